@@ -58,7 +58,7 @@ CREATE TABLE IF NOT EXISTS Chunks (
     access_count INTEGER DEFAULT 0,     -- For LRU caching
     last_accessed DATETIME DEFAULT CURRENT_TIMESTAMP,
     checksum TEXT,                      -- For integrity checking
-    compression_type TEXT DEFAULT 'zlib', -- zlib, lz4, none
+    compression_type TEXT DEFAULT 'none', -- ChunkCodec name: none, lz4, zstd ('zlib' rows are uncompressed)
     uncompressed_size INTEGER DEFAULT 0,
     UNIQUE(world_id, chunk_x, chunk_y, chunk_z),
     FOREIGN KEY (world_id) REFERENCES WorldMeta(world_id) ON DELETE CASCADE
@@ -71,6 +71,17 @@ CREATE INDEX IF NOT EXISTS idx_chunk_dirty ON Chunks(is_dirty);
 CREATE INDEX IF NOT EXISTS idx_chunk_priority ON Chunks(load_priority DESC);
 CREATE INDEX IF NOT EXISTS idx_chunk_access ON Chunks(last_accessed);
 
+-- Trained compression dictionaries (zstd frames name the dictionary they need)
+CREATE TABLE IF NOT EXISTS ChunkDictionaries (
+    world_id INTEGER NOT NULL,
+    dictionary_id INTEGER NOT NULL,
+    codec TEXT NOT NULL,
+    data BLOB NOT NULL,
+    created_at INTEGER NOT NULL,
+    PRIMARY KEY (world_id, dictionary_id),
+    FOREIGN KEY (world_id) REFERENCES WorldMeta(world_id) ON DELETE CASCADE
+);
+
 -- ============================================================================
 -- ENTITIES (Players, NPCs, Buildings, Items, Projectiles)
 -- ============================================================================
@@ -448,6 +459,8 @@ CREATE TABLE IF NOT EXISTS SchemaMigrations (
 -- Record initial schema version
 INSERT OR IGNORE INTO SchemaMigrations (version, description)
 VALUES (1, 'Initial world persistence schema');
+INSERT OR IGNORE INTO SchemaMigrations (version, description)
+VALUES (2, 'Chunk compression dictionaries');
 
 -- ============================================================================
 -- VIEWS (Convenient queries)
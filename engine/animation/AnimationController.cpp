@@ -1,17 +1,99 @@
 #include "animation/AnimationController.hpp"
+#include "animation/blending/BlendMask.hpp"
 #include <algorithm>
 #include <cmath>
 
 namespace Nova {
 
-AnimationController::AnimationController(Skeleton* skeleton)
-    : m_skeleton(skeleton)
-{}
+AnimationController::AnimationController(Skeleton* skeleton) {
+    SetSkeleton(skeleton);
+}
+
+void AnimationController::SetSkeleton(Skeleton* skeleton) {
+    m_skeleton = skeleton;
+    RebuildBindings();
+}
 
 void AnimationController::AddAnimation(const std::string& name, std::shared_ptr<Animation> animation) {
+    auto existing = m_animations.find(name);
+    if (existing != m_animations.end() && existing->second && existing->second != animation) {
+        ReleaseAnimation(existing->second.get(), name, animation.get());
+    }
+
+    // Retarget to bone indices now rather than resolving names every frame
+    if (m_skeleton && animation) {
+        m_bindings.try_emplace(animation.get(), *animation, *m_skeleton);
+    }
     m_animations[name] = std::move(animation);
 }
 
+void AnimationController::ReleaseAnimation(const Animation* animation, const std::string& name,
+                                           const Animation* replacement) {
+    for (const auto& [otherName, other] : m_animations) {
+        if (other.get() == animation && otherName != name) {
+            return;  // Still in the library under another name
+        }
+    }
+
+    // Bindings are keyed by address, which a clip allocated later may reuse
+    m_bindings.erase(animation);
+
+    // Instances of the old clip carry on with its replacement, or stop
+    if (!replacement) {
+        std::erase_if(m_activeAnimations, [animation](const AnimationInstance& instance) {
+            return instance.animation == animation;
+        });
+        return;
+    }
+    for (auto& instance : m_activeAnimations) {
+        if (instance.animation == animation) {
+            instance.animation = replacement;
+            instance.binding = GetBinding(replacement);
+            instance.keyCursors.assign(instance.binding ? instance.binding->GetBoneCount() : 0, 0);
+        }
+    }
+}
+
+void AnimationController::RebuildBindings() {
+    m_bindings.clear();
+    m_blendedTransformsDirty = true;
+
+    if (!m_skeleton) {
+        m_pose.Resize(0);
+        for (auto& instance : m_activeAnimations) {
+            instance.binding = nullptr;
+        }
+        return;
+    }
+
+    for (const auto& [name, animation] : m_animations) {
+        if (animation) {
+            m_bindings.try_emplace(animation.get(), *animation, *m_skeleton);
+        }
+    }
+
+    PoseOps::SetRestPose(*m_skeleton, m_restPose);
+    m_pose = m_restPose;
+    m_layerPose.Resize(m_skeleton->GetBoneCount());
+    m_samplePose.Resize(m_skeleton->GetBoneCount());
+
+    for (auto& instance : m_activeAnimations) {
+        instance.binding = GetBinding(instance.animation);
+        instance.keyCursors.assign(m_skeleton->GetBoneCount(), 0);
+    }
+}
+
+const ClipBinding* AnimationController::GetBinding(const Animation* animation) {
+    if (!m_skeleton || !animation) {
+        return nullptr;
+    }
+    auto it = m_bindings.find(animation);
+    if (it == m_bindings.end()) {
+        it = m_bindings.try_emplace(animation, *animation, *m_skeleton).first;
+    }
+    return &it->second;
+}
+
 Animation* AnimationController::GetAnimation(const std::string& name) {
     auto it = m_animations.find(name);
     return it != m_animations.end() ? it->second.get() : nullptr;
@@ -23,13 +105,22 @@ const Animation* AnimationController::GetAnimation(const std::string& name) cons
 }
 
 void AnimationController::Play(const std::string& name, float blendTime, bool looping) {
+    PlayOnLayer(0, name, blendTime, looping);
+}
+
+void AnimationController::PlayOnLayer(size_t layerIndex, const std::string& name, float blendTime, bool looping) {
     const Animation* anim = GetAnimation(name);
     if (!anim) {
         return;
     }
 
-    // Mark existing animations for blend out
+    GetOrAddLayer(layerIndex);
+
+    // Mark existing animations on this layer for blend out
     for (auto& instance : m_activeAnimations) {
+        if (instance.layer != layerIndex) {
+            continue;
+        }
         if (instance.state == AnimationState::Playing ||
             instance.state == AnimationState::BlendingIn) {
             instance.state = AnimationState::BlendingOut;
@@ -44,6 +135,11 @@ void AnimationController::Play(const std::string& name, float blendTime, bool lo
     newInstance.currentTime = 0.0f;
     newInstance.playbackSpeed = m_playbackSpeed;
     newInstance.looping = looping;
+    newInstance.layer = layerIndex;
+    newInstance.binding = GetBinding(anim);
+    if (newInstance.binding) {
+        newInstance.keyCursors.assign(newInstance.binding->GetBoneCount(), 0);
+    }
 
     if (blendTime > 0.0f) {
         newInstance.weight = 0.0f;
@@ -56,8 +152,10 @@ void AnimationController::Play(const std::string& name, float blendTime, bool lo
         newInstance.state = AnimationState::Playing;
     }
 
-    m_activeAnimations.push_back(newInstance);
-    m_currentAnimationName = name;
+    m_activeAnimations.push_back(std::move(newInstance));
+    if (layerIndex == 0) {
+        m_currentAnimationName = name;
+    }
     m_playing = true;
 }
 
@@ -102,16 +200,56 @@ void AnimationController::Update(float deltaTime) {
         return;
     }
 
+    Advance(deltaTime);
+    Evaluate();
+}
+
+void AnimationController::Advance(float deltaTime) {
+    if (!m_playing && m_activeAnimations.empty()) {
+        return;
+    }
+
     // Update each animation instance
     for (auto& instance : m_activeAnimations) {
         UpdateInstance(instance, deltaTime);
     }
 
-    // Blend animations together
+    // Remove finished animations (they have no weight left, so sampling never sees them)
+    CleanupFinishedAnimations();
+}
+
+void AnimationController::Evaluate() {
     BlendAnimations();
+}
 
-    // Remove finished animations
-    CleanupFinishedAnimations();
+const Animation* AnimationController::GetSingleClip(float& outTime) const {
+    if (!m_skeleton) {
+        return nullptr;
+    }
+
+    const AnimationInstance* single = nullptr;
+    for (const auto& instance : m_activeAnimations) {
+        if (instance.weight <= 0.0f || !instance.binding) {
+            continue;
+        }
+        if (single) {
+            return nullptr;
+        }
+        single = &instance;
+    }
+    if (!single) {
+        return nullptr;
+    }
+
+    // Mirrors the base-layer shortcut in BlendAnimations(): the sample replaces the pose
+    const Layer defaults;
+    const Layer& layer = single->layer < m_layers.size() ? m_layers[single->layer] : defaults;
+    if (layer.blendMode == BlendMode::Additive || layer.mask || layer.weight < 1.0f) {
+        return nullptr;
+    }
+
+    outTime = single->currentTime;
+    return single->animation;
 }
 
 void AnimationController::UpdateInstance(AnimationInstance& instance, float deltaTime) {
@@ -169,48 +307,87 @@ void AnimationController::UpdateInstance(AnimationInstance& instance, float delt
 }
 
 void AnimationController::BlendAnimations() {
-    m_blendedTransforms.clear();
+    if (!m_skeleton) {
+        return;
+    }
+    if (m_pose.GetBoneCount() != m_skeleton->GetBoneCount()) {
+        RebuildBindings();
+    }
+    m_blendedTransformsDirty = true;
 
-    // Calculate total weight for normalization
-    float totalWeight = 0.0f;
+    size_t layerCount = 0;
     for (const auto& instance : m_activeAnimations) {
-        if (instance.weight > 0.0f && instance.animation) {
-            totalWeight += instance.weight;
+        layerCount = std::max(layerCount, instance.layer + 1);
+    }
+
+    // Bones no layer drives stay in the rest pose
+    bool hasBase = false;
+    for (size_t layerIndex = 0; layerIndex < layerCount; ++layerIndex) {
+        float layerTotalWeight = 0.0f;
+        if (!SampleLayer(layerIndex, layerTotalWeight)) {
+            continue;
+        }
+
+        const Layer defaults;
+        const Layer& layer = layerIndex < m_layers.size() ? m_layers[layerIndex] : defaults;
+
+        std::span<const float> boneWeights;
+        if (layer.mask) {
+            PoseOps::FillBoneWeights(layer.mask->GetWeights(), m_skeleton->GetBoneCount(), m_maskWeights);
+            boneWeights = m_maskWeights;
+        }
+
+        // The lowest active layer renormalizes its crossfade, so at full weight it covers the rest pose
+        const bool isBase = !hasBase;
+        if (isBase && layer.blendMode != BlendMode::Additive && !layer.mask && layer.weight >= 1.0f) {
+            std::swap(m_pose, m_layerPose);
+            hasBase = true;
+            continue;
+        }
+        if (!hasBase) {
+            m_pose = m_restPose;
+            hasBase = true;
+        }
+
+        // Layers above the base fade in and out with their own instances' weights
+        const float weight = layer.weight * (isBase ? 1.0f : std::min(layerTotalWeight, 1.0f));
+        if (weight <= 0.0f) {
+            continue;
+        }
+
+        if (layer.blendMode == BlendMode::Additive) {
+            PoseOps::BlendAdditive(m_pose, m_layerPose, weight, boneWeights, m_pose);
+        } else if (boneWeights.empty()) {
+            PoseOps::Blend(m_pose, m_layerPose, weight, m_pose);
+        } else {
+            PoseOps::Blend(m_pose, m_layerPose, weight, boneWeights, m_pose);
         }
     }
 
-    if (totalWeight <= 0.0f) {
-        return;
+    if (!hasBase) {
+        m_pose = m_restPose;
     }
+}
 
-    // First pass: accumulate weighted transforms
-    bool firstAnimation = true;
-    for (const auto& instance : m_activeAnimations) {
-        if (instance.weight <= 0.0f || !instance.animation) {
+bool AnimationController::SampleLayer(size_t layerIndex, float& outWeight) {
+    // Crossfade: running weighted average of the layer's instances
+    outWeight = 0.0f;
+    bool sampled = false;
+    for (auto& instance : m_activeAnimations) {
+        if (instance.layer != layerIndex || instance.weight <= 0.0f || !instance.binding) {
             continue;
         }
 
-        float normalizedWeight = instance.weight / totalWeight;
-        auto transforms = instance.animation->Evaluate(instance.currentTime);
-
-        if (firstAnimation) {
-            // First animation: just copy with weight
-            for (const auto& [boneName, transform] : transforms) {
-                m_blendedTransforms[boneName] = transform;
-            }
-            firstAnimation = false;
+        outWeight += instance.weight;
+        if (!sampled) {
+            instance.binding->Sample(instance.currentTime, m_layerPose, instance.keyCursors);
+            sampled = true;
         } else {
-            // Subsequent animations: blend based on mode
-            for (const auto& [boneName, transform] : transforms) {
-                auto it = m_blendedTransforms.find(boneName);
-                if (it != m_blendedTransforms.end()) {
-                    it->second = BlendTransforms(it->second, transform, normalizedWeight);
-                } else {
-                    m_blendedTransforms[boneName] = transform;
-                }
-            }
+            instance.binding->Sample(instance.currentTime, m_samplePose, instance.keyCursors);
+            PoseOps::Blend(m_layerPose, m_samplePose, instance.weight / outWeight, m_layerPose);
         }
     }
+    return sampled;
 }
 
 void AnimationController::CleanupFinishedAnimations() {
@@ -231,14 +408,30 @@ std::vector<glm::mat4> AnimationController::GetBoneMatrices() const {
     if (!m_skeleton) {
         return {};
     }
-    return m_skeleton->CalculateBoneMatrices(m_blendedTransforms);
+    std::vector<glm::mat4> matrices(m_skeleton->GetBoneCount());
+    GetBoneMatricesInto(matrices);
+    return matrices;
 }
 
 void AnimationController::GetBoneMatricesInto(std::span<glm::mat4> outMatrices) const {
     if (!m_skeleton) {
         return;
     }
-    m_skeleton->CalculateBoneMatricesInto(m_blendedTransforms, outMatrices);
+    m_skeleton->CalculateBoneMatricesInto(m_pose, outMatrices);
+}
+
+const std::unordered_map<std::string, glm::mat4>& AnimationController::GetBoneTransforms() const {
+    if (m_blendedTransformsDirty) {
+        m_blendedTransforms.clear();
+        if (m_skeleton) {
+            const auto& bones = m_skeleton->GetBones();
+            for (size_t bone = 0; bone < bones.size() && bone < m_pose.GetBoneCount(); ++bone) {
+                m_blendedTransforms[bones[bone].name] = m_pose.GetLocalMatrix(bone);
+            }
+        }
+        m_blendedTransformsDirty = false;
+    }
+    return m_blendedTransforms;
 }
 
 float AnimationController::GetCurrentTime() const {
@@ -257,15 +450,31 @@ void AnimationController::SetCurrentTime(float time) {
     }
 }
 
-void AnimationController::SetLayerWeight(size_t layerIndex, float weight) {
-    if (layerIndex >= m_layerWeights.size()) {
-        m_layerWeights.resize(layerIndex + 1, 1.0f);
+AnimationController::Layer& AnimationController::GetOrAddLayer(size_t layerIndex) {
+    if (layerIndex >= m_layers.size()) {
+        m_layers.resize(layerIndex + 1);
     }
-    m_layerWeights[layerIndex] = std::clamp(weight, 0.0f, 1.0f);
+    return m_layers[layerIndex];
+}
+
+void AnimationController::SetLayerWeight(size_t layerIndex, float weight) {
+    GetOrAddLayer(layerIndex).weight = std::clamp(weight, 0.0f, 1.0f);
 }
 
 float AnimationController::GetLayerWeight(size_t layerIndex) const {
-    return layerIndex < m_layerWeights.size() ? m_layerWeights[layerIndex] : 1.0f;
+    return layerIndex < m_layers.size() ? m_layers[layerIndex].weight : 1.0f;
+}
+
+void AnimationController::SetLayerBlendMode(size_t layerIndex, BlendMode mode) {
+    GetOrAddLayer(layerIndex).blendMode = mode;
+}
+
+BlendMode AnimationController::GetLayerBlendMode(size_t layerIndex) const {
+    return layerIndex < m_layers.size() ? m_layers[layerIndex].blendMode : BlendMode::Override;
+}
+
+void AnimationController::SetLayerMask(size_t layerIndex, std::shared_ptr<const BlendMask> mask) {
+    GetOrAddLayer(layerIndex).mask = std::move(mask);
 }
 
 // AnimationStateMachine implementation
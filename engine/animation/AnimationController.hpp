@@ -2,6 +2,7 @@
 
 #include "animation/Animation.hpp"
 #include "animation/Skeleton.hpp"
+#include "animation/Pose.hpp"
 #include <vector>
 #include <string>
 #include <memory>
@@ -10,6 +11,8 @@
 
 namespace Nova {
 
+class BlendMask;
+
 /**
  * @brief Animation playback state
  */
@@ -36,6 +39,11 @@ struct AnimationInstance {
 
     // Blend settings
     BlendMode blendMode = BlendMode::Override;
+    size_t layer = 0;
+
+    // Bone-indexed sampling state
+    const ClipBinding* binding = nullptr;
+    std::vector<uint32_t> keyCursors;
 
     // Callbacks
     std::function<void()> onAnimationEnd;
@@ -46,7 +54,11 @@ struct AnimationInstance {
  * @brief Controls animation playback, blending, and state management
  *
  * Supports multiple concurrent animations with blending, layers,
- * and crossfade transitions.
+ * and crossfade transitions. Clips are bound to the skeleton's bone indices
+ * when added (or when the skeleton changes), and every update samples and
+ * blends SoA poses: crossfades within a layer, then each layer over the
+ * ones below it through its weight, blend mode and optional BlendMask.
+ * Evaluation requires a skeleton.
  */
 class AnimationController {
 public:
@@ -61,11 +73,15 @@ public:
     /**
      * @brief Set the skeleton to animate
      */
-    void SetSkeleton(Skeleton* skeleton) { m_skeleton = skeleton; }
+    void SetSkeleton(Skeleton* skeleton);
     [[nodiscard]] Skeleton* GetSkeleton() const { return m_skeleton; }
 
     /**
      * @brief Add an animation to the controller's library
+     *
+     * Adding under an existing name replaces that clip: its binding is
+     * released and instances playing it continue with the new clip (or stop
+     * if animation is null).
      */
     void AddAnimation(const std::string& name, std::shared_ptr<Animation> animation);
 
@@ -83,6 +99,12 @@ public:
      */
     void Play(const std::string& name, float blendTime = 0.2f, bool looping = true);
 
+    /**
+     * @brief Play an animation on a layer, crossfading only that layer
+     * @param layerIndex Layer 0 is the base; higher layers apply on top
+     */
+    void PlayOnLayer(size_t layerIndex, const std::string& name, float blendTime = 0.2f, bool looping = true);
+
     /**
      * @brief Crossfade to another animation
      */
@@ -106,15 +128,47 @@ public:
     /**
      * @brief Update animation state
      * @param deltaTime Time since last update in seconds
+     *
+     * Equivalent to Advance() followed by Evaluate().
      */
     void Update(float deltaTime);
 
     /**
-     * @brief Get the blended bone transforms
+     * @brief Advance playback time, blend weights and callbacks without sampling
+     *
+     * Cheap enough to run every frame for every unit; schedulers such as
+     * CrowdAnimator call Evaluate() less often.
+     */
+    void Advance(float deltaTime);
+
+    /**
+     * @brief Sample and blend the active animations into the pose at their current times
+     */
+    void Evaluate();
+
+    /**
+     * @brief The clip that alone determines the pose, if there is one
+     *
+     * Set when exactly one instance has weight and its layer replaces the
+     * rest pose outright (override, full weight, no mask). Two controllers on
+     * the same skeleton reporting the same clip and time evaluate to the same
+     * pose.
+     *
+     * @param outTime Receives the clip time
+     * @return nullptr while blending, layering or idle
+     */
+    [[nodiscard]] const Animation* GetSingleClip(float& outTime) const;
+
+    /**
+     * @brief Get the blended local pose (bone-indexed)
+     */
+    [[nodiscard]] const Pose& GetPose() const { return m_pose; }
+
+    /**
+     * @brief Get the blended local transforms keyed by bone name
+     * @note Built on demand for tools; runtime code should use GetPose()
      */
-    [[nodiscard]] const std::unordered_map<std::string, glm::mat4>& GetBoneTransforms() const {
-        return m_blendedTransforms;
-    }
+    [[nodiscard]] const std::unordered_map<std::string, glm::mat4>& GetBoneTransforms() const;
 
     /**
      * @brief Get final bone matrices ready for GPU upload
@@ -158,27 +212,57 @@ public:
     void SetLayerWeight(size_t layerIndex, float weight);
     [[nodiscard]] float GetLayerWeight(size_t layerIndex) const;
 
+    /**
+     * @brief How a layer combines with the layers below it (Override or Additive)
+     */
+    void SetLayerBlendMode(size_t layerIndex, BlendMode mode);
+    [[nodiscard]] BlendMode GetLayerBlendMode(size_t layerIndex) const;
+
+    /**
+     * @brief Restrict a layer to the bones of a mask (nullptr for full body)
+     */
+    void SetLayerMask(size_t layerIndex, std::shared_ptr<const BlendMask> mask);
+
 private:
+    struct Layer {
+        float weight = 1.0f;
+        BlendMode blendMode = BlendMode::Override;
+        std::shared_ptr<const BlendMask> mask;
+    };
+
+    Layer& GetOrAddLayer(size_t layerIndex);
+    void RebuildBindings();
+    const ClipBinding* GetBinding(const Animation* animation);
+    void ReleaseAnimation(const Animation* animation, const std::string& name, const Animation* replacement);
     void UpdateInstance(AnimationInstance& instance, float deltaTime);
     void BlendAnimations();
+    bool SampleLayer(size_t layerIndex, float& outWeight);
     void CleanupFinishedAnimations();
 
     Skeleton* m_skeleton = nullptr;
     std::unordered_map<std::string, std::shared_ptr<Animation>> m_animations;
+    std::unordered_map<const Animation*, ClipBinding> m_bindings;
 
     // Active animation instances (supports blending multiple)
     std::vector<AnimationInstance> m_activeAnimations;
 
-    // Blended result
-    std::unordered_map<std::string, glm::mat4> m_blendedTransforms;
+    // Blended result and per-update scratch
+    Pose m_pose;
+    Pose m_restPose;
+    Pose m_layerPose;
+    Pose m_samplePose;
+    BoneWeights m_maskWeights;
+
+    // Name-keyed view of m_pose, rebuilt lazily by GetBoneTransforms()
+    mutable std::unordered_map<std::string, glm::mat4> m_blendedTransforms;
+    mutable bool m_blendedTransformsDirty = true;
 
     // Playback state
     bool m_playing = false;
     float m_playbackSpeed = 1.0f;
     std::string m_currentAnimationName;
 
-    // Layer weights for masked blending
-    std::vector<float> m_layerWeights;
+    std::vector<Layer> m_layers;
 };
 
 /**
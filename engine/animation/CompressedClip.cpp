@@ -0,0 +1,411 @@
+#include "animation/CompressedClip.hpp"
+#include "animation/Skeleton.hpp"
+#include <cassert>
+#include <cstring>
+
+namespace Nova {
+
+namespace {
+
+constexpr uint32_t kSerialMagic = 0x50434E4E;  // "NNCP"
+constexpr uint32_t kSerialVersion = 1;
+
+template<typename T>
+T ReadUnaligned(const uint8_t* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+void WriteBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+template<typename T>
+void WriteValue(std::vector<uint8_t>& out, const T& value) {
+    WriteBytes(out, &value, sizeof(T));
+}
+
+template<typename T>
+void WriteArray(std::vector<uint8_t>& out, const std::vector<T>& values) {
+    WriteValue(out, static_cast<uint32_t>(values.size()));
+    WriteBytes(out, values.data(), values.size() * sizeof(T));
+}
+
+void WriteString(std::vector<uint8_t>& out, const std::string& value) {
+    WriteValue(out, static_cast<uint32_t>(value.size()));
+    WriteBytes(out, value.data(), value.size());
+}
+
+/**
+ * @brief Bounds-checked cursor over serialized clip data
+ */
+class Reader {
+public:
+    explicit Reader(std::span<const uint8_t> data) : m_data(data) {}
+
+    [[nodiscard]] bool Ok() const noexcept { return m_ok; }
+
+    template<typename T>
+    T Value() {
+        T value{};
+        Bytes(&value, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    void Array(std::vector<T>& out) {
+        const uint32_t count = Value<uint32_t>();
+        if (!m_ok || count > (m_data.size() - m_offset) / sizeof(T)) {
+            m_ok = false;
+            return;
+        }
+        out.resize(count);
+        Bytes(out.data(), count * sizeof(T));
+    }
+
+    void String(std::string& out) {
+        const uint32_t length = Value<uint32_t>();
+        if (!m_ok || length > m_data.size() - m_offset) {
+            m_ok = false;
+            return;
+        }
+        out.assign(reinterpret_cast<const char*>(m_data.data() + m_offset), length);
+        m_offset += length;
+    }
+
+private:
+    void Bytes(void* out, size_t size) {
+        if (!m_ok || size > m_data.size() - m_offset) {
+            m_ok = false;
+            return;
+        }
+        std::memcpy(out, m_data.data() + m_offset, size);
+        m_offset += size;
+    }
+
+    std::span<const uint8_t> m_data;
+    size_t m_offset = 0;
+    bool m_ok = true;
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// CompressedClip
+// ============================================================================
+
+glm::vec3 CompressedClip::GetConstantTranslation(const Track& track) const {
+    assert(track.translation == ChannelMode::Constant);
+    const float* c = m_constants.data() + track.constantOffset;
+    return glm::vec3(c[0], c[1], c[2]);
+}
+
+glm::quat CompressedClip::GetConstantRotation(const Track& track) const {
+    assert(track.rotation == ChannelMode::Constant);
+    const float* c = m_constants.data() + track.constantOffset +
+                     (track.translation == ChannelMode::Constant ? 3 : 0);
+    return glm::quat(c[3], c[0], c[1], c[2]);
+}
+
+glm::vec3 CompressedClip::GetConstantScale(const Track& track) const {
+    assert(track.scale == ChannelMode::Constant);
+    const float* c = m_constants.data() + track.constantOffset +
+                     (track.translation == ChannelMode::Constant ? 3 : 0) +
+                     (track.rotation == ChannelMode::Constant ? 4 : 0);
+    return glm::vec3(c[0], c[1], c[2]);
+}
+
+size_t CompressedClip::GetMemoryUsage() const {
+    size_t bytes = sizeof(*this) + m_name.size();
+    for (const Track& track : m_tracks) {
+        bytes += sizeof(Track) + track.boneName.size();
+    }
+    bytes += m_channels.size() * sizeof(AnimatedChannel);
+    bytes += m_constants.size() * sizeof(float);
+    bytes += m_segmentOffsets.size() * sizeof(uint32_t);
+    bytes += m_segmentData.size();
+    return bytes;
+}
+
+std::vector<uint8_t> CompressedClip::Serialize() const {
+    std::vector<uint8_t> out;
+    out.reserve(m_segmentData.size() + m_constants.size() * sizeof(float) + 256);
+
+    WriteValue(out, kSerialMagic);
+    WriteValue(out, kSerialVersion);
+    WriteString(out, m_name);
+    WriteValue(out, m_duration);
+    WriteValue(out, m_frameDuration);
+    WriteValue(out, m_frameCount);
+    WriteValue(out, m_segmentFrames);
+
+    WriteValue(out, static_cast<uint32_t>(m_tracks.size()));
+    for (const Track& track : m_tracks) {
+        WriteString(out, track.boneName);
+        WriteValue(out, track.translation);
+        WriteValue(out, track.rotation);
+        WriteValue(out, track.scale);
+        WriteValue(out, track.constantOffset);
+    }
+
+    WriteArray(out, m_channels);
+    WriteArray(out, m_constants);
+    WriteArray(out, m_segmentOffsets);
+    WriteArray(out, m_segmentData);
+    return out;
+}
+
+bool CompressedClip::Deserialize(std::span<const uint8_t> data, CompressedClip& outClip) {
+    Reader reader(data);
+    if (reader.Value<uint32_t>() != kSerialMagic || reader.Value<uint32_t>() != kSerialVersion) {
+        return false;
+    }
+
+    CompressedClip clip;
+    reader.String(clip.m_name);
+    clip.m_duration = reader.Value<float>();
+    clip.m_frameDuration = reader.Value<float>();
+    clip.m_frameCount = reader.Value<uint32_t>();
+    clip.m_segmentFrames = reader.Value<uint32_t>();
+
+    const uint32_t trackCount = reader.Value<uint32_t>();
+    if (!reader.Ok() || trackCount > data.size()) {
+        return false;
+    }
+    clip.m_tracks.resize(trackCount);
+    for (Track& track : clip.m_tracks) {
+        reader.String(track.boneName);
+        track.translation = reader.Value<ChannelMode>();
+        track.rotation = reader.Value<ChannelMode>();
+        track.scale = reader.Value<ChannelMode>();
+        track.constantOffset = reader.Value<uint32_t>();
+    }
+
+    reader.Array(clip.m_channels);
+    reader.Array(clip.m_constants);
+    reader.Array(clip.m_segmentOffsets);
+    reader.Array(clip.m_segmentData);
+    if (!reader.Ok() || clip.m_segmentFrames == 0 || clip.m_segmentFrames > 254) {
+        return false;
+    }
+
+    // Enum values and constant offsets must be ones Serialize() could have written
+    for (const Track& track : clip.m_tracks) {
+        uint64_t constantCount = 0;
+        for (const ChannelMode mode : {track.translation, track.rotation, track.scale}) {
+            if (mode > ChannelMode::Animated) {
+                return false;
+            }
+        }
+        constantCount += track.translation == ChannelMode::Constant ? 3 : 0;
+        constantCount += track.rotation == ChannelMode::Constant ? 4 : 0;
+        constantCount += track.scale == ChannelMode::Constant ? 3 : 0;
+        if (constantCount > 0 && uint64_t(track.constantOffset) + constantCount > clip.m_constants.size()) {
+            return false;
+        }
+    }
+    for (const AnimatedChannel& channel : clip.m_channels) {
+        if (channel.track >= clip.m_tracks.size() || channel.kind > ChannelKind::Scale) {
+            return false;
+        }
+    }
+
+    // Offsets must stay inside the data the sampler will read
+    for (size_t i = 0; i + 1 < clip.m_segmentOffsets.size(); ++i) {
+        if (clip.m_segmentOffsets[i] > clip.m_segmentOffsets[i + 1] ||
+            clip.m_segmentOffsets[i + 1] > clip.m_segmentData.size() ||
+            clip.m_segmentOffsets[i + 1] - clip.m_segmentOffsets[i] < clip.m_channels.size() * sizeof(uint32_t)) {
+            return false;
+        }
+
+        // Every channel block needs at least one key and must end inside its segment
+        const uint8_t* segment = clip.m_segmentData.data() + clip.m_segmentOffsets[i];
+        const uint64_t segmentSize = clip.m_segmentOffsets[i + 1] - clip.m_segmentOffsets[i];
+        for (size_t c = 0; c < clip.m_channels.size(); ++c) {
+            const uint64_t block = ReadUnaligned<uint32_t>(segment + c * sizeof(uint32_t));
+            if (block >= segmentSize) {
+                return false;
+            }
+            const uint64_t keyCount = segment[block];
+            const uint64_t rangeBytes = clip.m_channels[c].kind == ChannelKind::Rotation ? 0 : 6 * sizeof(float);
+            if (keyCount == 0 || block + 1 + keyCount + rangeBytes + keyCount * 3 * sizeof(uint16_t) > segmentSize) {
+                return false;
+            }
+        }
+    }
+
+    outClip = std::move(clip);
+    return true;
+}
+
+// ============================================================================
+// CompressedClipSampler
+// ============================================================================
+
+CompressedClipSampler::CompressedClipSampler(const CompressedClip& clip, const Skeleton& skeleton)
+    : m_clip(&clip)
+{
+    PoseOps::SetRestPose(skeleton, m_basePose);
+
+    // Bake constant and default channels into the base pose once
+    std::vector<int32_t> boneForTrack(clip.m_tracks.size(), -1);
+    for (size_t i = 0; i < clip.m_tracks.size(); ++i) {
+        const CompressedClip::Track& track = clip.m_tracks[i];
+        const int bone = skeleton.GetBoneIndex(track.boneName);
+        boneForTrack[i] = bone;
+        if (bone < 0) {
+            continue;
+        }
+
+        glm::vec3 translation = m_basePose.GetTranslation(bone);
+        glm::quat rotation = m_basePose.GetRotation(bone);
+        glm::vec3 scale = m_basePose.GetScale(bone);
+        using Mode = CompressedClip::ChannelMode;
+        if (track.translation != Mode::Animated) {
+            translation = track.translation == Mode::Constant ? clip.GetConstantTranslation(track) : glm::vec3(0.0f);
+        }
+        if (track.rotation != Mode::Animated) {
+            rotation = track.rotation == Mode::Constant ? clip.GetConstantRotation(track) : glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        }
+        if (track.scale != Mode::Animated) {
+            scale = track.scale == Mode::Constant ? clip.GetConstantScale(track) : glm::vec3(1.0f);
+        }
+        m_basePose.SetBone(bone, translation, rotation, scale);
+    }
+
+    // Channels of bones the skeleton lacks are never decoded
+    for (size_t c = 0; c < clip.m_channels.size(); ++c) {
+        const int32_t bone = boneForTrack[clip.m_channels[c].track];
+        if (bone >= 0) {
+            ChannelState state;
+            state.channel = static_cast<uint32_t>(c);
+            state.bone = static_cast<uint32_t>(bone);
+            state.kind = clip.m_channels[c].kind;
+            m_channels.push_back(state);
+        }
+    }
+}
+
+void CompressedClipSampler::Reset() {
+    m_segment = SIZE_MAX;
+}
+
+void CompressedClipSampler::EnterSegment(size_t segment) {
+    const uint8_t* base = m_clip->m_segmentData.data() + m_clip->m_segmentOffsets[segment];
+    for (ChannelState& state : m_channels) {
+        state.block = base + ReadUnaligned<uint32_t>(base + state.channel * sizeof(uint32_t));
+        state.key = 0;
+        state.decodedKey = UINT32_MAX;
+    }
+    m_segment = segment;
+}
+
+void CompressedClipSampler::DecodeKeys(ChannelState& state, uint32_t keyCount) {
+    // Block: keyCount, key frames, [range], packed values
+    const uint8_t* keyFrames = state.block + 1;
+    const uint8_t* values = keyFrames + keyCount;
+    const uint32_t next = std::min(state.key + 1, keyCount - 1);
+
+    state.decodedKey = state.key;
+    state.frame = static_cast<float>(keyFrames[state.key]);
+    const float span = static_cast<float>(keyFrames[next]) - state.frame;
+    state.inverseSpan = span > 0.0f ? 1.0f / span : 0.0f;
+
+    uint16_t a[3];
+    uint16_t b[3];
+    if (state.kind == CompressedClip::ChannelKind::Rotation) {
+        std::memcpy(a, values + state.key * 6, 6);
+        std::memcpy(b, values + next * 6, 6);
+        const glm::quat qa = ClipQuantization::UnpackRotation(a);
+        glm::quat qb = ClipQuantization::UnpackRotation(b);
+        if (glm::dot(qa, qb) < 0.0f) {
+            qb = -qb;  // Shortest arc, resolved once per key pair
+        }
+        state.from = glm::vec4(qa.x, qa.y, qa.z, qa.w);
+        state.to = glm::vec4(qb.x, qb.y, qb.z, qb.w);
+        return;
+    }
+
+    float range[6];
+    std::memcpy(range, values, sizeof(range));
+    std::memcpy(a, values + sizeof(range) + state.key * 6, 6);
+    std::memcpy(b, values + sizeof(range) + next * 6, 6);
+    for (int i = 0; i < 3; ++i) {
+        state.from[i] = ClipQuantization::DequantizeRange(a[i], range[i], range[3 + i]);
+        state.to[i] = ClipQuantization::DequantizeRange(b[i], range[i], range[3 + i]);
+    }
+}
+
+void CompressedClipSampler::Sample(float time, Pose& outPose) {
+    assert(m_clip && "Sampling without a clip");
+
+    outPose = m_basePose;
+    const size_t segmentCount = m_clip->GetSegmentCount();
+    if (m_channels.empty() || segmentCount == 0) {
+        return;
+    }
+
+    // Locate the segment and the frame position inside it
+    const float frames = m_clip->m_frameDuration > 0.0f
+        ? std::clamp(time, 0.0f, m_clip->m_duration) / m_clip->m_frameDuration
+        : 0.0f;
+    const float segmentFrames = static_cast<float>(m_clip->m_segmentFrames);
+    const size_t segment = std::min(static_cast<size_t>(frames / segmentFrames), segmentCount - 1);
+    const float local = frames - static_cast<float>(segment) * segmentFrames;
+
+    if (segment != m_segment) {
+        EnterSegment(segment);
+    }
+
+    float* translation[3] = {outPose.Data(Pose::TranslationX), outPose.Data(Pose::TranslationY),
+                             outPose.Data(Pose::TranslationZ)};
+    float* rotation[4] = {outPose.Data(Pose::RotationX), outPose.Data(Pose::RotationY),
+                          outPose.Data(Pose::RotationZ), outPose.Data(Pose::RotationW)};
+    float* scale[3] = {outPose.Data(Pose::ScaleX), outPose.Data(Pose::ScaleY), outPose.Data(Pose::ScaleZ)};
+
+    for (ChannelState& state : m_channels) {
+        const uint32_t keyCount = state.block[0];
+        const uint8_t* keyFrames = state.block + 1;
+
+        // Move the cursor forward; only a backwards seek restarts the segment
+        uint32_t key = state.key;
+        if (static_cast<float>(keyFrames[key]) > local) {
+            key = 0;
+        }
+        while (key + 2 < keyCount && static_cast<float>(keyFrames[key + 1]) <= local) {
+            ++key;
+        }
+        state.key = key;
+        if (key != state.decodedKey) {
+            DecodeKeys(state, keyCount);
+        }
+
+        const float alpha = std::clamp((local - state.frame) * state.inverseSpan, 0.0f, 1.0f);
+        const glm::vec4 value = state.from + (state.to - state.from) * alpha;
+        const uint32_t bone = state.bone;
+
+        switch (state.kind) {
+            case CompressedClip::ChannelKind::Rotation: {
+                const float inverseLength = 1.0f / std::sqrt(glm::dot(value, value));
+                for (int i = 0; i < 4; ++i) {
+                    rotation[i][bone] = value[i] * inverseLength;
+                }
+                break;
+            }
+            case CompressedClip::ChannelKind::Translation:
+                for (int i = 0; i < 3; ++i) {
+                    translation[i][bone] = value[i];
+                }
+                break;
+            case CompressedClip::ChannelKind::Scale:
+                for (int i = 0; i < 3; ++i) {
+                    scale[i][bone] = value[i];
+                }
+                break;
+        }
+    }
+}
+
+} // namespace Nova
@@ -0,0 +1,266 @@
+/**
+ * @file CompressedClip.hpp
+ * @brief Segmented, quantised animation clips and their cursor-based sampler
+ *
+ * A CompressedClip is produced offline by AnimationCompressor. The clip is
+ * resampled to a fixed frame rate and cut into segments of a few frames.
+ * Within a segment every animated channel keeps only the frames needed to
+ * stay inside its error bound, quantised to 16 bits per component
+ * (translation/scale relative to the segment's range, rotations as
+ * smallest-three). Channels that never move are stored once as constants,
+ * or dropped entirely when they hold the identity value.
+ *
+ * @code{.cpp}
+ * Nova::CompressedClipSampler sampler(clip, skeleton);  // at load time
+ * Nova::Pose pose;
+ * sampler.Sample(time, pose);                          // every frame
+ * @endcode
+ */
+
+#pragma once
+
+#include "animation/Pose.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Nova {
+
+class Skeleton;
+class AnimationCompressor;
+
+/**
+ * @brief Compressed, segment-based animation clip
+ */
+class CompressedClip {
+public:
+    /**
+     * @brief How one transform component of a track is stored
+     */
+    enum class ChannelMode : uint8_t {
+        Default,    ///< Identity value, nothing stored
+        Constant,   ///< One full-precision value for the whole clip
+        Animated    ///< Reduced, quantised keys per segment
+    };
+
+    enum class ChannelKind : uint8_t {
+        Translation,
+        Rotation,
+        Scale
+    };
+
+    /**
+     * @brief Per-bone track descriptor
+     */
+    struct Track {
+        std::string boneName;
+        ChannelMode translation = ChannelMode::Default;
+        ChannelMode rotation = ChannelMode::Default;
+        ChannelMode scale = ChannelMode::Default;
+        uint32_t constantOffset = 0;  ///< First float of this track's constants (T, R, S order)
+    };
+
+    /**
+     * @brief Animated channel, in the order segments store them
+     */
+    struct AnimatedChannel {
+        uint32_t track = 0;
+        ChannelKind kind = ChannelKind::Translation;
+    };
+
+    CompressedClip() = default;
+
+    [[nodiscard]] const std::string& GetName() const noexcept { return m_name; }
+    [[nodiscard]] float GetDuration() const noexcept { return m_duration; }
+    [[nodiscard]] float GetFrameDuration() const noexcept { return m_frameDuration; }
+    [[nodiscard]] uint32_t GetFrameCount() const noexcept { return m_frameCount; }
+    [[nodiscard]] uint32_t GetSegmentFrames() const noexcept { return m_segmentFrames; }
+    [[nodiscard]] size_t GetSegmentCount() const noexcept {
+        return m_segmentOffsets.empty() ? 0 : m_segmentOffsets.size() - 1;
+    }
+
+    [[nodiscard]] const std::vector<Track>& GetTracks() const noexcept { return m_tracks; }
+    [[nodiscard]] const std::vector<AnimatedChannel>& GetAnimatedChannels() const noexcept { return m_channels; }
+
+    /**
+     * @brief Constant value of a track component (Constant channels only)
+     */
+    [[nodiscard]] glm::vec3 GetConstantTranslation(const Track& track) const;
+    [[nodiscard]] glm::quat GetConstantRotation(const Track& track) const;
+    [[nodiscard]] glm::vec3 GetConstantScale(const Track& track) const;
+
+    /**
+     * @brief Bytes held by the clip, track names included
+     */
+    [[nodiscard]] size_t GetMemoryUsage() const;
+
+    /**
+     * @brief Flat binary form for engine asset files
+     */
+    [[nodiscard]] std::vector<uint8_t> Serialize() const;
+
+    /**
+     * @brief Read a clip written by Serialize()
+     * @return false if the data is truncated or malformed
+     */
+    static bool Deserialize(std::span<const uint8_t> data, CompressedClip& outClip);
+
+private:
+    friend class AnimationCompressor;
+    friend class CompressedClipSampler;
+
+    std::string m_name;
+    float m_duration = 0.0f;
+    float m_frameDuration = 0.0f;
+    uint32_t m_frameCount = 0;
+    uint32_t m_segmentFrames = 16;
+
+    std::vector<Track> m_tracks;
+    std::vector<AnimatedChannel> m_channels;
+    std::vector<float> m_constants;
+
+    // Segment i occupies [m_segmentOffsets[i], m_segmentOffsets[i + 1]) of m_segmentData and
+    // starts with one uint32 byte offset per animated channel
+    std::vector<uint32_t> m_segmentOffsets;
+    std::vector<uint8_t> m_segmentData;
+};
+
+/**
+ * @brief Key encodings shared by AnimationCompressor and CompressedClipSampler
+ *
+ * Translation and scale keys are 16-bit fractions of the segment's
+ * per-channel [min, min + extent] box. Rotations drop their largest
+ * component (recovered from unit length) and store the other three as
+ * 15-bit values in [-1/sqrt(2), 1/sqrt(2)]; the dropped index rides in the
+ * top bits of the first two words.
+ */
+namespace ClipQuantization {
+    inline constexpr float kRangeScale = 1.0f / 65535.0f;
+    inline constexpr float kSmallestThreeBound = 0.70710678f;
+    inline constexpr float kSmallestThreeMax = 32767.0f;
+
+    [[nodiscard]] inline uint16_t QuantizeRange(float value, float min, float extent) {
+        if (extent <= 0.0f) {
+            return 0;
+        }
+        const float unit = std::clamp((value - min) / extent, 0.0f, 1.0f);
+        return static_cast<uint16_t>(unit * 65535.0f + 0.5f);
+    }
+
+    [[nodiscard]] inline float DequantizeRange(uint16_t value, float min, float extent) {
+        return min + static_cast<float>(value) * (extent * kRangeScale);
+    }
+
+    inline void PackRotation(const glm::quat& rotation, uint16_t out[3]) {
+        const float components[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+        uint32_t largest = 0;
+        for (uint32_t i = 1; i < 4; ++i) {
+            if (std::abs(components[i]) > std::abs(components[largest])) {
+                largest = i;
+            }
+        }
+
+        // q and -q are the same rotation: make the dropped component positive
+        const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+        uint32_t word = 0;
+        for (uint32_t i = 0; i < 4; ++i) {
+            if (i == largest) {
+                continue;
+            }
+            const float unit = std::clamp(sign * components[i] / kSmallestThreeBound, -1.0f, 1.0f);
+            out[word++] = static_cast<uint16_t>(std::lround((unit * 0.5f + 0.5f) * kSmallestThreeMax));
+        }
+        out[0] = static_cast<uint16_t>(out[0] | ((largest & 2u) << 14));
+        out[1] = static_cast<uint16_t>(out[1] | ((largest & 1u) << 15));
+    }
+
+    [[nodiscard]] inline glm::quat UnpackRotation(const uint16_t in[3]) {
+        const uint32_t largest = ((in[0] >> 14) & 2u) | (in[1] >> 15);
+        float components[4];
+        float sumSquares = 0.0f;
+        uint32_t word = 0;
+        for (uint32_t i = 0; i < 4; ++i) {
+            if (i == largest) {
+                continue;
+            }
+            const float unit = static_cast<float>(in[word++] & 0x7FFFu) * (2.0f / kSmallestThreeMax) - 1.0f;
+            components[i] = unit * kSmallestThreeBound;
+            sumSquares += components[i] * components[i];
+        }
+        components[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSquares));
+        return glm::quat(components[3], components[0], components[1], components[2]);
+    }
+
+    /**
+     * @brief Shortest-arc normalised lerp, as the sampler interpolates keys
+     */
+    [[nodiscard]] inline glm::quat Nlerp(const glm::quat& a, const glm::quat& b, float t) {
+        const float sign = glm::dot(a, b) < 0.0f ? -1.0f : 1.0f;
+        return glm::normalize(a * (1.0f - t) + b * (sign * t));
+    }
+}
+
+/**
+ * @brief Decodes a CompressedClip into bone-indexed poses
+ *
+ * Binds the clip's tracks to a skeleton once. Constant and default channels
+ * are baked into a base pose at bind time, so sampling copies that pose and
+ * decodes only the animated channels. Each channel keeps a key cursor that
+ * moves forward with playback; a seek backwards or into another segment
+ * restarts from the segment's first key, so random access costs at most one
+ * segment's keys.
+ *
+ * Samplers hold playback state: use one per playing instance.
+ */
+class CompressedClipSampler {
+public:
+    CompressedClipSampler() = default;
+    CompressedClipSampler(const CompressedClip& clip, const Skeleton& skeleton);
+
+    [[nodiscard]] const CompressedClip* GetClip() const noexcept { return m_clip; }
+
+    /**
+     * @brief Decode every bone at a time (clamped to the clip's duration)
+     * @param outPose Resized to the skeleton's bone count if needed
+     */
+    void Sample(float time, Pose& outPose);
+
+    /**
+     * @brief Forget cursor state (next Sample seeks)
+     */
+    void Reset();
+
+private:
+    /**
+     * @brief Per animated channel playback state
+     *
+     * The key pair around the cursor stays decoded until the cursor moves,
+     * so most samples only interpolate.
+     */
+    struct ChannelState {
+        uint32_t channel = 0;
+        uint32_t bone = 0;
+        CompressedClip::ChannelKind kind = CompressedClip::ChannelKind::Translation;
+        const uint8_t* block = nullptr;     // This channel's block in the current segment
+        uint32_t key = 0;                   // Cursor: last key at or before the sample frame
+        uint32_t decodedKey = UINT32_MAX;   // Key whose pair is held in from/to
+        float frame = 0.0f;
+        float inverseSpan = 0.0f;
+        glm::vec4 from{0.0f};
+        glm::vec4 to{0.0f};
+    };
+
+    void EnterSegment(size_t segment);
+    void DecodeKeys(ChannelState& state, uint32_t keyCount);
+
+    const CompressedClip* m_clip = nullptr;
+    Pose m_basePose;
+
+    size_t m_segment = SIZE_MAX;
+    std::vector<ChannelState> m_channels;
+};
+
+} // namespace Nova
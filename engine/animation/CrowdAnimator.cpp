@@ -0,0 +1,178 @@
+#include "animation/CrowdAnimator.hpp"
+#include "animation/AnimationController.hpp"
+#include "core/JobSystem.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Nova {
+
+CrowdAnimator::CrowdAnimator(const CrowdAnimationSettings& settings)
+    : m_settings(settings)
+{}
+
+CrowdAnimator::InstanceId CrowdAnimator::Add(AnimationController* controller, std::span<glm::mat4> outMatrices) {
+    assert(controller && "CrowdAnimator needs a controller");
+
+    InstanceId id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    } else {
+        id = static_cast<InstanceId>(m_instances.size());
+        m_instances.emplace_back();
+    }
+
+    Instance& instance = m_instances[id];
+    instance = Instance{};
+    instance.controller = controller;
+    instance.matrices = outMatrices;
+    ++m_instanceCount;
+    return id;
+}
+
+void CrowdAnimator::Remove(InstanceId id) {
+    if (id >= m_instances.size() || !m_instances[id].controller) {
+        return;
+    }
+    m_instances[id] = Instance{};
+    m_freeIds.push_back(id);
+    --m_instanceCount;
+}
+
+void CrowdAnimator::SetMatrices(InstanceId id, std::span<glm::mat4> outMatrices) {
+    assert(id < m_instances.size() && m_instances[id].controller && "Unknown crowd instance");
+    m_instances[id].matrices = outMatrices;
+    m_instances[id].forceUpdate = true;
+}
+
+void CrowdAnimator::SetPosition(InstanceId id, const glm::vec3& position) {
+    assert(id < m_instances.size() && m_instances[id].controller && "Unknown crowd instance");
+    m_instances[id].position = position;
+}
+
+void CrowdAnimator::Invalidate(InstanceId id) {
+    assert(id < m_instances.size() && m_instances[id].controller && "Unknown crowd instance");
+    m_instances[id].forceUpdate = true;
+}
+
+uint32_t CrowdAnimator::IntervalForDistanceSq(float distanceSq) const {
+    uint32_t interval = 1;
+    for (float distance : m_settings.lodDistances) {
+        if (distanceSq <= distance * distance) {
+            break;
+        }
+        interval *= 2;
+    }
+    return interval;
+}
+
+uint32_t CrowdAnimator::GetUpdateInterval(InstanceId id, const glm::vec3& viewPosition) const {
+    assert(id < m_instances.size() && m_instances[id].controller && "Unknown crowd instance");
+    const glm::vec3 offset = m_instances[id].position - viewPosition;
+    return IntervalForDistanceSq(glm::dot(offset, offset));
+}
+
+void CrowdAnimator::Update(float deltaTime, const glm::vec3& viewPosition) {
+    m_stats = CrowdAnimationStats{};
+    m_stats.instances = m_instanceCount;
+
+    // Time, weights and callbacks stay on this thread and never skip a frame
+    for (Instance& instance : m_instances) {
+        if (instance.controller) {
+            instance.controller->Advance(deltaTime);
+        }
+    }
+
+    Schedule(viewPosition);
+
+    Run(m_leaders.size(), [this](size_t i) {
+        Instance& instance = m_instances[m_leaders[i]];
+        instance.controller->Evaluate();
+        instance.controller->GetBoneMatricesInto(instance.matrices);
+    });
+
+    Run(m_copies.size(), [this](size_t i) {
+        const auto [follower, leader] = m_copies[i];
+        const std::span<glm::mat4> source = m_instances[leader].matrices;
+        const std::span<glm::mat4> target = m_instances[follower].matrices;
+        std::copy_n(source.begin(), std::min(source.size(), target.size()), target.begin());
+    });
+
+    m_stats.evaluated = m_leaders.size();
+    m_stats.shared = m_copies.size();
+    m_stats.skipped = m_instanceCount - m_leaders.size() - m_copies.size();
+    ++m_frame;
+}
+
+void CrowdAnimator::Schedule(const glm::vec3& viewPosition) {
+    m_due.clear();
+    m_leaders.clear();
+    m_copies.clear();
+
+    const bool share = m_settings.phaseQuantum > 0.0f;
+    for (InstanceId id = 0; id < m_instances.size(); ++id) {
+        Instance& instance = m_instances[id];
+        if (!instance.controller) {
+            continue;
+        }
+
+        // Intervals are powers of two; offsetting by id staggers instances across frames
+        const glm::vec3 offset = instance.position - viewPosition;
+        const uint32_t interval = IntervalForDistanceSq(glm::dot(offset, offset));
+        if (!instance.forceUpdate && ((m_frame + id) & (interval - 1)) != 0) {
+            continue;
+        }
+        instance.forceUpdate = false;
+
+        Evaluation evaluation;
+        evaluation.skeleton = instance.controller->GetSkeleton();
+        evaluation.instance = id;
+        float time = 0.0f;
+        if (share && evaluation.skeleton) {
+            evaluation.clip = instance.controller->GetSingleClip(time);
+            evaluation.phase = static_cast<int64_t>(std::floor(time / m_settings.phaseQuantum));
+        }
+        m_due.push_back(evaluation);
+    }
+
+    // Group by skeleton and clip so batches touch the same data, and equal phases end up adjacent
+    std::sort(m_due.begin(), m_due.end(), [](const Evaluation& a, const Evaluation& b) {
+        if (a.skeleton != b.skeleton) {
+            return std::less<>{}(a.skeleton, b.skeleton);
+        }
+        if (a.clip != b.clip) {
+            return std::less<>{}(a.clip, b.clip);
+        }
+        if (a.phase != b.phase) {
+            return a.phase < b.phase;
+        }
+        return a.instance < b.instance;
+    });
+
+    for (size_t i = 0; i < m_due.size(); ++i) {
+        const Evaluation& evaluation = m_due[i];
+        const bool samePose = i > 0 && evaluation.clip &&
+                              evaluation.skeleton == m_due[i - 1].skeleton &&
+                              evaluation.clip == m_due[i - 1].clip &&
+                              evaluation.phase == m_due[i - 1].phase;
+        if (samePose) {
+            m_copies.emplace_back(evaluation.instance, m_leaders.back());
+        } else {
+            m_leaders.push_back(evaluation.instance);
+        }
+    }
+}
+
+void CrowdAnimator::Run(size_t count, const std::function<void(size_t)>& work) {
+    JobSystem& jobs = JobSystem::Instance();
+    if (m_settings.useJobSystem && jobs.IsInitialized()) {
+        jobs.ParallelFor(0, count, std::max<size_t>(m_settings.batchSize, 1), work);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        work(i);
+    }
+}
+
+} // namespace Nova
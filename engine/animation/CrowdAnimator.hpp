@@ -0,0 +1,176 @@
+/**
+ * @file CrowdAnimator.hpp
+ * @brief Batched animation update for large numbers of units
+ *
+ * Updating every AnimationController on its own, every frame, at full rate
+ * does not scale to battles with a thousand units. CrowdAnimator drives a
+ * set of registered controllers together:
+ *
+ * - Playback time advances every frame for every unit, so clips, callbacks
+ *   and state machines never fall behind.
+ * - Poses are re-evaluated at a rate chosen by distance from the viewer:
+ *   every frame up close, then every 2nd, 4th and 8th frame. Evaluation
+ *   uses the unit's current time, so a skipped unit catches up in one step.
+ *   Units are staggered so each frame evaluates a similar share.
+ * - Units playing a single clip on the same skeleton at the same quantised
+ *   phase share one evaluation; the others copy its skinning matrices.
+ * - Evaluations are ordered by skeleton and clip and fanned out over the
+ *   JobSystem in batches.
+ *
+ * Results go straight into each unit's bone-matrix buffer, the one
+ * AnimationController::GetBoneMatricesInto() would fill.
+ *
+ * @code{.cpp}
+ * Nova::CrowdAnimator crowd;
+ * auto id = crowd.Add(&unit.controller, unit.boneMatrices);
+ * crowd.SetPosition(id, unit.position);    // whenever the unit moves
+ * crowd.Update(deltaTime, cameraPosition); // once per frame
+ * @endcode
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace Nova {
+
+class Animation;
+class AnimationController;
+class Skeleton;
+
+/**
+ * @brief Tuning for CrowdAnimator
+ */
+struct CrowdAnimationSettings {
+    /// Beyond each distance the evaluation interval doubles: 2, 4, then 8 frames
+    std::array<float, 3> lodDistances = {30.0f, 60.0f, 120.0f};
+
+    /// Clip time bucket for pose sharing in seconds (0 disables sharing)
+    float phaseQuantum = 1.0f / 30.0f;
+
+    /// Evaluations per job
+    size_t batchSize = 16;
+
+    /// Fan batches out over JobSystem::Instance() when it is initialized
+    bool useJobSystem = true;
+};
+
+/**
+ * @brief What the last CrowdAnimator::Update() did
+ */
+struct CrowdAnimationStats {
+    size_t instances = 0;
+    size_t evaluated = 0;  ///< Full controller evaluations
+    size_t shared = 0;     ///< Matrices copied from an evaluation at the same phase
+    size_t skipped = 0;    ///< Kept last frame's matrices (reduced update rate)
+};
+
+/**
+ * @brief Schedules and batches AnimationController evaluation for crowds
+ *
+ * Controllers and matrix buffers are owned by the caller and must outlive
+ * their registration. Advance() and its callbacks run on the thread calling
+ * Update(); evaluation may run on job workers, so controllers must not be
+ * touched elsewhere during Update().
+ *
+ * Only the matrix buffer is kept current: a controller whose evaluation
+ * was skipped or shared keeps its previous GetPose().
+ */
+class CrowdAnimator {
+public:
+    using InstanceId = uint32_t;
+
+    CrowdAnimator() = default;
+    explicit CrowdAnimator(const CrowdAnimationSettings& settings);
+
+    CrowdAnimator(const CrowdAnimator&) = delete;
+    CrowdAnimator& operator=(const CrowdAnimator&) = delete;
+
+    void SetSettings(const CrowdAnimationSettings& settings) { m_settings = settings; }
+    [[nodiscard]] const CrowdAnimationSettings& GetSettings() const noexcept { return m_settings; }
+
+    /**
+     * @brief Register a controller and the buffer its skinning matrices go to
+     * @param outMatrices At least one matrix per bone of the controller's skeleton
+     * @return Id for SetPosition() and Remove(); evaluated on the next Update()
+     */
+    InstanceId Add(AnimationController* controller, std::span<glm::mat4> outMatrices);
+
+    /**
+     * @brief Unregister an instance (its id may be reused)
+     */
+    void Remove(InstanceId id);
+
+    /**
+     * @brief Point the instance at a new matrix buffer (evaluated on the next Update())
+     */
+    void SetMatrices(InstanceId id, std::span<glm::mat4> outMatrices);
+
+    /**
+     * @brief World position used to pick the instance's update rate
+     */
+    void SetPosition(InstanceId id, const glm::vec3& position);
+
+    /**
+     * @brief Evaluate on the next Update() regardless of distance
+     *
+     * Call after an abrupt change such as a teleport or a new animation.
+     */
+    void Invalidate(InstanceId id);
+
+    /**
+     * @brief Advance every instance and refresh the matrices that are due
+     * @param viewPosition Point distances are measured from, usually the camera
+     */
+    void Update(float deltaTime, const glm::vec3& viewPosition);
+
+    /**
+     * @brief Evaluation interval in frames for an instance (1, 2, 4 or 8)
+     */
+    [[nodiscard]] uint32_t GetUpdateInterval(InstanceId id, const glm::vec3& viewPosition) const;
+
+    [[nodiscard]] size_t GetInstanceCount() const noexcept { return m_instanceCount; }
+    [[nodiscard]] const CrowdAnimationStats& GetStats() const noexcept { return m_stats; }
+
+private:
+    struct Instance {
+        AnimationController* controller = nullptr;
+        std::span<glm::mat4> matrices;
+        glm::vec3 position{0.0f};
+        bool forceUpdate = true;
+    };
+
+    /**
+     * @brief One due instance, sorted so equal poses and equal clips are adjacent
+     */
+    struct Evaluation {
+        const Skeleton* skeleton = nullptr;
+        const Animation* clip = nullptr;  // Null when the pose is not shareable
+        int64_t phase = 0;
+        InstanceId instance = 0;
+    };
+
+    [[nodiscard]] uint32_t IntervalForDistanceSq(float distanceSq) const;
+    void Schedule(const glm::vec3& viewPosition);
+    void Run(size_t count, const std::function<void(size_t)>& work);
+
+    CrowdAnimationSettings m_settings;
+    std::vector<Instance> m_instances;
+    std::vector<InstanceId> m_freeIds;
+    size_t m_instanceCount = 0;
+    uint64_t m_frame = 0;
+
+    // Per-update work lists, reused across frames
+    std::vector<Evaluation> m_due;
+    std::vector<InstanceId> m_leaders;
+    std::vector<std::pair<InstanceId, InstanceId>> m_copies;  // (follower, leader)
+
+    CrowdAnimationStats m_stats;
+};
+
+} // namespace Nova
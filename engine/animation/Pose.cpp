@@ -0,0 +1,439 @@
+#include "animation/Pose.hpp"
+#include "animation/Skeleton.hpp"
+#include "core/SIMD.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Nova {
+
+namespace {
+
+using SIMD::FloatBatch;
+
+constexpr size_t kWidth = FloatBatch::Width;
+static_assert(Pose::kStrideMultiple % kWidth == 0, "Pose stride must hold whole batches");
+
+// Local affine matrix components, column-major 3x4 (the bottom row is 0 0 0 1)
+enum AffineComponent : uint8_t {
+    M00, M10, M20,
+    M01, M11, M21,
+    M02, M12, M22,
+    M03, M13, M23,
+    AffineCount
+};
+
+size_t RoundUpStride(size_t boneCount) {
+    return (boneCount + Pose::kStrideMultiple - 1) / Pose::kStrideMultiple * Pose::kStrideMultiple;
+}
+
+struct RotationBatch {
+    FloatBatch x, y, z, w;
+};
+
+RotationBatch LoadRotation(const Pose& pose, size_t i) {
+    return {FloatBatch::Load(pose.Data(Pose::RotationX) + i), FloatBatch::Load(pose.Data(Pose::RotationY) + i),
+            FloatBatch::Load(pose.Data(Pose::RotationZ) + i), FloatBatch::Load(pose.Data(Pose::RotationW) + i)};
+}
+
+void StoreRotation(Pose& pose, size_t i, const RotationBatch& r) {
+    r.x.Store(pose.Data(Pose::RotationX) + i);
+    r.y.Store(pose.Data(Pose::RotationY) + i);
+    r.z.Store(pose.Data(Pose::RotationZ) + i);
+    r.w.Store(pose.Data(Pose::RotationW) + i);
+}
+
+RotationBatch Normalize(const RotationBatch& q) {
+    const FloatBatch lengthSq = MulAdd(q.x, q.x, MulAdd(q.y, q.y, MulAdd(q.z, q.z, q.w * q.w)));
+    const FloatBatch inv = FloatBatch::Broadcast(1.0f) / SIMD::Sqrt(lengthSq);
+    return {q.x * inv, q.y * inv, q.z * inv, q.w * inv};
+}
+
+/**
+ * @brief nlerp(a, b, w) along the shortest arc
+ */
+RotationBatch Nlerp(const RotationBatch& a, const RotationBatch& b, FloatBatch w) {
+    const FloatBatch zero = FloatBatch::Broadcast(0.0f);
+    const FloatBatch dot = MulAdd(a.x, b.x, MulAdd(a.y, b.y, MulAdd(a.z, b.z, a.w * b.w)));
+    const FloatBatch wb = SIMD::Select(SIMD::CmpLt(dot, zero), zero - w, w);
+    const FloatBatch wa = FloatBatch::Broadcast(1.0f) - w;
+    return Normalize({MulAdd(b.x, wb, a.x * wa), MulAdd(b.y, wb, a.y * wa),
+                      MulAdd(b.z, wb, a.z * wa), MulAdd(b.w, wb, a.w * wa)});
+}
+
+/**
+ * @brief Hamilton product p * q
+ */
+RotationBatch Multiply(const RotationBatch& p, const RotationBatch& q) {
+    return {p.w * q.x + p.x * q.w + p.y * q.z - p.z * q.y,
+            p.w * q.y + p.y * q.w + p.z * q.x - p.x * q.z,
+            p.w * q.z + p.z * q.w + p.x * q.y - p.y * q.x,
+            p.w * q.w - p.x * q.x - p.y * q.y - p.z * q.z};
+}
+
+FloatBatch LerpBatch(FloatBatch a, FloatBatch b, FloatBatch w) {
+    return MulAdd(b - a, w, a);
+}
+
+template<typename WeightFn>
+void BlendImpl(const Pose& a, const Pose& b, Pose& out, WeightFn&& weightAt) {
+    assert(a.GetBoneCount() == b.GetBoneCount() && "Pose bone counts differ");
+    if (out.GetBoneCount() != a.GetBoneCount()) {
+        out.Resize(a.GetBoneCount());
+    }
+
+    const size_t stride = out.GetStride();
+    for (size_t i = 0; i < stride; i += kWidth) {
+        const FloatBatch w = weightAt(i);
+
+        for (Pose::Component c : {Pose::TranslationX, Pose::TranslationY, Pose::TranslationZ,
+                                  Pose::ScaleX, Pose::ScaleY, Pose::ScaleZ}) {
+            LerpBatch(FloatBatch::Load(a.Data(c) + i), FloatBatch::Load(b.Data(c) + i), w).Store(out.Data(c) + i);
+        }
+        StoreRotation(out, i, Nlerp(LoadRotation(a, i), LoadRotation(b, i), w));
+    }
+}
+
+/**
+ * @brief 4x4 column-major product, one column at a time in 4-wide registers
+ */
+void MultiplyMatrices(const glm::mat4& a, const glm::mat4& b, glm::mat4& out) {
+#ifdef NOVA_SSE_SUPPORT
+    const __m128 a0 = _mm_loadu_ps(&a[0][0]);
+    const __m128 a1 = _mm_loadu_ps(&a[1][0]);
+    const __m128 a2 = _mm_loadu_ps(&a[2][0]);
+    const __m128 a3 = _mm_loadu_ps(&a[3][0]);
+    for (int column = 0; column < 4; ++column) {
+        __m128 r = _mm_mul_ps(a0, _mm_set1_ps(b[column][0]));
+        r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(b[column][1])));
+        r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(b[column][2])));
+        r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(b[column][3])));
+        _mm_storeu_ps(&out[column][0], r);
+    }
+#else
+    out = a * b;
+#endif
+}
+
+/**
+ * @brief Compose local TRS into affine matrix components, Width bones at a time
+ */
+void ComputeLocalAffine(const Pose& pose, float* affine) {
+    const size_t stride = pose.GetStride();
+    const FloatBatch one = FloatBatch::Broadcast(1.0f);
+    const FloatBatch two = FloatBatch::Broadcast(2.0f);
+
+    for (size_t i = 0; i < stride; i += kWidth) {
+        const RotationBatch q = LoadRotation(pose, i);
+        const FloatBatch sx = FloatBatch::Load(pose.Data(Pose::ScaleX) + i);
+        const FloatBatch sy = FloatBatch::Load(pose.Data(Pose::ScaleY) + i);
+        const FloatBatch sz = FloatBatch::Load(pose.Data(Pose::ScaleZ) + i);
+
+        const FloatBatch xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        const FloatBatch xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        const FloatBatch wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+        // T * R * S: rotation columns scaled per axis, translation in the last column
+        ((one - two * (yy + zz)) * sx).Store(affine + M00 * stride + i);
+        (two * (xy + wz) * sx).Store(affine + M10 * stride + i);
+        (two * (xz - wy) * sx).Store(affine + M20 * stride + i);
+
+        (two * (xy - wz) * sy).Store(affine + M01 * stride + i);
+        ((one - two * (xx + zz)) * sy).Store(affine + M11 * stride + i);
+        (two * (yz + wx) * sy).Store(affine + M21 * stride + i);
+
+        (two * (xz + wy) * sz).Store(affine + M02 * stride + i);
+        (two * (yz - wx) * sz).Store(affine + M12 * stride + i);
+        ((one - two * (xx + yy)) * sz).Store(affine + M22 * stride + i);
+
+        std::memcpy(affine + M03 * stride + i, pose.Data(Pose::TranslationX) + i, kWidth * sizeof(float));
+        std::memcpy(affine + M13 * stride + i, pose.Data(Pose::TranslationY) + i, kWidth * sizeof(float));
+        std::memcpy(affine + M23 * stride + i, pose.Data(Pose::TranslationZ) + i, kWidth * sizeof(float));
+    }
+}
+
+glm::mat4 LoadAffine(const float* affine, size_t stride, size_t bone) {
+    auto at = [&](AffineComponent c) { return affine[c * stride + bone]; };
+    return glm::mat4(at(M00), at(M10), at(M20), 0.0f,
+                     at(M01), at(M11), at(M21), 0.0f,
+                     at(M02), at(M12), at(M22), 0.0f,
+                     at(M03), at(M13), at(M23), 1.0f);
+}
+
+// Per-thread scratch so characters sharing a skeleton or clip can be evaluated in parallel
+struct PoseScratch {
+    Pose nextKeys;
+    BoneWeights keyWeights;
+    std::vector<float, AlignedAllocator<float, 64>> affine;
+    std::vector<glm::mat4> model;
+};
+
+PoseScratch& GetScratch() {
+    thread_local PoseScratch scratch;
+    return scratch;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Pose
+// ============================================================================
+
+Pose::Pose(size_t boneCount) {
+    Resize(boneCount);
+}
+
+void Pose::Resize(size_t boneCount) {
+    m_boneCount = boneCount;
+    m_stride = RoundUpStride(boneCount);
+    m_data.resize(ComponentCount * m_stride);
+    SetIdentity();
+}
+
+void Pose::SetIdentity() {
+    for (Component c : {TranslationX, TranslationY, TranslationZ, RotationX, RotationY, RotationZ}) {
+        std::fill_n(Data(c), m_stride, 0.0f);
+    }
+    for (Component c : {RotationW, ScaleX, ScaleY, ScaleZ}) {
+        std::fill_n(Data(c), m_stride, 1.0f);
+    }
+}
+
+void Pose::SetBone(size_t bone, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale) {
+    assert(bone < m_boneCount && "Bone index out of range");
+    Data(TranslationX)[bone] = translation.x;
+    Data(TranslationY)[bone] = translation.y;
+    Data(TranslationZ)[bone] = translation.z;
+    Data(RotationX)[bone] = rotation.x;
+    Data(RotationY)[bone] = rotation.y;
+    Data(RotationZ)[bone] = rotation.z;
+    Data(RotationW)[bone] = rotation.w;
+    Data(ScaleX)[bone] = scale.x;
+    Data(ScaleY)[bone] = scale.y;
+    Data(ScaleZ)[bone] = scale.z;
+}
+
+glm::vec3 Pose::GetTranslation(size_t bone) const {
+    return glm::vec3(Data(TranslationX)[bone], Data(TranslationY)[bone], Data(TranslationZ)[bone]);
+}
+
+glm::quat Pose::GetRotation(size_t bone) const {
+    return glm::quat(Data(RotationW)[bone], Data(RotationX)[bone], Data(RotationY)[bone], Data(RotationZ)[bone]);
+}
+
+glm::vec3 Pose::GetScale(size_t bone) const {
+    return glm::vec3(Data(ScaleX)[bone], Data(ScaleY)[bone], Data(ScaleZ)[bone]);
+}
+
+glm::mat4 Pose::GetLocalMatrix(size_t bone) const {
+    Keyframe kf;
+    kf.position = GetTranslation(bone);
+    kf.rotation = GetRotation(bone);
+    kf.scale = GetScale(bone);
+    return KeyframeUtils::ToMatrix(kf);
+}
+
+// ============================================================================
+// ClipBinding
+// ============================================================================
+
+ClipBinding::ClipBinding(const Animation& clip, const Skeleton& skeleton)
+    : m_clip(&clip)
+    , m_skeleton(&skeleton)
+{
+    const auto& channels = clip.GetChannels();
+    const auto& bones = skeleton.GetBones();
+
+    m_channelForBone.assign(bones.size(), -1);
+    for (size_t bone = 0; bone < bones.size(); ++bone) {
+        if (const AnimationChannel* channel = clip.GetChannel(bones[bone].name)) {
+            if (!channel->keyframes.empty()) {
+                m_channelForBone[bone] = static_cast<int32_t>(channel - channels.data());
+                ++m_boundChannels;
+            }
+        }
+    }
+
+    PoseOps::SetRestPose(skeleton, m_restPose);
+}
+
+void ClipBinding::Sample(float time, Pose& outPose, std::span<uint32_t> cursors) const {
+    assert(m_clip && "Sampling an unbound clip");
+    assert(cursors.size() >= m_channelForBone.size() && "One cursor per bone required");
+
+    PoseScratch& scratch = GetScratch();
+    Pose& next = scratch.nextKeys;
+
+    // Unanimated bones keep the rest pose with weight 0
+    outPose = m_restPose;
+    if (next.GetBoneCount() != m_restPose.GetBoneCount()) {
+        next.Resize(m_restPose.GetBoneCount());
+    }
+    scratch.keyWeights.assign(m_restPose.GetStride(), 0.0f);
+
+    const auto& channels = m_clip->GetChannels();
+    for (size_t bone = 0; bone < m_channelForBone.size(); ++bone) {
+        const int32_t channelIndex = m_channelForBone[bone];
+        if (channelIndex < 0) {
+            continue;
+        }
+
+        const AnimationChannel& channel = channels[static_cast<size_t>(channelIndex)];
+        const std::vector<Keyframe>& keys = channel.keyframes;
+        const size_t last = keys.size() - 1;
+
+        // Cursor stays valid for sequential playback; otherwise binary search
+        size_t k = cursors[bone];
+        if (time <= keys.front().time || last == 0) {
+            k = 0;
+        } else if (time >= keys[last].time) {
+            k = last;
+        } else if (!(k < last && keys[k].time <= time && time < keys[k + 1].time)) {
+            if (k + 1 < last && keys[k + 1].time <= time && time < keys[k + 2].time) {
+                ++k;
+            } else {
+                auto it = std::upper_bound(keys.begin(), keys.end(), time,
+                    [](float t, const Keyframe& kf) { return t < kf.time; });
+                k = static_cast<size_t>(std::distance(keys.begin(), it)) - 1;
+            }
+        }
+        cursors[bone] = static_cast<uint32_t>(k);
+
+        const Keyframe& prev = keys[k];
+        const Keyframe& nextKey = keys[std::min(k + 1, last)];
+
+        float t = 0.0f;
+        if (k < last && time > prev.time) {
+            const float span = nextKey.time - prev.time;
+            t = span > 0.0f ? (time - prev.time) / span : 0.0f;
+        }
+
+        glm::vec3 prevPosition = prev.position;
+        glm::vec3 nextPosition = nextKey.position;
+        switch (channel.interpolationMode) {
+            case InterpolationMode::Step:
+                t = 0.0f;
+                break;
+            case InterpolationMode::Cubic:
+                t = Interpolation::SmoothStep(t);
+                break;
+            case InterpolationMode::CatmullRom:
+                if (k < last) {
+                    const size_t p0 = k > 0 ? k - 1 : k;
+                    const size_t p3 = k + 2 <= last ? k + 2 : k + 1;
+                    prevPosition = nextPosition = Interpolation::CatmullRom(
+                        keys[p0].position, prev.position, nextKey.position, keys[p3].position, t);
+                }
+                break;
+            case InterpolationMode::Linear:
+            default:
+                break;
+        }
+
+        outPose.SetBone(bone, prevPosition, prev.rotation, prev.scale);
+        next.SetBone(bone, nextPosition, nextKey.rotation, nextKey.scale);
+        scratch.keyWeights[bone] = t;
+    }
+
+    PoseOps::Blend(outPose, next, 1.0f, scratch.keyWeights, outPose);
+}
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+namespace PoseOps {
+
+void SetRestPose(const Skeleton& skeleton, Pose& outPose) {
+    const auto& bones = skeleton.GetBones();
+    outPose.Resize(bones.size());
+    for (size_t bone = 0; bone < bones.size(); ++bone) {
+        const Keyframe rest = KeyframeUtils::FromMatrix(bones[bone].localTransform);
+        outPose.SetBone(bone, rest.position, glm::normalize(rest.rotation), rest.scale);
+    }
+}
+
+void Blend(const Pose& a, const Pose& b, float weight, Pose& out) {
+    const FloatBatch w = FloatBatch::Broadcast(weight);
+    BlendImpl(a, b, out, [w](size_t) { return w; });
+}
+
+void Blend(const Pose& a, const Pose& b, float weight, std::span<const float> boneWeights, Pose& out) {
+    assert(boneWeights.size() >= a.GetStride() && "Bone weights must cover the padded stride");
+    const FloatBatch w = FloatBatch::Broadcast(weight);
+    const float* weights = boneWeights.data();
+    BlendImpl(a, b, out, [w, weights](size_t i) { return w * FloatBatch::Load(weights + i); });
+}
+
+void BlendAdditive(const Pose& base, const Pose& additive, float weight,
+                   std::span<const float> boneWeights, Pose& out) {
+    assert(base.GetBoneCount() == additive.GetBoneCount() && "Pose bone counts differ");
+    assert((boneWeights.empty() || boneWeights.size() >= base.GetStride()) &&
+           "Bone weights must cover the padded stride");
+    if (out.GetBoneCount() != base.GetBoneCount()) {
+        out.Resize(base.GetBoneCount());
+    }
+
+    const size_t stride = out.GetStride();
+    const FloatBatch one = FloatBatch::Broadcast(1.0f);
+    const FloatBatch zero = FloatBatch::Broadcast(0.0f);
+    const FloatBatch layerWeight = FloatBatch::Broadcast(weight);
+
+    for (size_t i = 0; i < stride; i += kWidth) {
+        const FloatBatch w = boneWeights.empty() ? layerWeight : layerWeight * FloatBatch::Load(boneWeights.data() + i);
+
+        for (Pose::Component c : {Pose::TranslationX, Pose::TranslationY, Pose::TranslationZ}) {
+            MulAdd(FloatBatch::Load(additive.Data(c) + i), w, FloatBatch::Load(base.Data(c) + i)).Store(out.Data(c) + i);
+        }
+        for (Pose::Component c : {Pose::ScaleX, Pose::ScaleY, Pose::ScaleZ}) {
+            const FloatBatch scale = LerpBatch(one, FloatBatch::Load(additive.Data(c) + i), w);
+            (FloatBatch::Load(base.Data(c) + i) * scale).Store(out.Data(c) + i);
+        }
+
+        const RotationBatch identity{zero, zero, zero, one};
+        const RotationBatch delta = Nlerp(identity, LoadRotation(additive, i), w);
+        StoreRotation(out, i, Normalize(Multiply(delta, LoadRotation(base, i))));
+    }
+}
+
+void FillBoneWeights(std::span<const float> weights, size_t boneCount, BoneWeights& outWeights) {
+    outWeights.assign(RoundUpStride(boneCount), 0.0f);
+    std::copy_n(weights.begin(), std::min(weights.size(), boneCount), outWeights.begin());
+}
+
+void ComputeSkinningMatrices(const Pose& pose, const Skeleton& skeleton, std::span<glm::mat4> outMatrices) {
+    const auto& bones = skeleton.GetBones();
+    const size_t boneCount = bones.size();
+    if (boneCount == 0 || outMatrices.size() < boneCount || pose.GetBoneCount() < boneCount) {
+        return;
+    }
+
+    PoseScratch& scratch = GetScratch();
+    const size_t stride = pose.GetStride();
+    scratch.affine.resize(AffineCount * stride);
+    if (scratch.model.size() < boneCount) {
+        scratch.model.resize(boneCount);
+    }
+
+    ComputeLocalAffine(pose, scratch.affine.data());
+
+    // Bones are parent-first, so every parent's model matrix is ready before its children
+    const glm::mat4& globalInverse = skeleton.GetGlobalInverseTransform();
+    glm::mat4 modelOffset;
+    for (size_t i = 0; i < boneCount; ++i) {
+        const glm::mat4 local = LoadAffine(scratch.affine.data(), stride, i);
+        const int parent = bones[i].parentIndex;
+        if (parent >= 0 && static_cast<size_t>(parent) < i) {
+            MultiplyMatrices(scratch.model[static_cast<size_t>(parent)], local, scratch.model[i]);
+        } else {
+            scratch.model[i] = local;
+        }
+
+        MultiplyMatrices(scratch.model[i], bones[i].offsetMatrix, modelOffset);
+        MultiplyMatrices(globalInverse, modelOffset, outMatrices[i]);
+    }
+}
+
+} // namespace PoseOps
+
+} // namespace Nova
@@ -0,0 +1,192 @@
+/**
+ * @file Pose.hpp
+ * @brief Bone-indexed structure-of-arrays poses and their SIMD kernels
+ *
+ * A Pose holds one local translation/rotation/scale per skeleton bone, each
+ * component in its own cache-line aligned float array. Clips are bound to a
+ * skeleton once (ClipBinding) so sampling, blending and the hierarchy pass
+ * work on bone indices only: no name lookups, no per-bone matrices until the
+ * final skinning matrices are written.
+ *
+ * @code{.cpp}
+ * Nova::ClipBinding walk(walkClip, skeleton);      // at load time
+ * std::vector<uint32_t> cursors(skeleton.GetBoneCount());
+ *
+ * Nova::Pose pose(skeleton.GetBoneCount());
+ * walk.Sample(time, pose, cursors);
+ * Nova::PoseOps::Blend(pose, aimPose, 0.5f, pose);
+ * skeleton.CalculateBoneMatricesInto(pose, boneMatrices);
+ * @endcode
+ */
+
+#pragma once
+
+#include "animation/Animation.hpp"
+#include "core/SoA.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Nova {
+
+class Skeleton;
+
+/**
+ * @brief Local bone transforms stored as SoA float arrays
+ *
+ * Every component array has GetStride() entries, a multiple of 16 floats,
+ * so SIMD kernels can run whole batches without a scalar tail. Padding lanes
+ * hold the identity transform.
+ */
+class Pose {
+public:
+    enum Component : uint8_t {
+        TranslationX, TranslationY, TranslationZ,
+        RotationX, RotationY, RotationZ, RotationW,
+        ScaleX, ScaleY, ScaleZ,
+        ComponentCount
+    };
+
+    static constexpr size_t kStrideMultiple = 16;  // One cache line of floats
+
+    Pose() = default;
+    explicit Pose(size_t boneCount);
+
+    /**
+     * @brief Resize to a bone count; every bone is reset to identity
+     */
+    void Resize(size_t boneCount);
+
+    /**
+     * @brief Reset every bone to identity
+     */
+    void SetIdentity();
+
+    [[nodiscard]] size_t GetBoneCount() const noexcept { return m_boneCount; }
+    [[nodiscard]] size_t GetStride() const noexcept { return m_stride; }
+
+    /**
+     * @brief Aligned component array (GetStride() floats)
+     */
+    [[nodiscard]] float* Data(Component component) noexcept { return m_data.data() + component * m_stride; }
+    [[nodiscard]] const float* Data(Component component) const noexcept {
+        return m_data.data() + component * m_stride;
+    }
+
+    void SetBone(size_t bone, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale);
+
+    [[nodiscard]] glm::vec3 GetTranslation(size_t bone) const;
+    [[nodiscard]] glm::quat GetRotation(size_t bone) const;
+    [[nodiscard]] glm::vec3 GetScale(size_t bone) const;
+
+    /**
+     * @brief Compose a bone's local TRS matrix (tools and debugging)
+     */
+    [[nodiscard]] glm::mat4 GetLocalMatrix(size_t bone) const;
+
+private:
+    size_t m_boneCount = 0;
+    size_t m_stride = 0;
+    std::vector<float, AlignedAllocator<float, 64>> m_data;
+};
+
+/**
+ * @brief Padded per-bone weight array for masked blends
+ */
+using BoneWeights = std::vector<float, AlignedAllocator<float, 64>>;
+
+/**
+ * @brief An animation clip retargeted to one skeleton's bone indices
+ *
+ * Built once when a clip is loaded for a skeleton. Bones the clip does not
+ * animate sample the skeleton's rest pose. Rebuild the binding if either
+ * the clip's channels or the skeleton's bones change.
+ */
+class ClipBinding {
+public:
+    ClipBinding() = default;
+    ClipBinding(const Animation& clip, const Skeleton& skeleton);
+
+    [[nodiscard]] const Animation* GetClip() const noexcept { return m_clip; }
+    [[nodiscard]] const Skeleton* GetSkeleton() const noexcept { return m_skeleton; }
+    [[nodiscard]] size_t GetBoneCount() const noexcept { return m_channelForBone.size(); }
+
+    /**
+     * @brief Channel index animating each bone, or -1 for rest pose
+     */
+    [[nodiscard]] std::span<const int32_t> GetChannelForBone() const noexcept { return m_channelForBone; }
+
+    /**
+     * @brief Number of bones driven by the clip
+     */
+    [[nodiscard]] size_t GetBoundChannelCount() const noexcept { return m_boundChannels; }
+
+    /**
+     * @brief Sample the clip at a time into a pose
+     * @param time Clip time in seconds
+     * @param outPose Resized to the skeleton's bone count if needed
+     * @param cursors Per-bone keyframe cursors owned by the playing instance
+     *        (GetBoneCount() entries); make playback O(1) per bone
+     *
+     * Rotation keys are nlerped rather than slerped. Keys are dense enough
+     * that the difference is far below what skinning can show.
+     */
+    void Sample(float time, Pose& outPose, std::span<uint32_t> cursors) const;
+
+private:
+    const Animation* m_clip = nullptr;
+    const Skeleton* m_skeleton = nullptr;
+    std::vector<int32_t> m_channelForBone;
+    size_t m_boundChannels = 0;
+    Pose m_restPose;
+};
+
+/**
+ * @brief SIMD pose kernels
+ *
+ * Outputs may alias inputs and are resized to the inputs' bone count.
+ * Rotations are blended with nlerp along the shortest arc.
+ */
+namespace PoseOps {
+    /**
+     * @brief Fill a pose with the skeleton's rest (bind) local transforms
+     */
+    void SetRestPose(const Skeleton& skeleton, Pose& outPose);
+
+    /**
+     * @brief out = lerp(a, b, weight)
+     */
+    void Blend(const Pose& a, const Pose& b, float weight, Pose& out);
+
+    /**
+     * @brief Per-bone blend: out = lerp(a, b, weight * boneWeights[i])
+     * @param boneWeights At least a.GetStride() entries
+     */
+    void Blend(const Pose& a, const Pose& b, float weight, std::span<const float> boneWeights, Pose& out);
+
+    /**
+     * @brief Apply an additive pose: translation adds, rotation premultiplies,
+     *        scale multiplies, each scaled by weight (and boneWeights if given)
+     */
+    void BlendAdditive(const Pose& base, const Pose& additive, float weight,
+                       std::span<const float> boneWeights, Pose& out);
+
+    /**
+     * @brief Copy per-bone weights into a padded array for the kernels above
+     * @param weights Per-bone weights; bones past its end get 0
+     */
+    void FillBoneWeights(std::span<const float> weights, size_t boneCount, BoneWeights& outWeights);
+
+    /**
+     * @brief Local-to-model hierarchy pass and skinning matrices
+     *
+     * Composes every local TRS into an affine matrix in SIMD batches, then
+     * walks the parent-first bone list multiplying with 4-wide columns:
+     * out[i] = globalInverse * model[i] * offset[i].
+     */
+    void ComputeSkinningMatrices(const Pose& pose, const Skeleton& skeleton, std::span<glm::mat4> outMatrices);
+}
+
+} // namespace Nova
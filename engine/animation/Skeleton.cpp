@@ -1,4 +1,5 @@
 #include "animation/Skeleton.hpp"
+#include "animation/Pose.hpp"
 #include <algorithm>
 #include <stdexcept>
 #include <cassert>
@@ -106,6 +107,10 @@ void Skeleton::CalculateBoneMatricesInto(
     }
 }
 
+void Skeleton::CalculateBoneMatricesInto(const Pose& pose, std::span<glm::mat4> outMatrices) const {
+    PoseOps::ComputeSkinningMatrices(pose, *this, outMatrices);
+}
+
 std::vector<glm::mat4> Skeleton::GetBindPoseMatrices() const {
     const size_t boneCount = m_bones.size();
     std::vector<glm::mat4> bindPose(boneCount, glm::mat4(1.0f));
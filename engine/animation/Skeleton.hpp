@@ -8,6 +8,8 @@
 
 namespace Nova {
 
+class Pose;
+
 /**
  * @brief Bone in a skeleton hierarchy
  */
@@ -90,6 +92,13 @@ public:
         const std::unordered_map<std::string, glm::mat4>& animationTransforms,
         std::span<glm::mat4> outMatrices) const;
 
+    /**
+     * @brief Calculate bone matrices from a bone-indexed pose (SIMD path)
+     * @param pose Local transforms, at least GetBoneCount() bones
+     * @param outMatrices Output span for bone matrices (must be at least GetBoneCount() size)
+     */
+    void CalculateBoneMatricesInto(const Pose& pose, std::span<glm::mat4> outMatrices) const;
+
     /**
      * @brief Get identity matrices for bind pose
      */
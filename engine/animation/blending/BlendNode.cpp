@@ -237,12 +237,15 @@ AnimationPose ClipNode::Evaluate(float deltaTime) {
     // Evaluate animation
     pose.Resize(m_skeleton->GetBoneCount());
 
-    auto transforms = m_clip->Evaluate(m_time);
-    for (const auto& [boneName, matrix] : transforms) {
-        int boneIndex = m_skeleton->GetBoneIndex(boneName);
-        if (boneIndex >= 0) {
-            pose.SetBoneTransform(static_cast<size_t>(boneIndex), BoneTransform::FromMatrix(matrix));
-        }
+    if (m_binding.GetClip() != m_clip || m_binding.GetSkeleton() != m_skeleton ||
+        m_binding.GetBoneCount() != m_skeleton->GetBoneCount()) {
+        m_binding = ClipBinding(*m_clip, *m_skeleton);
+        m_keyCursors.assign(m_binding.GetBoneCount(), 0);
+    }
+
+    m_binding.Sample(m_time, m_sampled, m_keyCursors);
+    for (size_t i = 0; i < m_sampled.GetBoneCount(); ++i) {
+        pose.SetBoneTransform(i, {m_sampled.GetTranslation(i), m_sampled.GetRotation(i), m_sampled.GetScale(i)});
     }
 
     // Extract root motion
@@ -7,6 +7,7 @@
 #include <functional>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
+#include "../Pose.hpp"
 
 namespace Nova {
 
@@ -272,6 +273,11 @@ private:
     bool m_rootMotionEnabled = false;
     glm::vec3 m_lastRootPosition{0.0f};
     glm::quat m_lastRootRotation{1.0f, 0.0f, 0.0f, 0.0f};
+
+    // Clip retargeted to m_skeleton; rebuilt when either changes
+    ClipBinding m_binding;
+    std::vector<uint32_t> m_keyCursors;
+    Pose m_sampled;
 };
 
 /**
@@ -7,6 +7,7 @@
 #include "input/InputManager.hpp"
 #include "scene/Scene.hpp"
 #include "config/Config.hpp"
+#include "reflection/EventChannel.hpp"
 
 #ifdef NOVA_AUDIO_ENABLED
 #include "audio/AudioEngine.hpp"
@@ -176,6 +177,9 @@ void Engine::ProcessFrame(const ApplicationCallbacks& callbacks) {
         callbacks.onUpdate(deltaTime);
     }
 
+    // Deliver this frame's typed events
+    Reflect::EventChannels::DispatchAll();
+
 #ifdef NOVA_AUDIO_ENABLED
     // Update audio system (handles streaming, crossfades, occlusion)
     if (AudioEngine::Instance().IsInitialized()) {
@@ -1,4 +1,5 @@
 #include "core/JobSystem.hpp"
+#include "core/TraceCapture.hpp"
 #include <spdlog/spdlog.h>
 
 #ifdef _WIN32
@@ -9,8 +10,109 @@
 
 namespace Nova {
 
+namespace {
+
+// Failed scans before an idle worker parks on the sleep condition
+constexpr uint32_t kIdleSpinCount = 64;
+
+// Minimum slots per worker pool (workers mostly submit nested work)
+constexpr size_t kMinWorkerPoolCapacity = 256;
+
+// Failed help attempts before a non-worker thread parks inside JobCounter::Wait
+constexpr uint32_t kWaitSpinCount = 64;
+
+uint32_t NextStealVictim(uint32_t workerCount) {
+    // xorshift32 - cheap per-thread victim selection
+    thread_local uint32_t state = 0x9E3779B9u ^
+        static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % workerCount;
+}
+
+} // namespace
+
 // Thread-local storage for worker identification
-thread_local bool JobSystem::s_isWorkerThread = false;
+thread_local uint32_t JobSystem::s_workerIndex = JobSystem::kExternalThread;
+
+// =============================================================================
+// JobHandle / JobCounter
+// =============================================================================
+
+void JobHandle::Wait() const {
+    JobSystem& jobSystem = JobSystem::Instance();
+    while (!IsComplete()) {
+        if (!jobSystem.YieldAndProcess()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobCounter::Decrement() {
+    // Fast path: not the last reference, nothing else to touch
+    uint32_t count = m_count.load(std::memory_order_relaxed);
+    while (count > 1) {
+        if (m_count.compare_exchange_weak(count, count - 1,
+                                          std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    // Possibly the final decrement. Doing it under the lock means Wait()
+    // cannot return (and the owner cannot destroy *this) until we are done.
+    detail::JobSlot* continuations = nullptr;
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_count.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        continuations = std::exchange(m_continuations, nullptr);
+        m_cv.notify_all();
+    }
+
+    if (continuations) {
+        JobSystem::Instance().EnqueueContinuations(continuations);
+    }
+}
+
+void JobCounter::Wait() {
+    JobSystem& jobSystem = JobSystem::Instance();
+    const bool isWorker = jobSystem.IsWorkerThread();
+
+    uint32_t idleSpins = 0;
+    while (!IsComplete()) {
+        if (jobSystem.YieldAndProcess()) {
+            idleSpins = 0;
+            continue;
+        }
+
+        // Workers never park: new work may appear that they should help with
+        if (isWorker || ++idleSpins < kWaitSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Everything left is already running elsewhere
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [this] {
+            return m_count.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    // Synchronize with a final Decrement() that may still hold the lock
+    std::lock_guard lock(m_mutex);
+}
+
+// =============================================================================
+// JobSystem
+// =============================================================================
+
+JobSystem::WorkerState::WorkerState(size_t capacity) {
+    for (auto& deque : deques) {
+        deque = std::make_unique<WorkStealingDeque<detail::JobSlot*>>(capacity);
+    }
+}
 
 JobSystem::~JobSystem() {
     if (m_initialized) {
@@ -28,26 +130,57 @@ bool JobSystem::Initialize(const JobSystemConfig& config) {
     uint32_t hardwareThreads = std::thread::hardware_concurrency();
     m_workerCount = (config.workerThreads > 0)
         ? config.workerThreads
-        : std::max(1u, hardwareThreads - 1);
+        : std::max(1u, hardwareThreads > 1 ? hardwareThreads - 1 : 1u);
+    m_enablePriorities = config.enablePriorities;
 
     spdlog::info("Initializing JobSystem with {} worker threads", m_workerCount);
 
-    m_running = true;
+    // Slot pools: a worker's deque only ever holds slots from its own pool and
+    // each injection queue can hold every slot, so a push can never fail.
+    const size_t externalCapacity = detail::RoundUpToPowerOfTwo(std::max<size_t>(config.queueCapacity, 2));
+    const size_t workerCapacity = std::max(kMinWorkerPoolCapacity, externalCapacity / 4);
+    const size_t totalCapacity = externalCapacity + workerCapacity * m_workerCount;
+
+    m_slotPools.clear();
+    m_slotPools.reserve(m_workerCount + 1);
+    for (uint32_t i = 0; i <= m_workerCount; ++i) {
+        auto pool = std::make_unique<SlotPool>();
+        pool->capacity = (i == m_workerCount) ? externalCapacity : workerCapacity;
+        pool->slots = std::make_unique<detail::JobSlot[]>(pool->capacity);
+        for (size_t s = 0; s < pool->capacity; ++s) {
+            pool->slots[s].owner = i;
+            pool->slots[s].next = (s + 1 < pool->capacity) ? &pool->slots[s + 1] : nullptr;
+        }
+        pool->freeList = &pool->slots[0];
+        m_slotPools.push_back(std::move(pool));
+    }
+
+    for (auto& queue : m_injectionQueues) {
+        queue = std::make_unique<BoundedMPMCQueue<detail::JobSlot*>>(totalCapacity);
+    }
+
     m_workers.reserve(m_workerCount);
+    for (uint32_t i = 0; i < m_workerCount; ++i) {
+        m_workers.push_back(std::make_unique<WorkerState>(workerCapacity));
+    }
 
-    // Create worker threads
+    m_pendingJobs = 0;
+    m_running = true;
+    m_accepting = true;
+
+    // Create worker threads once all per-worker state exists, since workers steal from each other
     for (uint32_t i = 0; i < m_workerCount; ++i) {
-        m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+        m_workers[i]->thread = std::thread(&JobSystem::WorkerLoop, this, i);
 
         // Set thread name for debugging
 #ifdef _WIN32
         std::wstring name = std::wstring(config.threadNamePrefix.begin(),
                                           config.threadNamePrefix.end()) +
                            std::to_wstring(i);
-        SetThreadDescription(m_workers.back().native_handle(), name.c_str());
+        SetThreadDescription(m_workers[i]->thread.native_handle(), name.c_str());
 #elif defined(__linux__)
         std::string name = config.threadNamePrefix + std::to_string(i);
-        pthread_setname_np(m_workers.back().native_handle(), name.c_str());
+        pthread_setname_np(m_workers[i]->thread.native_handle(), name.c_str());
 #elif defined(__APPLE__)
         // macOS requires setting thread name from the thread itself
 #endif
@@ -65,63 +198,43 @@ void JobSystem::Shutdown() {
 
     spdlog::info("Shutting down JobSystem");
 
-    // Signal workers to stop
-    m_running = false;
-    m_condition.notify_all();
+    // Stop queueing new work; workers finish what is queued and then exit
+    m_accepting = false;
+    {
+        std::lock_guard lock(m_sleepMutex);
+        m_sleepCondition.notify_all();
+    }
 
     // Wait for all workers to finish
     for (auto& worker : m_workers) {
-        if (worker.joinable()) {
-            worker.join();
+        if (worker->thread.joinable()) {
+            worker->thread.join();
         }
     }
 
-    m_workers.clear();
-    m_workerCount = 0;
-
-    // Clear remaining jobs
-    {
-        std::lock_guard lock(m_queueMutex);
-        while (!m_jobQueue.empty()) {
-            m_jobQueue.pop();
-        }
+    // Run whatever is left so counters and handles resolve and captures are destroyed.
+    // Jobs run here may release continuations, so keep going until nothing is found.
+    size_t drained = 0;
+    while (detail::JobSlot* slot = TryGetJob()) {
+        ExecuteJob(slot);
+        ++drained;
     }
-
-    m_initialized = false;
-    spdlog::info("JobSystem shutdown complete");
-}
-
-JobHandle JobSystem::Submit(Job job, JobPriority priority) {
-    auto completed = std::make_shared<std::atomic<bool>>(false);
-
-    {
-        std::lock_guard lock(m_queueMutex);
-        m_jobQueue.push(PrioritizedJob{
-            std::move(job),
-            completed,
-            nullptr,
-            priority
-        });
+    if (drained > 0) {
+        spdlog::warn("JobSystem ran {} pending jobs during shutdown", drained);
     }
 
-    m_condition.notify_one();
-    return JobHandle(completed);
-}
-
-void JobSystem::Submit(Job job, JobCounter& counter, JobPriority priority) {
-    counter.Increment();
+    m_running = false;
 
-    {
-        std::lock_guard lock(m_queueMutex);
-        m_jobQueue.push(PrioritizedJob{
-            std::move(job),
-            nullptr,
-            &counter,
-            priority
-        });
+    m_workers.clear();
+    m_workerCount = 0;
+    for (auto& queue : m_injectionQueues) {
+        queue.reset();
     }
+    m_slotPools.clear();
+    m_pendingJobs = 0;
 
-    m_condition.notify_one();
+    m_initialized = false;
+    spdlog::info("JobSystem shutdown complete");
 }
 
 void JobSystem::SubmitAndWait(const std::vector<Job>& jobs, JobPriority priority) {
@@ -170,9 +283,17 @@ void JobSystem::ParallelFor(size_t start, size_t end, size_t batchSize,
 }
 
 void JobSystem::ParallelFor(size_t count, const std::function<void(size_t)>& func) {
+    ParallelFor(0, count, func);
+}
+
+void JobSystem::ParallelFor(size_t start, size_t end, const std::function<void(size_t)>& func) {
+    if (start >= end) {
+        return;
+    }
+
     // Auto-determine batch size based on work and thread count
-    size_t batchSize = std::max(size_t(1), count / (m_workerCount * 4));
-    ParallelFor(0, count, batchSize, func);
+    size_t batchSize = std::max(size_t(1), (end - start) / (std::max(m_workerCount, 1u) * 4));
+    ParallelFor(start, end, batchSize, func);
 }
 
 void JobSystem::ParallelForRange(size_t start, size_t end,
@@ -206,88 +327,237 @@ void JobSystem::ParallelForRange(size_t start, size_t end,
 }
 
 size_t JobSystem::GetPendingJobCount() const {
-    std::lock_guard lock(m_queueMutex);
-    return m_jobQueue.size();
+    return static_cast<size_t>(std::max<int64_t>(0, m_pendingJobs.load(std::memory_order_relaxed)));
 }
 
 bool JobSystem::IsWorkerThread() const {
-    return s_isWorkerThread;
+    return s_workerIndex != kExternalThread;
 }
 
 bool JobSystem::YieldAndProcess() {
-    auto job = TryGetJob();
-    if (job) {
-        ExecuteJob(*job);
+    if (detail::JobSlot* slot = TryGetJob()) {
+        ExecuteJob(slot);
         return true;
     }
     return false;
 }
 
 void JobSystem::WorkerLoop(uint32_t threadIndex) {
-    s_isWorkerThread = true;
+    s_workerIndex = threadIndex;
 
 #ifdef __APPLE__
     // Set thread name on macOS (must be done from the thread itself)
     std::string name = "Nova_Worker_" + std::to_string(threadIndex);
     pthread_setname_np(name.c_str());
 #endif
+    TraceCapture::Instance().SetThreadName("Nova_Worker_" + std::to_string(threadIndex));
+
+    // Queued jobs are still served after Shutdown() stops accepting new ones:
+    // a job being finished may be waiting on work sitting in another deque.
+    uint32_t idleSpins = 0;
+    for (;;) {
+        if (detail::JobSlot* slot = TryGetJob()) {
+            ExecuteJob(slot);
+            idleSpins = 0;
+            continue;
+        }
+        if (!m_accepting.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        if (++idleSpins < kIdleSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        idleSpins = 0;
+
+        // Park until a submission arrives. Announcing ourselves before
+        // re-checking m_pendingJobs pairs with WakeWorker() so a wakeup
+        // cannot slip between the check and the wait.
+        std::unique_lock lock(m_sleepMutex);
+        m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        m_sleepCondition.wait(lock, [this] {
+            return m_pendingJobs.load(std::memory_order_seq_cst) > 0 ||
+                   !m_accepting.load(std::memory_order_acquire);
+        });
+        m_sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
 
-    while (m_running) {
-        PrioritizedJob job;
+    s_workerIndex = kExternalThread;
+}
 
-        {
-            std::unique_lock lock(m_queueMutex);
+detail::JobSlot* JobSystem::AcquireSlot() {
+    assert(m_initialized && "JobSystem::Submit called before Initialize");
 
-            // Wait for work or shutdown signal
-            m_condition.wait(lock, [this] {
-                return !m_jobQueue.empty() || !m_running;
-            });
+    const uint32_t poolIndex = (s_workerIndex != kExternalThread) ? s_workerIndex : m_workerCount;
 
-            if (!m_running && m_jobQueue.empty()) {
-                break;
-            }
+    // Pool exhausted means this thread has a full pool's worth of jobs in
+    // flight - help drain them rather than allocating more.
+    detail::JobSlot* slot = TryAcquireSlot(poolIndex);
+    while (!slot) {
+        if (!YieldAndProcess()) {
+            std::this_thread::yield();
+        }
+        slot = TryAcquireSlot(poolIndex);
+    }
+    return slot;
+}
 
-            if (m_jobQueue.empty()) {
-                continue;
-            }
+detail::JobSlot* JobSystem::TryAcquireSlot(uint32_t poolIndex) {
+    SlotPool& pool = *m_slotPools[poolIndex];
 
-            job = m_jobQueue.top();
-            m_jobQueue.pop();
+    auto pop = [&pool]() -> detail::JobSlot* {
+        if (!pool.freeList) {
+            pool.freeList = pool.remoteFree.exchange(nullptr, std::memory_order_acquire);
         }
+        detail::JobSlot* slot = pool.freeList;
+        if (slot) {
+            pool.freeList = slot->next;
+        }
+        return slot;
+    };
+
+    if (poolIndex == m_workerCount) {
+        std::lock_guard lock(m_externalPoolMutex);
+        return pop();
+    }
+    return pop();
+}
 
-        ExecuteJob(job);
+void JobSystem::ReleaseSlot(detail::JobSlot* slot) {
+    SlotPool& pool = *m_slotPools[slot->owner];
+
+    if (slot->owner == s_workerIndex) {
+        slot->next = pool.freeList;
+        pool.freeList = slot;
+        return;
     }
 
-    s_isWorkerThread = false;
+    detail::JobSlot* head = pool.remoteFree.load(std::memory_order_relaxed);
+    do {
+        slot->next = head;
+    } while (!pool.remoteFree.compare_exchange_weak(
+        head, slot, std::memory_order_release, std::memory_order_relaxed));
 }
 
-std::optional<JobSystem::PrioritizedJob> JobSystem::TryGetJob() {
-    std::lock_guard lock(m_queueMutex);
+void JobSystem::Enqueue(detail::JobSlot* slot, JobPriority priority) {
+    const size_t lane = m_enablePriorities
+        ? static_cast<size_t>(priority)
+        : static_cast<size_t>(JobPriority::Normal);
 
-    if (m_jobQueue.empty()) {
-        return std::nullopt;
+    // Once Shutdown() has begun nothing new is queued; running the job here
+    // means a caller waiting on it (often a job being drained) cannot stall
+    if (!m_accepting.load(std::memory_order_acquire)) {
+        ExecuteJob(slot);
+        return;
+    }
+
+    // Count before publishing so a thief can never observe a negative count
+    m_pendingJobs.fetch_add(1, std::memory_order_seq_cst);
+
+    // A worker's deque only takes slots from its own pool; everything else
+    // (external submissions, continuations released on another thread) goes
+    // through the injection queues.
+    bool pushed;
+    if (slot->owner == s_workerIndex) {
+        pushed = m_workers[s_workerIndex]->deques[lane]->Push(slot);
+    } else {
+        pushed = m_injectionQueues[lane]->TryPush(slot);
+    }
+    assert(pushed && "Job queue sized to its slot pool cannot overflow");
+    (void)pushed;
+
+    WakeWorker();
+}
+
+void JobSystem::EnqueueAfter(JobCounter& dependency, detail::JobSlot* slot, JobPriority priority) {
+    slot->priority = priority;
+    {
+        std::lock_guard lock(dependency.m_mutex);
+        if (!dependency.IsComplete()) {
+            slot->next = dependency.m_continuations;
+            dependency.m_continuations = slot;
+            return;
+        }
     }
+    Enqueue(slot, priority);
+}
 
-    auto job = m_jobQueue.top();
-    m_jobQueue.pop();
-    return job;
+void JobSystem::EnqueueContinuations(detail::JobSlot* list) {
+    while (list) {
+        detail::JobSlot* slot = list;
+        list = list->next;
+        Enqueue(slot, slot->priority);
+    }
 }
 
-void JobSystem::ExecuteJob(PrioritizedJob& job) {
+detail::JobSlot* JobSystem::TryGetJob() {
+    if (!m_running.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    const uint32_t self = s_workerIndex;
+    detail::JobSlot* slot = nullptr;
+
+    for (size_t lane = kPriorityCount; lane-- > 0;) {
+        // Own deque first (newest work, warm cache)
+        if (self != kExternalThread && m_workers[self]->deques[lane]->Pop(slot)) {
+            break;
+        }
+
+        if (m_injectionQueues[lane]->TryPop(slot)) {
+            break;
+        }
+
+        // Steal oldest work from a random victim
+        if (m_workerCount > 0) {
+            const uint32_t first = NextStealVictim(m_workerCount);
+            bool stolen = false;
+            for (uint32_t i = 0; i < m_workerCount && !stolen; ++i) {
+                const uint32_t victim = (first + i) % m_workerCount;
+                if (victim != self) {
+                    stolen = m_workers[victim]->deques[lane]->Steal(slot);
+                }
+            }
+            if (stolen) {
+                break;
+            }
+        }
+
+        slot = nullptr;
+    }
+
+    if (slot) {
+        m_pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return slot;
+}
+
+void JobSystem::ExecuteJob(detail::JobSlot* slot) {
     try {
-        job.job();
+        slot->invoke(*slot);
     } catch (const std::exception& e) {
         spdlog::error("Job threw exception: {}", e.what());
     } catch (...) {
         spdlog::error("Job threw unknown exception");
     }
 
-    if (job.completed) {
-        job.completed->store(true, std::memory_order_release);
+    slot->destroy(*slot);
+
+    // Grab the counter before the slot can be recycled
+    JobCounter* counter = slot->counter;
+    slot->generation.fetch_add(1, std::memory_order_release);
+    ReleaseSlot(slot);
+
+    if (counter) {
+        counter->Decrement();
     }
+}
 
-    if (job.counter) {
-        job.counter->Decrement();
+void JobSystem::WakeWorker() {
+    if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard lock(m_sleepMutex);
+        m_sleepCondition.notify_one();
     }
 }
 
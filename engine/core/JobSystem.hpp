@@ -13,6 +13,10 @@
 #include <array>
 #include <string>
 #include <cassert>
+#include <new>
+#include <type_traits>
+
+#include "WorkStealingDeque.hpp"
 
 namespace Nova {
 
@@ -32,90 +36,157 @@ enum class JobPriority : uint8_t {
 struct JobSystemConfig {
     uint32_t workerThreads = 0;  // 0 = auto (hardware_concurrency - 1)
     bool enablePriorities = true;
-    size_t queueCapacity = 4096;
+    size_t queueCapacity = 4096;  // Max in-flight jobs from external threads (workers get a quarter each)
     std::string threadNamePrefix = "Nova_Worker_";
 };
 
+class JobCounter;
+class JobSystem;
+
+namespace detail {
+
+/**
+ * @brief Pooled storage for a single submitted job
+ *
+ * Small callables (including std::function) are constructed in place in the
+ * inline buffer; oversized captures fall back to a heap allocation. Slots are
+ * recycled through per-thread free lists and never returned to the OS until
+ * the job system shuts down.
+ */
+struct alignas(64) JobSlot {
+    static constexpr size_t kInlineSize = 64;
+
+    alignas(std::max_align_t) unsigned char storage[kInlineSize];
+    void (*invoke)(JobSlot&) = nullptr;
+    void (*destroy)(JobSlot&) = nullptr;
+    JobCounter* counter = nullptr;
+    JobSlot* next = nullptr;              // Free list or continuation list link
+    std::atomic<uint32_t> generation{0};  // Bumped each time the job completes
+    uint32_t owner = 0;                   // Index of the free list this slot returns to
+    JobPriority priority = JobPriority::Normal;
+
+    template<typename F>
+    void Emplace(F&& func) {
+        using Fn = std::decay_t<F>;
+        if constexpr (sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(std::max_align_t)) {
+            ::new (static_cast<void*>(storage)) Fn(std::forward<F>(func));
+            invoke = [](JobSlot& slot) { (*std::launder(reinterpret_cast<Fn*>(slot.storage)))(); };
+            destroy = [](JobSlot& slot) { std::launder(reinterpret_cast<Fn*>(slot.storage))->~Fn(); };
+        } else {
+            ::new (static_cast<void*>(storage)) Fn*(new Fn(std::forward<F>(func)));
+            invoke = [](JobSlot& slot) { (**std::launder(reinterpret_cast<Fn**>(slot.storage)))(); };
+            destroy = [](JobSlot& slot) { delete *std::launder(reinterpret_cast<Fn**>(slot.storage)); };
+        }
+    }
+};
+
+} // namespace detail
+
 /**
  * @brief Lightweight job handle for tracking completion
+ *
+ * Refers to a pooled job slot plus the generation it was submitted with; the
+ * job is complete once the slot's generation moves on. Handles must not
+ * outlive the JobSystem.
  */
 class JobHandle {
 public:
     JobHandle() = default;
-    explicit JobHandle(std::shared_ptr<std::atomic<bool>> completed)
-        : m_completed(std::move(completed)) {}
 
     /**
      * @brief Check if job is complete (non-blocking)
      */
     [[nodiscard]] bool IsComplete() const {
-        return !m_completed || m_completed->load(std::memory_order_acquire);
+        return !m_slot || m_slot->generation.load(std::memory_order_acquire) != m_generation;
     }
 
     /**
-     * @brief Wait for job completion (blocking)
+     * @brief Wait for job completion
+     *
+     * Runs other pending jobs while waiting, so it is safe to call from
+     * inside a job without parking the worker.
      */
-    void Wait() const {
-        if (m_completed) {
-            while (!m_completed->load(std::memory_order_acquire)) {
-                std::this_thread::yield();
-            }
-        }
-    }
+    void Wait() const;
 
     /**
      * @brief Check if handle is valid
      */
-    [[nodiscard]] bool IsValid() const { return m_completed != nullptr; }
+    [[nodiscard]] bool IsValid() const { return m_slot != nullptr; }
 
 private:
-    std::shared_ptr<std::atomic<bool>> m_completed;
+    friend class JobSystem;
+
+    JobHandle(const detail::JobSlot* slot, uint32_t generation)
+        : m_slot(slot), m_generation(generation) {}
+
+    const detail::JobSlot* m_slot = nullptr;
+    uint32_t m_generation = 0;
 };
 
 /**
  * @brief Counter for batch job synchronization
+ *
+ * Also acts as a dependency: jobs submitted with JobSystem::SubmitAfter()
+ * are held on the counter and enqueued when it reaches zero.
  */
 class JobCounter {
 public:
     explicit JobCounter(uint32_t count = 0)
         : m_count(count) {}
 
+    ~JobCounter() {
+        assert(!m_continuations && "JobCounter destroyed with pending continuations");
+    }
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
     void Increment(uint32_t n = 1) {
         m_count.fetch_add(n, std::memory_order_release);
     }
 
-    void Decrement() {
-        m_count.fetch_sub(1, std::memory_order_release);
-        m_cv.notify_all();
-    }
+    /**
+     * @brief Decrement the counter, releasing waiters and continuations at zero
+     */
+    void Decrement();
 
     [[nodiscard]] bool IsComplete() const {
         return m_count.load(std::memory_order_acquire) == 0;
     }
 
-    void Wait() {
-        std::unique_lock lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return m_count.load(std::memory_order_acquire) == 0;
-        });
-    }
+    /**
+     * @brief Wait until the counter reaches zero
+     *
+     * Runs other pending jobs while waiting, so nested waits inside jobs keep
+     * the worker busy instead of blocking it. Threads that find nothing to
+     * run park on a condition variable. Call this (rather than polling
+     * IsComplete()) before destroying a counter that jobs still reference.
+     */
+    void Wait();
 
     [[nodiscard]] uint32_t GetCount() const {
         return m_count.load(std::memory_order_acquire);
     }
 
 private:
+    friend class JobSystem;
+
     std::atomic<uint32_t> m_count;
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    detail::JobSlot* m_continuations = nullptr;  // Guarded by m_mutex
 };
 
 /**
- * @brief Simple, efficient job system for parallel work distribution
+ * @brief Work-stealing job system for parallel work distribution
  *
  * Features:
- * - Work-stealing for load balancing
- * - Priority queues for critical work
+ * - Per-worker Chase-Lev deques; idle workers steal from random victims
+ * - Lock-free injection queues for submissions from non-worker threads
+ * - One queue per priority level, drained highest priority first
+ * - Waits run other jobs instead of blocking, so nested parallelism is safe
+ * - Dependent jobs via SubmitAfter() without parking any thread
+ * - Pooled job storage: no allocation per Submit for small callables
  * - Batch job support with counters
  * - Parallel-for helper
  */
@@ -124,6 +195,8 @@ public:
     using Job = std::function<void()>;
     using JobWithData = std::function<void(void*)>;
 
+    static constexpr size_t kPriorityCount = 4;
+
     /**
      * @brief Get singleton instance
      */
@@ -147,6 +220,11 @@ public:
 
     /**
      * @brief Shutdown the job system
+     *
+     * Jobs already queued still run to completion, including nested work
+     * they wait on; whatever the workers leave is run on the calling thread
+     * so that outstanding handles and counters resolve. Jobs submitted once
+     * shutdown has begun run immediately on the submitting thread.
      */
     void Shutdown();
 
@@ -157,19 +235,76 @@ public:
 
     /**
      * @brief Submit a job to the queue
-     * @param job Function to execute
+     * @param func Callable to execute
      * @param priority Job priority
      * @return Handle to track completion
      */
-    [[nodiscard]] JobHandle Submit(Job job, JobPriority priority = JobPriority::Normal);
+    template<typename F>
+    [[nodiscard]] JobHandle Submit(F&& func, JobPriority priority = JobPriority::Normal) {
+        detail::JobSlot* slot = AcquireSlot();
+        slot->Emplace(std::forward<F>(func));
+        slot->counter = nullptr;
+        // Read before enqueueing: the slot may complete and be recycled immediately
+        const uint32_t generation = slot->generation.load(std::memory_order_relaxed);
+        Enqueue(slot, priority);
+        return JobHandle(slot, generation);
+    }
 
     /**
      * @brief Submit a job with associated counter (for batch operations)
-     * @param job Function to execute
+     * @param func Callable to execute
      * @param counter Counter to decrement on completion
      * @param priority Job priority
      */
-    void Submit(Job job, JobCounter& counter, JobPriority priority = JobPriority::Normal);
+    template<typename F>
+    void Submit(F&& func, JobCounter& counter, JobPriority priority = JobPriority::Normal) {
+        counter.Increment();
+        detail::JobSlot* slot = AcquireSlot();
+        slot->Emplace(std::forward<F>(func));
+        slot->counter = &counter;
+        Enqueue(slot, priority);
+    }
+
+    /**
+     * @brief Submit a job that runs once a dependency counter reaches zero
+     *
+     * The job is parked on the dependency rather than blocking a thread. To
+     * express "B after A and C", submit A and C against the same counter and
+     * pass it here; submit all dependencies before calling this, since a
+     * counter that is already zero releases the job immediately.
+     *
+     * @param dependency Counter that must reach zero first
+     * @param func Callable to execute
+     * @param priority Job priority
+     * @return Handle to track completion
+     */
+    template<typename F>
+    [[nodiscard]] JobHandle SubmitAfter(JobCounter& dependency, F&& func,
+                                        JobPriority priority = JobPriority::Normal) {
+        detail::JobSlot* slot = AcquireSlot();
+        slot->Emplace(std::forward<F>(func));
+        slot->counter = nullptr;
+        const uint32_t generation = slot->generation.load(std::memory_order_relaxed);
+        EnqueueAfter(dependency, slot, priority);
+        return JobHandle(slot, generation);
+    }
+
+    /**
+     * @brief Submit a dependent job with its own completion counter
+     * @param dependency Counter that must reach zero first
+     * @param func Callable to execute
+     * @param counter Counter to decrement on completion (can feed further SubmitAfter calls)
+     * @param priority Job priority
+     */
+    template<typename F>
+    void SubmitAfter(JobCounter& dependency, F&& func, JobCounter& counter,
+                     JobPriority priority = JobPriority::Normal) {
+        counter.Increment();
+        detail::JobSlot* slot = AcquireSlot();
+        slot->Emplace(std::forward<F>(func));
+        slot->counter = &counter;
+        EnqueueAfter(dependency, slot, priority);
+    }
 
     /**
      * @brief Submit multiple jobs and return when all complete
@@ -193,6 +328,11 @@ public:
      */
     void ParallelFor(size_t count, const std::function<void(size_t)>& func);
 
+    /**
+     * @brief Parallel for loop over [start, end) with automatic batching
+     */
+    void ParallelFor(size_t start, size_t end, const std::function<void(size_t)>& func);
+
     /**
      * @brief Parallel for loop over a range with data
      * @param start Start index
@@ -224,39 +364,71 @@ public:
     bool YieldAndProcess();
 
 private:
+    friend class JobCounter;
+
     JobSystem() = default;
     ~JobSystem();
 
-    struct PrioritizedJob {
-        Job job;
-        std::shared_ptr<std::atomic<bool>> completed;
-        JobCounter* counter = nullptr;
-        JobPriority priority = JobPriority::Normal;
+    static constexpr uint32_t kExternalThread = ~0u;
 
-        bool operator<(const PrioritizedJob& other) const {
-            return static_cast<int>(priority) < static_cast<int>(other.priority);
-        }
+    /**
+     * @brief Free list of job slots owned by one thread (or by all external threads)
+     *
+     * The owner pops from a private list; any thread returning a slot pushes
+     * onto the atomic remote list, which the owner takes wholesale when its
+     * private list runs dry. Only pushes and take-all touch the remote list,
+     * so it is ABA-free.
+     */
+    struct alignas(64) SlotPool {
+        std::unique_ptr<detail::JobSlot[]> slots;
+        size_t capacity = 0;
+        detail::JobSlot* freeList = nullptr;
+        alignas(64) std::atomic<detail::JobSlot*> remoteFree{nullptr};
     };
 
-    void WorkerLoop(uint32_t threadIndex);
-    std::optional<PrioritizedJob> TryGetJob();
-    void ExecuteJob(PrioritizedJob& job);
+    struct WorkerState {
+        explicit WorkerState(size_t capacity);
+
+        std::array<std::unique_ptr<WorkStealingDeque<detail::JobSlot*>>, kPriorityCount> deques;
+        std::thread thread;
+    };
 
-    // Worker threads
-    std::vector<std::thread> m_workers;
+    void WorkerLoop(uint32_t threadIndex);
+    detail::JobSlot* AcquireSlot();
+    detail::JobSlot* TryAcquireSlot(uint32_t poolIndex);
+    void ReleaseSlot(detail::JobSlot* slot);
+    void Enqueue(detail::JobSlot* slot, JobPriority priority);
+    void EnqueueAfter(JobCounter& dependency, detail::JobSlot* slot, JobPriority priority);
+    void EnqueueContinuations(detail::JobSlot* list);
+    detail::JobSlot* TryGetJob();
+    void ExecuteJob(detail::JobSlot* slot);
+    void WakeWorker();
+
+    // Worker threads and their deques
+    std::vector<std::unique_ptr<WorkerState>> m_workers;
     uint32_t m_workerCount = 0;
 
-    // Job queue with priority support
-    std::priority_queue<PrioritizedJob> m_jobQueue;
-    mutable std::mutex m_queueMutex;
-    std::condition_variable m_condition;
+    // Submissions from non-worker threads, one queue per priority
+    std::array<std::unique_ptr<BoundedMPMCQueue<detail::JobSlot*>>, kPriorityCount> m_injectionQueues;
+
+    // Job slot pools: one per worker plus a shared one (index m_workerCount) for external threads
+    std::vector<std::unique_ptr<SlotPool>> m_slotPools;
+    std::mutex m_externalPoolMutex;
+
+    // Sleeping support - workers only park after finding nothing to do
+    std::atomic<int64_t> m_pendingJobs{0};
+    std::atomic<uint32_t> m_sleepingWorkers{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCondition;
 
-    // State
+    // State: m_running while the queues exist, m_accepting while new jobs may be queued
     std::atomic<bool> m_running{false};
+    std::atomic<bool> m_accepting{false};
     bool m_initialized = false;
+    bool m_enablePriorities = true;
 
-    // Thread identification
-    thread_local static bool s_isWorkerThread;
+    // Thread identification (kExternalThread for non-workers)
+    thread_local static uint32_t s_workerIndex;
 };
 
 /**
@@ -318,7 +490,7 @@ T Reduce(InputIt first, InputIt last, T init, BinaryOp op) {
 
     size_t chunkSize = (count + numThreads - 1) / numThreads;
 
-    JobCounter counter(numThreads);
+    JobCounter counter;
     for (uint32_t t = 0; t < numThreads; ++t) {
         size_t start = t * chunkSize;
         size_t end = std::min(start + chunkSize, count);
@@ -357,7 +529,7 @@ void Sort(RandomIt first, RandomIt last, Compare comp, size_t threshold = 10000)
     auto mid = first + count / 2;
     std::nth_element(first, mid, last, comp);
 
-    JobCounter counter(2);
+    JobCounter counter;
 
     JobSystem::Instance().Submit([&]() {
         Sort(first, mid, comp, threshold);
@@ -52,6 +52,8 @@
 #include <deque>
 #include <memory>
 #include <cstdint>
+#include <cmath>
+#include <limits>
 
 namespace Nova {
 
@@ -2,6 +2,7 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <array>
@@ -487,5 +488,222 @@ inline void MultiplyAddVectors(const float* a, const float* b, const float* c,
 #endif
 }
 
+// =============================================================================
+// Lane Batches
+// =============================================================================
+
+/**
+ * @brief Widest float lane batch available at compile time
+ *
+ * One element per lane for SoA kernels: 8 lanes with AVX, 4 with SSE or
+ * NEON, 1 otherwise. Comparison results are lane masks (all bits set or
+ * clear) consumed by Select/And. Loads and stores are unaligned-safe;
+ * AlignedSoA arrays make them aligned in practice.
+ */
+struct FloatBatch {
+#if defined(NOVA_AVX_SUPPORT)
+    static constexpr size_t Width = 8;
+    __m256 data;
+
+    FloatBatch() : data(_mm256_setzero_ps()) {}
+    FloatBatch(__m256 v) : data(v) {}
+
+    static FloatBatch Load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+    static FloatBatch Broadcast(float value) { return _mm256_set1_ps(value); }
+    void Store(float* ptr) const { _mm256_storeu_ps(ptr, data); }
+
+    FloatBatch operator+(FloatBatch o) const { return _mm256_add_ps(data, o.data); }
+    FloatBatch operator-(FloatBatch o) const { return _mm256_sub_ps(data, o.data); }
+    FloatBatch operator*(FloatBatch o) const { return _mm256_mul_ps(data, o.data); }
+    FloatBatch operator/(FloatBatch o) const { return _mm256_div_ps(data, o.data); }
+#elif defined(NOVA_SSE_SUPPORT)
+    static constexpr size_t Width = 4;
+    __m128 data;
+
+    FloatBatch() : data(_mm_setzero_ps()) {}
+    FloatBatch(__m128 v) : data(v) {}
+
+    static FloatBatch Load(const float* ptr) { return _mm_loadu_ps(ptr); }
+    static FloatBatch Broadcast(float value) { return _mm_set1_ps(value); }
+    void Store(float* ptr) const { _mm_storeu_ps(ptr, data); }
+
+    FloatBatch operator+(FloatBatch o) const { return _mm_add_ps(data, o.data); }
+    FloatBatch operator-(FloatBatch o) const { return _mm_sub_ps(data, o.data); }
+    FloatBatch operator*(FloatBatch o) const { return _mm_mul_ps(data, o.data); }
+    FloatBatch operator/(FloatBatch o) const { return _mm_div_ps(data, o.data); }
+#elif defined(NOVA_NEON_SUPPORT)
+    static constexpr size_t Width = 4;
+    float32x4_t data;
+
+    FloatBatch() : data(vdupq_n_f32(0.0f)) {}
+    FloatBatch(float32x4_t v) : data(v) {}
+
+    static FloatBatch Load(const float* ptr) { return vld1q_f32(ptr); }
+    static FloatBatch Broadcast(float value) { return vdupq_n_f32(value); }
+    void Store(float* ptr) const { vst1q_f32(ptr, data); }
+
+    FloatBatch operator+(FloatBatch o) const { return vaddq_f32(data, o.data); }
+    FloatBatch operator-(FloatBatch o) const { return vsubq_f32(data, o.data); }
+    FloatBatch operator*(FloatBatch o) const { return vmulq_f32(data, o.data); }
+    FloatBatch operator/(FloatBatch o) const {
+        // Two Newton steps on the reciprocal estimate (no vdivq_f32 on ARMv7)
+        float32x4_t r = vrecpeq_f32(o.data);
+        r = vmulq_f32(vrecpsq_f32(o.data, r), r);
+        r = vmulq_f32(vrecpsq_f32(o.data, r), r);
+        return vmulq_f32(data, r);
+    }
+#else
+    static constexpr size_t Width = 1;
+    float data;
+
+    FloatBatch() : data(0.0f) {}
+    FloatBatch(float v) : data(v) {}
+
+    static FloatBatch Load(const float* ptr) { return *ptr; }
+    static FloatBatch Broadcast(float value) { return value; }
+    void Store(float* ptr) const { *ptr = data; }
+
+    FloatBatch operator+(FloatBatch o) const { return data + o.data; }
+    FloatBatch operator-(FloatBatch o) const { return data - o.data; }
+    FloatBatch operator*(FloatBatch o) const { return data * o.data; }
+    FloatBatch operator/(FloatBatch o) const { return data / o.data; }
+#endif
+};
+
+/**
+ * @brief a * b + c (fused when FMA is available)
+ */
+[[nodiscard]] inline FloatBatch MulAdd(FloatBatch a, FloatBatch b, FloatBatch c) {
+#if defined(NOVA_AVX_SUPPORT) && defined(__FMA__)
+    return _mm256_fmadd_ps(a.data, b.data, c.data);
+#elif defined(NOVA_NEON_SUPPORT)
+    return vmlaq_f32(c.data, a.data, b.data);
+#else
+    return a * b + c;
+#endif
+}
+
+[[nodiscard]] inline FloatBatch Sqrt(FloatBatch v) {
+#if defined(NOVA_AVX_SUPPORT)
+    return _mm256_sqrt_ps(v.data);
+#elif defined(NOVA_SSE_SUPPORT)
+    return _mm_sqrt_ps(v.data);
+#elif defined(NOVA_NEON_SUPPORT)
+    // sqrt(x) = x * rsqrt(x), refined; zero stays zero
+    float32x4_t r = vrsqrteq_f32(v.data);
+    r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v.data, r), r), r);
+    r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(v.data, r), r), r);
+    uint32x4_t nonZero = vcgtq_f32(v.data, vdupq_n_f32(0.0f));
+    return vreinterpretq_f32_u32(vandq_u32(nonZero, vreinterpretq_u32_f32(vmulq_f32(v.data, r))));
+#else
+    return std::sqrt(v.data);
+#endif
+}
+
+/**
+ * @brief Lane mask of a < b
+ */
+[[nodiscard]] inline FloatBatch CmpLt(FloatBatch a, FloatBatch b) {
+#if defined(NOVA_AVX_SUPPORT)
+    return _mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ);
+#elif defined(NOVA_SSE_SUPPORT)
+    return _mm_cmplt_ps(a.data, b.data);
+#elif defined(NOVA_NEON_SUPPORT)
+    return vreinterpretq_f32_u32(vcltq_f32(a.data, b.data));
+#else
+    uint32_t bits = a.data < b.data ? ~0u : 0u;
+    float mask;
+    std::memcpy(&mask, &bits, sizeof(mask));
+    return mask;
+#endif
+}
+
+/**
+ * @brief Lane mask of a > b
+ */
+[[nodiscard]] inline FloatBatch CmpGt(FloatBatch a, FloatBatch b) {
+    return CmpLt(b, a);
+}
+
+/**
+ * @brief Bitwise AND of two lane masks
+ */
+[[nodiscard]] inline FloatBatch And(FloatBatch a, FloatBatch b) {
+#if defined(NOVA_AVX_SUPPORT)
+    return _mm256_and_ps(a.data, b.data);
+#elif defined(NOVA_SSE_SUPPORT)
+    return _mm_and_ps(a.data, b.data);
+#elif defined(NOVA_NEON_SUPPORT)
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.data), vreinterpretq_u32_f32(b.data)));
+#else
+    uint32_t bitsA, bitsB;
+    std::memcpy(&bitsA, &a.data, sizeof(bitsA));
+    std::memcpy(&bitsB, &b.data, sizeof(bitsB));
+    bitsA &= bitsB;
+    float mask;
+    std::memcpy(&mask, &bitsA, sizeof(mask));
+    return mask;
+#endif
+}
+
+/**
+ * @brief Bitwise OR of two lane masks
+ */
+[[nodiscard]] inline FloatBatch Or(FloatBatch a, FloatBatch b) {
+#if defined(NOVA_AVX_SUPPORT)
+    return _mm256_or_ps(a.data, b.data);
+#elif defined(NOVA_SSE_SUPPORT)
+    return _mm_or_ps(a.data, b.data);
+#elif defined(NOVA_NEON_SUPPORT)
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.data), vreinterpretq_u32_f32(b.data)));
+#else
+    uint32_t bitsA, bitsB;
+    std::memcpy(&bitsA, &a.data, sizeof(bitsA));
+    std::memcpy(&bitsB, &b.data, sizeof(bitsB));
+    bitsA |= bitsB;
+    float mask;
+    std::memcpy(&mask, &bitsA, sizeof(mask));
+    return mask;
+#endif
+}
+
+/**
+ * @brief One bit per lane of a mask, lane 0 in bit 0
+ */
+[[nodiscard]] inline uint32_t MoveMask(FloatBatch mask) {
+#if defined(NOVA_AVX_SUPPORT)
+    return static_cast<uint32_t>(_mm256_movemask_ps(mask.data));
+#elif defined(NOVA_SSE_SUPPORT)
+    return static_cast<uint32_t>(_mm_movemask_ps(mask.data));
+#elif defined(NOVA_NEON_SUPPORT)
+    const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(mask.data), 31);
+    return vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) |
+           (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &mask.data, sizeof(bits));
+    return bits >> 31;
+#endif
+}
+
+/**
+ * @brief Per lane: mask ? a : b
+ */
+[[nodiscard]] inline FloatBatch Select(FloatBatch mask, FloatBatch a, FloatBatch b) {
+#if defined(NOVA_AVX_SUPPORT)
+    return _mm256_blendv_ps(b.data, a.data, mask.data);
+#elif defined(NOVA_SSE4_SUPPORT)
+    return _mm_blendv_ps(b.data, a.data, mask.data);
+#elif defined(NOVA_SSE_SUPPORT)
+    return _mm_or_ps(_mm_and_ps(mask.data, a.data), _mm_andnot_ps(mask.data, b.data));
+#elif defined(NOVA_NEON_SUPPORT)
+    return vbslq_f32(vreinterpretq_u32_f32(mask.data), a.data, b.data);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &mask.data, sizeof(bits));
+    return bits ? a : b;
+#endif
+}
+
 } // namespace SIMD
 } // namespace Nova
@@ -9,6 +9,9 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
+#include <cstdint>
+#include <memory>
+#include <new>
 
 namespace Nova {
 
@@ -225,10 +228,40 @@ private:
     std::tuple<std::vector<Components>...> m_arrays;
 };
 
+/**
+ * @brief Allocator returning memory aligned to a fixed boundary
+ */
+template<typename T, size_t Align>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template<typename U>
+    struct rebind { using other = AlignedAllocator<U, Align>; };
+
+    AlignedAllocator() noexcept = default;
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Align}));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t{Align});
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Align>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Align>&) const noexcept { return false; }
+};
+
 /**
  * @brief Aligned SoA for SIMD operations
  *
- * Ensures each array is aligned for efficient SIMD access.
+ * Ensures each array is aligned for efficient SIMD access. Components are
+ * addressed by index, so the same type may appear more than once (e.g. one
+ * float array per vector axis).
  */
 template<typename... Components>
 class AlignedSoA {
@@ -241,14 +274,30 @@ public:
      * @brief Aligned vector type
      */
     template<typename T>
-    using AlignedVector = std::vector<T, std::allocator<T>>;  // Use aligned_alloc in real impl
+    using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
 
     Index Add(Components... components) {
         Index idx = static_cast<Index>(Size());
-        (std::get<AlignedVector<Components>>(m_arrays).push_back(std::move(components)), ...);
+        AddImpl(std::index_sequence_for<Components...>{}, std::move(components)...);
         return idx;
     }
 
+    /**
+     * @brief Remove element at index (swap with last, O(1))
+     * @return Index of element that was moved to fill the gap (or INVALID_INDEX if was last)
+     */
+    Index Remove(Index index) {
+        assert(index < Size() && "Invalid index");
+
+        Index lastIdx = static_cast<Index>(Size() - 1);
+        if (index != lastIdx) {
+            SwapWithLast(index, std::index_sequence_for<Components...>{});
+        }
+        PopBack(std::index_sequence_for<Components...>{});
+
+        return (index != lastIdx) ? index : ~Index{0};
+    }
+
     template<size_t I>
     [[nodiscard]] auto& Get() {
         return std::get<I>(m_arrays);
@@ -259,19 +308,48 @@ public:
         return std::get<I>(m_arrays);
     }
 
+    /**
+     * @brief Raw aligned pointer to a component array (for SIMD kernels)
+     */
+    template<size_t I>
+    [[nodiscard]] auto* Data() {
+        return std::get<I>(m_arrays).data();
+    }
+
+    template<size_t I>
+    [[nodiscard]] const auto* Data() const {
+        return std::get<I>(m_arrays).data();
+    }
+
     [[nodiscard]] size_t Size() const {
         return std::get<0>(m_arrays).size();
     }
 
     void Reserve(size_t capacity) {
-        (std::get<AlignedVector<Components>>(m_arrays).reserve(capacity), ...);
+        std::apply([capacity](auto&... arrays) { (arrays.reserve(capacity), ...); }, m_arrays);
     }
 
     void Clear() {
-        (std::get<AlignedVector<Components>>(m_arrays).clear(), ...);
+        std::apply([](auto&... arrays) { (arrays.clear(), ...); }, m_arrays);
     }
 
 private:
+    template<size_t... Is>
+    void AddImpl(std::index_sequence<Is...>, Components&&... components) {
+        (std::get<Is>(m_arrays).push_back(std::move(components)), ...);
+    }
+
+    template<size_t... Is>
+    void SwapWithLast(Index index, std::index_sequence<Is...>) {
+        ((std::swap(std::get<Is>(m_arrays)[index],
+                    std::get<Is>(m_arrays).back())), ...);
+    }
+
+    template<size_t... Is>
+    void PopBack(std::index_sequence<Is...>) {
+        (std::get<Is>(m_arrays).pop_back(), ...);
+    }
+
     std::tuple<AlignedVector<Components>...> m_arrays;
 };
 
@@ -0,0 +1,347 @@
+/**
+ * @file TraceCapture.cpp
+ * @brief Implementation of per-thread trace capture and JSON streaming
+ */
+
+#include "TraceCapture.hpp"
+#include "debug/ProfilerChrome.hpp"
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <unordered_map>
+
+namespace Nova {
+
+namespace {
+
+/**
+ * @brief Process-wide name table; IDs index into escapedNames
+ */
+struct TraceNameTable {
+    std::mutex mutex;
+    std::unordered_map<std::string, TraceNameId> ids;
+    std::deque<std::string> escapedNames;  // Deque: stable references while appending
+};
+
+TraceNameTable& GetNameTable() {
+    static TraceNameTable table;
+    return table;
+}
+
+std::string EscapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"':  escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20) {
+                    escaped += c;
+                }
+                break;
+        }
+    }
+    return escaped;
+}
+
+void AppendUInt(std::string& out, uint64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+// Chrome trace timestamps are microseconds; keep sub-microsecond precision
+void AppendMicroseconds(std::string& out, uint64_t ns) {
+    AppendUInt(out, ns / 1000);
+    out += '.';
+    const uint64_t frac = ns % 1000;
+    out += static_cast<char>('0' + frac / 100);
+    out += static_cast<char>('0' + (frac / 10) % 10);
+    out += static_cast<char>('0' + frac % 10);
+}
+
+constexpr size_t kWriteBatchBytes = 1 << 20;
+
+} // namespace
+
+thread_local TraceCapture::ThreadBuffer* TraceCapture::t_buffer = nullptr;
+thread_local TraceCapture::ThreadBufferHandle TraceCapture::t_bufferHandle;
+thread_local std::string TraceCapture::t_threadName;
+
+TraceCapture::ThreadBuffer::ThreadBuffer(size_t requestedCapacity)
+    : capacity([requestedCapacity] {
+          size_t result = 1;
+          while (result < requestedCapacity) result <<= 1;
+          return result;
+      }())
+    , mask(capacity - 1)
+    , records(std::make_unique<TraceRecord[]>(capacity)) {}
+
+TraceCapture::ThreadBufferHandle::~ThreadBufferHandle() {
+    if (t_buffer) {
+        t_buffer->retired.store(true, std::memory_order_release);
+        t_buffer = nullptr;
+    }
+}
+
+TraceCapture& TraceCapture::Instance() {
+    static TraceCapture instance;
+    return instance;
+}
+
+TraceCapture::~TraceCapture() {
+    Stop();
+}
+
+TraceNameId TraceCapture::InternName(std::string_view name) {
+    TraceNameTable& table = GetNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.ids.find(std::string(name));
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+
+    const TraceNameId id = static_cast<TraceNameId>(table.escapedNames.size());
+    table.escapedNames.push_back(EscapeJson(name));
+    table.ids.emplace(std::string(name), id);
+    return id;
+}
+
+bool TraceCapture::Start(const TraceCaptureConfig& config) {
+    if (m_capturing.load(std::memory_order_acquire) || m_flusher.joinable()) {
+        return false;
+    }
+
+    m_output.open(config.filepath, std::ios::out | std::ios::trunc);
+    if (!m_output) {
+        return false;
+    }
+
+    m_config = config;
+    m_sessionStartNs = Now();
+    m_writtenEvents = 0;
+    m_stopRequested = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        m_retiredDropped = 0;
+        for (auto& buffer : m_buffers) {
+            buffer->nameWritten = false;
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::string header = "{\"traceEvents\":[";
+    header += "\n{\"name\":\"process_name\",\"ph\":\"";
+    header += static_cast<char>(TraceEventType::Metadata);
+    header += "\",\"pid\":";
+    AppendUInt(header, m_config.processId);
+    header += ",\"tid\":0,\"args\":{\"name\":\"Nova Engine\"}}";
+    m_output << header;
+
+    m_capturing.store(true, std::memory_order_release);
+    m_flusher = std::thread(&TraceCapture::FlusherLoop, this);
+    return true;
+}
+
+void TraceCapture::Stop() {
+    if (!m_flusher.joinable()) {
+        return;
+    }
+
+    m_capturing.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_flushMutex);
+        m_stopRequested = true;
+    }
+    m_flushCondition.notify_all();
+    m_flusher.join();
+
+    // Final drain picks up anything recorded between the last flush and Stop()
+    Drain();
+
+    m_output << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"version\":\"Nova Engine TraceCapture 1.0\"";
+    m_output << ",\"droppedEvents\":" << GetDroppedEventCount() << "}}";
+    m_output.close();
+}
+
+void TraceCapture::SetThreadName(std::string_view name) {
+    t_threadName = std::string(name);
+    if (t_buffer) {
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        t_buffer->threadName = t_threadName;
+        t_buffer->nameWritten = false;
+    }
+}
+
+uint64_t TraceCapture::GetDroppedEventCount() const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    uint64_t dropped = m_retiredDropped;
+    for (const auto& buffer : m_buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+TraceCapture::ThreadBuffer* TraceCapture::RegisterThread() {
+    if (!IsCapturing()) {
+        return nullptr;
+    }
+
+    // Touch the handle so its destructor retires the ring on thread exit
+    (void)&t_bufferHandle;
+
+    auto buffer = std::make_unique<ThreadBuffer>(m_config.eventsPerThread);
+
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    buffer->threadId = m_nextThreadId++;
+    buffer->threadName = t_threadName.empty()
+        ? "Thread " + std::to_string(buffer->threadId)
+        : t_threadName;
+    t_buffer = buffer.get();
+    m_buffers.push_back(std::move(buffer));
+    return t_buffer;
+}
+
+void TraceCapture::FlusherLoop() {
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    while (!m_stopRequested) {
+        m_flushCondition.wait_for(lock, std::chrono::milliseconds(m_config.flushIntervalMs),
+                                  [this] { return m_stopRequested; });
+        lock.unlock();
+        Drain();
+        lock.lock();
+    }
+}
+
+void TraceCapture::Drain() {
+    // Snapshot the registry, then format and write without holding any lock
+    // a producer might need (registering a ring, interning a name)
+    struct PendingRing {
+        ThreadBuffer* buffer;
+        bool retired;
+        bool writeName;
+        std::string threadName;
+    };
+    std::vector<PendingRing> rings;
+    {
+        std::lock_guard<std::mutex> registryLock(m_registryMutex);
+        rings.reserve(m_buffers.size());
+        for (auto& buffer : m_buffers) {
+            PendingRing& ring = rings.emplace_back();
+            ring.buffer = buffer.get();
+            ring.retired = buffer->retired.load(std::memory_order_acquire);
+            ring.writeName = !buffer->nameWritten;
+            if (ring.writeName) {
+                ring.threadName = buffer->threadName;
+                buffer->nameWritten = true;
+            }
+        }
+    }
+    {
+        // Names are append-only and deque elements never move, so pointers
+        // taken under the lock stay valid afterwards
+        TraceNameTable& table = GetNameTable();
+        std::lock_guard<std::mutex> namesLock(table.mutex);
+        for (size_t i = m_names.size(); i < table.escapedNames.size(); ++i) {
+            m_names.push_back(&table.escapedNames[i]);
+        }
+    }
+
+    std::string out;
+    out.reserve(kWriteBatchBytes);
+    uint64_t written = 0;
+    bool anyRetired = false;
+
+    // Rings are only released below, by this thread, so the pointers stay valid
+    for (const PendingRing& ring : rings) {
+        ThreadBuffer& buffer = *ring.buffer;
+        if (ring.writeName) {
+            AppendThreadName(out, buffer.threadId, ring.threadName);
+        }
+
+        const uint64_t read = buffer.readPos.load(std::memory_order_relaxed);
+        const uint64_t write = buffer.writePos.load(std::memory_order_acquire);
+        for (uint64_t pos = read; pos < write; ++pos) {
+            const TraceRecord& record = buffer.records[pos & buffer.mask];
+            // Skip records left over from a previous session
+            if (record.startNs >= m_sessionStartNs) {
+                AppendRecord(out, record, buffer.threadId);
+                ++written;
+            }
+            if (out.size() >= kWriteBatchBytes) {
+                m_output.write(out.data(), static_cast<std::streamsize>(out.size()));
+                out.clear();
+            }
+        }
+        buffer.readPos.store(write, std::memory_order_release);
+        anyRetired |= ring.retired;
+    }
+
+    if (!out.empty()) {
+        m_output.write(out.data(), static_cast<std::streamsize>(out.size()));
+    }
+    m_output.flush();
+    m_writtenEvents.fetch_add(written, std::memory_order_relaxed);
+
+    // Release rings whose owning thread was already gone before they were read
+    if (anyRetired) {
+        std::lock_guard<std::mutex> registryLock(m_registryMutex);
+        for (const PendingRing& ring : rings) {
+            if (!ring.retired) {
+                continue;
+            }
+            auto it = std::find_if(m_buffers.begin(), m_buffers.end(),
+                                   [&ring](const auto& buffer) { return buffer.get() == ring.buffer; });
+            if (it != m_buffers.end()) {
+                m_retiredDropped += (*it)->dropped.load(std::memory_order_relaxed);
+                m_buffers.erase(it);
+            }
+        }
+    }
+}
+
+void TraceCapture::AppendRecord(std::string& out, const TraceRecord& record, uint32_t threadId) const {
+    out += ",\n{\"name\":\"";
+    if (record.nameId < m_names.size()) {
+        out += *m_names[record.nameId];
+    } else {
+        out += '?';
+    }
+    out += "\",\"cat\":\"trace\",\"ph\":\"";
+    if (record.instant) {
+        out += static_cast<char>(TraceEventType::Instant);
+        out += "\",\"s\":\"t";
+    } else {
+        out += static_cast<char>(TraceEventType::Complete);
+    }
+    out += "\",\"ts\":";
+    AppendMicroseconds(out, record.startNs - m_sessionStartNs);
+    if (!record.instant) {
+        out += ",\"dur\":";
+        AppendMicroseconds(out, record.endNs >= record.startNs ? record.endNs - record.startNs : 0);
+    }
+    out += ",\"pid\":";
+    AppendUInt(out, m_config.processId);
+    out += ",\"tid\":";
+    AppendUInt(out, threadId);
+    out += '}';
+}
+
+void TraceCapture::AppendThreadName(std::string& out, uint32_t threadId, const std::string& name) const {
+    out += ",\n{\"name\":\"thread_name\",\"ph\":\"";
+    out += static_cast<char>(TraceEventType::Metadata);
+    out += "\",\"pid\":";
+    AppendUInt(out, m_config.processId);
+    out += ",\"tid\":";
+    AppendUInt(out, threadId);
+    out += ",\"args\":{\"name\":\"";
+    out += EscapeJson(name);
+    out += "\"}}";
+}
+
+} // namespace Nova
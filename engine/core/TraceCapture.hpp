@@ -0,0 +1,296 @@
+#pragma once
+
+/**
+ * @file TraceCapture.hpp
+ * @brief Low-overhead trace capture streamed to Chrome Trace / Perfetto JSON
+ *
+ * Complements the statistics-oriented Profiler for instrumenting hot loops:
+ * - Scope names are interned once per call site into static 32-bit IDs
+ * - Each thread appends fixed-size records to its own SPSC ring buffer,
+ *   with no locks, allocations or string handling on the hot path
+ * - A background flusher drains the rings and streams Chrome Trace JSON
+ *   (loadable in chrome://tracing and ui.perfetto.dev)
+ *
+ * When a ring is full the event is dropped and counted rather than
+ * stalling the instrumented thread.
+ *
+ * @section usage Usage Example
+ * @code
+ * TraceCaptureConfig config;
+ * config.filepath = "soak_trace.json";
+ * TraceCapture::Instance().Start(config);
+ *
+ * void UpdatePhysics() {
+ *     NOVA_TRACE_SCOPE("Physics::Step");
+ *     for (auto& island : islands) {
+ *         NOVA_TRACE_SCOPE("Physics::Island");
+ *         // ...
+ *     }
+ * }
+ *
+ * TraceCapture::Instance().Stop();
+ * @endcode
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Nova {
+
+using TraceNameId = uint32_t;
+
+/**
+ * @brief Configuration for a trace capture session
+ */
+struct TraceCaptureConfig {
+    std::string filepath = "nova_trace.json";
+    size_t eventsPerThread = 1 << 16;  // Ring capacity, fixed when a thread first records (rounded to power of two)
+    uint32_t flushIntervalMs = 50;     // How often the background flusher drains rings
+    uint32_t processId = 1;
+};
+
+/**
+ * @brief Fixed-size record written by instrumented threads
+ */
+struct TraceRecord {
+    uint64_t startNs = 0;
+    uint64_t endNs = 0;       // Equal to startNs for instant events
+    TraceNameId nameId = 0;
+    uint32_t instant = 0;
+};
+
+/**
+ * @brief Per-thread event capture with background streaming export
+ */
+class TraceCapture {
+public:
+    static TraceCapture& Instance();
+
+    TraceCapture(const TraceCapture&) = delete;
+    TraceCapture& operator=(const TraceCapture&) = delete;
+
+    /**
+     * @brief Intern a scope name, returning a stable ID for this process
+     *
+     * Takes a lock - call once per call site (the macros cache the result
+     * in a function-local static).
+     */
+    static TraceNameId InternName(std::string_view name);
+
+    /**
+     * @brief Begin streaming events to the configured file
+     * @return false if a session is already active or the file cannot be opened
+     */
+    bool Start(const TraceCaptureConfig& config = {});
+
+    /**
+     * @brief Stop capture, drain all rings and finalize the file
+     */
+    void Stop();
+
+    [[nodiscard]] bool IsCapturing() const noexcept {
+        return m_capturing.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Current timestamp in nanoseconds (steady clock)
+     */
+    [[nodiscard]] static uint64_t Now() noexcept {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Record a completed scope on the calling thread
+     */
+    void Record(TraceNameId nameId, uint64_t startNs, uint64_t endNs) noexcept {
+        ThreadBuffer* buffer = t_buffer;
+        if (!buffer) {
+            buffer = RegisterThread();
+            if (!buffer) return;
+        }
+        buffer->Push(TraceRecord{startNs, endNs, nameId, 0});
+    }
+
+    /**
+     * @brief Record an instant event on the calling thread
+     */
+    void RecordInstant(TraceNameId nameId) noexcept {
+        if (!IsCapturing()) return;
+        const uint64_t now = Now();
+        ThreadBuffer* buffer = t_buffer;
+        if (!buffer) {
+            buffer = RegisterThread();
+            if (!buffer) return;
+        }
+        buffer->Push(TraceRecord{now, now, nameId, 1});
+    }
+
+    /**
+     * @brief Name the calling thread in exported traces
+     *
+     * Cheap when not capturing; the name is applied once the thread records
+     * its first event.
+     */
+    void SetThreadName(std::string_view name);
+
+    /**
+     * @brief Events dropped because a thread's ring was full (current session)
+     */
+    [[nodiscard]] uint64_t GetDroppedEventCount() const;
+
+    /**
+     * @brief Events written to the output file (current session)
+     */
+    [[nodiscard]] uint64_t GetWrittenEventCount() const noexcept {
+        return m_writtenEvents.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief Single-producer (owning thread) / single-consumer (flusher) ring
+     */
+    struct ThreadBuffer {
+        explicit ThreadBuffer(size_t capacity);
+
+        void Push(const TraceRecord& record) noexcept {
+            const uint64_t write = writePos.load(std::memory_order_relaxed);
+            if (write - cachedReadPos >= capacity) {
+                cachedReadPos = readPos.load(std::memory_order_acquire);
+                if (write - cachedReadPos >= capacity) {
+                    dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            records[write & mask] = record;
+            writePos.store(write + 1, std::memory_order_release);
+        }
+
+        const size_t capacity;
+        const size_t mask;
+        std::unique_ptr<TraceRecord[]> records;
+
+        alignas(64) std::atomic<uint64_t> writePos{0};
+        uint64_t cachedReadPos = 0;                     // Producer-side copy of readPos
+        std::atomic<uint64_t> dropped{0};
+
+        alignas(64) std::atomic<uint64_t> readPos{0};   // Owned by the flusher
+        std::atomic<bool> retired{false};               // Owning thread has exited
+
+        uint32_t threadId = 0;
+        std::string threadName;                         // Guarded by TraceCapture::m_registryMutex
+        bool nameWritten = false;                       // Guarded by TraceCapture::m_registryMutex
+    };
+
+    struct ThreadBufferHandle {
+        ~ThreadBufferHandle();
+    };
+
+    TraceCapture() = default;
+    ~TraceCapture();
+
+    ThreadBuffer* RegisterThread();
+    void FlusherLoop();
+    void Drain();
+    void AppendRecord(std::string& out, const TraceRecord& record, uint32_t threadId) const;
+    void AppendThreadName(std::string& out, uint32_t threadId, const std::string& name) const;
+
+    static thread_local ThreadBuffer* t_buffer;
+    static thread_local ThreadBufferHandle t_bufferHandle;
+    static thread_local std::string t_threadName;
+
+    TraceCaptureConfig m_config;
+    std::atomic<bool> m_capturing{false};
+    uint64_t m_sessionStartNs = 0;
+
+    // Registered thread rings (only touched by producers on registration)
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    mutable std::mutex m_registryMutex;
+    uint32_t m_nextThreadId = 1;
+
+    // Output stream, owned by the flusher while a session is active
+    std::ofstream m_output;
+    std::atomic<uint64_t> m_writtenEvents{0};
+    std::vector<const std::string*> m_names;  // Escaped names by ID, copied from the name table by Drain()
+    uint64_t m_retiredDropped = 0;  // Dropped by threads whose rings were released; guarded by m_registryMutex
+
+    std::thread m_flusher;
+    std::mutex m_flushMutex;
+    std::condition_variable m_flushCondition;
+    bool m_stopRequested = false;
+};
+
+/**
+ * @brief RAII scope that records a complete event on destruction
+ */
+class TraceScope {
+public:
+    explicit TraceScope(TraceNameId nameId) noexcept
+        : m_nameId(nameId)
+        , m_startNs(TraceCapture::Instance().IsCapturing() ? TraceCapture::Now() : 0) {}
+
+    ~TraceScope() {
+        if (m_startNs != 0) {
+            TraceCapture::Instance().Record(m_nameId, m_startNs, TraceCapture::Now());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceNameId m_nameId;
+    uint64_t m_startNs;
+};
+
+} // namespace Nova
+
+// =============================================================================
+// Trace Macros
+// =============================================================================
+
+#ifndef NOVA_PROFILE_ENABLED
+#define NOVA_PROFILE_ENABLED 1
+#endif
+
+#define NOVA_TRACE_CONCAT_IMPL(a, b) a##b
+#define NOVA_TRACE_CONCAT(a, b) NOVA_TRACE_CONCAT_IMPL(a, b)
+
+#if NOVA_PROFILE_ENABLED
+
+/**
+ * @brief Trace a scope into the capture ring (name must be a string literal or otherwise stable)
+ */
+#define NOVA_TRACE_SCOPE(name) \
+    static const ::Nova::TraceNameId NOVA_TRACE_CONCAT(_nova_trace_id_, __LINE__) = \
+        ::Nova::TraceCapture::InternName(name); \
+    ::Nova::TraceScope NOVA_TRACE_CONCAT(_nova_trace_scope_, __LINE__)(NOVA_TRACE_CONCAT(_nova_trace_id_, __LINE__))
+
+#define NOVA_TRACE_FUNCTION() \
+    NOVA_TRACE_SCOPE(__FUNCTION__)
+
+/**
+ * @brief Record an instant marker
+ */
+#define NOVA_TRACE_INSTANT(name) \
+    do { \
+        static const ::Nova::TraceNameId _nova_trace_instant_id = ::Nova::TraceCapture::InternName(name); \
+        ::Nova::TraceCapture::Instance().RecordInstant(_nova_trace_instant_id); \
+    } while (0)
+
+#else
+
+#define NOVA_TRACE_SCOPE(name) ((void)0)
+#define NOVA_TRACE_FUNCTION() ((void)0)
+#define NOVA_TRACE_INSTANT(name) ((void)0)
+
+#endif // NOVA_PROFILE_ENABLED
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Nova {
+
+namespace detail {
+
+inline size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Fixed-capacity Chase-Lev work-stealing deque
+ *
+ * The owning thread pushes and pops at the bottom (LIFO, cache-warm work);
+ * any other thread may steal from the top (FIFO, oldest work). Push/Pop are
+ * wait-free for the owner, Steal is lock-free. The buffer never grows, so
+ * callers must bound the number of in-flight items (Push returns false when
+ * full).
+ *
+ * Memory orderings follow Le et al., "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (PPoPP 2013).
+ *
+ * @tparam T Trivially copyable element type (typically a pointer)
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque requires trivially copyable elements");
+
+public:
+    explicit WorkStealingDeque(size_t capacity = 4096)
+        : m_capacity(detail::RoundUpToPowerOfTwo(capacity))
+        , m_mask(m_capacity - 1)
+        , m_buffer(std::make_unique<std::atomic<T>[]>(m_capacity)) {}
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Push an item at the bottom (owner thread only)
+     * @return false if the deque is full
+     */
+    bool Push(T item) {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(m_capacity)) {
+            return false;
+        }
+
+        m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Pop the most recently pushed item (owner thread only)
+     * @return false if the deque is empty or the last item was stolen
+     */
+    bool Pop(T& out) {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last item - race against thieves for it
+            const bool won = m_top.compare_exchange_strong(
+                top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Steal the oldest item (any thread)
+     * @return false if the deque is empty or another thief won the race
+     */
+    bool Steal(T& out) {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        out = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Approximate number of queued items
+     */
+    [[nodiscard]] size_t SizeApprox() const {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    [[nodiscard]] size_t GetCapacity() const { return m_capacity; }
+
+private:
+    const size_t m_capacity;
+    const size_t m_mask;
+    std::unique_ptr<std::atomic<T>[]> m_buffer;
+
+    // Thieves hammer m_top, the owner hammers m_bottom - keep them apart
+    alignas(64) std::atomic<int64_t> m_top{0};
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+};
+
+/**
+ * @brief Bounded multi-producer multi-consumer FIFO queue
+ *
+ * Dmitry Vyukov's sequence-numbered ring buffer: each push/pop is a single
+ * CAS on the shared cursor in the uncontended case, with no locks. Used for
+ * submissions from threads that do not own a work-stealing deque.
+ *
+ * @tparam T Trivially copyable element type
+ */
+template<typename T>
+class BoundedMPMCQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "BoundedMPMCQueue requires trivially copyable elements");
+
+public:
+    explicit BoundedMPMCQueue(size_t capacity = 4096)
+        : m_capacity(detail::RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity))
+        , m_mask(m_capacity - 1)
+        , m_cells(std::make_unique<Cell[]>(m_capacity)) {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+    BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+    /**
+     * @brief Enqueue an item
+     * @return false if the queue is full
+     */
+    bool TryPush(T item) {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeue an item
+     * @return false if the queue is empty
+     */
+    bool TryPop(T& out) {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        out = cell->data;
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Approximate number of queued items
+     */
+    [[nodiscard]] size_t SizeApprox() const {
+        const size_t enqueue = m_enqueuePos.load(std::memory_order_relaxed);
+        const size_t dequeue = m_dequeuePos.load(std::memory_order_relaxed);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    [[nodiscard]] size_t GetCapacity() const { return m_capacity; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T data{};
+    };
+
+    const size_t m_capacity;
+    const size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) std::atomic<size_t> m_dequeuePos{0};
+};
+
+/**
+ * @brief Bounded single-producer single-consumer FIFO queue
+ *
+ * Lamport ring with cached cursors: each side re-reads the other side's
+ * cursor only when its cached copy says the ring is full (or empty), so a
+ * push or pop normally touches nothing shared but the slot itself. Exactly
+ * one thread may push and exactly one thread may pop.
+ *
+ * @tparam T Trivially copyable element type (typically a pointer)
+ */
+template<typename T>
+class BoundedSPSCQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "BoundedSPSCQueue requires trivially copyable elements");
+
+public:
+    explicit BoundedSPSCQueue(size_t capacity = 4096)
+        : m_capacity(detail::RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity))
+        , m_mask(m_capacity - 1)
+        , m_slots(std::make_unique<T[]>(m_capacity)) {}
+
+    BoundedSPSCQueue(const BoundedSPSCQueue&) = delete;
+    BoundedSPSCQueue& operator=(const BoundedSPSCQueue&) = delete;
+
+    /**
+     * @brief Enqueue an item (producer thread only)
+     * @return false if the queue is full
+     */
+    bool TryPush(T item) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead >= m_capacity) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead >= m_capacity) {
+                return false;
+            }
+        }
+
+        m_slots[tail & m_mask] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeue an item (consumer thread only)
+     * @return false if the queue is empty
+     */
+    bool TryPop(T& out) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) {
+                return false;
+            }
+        }
+
+        out = m_slots[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Approximate number of queued items
+     */
+    [[nodiscard]] size_t SizeApprox() const {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    [[nodiscard]] size_t GetCapacity() const { return m_capacity; }
+
+private:
+    const size_t m_capacity;
+    const size_t m_mask;
+    std::unique_ptr<T[]> m_slots;
+
+    alignas(64) std::atomic<size_t> m_head{0};     // Written by the consumer
+    size_t m_cachedTail = 0;                        // Consumer's copy of m_tail
+    alignas(64) std::atomic<size_t> m_tail{0};     // Written by the producer
+    size_t m_cachedHead = 0;                        // Producer's copy of m_head
+};
+
+} // namespace Nova
@@ -0,0 +1,175 @@
+#include "Archetype.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace Nova {
+namespace ECS {
+
+namespace {
+
+constexpr size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+std::byte* AllocateChunk(size_t bytes) {
+    return static_cast<std::byte*>(::operator new(bytes, std::align_val_t{kComponentColumnAlignment}));
+}
+
+void FreeChunk(std::byte* data) {
+    ::operator delete(data, std::align_val_t{kComponentColumnAlignment});
+}
+
+} // namespace
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+Archetype::Archetype(const ComponentMask& mask)
+    : m_mask(mask) {
+    m_columnOffsets.fill(kNoColumn);
+
+    for (ComponentTypeId id = 0; id < kMaxComponentTypes; ++id) {
+        if (!mask.test(id)) continue;
+        m_components.push_back(id);
+        const ComponentInfo& info = ComponentRegistry::Get(id);
+        m_componentSizes[id] = static_cast<uint32_t>(info.size);
+        if (info.size > 0) {
+            m_columns.push_back(id);
+        }
+    }
+
+    // Bytes needed for n rows once every column is rounded out to a cache line
+    auto layoutBytes = [this](size_t rows) {
+        size_t bytes = AlignUp(rows * sizeof(EntityHandle), kComponentColumnAlignment);
+        for (ComponentTypeId id : m_columns) {
+            bytes = AlignUp(bytes + rows * m_componentSizes[id], kComponentColumnAlignment);
+        }
+        return bytes;
+    };
+
+    size_t rowBytes = sizeof(EntityHandle);
+    for (ComponentTypeId id : m_columns) {
+        rowBytes += m_componentSizes[id];
+    }
+
+    size_t rows = std::max<size_t>(kChunkBytes / rowBytes, 1);
+    while (rows > 1 && layoutBytes(rows) > kChunkBytes) {
+        --rows;
+    }
+    m_capacity = static_cast<uint32_t>(rows);
+    m_chunkBytes = std::max(layoutBytes(rows), kChunkBytes);
+
+    size_t offset = AlignUp(rows * sizeof(EntityHandle), kComponentColumnAlignment);
+    for (ComponentTypeId id : m_columns) {
+        m_columnOffsets[id] = static_cast<uint32_t>(offset);
+        offset = AlignUp(offset + rows * m_componentSizes[id], kComponentColumnAlignment);
+    }
+}
+
+Archetype::~Archetype() {
+    Clear();
+    if (m_spareChunk) {
+        FreeChunk(m_spareChunk);
+    }
+}
+
+// ============================================================================
+// ROWS
+// ============================================================================
+
+EntityLocation Archetype::Allocate(EntityHandle handle) {
+    if (m_chunks.empty() || m_chunks.back().count == m_capacity) {
+        Chunk chunk;
+        if (m_spareChunk) {
+            chunk.data = m_spareChunk;
+            m_spareChunk = nullptr;
+        } else {
+            chunk.data = AllocateChunk(m_chunkBytes);
+        }
+        m_chunks.push_back(chunk);
+    }
+
+    const uint32_t chunkIndex = static_cast<uint32_t>(m_chunks.size() - 1);
+    Chunk& chunk = m_chunks.back();
+    const uint32_t row = chunk.count++;
+    GetHandles(chunkIndex)[row] = handle;
+    ++m_entityCount;
+    return {chunkIndex, row};
+}
+
+EntityHandle Archetype::Remove(EntityLocation location) {
+    for (ComponentTypeId id : m_columns) {
+        ComponentRegistry::Get(id).destroy(GetComponent(location, id));
+    }
+    return FillGap(location);
+}
+
+EntityHandle Archetype::MoveTo(EntityLocation location, Archetype& destination,
+                               EntityLocation destinationLocation) {
+    assert(&destination != this);
+
+    for (ComponentTypeId id : m_columns) {
+        const ComponentInfo& info = ComponentRegistry::Get(id);
+        if (void* target = destination.GetComponent(destinationLocation, id)) {
+            info.relocate(target, GetComponent(location, id));
+        } else {
+            info.destroy(GetComponent(location, id));
+        }
+    }
+    return FillGap(location);
+}
+
+EntityHandle Archetype::FillGap(EntityLocation location) {
+    // Row storage at location is already dead; pull the archetype's last row into it
+    const uint32_t lastChunk = static_cast<uint32_t>(m_chunks.size() - 1);
+    const uint32_t lastRow = m_chunks[lastChunk].count - 1;
+    const EntityLocation last{lastChunk, lastRow};
+
+    EntityHandle moved = kNullEntity;
+    if (location.chunk != last.chunk || location.row != last.row) {
+        for (ComponentTypeId id : m_columns) {
+            ComponentRegistry::Get(id).relocate(GetComponent(location, id), GetComponent(last, id));
+        }
+        moved = GetHandles(last.chunk)[last.row];
+        GetHandles(location.chunk)[location.row] = moved;
+    }
+
+    --m_chunks[lastChunk].count;
+    --m_entityCount;
+    if (m_chunks[lastChunk].count == 0) {
+        ReleaseLastChunk();
+    }
+    return moved;
+}
+
+void Archetype::ReleaseLastChunk() {
+    std::byte* data = m_chunks.back().data;
+    m_chunks.pop_back();
+    if (m_spareChunk) {
+        FreeChunk(data);
+    } else {
+        m_spareChunk = data;
+    }
+}
+
+void Archetype::Clear() {
+    for (size_t chunk = 0; chunk < m_chunks.size(); ++chunk) {
+        for (ComponentTypeId id : m_columns) {
+            const ComponentInfo& info = ComponentRegistry::Get(id);
+            std::byte* column = static_cast<std::byte*>(GetColumn(chunk, id));
+            for (uint32_t row = 0; row < m_chunks[chunk].count; ++row) {
+                info.destroy(column + static_cast<size_t>(row) * info.size);
+            }
+        }
+    }
+    while (!m_chunks.empty()) {
+        ReleaseLastChunk();
+    }
+    m_entityCount = 0;
+}
+
+} // namespace ECS
+} // namespace Nova
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Component.hpp"
+#include "EntityHandle.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+namespace ECS {
+
+/**
+ * @brief Position of an entity's row inside an archetype
+ */
+struct EntityLocation {
+    uint32_t chunk = 0;
+    uint32_t row = 0;
+};
+
+/**
+ * @brief Storage for every entity that has exactly one component signature
+ *
+ * Entities live in fixed-size chunks. A chunk is one 64-byte aligned block
+ * holding a column of handles followed by one column per non-tag component,
+ * each column starting on its own cache line. Rows are kept dense: removing
+ * an entity moves the archetype's last row into the hole, so every chunk but
+ * the last is full and iteration never has to skip gaps.
+ *
+ * Archetypes are owned by an ECS::World; the row operations below leave the
+ * world's entity table to the caller.
+ */
+class Archetype {
+public:
+    /// Target chunk size; a single oversized component grows its chunks to fit one row
+    static constexpr size_t kChunkBytes = 16 * 1024;
+
+    explicit Archetype(const ComponentMask& mask);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    [[nodiscard]] const ComponentMask& GetMask() const noexcept { return m_mask; }
+    [[nodiscard]] const std::vector<ComponentTypeId>& GetComponents() const noexcept { return m_components; }
+    [[nodiscard]] bool Has(ComponentTypeId id) const { return m_mask.test(id); }
+
+    [[nodiscard]] uint32_t GetChunkCapacity() const noexcept { return m_capacity; }
+    [[nodiscard]] size_t GetChunkCount() const noexcept { return m_chunks.size(); }
+    [[nodiscard]] size_t GetEntityCount() const noexcept { return m_entityCount; }
+    [[nodiscard]] uint32_t GetCount(size_t chunk) const { return m_chunks[chunk].count; }
+
+    [[nodiscard]] EntityHandle* GetHandles(size_t chunk) const {
+        return reinterpret_cast<EntityHandle*>(m_chunks[chunk].data);
+    }
+
+    /**
+     * @brief Start of the column for a component in one chunk
+     * @return nullptr if the archetype lacks the component or it is a tag
+     */
+    [[nodiscard]] void* GetColumn(size_t chunk, ComponentTypeId id) const {
+        const uint32_t offset = m_columnOffsets[id];
+        return offset != kNoColumn ? m_chunks[chunk].data + offset : nullptr;
+    }
+
+    [[nodiscard]] void* GetComponent(EntityLocation location, ComponentTypeId id) const {
+        const uint32_t offset = m_columnOffsets[id];
+        if (offset == kNoColumn) return nullptr;
+        return m_chunks[location.chunk].data + offset +
+               static_cast<size_t>(location.row) * m_componentSizes[id];
+    }
+
+    /**
+     * @brief Append a row for handle; component storage is left unconstructed
+     */
+    EntityLocation Allocate(EntityHandle handle);
+
+    /**
+     * @brief Destroy a row's components and close the gap
+     * @return Handle of the entity moved into the freed row, or kNullEntity
+     */
+    EntityHandle Remove(EntityLocation location);
+
+    /**
+     * @brief Relocate a row into a row already allocated in another archetype
+     *
+     * Components both archetypes share are moved, components the destination
+     * lacks are destroyed, and components only the destination has are left
+     * for the caller to construct. The source gap is then closed.
+     * @return Handle of the entity moved into the freed source row, or kNullEntity
+     */
+    EntityHandle MoveTo(EntityLocation location, Archetype& destination, EntityLocation destinationLocation);
+
+    /**
+     * @brief Destroy every row and release all chunks
+     */
+    void Clear();
+
+    // Cached structural transitions, filled in lazily by the world
+    std::unordered_map<ComponentTypeId, Archetype*> addEdges;
+    std::unordered_map<ComponentTypeId, Archetype*> removeEdges;
+
+private:
+    static constexpr uint32_t kNoColumn = ~uint32_t{0};
+
+    struct Chunk {
+        std::byte* data = nullptr;
+        uint32_t count = 0;
+    };
+
+    EntityHandle FillGap(EntityLocation location);
+    void ReleaseLastChunk();
+
+    ComponentMask m_mask;
+    std::vector<ComponentTypeId> m_components;   ///< All components, ascending id
+    std::vector<ComponentTypeId> m_columns;      ///< Components that own a column
+    std::array<uint32_t, kMaxComponentTypes> m_columnOffsets;
+    std::array<uint32_t, kMaxComponentTypes> m_componentSizes{};
+    uint32_t m_capacity = 0;
+    size_t m_chunkBytes = 0;
+
+    std::vector<Chunk> m_chunks;
+    std::byte* m_spareChunk = nullptr;  ///< Last released chunk, kept so a boundary add/remove doesn't thrash the allocator
+    size_t m_entityCount = 0;
+};
+
+} // namespace ECS
+} // namespace Nova
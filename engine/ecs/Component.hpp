@@ -0,0 +1,102 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nova {
+namespace ECS {
+
+using ComponentTypeId = uint32_t;
+
+/// Upper bound on distinct component types; archetype signatures are bitsets of this width
+inline constexpr size_t kMaxComponentTypes = 128;
+
+/// Alignment of chunk columns; one cache line so columns never share a line
+inline constexpr size_t kComponentColumnAlignment = 64;
+
+using ComponentMask = std::bitset<kMaxComponentTypes>;
+
+/**
+ * @brief Type-erased description of a component type
+ *
+ * Chunks hold raw bytes, so moving a row between chunks or archetypes goes
+ * through these function pointers. Empty types are tags: they take part in
+ * the archetype signature but get no column.
+ */
+struct ComponentInfo {
+    size_t size = 0;        ///< 0 for tag components
+    size_t alignment = 1;
+    void (*relocate)(void* dst, void* src) noexcept = nullptr;  ///< Move-construct dst from src, then destroy src
+    void (*destroy)(void* ptr) noexcept = nullptr;
+};
+
+/**
+ * @brief Process-wide table of component types
+ *
+ * Ids are handed out on first use of ComponentId<T>() and are dense, so they
+ * index straight into ComponentMask and per-archetype column tables.
+ */
+class ComponentRegistry {
+public:
+    static ComponentTypeId Register(const ComponentInfo& info);
+    [[nodiscard]] static const ComponentInfo& Get(ComponentTypeId id);
+    [[nodiscard]] static size_t GetCount();
+};
+
+namespace detail {
+
+template<typename T>
+ComponentInfo MakeComponentInfo() {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "ECS components are relocated between chunks and must be nothrow movable");
+    static_assert(alignof(T) <= kComponentColumnAlignment,
+                  "ECS components cannot be aligned beyond a cache line");
+
+    ComponentInfo info;
+    if constexpr (!std::is_empty_v<T>) {
+        info.size = sizeof(T);
+        info.alignment = alignof(T);
+        info.relocate = [](void* dst, void* src) noexcept {
+            T* from = static_cast<T*>(src);
+            ::new (dst) T(std::move(*from));
+            from->~T();
+        };
+        info.destroy = [](void* ptr) noexcept {
+            static_cast<T*>(ptr)->~T();
+        };
+    }
+    return info;
+}
+
+template<typename T>
+ComponentTypeId ComponentIdOf() {
+    static const ComponentTypeId id = ComponentRegistry::Register(MakeComponentInfo<T>());
+    return id;
+}
+
+} // namespace detail
+
+/**
+ * @brief Stable id of component type T for the lifetime of the process
+ */
+template<typename T>
+[[nodiscard]] ComponentTypeId ComponentId() {
+    return detail::ComponentIdOf<std::remove_cvref_t<T>>();
+}
+
+/**
+ * @brief Signature containing each of Ts
+ */
+template<typename... Ts>
+[[nodiscard]] ComponentMask MakeComponentMask() {
+    ComponentMask mask;
+    (mask.set(ComponentId<Ts>()), ...);
+    return mask;
+}
+
+} // namespace ECS
+} // namespace Nova
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace Nova {
+namespace ECS {
+
+/**
+ * @brief Generational reference to an entity in an ECS::World
+ *
+ * The index names a slot in the world's entity table and the generation is
+ * bumped every time that slot is freed, so a handle to a destroyed entity
+ * never resolves to whatever reuses its slot. Handles stay valid while the
+ * entity's components move between chunks and archetypes.
+ */
+struct EntityHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;  ///< 0 is never issued, so a default handle is null
+
+    [[nodiscard]] constexpr bool IsValid() const noexcept { return generation != 0; }
+
+    [[nodiscard]] constexpr uint64_t ToU64() const noexcept {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+
+    [[nodiscard]] static constexpr EntityHandle FromU64(uint64_t value) noexcept {
+        return {static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)};
+    }
+
+    constexpr bool operator==(const EntityHandle&) const noexcept = default;
+};
+
+inline constexpr EntityHandle kNullEntity{};
+
+} // namespace ECS
+} // namespace Nova
+
+template<>
+struct std::hash<Nova::ECS::EntityHandle> {
+    size_t operator()(const Nova::ECS::EntityHandle& handle) const noexcept {
+        return std::hash<uint64_t>{}(handle.ToU64());
+    }
+};
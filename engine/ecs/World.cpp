@@ -0,0 +1,220 @@
+#include "World.hpp"
+#include "../core/JobSystem.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+namespace Nova {
+namespace ECS {
+
+// ============================================================================
+// COMPONENT REGISTRY
+// ============================================================================
+
+namespace {
+
+struct ComponentTable {
+    std::mutex mutex;
+    std::array<ComponentInfo, kMaxComponentTypes> infos;
+    size_t count = 0;
+};
+
+ComponentTable& GetComponentTable() {
+    static ComponentTable table;
+    return table;
+}
+
+} // namespace
+
+ComponentTypeId ComponentRegistry::Register(const ComponentInfo& info) {
+    ComponentTable& table = GetComponentTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    assert(table.count < kMaxComponentTypes && "Raise ECS::kMaxComponentTypes");
+    table.infos[table.count] = info;
+    return static_cast<ComponentTypeId>(table.count++);
+}
+
+const ComponentInfo& ComponentRegistry::Get(ComponentTypeId id) {
+    // Entries are written once, before their id is published through ComponentId<T>()
+    return GetComponentTable().infos[id];
+}
+
+size_t ComponentRegistry::GetCount() {
+    ComponentTable& table = GetComponentTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.count;
+}
+
+// ============================================================================
+// ENTITIES
+// ============================================================================
+
+World::World() = default;
+
+World::~World() {
+    Clear();
+}
+
+EntityHandle World::AllocateHandle() {
+    if (!m_freeIndices.empty()) {
+        const uint32_t index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+        return {index, m_records[index].generation};
+    }
+    m_records.emplace_back();
+    return {static_cast<uint32_t>(m_records.size() - 1), m_records.back().generation};
+}
+
+void World::Place(EntityHandle handle, Archetype& archetype, EntityLocation location) {
+    EntityRecord& record = m_records[handle.index];
+    record.archetype = &archetype;
+    record.location = location;
+    ++m_entityCount;
+}
+
+bool World::Destroy(EntityHandle handle) {
+    if (!Find(handle)) return false;
+    assert(!IsIterating() && "ECS::World::Destroy during a query");
+
+    EntityRecord& record = m_records[handle.index];
+    const EntityHandle moved = record.archetype->Remove(record.location);
+    if (moved.IsValid()) {
+        m_records[moved.index].location = record.location;
+    }
+
+    record.archetype = nullptr;
+    if (++record.generation == 0) {
+        record.generation = 1;
+    }
+    m_freeIndices.push_back(handle.index);
+    --m_entityCount;
+    return true;
+}
+
+void World::Clear() {
+    assert(!IsIterating() && "ECS::World::Clear during a query");
+
+    for (Archetype* archetype : m_archetypes) {
+        archetype->Clear();
+    }
+
+    m_freeIndices.clear();
+    for (uint32_t index = static_cast<uint32_t>(m_records.size()); index-- > 0;) {
+        EntityRecord& record = m_records[index];
+        if (record.archetype) {
+            record.archetype = nullptr;
+            if (++record.generation == 0) {
+                record.generation = 1;
+            }
+        }
+        m_freeIndices.push_back(index);
+    }
+    m_entityCount = 0;
+}
+
+EntityLocation World::MoveEntity(EntityHandle handle, Archetype& target) {
+    EntityRecord& record = m_records[handle.index];
+    const EntityLocation destination = target.Allocate(handle);
+    const EntityHandle moved = record.archetype->MoveTo(record.location, target, destination);
+    if (moved.IsValid()) {
+        m_records[moved.index].location = record.location;
+    }
+    record.archetype = &target;
+    record.location = destination;
+    return destination;
+}
+
+// ============================================================================
+// ARCHETYPES
+// ============================================================================
+
+Archetype* World::GetOrCreateArchetype(const ComponentMask& mask) {
+    auto it = m_archetypeLookup.find(mask);
+    if (it != m_archetypeLookup.end()) {
+        return it->second.get();
+    }
+
+    auto archetype = std::make_unique<Archetype>(mask);
+    Archetype* result = archetype.get();
+    m_archetypeLookup.emplace(mask, std::move(archetype));
+    m_archetypes.push_back(result);
+    return result;
+}
+
+Archetype* World::GetAddTarget(Archetype& source, ComponentTypeId id) {
+    auto it = source.addEdges.find(id);
+    if (it != source.addEdges.end()) {
+        return it->second;
+    }
+    Archetype* target = GetOrCreateArchetype(ComponentMask(source.GetMask()).set(id));
+    source.addEdges.emplace(id, target);
+    target->removeEdges.emplace(id, &source);
+    return target;
+}
+
+Archetype* World::GetRemoveTarget(Archetype& source, ComponentTypeId id) {
+    auto it = source.removeEdges.find(id);
+    if (it != source.removeEdges.end()) {
+        return it->second;
+    }
+    Archetype* target = GetOrCreateArchetype(ComponentMask(source.GetMask()).reset(id));
+    source.removeEdges.emplace(id, target);
+    target->addEdges.emplace(id, &source);
+    return target;
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+void World::ParallelForEachChunk(const ComponentMask& required, const ChunkCallback& fn, size_t rowsPerJob) {
+    IterationScope scope(*this);
+
+    JobSystem& jobs = JobSystem::Instance();
+    size_t rows = 0;
+    for (const Archetype* archetype : m_archetypes) {
+        if ((archetype->GetMask() & required) == required) {
+            rows += archetype->GetEntityCount();
+        }
+    }
+    if (rowsPerJob == 0) {
+        rowsPerJob = std::max<size_t>(1, rows / (std::max(jobs.GetWorkerCount(), 1u) * 4));
+    }
+
+    if (rows <= rowsPerJob || !jobs.IsInitialized()) {
+        ForEachChunk(required, fn);
+        return;
+    }
+
+    // Ranges never straddle chunks, so each view keeps contiguous columns
+    std::vector<ChunkView> ranges;
+    ranges.reserve(rows / rowsPerJob + m_archetypes.size());
+    for (Archetype* archetype : m_archetypes) {
+        if ((archetype->GetMask() & required) != required) continue;
+        for (size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+            const uint32_t count = archetype->GetCount(chunk);
+            for (uint32_t begin = 0; begin < count; begin += static_cast<uint32_t>(rowsPerJob)) {
+                const uint32_t end = static_cast<uint32_t>(std::min<size_t>(begin + rowsPerJob, count));
+                ranges.emplace_back(*archetype, chunk, begin, end);
+            }
+        }
+    }
+
+    jobs.ParallelFor(0, ranges.size(), 1, [&](size_t i) {
+        fn(ranges[i]);
+    });
+}
+
+size_t World::Count(const ComponentMask& required) const {
+    size_t count = 0;
+    for (const Archetype* archetype : m_archetypes) {
+        if ((archetype->GetMask() & required) == required) {
+            count += archetype->GetEntityCount();
+        }
+    }
+    return count;
+}
+
+} // namespace ECS
+} // namespace Nova
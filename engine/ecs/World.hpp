@@ -0,0 +1,345 @@
+#pragma once
+
+#include "Archetype.hpp"
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Nova {
+namespace ECS {
+
+/**
+ * @brief One chunk of a query result: a run of entities with contiguous columns
+ *
+ * Parallel queries may hand out a range of a chunk's rows rather than all of it.
+ */
+class ChunkView {
+public:
+    ChunkView(const Archetype& archetype, size_t chunk)
+        : m_archetype(&archetype), m_chunk(chunk), m_begin(0), m_end(archetype.GetCount(chunk)) {}
+
+    ChunkView(const Archetype& archetype, size_t chunk, uint32_t begin, uint32_t end)
+        : m_archetype(&archetype), m_chunk(chunk), m_begin(begin), m_end(end) {}
+
+    [[nodiscard]] uint32_t Count() const { return m_end - m_begin; }
+    [[nodiscard]] const EntityHandle* Handles() const { return m_archetype->GetHandles(m_chunk) + m_begin; }
+
+    /**
+     * @brief Column of component T, Count() entries long
+     * @return nullptr if the chunk's archetype lacks T
+     */
+    template<typename T>
+    [[nodiscard]] T* Get() const {
+        static_assert(!std::is_empty_v<T>, "Tag components have no column");
+        T* column = static_cast<T*>(m_archetype->GetColumn(m_chunk, ComponentId<T>()));
+        return column ? column + m_begin : nullptr;
+    }
+
+    template<typename T>
+    [[nodiscard]] bool Has() const { return m_archetype->Has(ComponentId<T>()); }
+
+    [[nodiscard]] const Archetype& GetArchetype() const { return *m_archetype; }
+
+private:
+    const Archetype* m_archetype;
+    size_t m_chunk;
+    uint32_t m_begin;
+    uint32_t m_end;
+};
+
+/**
+ * @brief Archetype-based entity/component store
+ *
+ * Entities are grouped by their exact component signature; each group is an
+ * Archetype of dense, cache-line aligned chunks, so a query walks contiguous
+ * columns instead of chasing one heap object per entity. Entities are named
+ * by generational EntityHandles that survive the moves caused by adding or
+ * removing components and by other entities being destroyed.
+ *
+ * Structural changes (Create, Destroy, Add of a new component, Remove) move
+ * rows and are not allowed while a query is running; collect them and apply
+ * them afterwards. Get and assigning through Add on an existing component are
+ * fine during iteration.
+ *
+ * Example usage:
+ * @code
+ * ECS::World world;
+ * auto e = world.Create(Position{}, Velocity{{1, 0, 0}});
+ * world.ForEach<Position, const Velocity>([dt](Position& p, const Velocity& v) {
+ *     p.value += v.value * dt;
+ * });
+ * @endcode
+ */
+class World {
+public:
+    using ChunkCallback = std::function<void(const ChunkView&)>;
+
+    World();
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+    World(World&&) noexcept = default;
+    World& operator=(World&&) noexcept = default;
+
+    // =========================================================================
+    // Entities
+    // =========================================================================
+
+    /**
+     * @brief Create an entity with the given components
+     */
+    template<typename... Ts>
+    EntityHandle Create(Ts&&... components);
+
+    /**
+     * @brief Destroy an entity and its components
+     * @return false if the handle is stale
+     */
+    bool Destroy(EntityHandle handle);
+
+    [[nodiscard]] bool IsAlive(EntityHandle handle) const { return Find(handle) != nullptr; }
+
+    /**
+     * @brief Destroy every entity; outstanding handles all become stale
+     */
+    void Clear();
+
+    [[nodiscard]] size_t GetEntityCount() const noexcept { return m_entityCount; }
+    [[nodiscard]] size_t GetArchetypeCount() const noexcept { return m_archetypes.size(); }
+    [[nodiscard]] const std::vector<Archetype*>& GetArchetypes() const noexcept { return m_archetypes; }
+
+    // =========================================================================
+    // Components
+    // =========================================================================
+
+    /**
+     * @brief Get a component of an entity
+     * @return nullptr if the handle is stale or the entity lacks T
+     */
+    template<typename T>
+    [[nodiscard]] T* Get(EntityHandle handle) const;
+
+    template<typename T>
+    [[nodiscard]] bool Has(EntityHandle handle) const;
+
+    /**
+     * @brief Add component T, or overwrite it if the entity already has one
+     * @return false if the handle is stale
+     */
+    template<typename T>
+    bool Add(EntityHandle handle, T component = T{});
+
+    /**
+     * @brief Remove component T
+     * @return false if the handle is stale or the entity lacks T
+     */
+    template<typename T>
+    bool Remove(EntityHandle handle);
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    /**
+     * @brief Visit every chunk whose archetype contains all of required
+     */
+    template<typename F>
+    void ForEachChunk(const ComponentMask& required, F&& fn) const;
+
+    /**
+     * @brief Visit matching chunks on the JobSystem, split into row ranges
+     *
+     * Chunks are cut into ranges of rowsPerJob rows (0 picks about four ranges
+     * per worker, as JobSystem::ParallelFor does), so a few full chunks still
+     * spread over every worker. Runs serially when the JobSystem is not
+     * initialized or everything fits in one range. fn is called concurrently
+     * and must only touch the rows of the view it is given.
+     */
+    void ParallelForEachChunk(const ComponentMask& required, const ChunkCallback& fn, size_t rowsPerJob = 0);
+
+    /**
+     * @brief Call fn(Ts&...) for every entity that has all of Ts and all of filter
+     *
+     * fn may also take the entity's handle as its first parameter. Tag
+     * components have no storage to pass, so put them in filter.
+     */
+    template<typename... Ts, typename F>
+    void ForEach(const ComponentMask& filter, F&& fn);
+
+    template<typename... Ts, typename F>
+    void ForEach(F&& fn) { ForEach<Ts...>(ComponentMask{}, std::forward<F>(fn)); }
+
+    /**
+     * @brief ForEach spread over row ranges on the JobSystem
+     */
+    template<typename... Ts, typename F>
+    void ParallelForEach(const ComponentMask& filter, F&& fn);
+
+    template<typename... Ts, typename F>
+    void ParallelForEach(F&& fn) { ParallelForEach<Ts...>(ComponentMask{}, std::forward<F>(fn)); }
+
+    /**
+     * @brief Number of entities whose archetype contains all of required
+     */
+    [[nodiscard]] size_t Count(const ComponentMask& required) const;
+
+    /** @brief Check whether a query is running; structural changes must wait */
+    [[nodiscard]] bool IsIterating() const noexcept { return m_iterationDepth > 0; }
+
+private:
+    struct EntityRecord {
+        Archetype* archetype = nullptr;
+        EntityLocation location;
+        uint32_t generation = 1;
+    };
+
+    class IterationScope {
+    public:
+        explicit IterationScope(const World& world) : m_world(world) { ++m_world.m_iterationDepth; }
+        ~IterationScope() { --m_world.m_iterationDepth; }
+    private:
+        const World& m_world;
+    };
+
+    [[nodiscard]] const EntityRecord* Find(EntityHandle handle) const {
+        if (handle.index >= m_records.size()) return nullptr;
+        const EntityRecord& record = m_records[handle.index];
+        return record.generation == handle.generation && record.archetype ? &record : nullptr;
+    }
+
+    EntityHandle AllocateHandle();
+    Archetype* GetOrCreateArchetype(const ComponentMask& mask);
+    Archetype* GetAddTarget(Archetype& source, ComponentTypeId id);
+    Archetype* GetRemoveTarget(Archetype& source, ComponentTypeId id);
+    void Place(EntityHandle handle, Archetype& archetype, EntityLocation location);
+    EntityLocation MoveEntity(EntityHandle handle, Archetype& target);
+
+    template<typename T, typename Arg>
+    static void Construct(Archetype& archetype, EntityLocation location, Arg&& value) {
+        if constexpr (!std::is_empty_v<T>) {
+            ::new (archetype.GetComponent(location, ComponentId<T>())) T(std::forward<Arg>(value));
+        }
+    }
+
+    template<typename... Ts, typename F>
+    static void RunChunk(const ChunkView& view, F& fn) {
+        const uint32_t count = view.Count();
+        const EntityHandle* handles = view.Handles();
+        auto columns = std::make_tuple(view.Get<std::remove_cvref_t<Ts>>()...);
+        std::apply([&](auto*... column) {
+            for (uint32_t i = 0; i < count; ++i) {
+                if constexpr (std::is_invocable_v<F&, EntityHandle, Ts&...>) {
+                    fn(handles[i], column[i]...);
+                } else {
+                    fn(column[i]...);
+                }
+            }
+        }, columns);
+    }
+
+    std::vector<EntityRecord> m_records;
+    std::vector<uint32_t> m_freeIndices;
+    std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_archetypeLookup;
+    std::vector<Archetype*> m_archetypes;
+    size_t m_entityCount = 0;
+    mutable int m_iterationDepth = 0;
+};
+
+// ============================================================================
+// Template Implementations
+// ============================================================================
+
+template<typename... Ts>
+EntityHandle World::Create(Ts&&... components) {
+    assert(!IsIterating() && "ECS::World::Create during a query");
+
+    const ComponentMask mask = MakeComponentMask<Ts...>();
+    assert(mask.count() == sizeof...(Ts) && "ECS::World::Create given the same component twice");
+
+    Archetype* archetype = GetOrCreateArchetype(mask);
+    const EntityHandle handle = AllocateHandle();
+    const EntityLocation location = archetype->Allocate(handle);
+    (Construct<std::remove_cvref_t<Ts>>(*archetype, location, std::forward<Ts>(components)), ...);
+    Place(handle, *archetype, location);
+    return handle;
+}
+
+template<typename T>
+T* World::Get(EntityHandle handle) const {
+    static_assert(!std::is_empty_v<T>, "Tag components have no storage; use Has");
+    const EntityRecord* record = Find(handle);
+    if (!record) return nullptr;
+    return static_cast<T*>(record->archetype->GetComponent(record->location, ComponentId<T>()));
+}
+
+template<typename T>
+bool World::Has(EntityHandle handle) const {
+    const EntityRecord* record = Find(handle);
+    return record && record->archetype->Has(ComponentId<T>());
+}
+
+template<typename T>
+bool World::Add(EntityHandle handle, T component) {
+    const EntityRecord* record = Find(handle);
+    if (!record) return false;
+
+    const ComponentTypeId id = ComponentId<T>();
+    if (record->archetype->Has(id)) {
+        if constexpr (!std::is_empty_v<T>) {
+            *static_cast<T*>(record->archetype->GetComponent(record->location, id)) = std::move(component);
+        }
+        return true;
+    }
+
+    assert(!IsIterating() && "ECS::World::Add of a new component during a query");
+    Archetype* target = GetAddTarget(*record->archetype, id);
+    const EntityLocation location = MoveEntity(handle, *target);
+    Construct<T>(*target, location, std::move(component));
+    return true;
+}
+
+template<typename T>
+bool World::Remove(EntityHandle handle) {
+    const EntityRecord* record = Find(handle);
+    const ComponentTypeId id = ComponentId<T>();
+    if (!record || !record->archetype->Has(id)) return false;
+
+    assert(!IsIterating() && "ECS::World::Remove during a query");
+    MoveEntity(handle, *GetRemoveTarget(*record->archetype, id));
+    return true;
+}
+
+template<typename F>
+void World::ForEachChunk(const ComponentMask& required, F&& fn) const {
+    IterationScope scope(*this);
+    for (Archetype* archetype : m_archetypes) {
+        if ((archetype->GetMask() & required) != required) continue;
+        for (size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+            fn(ChunkView(*archetype, chunk));
+        }
+    }
+}
+
+template<typename... Ts, typename F>
+void World::ForEach(const ComponentMask& filter, F&& fn) {
+    ForEachChunk(filter | MakeComponentMask<Ts...>(), [&fn](const ChunkView& view) {
+        RunChunk<Ts...>(view, fn);
+    });
+}
+
+template<typename... Ts, typename F>
+void World::ParallelForEach(const ComponentMask& filter, F&& fn) {
+    ParallelForEachChunk(filter | MakeComponentMask<Ts...>(), [&fn](const ChunkView& view) {
+        RunChunk<Ts...>(view, fn);
+    });
+}
+
+} // namespace ECS
+} // namespace Nova
@@ -1,5 +1,6 @@
 #include "graphics/Culler.hpp"
 #include "graphics/Mesh.hpp"
+#include "graphics/SoftwareOcclusion.hpp"
 #include "scene/Camera.hpp"
 
 #include <glad/gl.h>
@@ -204,12 +205,9 @@ bool Culler::Initialize(const CullingConfig& config) {
 
     m_config = config;
 
-    // Initialize Hi-Z buffer for occlusion culling
+    // Initialize Hi-Z or software buffer for occlusion culling
     if (m_config.occlusionCullingEnabled) {
-        m_hiZBuffer = std::make_unique<HiZBuffer>();
-        m_hiZBuffer->Initialize(m_config.occlusionResolution,
-                                 m_config.occlusionResolution,
-                                 m_config.occlusionHierarchyDepth);
+        CreateOcclusionBuffer();
     }
 
     m_initialized = true;
@@ -227,6 +225,8 @@ void Culler::Shutdown() {
     m_freeIndices.clear();
     m_occlusionQueries.clear();
     m_hiZBuffer.reset();
+    m_occluders.clear();
+    m_softwareOcclusion.reset();
 
     m_initialized = false;
 }
@@ -245,6 +245,15 @@ void Culler::BeginFrame(const Camera& camera) {
     // Extract frustum planes
     m_frustum.ExtractFromMatrix(m_viewProjection);
 
+    // Rasterise occluders for this view
+    if (m_softwareOcclusion) {
+        m_softwareOcclusion->BeginFrame(m_viewProjection);
+        for (const auto& occluder : m_occluders) {
+            m_softwareOcclusion->AddOccluder(occluder.vertices, occluder.indices, occluder.transform);
+        }
+        m_softwareOcclusion->Rasterize();
+    }
+
     // Reset visibility flags
     for (auto& obj : m_objects) {
         obj.visible = true;
@@ -398,14 +407,36 @@ float Culler::CalculateScreenSize(float worldSize, float distance) const {
 void Culler::SetConfig(const CullingConfig& config) {
     m_config = config;
 
-    // Reinitialize Hi-Z buffer if occlusion culling settings changed
-    if (m_config.occlusionCullingEnabled && !m_hiZBuffer) {
+    // Reinitialize occlusion buffers if occlusion culling settings changed
+    if (m_config.occlusionCullingEnabled) {
+        CreateOcclusionBuffer();
+    } else {
+        m_hiZBuffer.reset();
+        m_softwareOcclusion.reset();
+    }
+}
+
+void Culler::CreateOcclusionBuffer() {
+    if (m_config.useSoftwareOcclusion) {
+        m_hiZBuffer.reset();
+
+        SoftwareOcclusionSettings settings;
+        settings.width = m_config.softwareOcclusionWidth;
+        settings.height = m_config.softwareOcclusionHeight;
+        if (m_softwareOcclusion) {
+            m_softwareOcclusion->SetSettings(settings);
+        } else {
+            m_softwareOcclusion = std::make_unique<SoftwareOcclusionBuffer>(settings);
+        }
+        return;
+    }
+
+    m_softwareOcclusion.reset();
+    if (!m_hiZBuffer) {
         m_hiZBuffer = std::make_unique<HiZBuffer>();
         m_hiZBuffer->Initialize(m_config.occlusionResolution,
                                  m_config.occlusionResolution,
                                  m_config.occlusionHierarchyDepth);
-    } else if (!m_config.occlusionCullingEnabled && m_hiZBuffer) {
-        m_hiZBuffer.reset();
     }
 }
 
@@ -415,6 +446,34 @@ void Culler::UpdateOcclusionBuffer(uint32_t depthTexture) {
     }
 }
 
+uint32_t Culler::RegisterOccluder(std::span<const glm::vec3> vertices, std::span<const uint32_t> indices,
+                                  const glm::mat4& transform) {
+    Occluder occluder;
+    occluder.id = m_nextOccluderID++;
+    occluder.vertices.assign(vertices.begin(), vertices.end());
+    occluder.indices.assign(indices.begin(), indices.end());
+    occluder.transform = transform;
+    m_occluders.push_back(std::move(occluder));
+    return m_occluders.back().id;
+}
+
+void Culler::UpdateOccluderTransform(uint32_t occluderID, const glm::mat4& transform) {
+    for (auto& occluder : m_occluders) {
+        if (occluder.id == occluderID) {
+            occluder.transform = transform;
+            return;
+        }
+    }
+}
+
+void Culler::RemoveOccluder(uint32_t occluderID) {
+    auto it = std::find_if(m_occluders.begin(), m_occluders.end(),
+        [occluderID](const Occluder& occluder) { return occluder.id == occluderID; });
+    if (it != m_occluders.end()) {
+        m_occluders.erase(it);
+    }
+}
+
 bool Culler::FrustumCull(const CullableObject& object) const {
     // First test bounding sphere (cheaper)
     if (!m_frustum.ContainsSphere(object.boundingSphere.center,
@@ -427,6 +486,10 @@ bool Culler::FrustumCull(const CullableObject& object) const {
 }
 
 bool Culler::OcclusionCull(const CullableObject& object) const {
+    if (m_softwareOcclusion) {
+        return !m_softwareOcclusion->TestAABB(object.worldBounds);
+    }
+
     if (!m_hiZBuffer) {
         return false;
     }
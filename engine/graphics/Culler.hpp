@@ -5,6 +5,7 @@
 #include <memory>
 #include <functional>
 #include <cstdint>
+#include <span>
 #include <limits>
 #include <glm/glm.hpp>
 
@@ -14,6 +15,7 @@ namespace Nova {
 class Camera;
 class Mesh;
 class SceneNode;
+class SoftwareOcclusionBuffer;
 
 /**
  * @brief Axis-Aligned Bounding Box for culling
@@ -294,6 +296,11 @@ struct CullingConfig {
     int occlusionHierarchyDepth = 4;
     int occlusionResolution = 256;       // Hi-Z buffer resolution
 
+    // Rasterise registered occluders on the CPU instead of reading back the Hi-Z buffer
+    bool useSoftwareOcclusion = false;
+    int softwareOcclusionWidth = 256;
+    int softwareOcclusionHeight = 128;
+
     // Multi-threaded culling
     bool useMultiThreading = false;
     int numCullingThreads = 4;
@@ -473,6 +480,30 @@ public:
      */
     const HiZBuffer* GetHiZBuffer() const { return m_hiZBuffer.get(); }
 
+    /**
+     * @brief Register a mesh that hides what is behind it (software occlusion only)
+     * @param vertices Object-space positions of a closed, low-polygon proxy
+     * @param indices Three per triangle
+     * @return Occluder ID for future reference
+     */
+    uint32_t RegisterOccluder(std::span<const glm::vec3> vertices, std::span<const uint32_t> indices,
+                              const glm::mat4& transform = glm::mat4(1.0f));
+
+    /**
+     * @brief Move an occluder
+     */
+    void UpdateOccluderTransform(uint32_t occluderID, const glm::mat4& transform);
+
+    /**
+     * @brief Remove an occluder
+     */
+    void RemoveOccluder(uint32_t occluderID);
+
+    /**
+     * @brief Get the software depth buffer rasterised in BeginFrame()
+     */
+    const SoftwareOcclusionBuffer* GetSoftwareOcclusion() const { return m_softwareOcclusion.get(); }
+
 private:
     // Frustum culling
     bool FrustumCull(const CullableObject& object) const;
@@ -497,6 +528,18 @@ private:
     std::vector<OcclusionQuery> m_occlusionQueries;
     std::unique_ptr<HiZBuffer> m_hiZBuffer;
 
+    // Software occlusion
+    struct Occluder {
+        uint32_t id = 0;
+        std::vector<glm::vec3> vertices;
+        std::vector<uint32_t> indices;
+        glm::mat4 transform{1.0f};
+    };
+    void CreateOcclusionBuffer();
+    std::vector<Occluder> m_occluders;
+    uint32_t m_nextOccluderID = 1;
+    std::unique_ptr<SoftwareOcclusionBuffer> m_softwareOcclusion;
+
     // Camera data
     Frustum m_frustum;
     glm::vec3 m_cameraPosition{0.0f};
@@ -1,5 +1,8 @@
 #include "ParallelCullingSystem.hpp"
+#include "../core/JobSystem.hpp"
+#include "../core/SIMD.hpp"
 #include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cmath>
 
@@ -14,50 +17,50 @@ Frustum::Frustum(const Matrix4& viewProj) {
     // Extract frustum planes from view-projection matrix
     // Left plane
     planes[0] = Vector4(
-        viewProj.m[3] + viewProj.m[0],
-        viewProj.m[7] + viewProj.m[4],
-        viewProj.m[11] + viewProj.m[8],
-        viewProj.m[15] + viewProj.m[12]
+        viewProj[0][3] + viewProj[0][0],
+        viewProj[1][3] + viewProj[1][0],
+        viewProj[2][3] + viewProj[2][0],
+        viewProj[3][3] + viewProj[3][0]
     );
 
     // Right plane
     planes[1] = Vector4(
-        viewProj.m[3] - viewProj.m[0],
-        viewProj.m[7] - viewProj.m[4],
-        viewProj.m[11] - viewProj.m[8],
-        viewProj.m[15] - viewProj.m[12]
+        viewProj[0][3] - viewProj[0][0],
+        viewProj[1][3] - viewProj[1][0],
+        viewProj[2][3] - viewProj[2][0],
+        viewProj[3][3] - viewProj[3][0]
     );
 
     // Bottom plane
     planes[2] = Vector4(
-        viewProj.m[3] + viewProj.m[1],
-        viewProj.m[7] + viewProj.m[5],
-        viewProj.m[11] + viewProj.m[9],
-        viewProj.m[15] + viewProj.m[13]
+        viewProj[0][3] + viewProj[0][1],
+        viewProj[1][3] + viewProj[1][1],
+        viewProj[2][3] + viewProj[2][1],
+        viewProj[3][3] + viewProj[3][1]
     );
 
     // Top plane
     planes[3] = Vector4(
-        viewProj.m[3] - viewProj.m[1],
-        viewProj.m[7] - viewProj.m[5],
-        viewProj.m[11] - viewProj.m[9],
-        viewProj.m[15] - viewProj.m[13]
+        viewProj[0][3] - viewProj[0][1],
+        viewProj[1][3] - viewProj[1][1],
+        viewProj[2][3] - viewProj[2][1],
+        viewProj[3][3] - viewProj[3][1]
     );
 
     // Near plane
     planes[4] = Vector4(
-        viewProj.m[3] + viewProj.m[2],
-        viewProj.m[7] + viewProj.m[6],
-        viewProj.m[11] + viewProj.m[10],
-        viewProj.m[15] + viewProj.m[14]
+        viewProj[0][3] + viewProj[0][2],
+        viewProj[1][3] + viewProj[1][2],
+        viewProj[2][3] + viewProj[2][2],
+        viewProj[3][3] + viewProj[3][2]
     );
 
     // Far plane
     planes[5] = Vector4(
-        viewProj.m[3] - viewProj.m[2],
-        viewProj.m[7] - viewProj.m[6],
-        viewProj.m[11] - viewProj.m[10],
-        viewProj.m[15] - viewProj.m[14]
+        viewProj[0][3] - viewProj[0][2],
+        viewProj[1][3] - viewProj[1][2],
+        viewProj[2][3] - viewProj[2][2],
+        viewProj[3][3] - viewProj[3][2]
     );
 
     // Normalize planes
@@ -109,107 +112,96 @@ bool Frustum::TestAABB(const Vector3& min, const Vector3& max) const {
 }
 
 // ============================================================================
-// JobQueue Implementation
+// CullingBounds Implementation
 // ============================================================================
 
-void JobQueue::Push(std::function<void()> job) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_jobs.push(std::move(job));
-}
+void CullingBounds::Resize(size_t count, bool withAABBs) {
+    // Whole batches for the widest SIMD path, so kernels can load past the last object
+    const size_t padded = (count + kBatchPadding - 1) / kBatchPadding * kBatchPadding;
 
-bool JobQueue::TryPop(std::function<void()>& job) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_jobs.empty()) {
-        return false;
+    for (Array<float>* array : {&centerX, &centerY, &centerZ, &radius}) {
+        array->resize(padded, 0.0f);
+    }
+    for (Array<float>* array : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ}) {
+        if (withAABBs) {
+            array->resize(padded, 0.0f);
+        } else {
+            array->clear();
+        }
     }
-    job = std::move(m_jobs.front());
-    m_jobs.pop();
-    return true;
+    ids.resize(count);
 }
 
-bool JobQueue::Empty() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_jobs.empty();
-}
+namespace {
 
-size_t JobQueue::Size() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    return m_jobs.size();
+Vector3 TransformPoint(const Matrix4& transform, const Vector3& point) {
+    return Vector3(transform * Vector4(point, 1.0f));
 }
 
-// ============================================================================
-// ThreadPool Implementation
-// ============================================================================
-
-ThreadPool::ThreadPool(size_t numThreads)
-    : m_stop(false)
-    , m_activeTasks(0) {
-
-    if (numThreads == 0) {
-        numThreads = std::thread::hardware_concurrency();
-        if (numThreads == 0) numThreads = 8; // Fallback
-    }
-
-    // Clamp to reasonable range
-    numThreads = std::max<size_t>(1, std::min<size_t>(32, numThreads));
-
-    m_workers.reserve(numThreads);
-    for (size_t i = 0; i < numThreads; i++) {
-        m_workers.emplace_back(&ThreadPool::WorkerThread, this);
+// World-space box around a transformed local box: the centre moves with the
+// transform, the half extents go through the absolute rotation/scale part
+void TransformAABB(const Matrix4& transform, const Vector3& localMin, const Vector3& localMax,
+                   Vector3& outMin, Vector3& outMax) {
+    const Vector3 center = TransformPoint(transform, (localMin + localMax) * 0.5f);
+    const float half[3] = {(localMax.x - localMin.x) * 0.5f, (localMax.y - localMin.y) * 0.5f,
+                           (localMax.z - localMin.z) * 0.5f};
+
+    float extent[3];
+    for (int row = 0; row < 3; row++) {
+        extent[row] = std::abs(transform[0][row]) * half[0] +
+                      std::abs(transform[1][row]) * half[1] +
+                      std::abs(transform[2][row]) * half[2];
     }
+    outMin = Vector3(center.x - extent[0], center.y - extent[1], center.z - extent[2]);
+    outMax = Vector3(center.x + extent[0], center.y + extent[1], center.z + extent[2]);
 }
 
-ThreadPool::~ThreadPool() {
-    m_stop = true;
-    m_condition.notify_all();
-
-    for (auto& worker : m_workers) {
-        if (worker.joinable()) {
-            worker.join();
+} // anonymous namespace
+
+void CullingBounds::Assign(const std::vector<SDFInstance>& instances, bool withAABBs) {
+    Resize(instances.size(), withAABBs);
+    for (size_t i = 0; i < instances.size(); i++) {
+        const SDFInstance& instance = instances[i];
+        SetSphere(i, TransformPoint(instance.transform, instance.boundingSphereCenter), instance.boundingSphereRadius);
+        if (withAABBs) {
+            Vector3 worldMin;
+            Vector3 worldMax;
+            TransformAABB(instance.transform, instance.aabbMin, instance.aabbMax, worldMin, worldMax);
+            SetAABB(i, worldMin, worldMax);
         }
+        ids[i] = instance.instanceID;
     }
 }
 
-void ThreadPool::WorkerThread() {
-    while (true) {
-        std::function<void()> job;
+// ============================================================================
+// ParallelCullingSystem Implementation
+// ============================================================================
 
-        {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            m_condition.wait(lock, [this] {
-                return m_stop || !m_jobQueue.Empty();
-            });
+namespace {
 
-            if (m_stop && m_jobQueue.Empty()) {
-                break;
-            }
+// Projected-size thresholds (fraction of screen height) for LOD 1..4
+constexpr float kLODThresholds[4] = {0.3f, 0.15f, 0.075f, 0.0375f};
 
-            if (!m_jobQueue.TryPop(job)) {
-                continue;
-            }
-        }
+// Survivors of the job running on this thread, before they are appended to the result
+struct CullScratch {
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> lods;
+};
 
-        if (job) {
-            job();
-            m_activeTasks--;
-        }
-    }
+CullScratch& GetCullScratch() {
+    thread_local CullScratch scratch;
+    return scratch;
 }
 
-void ThreadPool::WaitAll() {
-    while (m_activeTasks > 0 || !m_jobQueue.Empty()) {
-        std::this_thread::yield();
-    }
+float TanHalfFov(const CullingCamera& camera) {
+    return std::tan(camera.fov * 3.14159265f / 180.0f * 0.5f);
 }
 
-// ============================================================================
-// ParallelCullingSystem Implementation
-// ============================================================================
+} // anonymous namespace
 
 ParallelCullingSystem::ParallelCullingSystem(const Config& config)
     : m_config(config) {
 
-    m_threadPool = std::make_unique<ThreadPool>(config.numThreads);
     m_cullingTimeSamples.reserve(MAX_TIME_SAMPLES);
 }
 
@@ -219,79 +211,30 @@ CullingResult ParallelCullingSystem::CullObjects(
     const std::vector<SDFInstance>& instances,
     const CullingCamera& camera) {
 
-    auto startTime = std::chrono::high_resolution_clock::now();
-
     CullingResult result;
 
     if (instances.empty()) {
         return result;
     }
 
-    // Calculate number of jobs
-    const int jobCount = (static_cast<int>(instances.size()) + m_config.jobGranularity - 1) / m_config.jobGranularity;
-
-    // Create culling jobs
-    std::vector<CullingJob> jobs(jobCount);
-    std::vector<std::future<void>> futures;
-    futures.reserve(jobCount);
-
-    for (int i = 0; i < jobCount; i++) {
-        jobs[i].startIndex = i * m_config.jobGranularity;
-        jobs[i].count = std::min(m_config.jobGranularity,
-                                static_cast<int>(instances.size()) - jobs[i].startIndex);
-        jobs[i].frustum = &camera.frustum;
-        jobs[i].camera = &camera;
-        jobs[i].instances = &instances;
-
-        // Reserve approximate capacity
-        jobs[i].visibleIndices.reserve(jobs[i].count / 2);
-        if (m_config.enableLOD) {
-            jobs[i].lodLevels.reserve(jobs[i].count / 2);
-        }
-    }
+    m_instanceBounds.Assign(instances, m_config.testAABB);
+    CullBounds(m_instanceBounds, camera, result);
+    return result;
+}
 
-    // Submit jobs to thread pool
-    for (int i = 0; i < jobCount; i++) {
-        futures.push_back(m_threadPool->Submit([this, &jobs, i]() {
-            ProcessCullingJob(jobs[i]);
-        }));
-    }
+void ParallelCullingSystem::CullBounds(
+    const CullingBounds& bounds,
+    const CullingCamera& camera,
+    CullingResult& outResult) {
 
-    // Wait for all jobs to complete
-    for (auto& future : futures) {
-        future.get();
-    }
+    auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Merge results
-    MergeResults(jobs, result);
+    const uint32_t totalVisible = Cull(bounds, camera, m_config.enableLOD, outResult);
 
     auto endTime = std::chrono::high_resolution_clock::now();
-    result.cullingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
-
-    // Update statistics
-    m_cullingTimeSamples.push_back(result.cullingTimeMs);
-    if (m_cullingTimeSamples.size() > MAX_TIME_SAMPLES) {
-        m_cullingTimeSamples.erase(m_cullingTimeSamples.begin());
-    }
-
-    m_stats.totalObjectsTested += static_cast<uint32_t>(instances.size());
-    m_stats.totalObjectsVisible += result.totalVisible;
-    m_stats.maxCullingTimeMs = std::max(m_stats.maxCullingTimeMs, result.cullingTimeMs);
-    m_stats.minCullingTimeMs = std::min(m_stats.minCullingTimeMs, result.cullingTimeMs);
-
-    // Calculate average
-    float sum = 0.0f;
-    for (float time : m_cullingTimeSamples) {
-        sum += time;
-    }
-    m_stats.avgCullingTimeMs = sum / m_cullingTimeSamples.size();
+    outResult.cullingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
 
-    if (m_stats.totalObjectsTested > 0) {
-        m_stats.visibilityRatio = static_cast<float>(m_stats.totalObjectsVisible) /
-                                  static_cast<float>(m_stats.totalObjectsTested);
-    }
-
-    return result;
+    RecordTiming(outResult.cullingTimeMs, bounds.Size(), totalVisible);
 }
 
 CullingResult ParallelCullingSystem::CullObjectsFast(
@@ -306,79 +249,171 @@ CullingResult ParallelCullingSystem::CullObjectsFast(
         return result;
     }
 
-    // Calculate number of jobs
-    const int jobCount = (static_cast<int>(instances.size()) + m_config.jobGranularity - 1) / m_config.jobGranularity;
-
-    // Create culling jobs (no LOD)
-    std::vector<CullingJob> jobs(jobCount);
-    std::vector<std::future<void>> futures;
-    futures.reserve(jobCount);
+    // Spheres only, no LOD
+    m_instanceBounds.Assign(instances, false);
 
     CullingCamera dummyCamera;
     dummyCamera.frustum = frustum;
+    Cull(m_instanceBounds, dummyCamera, false, result);
 
-    for (int i = 0; i < jobCount; i++) {
-        jobs[i].startIndex = i * m_config.jobGranularity;
-        jobs[i].count = std::min(m_config.jobGranularity,
-                                static_cast<int>(instances.size()) - jobs[i].startIndex);
-        jobs[i].frustum = &frustum;
-        jobs[i].camera = &dummyCamera;
-        jobs[i].instances = &instances;
-        jobs[i].visibleIndices.reserve(jobs[i].count / 2);
-    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.cullingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
 
-    // Submit jobs
-    for (int i = 0; i < jobCount; i++) {
-        futures.push_back(m_threadPool->Submit([&jobs, i]() {
-            CullingJob& job = jobs[i];
-            for (int j = 0; j < job.count; j++) {
-                int index = job.startIndex + j;
-                const SDFInstance& instance = (*job.instances)[index];
+    return result;
+}
 
-                // Transform bounding sphere center
-                Vector3 worldCenter = instance.transform.TransformPoint(instance.boundingSphereCenter);
+uint32_t ParallelCullingSystem::Cull(
+    const CullingBounds& bounds,
+    const CullingCamera& camera,
+    bool withLOD,
+    CullingResult& outResult) {
 
-                // Frustum test
-                if (job.frustum->TestSphere(worldCenter, instance.boundingSphereRadius)) {
-                    job.visibleIndices.push_back(instance.instanceID);
-                }
-            }
-        }));
-    }
+    const size_t count = bounds.Size();
 
-    // Wait for completion
-    for (auto& future : futures) {
-        future.get();
+    // Sized for the worst case; jobs reserve their slice with one atomic add each
+    outResult.visibleIndices.resize(count);
+    if (withLOD) {
+        outResult.lodLevels.resize(count);
+    } else {
+        outResult.lodLevels.clear();
     }
+    m_visibleCursor.store(0, std::memory_order_relaxed);
+
+    // Jobs start on a batch boundary
+    constexpr size_t kPadding = CullingBounds::kBatchPadding;
+    const size_t requested = static_cast<size_t>(std::max(m_config.jobGranularity, 1));
+    const size_t granularity = (requested + kPadding - 1) / kPadding * kPadding;
+    const size_t jobCount = (count + granularity - 1) / granularity;
+
+    RunJobs(jobCount, [&](size_t job) {
+        const size_t begin = job * granularity;
+        CullRange(bounds, camera, withLOD, begin, std::min(begin + granularity, count), outResult);
+    });
+
+    const uint32_t totalVisible = m_visibleCursor.load(std::memory_order_acquire);
+    outResult.visibleIndices.resize(totalVisible);
+    if (withLOD) {
+        outResult.lodLevels.resize(totalVisible);
+    }
+    outResult.totalVisible = totalVisible;
+    return totalVisible;
+}
 
-    // Merge results
-    MergeResults(jobs, result);
+void ParallelCullingSystem::CullRange(
+    const CullingBounds& bounds,
+    const CullingCamera& camera,
+    bool withLOD,
+    size_t begin,
+    size_t end,
+    CullingResult& outResult) {
 
-    auto endTime = std::chrono::high_resolution_clock::now();
-    result.cullingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    using Nova::SIMD::FloatBatch;
+    constexpr size_t Width = FloatBatch::Width;
+    static_assert(CullingBounds::kBatchPadding % Width == 0, "Bounds padding must cover whole batches");
 
-    return result;
-}
+    const Frustum& frustum = camera.frustum;
+    const bool withAABB = m_config.testAABB && bounds.HasAABBs();
+
+    FloatBatch planeX[6], planeY[6], planeZ[6], planeW[6];
+    for (int p = 0; p < 6; p++) {
+        planeX[p] = FloatBatch::Broadcast(frustum.planes[p].x);
+        planeY[p] = FloatBatch::Broadcast(frustum.planes[p].y);
+        planeZ[p] = FloatBatch::Broadcast(frustum.planes[p].z);
+        planeW[p] = FloatBatch::Broadcast(frustum.planes[p].w);
+    }
+
+    // LOD k+1 starts where radius * bias <= threshold[k] * tan(fov / 2) * distance
+    const float tanHalfFov = TanHalfFov(camera);
+    const FloatBatch cameraX = FloatBatch::Broadcast(camera.position.x);
+    const FloatBatch cameraY = FloatBatch::Broadcast(camera.position.y);
+    const FloatBatch cameraZ = FloatBatch::Broadcast(camera.position.z);
+    const FloatBatch lodBias = FloatBatch::Broadcast(m_config.lodBias);
+    FloatBatch lodScale[4];
+    for (int k = 0; k < 4; k++) {
+        lodScale[k] = FloatBatch::Broadcast(kLODThresholds[k] * tanHalfFov);
+    }
+    const uint32_t maxLOD = static_cast<uint32_t>(std::max(m_config.maxLODLevel, 0));
+
+    CullScratch& scratch = GetCullScratch();
+    scratch.ids.resize(end - begin);
+    scratch.lods.resize(withLOD ? end - begin : 0);
+    size_t visibleCount = 0;
+
+    const FloatBatch zero = FloatBatch::Broadcast(0.0f);
+    for (size_t i = begin; i < end; i += Width) {
+        const FloatBatch cx = FloatBatch::Load(bounds.centerX.data() + i);
+        const FloatBatch cy = FloatBatch::Load(bounds.centerY.data() + i);
+        const FloatBatch cz = FloatBatch::Load(bounds.centerZ.data() + i);
+        const FloatBatch r = FloatBatch::Load(bounds.radius.data() + i);
+        const FloatBatch negativeRadius = zero - r;
+
+        // Outside if any plane has the sphere entirely behind it
+        FloatBatch outside = zero;
+        for (int p = 0; p < 6; p++) {
+            const FloatBatch distance = Nova::SIMD::MulAdd(planeX[p], cx,
+                Nova::SIMD::MulAdd(planeY[p], cy, Nova::SIMD::MulAdd(planeZ[p], cz, planeW[p])));
+            outside = Nova::SIMD::Or(outside, Nova::SIMD::CmpLt(distance, negativeRadius));
+        }
+
+        // AABB: test the corner furthest along each plane normal (chosen per plane, not per lane)
+        if (withAABB) {
+            for (int p = 0; p < 6; p++) {
+                const Vector4& plane = frustum.planes[p];
+                const FloatBatch px = FloatBatch::Load((plane.x >= 0.0f ? bounds.maxX : bounds.minX).data() + i);
+                const FloatBatch py = FloatBatch::Load((plane.y >= 0.0f ? bounds.maxY : bounds.minY).data() + i);
+                const FloatBatch pz = FloatBatch::Load((plane.z >= 0.0f ? bounds.maxZ : bounds.minZ).data() + i);
+                const FloatBatch distance = Nova::SIMD::MulAdd(planeX[p], px,
+                    Nova::SIMD::MulAdd(planeY[p], py, Nova::SIMD::MulAdd(planeZ[p], pz, planeW[p])));
+                outside = Nova::SIMD::Or(outside, Nova::SIMD::CmpLt(distance, zero));
+            }
+        }
 
-void ParallelCullingSystem::ProcessCullingJob(CullingJob& job) {
-    for (int i = 0; i < job.count; i++) {
-        int index = job.startIndex + i;
-        const SDFInstance& instance = (*job.instances)[index];
+        const size_t lanes = std::min(Width, end - i);
+        const uint32_t laneMask = (1u << lanes) - 1u;
+        uint32_t visible = ~Nova::SIMD::MoveMask(outside) & laneMask;
+        if (visible == 0) {
+            continue;
+        }
 
-        // Transform bounding sphere center
-        Vector3 worldCenter = instance.transform.TransformPoint(instance.boundingSphereCenter);
+        // Bit k of detailMask[k] set: still finer than LOD k + 1
+        uint32_t detailMask[4] = {laneMask, laneMask, laneMask, laneMask};
+        if (withLOD) {
+            const FloatBatch dx = cx - cameraX;
+            const FloatBatch dy = cy - cameraY;
+            const FloatBatch dz = cz - cameraZ;
+            const FloatBatch distance = Nova::SIMD::Sqrt(Nova::SIMD::MulAdd(dx, dx, Nova::SIMD::MulAdd(dy, dy, dz * dz)));
+            const FloatBatch size = r * lodBias;
+            for (int k = 0; k < 4; k++) {
+                detailMask[k] = Nova::SIMD::MoveMask(Nova::SIMD::CmpGt(size, lodScale[k] * distance));
+            }
+        }
 
-        // Frustum culling
-        if (job.frustum->TestSphere(worldCenter, instance.boundingSphereRadius)) {
-            job.visibleIndices.push_back(instance.instanceID);
+        while (visible != 0) {
+            const uint32_t lane = static_cast<uint32_t>(std::countr_zero(visible));
+            visible &= visible - 1;
 
-            // Calculate LOD if enabled
-            if (m_config.enableLOD && job.camera) {
-                uint32_t lod = CalculateLODLevel(instance, *job.camera);
-                job.lodLevels.push_back(lod);
+            scratch.ids[visibleCount] = bounds.ids[i + lane];
+            if (withLOD) {
+                uint32_t lod = 4;
+                for (int k = 0; k < 4; k++) {
+                    lod -= (detailMask[k] >> lane) & 1u;
+                }
+                scratch.lods[visibleCount] = std::min(lod, maxLOD);
             }
+            visibleCount++;
         }
     }
+
+    if (visibleCount == 0) {
+        return;
+    }
+
+    // Compact straight into the shared result
+    const uint32_t base = m_visibleCursor.fetch_add(static_cast<uint32_t>(visibleCount), std::memory_order_relaxed);
+    std::copy_n(scratch.ids.begin(), visibleCount, outResult.visibleIndices.begin() + base);
+    if (withLOD) {
+        std::copy_n(scratch.lods.begin(), visibleCount, outResult.lodLevels.begin() + base);
+    }
 }
 
 uint32_t ParallelCullingSystem::CalculateLODLevel(
@@ -386,75 +421,30 @@ uint32_t ParallelCullingSystem::CalculateLODLevel(
     const CullingCamera& camera) const {
 
     // Calculate distance from camera to instance
-    Vector3 worldCenter = instance.transform.TransformPoint(instance.boundingSphereCenter);
-    Vector3 toInstance = worldCenter - camera.position;
-    float distance = toInstance.Length();
+    Vector3 worldCenter = TransformPoint(instance.transform, instance.boundingSphereCenter);
+    float distance = glm::length(worldCenter - camera.position);
 
     // Calculate screen-space size (projected radius)
-    float fovRadians = camera.fov * 3.14159265f / 180.0f;
-    float screenHeight = 2.0f * std::tan(fovRadians * 0.5f) * distance;
+    float screenHeight = 2.0f * TanHalfFov(camera) * distance;
     float projectedSize = (instance.boundingSphereRadius * 2.0f) / screenHeight;
 
     // Apply LOD bias
     projectedSize *= m_config.lodBias;
 
-    // Determine LOD level based on screen-space size
+    // Determine LOD level based on screen-space size: one level per threshold it falls under
     uint32_t lodLevel = 0;
-
-    if (projectedSize > 0.3f) {
-        lodLevel = 0; // Highest detail
-    } else if (projectedSize > 0.15f) {
-        lodLevel = 1;
-    } else if (projectedSize > 0.075f) {
-        lodLevel = 2;
-    } else if (projectedSize > 0.0375f) {
-        lodLevel = 3;
-    } else {
-        lodLevel = 4; // Lowest detail
+    for (float threshold : kLODThresholds) {
+        if (!(projectedSize > threshold)) {
+            lodLevel++;
+        }
     }
 
     // Clamp to max LOD level
-    lodLevel = std::min(lodLevel, static_cast<uint32_t>(m_config.maxLODLevel));
+    lodLevel = std::min(lodLevel, static_cast<uint32_t>(std::max(m_config.maxLODLevel, 0)));
 
     return lodLevel;
 }
 
-void ParallelCullingSystem::MergeResults(
-    const std::vector<CullingJob>& jobs,
-    CullingResult& outResult) {
-
-    // Calculate total visible count
-    size_t totalVisible = 0;
-    for (const auto& job : jobs) {
-        totalVisible += job.visibleIndices.size();
-    }
-
-    // Reserve space
-    outResult.visibleIndices.reserve(totalVisible);
-    if (m_config.enableLOD) {
-        outResult.lodLevels.reserve(totalVisible);
-    }
-
-    // Merge results from all jobs
-    for (const auto& job : jobs) {
-        outResult.visibleIndices.insert(
-            outResult.visibleIndices.end(),
-            job.visibleIndices.begin(),
-            job.visibleIndices.end()
-        );
-
-        if (m_config.enableLOD) {
-            outResult.lodLevels.insert(
-                outResult.lodLevels.end(),
-                job.lodLevels.begin(),
-                job.lodLevels.end()
-            );
-        }
-    }
-
-    outResult.totalVisible = static_cast<uint32_t>(totalVisible);
-}
-
 void ParallelCullingSystem::CalculateLOD(
     const std::vector<SDFInstance>& instances,
     const std::vector<uint32_t>& visibleIndices,
@@ -467,25 +457,51 @@ void ParallelCullingSystem::CalculateLOD(
     const size_t batchSize = 256;
     const size_t numBatches = (visibleIndices.size() + batchSize - 1) / batchSize;
 
-    std::vector<std::future<void>> futures;
-    futures.reserve(numBatches);
+    RunJobs(numBatches, [&](size_t i) {
+        size_t start = i * batchSize;
+        size_t end = std::min(start + batchSize, visibleIndices.size());
 
-    for (size_t i = 0; i < numBatches; i++) {
-        futures.push_back(m_threadPool->Submit([this, &instances, &visibleIndices, &camera, &outLODLevels, i, batchSize]() {
-            size_t start = i * batchSize;
-            size_t end = std::min(start + batchSize, visibleIndices.size());
-
-            for (size_t j = start; j < end; j++) {
-                uint32_t instanceIndex = visibleIndices[j];
-                if (instanceIndex < instances.size()) {
-                    outLODLevels[j] = CalculateLODLevel(instances[instanceIndex], camera);
-                }
+        for (size_t j = start; j < end; j++) {
+            uint32_t instanceIndex = visibleIndices[j];
+            if (instanceIndex < instances.size()) {
+                outLODLevels[j] = CalculateLODLevel(instances[instanceIndex], camera);
             }
-        }));
+        }
+    });
+}
+
+void ParallelCullingSystem::RunJobs(size_t count, const std::function<void(size_t)>& job) const {
+    Nova::JobSystem& jobSystem = Nova::JobSystem::Instance();
+    if (m_config.useJobSystem && count > 1 && jobSystem.IsInitialized()) {
+        jobSystem.ParallelFor(0, count, 1, job);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        job(i);
+    }
+}
+
+void ParallelCullingSystem::RecordTiming(float cullingTimeMs, size_t tested, size_t visible) {
+    m_cullingTimeSamples.push_back(cullingTimeMs);
+    if (m_cullingTimeSamples.size() > MAX_TIME_SAMPLES) {
+        m_cullingTimeSamples.erase(m_cullingTimeSamples.begin());
+    }
+
+    m_stats.totalObjectsTested += static_cast<uint32_t>(tested);
+    m_stats.totalObjectsVisible += static_cast<uint32_t>(visible);
+    m_stats.maxCullingTimeMs = std::max(m_stats.maxCullingTimeMs, cullingTimeMs);
+    m_stats.minCullingTimeMs = std::min(m_stats.minCullingTimeMs, cullingTimeMs);
+
+    // Calculate average
+    float sum = 0.0f;
+    for (float time : m_cullingTimeSamples) {
+        sum += time;
     }
+    m_stats.avgCullingTimeMs = sum / m_cullingTimeSamples.size();
 
-    for (auto& future : futures) {
-        future.get();
+    if (m_stats.totalObjectsTested > 0) {
+        m_stats.visibilityRatio = static_cast<float>(m_stats.totalObjectsVisible) /
+                                  static_cast<float>(m_stats.totalObjectsTested);
     }
 }
 
@@ -496,11 +512,6 @@ void ParallelCullingSystem::ResetStats() {
 
 void ParallelCullingSystem::SetConfig(const Config& config) {
     m_config = config;
-
-    // Recreate thread pool if thread count changed
-    if (m_threadPool->GetThreadCount() != config.numThreads && config.numThreads > 0) {
-        m_threadPool = std::make_unique<ThreadPool>(config.numThreads);
-    }
 }
 
 } // namespace Graphics
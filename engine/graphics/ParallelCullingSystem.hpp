@@ -1,20 +1,18 @@
 #pragma once
 
 #include <vector>
-#include <future>
 #include <atomic>
-#include <memory>
 #include <functional>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
-#include <thread>
-#include "../math/Vector3.hpp"
-#include "../math/Matrix4.hpp"
+#include <glm/glm.hpp>
+#include "../core/SoA.hpp"
 
 namespace Engine {
 namespace Graphics {
 
+using Vector3 = glm::vec3;
+using Vector4 = glm::vec4;
+using Matrix4 = glm::mat4;  // Column-major: transform[3] is the translation
+
 /**
  * @brief Frustum representation for culling
  */
@@ -39,7 +37,8 @@ struct CullingCamera {
     float farPlane;
     float fov;
 
-    CullingCamera() : nearPlane(0.1f), farPlane(1000.0f), fov(60.0f) {}
+    CullingCamera()
+        : position(0.0f), viewProjection(1.0f), nearPlane(0.1f), farPlane(1000.0f), fov(60.0f) {}
 };
 
 /**
@@ -49,13 +48,15 @@ struct SDFInstance {
     Matrix4 transform;
     Vector3 boundingSphereCenter;
     float boundingSphereRadius;
-    Vector3 aabbMin;
+    Vector3 aabbMin;          // Local space, like the sphere centre
     Vector3 aabbMax;
     uint32_t materialID;
     uint32_t lodLevel;
     uint32_t instanceID;
 
-    SDFInstance() : boundingSphereRadius(1.0f), materialID(0), lodLevel(0), instanceID(0) {}
+    SDFInstance()
+        : transform(1.0f), boundingSphereCenter(0.0f), boundingSphereRadius(1.0f),
+          aabbMin(0.0f), aabbMax(0.0f), materialID(0), lodLevel(0), instanceID(0) {}
 };
 
 /**
@@ -78,67 +79,62 @@ struct CullingResult {
 };
 
 /**
- * @brief Culling job for parallel processing
+ * @brief Structure-of-arrays bounds for SIMD culling
+ *
+ * One entry per object: world-space bounding sphere, optional world-space
+ * AABB and the id reported when the object is visible. Arrays are padded to
+ * a whole number of SIMD batches so kernels never read past the end.
  */
-struct CullingJob {
-    int startIndex;
-    int count;
-    const Frustum* frustum;
-    const CullingCamera* camera;
-    const std::vector<SDFInstance>* instances;
-    std::vector<uint32_t> visibleIndices;
-    std::vector<uint32_t> lodLevels;
+struct CullingBounds {
+    template<typename T>
+    using Array = std::vector<T, Nova::AlignedAllocator<T, 32>>;
 
-    CullingJob() : startIndex(0), count(0), frustum(nullptr), camera(nullptr), instances(nullptr) {}
-};
+    static constexpr size_t kBatchPadding = 8;  // Widest SIMD batch (AVX)
 
-/**
- * @brief Lock-free job queue for worker threads
- */
-class JobQueue {
-public:
-    JobQueue() = default;
-    ~JobQueue() = default;
+    Array<float> centerX, centerY, centerZ, radius;
+    Array<float> minX, minY, minZ, maxX, maxY, maxZ;  // Empty unless AABBs are used
+    std::vector<uint32_t> ids;
 
-    void Push(std::function<void()> job);
-    bool TryPop(std::function<void()>& job);
-    bool Empty() const;
-    size_t Size() const;
-
-private:
-    std::queue<std::function<void()>> m_jobs;
-    mutable std::mutex m_mutex;
-};
+    size_t Size() const { return ids.size(); }
+    bool HasAABBs() const { return !minX.empty(); }
 
-/**
- * @brief Thread pool for parallel task execution
- */
-class ThreadPool {
-public:
-    explicit ThreadPool(size_t numThreads = 0);
-    ~ThreadPool();
+    /**
+     * @brief Resize all arrays (padding included); AABB arrays only if requested
+     */
+    void Resize(size_t count, bool withAABBs);
 
-    template<typename F, typename... Args>
-    auto Submit(F&& f, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type>;
+    void SetSphere(size_t index, const Vector3& center, float sphereRadius) {
+        centerX[index] = center.x;
+        centerY[index] = center.y;
+        centerZ[index] = center.z;
+        radius[index] = sphereRadius;
+    }
 
-    void WaitAll();
-    size_t GetThreadCount() const { return m_workers.size(); }
+    void SetAABB(size_t index, const Vector3& aabbMin, const Vector3& aabbMax) {
+        minX[index] = aabbMin.x;
+        minY[index] = aabbMin.y;
+        minZ[index] = aabbMin.z;
+        maxX[index] = aabbMax.x;
+        maxY[index] = aabbMax.y;
+        maxZ[index] = aabbMax.z;
+    }
 
-private:
-    void WorkerThread();
-
-    std::vector<std::thread> m_workers;
-    JobQueue m_jobQueue;
-    std::condition_variable m_condition;
-    std::mutex m_queueMutex;
-    std::atomic<bool> m_stop;
-    std::atomic<int> m_activeTasks;
+    /**
+     * @brief Fill from instances: sphere centres and AABBs moved to world space
+     */
+    void Assign(const std::vector<SDFInstance>& instances, bool withAABBs);
 };
 
 /**
  * @brief Multi-threaded parallel culling system
- * Performs frustum culling and LOD calculation for 10,000+ objects
- * Target: <1ms for 10K objects with 8-16 threads
+ *
+ * Culls SoA bounds on the engine JobSystem. Each job tests a range of
+ * objects a SIMD batch at a time (8 per instruction with AVX) against the
+ * six frustum planes, optionally the AABBs too, picks the LOD of the
+ * survivors in the same pass and appends them to the shared result through
+ * one atomic reservation per job, so there is no merge step. Visible order
+ * is ascending within a job; jobs may land in any order when run in
+ * parallel.
  */
 class ParallelCullingSystem {
 public:
@@ -146,16 +142,18 @@ public:
      * @brief Configuration for culling system
      */
     struct Config {
-        size_t numThreads;           // 0 = auto-detect
-        int jobGranularity;          // Objects per job (default: 256)
+        int jobGranularity;          // Objects per job (default: 4096)
         bool enableLOD;              // Enable LOD calculation
+        bool testAABB;               // Also test AABBs when the bounds have them
+        bool useJobSystem;           // Spread jobs over Nova::JobSystem when initialized
         float lodBias;               // LOD bias factor
         int maxLODLevel;             // Maximum LOD level
 
         Config()
-            : numThreads(0)
-            , jobGranularity(256)
+            : jobGranularity(4096)
             , enableLOD(true)
+            , testAABB(true)
+            , useJobSystem(true)
             , lodBias(1.0f)
             , maxLODLevel(4) {}
     };
@@ -171,6 +169,14 @@ public:
      */
     CullingResult CullObjects(const std::vector<SDFInstance>& instances, const CullingCamera& camera);
 
+    /**
+     * @brief Cull SoA bounds into a reused result
+     *
+     * Visible ids go to outResult.visibleIndices and, with LOD enabled,
+     * their levels to the matching outResult.lodLevels entries.
+     */
+    void CullBounds(const CullingBounds& bounds, const CullingCamera& camera, CullingResult& outResult);
+
     /**
      * @brief Perform frustum culling only (no LOD)
      */
@@ -210,9 +216,16 @@ public:
 
 private:
     /**
-     * @brief Process a single culling job
+     * @brief Split the bounds into jobs and cull them into outResult
+     * @return Visible count
      */
-    void ProcessCullingJob(CullingJob& job);
+    uint32_t Cull(const CullingBounds& bounds, const CullingCamera& camera, bool withLOD, CullingResult& outResult);
+
+    /**
+     * @brief Cull [begin, end) of the bounds, appending survivors to the result
+     */
+    void CullRange(const CullingBounds& bounds, const CullingCamera& camera, bool withLOD,
+                   size_t begin, size_t end, CullingResult& outResult);
 
     /**
      * @brief Calculate LOD level for an instance
@@ -220,43 +233,25 @@ private:
     uint32_t CalculateLODLevel(const SDFInstance& instance, const CullingCamera& camera) const;
 
     /**
-     * @brief Merge job results into final output
+     * @brief Run count jobs on the JobSystem, or inline without one
      */
-    void MergeResults(const std::vector<CullingJob>& jobs, CullingResult& outResult);
+    void RunJobs(size_t count, const std::function<void(size_t)>& job) const;
+
+    void RecordTiming(float cullingTimeMs, size_t tested, size_t visible);
 
     Config m_config;
-    std::unique_ptr<ThreadPool> m_threadPool;
     Stats m_stats;
 
+    // Bounds built by the SDFInstance overloads
+    CullingBounds m_instanceBounds;
+
+    // Next free slot in the result being written
+    std::atomic<uint32_t> m_visibleCursor{0};
+
     // Performance tracking
     std::vector<float> m_cullingTimeSamples;
     static constexpr size_t MAX_TIME_SAMPLES = 60;
 };
 
-// Template implementation for ThreadPool::Submit
-template<typename F, typename... Args>
-auto ThreadPool::Submit(F&& f, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type> {
-    using ReturnType = typename std::result_of<F(Args...)>::type;
-
-    auto task = std::make_shared<std::packaged_task<ReturnType()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-    );
-
-    std::future<ReturnType> result = task->get_future();
-
-    {
-        std::unique_lock<std::mutex> lock(m_queueMutex);
-        if (m_stop) {
-            throw std::runtime_error("Cannot submit to stopped ThreadPool");
-        }
-
-        m_activeTasks++;
-        m_jobQueue.Push([task]() { (*task)(); });
-    }
-
-    m_condition.notify_one();
-    return result;
-}
-
 } // namespace Graphics
 } // namespace Engine
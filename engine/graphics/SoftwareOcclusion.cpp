@@ -0,0 +1,442 @@
+#include "graphics/SoftwareOcclusion.hpp"
+#include "core/JobSystem.hpp"
+#include "core/SIMD.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Nova {
+
+namespace {
+
+using SIMD::FloatBatch;
+
+constexpr int kLanes = static_cast<int>(FloatBatch::Width);
+constexpr uint32_t kAllLanes = (1u << kLanes) - 1u;
+
+static_assert(SoftwareOcclusionBuffer::kBlockSize % kLanes == 0, "Blocks must hold whole batches");
+static_assert(SoftwareOcclusionBuffer::kTileSize % SoftwareOcclusionBuffer::kBlockSize == 0,
+              "Tiles must hold whole blocks");
+
+constexpr float kFarDepth = std::numeric_limits<float>::max();
+
+// Clip-space w below this is treated as at or behind the eye
+constexpr float kMinClipW = 1.0e-3f;
+
+// Triangles covering less than this many square pixels are dropped
+constexpr float kMinArea = 1.0e-6f;
+
+alignas(32) constexpr float kLaneOffsets[8] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+
+int RoundUpToTile(int size) {
+    const int tile = SoftwareOcclusionBuffer::kTileSize;
+    return std::max(tile, (size + tile - 1) / tile * tile);
+}
+
+/**
+ * @brief Pixel index from a screen coordinate, clamped before the conversion
+ */
+int ClampToPixel(float coordinate, int size) {
+    return static_cast<int>(std::clamp(coordinate, -1.0f, static_cast<float>(size)));
+}
+
+float LaneMax(FloatBatch batch) {
+    alignas(32) float lanes[kLanes];
+    batch.Store(lanes);
+    return *std::max_element(lanes, lanes + kLanes);
+}
+
+/**
+ * @brief Bits of the lanes of a batch at x that fall inside [minX, maxX]
+ */
+uint32_t LanesInRange(int x, int minX, int maxX) {
+    uint32_t lanes = kAllLanes;
+    if (x < minX) {
+        lanes &= kAllLanes << (minX - x);
+    }
+    if (x + kLanes - 1 > maxX) {
+        lanes &= kAllLanes >> (x + kLanes - 1 - maxX);
+    }
+    return lanes & kAllLanes;
+}
+
+} // namespace
+
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer()
+    : SoftwareOcclusionBuffer(SoftwareOcclusionSettings{})
+{}
+
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer(const SoftwareOcclusionSettings& settings)
+    : m_settings(settings)
+{
+    BeginFrame(glm::mat4(1.0f));
+}
+
+void SoftwareOcclusionBuffer::SetSettings(const SoftwareOcclusionSettings& settings) {
+    m_settings = settings;
+}
+
+void SoftwareOcclusionBuffer::BeginFrame(const glm::mat4& viewProjection) {
+    const int width = RoundUpToTile(m_settings.width);
+    const int height = RoundUpToTile(m_settings.height);
+    if (width != m_width || height != m_height) {
+        m_width = width;
+        m_height = height;
+        m_tilesX = width / kTileSize;
+        m_tilesY = height / kTileSize;
+        m_blocksX = width / kBlockSize;
+        m_depth.assign(static_cast<size_t>(width) * height, kFarDepth);
+        m_blockDepth.assign(static_cast<size_t>(m_blocksX) * (height / kBlockSize), kFarDepth);
+        m_bins.resize(static_cast<size_t>(m_tilesX) * m_tilesY);
+    }
+
+    m_viewProjection = viewProjection;
+    m_triangles.clear();
+    for (auto& bin : m_bins) {
+        bin.clear();
+    }
+    m_stats = SoftwareOcclusionStats{};
+    m_rasterized = false;
+}
+
+// ============================================================================
+// Triangle setup and binning
+// ============================================================================
+
+void SoftwareOcclusionBuffer::AddOccluder(std::span<const glm::vec3> vertices,
+                                          std::span<const uint32_t> indices,
+                                          const glm::mat4& transform) {
+    ++m_stats.occluders;
+
+    const glm::mat4 toClip = m_viewProjection * transform;
+    m_clipVertices.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        m_clipVertices[i] = toClip * glm::vec4(vertices[i], 1.0f);
+    }
+
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        assert(indices[i] < vertices.size() && indices[i + 1] < vertices.size() &&
+               indices[i + 2] < vertices.size() && "Occluder index out of range");
+        ++m_stats.triangles;
+
+        const glm::vec4 corners[3] = {
+            m_clipVertices[indices[i]], m_clipVertices[indices[i + 1]], m_clipVertices[indices[i + 2]]
+        };
+        const int inFront = (corners[0].w >= kMinClipW) + (corners[1].w >= kMinClipW) +
+                            (corners[2].w >= kMinClipW);
+        if (inFront == 3) {
+            AddScreenTriangle(corners[0], corners[1], corners[2]);
+            continue;
+        }
+        if (inFront == 0) {
+            continue;
+        }
+
+        // Clip against w = kMinClipW: one corner in front leaves a triangle, two leave a quad
+        glm::vec4 polygon[4];
+        int count = 0;
+        for (int c = 0; c < 3; ++c) {
+            const glm::vec4& current = corners[c];
+            const glm::vec4& next = corners[(c + 1) % 3];
+            const bool currentIn = current.w >= kMinClipW;
+            if (currentIn) {
+                polygon[count++] = current;
+            }
+            if (currentIn != (next.w >= kMinClipW)) {
+                const float t = (kMinClipW - current.w) / (next.w - current.w);
+                polygon[count++] = current + (next - current) * t;
+            }
+        }
+        for (int c = 1; c + 1 < count; ++c) {
+            AddScreenTriangle(polygon[0], polygon[c], polygon[c + 1]);
+        }
+    }
+}
+
+void SoftwareOcclusionBuffer::AddScreenTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c) {
+    const float halfWidth = 0.5f * static_cast<float>(m_width);
+    const float halfHeight = 0.5f * static_cast<float>(m_height);
+    auto toScreen = [&](const glm::vec4& v) {
+        const float invW = 1.0f / v.w;
+        return glm::vec3((v.x * invW + 1.0f) * halfWidth, (v.y * invW + 1.0f) * halfHeight, v.z * invW);
+    };
+
+    glm::vec3 p[3] = {toScreen(a), toScreen(b), toScreen(c)};
+    float area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[2].x - p[0].x) * (p[1].y - p[0].y);
+    if (area < 0.0f) {
+        if (m_settings.cullBackFaces) {
+            return;
+        }
+        std::swap(p[1], p[2]);
+        area = -area;
+    }
+    if (!(area > kMinArea)) {
+        return;  // Degenerate, or NaN from a vertex at infinity
+    }
+
+    // Pixels whose centre can be inside the triangle
+    Triangle triangle;
+    triangle.minX = std::max(0, ClampToPixel(std::ceil(std::min({p[0].x, p[1].x, p[2].x}) - 0.5f), m_width));
+    triangle.maxX = std::min(m_width - 1, ClampToPixel(std::floor(std::max({p[0].x, p[1].x, p[2].x}) - 0.5f), m_width));
+    triangle.minY = std::max(0, ClampToPixel(std::ceil(std::min({p[0].y, p[1].y, p[2].y}) - 0.5f), m_height));
+    triangle.maxY = std::min(m_height - 1, ClampToPixel(std::floor(std::max({p[0].y, p[1].y, p[2].y}) - 0.5f), m_height));
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY) {
+        return;
+    }
+
+    // Counter-clockwise: the inside is to the left of each edge
+    for (int i = 0; i < 3; ++i) {
+        const glm::vec3& from = p[i];
+        const glm::vec3& to = p[(i + 1) % 3];
+        triangle.edgeA[i] = from.y - to.y;
+        triangle.edgeB[i] = to.x - from.x;
+        triangle.originX[i] = from.x;
+        triangle.originY[i] = from.y;
+    }
+
+    const glm::vec3 d1 = p[1] - p[0];
+    const glm::vec3 d2 = p[2] - p[0];
+    triangle.x0 = p[0].x;
+    triangle.y0 = p[0].y;
+    triangle.z0 = p[0].z;
+    triangle.depthDx = (d1.z * d2.y - d2.z * d1.y) / area;
+    triangle.depthDy = (d1.x * d2.z - d2.x * d1.z) / area;
+
+    const auto index = static_cast<uint32_t>(m_triangles.size());
+    m_triangles.push_back(triangle);
+    ++m_stats.rasterized;
+
+    for (int ty = triangle.minY / kTileSize; ty <= triangle.maxY / kTileSize; ++ty) {
+        for (int tx = triangle.minX / kTileSize; tx <= triangle.maxX / kTileSize; ++tx) {
+            m_bins[static_cast<size_t>(ty) * m_tilesX + tx].push_back(index);
+            ++m_stats.binned;
+        }
+    }
+}
+
+// ============================================================================
+// Rasterisation
+// ============================================================================
+
+void SoftwareOcclusionBuffer::Rasterize() {
+    auto work = [this](size_t tile) { RasterizeTile(tile); };
+
+    JobSystem& jobs = JobSystem::Instance();
+    if (m_settings.useJobSystem && jobs.IsInitialized()) {
+        jobs.ParallelFor(0, m_bins.size(), 1, work);
+    } else {
+        for (size_t tile = 0; tile < m_bins.size(); ++tile) {
+            work(tile);
+        }
+    }
+    m_rasterized = true;
+}
+
+void SoftwareOcclusionBuffer::RasterizeTile(size_t tile) {
+    const int tileX = static_cast<int>(tile % m_tilesX);
+    const int tileY = static_cast<int>(tile / m_tilesX);
+
+    for (int y = tileY * kTileSize; y < (tileY + 1) * kTileSize; ++y) {
+        float* row = m_depth.data() + static_cast<size_t>(y) * m_width + tileX * kTileSize;
+        std::fill(row, row + kTileSize, kFarDepth);
+    }
+
+    for (uint32_t index : m_bins[tile]) {
+        RasterizeTriangle(m_triangles[index], tileX, tileY);
+    }
+
+    BuildTileBlocks(tileX, tileY);
+}
+
+void SoftwareOcclusionBuffer::RasterizeTriangle(const Triangle& triangle, int tileX, int tileY) {
+    // Tiles start on a batch boundary, so aligning down stays inside the tile
+    const int startX = std::max(triangle.minX, tileX * kTileSize) & ~(kLanes - 1);
+    const int endX = std::min(triangle.maxX, (tileX + 1) * kTileSize - 1);
+    const int startY = std::max(triangle.minY, tileY * kTileSize);
+    const int endY = std::min(triangle.maxY, (tileY + 1) * kTileSize - 1);
+
+    const FloatBatch lanes = FloatBatch::Load(kLaneOffsets);
+    const FloatBatch zero = FloatBatch::Broadcast(0.0f);
+    const float width = static_cast<float>(kLanes);
+
+    FloatBatch edgeStep[3];
+    FloatBatch edgeLanes[3];
+    for (int i = 0; i < 3; ++i) {
+        edgeStep[i] = FloatBatch::Broadcast(triangle.edgeA[i] * width);
+        edgeLanes[i] = FloatBatch::Broadcast(triangle.edgeA[i]) * lanes;
+    }
+    const FloatBatch depthStep = FloatBatch::Broadcast(triangle.depthDx * width);
+    const FloatBatch depthLanes = FloatBatch::Broadcast(triangle.depthDx) * lanes;
+
+    const float px = static_cast<float>(startX) + 0.5f;
+    for (int y = startY; y <= endY; ++y) {
+        const float py = static_cast<float>(y) + 0.5f;
+
+        FloatBatch edge[3];
+        for (int i = 0; i < 3; ++i) {
+            const float rowStart = triangle.edgeA[i] * (px - triangle.originX[i]) +
+                                   triangle.edgeB[i] * (py - triangle.originY[i]);
+            edge[i] = edgeLanes[i] + FloatBatch::Broadcast(rowStart);
+        }
+        FloatBatch depth = depthLanes + FloatBatch::Broadcast(
+            triangle.z0 + triangle.depthDx * (px - triangle.x0) + triangle.depthDy * (py - triangle.y0));
+
+        float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+        for (int x = startX; x <= endX; x += kLanes) {
+            const FloatBatch outside = SIMD::Or(SIMD::Or(SIMD::CmpLt(edge[0], zero), SIMD::CmpLt(edge[1], zero)),
+                                                SIMD::CmpLt(edge[2], zero));
+            if (SIMD::MoveMask(outside) != kAllLanes) {
+                const FloatBatch current = FloatBatch::Load(row + x);
+                const FloatBatch nearest = SIMD::Select(SIMD::CmpLt(depth, current), depth, current);
+                SIMD::Select(outside, current, nearest).Store(row + x);
+            }
+            for (int i = 0; i < 3; ++i) {
+                edge[i] = edge[i] + edgeStep[i];
+            }
+            depth = depth + depthStep;
+        }
+    }
+}
+
+void SoftwareOcclusionBuffer::BuildTileBlocks(int tileX, int tileY) {
+    constexpr int kBlocksPerTile = kTileSize / kBlockSize;
+
+    for (int by = tileY * kBlocksPerTile; by < (tileY + 1) * kBlocksPerTile; ++by) {
+        for (int bx = tileX * kBlocksPerTile; bx < (tileX + 1) * kBlocksPerTile; ++bx) {
+            const float* block = m_depth.data() + static_cast<size_t>(by) * kBlockSize * m_width + bx * kBlockSize;
+            FloatBatch farthest = FloatBatch::Load(block);
+            for (int y = 0; y < kBlockSize; ++y) {
+                for (int x = 0; x < kBlockSize; x += kLanes) {
+                    const FloatBatch depth = FloatBatch::Load(block + static_cast<size_t>(y) * m_width + x);
+                    farthest = SIMD::Select(SIMD::CmpGt(depth, farthest), depth, farthest);
+                }
+            }
+            m_blockDepth[static_cast<size_t>(by) * m_blocksX + bx] = LaneMax(farthest);
+        }
+    }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+bool SoftwareOcclusionBuffer::TestAABB(const AABB& bounds) const {
+    if (!m_rasterized) {
+        return true;
+    }
+
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    float nearestDepth = std::numeric_limits<float>::max();
+    int behind = 0;
+
+    // One full transform; the other corners step along the matrix columns
+    const glm::vec3 size = bounds.max - bounds.min;
+    glm::vec4 corners[8];
+    corners[0] = m_viewProjection * glm::vec4(bounds.min, 1.0f);
+    corners[1] = corners[0] + m_viewProjection[0] * size.x;
+    corners[2] = corners[0] + m_viewProjection[1] * size.y;
+    corners[3] = corners[1] + m_viewProjection[1] * size.y;
+    for (int i = 0; i < 4; ++i) {
+        corners[i + 4] = corners[i] + m_viewProjection[2] * size.z;
+    }
+
+    for (const glm::vec4& clip : corners) {
+        if (clip.w < kMinClipW) {
+            ++behind;
+            continue;
+        }
+        const float invW = 1.0f / clip.w;
+        minX = std::min(minX, clip.x * invW);
+        maxX = std::max(maxX, clip.x * invW);
+        minY = std::min(minY, clip.y * invW);
+        maxY = std::max(maxY, clip.y * invW);
+        nearestDepth = std::min(nearestDepth, clip.z * invW);
+    }
+
+    if (behind == 8) {
+        return false;
+    }
+    if (behind > 0) {
+        return true;  // Reaches the viewer; too close to be hidden
+    }
+
+    // Every pixel the projected box touches
+    const float halfWidth = 0.5f * static_cast<float>(m_width);
+    const float halfHeight = 0.5f * static_cast<float>(m_height);
+    const int pixelMinX = std::max(0, ClampToPixel(std::floor((minX + 1.0f) * halfWidth), m_width));
+    const int pixelMaxX = std::min(m_width - 1, ClampToPixel(std::floor((maxX + 1.0f) * halfWidth), m_width));
+    const int pixelMinY = std::max(0, ClampToPixel(std::floor((minY + 1.0f) * halfHeight), m_height));
+    const int pixelMaxY = std::min(m_height - 1, ClampToPixel(std::floor((maxY + 1.0f) * halfHeight), m_height));
+    if (pixelMinX > pixelMaxX || pixelMinY > pixelMaxY) {
+        return false;
+    }
+
+    return IsRectVisible(pixelMinX, pixelMinY, pixelMaxX, pixelMaxY, nearestDepth);
+}
+
+bool SoftwareOcclusionBuffer::TestPoint(const glm::vec3& point) const {
+    if (!m_rasterized) {
+        return true;
+    }
+
+    const glm::vec4 clip = m_viewProjection * glm::vec4(point, 1.0f);
+    if (clip.w < kMinClipW) {
+        return false;
+    }
+    const float invW = 1.0f / clip.w;
+    const float x = (clip.x * invW + 1.0f) * 0.5f * static_cast<float>(m_width);
+    const float y = (clip.y * invW + 1.0f) * 0.5f * static_cast<float>(m_height);
+    if (!(x >= 0.0f && x < static_cast<float>(m_width) && y >= 0.0f && y < static_cast<float>(m_height))) {
+        return false;
+    }
+
+    const float depth = m_depth[static_cast<size_t>(y) * m_width + static_cast<size_t>(x)];
+    return !(depth < clip.z * invW);
+}
+
+bool SoftwareOcclusionBuffer::IsRectVisible(int minX, int minY, int maxX, int maxY, float nearestDepth) const {
+    for (int by = minY / kBlockSize; by <= maxY / kBlockSize; ++by) {
+        for (int bx = minX / kBlockSize; bx <= maxX / kBlockSize; ++bx) {
+            if (m_blockDepth[static_cast<size_t>(by) * m_blocksX + bx] < nearestDepth) {
+                continue;  // Every pixel of the block is in front of the box
+            }
+
+            const int blockMinX = bx * kBlockSize;
+            const int blockMinY = by * kBlockSize;
+            const int blockMaxX = blockMinX + kBlockSize - 1;
+            const int blockMaxY = blockMinY + kBlockSize - 1;
+            if (blockMinX >= minX && blockMaxX <= maxX && blockMinY >= minY && blockMaxY <= maxY) {
+                return true;  // The block's farthest pixel is inside the box's rectangle
+            }
+
+            if (AnyPixelVisible(std::max(minX, blockMinX), std::max(minY, blockMinY),
+                                std::min(maxX, blockMaxX), std::min(maxY, blockMaxY), nearestDepth)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool SoftwareOcclusionBuffer::AnyPixelVisible(int minX, int minY, int maxX, int maxY, float nearestDepth) const {
+    const FloatBatch nearest = FloatBatch::Broadcast(nearestDepth);
+    const int startX = minX & ~(kLanes - 1);
+
+    for (int y = minY; y <= maxY; ++y) {
+        const float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+        for (int x = startX; x <= maxX; x += kLanes) {
+            const uint32_t hidden = SIMD::MoveMask(SIMD::CmpLt(FloatBatch::Load(row + x), nearest));
+            if (LanesInRange(x, minX, maxX) & ~hidden) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace Nova
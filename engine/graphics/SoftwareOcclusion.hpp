@@ -0,0 +1,189 @@
+/**
+ * @file SoftwareOcclusion.hpp
+ * @brief CPU occlusion culling against a low-resolution software depth buffer
+ *
+ * HiZBuffer needs the GPU depth buffer read back, which costs a frame of
+ * latency and is unavailable on headless servers. SoftwareOcclusionBuffer
+ * rasterises a handful of designated occluders (buildings, terrain chunks,
+ * large props) into a small depth buffer on the CPU instead:
+ *
+ * - Occluder triangles are transformed, clipped against the near plane and
+ *   binned into screen tiles as they are added.
+ * - Rasterize() fills the tiles in parallel on the JobSystem, one SIMD
+ *   batch of pixels at a time, and reduces each 8x8 block to the farthest
+ *   depth it contains.
+ * - TestAABB() and TestPoint() reject an occludee when its nearest depth is
+ *   behind every covered pixel, checking whole blocks first and single
+ *   pixels only where a block is inconclusive.
+ *
+ * Depth is clip-space z / w for whatever projection is supplied; only its
+ * ordering matters, so perspective and orthographic matrices both work.
+ * The same buffer serves Culler::OcclusionCull (camera view), fog of war
+ * (top-down orthographic view) and AI line of sight (view from the unit's
+ * eyes).
+ *
+ * @code{.cpp}
+ * Nova::SoftwareOcclusionBuffer occlusion;
+ * occlusion.BeginFrame(camera.GetProjectionView());
+ * for (const auto& building : buildings) {
+ *     occlusion.AddOccluder(building.proxyVertices, building.proxyIndices, building.transform);
+ * }
+ * occlusion.Rasterize();
+ * if (occlusion.TestAABB(unit.bounds)) { ... }
+ * @endcode
+ */
+
+#pragma once
+
+#include "graphics/Culler.hpp"
+#include "core/SoA.hpp"
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Nova {
+
+/**
+ * @brief Tuning for SoftwareOcclusionBuffer
+ */
+struct SoftwareOcclusionSettings {
+    /// Depth buffer resolution, rounded up to whole 32x32 tiles
+    int width = 256;
+    int height = 128;
+
+    /// Skip triangles facing away from the viewer (counter-clockwise front faces);
+    /// disable for open occluders such as single-sided walls seen from both sides
+    bool cullBackFaces = true;
+
+    /// Rasterise tiles on JobSystem::Instance() when it is initialized
+    bool useJobSystem = true;
+};
+
+/**
+ * @brief What the last frame put into the buffer
+ */
+struct SoftwareOcclusionStats {
+    size_t occluders = 0;
+    size_t triangles = 0;    ///< Submitted occluder triangles
+    size_t rasterized = 0;   ///< Left after clipping, back-face and off-screen rejection
+    size_t binned = 0;       ///< Triangle-tile pairs rasterised
+};
+
+/**
+ * @brief Tiled software depth buffer for conservative occlusion tests
+ *
+ * A frame is BeginFrame(), any number of AddOccluder() calls, then
+ * Rasterize(). The Test functions are const and may be called from any
+ * number of threads until the next BeginFrame(); before Rasterize() they
+ * report everything as visible.
+ */
+class SoftwareOcclusionBuffer {
+public:
+    static constexpr int kTileSize = 32;
+    static constexpr int kBlockSize = 8;
+
+    SoftwareOcclusionBuffer();
+    explicit SoftwareOcclusionBuffer(const SoftwareOcclusionSettings& settings);
+
+    SoftwareOcclusionBuffer(const SoftwareOcclusionBuffer&) = delete;
+    SoftwareOcclusionBuffer& operator=(const SoftwareOcclusionBuffer&) = delete;
+
+    /**
+     * @brief Change resolution or options; takes effect on the next BeginFrame()
+     */
+    void SetSettings(const SoftwareOcclusionSettings& settings);
+    [[nodiscard]] const SoftwareOcclusionSettings& GetSettings() const noexcept { return m_settings; }
+
+    /**
+     * @brief Start a new frame seen through viewProjection and drop all occluders
+     */
+    void BeginFrame(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Add an indexed triangle mesh as an occluder
+     * @param vertices Object-space positions
+     * @param indices Three per triangle
+     * @param transform Object-to-world matrix
+     *
+     * Occluders should be closed, low-polygon proxies that lie inside the
+     * visible geometry: anything they cover is treated as hidden.
+     */
+    void AddOccluder(std::span<const glm::vec3> vertices, std::span<const uint32_t> indices,
+                     const glm::mat4& transform = glm::mat4(1.0f));
+
+    /**
+     * @brief Rasterise the occluders added since BeginFrame()
+     */
+    void Rasterize();
+
+    /**
+     * @brief Whether any part of a world-space box may be visible
+     * @return false when the box is hidden behind occluders or off screen;
+     *         true when it crosses the near plane
+     */
+    [[nodiscard]] bool TestAABB(const AABB& bounds) const;
+
+    /**
+     * @brief Whether a world-space point is on screen and not behind an occluder
+     */
+    [[nodiscard]] bool TestPoint(const glm::vec3& point) const;
+
+    [[nodiscard]] int GetWidth() const noexcept { return m_width; }
+    [[nodiscard]] int GetHeight() const noexcept { return m_height; }
+    [[nodiscard]] const glm::mat4& GetViewProjection() const noexcept { return m_viewProjection; }
+    [[nodiscard]] const SoftwareOcclusionStats& GetStats() const noexcept { return m_stats; }
+
+    /**
+     * @brief Rasterised depth, row 0 at the bottom of the screen (for debug views)
+     *
+     * Pixels no occluder covers hold std::numeric_limits<float>::max().
+     */
+    [[nodiscard]] std::span<const float> GetDepth() const noexcept { return m_depth; }
+
+private:
+    /**
+     * @brief Screen-space triangle set up for edge-function rasterisation
+     *
+     * Edge i is inside where edgeA[i] * (x - originX[i]) + edgeB[i] * (y - originY[i]) >= 0,
+     * evaluated at pixel centres; depth is a plane through vertex 0.
+     */
+    struct Triangle {
+        float edgeA[3];
+        float edgeB[3];
+        float originX[3];
+        float originY[3];
+        float x0, y0, z0;
+        float depthDx, depthDy;
+        int minX, minY, maxX, maxY;  // Inclusive pixel bounds, clamped to the buffer
+    };
+
+    void AddScreenTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c);
+    void RasterizeTile(size_t tile);
+    void RasterizeTriangle(const Triangle& triangle, int tileX, int tileY);
+    void BuildTileBlocks(int tileX, int tileY);
+
+    [[nodiscard]] bool IsRectVisible(int minX, int minY, int maxX, int maxY, float nearestDepth) const;
+    [[nodiscard]] bool AnyPixelVisible(int minX, int minY, int maxX, int maxY, float nearestDepth) const;
+
+    SoftwareOcclusionSettings m_settings;
+    int m_width = 0;
+    int m_height = 0;
+    int m_tilesX = 0;
+    int m_tilesY = 0;
+    int m_blocksX = 0;
+
+    glm::mat4 m_viewProjection{1.0f};
+    std::vector<float, AlignedAllocator<float, 32>> m_depth;  // Nearest occluder depth per pixel
+    std::vector<float> m_blockDepth;                          // Farthest pixel depth per 8x8 block
+    std::vector<Triangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_bins;  // Triangle indices per tile
+    std::vector<glm::vec4> m_clipVertices;      // AddOccluder() scratch
+
+    SoftwareOcclusionStats m_stats;
+    bool m_rasterized = false;
+};
+
+} // namespace Nova
@@ -0,0 +1,327 @@
+#include "AnimationCompressor.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <tuple>
+
+namespace Nova {
+
+namespace {
+
+using ChannelKind = CompressedClip::ChannelKind;
+using ChannelMode = CompressedClip::ChannelMode;
+
+/**
+ * @brief One animated channel on the frame grid; rotations as (x, y, z, w)
+ */
+struct SampledChannel {
+    ChannelKind kind = ChannelKind::Translation;
+    float tolerance = 0.0f;
+    std::vector<glm::vec4> values;
+};
+
+ImportedKeyframe SampleChannel(const ImportedChannel& channel, float time) {
+    const auto& keys = channel.keyframes;
+    if (keys.size() == 1 || time <= keys.front().time) {
+        return keys.front();
+    }
+    if (time >= keys.back().time) {
+        return keys.back();
+    }
+
+    auto it = std::upper_bound(keys.begin(), keys.end(), time,
+                               [](float t, const ImportedKeyframe& kf) { return t < kf.time; });
+    const ImportedKeyframe& prev = *std::prev(it);
+    const float span = it->time - prev.time;
+    return InterpolateKeyframes(prev, *it, span > 0.0f ? (time - prev.time) / span : 0.0f);
+}
+
+glm::vec4 ToValue(ChannelKind kind, const ImportedKeyframe& key) {
+    switch (kind) {
+        case ChannelKind::Translation: return glm::vec4(key.position, 0.0f);
+        case ChannelKind::Scale:       return glm::vec4(key.scale, 0.0f);
+        case ChannelKind::Rotation: {
+            const glm::quat q = glm::normalize(key.rotation);
+            return glm::vec4(q.x, q.y, q.z, q.w);
+        }
+    }
+    return glm::vec4(0.0f);
+}
+
+glm::vec4 IdentityValue(ChannelKind kind) {
+    switch (kind) {
+        case ChannelKind::Translation: return glm::vec4(0.0f);
+        case ChannelKind::Scale:       return glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+        case ChannelKind::Rotation:    return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+    return glm::vec4(0.0f);
+}
+
+glm::quat ToQuat(const glm::vec4& v) {
+    return glm::quat(v.w, v.x, v.y, v.z);
+}
+
+/**
+ * @brief Error metric matching the import tolerances
+ */
+float ChannelError(ChannelKind kind, const glm::vec4& a, const glm::vec4& b) {
+    if (kind == ChannelKind::Rotation) {
+        return 1.0f - std::min(1.0f, std::abs(glm::dot(ToQuat(a), ToQuat(b))));
+    }
+    return glm::length(glm::vec3(a) - glm::vec3(b));
+}
+
+/**
+ * @brief Reconstruct between two keys exactly as the runtime sampler does
+ */
+glm::vec4 Interpolate(ChannelKind kind, const glm::vec4& a, const glm::vec4& b, float t) {
+    if (kind == ChannelKind::Rotation) {
+        const glm::quat q = ClipQuantization::Nlerp(ToQuat(a), ToQuat(b), t);
+        return glm::vec4(q.x, q.y, q.z, q.w);
+    }
+    return glm::vec4(glm::mix(glm::vec3(a), glm::vec3(b), t), 0.0f);
+}
+
+/**
+ * @brief Worst reconstruction error over a segment and the frame it occurs at
+ */
+std::pair<float, uint32_t> WorstFrame(const SampledChannel& channel, const std::vector<glm::vec4>& decoded,
+                                      const std::vector<bool>& keep, uint32_t first, uint32_t count) {
+    float worst = 0.0f;
+    uint32_t worstFrame = 0;
+    uint32_t previousKey = 0;
+    for (uint32_t f = 0; f < count; ++f) {
+        if (keep[f]) {
+            const float error = ChannelError(channel.kind, decoded[f], channel.values[first + f]);
+            if (error > worst) {
+                worst = error;
+                worstFrame = f;
+            }
+            previousKey = f;
+            continue;
+        }
+
+        uint32_t nextKey = f + 1;
+        while (!keep[nextKey]) {
+            ++nextKey;
+        }
+        const float t = static_cast<float>(f - previousKey) / static_cast<float>(nextKey - previousKey);
+        const glm::vec4 value = Interpolate(channel.kind, decoded[previousKey], decoded[nextKey], t);
+        const float error = ChannelError(channel.kind, value, channel.values[first + f]);
+        if (error > worst) {
+            worst = error;
+            worstFrame = f;
+        }
+    }
+    return {worst, worstFrame};
+}
+
+/**
+ * @brief Quantise, reduce and append one channel's block for one segment
+ * @return Worst error left in the segment
+ */
+float EncodeSegment(const SampledChannel& channel, uint32_t first, uint32_t count,
+                    std::vector<uint8_t>& out, uint64_t& storedKeys) {
+    std::vector<std::array<uint16_t, 3>> packed(count);
+    std::vector<glm::vec4> decoded(count);
+    glm::vec3 rangeMin(0.0f);
+    glm::vec3 rangeExtent(0.0f);
+
+    if (channel.kind == ChannelKind::Rotation) {
+        for (uint32_t f = 0; f < count; ++f) {
+            ClipQuantization::PackRotation(ToQuat(channel.values[first + f]), packed[f].data());
+            const glm::quat q = ClipQuantization::UnpackRotation(packed[f].data());
+            decoded[f] = glm::vec4(q.x, q.y, q.z, q.w);
+        }
+    } else {
+        glm::vec3 rangeMax(-std::numeric_limits<float>::max());
+        rangeMin = glm::vec3(std::numeric_limits<float>::max());
+        for (uint32_t f = 0; f < count; ++f) {
+            rangeMin = glm::min(rangeMin, glm::vec3(channel.values[first + f]));
+            rangeMax = glm::max(rangeMax, glm::vec3(channel.values[first + f]));
+        }
+        rangeExtent = rangeMax - rangeMin;
+        for (uint32_t f = 0; f < count; ++f) {
+            for (int i = 0; i < 3; ++i) {
+                packed[f][i] = ClipQuantization::QuantizeRange(channel.values[first + f][i], rangeMin[i], rangeExtent[i]);
+                decoded[f][i] = ClipQuantization::DequantizeRange(packed[f][i], rangeMin[i], rangeExtent[i]);
+            }
+        }
+    }
+
+    // Start from the segment ends and add back the worst frame until within tolerance
+    std::vector<bool> keep(count, false);
+    keep.front() = true;
+    keep.back() = true;
+    auto [worst, worstFrame] = WorstFrame(channel, decoded, keep, first, count);
+    while (worst > channel.tolerance && !keep[worstFrame]) {
+        keep[worstFrame] = true;
+        std::tie(worst, worstFrame) = WorstFrame(channel, decoded, keep, first, count);
+    }
+
+    std::vector<uint8_t> keyFrames;
+    for (uint32_t f = 0; f < count; ++f) {
+        if (keep[f]) {
+            keyFrames.push_back(static_cast<uint8_t>(f));
+        }
+    }
+    storedKeys += keyFrames.size();
+
+    out.push_back(static_cast<uint8_t>(keyFrames.size()));
+    out.insert(out.end(), keyFrames.begin(), keyFrames.end());
+    if (channel.kind != ChannelKind::Rotation) {
+        const float range[6] = {rangeMin.x, rangeMin.y, rangeMin.z, rangeExtent.x, rangeExtent.y, rangeExtent.z};
+        const auto* bytes = reinterpret_cast<const uint8_t*>(range);
+        out.insert(out.end(), bytes, bytes + sizeof(range));
+    }
+    for (uint8_t f : keyFrames) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(packed[f].data());
+        out.insert(out.end(), bytes, bytes + 3 * sizeof(uint16_t));
+    }
+    return worst;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Animation Compressor
+// ============================================================================
+
+AnimationCompressor::AnimationCompressor(const ClipCompressionSettings& settings)
+    : m_settings(settings)
+{}
+
+CompressedClip AnimationCompressor::Compress(const ImportedClip& clip, ClipCompressionStats* stats) const {
+    ClipCompressionStats report;
+    CompressedClip out;
+    out.m_name = clip.name;
+
+    float duration = clip.duration;
+    if (duration <= 0.0f) {
+        for (const auto& channel : clip.channels) {
+            if (!channel.keyframes.empty()) {
+                duration = std::max(duration, channel.keyframes.back().time);
+            }
+        }
+    }
+
+    const float sampleRate = std::max(m_settings.sampleRate, 1.0f);
+    out.m_duration = duration;
+    out.m_frameCount = duration > 0.0f ? static_cast<uint32_t>(std::ceil(duration * sampleRate - 1e-3f)) + 1 : 1;
+    out.m_frameDuration = out.m_frameCount > 1 ? duration / static_cast<float>(out.m_frameCount - 1) : 0.0f;
+    // A segment stores segmentFrames + 1 frames and its key count is one byte
+    out.m_segmentFrames = std::clamp<uint32_t>(m_settings.segmentFrames, 1, 254);
+    report.frames = out.m_frameCount;
+
+    // Classify every channel and sample the animated ones on the frame grid
+    std::vector<SampledChannel> animated;
+    std::vector<ImportedKeyframe> samples(out.m_frameCount);
+    for (const auto& channel : clip.channels) {
+        report.sourceBytes += channel.keyframes.size() * sizeof(ImportedKeyframe);
+
+        CompressedClip::Track track;
+        track.boneName = channel.boneName;
+        track.constantOffset = static_cast<uint32_t>(out.m_constants.size());
+
+        if (!channel.keyframes.empty()) {
+            for (uint32_t f = 0; f < out.m_frameCount; ++f) {
+                samples[f] = SampleChannel(channel, static_cast<float>(f) * out.m_frameDuration);
+            }
+        }
+
+        struct Component {
+            ChannelKind kind;
+            bool present;
+            float tolerance;
+            ChannelMode* mode;
+        };
+        const Component components[] = {
+            {ChannelKind::Translation, channel.hasPosition, m_settings.positionTolerance, &track.translation},
+            {ChannelKind::Rotation, channel.hasRotation, m_settings.rotationTolerance, &track.rotation},
+            {ChannelKind::Scale, channel.hasScale, m_settings.scaleTolerance, &track.scale},
+        };
+
+        for (const Component& component : components) {
+            *component.mode = ChannelMode::Default;
+            if (!component.present || channel.keyframes.empty()) {
+                ++report.defaultChannels;
+                continue;
+            }
+
+            SampledChannel sampled;
+            sampled.kind = component.kind;
+            sampled.tolerance = component.tolerance;
+            sampled.values.reserve(out.m_frameCount);
+            float deviation = 0.0f;
+            for (uint32_t f = 0; f < out.m_frameCount; ++f) {
+                sampled.values.push_back(ToValue(component.kind, samples[f]));
+                deviation = std::max(deviation, ChannelError(component.kind, sampled.values.front(), sampled.values.back()));
+            }
+
+            if (deviation > component.tolerance) {
+                *component.mode = ChannelMode::Animated;
+                out.m_channels.push_back({static_cast<uint32_t>(out.m_tracks.size()), component.kind});
+                animated.push_back(std::move(sampled));
+                ++report.animatedChannels;
+                continue;
+            }
+
+            const glm::vec4& value = sampled.values.front();
+            const float identityError = ChannelError(component.kind, value, IdentityValue(component.kind));
+            float& maxError = component.kind == ChannelKind::Translation ? report.maxPositionError
+                            : component.kind == ChannelKind::Rotation ? report.maxRotationError
+                            : report.maxScaleError;
+            if (identityError <= component.tolerance) {
+                maxError = std::max(maxError, identityError + deviation);
+                ++report.defaultChannels;
+                continue;
+            }
+
+            *component.mode = ChannelMode::Constant;
+            maxError = std::max(maxError, deviation);
+            const int width = component.kind == ChannelKind::Rotation ? 4 : 3;
+            for (int i = 0; i < width; ++i) {
+                out.m_constants.push_back(value[i]);
+            }
+            ++report.constantChannels;
+        }
+
+        out.m_tracks.push_back(std::move(track));
+    }
+
+    // Segments share their boundary frames so a segment never reads its neighbour
+    const uint32_t lastFrame = out.m_frameCount - 1;
+    const uint32_t segmentCount = lastFrame > 0 ? (lastFrame + out.m_segmentFrames - 1) / out.m_segmentFrames : 1;
+    for (uint32_t s = 0; s < segmentCount; ++s) {
+        const uint32_t first = s * out.m_segmentFrames;
+        const uint32_t count = std::min(first + out.m_segmentFrames, lastFrame) - first + 1;
+
+        const size_t segmentStart = out.m_segmentData.size();
+        out.m_segmentOffsets.push_back(static_cast<uint32_t>(segmentStart));
+        out.m_segmentData.resize(segmentStart + animated.size() * sizeof(uint32_t));
+
+        for (size_t c = 0; c < animated.size(); ++c) {
+            const auto blockOffset = static_cast<uint32_t>(out.m_segmentData.size() - segmentStart);
+            std::memcpy(out.m_segmentData.data() + segmentStart + c * sizeof(uint32_t), &blockOffset, sizeof(blockOffset));
+
+            const float worst = EncodeSegment(animated[c], first, count, out.m_segmentData, report.storedKeys);
+            switch (animated[c].kind) {
+                case ChannelKind::Translation: report.maxPositionError = std::max(report.maxPositionError, worst); break;
+                case ChannelKind::Rotation:    report.maxRotationError = std::max(report.maxRotationError, worst); break;
+                case ChannelKind::Scale:       report.maxScaleError = std::max(report.maxScaleError, worst); break;
+            }
+        }
+    }
+    out.m_segmentOffsets.push_back(static_cast<uint32_t>(out.m_segmentData.size()));
+
+    report.sampledKeys = static_cast<uint64_t>(out.m_frameCount) * animated.size();
+    report.compressedBytes = out.GetMemoryUsage();
+    if (stats) {
+        *stats = report;
+    }
+    return out;
+}
+
+} // namespace Nova
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "AnimationImporter.hpp"
+#include "../animation/CompressedClip.hpp"
+#include <cstdint>
+
+namespace Nova {
+
+// ============================================================================
+// Compression Settings
+// ============================================================================
+
+/**
+ * @brief Error bounds and layout for runtime clip compression
+ *
+ * Tolerances use the same units as AnimationImportSettings: world units for
+ * translation and scale, 1 - |dot| for rotations.
+ */
+struct ClipCompressionSettings {
+    float sampleRate = 30.0f;           ///< Frames per second the clip is resampled to
+    float positionTolerance = 0.001f;
+    float rotationTolerance = 0.0001f;
+    float scaleTolerance = 0.001f;
+    uint32_t segmentFrames = 16;        ///< Frames per segment (at most 254; segments share their end frames)
+};
+
+/**
+ * @brief What compression did to one clip
+ *
+ * Errors are measured per channel against the resampled source, after
+ * quantisation, at every frame.
+ */
+struct ClipCompressionStats {
+    size_t sourceBytes = 0;             ///< Source keyframes as ImportedKeyframe
+    size_t compressedBytes = 0;         ///< CompressedClip::GetMemoryUsage()
+    uint32_t frames = 0;
+    uint32_t defaultChannels = 0;
+    uint32_t constantChannels = 0;
+    uint32_t animatedChannels = 0;
+    uint64_t sampledKeys = 0;           ///< Frames x animated channels
+    uint64_t storedKeys = 0;            ///< Keys kept after reduction, over all segments
+    float maxPositionError = 0.0f;
+    float maxRotationError = 0.0f;
+    float maxScaleError = 0.0f;
+
+    [[nodiscard]] float GetRatio() const {
+        return compressedBytes > 0 ? static_cast<float>(sourceBytes) / static_cast<float>(compressedBytes) : 0.0f;
+    }
+};
+
+// ============================================================================
+// Animation Compressor
+// ============================================================================
+
+/**
+ * @brief Offline compressor producing CompressedClip runtime data
+ *
+ * Pipeline per clip:
+ * - Resample every channel to a uniform frame grid
+ * - Classify each translation/rotation/scale channel as default (identity),
+ *   constant, or animated
+ * - Cut the grid into segments; in each, quantise the animated channels and
+ *   greedily re-insert the worst-reconstructed frame until every frame is
+ *   within tolerance of the source
+ */
+class AnimationCompressor {
+public:
+    AnimationCompressor() = default;
+    explicit AnimationCompressor(const ClipCompressionSettings& settings);
+
+    void SetSettings(const ClipCompressionSettings& settings) { m_settings = settings; }
+    [[nodiscard]] const ClipCompressionSettings& GetSettings() const { return m_settings; }
+
+    /**
+     * @brief Compress one clip
+     * @param stats Optional report of sizes, channel classes and errors
+     */
+    [[nodiscard]] CompressedClip Compress(const ImportedClip& clip, ClipCompressionStats* stats = nullptr) const;
+
+private:
+    ClipCompressionSettings m_settings;
+};
+
+} // namespace Nova
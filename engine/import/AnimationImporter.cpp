@@ -1,4 +1,5 @@
 #include "AnimationImporter.hpp"
+#include "AnimationCompressor.hpp"
 #include <fstream>
 #include <sstream>
 #include <cmath>
@@ -141,15 +142,38 @@ ImportedAnimation AnimationImporter::Import(const std::string& path,
     }
 
     if (settings.compression != AnimationCompression::None) {
+        ClipCompressionSettings clipSettings;
+        clipSettings.sampleRate = settings.resample ? settings.targetSampleRate : settings.sampleRate;
+        clipSettings.positionTolerance = settings.positionTolerance;
+        clipSettings.rotationTolerance = settings.rotationTolerance;
+        clipSettings.scaleTolerance = settings.scaleTolerance;
+        AnimationCompressor compressor(clipSettings);
+
         for (auto& clip : result.clips) {
+            // Runtime clips are built from the full-rate data, before keyframe reduction
+            ClipCompressionStats stats;
+            result.compressedClips.push_back(compressor.Compress(clip, &stats));
+            if (progress) {
+                progress->Info(clip.name + ": " + std::to_string(stats.animatedChannels) + " animated, " +
+                               std::to_string(stats.constantChannels) + " constant, " +
+                               std::to_string(stats.defaultChannels) + " default channels, " +
+                               std::to_string(stats.GetRatio()) + ":1");
+            }
+
             Compress(clip, settings.positionTolerance, settings.rotationTolerance, settings.scaleTolerance);
         }
         if (progress) progress->Info("Compressed animation data");
     }
 
-    result.compressedSize = EstimateCompressedSize(result.clips[0]);
-    for (size_t i = 1; i < result.clips.size(); ++i) {
-        result.compressedSize += EstimateCompressedSize(result.clips[i]);
+    result.compressedSize = 0;
+    if (!result.compressedClips.empty()) {
+        for (const auto& clip : result.compressedClips) {
+            result.compressedSize += clip.GetMemoryUsage();
+        }
+    } else {
+        for (const auto& clip : result.clips) {
+            result.compressedSize += EstimateCompressedSize(clip);
+        }
     }
     result.compressionRatio = result.originalSize > 0 ?
         static_cast<float>(result.compressedSize) / result.originalSize : 1.0f;
@@ -1029,6 +1053,21 @@ bool AnimationImporter::SaveEngineFormat(const ImportedAnimation& animation, con
     Header header;
     header.clipCount = static_cast<uint32_t>(animation.clips.size());
 
+    // Version 2: serialized runtime clips instead of raw keyframes
+    if (!animation.compressedClips.empty()) {
+        header.version = 2;
+        header.clipCount = static_cast<uint32_t>(animation.compressedClips.size());
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (const auto& clip : animation.compressedClips) {
+            const std::vector<uint8_t> data = clip.Serialize();
+            const uint32_t size = static_cast<uint32_t>(data.size());
+            file.write(reinterpret_cast<const char*>(&size), 4);
+            file.write(reinterpret_cast<const char*>(data.data()), size);
+        }
+        return file.good();
+    }
+
     file.write(reinterpret_cast<const char*>(&header), sizeof(header));
 
     // Write clips
@@ -2,6 +2,7 @@
 
 #include "ImportSettings.hpp"
 #include "ImportProgress.hpp"
+#include "../animation/CompressedClip.hpp"
 #include <string>
 #include <vector>
 #include <memory>
@@ -114,6 +115,9 @@ struct ImportedAnimation {
     uint32_t totalChannels = 0;
     uint32_t totalClips = 0;
 
+    // Runtime clips, one per entry in clips (empty when compression is None)
+    std::vector<CompressedClip> compressedClips;
+
     // Compression info
     size_t originalSize = 0;
     size_t compressedSize = 0;
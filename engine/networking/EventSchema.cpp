@@ -0,0 +1,728 @@
+#include "EventSchema.hpp"
+#include "ReplicationSystem.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Nova {
+
+namespace {
+
+constexpr float kInvSqrt2 = 0.70710678118f;
+constexpr uint32_t kDefaultQuantizedBits = 16;
+constexpr uint32_t kDefaultQuaternionBits = 10;
+
+uint32_t QuantizedBits(const EventFieldSchema& field) {
+    const uint32_t fallback = field.encoding == FieldEncoding::Quaternion ? kDefaultQuaternionBits : kDefaultQuantizedBits;
+    return std::clamp(field.bits == 0 ? fallback : field.bits, 1u, 32u);
+}
+
+/**
+ * @brief EventValue alternative index produced by an encoding
+ */
+size_t ValueIndex(FieldEncoding encoding) {
+    switch (encoding) {
+        case FieldEncoding::Bool:           return 1;
+        case FieldEncoding::Int32:          return 2;
+        case FieldEncoding::Int64:          return 3;
+        case FieldEncoding::UInt32:         return 4;
+        case FieldEncoding::UInt64:         return 5;
+        case FieldEncoding::Float:
+        case FieldEncoding::QuantizedFloat: return 6;
+        case FieldEncoding::Double:         return 7;
+        case FieldEncoding::String:         return 8;
+        case FieldEncoding::Vec2:
+        case FieldEncoding::QuantizedVec2:  return 9;
+        case FieldEncoding::Vec3:
+        case FieldEncoding::QuantizedVec3:  return 10;
+        case FieldEncoding::Vec4:           return 11;
+        case FieldEncoding::Quaternion:     return 12;
+        case FieldEncoding::Bytes:          return 13;
+    }
+    return 0;
+}
+
+EventValue DefaultValue(FieldEncoding encoding) {
+    switch (encoding) {
+        case FieldEncoding::Bool:           return false;
+        case FieldEncoding::Int32:          return int32_t{0};
+        case FieldEncoding::Int64:          return int64_t{0};
+        case FieldEncoding::UInt32:         return uint32_t{0};
+        case FieldEncoding::UInt64:         return uint64_t{0};
+        case FieldEncoding::Float:
+        case FieldEncoding::QuantizedFloat: return 0.0f;
+        case FieldEncoding::Double:         return 0.0;
+        case FieldEncoding::String:         return std::string();
+        case FieldEncoding::Vec2:
+        case FieldEncoding::QuantizedVec2:  return glm::vec2(0.0f);
+        case FieldEncoding::Vec3:
+        case FieldEncoding::QuantizedVec3:  return glm::vec3(0.0f);
+        case FieldEncoding::Vec4:           return glm::vec4(0.0f);
+        case FieldEncoding::Quaternion:     return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        case FieldEncoding::Bytes:          return std::vector<uint8_t>();
+    }
+    return std::monostate{};
+}
+
+void WriteField(BitWriter& writer, const EventFieldSchema& field, const EventValue& value) {
+    const uint32_t bits = QuantizedBits(field);
+    switch (field.encoding) {
+        case FieldEncoding::Bool:   writer.WriteBool(std::get<bool>(value)); break;
+        case FieldEncoding::Int32:  writer.WriteVarInt(std::get<int32_t>(value)); break;
+        case FieldEncoding::Int64:  writer.WriteVarInt(std::get<int64_t>(value)); break;
+        case FieldEncoding::UInt32: writer.WriteVarUInt(std::get<uint32_t>(value)); break;
+        case FieldEncoding::UInt64: writer.WriteVarUInt(std::get<uint64_t>(value)); break;
+        case FieldEncoding::Float:  writer.WriteFloat(std::get<float>(value)); break;
+        case FieldEncoding::Double: writer.WriteDouble(std::get<double>(value)); break;
+        case FieldEncoding::QuantizedFloat:
+            writer.WriteQuantized(std::get<float>(value), field.min, field.max, bits);
+            break;
+        case FieldEncoding::Vec2: {
+            const auto& v = std::get<glm::vec2>(value);
+            writer.WriteFloat(v.x);
+            writer.WriteFloat(v.y);
+            break;
+        }
+        case FieldEncoding::Vec3: {
+            const auto& v = std::get<glm::vec3>(value);
+            writer.WriteFloat(v.x);
+            writer.WriteFloat(v.y);
+            writer.WriteFloat(v.z);
+            break;
+        }
+        case FieldEncoding::Vec4: {
+            const auto& v = std::get<glm::vec4>(value);
+            writer.WriteFloat(v.x);
+            writer.WriteFloat(v.y);
+            writer.WriteFloat(v.z);
+            writer.WriteFloat(v.w);
+            break;
+        }
+        case FieldEncoding::QuantizedVec2: {
+            const auto& v = std::get<glm::vec2>(value);
+            writer.WriteQuantized(v.x, field.min, field.max, bits);
+            writer.WriteQuantized(v.y, field.min, field.max, bits);
+            break;
+        }
+        case FieldEncoding::QuantizedVec3: {
+            const auto& v = std::get<glm::vec3>(value);
+            writer.WriteQuantized(v.x, field.min, field.max, bits);
+            writer.WriteQuantized(v.y, field.min, field.max, bits);
+            writer.WriteQuantized(v.z, field.min, field.max, bits);
+            break;
+        }
+        case FieldEncoding::Quaternion:
+            writer.WriteQuaternion(std::get<glm::quat>(value), bits);
+            break;
+        case FieldEncoding::String: {
+            const auto& s = std::get<std::string>(value);
+            writer.WriteBytes(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+            break;
+        }
+        case FieldEncoding::Bytes: {
+            const auto& b = std::get<std::vector<uint8_t>>(value);
+            writer.WriteBytes(b.data(), b.size());
+            break;
+        }
+    }
+}
+
+template<typename T>
+T& Emplace(EventValue& value) {
+    if (auto* existing = std::get_if<T>(&value)) {
+        return *existing;
+    }
+    return value.emplace<T>();
+}
+
+void ReadField(BitReader& reader, const EventFieldSchema& field, EventValue& value) {
+    const uint32_t bits = QuantizedBits(field);
+    switch (field.encoding) {
+        case FieldEncoding::Bool:   value = reader.ReadBool(); break;
+        case FieldEncoding::Int32:  value = static_cast<int32_t>(reader.ReadVarInt()); break;
+        case FieldEncoding::Int64:  value = reader.ReadVarInt(); break;
+        case FieldEncoding::UInt32: value = static_cast<uint32_t>(reader.ReadVarUInt()); break;
+        case FieldEncoding::UInt64: value = reader.ReadVarUInt(); break;
+        case FieldEncoding::Float:  value = reader.ReadFloat(); break;
+        case FieldEncoding::Double: value = reader.ReadDouble(); break;
+        case FieldEncoding::QuantizedFloat:
+            value = reader.ReadQuantized(field.min, field.max, bits);
+            break;
+        case FieldEncoding::Vec2: {
+            const float x = reader.ReadFloat();
+            const float y = reader.ReadFloat();
+            value = glm::vec2(x, y);
+            break;
+        }
+        case FieldEncoding::Vec3: {
+            const float x = reader.ReadFloat();
+            const float y = reader.ReadFloat();
+            const float z = reader.ReadFloat();
+            value = glm::vec3(x, y, z);
+            break;
+        }
+        case FieldEncoding::Vec4: {
+            const float x = reader.ReadFloat();
+            const float y = reader.ReadFloat();
+            const float z = reader.ReadFloat();
+            const float w = reader.ReadFloat();
+            value = glm::vec4(x, y, z, w);
+            break;
+        }
+        case FieldEncoding::QuantizedVec2: {
+            const float x = reader.ReadQuantized(field.min, field.max, bits);
+            const float y = reader.ReadQuantized(field.min, field.max, bits);
+            value = glm::vec2(x, y);
+            break;
+        }
+        case FieldEncoding::QuantizedVec3: {
+            const float x = reader.ReadQuantized(field.min, field.max, bits);
+            const float y = reader.ReadQuantized(field.min, field.max, bits);
+            const float z = reader.ReadQuantized(field.min, field.max, bits);
+            value = glm::vec3(x, y, z);
+            break;
+        }
+        case FieldEncoding::Quaternion:
+            value = reader.ReadQuaternion(bits);
+            break;
+        case FieldEncoding::String:
+            reader.ReadString(Emplace<std::string>(value));
+            break;
+        case FieldEncoding::Bytes:
+            reader.ReadBytes(Emplace<std::vector<uint8_t>>(value));
+            break;
+    }
+}
+
+/**
+ * @brief Encoding used for properties the schema has no slot for
+ */
+FieldEncoding DynamicEncoding(size_t valueIndex) {
+    constexpr FieldEncoding kByIndex[] = {
+        FieldEncoding::Bool,    // monostate (never written)
+        FieldEncoding::Bool,   FieldEncoding::Int32,  FieldEncoding::Int64,
+        FieldEncoding::UInt32, FieldEncoding::UInt64, FieldEncoding::Float,
+        FieldEncoding::Double, FieldEncoding::String, FieldEncoding::Vec2,
+        FieldEncoding::Vec3,   FieldEncoding::Vec4,   FieldEncoding::Quaternion,
+        FieldEncoding::Bytes
+    };
+    return kByIndex[valueIndex];
+}
+
+constexpr uint32_t kDynamicQuaternionBits = 16;
+constexpr uint32_t kValueIndexBits = 4;
+
+} // namespace
+
+// ============================================================================
+// BitWriter
+// ============================================================================
+
+void BitWriter::WriteBits(uint32_t value, uint32_t bitCount) {
+    if (bitCount == 0) return;
+    const uint64_t mask = bitCount >= 32 ? 0xFFFFFFFFull : ((1ull << bitCount) - 1);
+    m_scratch |= (static_cast<uint64_t>(value) & mask) << m_scratchBits;
+    m_scratchBits += bitCount;
+    FlushBytes();
+}
+
+void BitWriter::WriteBits64(uint64_t value, uint32_t bitCount) {
+    if (bitCount > 32) {
+        WriteBits(static_cast<uint32_t>(value), 32);
+        WriteBits(static_cast<uint32_t>(value >> 32), bitCount - 32);
+    } else {
+        WriteBits(static_cast<uint32_t>(value), bitCount);
+    }
+}
+
+void BitWriter::FlushBytes() {
+    while (m_scratchBits >= 8) {
+        if (m_bytePos < m_buffer.size()) {
+            m_buffer[m_bytePos] = static_cast<uint8_t>(m_scratch);
+        } else {
+            m_overflow = true;
+        }
+        ++m_bytePos;
+        m_scratch >>= 8;
+        m_scratchBits -= 8;
+    }
+}
+
+void BitWriter::WriteVarUInt(uint64_t value) {
+    do {
+        uint32_t group = static_cast<uint32_t>(value & 0x7F);
+        value >>= 7;
+        if (value != 0) group |= 0x80;
+        WriteBits(group, 8);
+    } while (value != 0);
+}
+
+void BitWriter::WriteVarInt(int64_t value) {
+    const uint64_t zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    WriteVarUInt(zigzag);
+}
+
+void BitWriter::WriteFloat(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteBits(bits, 32);
+}
+
+void BitWriter::WriteDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteBits64(bits, 64);
+}
+
+void BitWriter::WriteQuantized(float value, float min, float max, uint32_t bitCount) {
+    const double steps = static_cast<double>((1ull << bitCount) - 1);
+    const double range = static_cast<double>(max) - static_cast<double>(min);
+    double t = range > 0.0 ? (static_cast<double>(value) - min) / range : 0.0;
+    if (!(t > 0.0)) t = 0.0;    // Also catches NaN
+    if (t > 1.0) t = 1.0;
+    WriteBits(static_cast<uint32_t>(t * steps + 0.5), bitCount);
+}
+
+void BitWriter::WriteQuaternion(const glm::quat& q, uint32_t bitsPerComponent) {
+    const float components[4] = {q.x, q.y, q.z, q.w};
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; ++i) {
+        if (std::abs(components[i]) > std::abs(components[largest])) {
+            largest = i;
+        }
+    }
+
+    // q and -q are the same rotation: flip so the dropped component is positive
+    const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+    WriteBits(largest, 2);
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i != largest) {
+            WriteQuantized(components[i] * sign, -kInvSqrt2, kInvSqrt2, bitsPerComponent);
+        }
+    }
+}
+
+void BitWriter::WriteBytes(const uint8_t* data, size_t size) {
+    WriteVarUInt(size);
+    if (m_scratchBits == 0 && m_bytePos + size <= m_buffer.size()) {
+        if (size > 0) std::memcpy(m_buffer.data() + m_bytePos, data, size);
+        m_bytePos += size;
+        return;
+    }
+    for (size_t i = 0; i < size; ++i) {
+        WriteBits(data[i], 8);
+    }
+}
+
+void BitWriter::Rewind(size_t bitPos) {
+    if (bitPos >= GetBitsWritten()) return;
+
+    const size_t byte = bitPos / 8;
+    const uint32_t bits = static_cast<uint32_t>(bitPos % 8);
+    const uint64_t mask = (1ull << bits) - 1;
+    if (byte == m_bytePos) {
+        m_scratch &= mask;
+    } else {
+        // The partial byte was already flushed to the buffer
+        m_scratch = byte < m_buffer.size() ? (m_buffer[byte] & mask) : 0;
+    }
+    m_bytePos = byte;
+    m_scratchBits = bits;
+    m_overflow = byte > m_buffer.size() || (byte == m_buffer.size() && bits > 0);
+}
+
+size_t BitWriter::Finish() {
+    if (m_scratchBits > 0) {
+        m_scratchBits = 8;
+        FlushBytes();
+    }
+    return m_overflow ? 0 : m_bytePos;
+}
+
+// ============================================================================
+// BitReader
+// ============================================================================
+
+uint32_t BitReader::ReadBits(uint32_t bitCount) {
+    if (bitCount == 0) return 0;
+    if (m_error || m_bitPos + bitCount > m_data.size() * 8) {
+        m_error = true;
+        return 0;
+    }
+
+    uint32_t result = 0;
+    uint32_t read = 0;
+    while (read < bitCount) {
+        const size_t byte = m_bitPos >> 3;
+        const uint32_t offset = static_cast<uint32_t>(m_bitPos & 7);
+        const uint32_t take = std::min(8u - offset, bitCount - read);
+        const uint32_t bits = (static_cast<uint32_t>(m_data[byte]) >> offset) & ((1u << take) - 1);
+        result |= bits << read;
+        read += take;
+        m_bitPos += take;
+    }
+    return result;
+}
+
+uint64_t BitReader::ReadBits64(uint32_t bitCount) {
+    if (bitCount > 32) {
+        const uint64_t low = ReadBits(32);
+        return low | (static_cast<uint64_t>(ReadBits(bitCount - 32)) << 32);
+    }
+    return ReadBits(bitCount);
+}
+
+uint64_t BitReader::ReadVarUInt() {
+    uint64_t value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7) {
+        const uint32_t group = ReadBits(8);
+        value |= static_cast<uint64_t>(group & 0x7F) << shift;
+        if ((group & 0x80) == 0) {
+            return value;
+        }
+    }
+    m_error = true;     // More than 10 groups: corrupt
+    return 0;
+}
+
+int64_t BitReader::ReadVarInt() {
+    const uint64_t zigzag = ReadVarUInt();
+    return static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+}
+
+float BitReader::ReadFloat() {
+    const uint32_t bits = ReadBits(32);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+double BitReader::ReadDouble() {
+    const uint64_t bits = ReadBits64(64);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float BitReader::ReadQuantized(float min, float max, uint32_t bitCount) {
+    const double steps = static_cast<double>((1ull << bitCount) - 1);
+    const double t = ReadBits(bitCount) / steps;
+    return static_cast<float>(min + t * (static_cast<double>(max) - min));
+}
+
+glm::quat BitReader::ReadQuaternion(uint32_t bitsPerComponent) {
+    const uint32_t largest = ReadBits(2);
+    float components[4];
+    float sumSquares = 0.0f;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i != largest) {
+            components[i] = ReadQuantized(-kInvSqrt2, kInvSqrt2, bitsPerComponent);
+            sumSquares += components[i] * components[i];
+        }
+    }
+    components[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSquares));
+    return glm::quat(components[3], components[0], components[1], components[2]);
+}
+
+void BitReader::Seek(size_t bitPos) {
+    if (bitPos > m_data.size() * 8) {
+        m_error = true;
+        return;
+    }
+    m_bitPos = bitPos;
+}
+
+size_t BitReader::ReadLength() {
+    const uint64_t length = ReadVarUInt();
+    const size_t remaining = m_data.size() - std::min(m_data.size(), (m_bitPos + 7) / 8);
+    if (length > remaining) {
+        m_error = true;
+        return 0;
+    }
+    return static_cast<size_t>(length);
+}
+
+void BitReader::ReadString(std::string& out) {
+    const size_t length = ReadLength();
+    out.resize(length);
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = static_cast<char>(ReadBits(8));
+    }
+}
+
+void BitReader::ReadBytes(std::vector<uint8_t>& out) {
+    const size_t length = ReadLength();
+    if ((m_bitPos & 7) == 0 && !m_error) {
+        out.assign(m_data.begin() + static_cast<std::ptrdiff_t>(m_bitPos / 8),
+                   m_data.begin() + static_cast<std::ptrdiff_t>(m_bitPos / 8 + length));
+        m_bitPos += length * 8;
+        return;
+    }
+    out.resize(length);
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = static_cast<uint8_t>(ReadBits(8));
+    }
+}
+
+// ============================================================================
+// EventSchema
+// ============================================================================
+
+int EventSchema::FindField(const std::string& name) const {
+    for (size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void EventSchema::InitEvent(NetworkEvent& event) const {
+    event.eventType = typeName;
+    event.category = static_cast<ReplicationCategory>(defaultCategory);
+    event.replicationMode = static_cast<ReplicationMode>(defaultReplicationMode);
+    event.persistenceMode = static_cast<PersistenceMode>(defaultPersistenceMode);
+    event.reliabilityMode = static_cast<ReliabilityMode>(defaultReliabilityMode);
+    event.priority = static_cast<EventPriority>(defaultPriority);
+
+    event.properties.resize(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+        event.properties[i].name = fields[i].name;
+        event.properties[i].value = DefaultValue(fields[i].encoding);
+        event.properties[i].dirty = true;
+    }
+}
+
+uint64_t EventSchema::GetHash() const {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+
+    mix(&typeId, sizeof(typeId));
+    mix(typeName.data(), typeName.size());
+    for (const auto& field : fields) {
+        mix(field.name.data(), field.name.size());
+        mix(&field.encoding, sizeof(field.encoding));
+        mix(&field.min, sizeof(field.min));
+        mix(&field.max, sizeof(field.max));
+        const uint32_t bits = QuantizedBits(field);
+        mix(&bits, sizeof(bits));
+    }
+    return hash;
+}
+
+// ============================================================================
+// EventCodec
+// ============================================================================
+
+size_t EventCodec::Encode(const EventSchema& schema, const NetworkEvent& event, std::span<uint8_t> buffer) {
+    if (schema.typeId == kDynamicTypeId) return 0;
+
+    BitWriter writer(buffer);
+    writer.WriteVarUInt(schema.typeId);
+    writer.WriteVarUInt(event.eventId);
+    writer.WriteVarUInt(event.sourceEntityId);
+    writer.WriteVarUInt(event.targetEntityId);
+    writer.WriteVarUInt(event.sourceClientId);
+    writer.WriteVarUInt(event.timestamp);
+
+    const bool customHeader =
+        static_cast<uint8_t>(event.category) != schema.defaultCategory ||
+        static_cast<uint8_t>(event.replicationMode) != schema.defaultReplicationMode ||
+        static_cast<uint8_t>(event.persistenceMode) != schema.defaultPersistenceMode ||
+        static_cast<uint8_t>(event.reliabilityMode) != schema.defaultReliabilityMode ||
+        static_cast<uint8_t>(event.priority) != schema.defaultPriority;
+    writer.WriteBool(customHeader);
+    if (customHeader) {
+        writer.WriteBits(static_cast<uint32_t>(event.category), 4);
+        writer.WriteBits(static_cast<uint32_t>(event.replicationMode), 3);
+        writer.WriteBits(static_cast<uint32_t>(event.persistenceMode), 2);
+        writer.WriteBits(static_cast<uint32_t>(event.reliabilityMode), 2);
+        writer.WriteBits(static_cast<uint32_t>(event.priority), 2);
+    }
+
+    // Match slots to properties; in-order events hit on the first comparison
+    const auto& properties = event.properties;
+    const EventValue* slotValues[EventSchema::kMaxFields];
+    const size_t slotCount = std::min(schema.fields.size(), EventSchema::kMaxFields);
+    size_t cursor = 0;
+    size_t matched = 0;
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+        const EventFieldSchema& field = schema.fields[slot];
+        const EventProperty* found = nullptr;
+        if (cursor < properties.size() && properties[cursor].name == field.name) {
+            found = &properties[cursor++];
+        } else {
+            for (const auto& prop : properties) {
+                if (prop.name == field.name) {
+                    found = &prop;
+                    break;
+                }
+            }
+        }
+
+        // A property of the wrong type travels as an unknown property instead
+        slotValues[slot] = found && found->value.index() == ValueIndex(field.encoding) ? &found->value : nullptr;
+        writer.WriteBool(slotValues[slot] != nullptr);
+        matched += slotValues[slot] ? 1 : 0;
+    }
+
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+        if (slotValues[slot]) {
+            WriteField(writer, schema.fields[slot], *slotValues[slot]);
+        }
+    }
+
+    // Properties without a slot
+    size_t extraCount = 0;
+    if (matched < properties.size()) {
+        for (const auto& prop : properties) {
+            const int slot = schema.FindField(prop.name);
+            const bool inSlot = slot >= 0 && static_cast<size_t>(slot) < slotCount &&
+                                prop.value.index() == ValueIndex(schema.fields[slot].encoding);
+            extraCount += (!inSlot && prop.value.index() != 0) ? 1 : 0;
+        }
+    }
+    writer.WriteVarUInt(extraCount);
+    if (extraCount > 0) {
+        EventFieldSchema dynamicField;
+        dynamicField.bits = kDynamicQuaternionBits;
+        for (const auto& prop : properties) {
+            const int slot = schema.FindField(prop.name);
+            const bool inSlot = slot >= 0 && static_cast<size_t>(slot) < slotCount &&
+                                prop.value.index() == ValueIndex(schema.fields[slot].encoding);
+            if (inSlot || prop.value.index() == 0) continue;
+
+            writer.WriteBytes(reinterpret_cast<const uint8_t*>(prop.name.data()), prop.name.size());
+            writer.WriteBits(static_cast<uint32_t>(prop.value.index()), kValueIndexBits);
+            dynamicField.encoding = DynamicEncoding(prop.value.index());
+            WriteField(writer, dynamicField, prop.value);
+        }
+    }
+
+    return writer.Finish();
+}
+
+bool EventCodec::Decode(const EventSchema& schema, std::span<const uint8_t> data, NetworkEvent& event) {
+    BitReader reader(data);
+    if (reader.ReadVarUInt() != schema.typeId || schema.typeId == kDynamicTypeId) {
+        return false;
+    }
+
+    event.eventType = schema.typeName;
+    event.eventId = reader.ReadVarUInt();
+    event.sourceEntityId = reader.ReadVarUInt();
+    event.targetEntityId = reader.ReadVarUInt();
+    event.sourceClientId = static_cast<uint32_t>(reader.ReadVarUInt());
+    event.timestamp = reader.ReadVarUInt();
+    event.serverTimestamp = 0;
+    event.delay = 0.0f;
+    event.targetClients.clear();
+    event.processed = false;
+    event.acknowledged = false;
+
+    uint8_t header[5] = {schema.defaultCategory, schema.defaultReplicationMode, schema.defaultPersistenceMode,
+                         schema.defaultReliabilityMode, schema.defaultPriority};
+    if (reader.ReadBool()) {
+        header[0] = static_cast<uint8_t>(reader.ReadBits(4));
+        header[1] = static_cast<uint8_t>(reader.ReadBits(3));
+        header[2] = static_cast<uint8_t>(reader.ReadBits(2));
+        header[3] = static_cast<uint8_t>(reader.ReadBits(2));
+        header[4] = static_cast<uint8_t>(reader.ReadBits(2));
+    }
+    event.category = static_cast<ReplicationCategory>(header[0]);
+    event.replicationMode = static_cast<ReplicationMode>(header[1]);
+    event.persistenceMode = static_cast<PersistenceMode>(header[2]);
+    event.reliabilityMode = static_cast<ReliabilityMode>(header[3]);
+    event.priority = static_cast<EventPriority>(header[4]);
+
+    const size_t slotCount = std::min(schema.fields.size(), EventSchema::kMaxFields);
+    uint64_t presence = 0;
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+        presence |= static_cast<uint64_t>(reader.ReadBool()) << slot;
+    }
+
+    // Reuse existing property entries (names and string/byte buffers keep their capacity)
+    auto& properties = event.properties;
+    size_t count = 0;
+    auto nextProperty = [&properties, &count]() -> EventProperty& {
+        if (count == properties.size()) {
+            properties.emplace_back();
+        }
+        EventProperty& prop = properties[count++];
+        prop.dirty = false;
+        return prop;
+    };
+
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+        if ((presence >> slot) & 1) {
+            EventProperty& prop = nextProperty();
+            prop.name = schema.fields[slot].name;
+            ReadField(reader, schema.fields[slot], prop.value);
+        }
+    }
+
+    const uint64_t extraCount = reader.ReadVarUInt();
+    EventFieldSchema dynamicField;
+    dynamicField.bits = kDynamicQuaternionBits;
+    for (uint64_t i = 0; i < extraCount && !reader.HasError(); ++i) {
+        EventProperty& prop = nextProperty();
+        reader.ReadString(prop.name);
+        const uint32_t valueIndex = reader.ReadBits(kValueIndexBits);
+        if (valueIndex == 0 || valueIndex >= std::variant_size_v<EventValue>) {
+            properties.resize(count);
+            return false;
+        }
+        dynamicField.encoding = DynamicEncoding(valueIndex);
+        ReadField(reader, dynamicField, prop.value);
+    }
+
+    properties.resize(count);
+    return !reader.HasError();
+}
+
+uint32_t EventCodec::PeekTypeId(std::span<const uint8_t> data) {
+    if (data.empty()) return kDynamicTypeId;
+    BitReader reader(data);
+    const uint64_t typeId = reader.ReadVarUInt();
+    return reader.HasError() ? kDynamicTypeId : static_cast<uint32_t>(typeId);
+}
+
+bool EventCodec::EncodeSlot(const EventSchema& schema, size_t slot, const NetworkEvent& event, BitWriter& writer) {
+    const EventFieldSchema& field = schema.fields[slot];
+    const auto& properties = event.properties;
+    const EventProperty* found = nullptr;
+    if (slot < properties.size() && properties[slot].name == field.name) {
+        found = &properties[slot];
+    } else {
+        for (const auto& prop : properties) {
+            if (prop.name == field.name) {
+                found = &prop;
+                break;
+            }
+        }
+    }
+
+    if (found && found->value.index() == ValueIndex(field.encoding)) {
+        WriteField(writer, field, found->value);
+        return true;
+    }
+    WriteField(writer, field, DefaultValue(field.encoding));
+    return false;
+}
+
+void EventCodec::DecodeSlot(const EventSchema& schema, size_t slot, BitReader& reader, NetworkEvent& event) {
+    ReadField(reader, schema.fields[slot], event.properties[slot].value);
+}
+
+void EventCodec::SkipSlot(const EventSchema& schema, size_t slot, BitReader& reader) {
+    EventValue value;
+    ReadField(reader, schema.fields[slot], value);
+}
+
+} // namespace Nova
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Nova {
+
+struct NetworkEvent;
+
+// ============================================================================
+// Bit Streams
+// ============================================================================
+
+/**
+ * @brief Little-endian bit writer over a caller-provided buffer
+ *
+ * Never allocates. Writing past the end of the buffer sets the overflow
+ * flag and discards further bits; callers check HasOverflowed() once at
+ * the end instead of after every write.
+ */
+class BitWriter {
+public:
+    explicit BitWriter(std::span<uint8_t> buffer) : m_buffer(buffer) {}
+
+    void WriteBits(uint32_t value, uint32_t bitCount);
+    void WriteBits64(uint64_t value, uint32_t bitCount);
+    void WriteBool(bool value) { WriteBits(value ? 1u : 0u, 1); }
+
+    /**
+     * @brief LEB128 varint: 7 bits per group plus a continuation bit
+     */
+    void WriteVarUInt(uint64_t value);
+    void WriteVarInt(int64_t value);    // Zigzag, then varint
+
+    void WriteFloat(float value);
+    void WriteDouble(double value);
+
+    /**
+     * @brief Quantise to bitCount bits across [min, max] (clamped)
+     */
+    void WriteQuantized(float value, float min, float max, uint32_t bitCount);
+
+    /**
+     * @brief Smallest-three quaternion: 2-bit index of the dropped component
+     *        and the other three quantised in [-1/sqrt(2), 1/sqrt(2)]
+     */
+    void WriteQuaternion(const glm::quat& q, uint32_t bitsPerComponent);
+
+    void WriteBytes(const uint8_t* data, size_t size);   // Varint length + bytes
+
+    /**
+     * @brief Drop everything written after bitPos (clears an overflow that happened later)
+     */
+    void Rewind(size_t bitPos);
+
+    /**
+     * @brief Flush the partial byte; returns total bytes written (0 on overflow)
+     */
+    size_t Finish();
+
+    [[nodiscard]] bool HasOverflowed() const { return m_overflow; }
+    [[nodiscard]] size_t GetBitsWritten() const { return m_bytePos * 8 + m_scratchBits; }
+
+private:
+    void FlushBytes();
+
+    std::span<uint8_t> m_buffer;
+    size_t m_bytePos = 0;
+    uint64_t m_scratch = 0;
+    uint32_t m_scratchBits = 0;
+    bool m_overflow = false;
+};
+
+/**
+ * @brief Reader matching BitWriter
+ *
+ * Reading past the end sets the error flag and yields zeros.
+ */
+class BitReader {
+public:
+    explicit BitReader(std::span<const uint8_t> data) : m_data(data) {}
+
+    uint32_t ReadBits(uint32_t bitCount);
+    uint64_t ReadBits64(uint32_t bitCount);
+    bool ReadBool() { return ReadBits(1) != 0; }
+
+    uint64_t ReadVarUInt();
+    int64_t ReadVarInt();
+
+    float ReadFloat();
+    double ReadDouble();
+    float ReadQuantized(float min, float max, uint32_t bitCount);
+    glm::quat ReadQuaternion(uint32_t bitsPerComponent);
+
+    /**
+     * @brief Read a length-prefixed run written by WriteBytes, reusing out's capacity
+     */
+    void ReadString(std::string& out);
+    void ReadBytes(std::vector<uint8_t>& out);
+
+    /**
+     * @brief Move to an absolute bit position (past the end sets the error flag)
+     */
+    void Seek(size_t bitPos);
+
+    [[nodiscard]] bool HasError() const { return m_error; }
+    [[nodiscard]] size_t GetBitsRead() const { return m_bitPos; }
+
+private:
+    size_t ReadLength();
+
+    std::span<const uint8_t> m_data;
+    size_t m_bitPos = 0;
+    bool m_error = false;
+};
+
+// ============================================================================
+// Event Schemas
+// ============================================================================
+
+/**
+ * @brief Wire encoding of one schema field
+ *
+ * Each encoding decodes to exactly one EventValue alternative.
+ */
+enum class FieldEncoding : uint8_t {
+    Bool,               // bool, 1 bit
+    Int32,              // int32_t, zigzag varint
+    Int64,              // int64_t, zigzag varint
+    UInt32,             // uint32_t, varint
+    UInt64,             // uint64_t, varint
+    Float,              // float, 32 bits
+    Double,             // double, 64 bits
+    QuantizedFloat,     // float in [min, max] with `bits` bits
+    Vec2,               // glm::vec2, raw floats
+    Vec3,               // glm::vec3, raw floats
+    Vec4,               // glm::vec4, raw floats
+    QuantizedVec2,      // glm::vec2, each component in [min, max] with `bits` bits
+    QuantizedVec3,      // glm::vec3, each component in [min, max] with `bits` bits
+    Quaternion,         // glm::quat, smallest-three with `bits` bits per component
+    String,             // std::string, varint length + bytes
+    Bytes               // std::vector<uint8_t>, varint length + bytes
+};
+
+/**
+ * @brief One property slot of an event schema
+ */
+struct EventFieldSchema {
+    std::string name;
+    FieldEncoding encoding = FieldEncoding::Float;
+    float min = 0.0f;           // Quantised encodings only
+    float max = 1.0f;
+    uint32_t bits = 0;          // 0 = encoding default (16, or 10 for quaternions)
+};
+
+/**
+ * @brief Compiled wire schema of a registered event type
+ *
+ * Created by EventTypeRegistry from EventTypeConfig::fields. Property slots
+ * are addressed by index: events built with InitEvent() (or decoded with
+ * EventCodec) keep properties in slot order, so the encoder matches each
+ * slot with a single name comparison instead of a search.
+ */
+struct EventSchema {
+    static constexpr size_t kMaxFields = 64;   // Slots beyond this travel as unknown properties
+
+    uint32_t typeId = 0;
+    std::string typeName;
+    std::vector<EventFieldSchema> fields;
+
+    // Header values that are omitted from the wire when an event matches them
+    uint8_t defaultCategory = 0;
+    uint8_t defaultReplicationMode = 0;
+    uint8_t defaultPersistenceMode = 0;
+    uint8_t defaultReliabilityMode = 0;
+    uint8_t defaultPriority = 0;
+
+    /**
+     * @brief Slot index of a field, or -1
+     */
+    [[nodiscard]] int FindField(const std::string& name) const;
+
+    /**
+     * @brief Reset event to this type with one default-valued property per slot
+     */
+    void InitEvent(NetworkEvent& event) const;
+
+    /**
+     * @brief Stable hash of type ID, name and field layout (for handshake checks)
+     */
+    [[nodiscard]] uint64_t GetHash() const;
+};
+
+// ============================================================================
+// Event Codec
+// ============================================================================
+
+/**
+ * @brief Bit-packed encoder/decoder for schema events
+ *
+ * Wire layout: varint type ID (never 0), varint IDs and timestamp, one bit
+ * plus packed enums when the header differs from the schema defaults, a
+ * presence bit per slot, the slot payloads, and finally any properties the
+ * schema does not know (name + type tag + raw value) so nothing is dropped.
+ */
+class EventCodec {
+public:
+    /// Type ID tagging a payload in the dynamic (string-keyed) format
+    static constexpr uint32_t kDynamicTypeId = 0;
+
+    /// Type IDs from here on tag control packets and are never given to event types
+    static constexpr uint32_t kFirstReservedTypeId = 0x3F00;
+    static constexpr uint32_t kSnapshotTypeId = 0x3F00;       // SnapshotHistory delta packet
+    static constexpr uint32_t kSnapshotAckTypeId = 0x3F01;    // SnapshotReceiver acknowledgement
+
+    /// Scratch size used by ReplicationSystem (one MTU-sized datagram)
+    static constexpr size_t kMaxEventSize = 1200;
+
+    /**
+     * @brief Encode event into buffer
+     * @return Bytes written, or 0 if the buffer is too small
+     */
+    static size_t Encode(const EventSchema& schema, const NetworkEvent& event, std::span<uint8_t> buffer);
+
+    /**
+     * @brief Decode into event, reusing its property storage
+     * @return false on truncated data or type ID mismatch
+     */
+    static bool Decode(const EventSchema& schema, std::span<const uint8_t> data, NetworkEvent& event);
+
+    /**
+     * @brief Read the leading type ID without decoding (kDynamicTypeId if empty)
+     */
+    static uint32_t PeekTypeId(std::span<const uint8_t> data);
+
+    /**
+     * @brief Write one slot payload exactly as Encode() does
+     *
+     * Writes the slot's default value if the event lacks the property or
+     * holds it with another type, and returns false in that case.
+     */
+    static bool EncodeSlot(const EventSchema& schema, size_t slot, const NetworkEvent& event, BitWriter& writer);
+
+    /**
+     * @brief Read one slot payload into event.properties[slot] (event set up by InitEvent())
+     */
+    static void DecodeSlot(const EventSchema& schema, size_t slot, BitReader& reader, NetworkEvent& event);
+
+    /**
+     * @brief Advance reader past one slot payload
+     */
+    static void SkipSlot(const EventSchema& schema, size_t slot, BitReader& reader);
+};
+
+} // namespace Nova
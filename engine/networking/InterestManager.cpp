@@ -0,0 +1,569 @@
+#include "InterestManager.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Nova {
+
+InterestManager::InterestManager(const InterestConfig& config)
+    : m_config(config) {
+    m_config.cellSize = std::max(m_config.cellSize, 1e-3f);
+    m_invCellSize = 1.0f / m_config.cellSize;
+}
+
+// ============================================================================
+// Entities
+// ============================================================================
+
+void InterestManager::UpdateEntity(uint64_t entityId, const glm::vec3& position, uint32_t updateBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto [it, inserted] = m_entityLookup.try_emplace(entityId, kInvalid);
+    if (inserted) {
+        uint32_t slot;
+        if (!m_freeEntities.empty()) {
+            slot = m_freeEntities.back();
+            m_freeEntities.pop_back();
+        } else {
+            slot = static_cast<uint32_t>(m_entities.size());
+            m_entities.emplace_back();
+        }
+        it->second = slot;
+
+        Entity& entity = m_entities[slot];
+        entity.id = entityId;
+        entity.position = position;
+        entity.priority = 1.0f;
+        entity.updateBytes = updateBytes != 0 ? updateBytes : m_config.defaultUpdateBytes;
+        entity.version = 1;
+        entity.alive = true;
+        entity.visibleTo.clear();
+        AddToCell(slot, CellKeyOf(position));
+        MarkMoved(slot);
+        return;
+    }
+
+    const uint32_t slot = it->second;
+    Entity& entity = m_entities[slot];
+    entity.position = position;
+    if (updateBytes != 0) {
+        entity.updateBytes = updateBytes;
+    }
+    ++entity.version;
+
+    const uint64_t key = CellKeyOf(position);
+    if (key != entity.cellKey) {
+        RemoveFromCell(slot);
+        AddToCell(slot, key);
+    }
+    MarkMoved(slot);
+}
+
+void InterestManager::MarkEntityChanged(uint64_t entityId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (Entity* entity = FindEntity(entityId)) {
+        ++entity->version;
+    }
+}
+
+void InterestManager::SetEntityPriority(uint64_t entityId, float priority) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (Entity* entity = FindEntity(entityId)) {
+        entity->priority = std::max(priority, 0.0f);
+    }
+}
+
+void InterestManager::RemoveEntity(uint64_t entityId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entityLookup.find(entityId);
+    if (it == m_entityLookup.end()) return;
+
+    const uint32_t slot = it->second;
+    Entity& entity = m_entities[slot];
+    while (!entity.visibleTo.empty()) {
+        const VisibleRef ref = entity.visibleTo.back();
+        RemoveVisible(ref.client, ref.index);
+    }
+    RemoveFromCell(slot);
+
+    entity.alive = false;
+    entity.moved = false;
+    m_freeEntities.push_back(slot);
+    m_entityLookup.erase(it);
+}
+
+bool InterestManager::HasEntity(uint64_t entityId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entityLookup.find(entityId) != m_entityLookup.end();
+}
+
+// ============================================================================
+// Clients
+// ============================================================================
+
+void InterestManager::AddClient(uint32_t clientId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    GetOrAddClient(clientId);
+}
+
+void InterestManager::SetClientPosition(uint32_t clientId, const glm::vec3& position, float radius) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Client& client = GetOrAddClient(clientId);
+    client.areas.clear();
+    client.areas.push_back({position, radius, 1.0f});
+    RewatchCells(m_clientLookup[clientId]);
+}
+
+void InterestManager::SetClientPosition(uint32_t clientId, const glm::vec3& position) {
+    SetClientPosition(clientId, position, m_config.defaultRadius);
+}
+
+void InterestManager::AddInterestArea(uint32_t clientId, const glm::vec3& center, float radius, float priority) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_clientLookup.find(clientId);
+    if (it == m_clientLookup.end()) return;
+
+    m_clients[it->second].areas.push_back({center, radius, priority});
+    RewatchCells(it->second);
+}
+
+void InterestManager::SetClientBandwidth(uint32_t clientId, size_t bytesPerTick) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    GetOrAddClient(clientId).bytesPerTick = bytesPerTick;
+}
+
+void InterestManager::RemoveClient(uint32_t clientId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_clientLookup.find(clientId);
+    if (it == m_clientLookup.end()) return;
+
+    const uint32_t slot = it->second;
+    Client& client = m_clients[slot];
+    while (!client.visible.empty()) {
+        RemoveVisible(slot, client.visible.size() - 1);
+    }
+    UnwatchCells(slot);
+
+    client.alive = false;
+    client.areas.clear();
+    m_freeClients.push_back(slot);
+    m_clientLookup.erase(it);
+}
+
+bool InterestManager::HasClient(uint32_t clientId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_clientLookup.find(clientId) != m_clientLookup.end();
+}
+
+// ============================================================================
+// Per-Tick Selection
+// ============================================================================
+
+void InterestManager::Update(float deltaTime) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.relevanceTests = 0;
+    m_stats.selectedUpdates = 0;
+    m_stats.deferredUpdates = 0;
+
+    // Clients whose areas changed re-test the entities in their cells
+    for (uint32_t slot = 0; slot < m_clients.size(); ++slot) {
+        Client& client = m_clients[slot];
+        if (client.alive && client.areasDirty) {
+            client.areasDirty = false;
+            RebuildVisible(slot);
+        }
+    }
+
+    // Moved entities re-test against the watchers of their new cell and the
+    // clients that currently see them (which catches leaving a watched cell)
+    for (uint32_t slot : m_movedEntities) {
+        Entity& entity = m_entities[slot];
+        if (!entity.alive || !entity.moved) continue;
+        entity.moved = false;
+
+        const uint32_t stamp = ++m_stamp;
+        m_clientScratch.clear();
+        auto addCandidate = [this, stamp](uint32_t client) {
+            if (m_clients[client].stamp != stamp) {
+                m_clients[client].stamp = stamp;
+                m_clientScratch.push_back(client);
+            }
+        };
+
+        for (const VisibleRef& ref : entity.visibleTo) {
+            addCandidate(ref.client);
+        }
+        for (uint32_t watcher : m_cells[entity.cellKey].watchers) {
+            addCandidate(watcher);
+        }
+        for (uint32_t client : m_globalClients) {
+            addCandidate(client);
+        }
+
+        for (uint32_t client : m_clientScratch) {
+            SetVisibility(client, slot, Relevance(m_clients[client], entity.position));
+        }
+        m_stats.relevanceTests += m_clientScratch.size();
+    }
+    m_movedEntities.clear();
+
+    // Stale entities accumulate priority until selected
+    for (Client& client : m_clients) {
+        if (!client.alive) continue;
+        for (VisibleEntry& entry : client.visible) {
+            const Entity& entity = m_entities[entry.entity];
+            if (entity.version != entry.sentVersion) {
+                entry.accumulator += entity.priority * entry.relevance * deltaTime;
+            }
+        }
+    }
+}
+
+void InterestManager::SelectUpdates(uint32_t clientId, std::vector<uint64_t>& outEntities) {
+    outEntities.clear();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_clientLookup.find(clientId);
+    if (it == m_clientLookup.end()) return;
+
+    Client& client = m_clients[it->second];
+    m_candidates.clear();
+    for (uint32_t i = 0; i < client.visible.size(); ++i) {
+        const VisibleEntry& entry = client.visible[i];
+        if (m_entities[entry.entity].version != entry.sentVersion) {
+            m_candidates.emplace_back(entry.accumulator, i);
+        }
+    }
+    std::sort(m_candidates.begin(), m_candidates.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    size_t usedBytes = 0;
+    for (const auto& [accumulator, index] : m_candidates) {
+        VisibleEntry& entry = client.visible[index];
+        const Entity& entity = m_entities[entry.entity];
+
+        // Skip what does not fit, but let smaller updates fill the remainder;
+        // the first update always goes out so oversized entities cannot starve
+        if (usedBytes + entity.updateBytes > client.bytesPerTick && !outEntities.empty()) {
+            ++m_stats.deferredUpdates;
+            continue;
+        }
+
+        usedBytes += entity.updateBytes;
+        outEntities.push_back(entity.id);
+        entry.sentVersion = entity.version;
+        entry.accumulator = 0.0f;
+        ++m_stats.selectedUpdates;
+    }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+bool InterestManager::IsRelevant(uint64_t /*entityId*/, const glm::vec3& entityPos, uint32_t clientId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Client* client = FindClient(clientId);
+    if (!client) return true; // No interest data, assume relevant
+    return Relevance(*client, entityPos) > 0.0f;
+}
+
+float InterestManager::GetRelevanceScore(uint64_t /*entityId*/, const glm::vec3& entityPos, uint32_t clientId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Client* client = FindClient(clientId);
+    if (!client) return 1.0f;
+    return Relevance(*client, entityPos);
+}
+
+std::vector<uint32_t> InterestManager::GetClientsInterestedIn(uint64_t /*entityId*/, const glm::vec3& entityPos) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<uint32_t> clients;
+
+    auto it = m_cells.find(CellKeyOf(entityPos));
+    if (it != m_cells.end()) {
+        for (uint32_t watcher : it->second.watchers) {
+            if (Relevance(m_clients[watcher], entityPos) > 0.0f) {
+                clients.push_back(m_clients[watcher].clientId);
+            }
+        }
+    }
+    for (uint32_t client : m_globalClients) {
+        clients.push_back(m_clients[client].clientId);
+    }
+    return clients;
+}
+
+bool InterestManager::IsVisibleTo(uint64_t entityId, uint32_t clientId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entityIt = m_entityLookup.find(entityId);
+    auto clientIt = m_clientLookup.find(clientId);
+    if (entityIt == m_entityLookup.end() || clientIt == m_clientLookup.end()) return false;
+
+    for (const VisibleRef& ref : m_entities[entityIt->second].visibleTo) {
+        if (ref.client == clientIt->second) return true;
+    }
+    return false;
+}
+
+size_t InterestManager::GetVisibleCount(uint32_t clientId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Client* client = FindClient(clientId);
+    return client ? client->visible.size() : 0;
+}
+
+void InterestManager::GetVisibleEntities(uint32_t clientId, std::vector<uint64_t>& outEntities) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    outEntities.clear();
+    if (const Client* client = FindClient(clientId)) {
+        outEntities.reserve(client->visible.size());
+        for (const VisibleEntry& entry : client->visible) {
+            outEntities.push_back(m_entities[entry.entity].id);
+        }
+    }
+}
+
+InterestManager::Stats InterestManager::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.entityCount = m_entityLookup.size();
+    stats.clientCount = m_clientLookup.size();
+    stats.cellCount = m_cells.size();
+    stats.visiblePairs = 0;
+    for (const Client& client : m_clients) {
+        stats.visiblePairs += client.alive ? client.visible.size() : 0;
+    }
+    return stats;
+}
+
+// ============================================================================
+// Internals
+// ============================================================================
+
+uint64_t InterestManager::CellKey(int32_t x, int32_t z) const {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+}
+
+uint64_t InterestManager::CellKeyOf(const glm::vec3& position) const {
+    return CellKey(static_cast<int32_t>(std::floor(position.x * m_invCellSize)),
+                   static_cast<int32_t>(std::floor(position.z * m_invCellSize)));
+}
+
+float InterestManager::Relevance(const Client& client, const glm::vec3& position) const {
+    if (client.areas.empty()) return 1.0f;
+
+    float best = 0.0f;
+    for (const InterestArea& area : client.areas) {
+        const glm::vec3 offset = position - area.center;
+        const float distSq = glm::dot(offset, offset);
+        if (distSq <= area.radius * area.radius) {
+            const float closeness = area.radius > 0.0f ? 1.0f - std::sqrt(distSq) / area.radius : 1.0f;
+            best = std::max(best, area.priority * std::max(closeness, m_config.minRelevance));
+        }
+    }
+    return best;
+}
+
+const InterestManager::Client* InterestManager::FindClient(uint32_t clientId) const {
+    auto it = m_clientLookup.find(clientId);
+    return it != m_clientLookup.end() ? &m_clients[it->second] : nullptr;
+}
+
+InterestManager::Client& InterestManager::GetOrAddClient(uint32_t clientId) {
+    auto [it, inserted] = m_clientLookup.try_emplace(clientId, kInvalid);
+    if (!inserted) {
+        return m_clients[it->second];
+    }
+
+    uint32_t slot;
+    if (!m_freeClients.empty()) {
+        slot = m_freeClients.back();
+        m_freeClients.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(m_clients.size());
+        m_clients.emplace_back();
+    }
+    it->second = slot;
+
+    Client& client = m_clients[slot];
+    client.clientId = clientId;
+    client.areas.clear();
+    client.watchedCells.clear();
+    client.visible.clear();
+    client.bytesPerTick = m_config.defaultBytesPerTick;
+    client.stamp = 0;
+    client.alive = true;
+    RewatchCells(slot);     // No areas yet: sees everything
+    return client;
+}
+
+InterestManager::Entity* InterestManager::FindEntity(uint64_t entityId) {
+    auto it = m_entityLookup.find(entityId);
+    return it != m_entityLookup.end() ? &m_entities[it->second] : nullptr;
+}
+
+void InterestManager::AddToCell(uint32_t entity, uint64_t key) {
+    Cell& cell = m_cells[key];
+    m_entities[entity].cellKey = key;
+    m_entities[entity].cellIndex = static_cast<uint32_t>(cell.entities.size());
+    cell.entities.push_back(entity);
+}
+
+void InterestManager::RemoveFromCell(uint32_t entity) {
+    Entity& e = m_entities[entity];
+    auto it = m_cells.find(e.cellKey);
+    if (it == m_cells.end() || e.cellIndex == kInvalid) return;
+
+    auto& entities = it->second.entities;
+    const uint32_t moved = entities.back();
+    entities[e.cellIndex] = moved;
+    m_entities[moved].cellIndex = e.cellIndex;
+    entities.pop_back();
+    e.cellIndex = kInvalid;
+    ReleaseCellIfEmpty(e.cellKey);
+}
+
+void InterestManager::ReleaseCellIfEmpty(uint64_t key) {
+    auto it = m_cells.find(key);
+    if (it != m_cells.end() && it->second.entities.empty() && it->second.watchers.empty()) {
+        m_cells.erase(it);
+    }
+}
+
+void InterestManager::UnwatchCells(uint32_t client) {
+    Client& c = m_clients[client];
+    for (uint64_t key : c.watchedCells) {
+        auto it = m_cells.find(key);
+        if (it == m_cells.end()) continue;
+
+        auto& watchers = it->second.watchers;
+        auto pos = std::find(watchers.begin(), watchers.end(), client);
+        if (pos != watchers.end()) {
+            *pos = watchers.back();
+            watchers.pop_back();
+        }
+        ReleaseCellIfEmpty(key);
+    }
+    c.watchedCells.clear();
+
+    auto global = std::find(m_globalClients.begin(), m_globalClients.end(), client);
+    if (global != m_globalClients.end()) {
+        *global = m_globalClients.back();
+        m_globalClients.pop_back();
+    }
+}
+
+void InterestManager::RewatchCells(uint32_t client) {
+    UnwatchCells(client);
+
+    Client& c = m_clients[client];
+    c.areasDirty = true;
+    if (c.areas.empty()) {
+        m_globalClients.push_back(client);
+        return;
+    }
+
+    for (const InterestArea& area : c.areas) {
+        const int32_t minX = static_cast<int32_t>(std::floor((area.center.x - area.radius) * m_invCellSize));
+        const int32_t maxX = static_cast<int32_t>(std::floor((area.center.x + area.radius) * m_invCellSize));
+        const int32_t minZ = static_cast<int32_t>(std::floor((area.center.z - area.radius) * m_invCellSize));
+        const int32_t maxZ = static_cast<int32_t>(std::floor((area.center.z + area.radius) * m_invCellSize));
+
+        for (int32_t z = minZ; z <= maxZ; ++z) {
+            for (int32_t x = minX; x <= maxX; ++x) {
+                const uint64_t key = CellKey(x, z);
+                auto& watchers = m_cells[key].watchers;
+                if (!watchers.empty() && watchers.back() == client) continue;  // Overlapping areas
+                watchers.push_back(client);
+                c.watchedCells.push_back(key);
+            }
+        }
+    }
+}
+
+void InterestManager::RebuildVisible(uint32_t client) {
+    const uint32_t stamp = ++m_stamp;
+    Client& c = m_clients[client];
+
+    if (c.areas.empty()) {
+        for (uint32_t slot = 0; slot < m_entities.size(); ++slot) {
+            if (m_entities[slot].alive) {
+                SetVisibility(client, slot, 1.0f);
+            }
+        }
+    } else {
+        for (uint64_t key : c.watchedCells) {
+            for (uint32_t slot : m_cells[key].entities) {
+                SetVisibility(client, slot, Relevance(c, m_entities[slot].position));
+                ++m_stats.relevanceTests;
+            }
+        }
+    }
+
+    // Entries not refreshed above are no longer in any watched cell
+    for (size_t i = c.visible.size(); i-- > 0;) {
+        if (c.visible[i].stamp != stamp) {
+            RemoveVisible(client, i);
+        }
+    }
+}
+
+void InterestManager::SetVisibility(uint32_t client, uint32_t entity, float relevance) {
+    Entity& e = m_entities[entity];
+    Client& c = m_clients[client];
+
+    auto ref = std::find_if(e.visibleTo.begin(), e.visibleTo.end(),
+                            [client](const VisibleRef& r) { return r.client == client; });
+    if (relevance <= 0.0f) {
+        if (ref != e.visibleTo.end()) {
+            RemoveVisible(client, ref->index);
+        }
+        return;
+    }
+
+    if (ref != e.visibleTo.end()) {
+        c.visible[ref->index].relevance = relevance;
+        c.visible[ref->index].stamp = m_stamp;
+        return;
+    }
+
+    // Newly visible entities start with a head start so they appear promptly
+    VisibleEntry entry;
+    entry.entity = entity;
+    entry.stamp = m_stamp;
+    entry.relevance = relevance;
+    entry.accumulator = e.priority;
+    e.visibleTo.push_back({client, static_cast<uint32_t>(c.visible.size())});
+    c.visible.push_back(entry);
+}
+
+void InterestManager::RemoveVisible(uint32_t client, size_t index) {
+    Client& c = m_clients[client];
+    auto& refs = m_entities[c.visible[index].entity].visibleTo;
+    for (size_t i = 0; i < refs.size(); ++i) {
+        if (refs[i].client == client) {
+            refs[i] = refs.back();
+            refs.pop_back();
+            break;
+        }
+    }
+
+    const size_t last = c.visible.size() - 1;
+    if (index != last) {
+        c.visible[index] = c.visible[last];
+        for (VisibleRef& ref : m_entities[c.visible[index].entity].visibleTo) {
+            if (ref.client == client) {
+                ref.index = static_cast<uint32_t>(index);
+                break;
+            }
+        }
+    }
+    c.visible.pop_back();
+}
+
+void InterestManager::MarkMoved(uint32_t entity) {
+    if (!m_entities[entity].moved) {
+        m_entities[entity].moved = true;
+        m_movedEntities.push_back(entity);
+    }
+}
+
+} // namespace Nova
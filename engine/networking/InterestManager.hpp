@@ -0,0 +1,254 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+
+/**
+ * @brief Configuration for interest management
+ */
+struct InterestConfig {
+    float cellSize = 64.0f;             // Grid cell edge on the XZ plane (~ half a view radius)
+    float defaultRadius = 150.0f;       // Radius used by SetClientPosition
+    size_t defaultBytesPerTick = 4096;  // Per-client send budget
+    uint32_t defaultUpdateBytes = 32;   // Estimated size of one entity update
+    float minRelevance = 0.05f;         // Relevance floor at the edge of an area
+};
+
+/**
+ * @brief Sphere a client is interested in
+ */
+struct InterestArea {
+    glm::vec3 center{0.0f};
+    float radius = 100.0f;
+    float priority = 1.0f;
+};
+
+// ============================================================================
+// Interest Manager - Spatial Relevancy and Per-Client Send Budgets
+// ============================================================================
+
+/**
+ * @brief Decides which entity updates each client receives every tick
+ *
+ * Entities live in a uniform grid on the XZ plane. Each client watches the
+ * cells its interest areas overlap, and keeps a visible set that is updated
+ * incrementally: Update() re-tests only entities that moved (against the
+ * watchers of their cell and the clients that already see them) and
+ * clients whose areas changed. Nothing scans all entities x all clients.
+ *
+ * Every visible entity carries a per-client priority accumulator that
+ * grows by priority x relevance each tick while the client holds a stale
+ * version of it. SelectUpdates() picks the highest accumulators that fit in
+ * the client's byte budget and resets them, so under load the nearest and
+ * most important entities update often and distant ones still update
+ * eventually instead of being dropped arbitrarily.
+ *
+ * Clients without interest areas see every entity (relevance 1).
+ * All public methods are thread-safe.
+ */
+class InterestManager {
+public:
+    /**
+     * @brief Counters for the last Update() / SelectUpdates() calls
+     */
+    struct Stats {
+        size_t entityCount = 0;
+        size_t clientCount = 0;
+        size_t cellCount = 0;
+        size_t visiblePairs = 0;        // Sum of visible set sizes
+        size_t relevanceTests = 0;      // Distance tests in the last Update()
+        size_t selectedUpdates = 0;     // Entities selected since the last Update()
+        size_t deferredUpdates = 0;     // Stale entities left over budget since the last Update()
+    };
+
+    explicit InterestManager(const InterestConfig& config = {});
+    ~InterestManager() = default;
+
+    InterestManager(const InterestManager&) = delete;
+    InterestManager& operator=(const InterestManager&) = delete;
+
+    // =========================================================================
+    // Entities
+    // =========================================================================
+
+    /**
+     * @brief Insert or move an entity; marks its state as changed
+     * @param updateBytes Size of the entity's next update (0 = keep previous)
+     */
+    void UpdateEntity(uint64_t entityId, const glm::vec3& position, uint32_t updateBytes = 0);
+
+    /**
+     * @brief Mark a state change without moving
+     */
+    void MarkEntityChanged(uint64_t entityId);
+
+    /**
+     * @brief Scale how fast the entity's accumulators grow (default 1)
+     */
+    void SetEntityPriority(uint64_t entityId, float priority);
+
+    void RemoveEntity(uint64_t entityId);
+    [[nodiscard]] bool HasEntity(uint64_t entityId) const;
+
+    // =========================================================================
+    // Clients
+    // =========================================================================
+
+    /**
+     * @brief Register a client (sees everything until it gets interest areas)
+     */
+    void AddClient(uint32_t clientId);
+
+    /**
+     * @brief Replace the client's areas with one around its viewpoint
+     */
+    void SetClientPosition(uint32_t clientId, const glm::vec3& position, float radius);
+    void SetClientPosition(uint32_t clientId, const glm::vec3& position);
+
+    void AddInterestArea(uint32_t clientId, const glm::vec3& center, float radius, float priority);
+    void SetClientBandwidth(uint32_t clientId, size_t bytesPerTick);
+    void RemoveClient(uint32_t clientId);
+    [[nodiscard]] bool HasClient(uint32_t clientId) const;
+
+    // =========================================================================
+    // Per-Tick Selection
+    // =========================================================================
+
+    /**
+     * @brief Apply movement and area changes, then grow accumulators by deltaTime
+     */
+    void Update(float deltaTime);
+
+    /**
+     * @brief Entities to update for a client this tick, highest priority first
+     *
+     * Selected entities are considered delivered: their accumulators reset
+     * until they change again.
+     */
+    void SelectUpdates(uint32_t clientId, std::vector<uint64_t>& outEntities);
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    /**
+     * @brief True if the client's areas contain the position (unknown client: true)
+     */
+    [[nodiscard]] bool IsRelevant(uint64_t entityId, const glm::vec3& entityPos, uint32_t clientId) const;
+
+    /**
+     * @brief Area priority scaled by closeness to the area center, 0 outside
+     */
+    [[nodiscard]] float GetRelevanceScore(uint64_t entityId, const glm::vec3& entityPos, uint32_t clientId) const;
+
+    /**
+     * @brief Clients whose areas contain the position (watchers of its cell only)
+     */
+    [[nodiscard]] std::vector<uint32_t> GetClientsInterestedIn(uint64_t entityId, const glm::vec3& entityPos) const;
+
+    /**
+     * @brief Whether the entity is in the client's visible set as of the last Update()
+     */
+    [[nodiscard]] bool IsVisibleTo(uint64_t entityId, uint32_t clientId) const;
+    [[nodiscard]] size_t GetVisibleCount(uint32_t clientId) const;
+
+    /**
+     * @brief The client's visible set as of the last Update(), in no particular order
+     */
+    void GetVisibleEntities(uint32_t clientId, std::vector<uint64_t>& outEntities) const;
+
+    [[nodiscard]] Stats GetStats() const;
+    [[nodiscard]] const InterestConfig& GetConfig() const { return m_config; }
+
+private:
+    static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+
+    struct VisibleRef {
+        uint32_t client;
+        uint32_t index;     // Position in the client's visible list
+    };
+
+    struct Entity {
+        uint64_t id = 0;
+        glm::vec3 position{0.0f};
+        uint64_t cellKey = 0;
+        uint32_t cellIndex = kInvalid;
+        float priority = 1.0f;
+        uint32_t updateBytes = 0;
+        uint32_t version = 1;
+        bool moved = false;
+        bool alive = false;
+        std::vector<VisibleRef> visibleTo;
+    };
+
+    struct VisibleEntry {
+        uint32_t entity;
+        uint32_t sentVersion = 0;
+        uint32_t stamp = 0;
+        float relevance = 0.0f;
+        float accumulator = 0.0f;
+    };
+
+    struct Client {
+        uint32_t clientId = 0;
+        std::vector<InterestArea> areas;
+        std::vector<uint64_t> watchedCells;
+        std::vector<VisibleEntry> visible;
+        size_t bytesPerTick = 0;
+        uint32_t stamp = 0;
+        bool areasDirty = false;
+        bool alive = false;
+    };
+
+    struct Cell {
+        std::vector<uint32_t> entities;
+        std::vector<uint32_t> watchers;
+    };
+
+    [[nodiscard]] uint64_t CellKey(int32_t x, int32_t z) const;
+    [[nodiscard]] uint64_t CellKeyOf(const glm::vec3& position) const;
+    [[nodiscard]] float Relevance(const Client& client, const glm::vec3& position) const;
+    [[nodiscard]] const Client* FindClient(uint32_t clientId) const;
+    Client& GetOrAddClient(uint32_t clientId);
+    Entity* FindEntity(uint64_t entityId);
+
+    void AddToCell(uint32_t entity, uint64_t key);
+    void RemoveFromCell(uint32_t entity);
+    void ReleaseCellIfEmpty(uint64_t key);
+    void UnwatchCells(uint32_t client);
+    void RewatchCells(uint32_t client);
+    void RebuildVisible(uint32_t client);
+    void SetVisibility(uint32_t client, uint32_t entity, float relevance);
+    void RemoveVisible(uint32_t client, size_t index);
+    void MarkMoved(uint32_t entity);
+
+    InterestConfig m_config;
+    float m_invCellSize = 1.0f;
+
+    std::vector<Entity> m_entities;
+    std::vector<uint32_t> m_freeEntities;
+    std::unordered_map<uint64_t, uint32_t> m_entityLookup;
+    std::vector<uint32_t> m_movedEntities;
+
+    std::vector<Client> m_clients;
+    std::vector<uint32_t> m_freeClients;
+    std::unordered_map<uint32_t, uint32_t> m_clientLookup;
+    std::vector<uint32_t> m_globalClients;      // Clients without areas
+
+    std::unordered_map<uint64_t, Cell> m_cells;
+
+    std::vector<uint32_t> m_clientScratch;
+    std::vector<std::pair<float, uint32_t>> m_candidates;
+    uint32_t m_stamp = 0;
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace Nova
@@ -0,0 +1,746 @@
+#include "NetworkIOThread.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+    #include <arpa/inet.h>
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+namespace Nova {
+
+namespace {
+
+// A partial fragmented message older than this may be dropped to make room
+constexpr uint64_t kReassemblyTimeoutNs = 1'000'000'000;
+
+} // namespace
+
+NetworkIOThread::NetworkIOThread(const NetIOConfig& config)
+    : m_config(config) {
+    m_config.datagramSize = std::clamp<size_t>(m_config.datagramSize, kFrameHeaderSize + 1, NetBuffer::kCapacity);
+    m_config.bufferCount = std::max<size_t>(m_config.bufferCount, 2);
+    m_config.batchSize = std::clamp<size_t>(m_config.batchSize, 1, 1024);
+}
+
+NetworkIOThread::~NetworkIOThread() {
+    Stop();
+}
+
+// ============================================================================
+// Game Thread
+// ============================================================================
+
+bool NetworkIOThread::Send(uint32_t clientId, std::span<const uint8_t> payload) {
+    return Send(clientId, {}, payload);
+}
+
+bool NetworkIOThread::Send(uint32_t clientId, std::span<const uint8_t> header, std::span<const uint8_t> payload) {
+    const size_t length = header.size() + payload.size();
+    if (!IsRunning() || length > kMaxFragmentedMessageSize) {
+        m_sendDropped++;
+        return false;
+    }
+
+    if (length <= kMaxMessageSize) {
+        if (!QueueFrame(clientId, 0, header, payload)) {
+            m_sendDropped++;
+            return false;
+        }
+        m_messagesSent++;
+        return true;
+    }
+
+    // Too large for one datagram: one fragment per datagram
+    m_fragmentScratch.assign(header.begin(), header.end());
+    m_fragmentScratch.insert(m_fragmentScratch.end(), payload.begin(), payload.end());
+    const uint16_t messageId = m_nextFragmentId++;
+    const size_t count = (length + kFragmentChunkSize - 1) / kFragmentChunkSize;
+    for (size_t i = 0; i < count; ++i) {
+        const std::array<uint8_t, kFragmentHeaderSize> fragmentHeader = {
+            static_cast<uint8_t>(messageId & 0xFF), static_cast<uint8_t>(messageId >> 8),
+            static_cast<uint8_t>(i), static_cast<uint8_t>(count)
+        };
+        const size_t offset = i * kFragmentChunkSize;
+        const std::span<const uint8_t> chunk(m_fragmentScratch.data() + offset,
+                                             std::min(kFragmentChunkSize, length - offset));
+        if (!QueueFrame(clientId, kFragmentFlag, fragmentHeader, chunk)) {
+            // The fragments already queued can never be reassembled
+            m_sendDropped++;
+            return false;
+        }
+    }
+    m_messagesSent++;
+    m_messagesFragmented++;
+    return true;
+}
+
+bool NetworkIOThread::QueueFrame(uint32_t clientId, uint16_t flags,
+                                 std::span<const uint8_t> header, std::span<const uint8_t> payload) {
+    const size_t length = header.size() + payload.size();
+    auto [it, inserted] = m_clientSlots.try_emplace(clientId, static_cast<uint32_t>(m_open.size()));
+    if (inserted) {
+        m_open.push_back(nullptr);
+    }
+    const uint32_t slot = it->second;
+    NetBuffer*& buffer = m_open[slot];
+
+    // A message larger than the coalescing target still goes out, alone
+    const size_t frameSize = kFrameHeaderSize + length;
+    if (buffer && buffer->size + frameSize > std::max(m_config.datagramSize, frameSize)) {
+        m_outbound->TryPush(buffer);
+        buffer = AcquireSendBuffer();
+        if (!buffer) {
+            m_openSlots.erase(std::find(m_openSlots.begin(), m_openSlots.end(), slot));
+        }
+    } else if (!buffer) {
+        buffer = AcquireSendBuffer();
+        if (buffer) {
+            m_openSlots.push_back(slot);
+        }
+    }
+    if (!buffer) {
+        return false;
+    }
+
+    buffer->clientId = clientId;
+    uint8_t* out = buffer->data.data() + buffer->size;
+    const size_t field = length | flags;
+    out[0] = static_cast<uint8_t>(field & 0xFF);
+    out[1] = static_cast<uint8_t>((field >> 8) & 0xFF);
+    if (!header.empty()) {
+        std::memcpy(out + kFrameHeaderSize, header.data(), header.size());
+    }
+    if (!payload.empty()) {
+        std::memcpy(out + kFrameHeaderSize + header.size(), payload.data(), payload.size());
+    }
+    buffer->size += static_cast<uint32_t>(frameSize);
+    return true;
+}
+
+void NetworkIOThread::Flush() {
+    if (!IsRunning()) return;
+
+    for (uint32_t slot : m_openSlots) {
+        m_outbound->TryPush(m_open[slot]);
+        m_open[slot] = nullptr;
+    }
+    m_openSlots.clear();
+
+    if (m_outbound->SizeApprox() > 0) {
+        Wake();
+    }
+}
+
+NetBuffer* NetworkIOThread::Poll() {
+    NetBuffer* buffer = nullptr;
+    if (m_inbound && m_inbound->TryPop(buffer)) {
+        return buffer;
+    }
+    return nullptr;
+}
+
+void NetworkIOThread::Release(NetBuffer* buffer) {
+    if (buffer && m_inboundReturn) {
+        m_inboundReturn->TryPush(buffer);
+    }
+}
+
+std::span<const uint8_t> NetworkIOThread::Reassemble(uint32_t clientId, std::span<const uint8_t> frame,
+                                                     uint64_t nowNs) {
+    if (frame.size() <= kFragmentHeaderSize) {
+        m_fragmentsDropped++;
+        return {};
+    }
+
+    const uint16_t messageId = static_cast<uint16_t>(frame[0] | (frame[1] << 8));
+    const size_t index = frame[2];
+    const size_t count = frame[3];
+    const std::span<const uint8_t> chunk = frame.subspan(kFragmentHeaderSize);
+    const bool last = index + 1 == count;
+    if (count < 2 || count > kMaxFragments || index >= count ||
+        (last ? chunk.size() > kFragmentChunkSize : chunk.size() != kFragmentChunkSize)) {
+        m_fragmentsDropped++;
+        return {};
+    }
+
+    // A peer finishes one fragmented message before it starts the next, so a
+    // different message ID means the partial one lost a fragment
+    auto it = m_reassembly.find(clientId);
+    if (it != m_reassembly.end() && (it->second.messageId != messageId || it->second.count != count)) {
+        m_fragmentsDropped += it->second.received;
+        m_reassemblyBytes -= it->second.data.size();
+        m_reassembly.erase(it);
+        it = m_reassembly.end();
+    }
+
+    if (it == m_reassembly.end()) {
+        const size_t bytes = count * kFragmentChunkSize;
+        if (m_reassemblyBytes + bytes > m_config.maxReassemblyBytes) {
+            for (auto stale = m_reassembly.begin(); stale != m_reassembly.end();) {
+                if (nowNs - stale->second.startedNs > kReassemblyTimeoutNs) {
+                    m_fragmentsDropped += stale->second.received;
+                    m_reassemblyBytes -= stale->second.data.size();
+                    stale = m_reassembly.erase(stale);
+                } else {
+                    ++stale;
+                }
+            }
+            if (m_reassemblyBytes + bytes > m_config.maxReassemblyBytes) {
+                m_fragmentsDropped++;
+                return {};
+            }
+        }
+
+        it = m_reassembly.try_emplace(clientId).first;
+        it->second.messageId = messageId;
+        it->second.count = static_cast<uint8_t>(count);
+        it->second.startedNs = nowNs;
+        it->second.data.resize(bytes);
+        m_reassemblyBytes += bytes;
+    }
+
+    Reassembly& entry = it->second;
+    const uint64_t bit = 1ull << index;
+    if (entry.receivedMask & bit) {
+        return {};      // Duplicate datagram
+    }
+    entry.receivedMask |= bit;
+    entry.received++;
+    std::memcpy(entry.data.data() + index * kFragmentChunkSize, chunk.data(), chunk.size());
+    if (last) {
+        entry.size = index * kFragmentChunkSize + chunk.size();
+    }
+    if (entry.received < entry.count) {
+        return {};
+    }
+
+    m_reassemblyBytes -= entry.data.size();
+    m_reassembled.swap(entry.data);
+    m_reassembled.resize(entry.size);
+    m_reassembly.erase(it);
+    m_messagesReassembled++;
+    return m_reassembled;
+}
+
+NetBuffer* NetworkIOThread::AcquireSendBuffer() {
+    if (m_sendFree.empty()) {
+        NetBuffer* returned = nullptr;
+        while (m_outboundReturn->TryPop(returned)) {
+            m_sendFree.push_back(returned);
+        }
+        if (m_sendFree.empty()) {
+            return nullptr;
+        }
+    }
+
+    NetBuffer* buffer = m_sendFree.back();
+    m_sendFree.pop_back();
+    buffer->size = 0;
+    return buffer;
+}
+
+NetworkIOThread::Stats NetworkIOThread::GetStats() const {
+    Stats stats;
+    stats.messagesSent = m_messagesSent;
+    stats.datagramsSent = m_datagramsSent.load(std::memory_order_relaxed);
+    stats.bytesSent = m_bytesSent.load(std::memory_order_relaxed);
+    stats.sendCalls = m_sendCalls.load(std::memory_order_relaxed);
+    stats.datagramsReceived = m_datagramsReceived.load(std::memory_order_relaxed);
+    stats.bytesReceived = m_bytesReceived.load(std::memory_order_relaxed);
+    stats.receiveCalls = m_receiveCalls.load(std::memory_order_relaxed);
+    stats.wakeups = m_wakeups.load(std::memory_order_relaxed);
+    stats.sendDropped = m_sendDropped + m_ioSendDropped.load(std::memory_order_relaxed);
+    stats.receiveDropped = m_receiveDropped.load(std::memory_order_relaxed);
+    stats.messagesFragmented = m_messagesFragmented;
+    stats.messagesReassembled = m_messagesReassembled;
+    stats.fragmentsDropped = m_fragmentsDropped;
+    stats.peersEvicted = m_peersEvicted.load(std::memory_order_relaxed);
+    stats.peersRefused = m_peersRefused.load(std::memory_order_relaxed);
+    return stats;
+}
+
+#ifdef __linux__
+
+// ============================================================================
+// Socket Setup (Linux)
+// ============================================================================
+
+/**
+ * @brief recvmmsg / sendmmsg descriptors, owned by the I/O thread
+ */
+struct NetworkIOThread::Batch {
+    std::vector<mmsghdr> messages;
+    std::vector<iovec> vectors;
+    std::vector<sockaddr_in> addresses;
+    std::vector<NetBuffer*> buffers;
+    NetBuffer discard;                  // Receive target when the game thread holds every buffer
+
+    explicit Batch(size_t size)
+        : messages(size), vectors(size), addresses(size), buffers(size) {}
+};
+
+namespace {
+
+uint64_t AddressKey(uint32_t ipv4, uint16_t port) {
+    return (static_cast<uint64_t>(ipv4) << 16) | port;
+}
+
+uint64_t SteadyNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+int CreateUdpSocket(int bufferBytes) {
+    const int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+    if (fd < 0) return -1;
+
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bufferBytes, sizeof(bufferBytes));
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bufferBytes, sizeof(bufferBytes));
+    return fd;
+}
+
+} // namespace
+
+bool NetworkIOThread::IsSupported() {
+    return true;
+}
+
+bool NetworkIOThread::Listen(uint16_t port) {
+    Stop();
+
+    const int fd = CreateUdpSocket(m_config.socketBufferBytes);
+    if (fd < 0) {
+        m_lastError = "Failed to create socket";
+        return false;
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = INADDR_ANY;
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        m_lastError = "Failed to bind socket";
+        close(fd);
+        return false;
+    }
+
+    return Start(fd, true);
+}
+
+bool NetworkIOThread::Connect(const std::string& address, uint16_t port) {
+    Stop();
+
+    sockaddr_in remote{};
+    remote.sin_family = AF_INET;
+    remote.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &remote.sin_addr) <= 0) {
+        addrinfo hints{};
+        addrinfo* result = nullptr;
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        if (getaddrinfo(address.c_str(), nullptr, &hints, &result) != 0 || !result) {
+            m_lastError = "Failed to resolve hostname";
+            return false;
+        }
+        remote.sin_addr = reinterpret_cast<sockaddr_in*>(result->ai_addr)->sin_addr;
+        freeaddrinfo(result);
+    }
+
+    const int fd = CreateUdpSocket(m_config.socketBufferBytes);
+    if (fd < 0) {
+        m_lastError = "Failed to create socket";
+        return false;
+    }
+
+    // Bind now so the local port is known before the first send
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = INADDR_ANY;
+    if (bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) < 0) {
+        m_lastError = "Failed to bind socket";
+        close(fd);
+        return false;
+    }
+
+    m_clientToAddress[0] = PeerAddress{remote.sin_addr.s_addr, remote.sin_port};
+    return Start(fd, false);
+}
+
+bool NetworkIOThread::Start(int socketFd, bool isServer) {
+    sockaddr_in local{};
+    socklen_t localLength = sizeof(local);
+    getsockname(socketFd, reinterpret_cast<sockaddr*>(&local), &localLength);
+    m_localPort = ntohs(local.sin_port);
+
+    m_socket = socketFd;
+    m_epoll = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_epoll < 0 || m_wakeEvent < 0) {
+        m_lastError = "Failed to create epoll instance";
+        Stop();
+        return false;
+    }
+
+    epoll_event socketEvent{};
+    socketEvent.events = EPOLLIN;
+    socketEvent.data.fd = m_socket;
+    epoll_event wakeEvent{};
+    wakeEvent.events = EPOLLIN;
+    wakeEvent.data.fd = m_wakeEvent;
+    if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_socket, &socketEvent) < 0 ||
+        epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wakeEvent, &wakeEvent) < 0) {
+        m_lastError = "Failed to register sockets with epoll";
+        Stop();
+        return false;
+    }
+
+    // Queues can hold a whole pool, so pushes never fail
+    const size_t count = m_config.bufferCount;
+    m_buffers = std::make_unique<NetBuffer[]>(count * 2);
+    m_outbound = std::make_unique<BoundedSPSCQueue<NetBuffer*>>(count);
+    m_outboundReturn = std::make_unique<BoundedSPSCQueue<NetBuffer*>>(count);
+    m_inbound = std::make_unique<BoundedSPSCQueue<NetBuffer*>>(count);
+    m_inboundReturn = std::make_unique<BoundedSPSCQueue<NetBuffer*>>(count);
+    m_sendFree.clear();
+    m_receiveFree.clear();
+    for (size_t i = 0; i < count; ++i) {
+        m_sendFree.push_back(&m_buffers[i]);
+        m_receiveFree.push_back(&m_buffers[count + i]);
+    }
+    m_sendQueue.clear();
+    m_sendQueue.reserve(count);
+    m_batch = std::make_unique<Batch>(m_config.batchSize);
+
+    m_isServer = isServer;
+    m_nextClientId = m_config.firstClientId;
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&NetworkIOThread::Run, this);
+    return true;
+}
+
+void NetworkIOThread::Stop() {
+    m_running.store(false, std::memory_order_release);
+    if (m_thread.joinable()) {
+        Wake();
+        m_thread.join();
+    }
+
+    if (m_socket >= 0) close(m_socket);
+    if (m_epoll >= 0) close(m_epoll);
+    if (m_wakeEvent >= 0) close(m_wakeEvent);
+    m_socket = -1;
+    m_epoll = -1;
+    m_wakeEvent = -1;
+
+    m_clientSlots.clear();
+    m_open.clear();
+    m_openSlots.clear();
+    m_sendFree.clear();
+    m_receiveFree.clear();
+    m_sendQueue.clear();
+    m_reassembly.clear();
+    m_reassemblyBytes = 0;
+    m_addressToClient.clear();
+    m_clientToAddress.clear();
+    m_nextEvictionNs = 0;
+    m_outbound.reset();
+    m_outboundReturn.reset();
+    m_inbound.reset();
+    m_inboundReturn.reset();
+    m_batch.reset();
+    m_buffers.reset();
+}
+
+void NetworkIOThread::Wake() {
+    const uint64_t one = 1;
+    if (write(m_wakeEvent, &one, sizeof(one)) < 0) {
+        // Counter already non-zero: the thread is awake anyway
+    }
+}
+
+// ============================================================================
+// I/O Thread (Linux)
+// ============================================================================
+
+void NetworkIOThread::Run() {
+    std::array<epoll_event, 4> events;
+    bool writeBlocked = false;
+
+    while (m_running.load(std::memory_order_acquire)) {
+        const int count = epoll_wait(m_epoll, events.data(), static_cast<int>(events.size()), -1);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        m_wakeups.fetch_add(1, std::memory_order_relaxed);
+
+        bool readable = false;
+        for (int i = 0; i < count; ++i) {
+            if (events[i].data.fd == m_wakeEvent) {
+                uint64_t value = 0;
+                if (read(m_wakeEvent, &value, sizeof(value)) < 0) {
+                    // Spurious wakeup
+                }
+            } else if (events[i].events & (EPOLLIN | EPOLLERR)) {
+                readable = true;
+            }
+        }
+
+        SendPending();
+        if (readable) {
+            ReceiveAll();
+        }
+
+        // Watch for writability only while the kernel send buffer is full
+        if (writeBlocked != !m_sendQueue.empty()) {
+            writeBlocked = !m_sendQueue.empty();
+            epoll_event socketEvent{};
+            socketEvent.events = EPOLLIN | (writeBlocked ? EPOLLOUT : 0u);
+            socketEvent.data.fd = m_socket;
+            epoll_ctl(m_epoll, EPOLL_CTL_MOD, m_socket, &socketEvent);
+        }
+    }
+}
+
+void NetworkIOThread::SendPending() {
+    NetBuffer* queued = nullptr;
+    while (m_outbound->TryPop(queued)) {
+        m_sendQueue.push_back(queued);
+    }
+
+    Batch& batch = *m_batch;
+    size_t next = 0;
+    while (next < m_sendQueue.size()) {
+        // Fill one batch, dropping datagrams for peers we never heard from
+        size_t count = 0;
+        while (count < batch.messages.size() && next < m_sendQueue.size()) {
+            NetBuffer* buffer = m_sendQueue[next++];
+            auto it = m_clientToAddress.find(buffer->clientId);
+            if (it == m_clientToAddress.end()) {
+                m_ioSendDropped.fetch_add(1, std::memory_order_relaxed);
+                m_outboundReturn->TryPush(buffer);
+                continue;
+            }
+
+            sockaddr_in& addr = batch.addresses[count];
+            addr = sockaddr_in{};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = it->second.ipv4;
+            addr.sin_port = it->second.port;
+
+            batch.vectors[count] = iovec{buffer->data.data(), buffer->size};
+            mmsghdr& message = batch.messages[count];
+            message = mmsghdr{};
+            message.msg_hdr.msg_name = &addr;
+            message.msg_hdr.msg_namelen = sizeof(addr);
+            message.msg_hdr.msg_iov = &batch.vectors[count];
+            message.msg_hdr.msg_iovlen = 1;
+            batch.buffers[count] = buffer;
+            ++count;
+        }
+        if (count == 0) break;
+
+        const int sent = sendmmsg(m_socket, batch.messages.data(), static_cast<unsigned int>(count), 0);
+        m_sendCalls.fetch_add(1, std::memory_order_relaxed);
+        size_t done = 0;
+        bool blocked = false;
+        if (sent > 0) {
+            done = static_cast<size_t>(sent);
+            uint64_t bytes = 0;
+            for (size_t i = 0; i < done; ++i) {
+                bytes += batch.buffers[i]->size;
+                m_outboundReturn->TryPush(batch.buffers[i]);
+            }
+            m_datagramsSent.fetch_add(done, std::memory_order_relaxed);
+            m_bytesSent.fetch_add(bytes, std::memory_order_relaxed);
+            blocked = done < count;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+            blocked = true;
+        } else {
+            // The first datagram failed (e.g. ICMP unreachable): drop it and go on
+            m_ioSendDropped.fetch_add(1, std::memory_order_relaxed);
+            m_outboundReturn->TryPush(batch.buffers[0]);
+            done = 1;
+        }
+
+        if (done < count) {
+            // Put the rest back (in order) just before the unbatched tail
+            const size_t unsent = count - done;
+            std::copy(batch.buffers.begin() + static_cast<std::ptrdiff_t>(done),
+                      batch.buffers.begin() + static_cast<std::ptrdiff_t>(count),
+                      m_sendQueue.begin() + static_cast<std::ptrdiff_t>(next - unsent));
+            next -= unsent;
+        }
+        if (blocked) {
+            break;      // Kernel send buffer full: resume on EPOLLOUT
+        }
+    }
+
+    m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + static_cast<std::ptrdiff_t>(next));
+}
+
+void NetworkIOThread::ReceiveAll() {
+    Batch& batch = *m_batch;
+
+    for (;;) {
+        NetBuffer* returned = nullptr;
+        while (m_inboundReturn->TryPop(returned)) {
+            m_receiveFree.push_back(returned);
+        }
+
+        const bool discarding = m_receiveFree.empty();
+        const size_t count = discarding ? 1 : std::min(batch.messages.size(), m_receiveFree.size());
+        for (size_t i = 0; i < count; ++i) {
+            NetBuffer* buffer = discarding ? &batch.discard : m_receiveFree[m_receiveFree.size() - 1 - i];
+            batch.buffers[i] = buffer;
+            batch.vectors[i] = iovec{buffer->data.data(), buffer->data.size()};
+            mmsghdr& message = batch.messages[i];
+            message = mmsghdr{};
+            message.msg_hdr.msg_name = &batch.addresses[i];
+            message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            message.msg_hdr.msg_iov = &batch.vectors[i];
+            message.msg_hdr.msg_iovlen = 1;
+        }
+
+        const int received = recvmmsg(m_socket, batch.messages.data(), static_cast<unsigned int>(count),
+                                      MSG_DONTWAIT, nullptr);
+        if (received <= 0) break;
+        m_receiveCalls.fetch_add(1, std::memory_order_relaxed);
+
+        if (discarding) {
+            m_receiveDropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        const uint64_t now = SteadyNowNs();
+        uint64_t bytes = 0;
+        uint64_t delivered = 0;
+        m_receiveFree.resize(m_receiveFree.size() - count);
+        for (size_t i = 0; i < count; ++i) {
+            NetBuffer* buffer = batch.buffers[i];
+            const mmsghdr& message = batch.messages[i];
+            if (i >= static_cast<size_t>(received) || (message.msg_hdr.msg_flags & MSG_TRUNC)) {
+                m_receiveFree.push_back(buffer);
+                continue;
+            }
+
+            buffer->size = message.msg_len;
+            buffer->receiveTimeNs = now;
+            buffer->clientId = 0;
+            if (m_isServer) {
+                const sockaddr_in& from = batch.addresses[i];
+                if (!ResolveClient(PeerAddress{from.sin_addr.s_addr, from.sin_port}, now, buffer->clientId)) {
+                    m_receiveFree.push_back(buffer);
+                    continue;
+                }
+            }
+            bytes += message.msg_len;
+            delivered++;
+            m_inbound->TryPush(buffer);
+        }
+        m_datagramsReceived.fetch_add(delivered, std::memory_order_relaxed);
+        m_bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+
+        if (static_cast<size_t>(received) < count) break;   // Socket drained
+    }
+}
+
+bool NetworkIOThread::ResolveClient(const PeerAddress& address, uint64_t nowNs, uint32_t& clientId) {
+    const uint64_t key = AddressKey(address.ipv4, address.port);
+    auto it = m_addressToClient.find(key);
+    if (it != m_addressToClient.end()) {
+        it->second.lastHeardNs = nowNs;
+        clientId = it->second.clientId;
+        return true;
+    }
+
+    // Spoofed source addresses must not grow the table without bound
+    if (m_addressToClient.size() >= m_config.maxPeers && !EvictIdlePeers(nowNs)) {
+        m_peersRefused.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    clientId = m_nextClientId++;
+    m_addressToClient.emplace(key, PeerState{clientId, nowNs});
+    m_clientToAddress.emplace(clientId, address);
+    return true;
+}
+
+bool NetworkIOThread::EvictIdlePeers(uint64_t nowNs) {
+    if (nowNs < m_nextEvictionNs) {
+        return false;
+    }
+
+    const uint64_t timeoutNs = static_cast<uint64_t>(m_config.peerIdleTimeoutMs) * 1'000'000;
+    uint64_t oldestKept = nowNs;
+    bool evicted = false;
+    for (auto it = m_addressToClient.begin(); it != m_addressToClient.end();) {
+        if (nowNs - it->second.lastHeardNs >= timeoutNs) {
+            m_clientToAddress.erase(it->second.clientId);
+            it = m_addressToClient.erase(it);
+            m_peersEvicted.fetch_add(1, std::memory_order_relaxed);
+            evicted = true;
+        } else {
+            oldestKept = std::min(oldestKept, it->second.lastHeardNs);
+            ++it;
+        }
+    }
+
+    // Skip rescanning until the quietest remaining peer could have timed out
+    m_nextEvictionNs = evicted ? 0 : oldestKept + timeoutNs;
+    return evicted;
+}
+
+#else
+
+// ============================================================================
+// Unsupported Platforms
+// ============================================================================
+
+struct NetworkIOThread::Batch {};
+
+bool NetworkIOThread::IsSupported() {
+    return false;
+}
+
+bool NetworkIOThread::Listen(uint16_t) {
+    m_lastError = "NetworkIOThread requires Linux";
+    return false;
+}
+
+bool NetworkIOThread::Connect(const std::string&, uint16_t) {
+    m_lastError = "NetworkIOThread requires Linux";
+    return false;
+}
+
+bool NetworkIOThread::Start(int, bool) {
+    return false;
+}
+
+void NetworkIOThread::Stop() {}
+void NetworkIOThread::Wake() {}
+void NetworkIOThread::Run() {}
+void NetworkIOThread::SendPending() {}
+void NetworkIOThread::ReceiveAll() {}
+
+bool NetworkIOThread::ResolveClient(const PeerAddress&, uint64_t, uint32_t&) {
+    return false;
+}
+
+bool NetworkIOThread::EvictIdlePeers(uint64_t) {
+    return false;
+}
+
+#endif
+
+} // namespace Nova
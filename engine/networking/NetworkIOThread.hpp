@@ -0,0 +1,301 @@
+#pragma once
+
+#include "../core/WorkStealingDeque.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+
+/**
+ * @brief Configuration for the network I/O thread
+ */
+struct NetIOConfig {
+    size_t datagramSize = 1200;         // Coalescing target per datagram (below the path MTU)
+    size_t bufferCount = 1024;          // Pooled buffers per direction
+    size_t batchSize = 64;              // Datagrams per recvmmsg / sendmmsg call
+    uint32_t firstClientId = 1;         // ID given to the first peer a server hears from
+    int socketBufferBytes = 4 << 20;    // SO_RCVBUF / SO_SNDBUF request
+    size_t maxPeers = 4096;             // Server: peer addresses tracked at once
+    uint32_t peerIdleTimeoutMs = 30000; // Server: a full peer table forgets peers silent this long
+    size_t maxReassemblyBytes = 4 << 20;  // Partially received fragmented messages, all peers
+};
+
+/**
+ * @brief Pooled datagram buffer handed between the game thread and the I/O thread
+ */
+struct NetBuffer {
+    static constexpr size_t kCapacity = 1472;  // Largest UDP payload in a 1500 byte Ethernet frame
+
+    uint32_t clientId = 0;              // Peer the datagram came from / goes to
+    uint32_t size = 0;
+    uint64_t receiveTimeNs = 0;         // steady_clock time the I/O thread received it (inbound only)
+    std::array<uint8_t, kCapacity> data;
+};
+
+// ============================================================================
+// Network I/O Thread - Batched UDP on a Dedicated Thread
+// ============================================================================
+
+/**
+ * @brief Owns a UDP socket and drives it from a dedicated thread through epoll
+ *
+ * The game thread never makes a socket call. Send() appends a message to
+ * that client's open datagram (a 2 byte length prefix per message), so the
+ * many small events of one tick leave as a few MTU-sized datagrams; a
+ * datagram is handed over when the next message would not fit and on
+ * Flush(), which also wakes the I/O thread. The I/O thread sends everything
+ * queued with sendmmsg and reads with recvmmsg, up to batchSize datagrams
+ * per syscall, and hands received datagrams back through a lock-free queue.
+ * Poll() returns them in arrival order; ReadMessages() splits one into
+ * messages and Release() returns it to the pool.
+ *
+ * Buffers come from two fixed pools (one per direction) and travel only
+ * through single-producer single-consumer queues, so steady-state traffic
+ * allocates nothing and takes no locks. When the game thread falls behind,
+ * the I/O thread drops incoming datagrams (as a full socket buffer would)
+ * instead of blocking.
+ *
+ * Messages up to kMaxMessageSize travel in one datagram. Larger ones (up to
+ * kMaxFragmentedMessageSize) are split into one fragment per datagram and
+ * put back together by ReadMessages(); a fragmented message is lost as a
+ * whole if any fragment is.
+ *
+ * A server (Listen) gives every new peer address the next client ID; a
+ * client (Connect) sees all traffic as client 0 and sends to client 0. The
+ * server tracks at most maxPeers addresses: when the table is full, peers
+ * idle for peerIdleTimeoutMs are forgotten, and datagrams from new
+ * addresses are dropped while none are.
+ * Send/Flush/Poll/Release must be called from one thread. Only available
+ * on Linux (IsSupported()); elsewhere Listen/Connect fail.
+ */
+class NetworkIOThread {
+public:
+    static constexpr size_t kFrameHeaderSize = 2;
+    static constexpr size_t kMaxMessageSize = NetBuffer::kCapacity - kFrameHeaderSize;  // One datagram
+
+    // Fragment frames set kFragmentFlag in their length and start with
+    // message ID (u16), fragment index and fragment count
+    static constexpr uint16_t kFragmentFlag = 0x8000;
+    static constexpr size_t kFragmentHeaderSize = 4;
+    static constexpr size_t kFragmentChunkSize = kMaxMessageSize - kFragmentHeaderSize;
+    static constexpr size_t kMaxFragments = 64;
+    static constexpr size_t kMaxFragmentedMessageSize = kFragmentChunkSize * kMaxFragments;
+
+    /**
+     * @brief Cumulative counters (messages are Send() calls, datagrams are wire packets)
+     */
+    struct Stats {
+        uint64_t messagesSent = 0;
+        uint64_t datagramsSent = 0;
+        uint64_t bytesSent = 0;
+        uint64_t sendCalls = 0;         // sendmmsg syscalls
+        uint64_t datagramsReceived = 0;
+        uint64_t bytesReceived = 0;
+        uint64_t receiveCalls = 0;      // recvmmsg syscalls
+        uint64_t wakeups = 0;           // epoll_wait returns
+        uint64_t sendDropped = 0;       // Messages dropped (no buffer, too large, unknown client)
+        uint64_t receiveDropped = 0;    // Datagrams dropped because the game thread fell behind
+        uint64_t messagesFragmented = 0;    // Sent messages split across datagrams
+        uint64_t messagesReassembled = 0;   // Fragmented messages delivered by ReadMessages()
+        uint64_t fragmentsDropped = 0;      // Malformed, superseded or over the reassembly budget
+        uint64_t peersEvicted = 0;      // Idle peers forgotten to make room (server)
+        uint64_t peersRefused = 0;      // Datagrams from new addresses dropped at maxPeers (server)
+    };
+
+    explicit NetworkIOThread(const NetIOConfig& config = NetIOConfig{});
+    ~NetworkIOThread();
+
+    NetworkIOThread(const NetworkIOThread&) = delete;
+    NetworkIOThread& operator=(const NetworkIOThread&) = delete;
+
+    [[nodiscard]] static bool IsSupported();
+
+    /**
+     * @brief Bind to a port (0 = any free port) and start the thread as a server
+     */
+    bool Listen(uint16_t port);
+
+    /**
+     * @brief Start the thread as a client of address:port (IPv4 literal or host name)
+     */
+    bool Connect(const std::string& address, uint16_t port);
+
+    /**
+     * @brief Stop the thread and close the socket (unsent datagrams are discarded)
+     */
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+    [[nodiscard]] uint16_t GetLocalPort() const { return m_localPort; }
+    [[nodiscard]] const std::string& GetLastError() const { return m_lastError; }
+
+    // =========================================================================
+    // Game Thread
+    // =========================================================================
+
+    /**
+     * @brief Queue a message for a client (header and payload are sent as one message)
+     * @return false if the message exceeds kMaxFragmentedMessageSize or no buffer is free
+     */
+    bool Send(uint32_t clientId, std::span<const uint8_t> payload);
+    bool Send(uint32_t clientId, std::span<const uint8_t> header, std::span<const uint8_t> payload);
+
+    /**
+     * @brief Hand every open datagram to the I/O thread and wake it
+     */
+    void Flush();
+
+    /**
+     * @brief Next received datagram, or nullptr (give it back with Release())
+     */
+    NetBuffer* Poll();
+    void Release(NetBuffer* buffer);
+
+    /**
+     * @brief Call fn(std::span<const uint8_t>) for each message of a datagram
+     * @return false if the datagram is malformed (messages before the error are delivered)
+     */
+    template<typename Fn>
+    static bool ForEachMessage(const NetBuffer& buffer, Fn&& fn) {
+        return ForEachFrame(buffer, [&fn](std::span<const uint8_t> frame, bool fragment) {
+            if (!fragment) fn(frame);
+        });
+    }
+
+    /**
+     * @brief ForEachMessage() that also reassembles fragmented messages (game thread)
+     *
+     * A fragmented message is delivered with the datagram that completes it;
+     * the span is valid until the next call.
+     */
+    template<typename Fn>
+    bool ReadMessages(const NetBuffer& buffer, Fn&& fn) {
+        return ForEachFrame(buffer, [this, &buffer, &fn](std::span<const uint8_t> frame, bool fragment) {
+            if (!fragment) {
+                fn(frame);
+            } else if (const std::span<const uint8_t> message = Reassemble(buffer.clientId, frame, buffer.receiveTimeNs);
+                       !message.empty()) {
+                fn(message);
+            }
+        });
+    }
+
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    struct Batch;
+
+    struct PeerAddress {
+        uint32_t ipv4 = 0;              // Network byte order
+        uint16_t port = 0;              // Network byte order
+    };
+
+    struct PeerState {
+        uint32_t clientId = 0;
+        uint64_t lastHeardNs = 0;
+    };
+
+    // Fragments of one message from one peer
+    struct Reassembly {
+        uint16_t messageId = 0;
+        uint8_t count = 0;
+        uint8_t received = 0;
+        uint64_t receivedMask = 0;      // Bit per fragment index
+        size_t size = 0;                // Known once the last fragment arrived
+        uint64_t startedNs = 0;
+        std::vector<uint8_t> data;
+    };
+
+    template<typename Fn>
+    static bool ForEachFrame(const NetBuffer& buffer, Fn&& fn) {
+        size_t offset = 0;
+        while (offset < buffer.size) {
+            if (buffer.size - offset < kFrameHeaderSize) return false;
+            const size_t field = buffer.data[offset] | (static_cast<size_t>(buffer.data[offset + 1]) << 8);
+            const size_t length = field & ~static_cast<size_t>(kFragmentFlag);
+            offset += kFrameHeaderSize;
+            if (length > buffer.size - offset) return false;
+            fn(std::span<const uint8_t>(buffer.data.data() + offset, length), (field & kFragmentFlag) != 0);
+            offset += length;
+        }
+        return true;
+    }
+
+    bool Start(int socketFd, bool isServer);
+    bool QueueFrame(uint32_t clientId, uint16_t flags, std::span<const uint8_t> header, std::span<const uint8_t> payload);
+    std::span<const uint8_t> Reassemble(uint32_t clientId, std::span<const uint8_t> frame, uint64_t nowNs);
+    NetBuffer* AcquireSendBuffer();
+    void Wake();
+    void Run();
+    void SendPending();
+    void ReceiveAll();
+    bool ResolveClient(const PeerAddress& address, uint64_t nowNs, uint32_t& clientId);
+    bool EvictIdlePeers(uint64_t nowNs);
+
+    NetIOConfig m_config;
+    std::string m_lastError;
+    uint16_t m_localPort = 0;
+    bool m_isServer = false;
+
+    int m_socket = -1;
+    int m_epoll = -1;
+    int m_wakeEvent = -1;
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+
+    // Buffer pools: outbound buffers are owned by the game thread until queued,
+    // inbound buffers by the I/O thread until delivered; each side gets its
+    // buffers back through a return queue.
+    std::unique_ptr<NetBuffer[]> m_buffers;
+    std::unique_ptr<BoundedSPSCQueue<NetBuffer*>> m_outbound;        // Game -> I/O: datagrams to send
+    std::unique_ptr<BoundedSPSCQueue<NetBuffer*>> m_outboundReturn;  // I/O -> game: sent buffers
+    std::unique_ptr<BoundedSPSCQueue<NetBuffer*>> m_inbound;         // I/O -> game: received datagrams
+    std::unique_ptr<BoundedSPSCQueue<NetBuffer*>> m_inboundReturn;   // Game -> I/O: released buffers
+
+    // Game thread
+    std::vector<NetBuffer*> m_sendFree;
+    std::unordered_map<uint32_t, uint32_t> m_clientSlots;   // Client ID -> index in m_open
+    std::vector<NetBuffer*> m_open;                         // Open datagram per slot (or nullptr)
+    std::vector<uint32_t> m_openSlots;                      // Slots with an open datagram
+    uint64_t m_messagesSent = 0;
+    uint64_t m_sendDropped = 0;
+    uint64_t m_messagesFragmented = 0;
+    uint16_t m_nextFragmentId = 0;
+    std::vector<uint8_t> m_fragmentScratch;                 // Header + payload of a message being split
+    std::unordered_map<uint32_t, Reassembly> m_reassembly;  // By client ID
+    size_t m_reassemblyBytes = 0;
+    std::vector<uint8_t> m_reassembled;                     // Last completed fragmented message
+    uint64_t m_messagesReassembled = 0;
+    uint64_t m_fragmentsDropped = 0;
+
+    // I/O thread
+    std::vector<NetBuffer*> m_receiveFree;
+    std::vector<NetBuffer*> m_sendQueue;
+    std::unordered_map<uint64_t, PeerState> m_addressToClient;
+    std::unordered_map<uint32_t, PeerAddress> m_clientToAddress;
+    uint32_t m_nextClientId = 1;
+    uint64_t m_nextEvictionNs = 0;      // No peer can be idle long enough before this
+    std::unique_ptr<Batch> m_batch;
+
+    std::atomic<uint64_t> m_datagramsSent{0};
+    std::atomic<uint64_t> m_bytesSent{0};
+    std::atomic<uint64_t> m_sendCalls{0};
+    std::atomic<uint64_t> m_ioSendDropped{0};
+    std::atomic<uint64_t> m_datagramsReceived{0};
+    std::atomic<uint64_t> m_bytesReceived{0};
+    std::atomic<uint64_t> m_receiveCalls{0};
+    std::atomic<uint64_t> m_wakeups{0};
+    std::atomic<uint64_t> m_receiveDropped{0};
+    std::atomic<uint64_t> m_peersEvicted{0};
+    std::atomic<uint64_t> m_peersRefused{0};
+};
+
+} // namespace Nova
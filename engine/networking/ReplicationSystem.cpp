@@ -1,5 +1,8 @@
 #include "ReplicationSystem.hpp"
 #include "FirebaseClient.hpp"
+#include "InterestManager.hpp"
+#include "NetworkIOThread.hpp"
+#include "SnapshotDelta.hpp"
 #include <algorithm>
 #include <sstream>
 #include <cstring>
@@ -54,171 +57,6 @@ public:
     virtual bool IsRelevantTo(uint32_t clientId) const = 0;
 };
 
-// ============================================================================
-// DeltaCompressor - Bandwidth Optimization
-// ============================================================================
-
-class DeltaCompressor {
-public:
-    struct CompressionStats {
-        uint64_t bytesBeforeCompression = 0;
-        uint64_t bytesAfterCompression = 0;
-        uint64_t deltasCompressed = 0;
-        float compressionRatio = 1.0f;
-    };
-
-    static std::vector<uint8_t> CompressDelta(
-        const std::vector<uint8_t>& oldState,
-        const std::vector<uint8_t>& newState
-    ) {
-        std::vector<uint8_t> delta;
-        delta.reserve(newState.size());
-
-        // Header: delta encoding marker
-        delta.push_back(0xDE);
-        delta.push_back(0x17);
-        delta.push_back(0xA0);
-
-        // Write original size
-        uint32_t origSize = static_cast<uint32_t>(newState.size());
-        delta.push_back(static_cast<uint8_t>(origSize & 0xFF));
-        delta.push_back(static_cast<uint8_t>((origSize >> 8) & 0xFF));
-        delta.push_back(static_cast<uint8_t>((origSize >> 16) & 0xFF));
-        delta.push_back(static_cast<uint8_t>((origSize >> 24) & 0xFF));
-
-        size_t minSize = std::min(oldState.size(), newState.size());
-        size_t runStart = 0;
-        bool inCopyRun = false;
-
-        for (size_t i = 0; i < newState.size(); ++i) {
-            bool same = (i < minSize && oldState[i] == newState[i]);
-
-            if (same && !inCopyRun) {
-                // Start skip run
-                if (i > runStart) {
-                    // Flush copy run
-                    WriteCopyRun(delta, newState, runStart, i - runStart);
-                }
-                runStart = i;
-            } else if (!same && inCopyRun) {
-                // End skip run, start copy run
-                if (i > runStart) {
-                    WriteSkipRun(delta, i - runStart);
-                }
-                runStart = i;
-                inCopyRun = false;
-            } else if (same) {
-                inCopyRun = true;
-            }
-        }
-
-        // Flush remaining
-        if (runStart < newState.size()) {
-            if (inCopyRun) {
-                WriteSkipRun(delta, newState.size() - runStart);
-            } else {
-                WriteCopyRun(delta, newState, runStart, newState.size() - runStart);
-            }
-        }
-
-        // If delta is larger than original, just send original
-        if (delta.size() >= newState.size()) {
-            delta.clear();
-            delta.push_back(0x00); // Full state marker
-            delta.insert(delta.end(), newState.begin(), newState.end());
-        }
-
-        return delta;
-    }
-
-    static std::vector<uint8_t> DecompressDelta(
-        const std::vector<uint8_t>& oldState,
-        const std::vector<uint8_t>& delta
-    ) {
-        if (delta.empty()) return oldState;
-
-        // Check for full state marker
-        if (delta[0] == 0x00) {
-            return std::vector<uint8_t>(delta.begin() + 1, delta.end());
-        }
-
-        // Check delta header
-        if (delta.size() < 7 || delta[0] != 0xDE || delta[1] != 0x17 || delta[2] != 0xA0) {
-            return delta; // Invalid delta, return as-is
-        }
-
-        uint32_t origSize = delta[3] | (delta[4] << 8) | (delta[5] << 16) | (delta[6] << 24);
-        std::vector<uint8_t> result;
-        result.reserve(origSize);
-
-        size_t offset = 7;
-        size_t oldOffset = 0;
-
-        while (offset < delta.size() && result.size() < origSize) {
-            uint8_t cmd = delta[offset++];
-            uint8_t type = (cmd >> 6) & 0x03;
-            uint32_t length = cmd & 0x3F;
-
-            if (length == 0x3F && offset < delta.size()) {
-                // Extended length
-                length = delta[offset++];
-                if (offset < delta.size()) {
-                    length |= (static_cast<uint32_t>(delta[offset++]) << 8);
-                }
-            }
-
-            if (type == 0) {
-                // Skip: copy from old state
-                for (uint32_t i = 0; i < length && oldOffset < oldState.size(); ++i) {
-                    result.push_back(oldState[oldOffset++]);
-                }
-            } else if (type == 1) {
-                // Copy: read new bytes
-                for (uint32_t i = 0; i < length && offset < delta.size(); ++i) {
-                    result.push_back(delta[offset++]);
-                    oldOffset++;
-                }
-            }
-        }
-
-        return result;
-    }
-
-    CompressionStats GetStats() const { return m_stats; }
-    void ResetStats() { m_stats = CompressionStats{}; }
-
-private:
-    static void WriteSkipRun(std::vector<uint8_t>& delta, size_t length) {
-        while (length > 0) {
-            if (length <= 62) {
-                delta.push_back(static_cast<uint8_t>(length)); // type 0 (skip)
-                break;
-            } else {
-                delta.push_back(0x3F); // type 0, extended
-                uint16_t len = static_cast<uint16_t>(std::min(length, size_t(65535)));
-                delta.push_back(static_cast<uint8_t>(len & 0xFF));
-                delta.push_back(static_cast<uint8_t>((len >> 8) & 0xFF));
-                length -= len;
-            }
-        }
-    }
-
-    static void WriteCopyRun(std::vector<uint8_t>& delta, const std::vector<uint8_t>& data,
-                             size_t start, size_t length) {
-        while (length > 0) {
-            size_t chunkLen = std::min(length, size_t(62));
-            delta.push_back(static_cast<uint8_t>(0x40 | chunkLen)); // type 1 (copy)
-            for (size_t i = 0; i < chunkLen; ++i) {
-                delta.push_back(data[start + i]);
-            }
-            start += chunkLen;
-            length -= chunkLen;
-        }
-    }
-
-    CompressionStats m_stats;
-};
-
 // ============================================================================
 // ReplicationChannel - Network Transport (TCP/UDP)
 // ============================================================================
@@ -241,6 +79,7 @@ public:
     };
 
     struct Packet {
+        uint32_t clientId = 0;
         uint32_t sequenceNumber = 0;
         uint32_t ackNumber = 0;
         uint32_t ackBitfield = 0;
@@ -250,6 +89,16 @@ public:
         bool needsAck = false;
     };
 
+    /**
+     * @brief Payload of one received packet (reliability header stripped)
+     */
+    struct ReceivedPacket {
+        uint32_t clientId = 0;
+        std::vector<uint8_t> data;
+    };
+
+    static constexpr size_t kPacketHeaderSize = 13;
+
     ReplicationChannel(Protocol protocol = Protocol::UDP)
         : m_protocol(protocol), m_socket(INVALID_SOCK) {}
 
@@ -260,6 +109,20 @@ public:
     bool Listen(uint16_t port) {
         if (!InitializeSockets()) return false;
 
+        if (m_protocol == Protocol::UDP && NetworkIOThread::IsSupported()) {
+            m_io = std::make_unique<NetworkIOThread>();
+            if (!m_io->Listen(port)) {
+                m_lastError = m_io->GetLastError();
+                m_state = State::Error;
+                m_io.reset();
+                return false;
+            }
+            m_port = port;
+            m_state = State::Connected;
+            m_isServer = true;
+            return true;
+        }
+
         m_socket = socket(AF_INET,
             m_protocol == Protocol::TCP ? SOCK_STREAM : SOCK_DGRAM,
             m_protocol == Protocol::TCP ? IPPROTO_TCP : IPPROTO_UDP);
@@ -308,6 +171,19 @@ public:
     bool Connect(const std::string& address, uint16_t port) {
         if (!InitializeSockets()) return false;
 
+        if (m_protocol == Protocol::UDP && NetworkIOThread::IsSupported()) {
+            m_io = std::make_unique<NetworkIOThread>();
+            if (!m_io->Connect(address, port)) {
+                m_lastError = m_io->GetLastError();
+                m_state = State::Error;
+                m_io.reset();
+                return false;
+            }
+            m_state = State::Connected;
+            m_isServer = false;
+            return true;
+        }
+
         m_socket = socket(AF_INET,
             m_protocol == Protocol::TCP ? SOCK_STREAM : SOCK_DGRAM,
             m_protocol == Protocol::TCP ? IPPROTO_TCP : IPPROTO_UDP);
@@ -368,6 +244,10 @@ public:
     }
 
     void Close() {
+        if (m_io) {
+            m_io->Stop();
+            m_io.reset();
+        }
         if (m_socket != INVALID_SOCK) {
             CLOSE_SOCKET(m_socket);
             m_socket = INVALID_SOCK;
@@ -379,57 +259,48 @@ public:
         m_state = State::Disconnected;
     }
 
-    bool Send(const std::vector<uint8_t>& data, uint32_t clientId = 0, bool reliable = true) {
+    bool Send(std::span<const uint8_t> data, uint32_t clientId = 0, bool reliable = true) {
         if (m_state != State::Connected) return false;
 
         Packet packet;
+        packet.clientId = clientId;
         packet.sequenceNumber = m_nextSequence++;
         packet.ackNumber = m_lastReceivedSeq;
         packet.ackBitfield = m_ackBitfield;
-        packet.data = data;
         packet.reliable = reliable;
         packet.sendTime = GetCurrentTimeMs();
 
-        std::vector<uint8_t> packetData = SerializePacket(packet);
-
-        bool success = false;
-        if (m_protocol == Protocol::TCP) {
-            SocketType targetSocket = m_socket;
-            if (m_isServer && clientId != 0) {
-                auto it = m_clientSockets.find(clientId);
-                if (it != m_clientSockets.end()) {
-                    targetSocket = it->second;
-                }
-            }
-            success = SendTCP(targetSocket, packetData);
-        } else {
-            if (m_isServer && clientId != 0) {
-                auto it = m_clientAddresses.find(clientId);
-                if (it != m_clientAddresses.end()) {
-                    success = SendUDP(packetData, it->second);
-                }
-            } else {
-                success = SendUDP(packetData, m_remoteAddr);
-            }
+        if (!Transmit(packet, data)) {
+            return false;
         }
 
-        if (success) {
-            m_stats.packetsSent++;
-            m_stats.bytesOut += packetData.size();
+        m_stats.packetsSent++;
+        m_stats.bytesOut += kPacketHeaderSize + data.size();
 
-            if (reliable) {
-                m_pendingAcks[packet.sequenceNumber] = packet;
-            }
+        if (reliable) {
+            packet.data.assign(data.begin(), data.end());
+            m_pendingAcks[packet.sequenceNumber] = std::move(packet);
         }
+        return true;
+    }
 
-        return success;
+    /**
+     * @brief Hand everything sent this tick to the network thread (UDP on Linux)
+     */
+    void Flush() {
+        if (m_io) {
+            m_io->Flush();
+        }
     }
 
-    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> Receive() {
-        std::vector<std::pair<uint32_t, std::vector<uint8_t>>> received;
+    /**
+     * @brief Packets received since the last call (valid until the next call)
+     */
+    std::span<const ReceivedPacket> Receive() {
+        m_receivedCount = 0;
 
         if (m_state != State::Connected && m_state != State::Connecting) {
-            return received;
+            return {};
         }
 
         // Check for connection completion (TCP)
@@ -460,15 +331,12 @@ public:
         }
 
         // Receive data
-        if (m_protocol == Protocol::TCP) {
-            received = ReceiveTCP();
+        if (m_io) {
+            ReceiveIO();
+        } else if (m_protocol == Protocol::TCP) {
+            ReceiveTCP();
         } else {
-            received = ReceiveUDP();
-        }
-
-        // Process acknowledgments
-        for (const auto& [clientId, data] : received) {
-            ProcessAcknowledgments(data);
+            ReceiveUDP();
         }
 
         // Resend unacked reliable packets
@@ -477,7 +345,7 @@ public:
         // Update stats
         UpdateStats();
 
-        return received;
+        return {m_received.data(), m_receivedCount};
     }
 
     State GetState() const { return m_state; }
@@ -486,7 +354,7 @@ public:
     Protocol GetProtocol() const { return m_protocol; }
 
     std::vector<uint32_t> GetConnectedClients() const {
-        std::vector<uint32_t> clients;
+        std::vector<uint32_t> clients(m_ioClients.begin(), m_ioClients.end());
         for (const auto& [id, _] : m_clientSockets) {
             clients.push_back(id);
         }
@@ -561,63 +429,46 @@ private:
         }
     }
 
-    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> ReceiveTCP() {
-        std::vector<std::pair<uint32_t, std::vector<uint8_t>>> received;
-
-        auto receiveFromSocket = [this](SocketType sock, uint32_t clientId)
-            -> std::optional<std::vector<uint8_t>> {
+    void ReceiveTCP() {
+        auto receiveFromSocket = [this](SocketType sock, uint32_t clientId) {
             // Read length prefix
             uint8_t lenBuf[4];
             int bytesRead = recv(sock, reinterpret_cast<char*>(lenBuf), 4, MSG_PEEK);
-            if (bytesRead < 4) return std::nullopt;
+            if (bytesRead < 4) return;
 
             uint32_t len = lenBuf[0] | (lenBuf[1] << 8) | (lenBuf[2] << 16) | (lenBuf[3] << 24);
-            if (len > 65536) return std::nullopt; // Sanity check
+            if (len > 65536) return; // Sanity check
 
-            std::vector<uint8_t> buffer(4 + len);
-            bytesRead = recv(sock, reinterpret_cast<char*>(buffer.data()),
-                static_cast<int>(buffer.size()), 0);
+            m_receiveBuffer.resize(4 + len);
+            bytesRead = recv(sock, reinterpret_cast<char*>(m_receiveBuffer.data()),
+                static_cast<int>(m_receiveBuffer.size()), 0);
 
-            if (bytesRead == static_cast<int>(buffer.size())) {
-                m_stats.packetsReceived++;
-                m_stats.bytesIn += bytesRead;
-                return std::vector<uint8_t>(buffer.begin() + 4, buffer.end());
+            if (bytesRead == static_cast<int>(m_receiveBuffer.size())) {
+                DeliverPacket(clientId, std::span<const uint8_t>(m_receiveBuffer).subspan(4));
             }
-            return std::nullopt;
         };
 
         if (m_isServer) {
             for (const auto& [clientId, sock] : m_clientSockets) {
-                if (auto data = receiveFromSocket(sock, clientId)) {
-                    received.emplace_back(clientId, std::move(*data));
-                }
+                receiveFromSocket(sock, clientId);
             }
         } else {
-            if (auto data = receiveFromSocket(m_socket, 0)) {
-                received.emplace_back(0, std::move(*data));
-            }
+            receiveFromSocket(m_socket, 0);
         }
-
-        return received;
     }
 
-    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> ReceiveUDP() {
-        std::vector<std::pair<uint32_t, std::vector<uint8_t>>> received;
-
-        std::vector<uint8_t> buffer(65536);
+    void ReceiveUDP() {
+        m_receiveBuffer.resize(65536);
         sockaddr_in senderAddr{};
         socklen_t addrLen = sizeof(senderAddr);
 
         while (true) {
-            int bytesRead = recvfrom(m_socket, reinterpret_cast<char*>(buffer.data()),
-                static_cast<int>(buffer.size()), 0,
+            int bytesRead = recvfrom(m_socket, reinterpret_cast<char*>(m_receiveBuffer.data()),
+                static_cast<int>(m_receiveBuffer.size()), 0,
                 reinterpret_cast<sockaddr*>(&senderAddr), &addrLen);
 
             if (bytesRead <= 0) break;
 
-            m_stats.packetsReceived++;
-            m_stats.bytesIn += bytesRead;
-
             // Find or create client ID
             uint32_t clientId = 0;
             for (const auto& [id, addr] : m_clientAddresses) {
@@ -633,38 +484,87 @@ private:
                 m_clientAddresses[clientId] = senderAddr;
             }
 
-            received.emplace_back(clientId,
-                std::vector<uint8_t>(buffer.begin(), buffer.begin() + bytesRead));
+            DeliverPacket(clientId, std::span<const uint8_t>(m_receiveBuffer.data(), static_cast<size_t>(bytesRead)));
         }
+    }
 
-        return received;
+    void ReceiveIO() {
+        while (NetBuffer* buffer = m_io->Poll()) {
+            m_ioClients.insert(buffer->clientId);
+            m_io->ReadMessages(*buffer, [this, buffer](std::span<const uint8_t> packet) {
+                DeliverPacket(buffer->clientId, packet);
+            });
+            m_io->Release(buffer);
+        }
     }
 
-    std::vector<uint8_t> SerializePacket(const Packet& packet) {
-        std::vector<uint8_t> data;
-        data.reserve(16 + packet.data.size());
-
-        // Header
-        auto writeU32 = [&data](uint32_t v) {
-            data.push_back(static_cast<uint8_t>(v & 0xFF));
-            data.push_back(static_cast<uint8_t>((v >> 8) & 0xFF));
-            data.push_back(static_cast<uint8_t>((v >> 16) & 0xFF));
-            data.push_back(static_cast<uint8_t>((v >> 24) & 0xFF));
+    /**
+     * @brief Process the reliability header and queue the payload (reusing slot storage)
+     */
+    void DeliverPacket(uint32_t clientId, std::span<const uint8_t> packet) {
+        if (packet.size() < kPacketHeaderSize) return;
+
+        m_stats.packetsReceived++;
+        m_stats.bytesIn += packet.size();
+        ProcessAcknowledgments(packet);
+
+        if (m_receivedCount == m_received.size()) {
+            m_received.emplace_back();
+        }
+        ReceivedPacket& received = m_received[m_receivedCount++];
+        received.clientId = clientId;
+        received.data.assign(packet.begin() + kPacketHeaderSize, packet.end());
+    }
+
+    bool Transmit(const Packet& packet, std::span<const uint8_t> payload) {
+        if (m_io) {
+            std::array<uint8_t, kPacketHeaderSize> header;
+            WritePacketHeader(packet, header.data());
+            return m_io->Send(m_isServer ? packet.clientId : 0, header, payload);
+        }
+
+        std::vector<uint8_t> packetData = SerializePacket(packet, payload);
+        if (m_protocol == Protocol::TCP) {
+            SocketType targetSocket = m_socket;
+            if (m_isServer && packet.clientId != 0) {
+                auto it = m_clientSockets.find(packet.clientId);
+                if (it != m_clientSockets.end()) {
+                    targetSocket = it->second;
+                }
+            }
+            return SendTCP(targetSocket, packetData);
+        }
+
+        if (m_isServer && packet.clientId != 0) {
+            auto it = m_clientAddresses.find(packet.clientId);
+            return it != m_clientAddresses.end() && SendUDP(packetData, it->second);
+        }
+        return SendUDP(packetData, m_remoteAddr);
+    }
+
+    static void WritePacketHeader(const Packet& packet, uint8_t* out) {
+        auto writeU32 = [&out](uint32_t v) {
+            *out++ = static_cast<uint8_t>(v & 0xFF);
+            *out++ = static_cast<uint8_t>((v >> 8) & 0xFF);
+            *out++ = static_cast<uint8_t>((v >> 16) & 0xFF);
+            *out++ = static_cast<uint8_t>((v >> 24) & 0xFF);
         };
 
         writeU32(packet.sequenceNumber);
         writeU32(packet.ackNumber);
         writeU32(packet.ackBitfield);
-        data.push_back(packet.reliable ? 1 : 0);
-
-        // Payload
-        data.insert(data.end(), packet.data.begin(), packet.data.end());
+        *out = packet.reliable ? 1 : 0;
+    }
 
+    std::vector<uint8_t> SerializePacket(const Packet& packet, std::span<const uint8_t> payload) {
+        std::vector<uint8_t> data(kPacketHeaderSize + payload.size());
+        WritePacketHeader(packet, data.data());
+        std::copy(payload.begin(), payload.end(), data.begin() + kPacketHeaderSize);
         return data;
     }
 
-    void ProcessAcknowledgments(const std::vector<uint8_t>& data) {
-        if (data.size() < 13) return;
+    void ProcessAcknowledgments(std::span<const uint8_t> data) {
+        if (data.size() < kPacketHeaderSize) return;
 
         uint32_t ackNum = data[4] | (data[5] << 8) | (data[6] << 16) | (data[7] << 24);
         uint32_t ackBits = data[8] | (data[9] << 8) | (data[10] << 16) | (data[11] << 24);
@@ -713,16 +613,10 @@ private:
         for (auto& [seq, packet] : m_pendingAcks) {
             if (now - packet.sendTime > resendThreshold) {
                 packet.sendTime = now;
-                std::vector<uint8_t> data = SerializePacket(packet);
-
-                if (m_protocol == Protocol::TCP) {
-                    SendTCP(m_socket, data);
-                } else {
-                    SendUDP(data, m_remoteAddr);
-                }
+                Transmit(packet, packet.data);
 
                 m_stats.packetsSent++;
-                m_stats.bytesOut += data.size();
+                m_stats.bytesOut += kPacketHeaderSize + packet.data.size();
             }
         }
     }
@@ -773,6 +667,15 @@ private:
     std::unordered_map<uint32_t, sockaddr_in> m_clientAddresses;
     uint32_t m_nextClientId = 1;
 
+    // UDP on Linux: sockets live on the network thread
+    std::unique_ptr<NetworkIOThread> m_io;
+    std::unordered_set<uint32_t> m_ioClients;
+
+    // Receive storage reused across calls
+    std::vector<ReceivedPacket> m_received;
+    size_t m_receivedCount = 0;
+    std::vector<uint8_t> m_receiveBuffer;
+
     // Reliability
     uint32_t m_nextSequence = 1;
     uint32_t m_lastReceivedSeq = 0;
@@ -889,107 +792,6 @@ private:
     std::unordered_map<uint64_t, EntityAuthority> m_authorities;
 };
 
-// ============================================================================
-// InterestManager - Relevance-based filtering
-// ============================================================================
-
-class InterestManager {
-public:
-    struct InterestArea {
-        glm::vec3 center;
-        float radius = 100.0f;
-        float priority = 1.0f;
-    };
-
-    struct ClientInterest {
-        uint32_t clientId = 0;
-        std::vector<InterestArea> areas;
-        std::unordered_set<uint64_t> relevantEntities;
-        glm::vec3 lastPosition;
-        float updateRadius = 150.0f;
-    };
-
-    void SetClientPosition(uint32_t clientId, const glm::vec3& position, float radius = 150.0f) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto& interest = m_clientInterests[clientId];
-        interest.clientId = clientId;
-        interest.lastPosition = position;
-        interest.updateRadius = radius;
-
-        // Primary interest area around player
-        interest.areas.clear();
-        interest.areas.push_back({position, radius, 1.0f});
-    }
-
-    void AddInterestArea(uint32_t clientId, const glm::vec3& center, float radius, float priority) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_clientInterests.find(clientId);
-        if (it != m_clientInterests.end()) {
-            it->second.areas.push_back({center, radius, priority});
-        }
-    }
-
-    bool IsRelevant(uint64_t entityId, const glm::vec3& entityPos, uint32_t clientId) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_clientInterests.find(clientId);
-        if (it == m_clientInterests.end()) return true; // No interest data, assume relevant
-
-        for (const auto& area : it->second.areas) {
-            float dist = glm::length(entityPos - area.center);
-            if (dist <= area.radius) {
-                return true;
-            }
-        }
-        return false;
-    }
-
-    float GetRelevanceScore(uint64_t entityId, const glm::vec3& entityPos, uint32_t clientId) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_clientInterests.find(clientId);
-        if (it == m_clientInterests.end()) return 1.0f;
-
-        float maxScore = 0.0f;
-        for (const auto& area : it->second.areas) {
-            float dist = glm::length(entityPos - area.center);
-            if (dist <= area.radius) {
-                float normalizedDist = 1.0f - (dist / area.radius);
-                float score = normalizedDist * area.priority;
-                maxScore = std::max(maxScore, score);
-            }
-        }
-        return maxScore;
-    }
-
-    std::vector<uint32_t> GetClientsInterestedIn(uint64_t entityId, const glm::vec3& entityPos) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        std::vector<uint32_t> clients;
-        for (const auto& [clientId, interest] : m_clientInterests) {
-            if (IsRelevantInternal(entityPos, interest)) {
-                clients.push_back(clientId);
-            }
-        }
-        return clients;
-    }
-
-    void RemoveClient(uint32_t clientId) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_clientInterests.erase(clientId);
-    }
-
-private:
-    bool IsRelevantInternal(const glm::vec3& entityPos, const ClientInterest& interest) const {
-        for (const auto& area : interest.areas) {
-            if (glm::length(entityPos - area.center) <= area.radius) {
-                return true;
-            }
-        }
-        return false;
-    }
-
-    mutable std::mutex m_mutex;
-    std::unordered_map<uint32_t, ClientInterest> m_clientInterests;
-};
-
 // ============================================================================
 // SnapshotInterpolator - Smooth state interpolation
 // ============================================================================
@@ -1385,7 +1187,8 @@ static std::unique_ptr<InterestManager> g_interestManager;
 static std::unique_ptr<SnapshotInterpolator> g_snapshotInterpolator;
 static std::unique_ptr<ClientPrediction> g_clientPrediction;
 static std::unique_ptr<BandwidthProfiler> g_bandwidthProfiler;
-static DeltaCompressor g_deltaCompressor;
+static std::unique_ptr<SnapshotHistory> g_snapshotHistory;
+static std::unique_ptr<SnapshotReceiver> g_snapshotReceiver;
 
 // ============================================================================
 // NetworkEvent Implementation
@@ -1432,6 +1235,34 @@ EventTypeRegistry& EventTypeRegistry::Instance() {
 void EventTypeRegistry::RegisterType(const EventTypeConfig& config) {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_types[config.typeName] = config;
+
+    auto [idIt, isNew] = m_typeIds.try_emplace(config.typeName, static_cast<uint32_t>(m_schemas.size() + 1));
+    if (isNew) {
+        if (idIt->second >= EventCodec::kFirstReservedTypeId) {
+            m_typeIds.erase(idIt);      // Out of IDs: the type stays dynamic
+            return;
+        }
+        m_schemas.emplace_back();
+    }
+
+    if (config.fields.empty()) {
+        m_schemas[idIt->second - 1].reset();
+        return;
+    }
+
+    // Re-registration updates the schema in place so handed-out pointers stay valid
+    auto& schema = m_schemas[idIt->second - 1];
+    if (!schema) {
+        schema = std::make_unique<EventSchema>();
+    }
+    schema->typeId = idIt->second;
+    schema->typeName = config.typeName;
+    schema->fields = config.fields;
+    schema->defaultCategory = static_cast<uint8_t>(config.defaultCategory);
+    schema->defaultReplicationMode = static_cast<uint8_t>(config.defaultReplicationMode);
+    schema->defaultPersistenceMode = static_cast<uint8_t>(config.defaultPersistenceMode);
+    schema->defaultReliabilityMode = static_cast<uint8_t>(config.defaultReliabilityMode);
+    schema->defaultPriority = static_cast<uint8_t>(config.defaultPriority);
 }
 
 void EventTypeRegistry::UnregisterType(const std::string& typeName) {
@@ -1456,6 +1287,29 @@ std::vector<std::string> EventTypeRegistry::GetTypesByCategory(ReplicationCatego
     return result;
 }
 
+const EventSchema* EventTypeRegistry::GetSchema(const std::string& typeName) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_types.find(typeName) == m_types.end()) return nullptr;
+    auto it = m_typeIds.find(typeName);
+    return it != m_typeIds.end() ? m_schemas[it->second - 1].get() : nullptr;
+}
+
+const EventSchema* EventTypeRegistry::GetSchema(uint32_t typeId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (typeId == 0 || typeId > m_schemas.size() || !m_schemas[typeId - 1]) return nullptr;
+    const EventSchema* schema = m_schemas[typeId - 1].get();
+    return m_types.find(schema->typeName) != m_types.end() ? schema : nullptr;
+}
+
+uint64_t EventTypeRegistry::GetSchemaHash() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t hash = 0;
+    for (const auto& schema : m_schemas) {
+        hash = hash * 31 + (schema ? schema->GetHash() : 0);
+    }
+    return hash;
+}
+
 void EventTypeRegistry::SetOverride(const std::string& typeName, const std::string& property, const EventValue& value) {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_overrides[typeName][property] = value;
@@ -1482,7 +1336,13 @@ void ReplicationSystem::Initialize(const Config& config) {
     g_tcpChannel = std::make_unique<ReplicationChannel>(ReplicationChannel::Protocol::TCP);
     g_udpChannel = std::make_unique<ReplicationChannel>(ReplicationChannel::Protocol::UDP);
     g_authorityManager = std::make_unique<AuthorityManager>();
-    g_interestManager = std::make_unique<InterestManager>();
+    InterestConfig interestConfig;
+    interestConfig.defaultBytesPerTick = config.clientBytesPerTick;
+    g_interestManager = std::make_unique<InterestManager>(interestConfig);
+    g_snapshotHistory = std::make_unique<SnapshotHistory>();
+    g_snapshotReceiver = std::make_unique<SnapshotReceiver>([](uint32_t typeId) {
+        return EventTypeRegistry::Instance().GetSchema(typeId);
+    });
     g_snapshotInterpolator = std::make_unique<SnapshotInterpolator>();
     g_clientPrediction = std::make_unique<ClientPrediction>();
     g_bandwidthProfiler = std::make_unique<BandwidthProfiler>();
@@ -1505,6 +1365,8 @@ void ReplicationSystem::Shutdown() {
     g_udpChannel.reset();
     g_authorityManager.reset();
     g_interestManager.reset();
+    g_snapshotHistory.reset();
+    g_snapshotReceiver.reset();
     g_snapshotInterpolator.reset();
     g_clientPrediction.reset();
     g_bandwidthProfiler.reset();
@@ -1528,6 +1390,7 @@ void ReplicationSystem::Update(float deltaTime) {
     if (m_syncTimer >= m_config.syncInterval) {
         m_syncTimer = 0.0f;
         SendOutgoingPackets();
+        SendEntityUpdates(m_config.syncInterval);
     }
 
     // Send heartbeats
@@ -1538,6 +1401,11 @@ void ReplicationSystem::Update(float deltaTime) {
         CheckTimeouts();
     }
 
+    // Everything sent this frame leaves in coalesced datagrams
+    if (g_udpChannel) {
+        g_udpChannel->Flush();
+    }
+
     // Process Firebase queue
     ProcessFirebaseQueue();
 
@@ -1778,6 +1646,7 @@ void ReplicationSystem::Disconnect() {
     m_connections.clear();
 
     // Clear interpolation and prediction state
+    if (g_snapshotReceiver) g_snapshotReceiver->Clear();
     if (g_snapshotInterpolator) g_snapshotInterpolator->Clear();
     if (g_clientPrediction) g_clientPrediction->Clear();
 }
@@ -2038,6 +1907,28 @@ uint64_t ReplicationSystem::GetServerTime() const {
     return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() + m_serverTimeOffset;
 }
 
+// ============================================================================
+// Interest Management
+// ============================================================================
+
+void ReplicationSystem::SetClientViewpoint(uint32_t clientId, const glm::vec3& position, float radius) {
+    if (g_interestManager) {
+        g_interestManager->SetClientPosition(clientId, position, radius);
+    }
+}
+
+void ReplicationSystem::AddClientInterestArea(uint32_t clientId, const glm::vec3& center, float radius, float priority) {
+    if (g_interestManager) {
+        g_interestManager->AddInterestArea(clientId, center, radius, priority);
+    }
+}
+
+void ReplicationSystem::SetClientBandwidth(uint32_t clientId, size_t bytesPerTick) {
+    if (g_interestManager) {
+        g_interestManager->SetClientBandwidth(clientId, bytesPerTick);
+    }
+}
+
 // ============================================================================
 // Statistics
 // ============================================================================
@@ -2127,18 +2018,9 @@ void ReplicationSystem::SendEventToNetwork(const NetworkEvent& event) {
     // Serialize event
     std::vector<uint8_t> data = SerializeEvent(event);
 
-    // Apply delta compression for state events
-    if (event.category == ReplicationCategory::EntityState ||
-        event.category == ReplicationCategory::EntityMovement) {
-        // Get previous state for this entity if available
-        auto it = m_lastEntityState.find(event.sourceEntityId);
-        if (it != m_lastEntityState.end()) {
-            std::vector<uint8_t> delta = DeltaCompressor::CompressDelta(it->second, data);
-            if (delta.size() < data.size()) {
-                data = std::move(delta);
-            }
-        }
-        m_lastEntityState[event.sourceEntityId] = data;
+    // Entity movement is sent per client by SendEntityUpdates
+    if (QueueEntityUpdate(event, data, reliable)) {
+        return;
     }
 
     switch (event.replicationMode) {
@@ -2225,6 +2107,148 @@ void ReplicationSystem::BroadcastEventData(const std::vector<uint8_t>& data,
     }
 }
 
+bool ReplicationSystem::QueueEntityUpdate(const NetworkEvent& event, std::vector<uint8_t>& data, bool reliable) {
+    if (!m_config.isHost || !g_interestManager || !g_snapshotHistory || event.sourceEntityId == 0) {
+        return false;
+    }
+
+    if (event.eventType == Events::ENTITY_DESTROY) {
+        g_interestManager->RemoveEntity(event.sourceEntityId);
+        g_snapshotHistory->RemoveEntity(event.sourceEntityId);
+        m_entityUpdates.erase(event.sourceEntityId);
+        return false;
+    }
+
+    if (event.category != ReplicationCategory::EntityMovement ||
+        (event.replicationMode != ReplicationMode::ToAll && event.replicationMode != ReplicationMode::ToClients)) {
+        return false;
+    }
+
+    const EventValue position = event.GetProperty("position");
+    if (const auto* pos = std::get_if<glm::vec3>(&position)) {
+        g_interestManager->UpdateEntity(event.sourceEntityId, *pos, static_cast<uint32_t>(data.size()));
+    } else if (g_interestManager->HasEntity(event.sourceEntityId)) {
+        g_interestManager->MarkEntityChanged(event.sourceEntityId);
+    } else {
+        return false;  // Never positioned: nothing to filter by
+    }
+
+    // Unreliable state of schema types travels in delta-compressed snapshots
+    if (!reliable) {
+        const EventSchema* schema = EventTypeRegistry::Instance().GetSchema(event.eventType);
+        if (schema && g_snapshotHistory->SetEntityState(event.sourceEntityId, *schema, event)) {
+            m_entityUpdates.erase(event.sourceEntityId);
+            return true;
+        }
+    }
+
+    // Only the latest update matters; older ones a client missed are superseded
+    PendingEntityUpdate& pending = m_entityUpdates[event.sourceEntityId];
+    pending.data = std::move(data);
+    pending.reliable = reliable;
+    return true;
+}
+
+void ReplicationSystem::SendEntityUpdates(float deltaTime) {
+    if (!m_config.isHost || !g_interestManager || !g_snapshotHistory) return;
+
+    std::lock_guard<std::mutex> lock(m_connectionMutex);
+    for (const auto& [clientId, conn] : m_connections) {
+        if (!conn.isLocal) {
+            g_interestManager->AddClient(clientId);
+        }
+    }
+
+    g_interestManager->Update(deltaTime);
+    g_snapshotHistory->Capture(GetServerTime());
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> packet;
+    for (const auto& [clientId, conn] : m_connections) {
+        if (conn.isLocal) continue;
+
+        g_interestManager->SelectUpdates(clientId, m_selectedUpdates);
+        for (uint64_t entityId : m_selectedUpdates) {
+            auto it = m_entityUpdates.find(entityId);
+            if (it == m_entityUpdates.end()) continue;
+
+            const PendingEntityUpdate& update = it->second;
+            ReplicationChannel* channel = update.reliable ? g_tcpChannel.get() : g_udpChannel.get();
+            if (!channel || channel->GetState() != ReplicationChannel::State::Connected) {
+                channel = g_tcpChannel.get();
+            }
+            if (!channel) return;
+
+            channel->Send(update.data, clientId, update.reliable);
+            m_stats.bytesOut += update.data.size();
+            if (g_bandwidthProfiler) {
+                g_bandwidthProfiler->RecordOutgoing(Events::ENTITY_MOVE, update.data.size());
+            }
+        }
+
+        // One snapshot per client and tick, delta-compressed against its last ack
+        g_interestManager->GetVisibleEntities(clientId, m_visibleEntities);
+        const size_t size = g_snapshotHistory->Encode(clientId, m_visibleEntities, m_selectedUpdates, packet);
+        if (size == 0) continue;
+
+        ReplicationChannel* channel = g_udpChannel.get();
+        if (!channel || channel->GetState() != ReplicationChannel::State::Connected) {
+            channel = g_tcpChannel.get();
+        }
+        if (!channel) return;
+
+        channel->Send(std::span<const uint8_t>(packet.data(), size), clientId, false);
+        m_stats.bytesOut += size;
+        if (g_bandwidthProfiler) {
+            g_bandwidthProfiler->RecordOutgoing(Events::ENTITY_MOVE, size);
+        }
+    }
+}
+
+bool ReplicationSystem::ProcessSnapshotPacket(uint32_t clientId, const std::vector<uint8_t>& data) {
+    const uint32_t typeId = EventCodec::PeekTypeId(data);
+    if (typeId == EventCodec::kSnapshotAckTypeId) {
+        if (m_config.isHost && g_snapshotHistory) {
+            g_snapshotHistory->ReceiveAck(clientId, data);
+        }
+        return true;
+    }
+    if (typeId != EventCodec::kSnapshotTypeId) {
+        return false;
+    }
+    if (m_config.isHost || !g_snapshotReceiver) {
+        return true;
+    }
+
+    const SnapshotReceiver::Result result = g_snapshotReceiver->Receive(data);
+    if (result == SnapshotReceiver::Result::Malformed || result == SnapshotReceiver::Result::MissingBaseline) {
+        return true;
+    }
+
+    // Ack duplicates too: the previous ack may have been lost
+    std::array<uint8_t, 16> ack;
+    const size_t ackSize = SnapshotReceiver::EncodeAck(g_snapshotReceiver->GetLatestTick(), ack);
+    ReplicationChannel* channel = g_udpChannel.get();
+    if (!channel || channel->GetState() != ReplicationChannel::State::Connected) {
+        channel = g_tcpChannel.get();
+    }
+    if (channel) {
+        channel->Send(std::span<const uint8_t>(ack.data(), ackSize), 1, false);
+    }
+
+    if (result != SnapshotReceiver::Result::Applied) {
+        return true;
+    }
+
+    NetworkEvent event;
+    for (uint64_t entityId : g_snapshotReceiver->GetChangedEntities()) {
+        if (g_snapshotReceiver->GetEntityState(entityId, event)) {
+            event.sourceClientId = 1;
+            ProcessRemoteEvent(event);
+        }
+    }
+    return true;
+}
+
 void ReplicationSystem::BroadcastEvent(const NetworkEvent& event) {
     std::vector<uint8_t> data = SerializeEvent(event);
     bool reliable = event.reliabilityMode != ReliabilityMode::Unreliable;
@@ -2304,7 +2328,19 @@ bool ReplicationSystem::CheckRateLimit(const std::string& eventType, uint32_t cl
 std::vector<uint8_t> ReplicationSystem::SerializeEvent(const NetworkEvent& event) const {
     std::vector<uint8_t> data;
 
-    // Simple serialization - would use proper binary format in production
+    // Types with a registered schema go out bit-packed with a numeric type ID
+    if (const EventSchema* schema = EventTypeRegistry::Instance().GetSchema(event.eventType)) {
+        data.resize(EventCodec::kMaxEventSize);
+        const size_t size = EventCodec::Encode(*schema, event, data);
+        if (size > 0) {
+            data.resize(size);
+            return data;
+        }
+        data.clear();   // Larger than one datagram: fall back to the dynamic format
+    }
+
+    // Dynamic format: type ID 0, then string-keyed properties
+    data.push_back(static_cast<uint8_t>(EventCodec::kDynamicTypeId));
     auto writeU64 = [&data](uint64_t v) {
         for (int i = 0; i < 8; i++) {
             data.push_back(static_cast<uint8_t>(v >> (i * 8)));
@@ -2411,9 +2447,19 @@ std::vector<uint8_t> ReplicationSystem::SerializeEvent(const NetworkEvent& event
 
 NetworkEvent ReplicationSystem::DeserializeEvent(const std::vector<uint8_t>& data) const {
     NetworkEvent event;
-    if (data.size() < 40) return event;  // Minimum size check
 
-    size_t offset = 0;
+    const uint32_t typeId = EventCodec::PeekTypeId(data);
+    if (typeId != EventCodec::kDynamicTypeId) {
+        const EventSchema* schema = EventTypeRegistry::Instance().GetSchema(typeId);
+        if (!schema || !EventCodec::Decode(*schema, data, event)) {
+            return NetworkEvent{};
+        }
+        return event;
+    }
+
+    if (data.size() < 41) return event;  // Minimum size check
+
+    size_t offset = 1;  // Skip type ID
 
     auto readU64 = [&data, &offset]() -> uint64_t {
         if (offset + 8 > data.size()) return 0;
@@ -2522,21 +2568,16 @@ NetworkEvent ReplicationSystem::DeserializeEvent(const std::vector<uint8_t>& dat
 void ReplicationSystem::ProcessIncomingPackets() {
     // Process TCP channel
     if (g_tcpChannel && g_tcpChannel->GetState() == ReplicationChannel::State::Connected) {
-        auto packets = g_tcpChannel->Receive();
-        for (const auto& [clientId, data] : packets) {
+        for (const auto& [clientId, data] : g_tcpChannel->Receive()) {
             if (g_bandwidthProfiler) {
                 g_bandwidthProfiler->RecordIncoming("TCP", data.size());
             }
 
-            // Check for delta-compressed data
-            std::vector<uint8_t> decompressed = data;
-            if (data.size() >= 3 && data[0] == 0xDE && data[1] == 0x17 && data[2] == 0xA0) {
-                // This is a delta - need previous state to decompress
-                // For now, try to decompress with empty base
-                decompressed = DeltaCompressor::DecompressDelta({}, data);
+            if (ProcessSnapshotPacket(clientId, data)) {
+                continue;
             }
 
-            NetworkEvent event = DeserializeEvent(decompressed);
+            NetworkEvent event = DeserializeEvent(data);
             if (!event.eventType.empty()) {
                 // Update connection info
                 if (m_config.isHost) {
@@ -2564,7 +2605,7 @@ void ReplicationSystem::ProcessIncomingPackets() {
                     SnapshotInterpolator::Snapshot snapshot;
                     snapshot.tick = static_cast<uint32_t>(event.eventId);
                     snapshot.timestamp = event.timestamp;
-                    snapshot.entityStates[event.sourceEntityId] = decompressed;
+                    snapshot.entityStates[event.sourceEntityId] = data;
                     g_snapshotInterpolator->AddSnapshot(snapshot);
                 }
             }
@@ -2573,12 +2614,15 @@ void ReplicationSystem::ProcessIncomingPackets() {
 
     // Process UDP channel
     if (g_udpChannel && g_udpChannel->GetState() == ReplicationChannel::State::Connected) {
-        auto packets = g_udpChannel->Receive();
-        for (const auto& [clientId, data] : packets) {
+        for (const auto& [clientId, data] : g_udpChannel->Receive()) {
             if (g_bandwidthProfiler) {
                 g_bandwidthProfiler->RecordIncoming("UDP", data.size());
             }
 
+            if (ProcessSnapshotPacket(clientId, data)) {
+                continue;
+            }
+
             NetworkEvent event = DeserializeEvent(data);
             if (!event.eventType.empty()) {
                 ProcessRemoteEvent(event);
@@ -2638,6 +2682,9 @@ void ReplicationSystem::CheckTimeouts() {
             if (g_interestManager) {
                 g_interestManager->RemoveClient(clientId);
             }
+            if (g_snapshotHistory) {
+                g_snapshotHistory->RemoveClient(clientId);
+            }
         }
     }
 
@@ -2811,7 +2858,12 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Unreliable,
         EventPriority::High,
         0.0f, 60,  // Max 60 per second
-        true, false, true
+        true, false, true,
+        {}, {},
+        {
+            {"direction", FieldEncoding::QuantizedVec2, -1.0f, 1.0f, 10},
+            {"sequence", FieldEncoding::UInt32, 0.0f, 1.0f, 0}
+        }
     });
 
     registry.RegisterType({
@@ -2822,7 +2874,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Unreliable,
         EventPriority::Normal,
         0.0f, 30,
-        true, false, true
+        true, false, true,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2833,7 +2886,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::High,
         0.0f, 20,
-        false, false, true
+        false, false, true,
+        {}, {}, {}
     });
 
     // Entity events - reliable
@@ -2845,7 +2899,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::High,
         0.0f, 0,
-        false, true, false  // Host only
+        false, true, false,  // Host only
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2856,7 +2911,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::High,
         0.0f, 0,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2867,7 +2923,13 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Unreliable,
         EventPriority::Normal,
         0.0f, 30,
-        true, false, true
+        true, false, true,
+        {}, {},
+        {
+            {"position", FieldEncoding::QuantizedVec3, -8192.0f, 8192.0f, 20},  // ~1.6 cm
+            {"rotation", FieldEncoding::Quaternion, 0.0f, 1.0f, 10},
+            {"velocity", FieldEncoding::QuantizedVec3, -64.0f, 64.0f, 12}
+        }
     });
 
     registry.RegisterType({
@@ -2878,7 +2940,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::Normal,
         0.0f, 0,
-        true, false, true
+        true, false, true,
+        {}, {}, {}
     });
 
     // Combat events
@@ -2890,7 +2953,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::High,
         0.1f, 10,  // Rate limited
-        true, false, true
+        true, false, true,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2901,7 +2965,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::High,
         0.0f, 0,
-        false, true, false  // Host only
+        false, true, false,  // Host only
+        {}, {}, {}
     });
 
     // Ability events
@@ -2913,7 +2978,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::High,
         0.0f, 0,
-        true, false, true
+        true, false, true,
+        {}, {}, {}
     });
 
     // Building events
@@ -2925,7 +2991,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::Normal,
         0.5f, 2,
-        true, false, true
+        true, false, true,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2936,7 +3003,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::Normal,
         0.0f, 0,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     // Terrain events - PERSIST TO FIREBASE
@@ -2948,7 +3016,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::Normal,
         0.1f, 10,
-        false, true, false  // Host only can modify
+        false, true, false,  // Host only can modify
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2959,7 +3028,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::Normal,
         0.05f, 20,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2970,7 +3040,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::Normal,
         0.5f, 2,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -2981,7 +3052,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::Normal,
         1.0f, 1,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     // Progression events - reliable, no persistence (fetch from host)
@@ -2993,7 +3065,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::Normal,
         0.0f, 0,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     registry.RegisterType({
@@ -3004,7 +3077,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::Reliable,
         EventPriority::High,
         0.0f, 0,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 
     // Chat events
@@ -3016,7 +3090,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::Normal,
         0.1f, 10,
-        false, false, true
+        false, false, true,
+        {}, {}, {}
     });
 
     // Game state events
@@ -3028,7 +3103,8 @@ void ReplicationSystem::RegisterDefaultEventTypes() {
         ReliabilityMode::ReliableOrdered,
         EventPriority::Critical,
         0.0f, 0,
-        false, true, false
+        false, true, false,
+        {}, {}, {}
     });
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "EventSchema.hpp"
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <string>
@@ -191,6 +192,9 @@ struct EventTypeConfig {
     // Callbacks
     std::function<bool(const NetworkEvent&)> validator;
     std::function<void(NetworkEvent&)> preprocessor;
+
+    // Wire schema (empty = string-keyed dynamic format)
+    std::vector<EventFieldSchema> fields;
 };
 
 /**
@@ -206,6 +210,17 @@ public:
     const EventTypeConfig* GetConfig(const std::string& typeName) const;
     std::vector<std::string> GetTypesByCategory(ReplicationCategory category) const;
 
+    /**
+     * @brief Compiled wire schema of a type with fields, or nullptr
+     *
+     * Type IDs are assigned in registration order starting at 1 and are never
+     * reused, so peers must register the same types in the same order;
+     * compare GetSchemaHash() during the handshake to detect mismatches.
+     */
+    const EventSchema* GetSchema(const std::string& typeName) const;
+    const EventSchema* GetSchema(uint32_t typeId) const;
+    uint64_t GetSchemaHash() const;
+
     // Editor support
     void SetOverride(const std::string& typeName, const std::string& property, const EventValue& value);
     void ClearOverrides(const std::string& typeName);
@@ -213,6 +228,8 @@ public:
 private:
     EventTypeRegistry() = default;
     std::unordered_map<std::string, EventTypeConfig> m_types;
+    std::unordered_map<std::string, uint32_t> m_typeIds;
+    std::vector<std::unique_ptr<EventSchema>> m_schemas;    // Indexed by type ID - 1
     std::unordered_map<std::string, std::unordered_map<std::string, EventValue>> m_overrides;
     mutable std::mutex m_mutex;
 };
@@ -276,6 +293,7 @@ public:
         bool enablePrediction = true;
         bool enableInterpolation = true;
         float interpolationDelay = 0.1f;    // 100ms interpolation buffer
+        size_t clientBytesPerTick = 4096;   // Entity update budget per client per sync tick
     };
 
     static ReplicationSystem& Instance();
@@ -439,6 +457,40 @@ public:
      */
     uint64_t GetServerTime() const;
 
+    // =========================================================================
+    // Interest Management
+    // =========================================================================
+
+    /**
+     * @brief Set the area a client receives entity movement for (host)
+     *
+     * Movement events of entities with a "position" property are not
+     * broadcast; each sync tick every client receives the latest update of
+     * the entities most relevant to it, within clientBytesPerTick. Clients
+     * without a viewpoint receive all entities under the same budget.
+     */
+    void SetClientViewpoint(uint32_t clientId, const glm::vec3& position, float radius);
+    void AddClientInterestArea(uint32_t clientId, const glm::vec3& center, float radius, float priority);
+    void SetClientBandwidth(uint32_t clientId, size_t bytesPerTick);
+
+    // =========================================================================
+    // Serialization
+    // =========================================================================
+
+    /**
+     * @brief Encode event for the wire
+     *
+     * Types registered with fields use their compiled EventSchema; others
+     * (and schema events too large for one datagram) use the dynamic
+     * string-keyed format, tagged with EventCodec::kDynamicTypeId.
+     */
+    std::vector<uint8_t> SerializeEvent(const NetworkEvent& event) const;
+
+    /**
+     * @brief Decode either wire format (empty eventType on failure)
+     */
+    NetworkEvent DeserializeEvent(const std::vector<uint8_t>& data) const;
+
     // =========================================================================
     // Statistics
     // =========================================================================
@@ -485,16 +537,16 @@ private:
     void ProcessRemoteEvent(const NetworkEvent& event);
     void SendEventToNetwork(const NetworkEvent& event);
     void BroadcastEvent(const NetworkEvent& event);
+    void BroadcastEventData(const std::vector<uint8_t>& data, const NetworkEvent& event, bool reliable);
     void SendEventTo(const NetworkEvent& event, uint32_t clientId);
+    bool QueueEntityUpdate(const NetworkEvent& event, std::vector<uint8_t>& data, bool reliable);
+    void SendEntityUpdates(float deltaTime);
+    bool ProcessSnapshotPacket(uint32_t clientId, const std::vector<uint8_t>& data);
 
     // Validation
     bool ValidateEvent(const NetworkEvent& event) const;
     bool CheckRateLimit(const std::string& eventType, uint32_t clientId);
 
-    // Serialization
-    std::vector<uint8_t> SerializeEvent(const NetworkEvent& event) const;
-    NetworkEvent DeserializeEvent(const std::vector<uint8_t>& data) const;
-
     // Network I/O
     void ProcessIncomingPackets();
     void SendOutgoingPackets();
@@ -543,6 +595,15 @@ private:
     std::unordered_map<uint64_t, uint32_t> m_entityOwnership;
     mutable std::mutex m_ownershipMutex;
 
+    // Entity state replication
+    struct PendingEntityUpdate {
+        std::vector<uint8_t> data;
+        bool reliable = false;
+    };
+    std::unordered_map<uint64_t, PendingEntityUpdate> m_entityUpdates;   // Latest update per entity
+    std::vector<uint64_t> m_selectedUpdates;
+    std::vector<uint64_t> m_visibleEntities;
+
     // Rate limiting
     std::unordered_map<std::string, std::unordered_map<uint32_t, std::chrono::steady_clock::time_point>> m_lastEventTime;
     std::unordered_map<std::string, std::unordered_map<uint32_t, int>> m_eventCountPerSecond;
@@ -568,6 +629,7 @@ private:
     void RegisterDefaultEventTypes();
     void ProcessFirebaseQueue();
     void PersistEvent(const NetworkEvent& event);
+    void PersistToLocalFile(const NetworkEvent& event);
 };
 
 // ============================================================================
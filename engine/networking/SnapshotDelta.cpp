@@ -0,0 +1,629 @@
+#include "SnapshotDelta.hpp"
+#include "ReplicationSystem.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Nova {
+
+namespace {
+
+// Packet entry operations (2 bits)
+constexpr uint32_t kEntryUpdate = 0;    // Field mask + changed slots, against the baseline
+constexpr uint32_t kEntryCreate = 1;    // Type ID + every slot
+constexpr uint32_t kEntryRemove = 2;
+constexpr uint32_t kEntryOpBits = 2;
+
+uint32_t SlotCount(const EventSchema& schema) {
+    return static_cast<uint32_t>(std::min(schema.fields.size(), EventSchema::kMaxFields));
+}
+
+void CopyBits(std::span<const uint8_t> data, size_t start, size_t count, BitWriter& writer) {
+    BitReader reader(data);
+    reader.Seek(start);
+    while (count > 0) {
+        const uint32_t take = static_cast<uint32_t>(std::min<size_t>(count, 32));
+        writer.WriteBits(reader.ReadBits(take), take);
+        count -= take;
+    }
+}
+
+bool FieldEqual(const WorldSnapshot& a, const WorldSnapshot::Entity& entityA,
+                const WorldSnapshot& b, const WorldSnapshot::Entity& entityB, uint32_t field) {
+    const uint32_t startA = a.GetFieldStart(entityA, field);
+    const uint32_t startB = b.GetFieldStart(entityB, field);
+    size_t count = a.GetFieldEnd(entityA, field) - startA;
+    if (count != b.GetFieldEnd(entityB, field) - startB) {
+        return false;
+    }
+
+    BitReader readerA(a.GetData(entityA));
+    BitReader readerB(b.GetData(entityB));
+    readerA.Seek(startA);
+    readerB.Seek(startB);
+    while (count > 0) {
+        const uint32_t take = static_cast<uint32_t>(std::min<size_t>(count, 32));
+        if (readerA.ReadBits(take) != readerB.ReadBits(take)) {
+            return false;
+        }
+        count -= take;
+    }
+    return true;
+}
+
+bool EntityEqual(const WorldSnapshot& a, const WorldSnapshot::Entity& entityA,
+                 const WorldSnapshot& b, const WorldSnapshot::Entity& entityB) {
+    if (entityA.schema != entityB.schema || entityA.fieldCount != entityB.fieldCount) {
+        return false;
+    }
+    if (!std::equal(a.fieldEnds.begin() + entityA.fieldOffset,
+                    a.fieldEnds.begin() + entityA.fieldOffset + entityA.fieldCount,
+                    b.fieldEnds.begin() + entityB.fieldOffset)) {
+        return false;
+    }
+    // Finish() pads with zero bits, so equal states have equal bytes
+    const auto dataA = a.GetData(entityA);
+    const auto dataB = b.GetData(entityB);
+    return dataA.empty() || std::memcmp(dataA.data(), dataB.data(), dataA.size()) == 0;
+}
+
+void AppendEntity(WorldSnapshot& snapshot, uint64_t entityId, const EventSchema* schema, uint32_t version,
+                  std::span<const uint8_t> data, std::span<const uint32_t> fieldEnds) {
+    WorldSnapshot::Entity entity;
+    entity.entityId = entityId;
+    entity.schema = schema;
+    entity.version = version;
+    entity.dataOffset = static_cast<uint32_t>(snapshot.data.size());
+    entity.fieldOffset = static_cast<uint32_t>(snapshot.fieldEnds.size());
+    entity.fieldCount = static_cast<uint32_t>(fieldEnds.size());
+    snapshot.data.insert(snapshot.data.end(), data.begin(), data.end());
+    snapshot.fieldEnds.insert(snapshot.fieldEnds.end(), fieldEnds.begin(), fieldEnds.end());
+    snapshot.entities.push_back(entity);
+}
+
+} // namespace
+
+// ============================================================================
+// WorldSnapshot
+// ============================================================================
+
+const WorldSnapshot::Entity* WorldSnapshot::Find(uint64_t entityId) const {
+    auto it = std::lower_bound(entities.begin(), entities.end(), entityId,
+                               [](const Entity& entity, uint64_t id) { return entity.entityId < id; });
+    return it != entities.end() && it->entityId == entityId ? &*it : nullptr;
+}
+
+std::span<const uint8_t> WorldSnapshot::GetData(const Entity& entity) const {
+    const uint32_t bits = entity.fieldCount > 0 ? fieldEnds[entity.fieldOffset + entity.fieldCount - 1] : 0;
+    return std::span<const uint8_t>(data).subspan(entity.dataOffset, (bits + 7) / 8);
+}
+
+uint32_t WorldSnapshot::GetFieldStart(const Entity& entity, uint32_t field) const {
+    return field == 0 ? 0 : fieldEnds[entity.fieldOffset + field - 1];
+}
+
+uint32_t WorldSnapshot::GetFieldEnd(const Entity& entity, uint32_t field) const {
+    return fieldEnds[entity.fieldOffset + field];
+}
+
+bool WorldSnapshot::GetEntityState(uint64_t entityId, NetworkEvent& outEvent) const {
+    const Entity* entity = Find(entityId);
+    if (!entity || !entity->schema) return false;
+
+    entity->schema->InitEvent(outEvent);
+    BitReader reader(GetData(*entity));
+    for (uint32_t slot = 0; slot < entity->fieldCount; ++slot) {
+        EventCodec::DecodeSlot(*entity->schema, slot, reader, outEvent);
+    }
+    outEvent.eventId = tick;
+    outEvent.sourceEntityId = entityId;
+    outEvent.timestamp = timestamp;
+    return !reader.HasError();
+}
+
+void WorldSnapshot::Clear() {
+    tick = 0;
+    timestamp = 0;
+    entities.clear();
+    data.clear();
+    fieldEnds.clear();
+}
+
+// ============================================================================
+// SnapshotHistory - World State
+// ============================================================================
+
+bool SnapshotHistory::SetEntityState(uint64_t entityId, const EventSchema& schema, const NetworkEvent& event) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const uint32_t slots = SlotCount(schema);
+    std::array<uint32_t, EventSchema::kMaxFields> fieldEnds;
+    m_encodeScratch.resize(EventCodec::kMaxEventSize);
+    BitWriter writer(m_encodeScratch);
+    for (uint32_t slot = 0; slot < slots; ++slot) {
+        EventCodec::EncodeSlot(schema, slot, event, writer);
+        fieldEnds[slot] = static_cast<uint32_t>(writer.GetBitsWritten());
+    }
+    const size_t size = writer.Finish();
+    if (writer.HasOverflowed()) {
+        return false;
+    }
+
+    auto [it, isNew] = m_stateLookup.try_emplace(entityId, static_cast<uint32_t>(m_states.size()));
+    if (isNew) {
+        m_states.emplace_back();
+        m_states.back().entityId = entityId;
+    }
+
+    EntityState& state = m_states[it->second];
+    const bool changed = isNew || state.schema != &schema || state.data.size() != size ||
+                         !std::equal(state.fieldEnds.begin(), state.fieldEnds.end(), fieldEnds.begin(), fieldEnds.begin() + slots) ||
+                         (size > 0 && std::memcmp(state.data.data(), m_encodeScratch.data(), size) != 0);
+    if (changed) {
+        state.schema = &schema;
+        state.data.assign(m_encodeScratch.begin(), m_encodeScratch.begin() + static_cast<std::ptrdiff_t>(size));
+        state.fieldEnds.assign(fieldEnds.begin(), fieldEnds.begin() + slots);
+        state.version = ++m_nextVersion;
+    }
+    return true;
+}
+
+void SnapshotHistory::RemoveEntity(uint64_t entityId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_stateLookup.find(entityId);
+    if (it == m_stateLookup.end()) return;
+
+    const uint32_t index = it->second;
+    m_stateLookup.erase(it);
+    if (index + 1 != m_states.size()) {
+        m_states[index] = std::move(m_states.back());
+        m_stateLookup[m_states[index].entityId] = index;
+    }
+    m_states.pop_back();
+}
+
+bool SnapshotHistory::HasEntity(uint64_t entityId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stateLookup.find(entityId) != m_stateLookup.end();
+}
+
+size_t SnapshotHistory::GetEntityCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_states.size();
+}
+
+uint32_t SnapshotHistory::Capture(uint64_t timestamp) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    ++m_currentTick;
+    WorldSnapshot& snapshot = m_snapshots[m_currentTick % kHistorySize];
+    snapshot.Clear();
+    snapshot.tick = m_currentTick;
+    snapshot.timestamp = timestamp;
+
+    m_sortScratch.clear();
+    m_sortScratch.reserve(m_states.size());
+    for (uint32_t i = 0; i < m_states.size(); ++i) {
+        m_sortScratch.emplace_back(m_states[i].entityId, i);
+    }
+    std::sort(m_sortScratch.begin(), m_sortScratch.end());
+
+    snapshot.entities.reserve(m_states.size());
+    for (const auto& [entityId, index] : m_sortScratch) {
+        const EntityState& state = m_states[index];
+        AppendEntity(snapshot, entityId, state.schema, state.version, state.data, state.fieldEnds);
+    }
+
+    ++m_stats.ticksCaptured;
+    return m_currentTick;
+}
+
+uint32_t SnapshotHistory::GetCurrentTick() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_currentTick;
+}
+
+bool SnapshotHistory::GetEntityState(uint32_t tick, uint64_t entityId, NetworkEvent& outEvent) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const WorldSnapshot* snapshot = GetSnapshot(tick);
+    return snapshot && snapshot->GetEntityState(entityId, outEvent);
+}
+
+const WorldSnapshot* SnapshotHistory::GetSnapshot(uint32_t tick) const {
+    if (tick == 0 || tick > m_currentTick || m_currentTick - tick >= kHistorySize) return nullptr;
+    const WorldSnapshot& snapshot = m_snapshots[tick % kHistorySize];
+    return snapshot.tick == tick ? &snapshot : nullptr;
+}
+
+// ============================================================================
+// SnapshotHistory - Clients
+// ============================================================================
+
+void SnapshotHistory::RemoveClient(uint32_t clientId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clients.erase(clientId);
+}
+
+void SnapshotHistory::Acknowledge(uint32_t clientId, uint32_t tick) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_clients.find(clientId);
+    if (it != m_clients.end() && tick > it->second.ackedTick && tick <= it->second.lastFrameTick) {
+        it->second.ackedTick = tick;
+    }
+}
+
+bool SnapshotHistory::ReceiveAck(uint32_t clientId, std::span<const uint8_t> packet) {
+    BitReader reader(packet);
+    if (reader.ReadVarUInt() != EventCodec::kSnapshotAckTypeId) return false;
+    const uint64_t tick = reader.ReadVarUInt();
+    if (reader.HasError() || tick > UINT32_MAX) return false;
+
+    Acknowledge(clientId, static_cast<uint32_t>(tick));
+    return true;
+}
+
+uint32_t SnapshotHistory::GetAckedTick(uint32_t clientId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_clients.find(clientId);
+    return it != m_clients.end() ? it->second.ackedTick : 0;
+}
+
+const SnapshotHistory::Frame* SnapshotHistory::GetFrame(const ClientState& client, uint32_t tick) const {
+    if (tick == 0 || m_currentTick - tick >= kHistorySize) return nullptr;
+    const Frame& frame = client.frames[tick % kHistorySize];
+    return frame.tick == tick ? &frame : nullptr;
+}
+
+size_t SnapshotHistory::Encode(uint32_t clientId, std::span<const uint64_t> visible, std::span<uint8_t> buffer) {
+    return Encode(clientId, visible, visible, buffer);
+}
+
+size_t SnapshotHistory::Encode(uint32_t clientId, std::span<const uint64_t> visible,
+                               std::span<const uint64_t> selected, std::span<uint8_t> buffer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const uint32_t tick = m_currentTick;
+    const WorldSnapshot* world = GetSnapshot(tick);
+    if (!world) return 0;
+
+    ClientState& client = m_clients[clientId];
+    const Frame* baseFrame = GetFrame(client, client.ackedTick);
+    const Frame* lastFrame = GetFrame(client, client.lastFrameTick);
+
+    m_visibleScratch.assign(visible.begin(), visible.end());
+    std::sort(m_visibleScratch.begin(), m_visibleScratch.end());
+    m_visibleScratch.erase(std::unique(m_visibleScratch.begin(), m_visibleScratch.end()), m_visibleScratch.end());
+    m_selectedScratch.assign(selected.begin(), selected.end());
+    std::sort(m_selectedScratch.begin(), m_selectedScratch.end());
+
+    const size_t capacity = std::min(buffer.size(), EventCodec::kMaxEventSize);
+    BitWriter writer(buffer.first(capacity));
+    writer.WriteVarUInt(EventCodec::kSnapshotTypeId);
+    writer.WriteVarUInt(tick);
+    writer.WriteVarUInt(baseFrame ? tick - baseFrame->tick : 0);
+    writer.WriteVarUInt(world->timestamp);
+
+    // Every entry must leave room for the end-of-entries bit
+    auto fits = [&writer, capacity]() {
+        return !writer.HasOverflowed() && writer.GetBitsWritten() + 1 <= capacity * 8;
+    };
+    if (!fits()) return 0;
+
+    uint64_t lastId = 0;
+    auto beginEntry = [&writer, &lastId](uint64_t entityId, uint32_t op) {
+        const size_t mark = writer.GetBitsWritten();
+        writer.WriteBool(true);
+        writer.WriteVarUInt(entityId - lastId);
+        writer.WriteBits(op, kEntryOpBits);
+        return mark;
+    };
+    auto commitEntry = [&](size_t mark, uint64_t entityId) {
+        if (!fits()) {
+            writer.Rewind(mark);
+            ++m_stats.entriesDeferred;
+            return false;
+        }
+        lastId = entityId;
+        return true;
+    };
+    auto findEntry = [](const Frame& frame, uint64_t entityId) -> const FrameEntry* {
+        auto it = std::lower_bound(frame.entries.begin(), frame.entries.end(), entityId,
+                                   [](const FrameEntry& entry, uint64_t id) { return entry.entityId < id; });
+        return it != frame.entries.end() && it->entityId == entityId ? &*it : nullptr;
+    };
+
+    // The previous frame may be this tick's slot; build into scratch and swap at the end
+    Frame& frame = m_frameScratch;
+    frame.tick = tick;
+    frame.entries.clear();
+
+    static const std::vector<FrameEntry> kNoEntries;
+    const std::vector<FrameEntry>& baseEntries = baseFrame ? baseFrame->entries : kNoEntries;
+    size_t baseIndex = 0;
+    size_t visibleIndex = 0;
+    while (baseIndex < baseEntries.size() || visibleIndex < m_visibleScratch.size()) {
+        const bool hasBase = baseIndex < baseEntries.size() &&
+            (visibleIndex >= m_visibleScratch.size() || baseEntries[baseIndex].entityId <= m_visibleScratch[visibleIndex]);
+        const bool isVisible = visibleIndex < m_visibleScratch.size() &&
+            (baseIndex >= baseEntries.size() || m_visibleScratch[visibleIndex] <= baseEntries[baseIndex].entityId);
+        const FrameEntry* base = hasBase ? &baseEntries[baseIndex++] : nullptr;
+        const uint64_t entityId = base ? base->entityId : m_visibleScratch[visibleIndex];
+        if (isVisible) ++visibleIndex;
+
+        const WorldSnapshot::Entity* current = isVisible ? world->Find(entityId) : nullptr;
+        if (!current) {
+            if (base) {
+                const size_t mark = beginEntry(entityId, kEntryRemove);
+                if (commitEntry(mark, entityId)) {
+                    ++m_stats.entitiesRemoved;
+                } else {
+                    frame.entries.push_back(*base);
+                }
+            }
+            continue;
+        }
+
+        // Deferred entities keep the state the previous frame gave them while it is stored
+        const WorldSnapshot* target = world;
+        const WorldSnapshot::Entity* targetEntity = current;
+        if (!std::binary_search(m_selectedScratch.begin(), m_selectedScratch.end(), entityId)) {
+            const FrameEntry* held = lastFrame ? findEntry(*lastFrame, entityId) : base;
+            if (held && held->sourceTick + kHistorySize / 2 > tick) {
+                const WorldSnapshot* heldSnapshot = GetSnapshot(held->sourceTick);
+                const WorldSnapshot::Entity* heldEntity = heldSnapshot ? heldSnapshot->Find(entityId) : nullptr;
+                if (heldEntity && heldEntity->version != current->version) {
+                    target = heldSnapshot;
+                    targetEntity = heldEntity;
+                }
+            }
+        }
+
+        const WorldSnapshot* baseSnapshot = base ? GetSnapshot(base->sourceTick) : nullptr;
+        const WorldSnapshot::Entity* baseEntity = baseSnapshot ? baseSnapshot->Find(entityId) : nullptr;
+
+        if (!baseEntity || baseEntity->schema != targetEntity->schema) {
+            // New to the client, or its baseline state is no longer stored
+            const size_t mark = beginEntry(entityId, kEntryCreate);
+            writer.WriteVarUInt(targetEntity->schema->typeId);
+            CopyBits(target->GetData(*targetEntity), 0,
+                     target->GetFieldEnd(*targetEntity, targetEntity->fieldCount - 1), writer);
+            if (commitEntry(mark, entityId)) {
+                frame.entries.push_back({entityId, target->tick});
+                ++m_stats.entitiesCreated;
+            } else if (base) {
+                frame.entries.push_back(*base);
+            }
+            continue;
+        }
+
+        uint64_t mask = 0;
+        if (baseEntity->version != targetEntity->version) {
+            for (uint32_t field = 0; field < targetEntity->fieldCount; ++field) {
+                if (!FieldEqual(*baseSnapshot, *baseEntity, *target, *targetEntity, field)) {
+                    mask |= 1ull << field;
+                }
+            }
+        }
+        if (mask == 0) {
+            frame.entries.push_back({entityId, target->tick});
+            continue;
+        }
+
+        const size_t mark = beginEntry(entityId, kEntryUpdate);
+        writer.WriteBits64(mask, targetEntity->fieldCount);
+        const auto data = target->GetData(*targetEntity);
+        for (uint32_t field = 0; field < targetEntity->fieldCount; ++field) {
+            if ((mask >> field) & 1) {
+                const uint32_t start = target->GetFieldStart(*targetEntity, field);
+                CopyBits(data, start, target->GetFieldEnd(*targetEntity, field) - start, writer);
+            }
+        }
+        if (commitEntry(mark, entityId)) {
+            frame.entries.push_back({entityId, target->tick});
+            ++m_stats.entitiesUpdated;
+            m_stats.fieldsWritten += static_cast<uint64_t>(std::popcount(mask));
+        } else {
+            frame.entries.push_back(*base);
+        }
+    }
+    writer.WriteBool(false);
+    const size_t size = writer.Finish();
+
+    std::swap(client.frames[tick % kHistorySize], m_frameScratch);
+    client.lastFrameTick = tick;
+
+    ++m_stats.packetsEncoded;
+    m_stats.fullPackets += baseFrame ? 0 : 1;
+    m_stats.bytesEncoded += size;
+    return size;
+}
+
+SnapshotHistory::Stats SnapshotHistory::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+// ============================================================================
+// SnapshotReceiver
+// ============================================================================
+
+SnapshotReceiver::SnapshotReceiver(SchemaResolver resolver)
+    : m_resolver(std::move(resolver)) {
+}
+
+SnapshotReceiver::Result SnapshotReceiver::Receive(std::span<const uint8_t> packet) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    BitReader reader(packet);
+    if (reader.ReadVarUInt() != EventCodec::kSnapshotTypeId) return Result::Malformed;
+    const uint64_t tick = reader.ReadVarUInt();
+    const uint64_t baselineAge = reader.ReadVarUInt();
+    const uint64_t timestamp = reader.ReadVarUInt();
+    if (reader.HasError() || tick == 0 || tick > UINT32_MAX ||
+        baselineAge >= SnapshotHistory::kHistorySize || baselineAge >= tick) {
+        return Result::Malformed;
+    }
+
+    const uint32_t slotTick = m_snapshots[tick % SnapshotHistory::kHistorySize].tick;
+    if (slotTick == tick) return Result::Duplicate;
+    if (slotTick > tick) return Result::Stale;     // Too old to keep
+
+    const WorldSnapshot* baseline = nullptr;
+    if (baselineAge > 0) {
+        baseline = GetSnapshot(static_cast<uint32_t>(tick - baselineAge));
+        if (!baseline) return Result::MissingBaseline;
+    }
+
+    WorldSnapshot& snapshot = m_decodeScratch;
+    snapshot.Clear();
+    snapshot.tick = static_cast<uint32_t>(tick);
+    snapshot.timestamp = timestamp;
+
+    static const std::vector<WorldSnapshot::Entity> kNoEntities;
+    const std::vector<WorldSnapshot::Entity>& baseEntities = baseline ? baseline->entities : kNoEntities;
+    size_t baseIndex = 0;
+    auto copyBase = [&](const WorldSnapshot::Entity& entity) {
+        AppendEntity(snapshot, entity.entityId, entity.schema, 0, baseline->GetData(entity),
+                     std::span<const uint32_t>(baseline->fieldEnds).subspan(entity.fieldOffset, entity.fieldCount));
+    };
+
+    std::array<uint32_t, EventSchema::kMaxFields> fieldEnds;
+    m_entityScratch.resize(EventCodec::kMaxEventSize);
+    uint64_t entityId = 0;
+    bool first = true;
+    while (reader.ReadBool()) {
+        const uint64_t delta = reader.ReadVarUInt();
+        const uint32_t op = reader.ReadBits(kEntryOpBits);
+        if (reader.HasError() || (delta == 0 && !first)) return Result::Malformed;
+        entityId += delta;
+        first = false;
+
+        while (baseIndex < baseEntities.size() && baseEntities[baseIndex].entityId < entityId) {
+            copyBase(baseEntities[baseIndex++]);
+        }
+        const WorldSnapshot::Entity* baseEntity = nullptr;
+        if (baseIndex < baseEntities.size() && baseEntities[baseIndex].entityId == entityId) {
+            baseEntity = &baseEntities[baseIndex++];
+        }
+
+        if (op == kEntryRemove) continue;
+
+        const EventSchema* schema = nullptr;
+        if (op == kEntryCreate) {
+            const uint64_t typeId = reader.ReadVarUInt();
+            schema = m_resolver && typeId <= UINT32_MAX ? m_resolver(static_cast<uint32_t>(typeId)) : nullptr;
+        } else if (op == kEntryUpdate && baseEntity) {
+            schema = baseEntity->schema;
+        }
+        if (!schema) return Result::Malformed;
+
+        const uint32_t slots = SlotCount(*schema);
+        const uint64_t mask = op == kEntryCreate ? ~0ull : reader.ReadBits64(slots);
+        BitWriter writer(m_entityScratch);
+        for (uint32_t slot = 0; slot < slots; ++slot) {
+            if ((mask >> slot) & 1) {
+                const size_t start = reader.GetBitsRead();
+                EventCodec::SkipSlot(*schema, slot, reader);
+                CopyBits(packet, start, reader.GetBitsRead() - start, writer);
+            } else {
+                const uint32_t start = baseline->GetFieldStart(*baseEntity, slot);
+                CopyBits(baseline->GetData(*baseEntity), start, baseline->GetFieldEnd(*baseEntity, slot) - start, writer);
+            }
+            fieldEnds[slot] = static_cast<uint32_t>(writer.GetBitsWritten());
+        }
+        const size_t size = writer.Finish();
+        if (reader.HasError() || writer.HasOverflowed()) return Result::Malformed;
+
+        AppendEntity(snapshot, entityId, schema, 0, std::span<const uint8_t>(m_entityScratch).first(size),
+                     std::span<const uint32_t>(fieldEnds).first(slots));
+    }
+    if (reader.HasError()) return Result::Malformed;
+    while (baseIndex < baseEntities.size()) {
+        copyBase(baseEntities[baseIndex++]);
+    }
+
+    const bool newest = tick > m_latestTick;
+    if (newest) {
+        // Changes relative to the current view, before its slot can be reused
+        m_changed.clear();
+        m_removed.clear();
+        const WorldSnapshot* previous = GetSnapshot(m_latestTick);
+        size_t prevIndex = 0;
+        for (const auto& entity : snapshot.entities) {
+            while (previous && prevIndex < previous->entities.size() &&
+                   previous->entities[prevIndex].entityId < entity.entityId) {
+                m_removed.push_back(previous->entities[prevIndex++].entityId);
+            }
+            if (previous && prevIndex < previous->entities.size() &&
+                previous->entities[prevIndex].entityId == entity.entityId) {
+                if (!EntityEqual(snapshot, entity, *previous, previous->entities[prevIndex])) {
+                    m_changed.push_back(entity.entityId);
+                }
+                ++prevIndex;
+            } else {
+                m_changed.push_back(entity.entityId);
+            }
+        }
+        while (previous && prevIndex < previous->entities.size()) {
+            m_removed.push_back(previous->entities[prevIndex++].entityId);
+        }
+        m_latestTick = static_cast<uint32_t>(tick);
+    }
+
+    std::swap(m_snapshots[tick % SnapshotHistory::kHistorySize], m_decodeScratch);
+    return newest ? Result::Applied : Result::Stale;
+}
+
+uint32_t SnapshotReceiver::GetLatestTick() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_latestTick;
+}
+
+uint64_t SnapshotReceiver::GetLatestTimestamp() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const WorldSnapshot* snapshot = GetSnapshot(m_latestTick);
+    return snapshot ? snapshot->timestamp : 0;
+}
+
+bool SnapshotReceiver::GetEntityState(uint64_t entityId, NetworkEvent& outEvent) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const WorldSnapshot* snapshot = GetSnapshot(m_latestTick);
+    return snapshot && snapshot->GetEntityState(entityId, outEvent);
+}
+
+bool SnapshotReceiver::GetEntityState(uint32_t tick, uint64_t entityId, NetworkEvent& outEvent) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const WorldSnapshot* snapshot = GetSnapshot(tick);
+    return snapshot && snapshot->GetEntityState(entityId, outEvent);
+}
+
+size_t SnapshotReceiver::GetEntityCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const WorldSnapshot* snapshot = GetSnapshot(m_latestTick);
+    return snapshot ? snapshot->entities.size() : 0;
+}
+
+void SnapshotReceiver::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& snapshot : m_snapshots) {
+        snapshot.Clear();
+    }
+    m_latestTick = 0;
+    m_changed.clear();
+    m_removed.clear();
+}
+
+size_t SnapshotReceiver::EncodeAck(uint32_t tick, std::span<uint8_t> buffer) {
+    BitWriter writer(buffer);
+    writer.WriteVarUInt(EventCodec::kSnapshotAckTypeId);
+    writer.WriteVarUInt(tick);
+    return writer.Finish();
+}
+
+const WorldSnapshot* SnapshotReceiver::GetSnapshot(uint32_t tick) const {
+    if (tick == 0) return nullptr;
+    const WorldSnapshot& snapshot = m_snapshots[tick % SnapshotHistory::kHistorySize];
+    return snapshot.tick == tick ? &snapshot : nullptr;
+}
+
+} // namespace Nova
@@ -0,0 +1,275 @@
+#pragma once
+
+#include "EventSchema.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+
+// ============================================================================
+// World Snapshot - Packed Entity States of One Tick
+// ============================================================================
+
+/**
+ * @brief Schema-encoded state of every entity at one tick
+ *
+ * Each entity state is the concatenation of its schema slot payloads
+ * (EventCodec::EncodeSlot), byte-aligned in one shared buffer, with the bit
+ * offset where each slot ends so single fields can be compared and copied.
+ * Entities are sorted by ID.
+ */
+struct WorldSnapshot {
+    struct Entity {
+        uint64_t entityId = 0;
+        const EventSchema* schema = nullptr;
+        uint32_t version = 0;           // Changes whenever the encoded state changes (server only)
+        uint32_t dataOffset = 0;        // Byte offset in data
+        uint32_t fieldOffset = 0;       // Index of the first slot in fieldEnds
+        uint32_t fieldCount = 0;
+    };
+
+    uint32_t tick = 0;                  // 0 = empty slot
+    uint64_t timestamp = 0;
+    std::vector<Entity> entities;
+    std::vector<uint8_t> data;
+    std::vector<uint32_t> fieldEnds;    // Bit offset of each slot end, relative to the entity
+
+    [[nodiscard]] const Entity* Find(uint64_t entityId) const;
+    [[nodiscard]] std::span<const uint8_t> GetData(const Entity& entity) const;
+    [[nodiscard]] uint32_t GetFieldStart(const Entity& entity, uint32_t field) const;
+    [[nodiscard]] uint32_t GetFieldEnd(const Entity& entity, uint32_t field) const;
+
+    /**
+     * @brief Decode an entity into a schema-initialised event (false if absent)
+     */
+    bool GetEntityState(uint64_t entityId, NetworkEvent& outEvent) const;
+
+    void Clear();
+};
+
+// ============================================================================
+// Snapshot History - Server Side
+// ============================================================================
+
+/**
+ * @brief Per-tick world snapshots and per-client delta encoding against acked baselines
+ *
+ * The server records entity state with SetEntityState(), calls Capture()
+ * once per network tick and then Encode() for every client. A packet is a
+ * delta from the newest snapshot that client acknowledged (or a full state
+ * when none is usable): entities that entered its view carry every field,
+ * entities that changed carry a field mask plus only the changed fields,
+ * and entities that left the view are listed as removed. Nothing is ever
+ * encoded against data the client may not have, so a lost, duplicated or
+ * reordered packet costs only bandwidth; the next packet still decodes.
+ *
+ * Per client the history remembers, for every tick it sent, which entities
+ * the client will hold and from which tick their state came. That lets a
+ * send budget defer updates (entities not in `selected` keep the state the
+ * client already has) while changes that are sent but not yet acked are
+ * repeated until an ack covers them.
+ *
+ * All public methods are thread-safe.
+ */
+class SnapshotHistory {
+public:
+    static constexpr uint32_t kHistorySize = 32;        // Ticks kept (and longest usable ack age)
+
+    struct Stats {
+        uint64_t ticksCaptured = 0;
+        uint64_t packetsEncoded = 0;
+        uint64_t fullPackets = 0;       // Encoded without a usable baseline
+        uint64_t bytesEncoded = 0;
+        uint64_t entitiesCreated = 0;
+        uint64_t entitiesUpdated = 0;
+        uint64_t entitiesRemoved = 0;
+        uint64_t fieldsWritten = 0;     // Slots sent in update entries
+        uint64_t entriesDeferred = 0;   // Entries that did not fit in a packet
+    };
+
+    SnapshotHistory() = default;
+
+    SnapshotHistory(const SnapshotHistory&) = delete;
+    SnapshotHistory& operator=(const SnapshotHistory&) = delete;
+
+    // =========================================================================
+    // World State
+    // =========================================================================
+
+    /**
+     * @brief Record the entity's current state (the schema's slots of event)
+     * @return false if the state does not fit in one packet
+     */
+    bool SetEntityState(uint64_t entityId, const EventSchema& schema, const NetworkEvent& event);
+
+    void RemoveEntity(uint64_t entityId);
+    [[nodiscard]] bool HasEntity(uint64_t entityId) const;
+    [[nodiscard]] size_t GetEntityCount() const;
+
+    /**
+     * @brief Store the current world state as the next tick
+     * @return The new tick (ticks start at 1)
+     */
+    uint32_t Capture(uint64_t timestamp);
+
+    [[nodiscard]] uint32_t GetCurrentTick() const;
+
+    /**
+     * @brief Decode an entity from a stored tick (false if the tick or entity is gone)
+     */
+    bool GetEntityState(uint32_t tick, uint64_t entityId, NetworkEvent& outEvent) const;
+
+    // =========================================================================
+    // Clients
+    // =========================================================================
+
+    void RemoveClient(uint32_t clientId);
+
+    /**
+     * @brief The client holds the snapshot of this tick (older acks are ignored)
+     */
+    void Acknowledge(uint32_t clientId, uint32_t tick);
+
+    /**
+     * @brief Apply an acknowledgement packet from SnapshotReceiver::EncodeAck()
+     */
+    bool ReceiveAck(uint32_t clientId, std::span<const uint8_t> packet);
+
+    [[nodiscard]] uint32_t GetAckedTick(uint32_t clientId) const;
+
+    /**
+     * @brief Encode the current tick for a client
+     * @param visible Entities the client should hold (any order, IDs without state are ignored)
+     * @param selected Visible entities whose latest state the client should receive now;
+     *        the others keep the state the client already has unless it is too old
+     * @return Packet size, or 0 if nothing was captured yet or buffer is too small for a header
+     */
+    size_t Encode(uint32_t clientId, std::span<const uint64_t> visible,
+                  std::span<const uint64_t> selected, std::span<uint8_t> buffer);
+
+    /**
+     * @brief Encode with every visible entity selected
+     */
+    size_t Encode(uint32_t clientId, std::span<const uint64_t> visible, std::span<uint8_t> buffer);
+
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    struct EntityState {
+        uint64_t entityId = 0;
+        const EventSchema* schema = nullptr;
+        uint32_t version = 0;
+        std::vector<uint8_t> data;
+        std::vector<uint32_t> fieldEnds;
+    };
+
+    struct FrameEntry {
+        uint64_t entityId;
+        uint32_t sourceTick;            // Tick whose world snapshot holds what the client has
+    };
+
+    struct Frame {
+        uint32_t tick = 0;
+        std::vector<FrameEntry> entries;    // Sorted by entity ID
+    };
+
+    struct ClientState {
+        uint32_t ackedTick = 0;
+        uint32_t lastFrameTick = 0;
+        std::array<Frame, kHistorySize> frames;
+    };
+
+    [[nodiscard]] const WorldSnapshot* GetSnapshot(uint32_t tick) const;
+    [[nodiscard]] const Frame* GetFrame(const ClientState& client, uint32_t tick) const;
+
+    std::vector<EntityState> m_states;
+    std::unordered_map<uint64_t, uint32_t> m_stateLookup;
+    std::vector<uint8_t> m_encodeScratch;
+    uint32_t m_nextVersion = 0;
+
+    std::array<WorldSnapshot, kHistorySize> m_snapshots;
+    uint32_t m_currentTick = 0;
+
+    std::unordered_map<uint32_t, ClientState> m_clients;
+    Frame m_frameScratch;
+    std::vector<uint64_t> m_visibleScratch;
+    std::vector<uint64_t> m_selectedScratch;
+    std::vector<std::pair<uint64_t, uint32_t>> m_sortScratch;
+
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+};
+
+// ============================================================================
+// Snapshot Receiver - Client Side
+// ============================================================================
+
+/**
+ * @brief Rebuilds snapshots from SnapshotHistory packets
+ *
+ * Keeps the last kHistorySize decoded snapshots so any packet whose
+ * baseline the server could have chosen can be decoded, in any order.
+ * Only packets newer than the latest one change the current view.
+ */
+class SnapshotReceiver {
+public:
+    using SchemaResolver = std::function<const EventSchema*(uint32_t typeId)>;
+
+    enum class Result {
+        Applied,            // Newest snapshot: current view updated
+        Stale,              // Older than the current view (kept as a baseline if its slot is free)
+        Duplicate,          // Tick already received
+        MissingBaseline,    // Baseline no longer (or never) held
+        Malformed
+    };
+
+    explicit SnapshotReceiver(SchemaResolver resolver);
+
+    SnapshotReceiver(const SnapshotReceiver&) = delete;
+    SnapshotReceiver& operator=(const SnapshotReceiver&) = delete;
+
+    Result Receive(std::span<const uint8_t> packet);
+
+    [[nodiscard]] uint32_t GetLatestTick() const;
+    [[nodiscard]] uint64_t GetLatestTimestamp() const;
+
+    /**
+     * @brief Entities added or changed / removed by the last Applied packet
+     */
+    [[nodiscard]] const std::vector<uint64_t>& GetChangedEntities() const { return m_changed; }
+    [[nodiscard]] const std::vector<uint64_t>& GetRemovedEntities() const { return m_removed; }
+
+    /**
+     * @brief Decode an entity from the current view (false if not held)
+     */
+    bool GetEntityState(uint64_t entityId, NetworkEvent& outEvent) const;
+    bool GetEntityState(uint32_t tick, uint64_t entityId, NetworkEvent& outEvent) const;
+    [[nodiscard]] size_t GetEntityCount() const;
+
+    void Clear();
+
+    /**
+     * @brief Acknowledgement packet for SnapshotHistory::ReceiveAck()
+     */
+    static size_t EncodeAck(uint32_t tick, std::span<uint8_t> buffer);
+
+private:
+    [[nodiscard]] const WorldSnapshot* GetSnapshot(uint32_t tick) const;
+
+    SchemaResolver m_resolver;
+    std::array<WorldSnapshot, SnapshotHistory::kHistorySize> m_snapshots;
+    WorldSnapshot m_decodeScratch;
+    std::vector<uint8_t> m_entityScratch;
+    uint32_t m_latestTick = 0;
+    std::vector<uint64_t> m_changed;
+    std::vector<uint64_t> m_removed;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace Nova
@@ -0,0 +1,179 @@
+#include "pathfinding/CompactGraph.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Nova {
+
+// Graph freeze
+CompactGraph Graph::Freeze() const {
+    return CompactGraph(*this);
+}
+
+// ============================================================================
+// CompactGraph implementation
+// ============================================================================
+
+CompactGraph::CompactGraph(const Graph& graph) {
+    const auto& nodes = graph.GetNodes();
+
+    // Dense order follows ascending node ID so freezing is deterministic.
+    // Negative IDs cannot index m_indexById and are left out.
+    m_nodeIds.reserve(nodes.size());
+    int maxId = -1;
+    for (const auto& [id, node] : nodes) {
+        if (id < 0) continue;
+        m_nodeIds.push_back(id);
+        maxId = std::max(maxId, id);
+    }
+    std::sort(m_nodeIds.begin(), m_nodeIds.end());
+
+    m_indexById.assign(static_cast<size_t>(maxId + 1), INVALID_INDEX);
+    for (size_t i = 0; i < m_nodeIds.size(); ++i) {
+        m_indexById[static_cast<size_t>(m_nodeIds[i])] = static_cast<Index>(i);
+    }
+
+    size_t edgeCount = 0;
+    for (int id : m_nodeIds) {
+        edgeCount += nodes.at(id).neighbors.size();
+    }
+
+    m_positions.reserve(m_nodeIds.size());
+    m_walkable.reserve(m_nodeIds.size());
+    m_edgeOffsets.reserve(m_nodeIds.size() + 1);
+    m_edgeTargets.reserve(edgeCount);
+    m_edgeWeights.reserve(edgeCount);
+
+    m_edgeOffsets.push_back(0);
+    for (int id : m_nodeIds) {
+        const PathNode& node = nodes.at(id);
+        m_positions.push_back(node.position);
+        m_walkable.push_back(node.walkable ? 1 : 0);
+
+        for (int neighborId : node.neighbors) {
+            const Index target = ToIndex(neighborId);
+            if (target == INVALID_INDEX) continue;
+
+            m_edgeTargets.push_back(target);
+            m_edgeWeights.push_back(graph.GetEdgeWeight(id, neighborId));
+        }
+        m_edgeOffsets.push_back(static_cast<Index>(m_edgeTargets.size()));
+    }
+}
+
+float CompactGraph::GetEdgeWeight(Index from, Index to) const noexcept {
+    const Index end = EdgeEnd(from);
+    for (Index edge = EdgeBegin(from); edge < end; ++edge) {
+        if (m_edgeTargets[edge] == to) {
+            return m_edgeWeights[edge];
+        }
+    }
+    return std::numeric_limits<float>::infinity();
+}
+
+// ============================================================================
+// AStarSearchContext implementation
+// ============================================================================
+
+AStarSearchContext& AStarSearchContext::ForCurrentThread() {
+    thread_local AStarSearchContext context;
+    return context;
+}
+
+CompactSearchResult AStarSearchContext::FindPath(
+    const CompactGraph& graph,
+    Index start,
+    Index goal,
+    const CompactSearchParams& params,
+    std::vector<Index>& outPath) {
+
+    return FindPath(graph, start, goal,
+        [](const glm::vec3& a, const glm::vec3& b) { return glm::distance(a, b); },
+        params, outPath);
+}
+
+void AStarSearchContext::BeginSearch(size_t nodeCount) {
+    if (m_nodes.size() < nodeCount) {
+        m_nodes.resize(nodeCount);
+        m_heap.reserve(nodeCount);
+    }
+    m_heap.clear();
+
+    // Stale states compare unequal to the new generation; on wrap-around
+    // reset them explicitly so none can alias the restarted counter
+    if (++m_generation == 0) {
+        for (NodeState& state : m_nodes) {
+            state.generation = 0;
+        }
+        m_generation = 1;
+    }
+}
+
+void AStarSearchContext::Place(uint32_t slot, const HeapEntry& entry) {
+    m_heap[slot] = entry;
+    m_nodes[entry.node].heapSlot = slot;
+}
+
+void AStarSearchContext::Push(Index node, float fCost, float gCost) {
+    const uint32_t slot = static_cast<uint32_t>(m_heap.size());
+    m_heap.push_back({fCost, gCost, node});
+    m_nodes[node].heapSlot = slot;
+    SiftUp(slot);
+}
+
+void AStarSearchContext::DecreaseKey(uint32_t slot, float fCost, float gCost) {
+    m_heap[slot].fCost = fCost;
+    m_heap[slot].gCost = gCost;
+    SiftUp(slot);
+}
+
+AStarSearchContext::HeapEntry AStarSearchContext::PopMin() {
+    const HeapEntry top = m_heap.front();
+    m_nodes[top.node].heapSlot = kClosed;
+
+    const HeapEntry last = m_heap.back();
+    m_heap.pop_back();
+    if (!m_heap.empty()) {
+        Place(0, last);
+        SiftDown(0);
+    }
+    return top;
+}
+
+void AStarSearchContext::SiftUp(uint32_t slot) {
+    const HeapEntry entry = m_heap[slot];
+    while (slot > 0) {
+        const uint32_t parent = (slot - 1) / 2;
+        if (!Before(entry, m_heap[parent])) break;
+        Place(slot, m_heap[parent]);
+        slot = parent;
+    }
+    Place(slot, entry);
+}
+
+void AStarSearchContext::SiftDown(uint32_t slot) {
+    const HeapEntry entry = m_heap[slot];
+    const uint32_t count = static_cast<uint32_t>(m_heap.size());
+    while (true) {
+        uint32_t child = slot * 2 + 1;
+        if (child >= count) break;
+        if (child + 1 < count && Before(m_heap[child + 1], m_heap[child])) {
+            ++child;
+        }
+        if (!Before(m_heap[child], entry)) break;
+        Place(slot, m_heap[child]);
+        slot = child;
+    }
+    Place(slot, entry);
+}
+
+void AStarSearchContext::ReconstructPath(Index start, Index goal, std::vector<Index>& outPath) const {
+    Index current = goal;
+    while (current != CompactGraph::INVALID_INDEX) {
+        outPath.push_back(current);
+        if (current == start) break;
+        current = m_nodes[current].parent;
+    }
+    std::reverse(outPath.begin(), outPath.end());
+}
+
+} // namespace Nova
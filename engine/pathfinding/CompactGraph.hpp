@@ -0,0 +1,374 @@
+#pragma once
+
+#include "pathfinding/Graph.hpp"
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <limits>
+#include <concepts>
+#include <utility>
+#include <glm/glm.hpp>
+
+namespace Nova {
+
+/**
+ * @brief Frozen, compressed sparse row (CSR) snapshot of a Graph
+ *
+ * Nodes are renumbered to dense indices (in ascending Graph node ID order)
+ * with positions, walkability and the edge offsets in contiguous arrays.
+ * Edge targets and weights for node i live in [offsets[i], offsets[i + 1]).
+ * Topology is immutable; walkability can still be toggled for dynamic
+ * obstacles. Rebuild with Graph::Freeze() after structural changes.
+ * Nodes with negative IDs (and edges to them) are not included.
+ */
+class CompactGraph {
+public:
+    using Index = uint32_t;
+    static constexpr Index INVALID_INDEX = std::numeric_limits<Index>::max();
+
+    CompactGraph() = default;
+    explicit CompactGraph(const Graph& graph);
+
+    /**
+     * @brief Number of nodes / directed edges
+     */
+    [[nodiscard]] size_t GetNodeCount() const noexcept { return m_positions.size(); }
+    [[nodiscard]] size_t GetEdgeCount() const noexcept { return m_edgeTargets.size(); }
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_positions.empty(); }
+
+    /**
+     * @brief Map a Graph node ID to its dense index
+     * @return Dense index or INVALID_INDEX if the ID was not in the graph
+     */
+    [[nodiscard]] Index ToIndex(int nodeId) const noexcept {
+        if (nodeId < 0 || static_cast<size_t>(nodeId) >= m_indexById.size()) {
+            return INVALID_INDEX;
+        }
+        return m_indexById[static_cast<size_t>(nodeId)];
+    }
+
+    /**
+     * @brief Map a dense index back to the Graph node ID
+     */
+    [[nodiscard]] int ToNodeId(Index index) const noexcept { return m_nodeIds[index]; }
+
+    [[nodiscard]] const glm::vec3& GetPosition(Index index) const noexcept { return m_positions[index]; }
+
+    [[nodiscard]] bool IsWalkable(Index index) const noexcept { return m_walkable[index] != 0; }
+    void SetWalkable(Index index, bool walkable) noexcept { m_walkable[index] = walkable ? 1 : 0; }
+
+    /**
+     * @brief Edge range of a node: [EdgeBegin, EdgeEnd)
+     */
+    [[nodiscard]] Index EdgeBegin(Index index) const noexcept { return m_edgeOffsets[index]; }
+    [[nodiscard]] Index EdgeEnd(Index index) const noexcept { return m_edgeOffsets[index + 1]; }
+
+    [[nodiscard]] Index GetEdgeTarget(Index edge) const noexcept { return m_edgeTargets[edge]; }
+    [[nodiscard]] float GetEdgeWeightAt(Index edge) const noexcept { return m_edgeWeights[edge]; }
+
+    /**
+     * @brief Neighbor indices and matching edge weights of a node
+     */
+    [[nodiscard]] std::span<const Index> GetNeighbors(Index index) const noexcept {
+        return {m_edgeTargets.data() + EdgeBegin(index), EdgeEnd(index) - EdgeBegin(index)};
+    }
+    [[nodiscard]] std::span<const float> GetEdgeWeights(Index index) const noexcept {
+        return {m_edgeWeights.data() + EdgeBegin(index), EdgeEnd(index) - EdgeBegin(index)};
+    }
+
+    /**
+     * @brief Weight of the edge from -> to (linear scan of from's edges)
+     * @return Edge weight or infinity if no edge exists
+     */
+    [[nodiscard]] float GetEdgeWeight(Index from, Index to) const noexcept;
+
+private:
+    std::vector<glm::vec3> m_positions;
+    std::vector<uint8_t> m_walkable;
+    std::vector<Index> m_edgeOffsets;   // GetNodeCount() + 1 entries
+    std::vector<Index> m_edgeTargets;
+    std::vector<float> m_edgeWeights;
+
+    std::vector<int> m_nodeIds;         // Dense index -> Graph node ID
+    std::vector<Index> m_indexById;     // Graph node ID -> dense index
+};
+
+/**
+ * @brief Limits for a search on a CompactGraph
+ */
+struct CompactSearchParams {
+    float heuristicWeight = 1.0f;       // Weight for heuristic (>1 = faster but less optimal)
+    int maxNodesExplored = -1;          // Max nodes to explore (-1 = unlimited)
+    float maxSearchDistance = -1.0f;    // Max path cost to expand (-1 = unlimited)
+};
+
+/**
+ * @brief Outcome of a search on a CompactGraph
+ */
+struct CompactSearchResult {
+    bool found = false;
+    float totalCost = 0.0f;
+    int nodesExplored = 0;
+
+    [[nodiscard]] explicit operator bool() const noexcept { return found; }
+};
+
+/**
+ * @brief Reusable A* state for searches on a CompactGraph
+ *
+ * Per-node state is stamped with a search generation, so starting a search
+ * is O(1) instead of clearing every node. The open set is an indexed binary
+ * heap with decrease-key. Once the buffers have grown to the graph size,
+ * searches perform no heap allocations (the output path vector is reused
+ * by the caller). A context is not thread-safe; use one per thread, e.g.
+ * ForCurrentThread().
+ */
+class AStarSearchContext {
+public:
+    using Index = CompactGraph::Index;
+
+    AStarSearchContext() = default;
+
+    /**
+     * @brief Context owned by the calling thread
+     */
+    [[nodiscard]] static AStarSearchContext& ForCurrentThread();
+
+    /**
+     * @brief A* from start to goal (dense indices) with a custom heuristic
+     * @param outPath Receives the dense node indices from start to goal
+     */
+    template<HeuristicFunction H>
+    CompactSearchResult FindPath(
+        const CompactGraph& graph,
+        Index start,
+        Index goal,
+        H&& heuristic,
+        const CompactSearchParams& params,
+        std::vector<Index>& outPath);
+
+    /**
+     * @brief A* restricted to nodes accepted by a filter
+     *
+     * The filter is a predicate on dense indices; rejected nodes are treated
+     * as unwalkable (the start node is not tested).
+     */
+    template<HeuristicFunction H, std::predicate<Index> NodeFilter>
+    CompactSearchResult FindPath(
+        const CompactGraph& graph,
+        Index start,
+        Index goal,
+        H&& heuristic,
+        NodeFilter&& filter,
+        const CompactSearchParams& params,
+        std::vector<Index>& outPath);
+
+    /**
+     * @brief A* with the Euclidean distance heuristic
+     */
+    CompactSearchResult FindPath(
+        const CompactGraph& graph,
+        Index start,
+        Index goal,
+        const CompactSearchParams& params,
+        std::vector<Index>& outPath);
+
+    /**
+     * @brief Dijkstra flood from start over nodes accepted by a filter
+     *
+     * Settles every reachable node (up to maxCost if positive), so GetCost()
+     * afterwards returns exact one-to-many costs.
+     *
+     * @return Number of nodes settled
+     */
+    template<std::predicate<Index> NodeFilter>
+    int ExpandAll(const CompactGraph& graph, Index start, NodeFilter&& filter, float maxCost = -1.0f);
+
+    /**
+     * @brief Cost from the last search's start to a node
+     *
+     * Exact for settled nodes; infinity if the node was not reached.
+     * Valid until the next search on this context.
+     */
+    [[nodiscard]] float GetCost(Index node) const noexcept {
+        if (node >= m_nodes.size() || m_nodes[node].generation != m_generation) {
+            return std::numeric_limits<float>::infinity();
+        }
+        return m_nodes[node].gCost;
+    }
+
+private:
+    static constexpr uint32_t kClosed = std::numeric_limits<uint32_t>::max();
+
+    struct NodeState {
+        float gCost = 0.0f;
+        Index parent = CompactGraph::INVALID_INDEX;
+        uint32_t generation = 0;   // State is valid only when equal to m_generation
+        uint32_t heapSlot = kClosed;
+    };
+
+    struct HeapEntry {
+        float fCost;
+        float gCost;
+        Index node;
+    };
+
+    void BeginSearch(size_t nodeCount);
+    void Push(Index node, float fCost, float gCost);
+    void DecreaseKey(uint32_t slot, float fCost, float gCost);
+    HeapEntry PopMin();
+    void SiftUp(uint32_t slot);
+    void SiftDown(uint32_t slot);
+    void Place(uint32_t slot, const HeapEntry& entry);
+
+    // Lower f first; on ties prefer the deeper node (higher g)
+    [[nodiscard]] static bool Before(const HeapEntry& a, const HeapEntry& b) noexcept {
+        return a.fCost < b.fCost || (a.fCost == b.fCost && a.gCost > b.gCost);
+    }
+
+    template<typename H, typename NodeFilter>
+    CompactSearchResult Search(
+        const CompactGraph& graph,
+        Index start,
+        Index goal,
+        H& heuristic,
+        NodeFilter& filter,
+        const CompactSearchParams& params);
+
+    void ReconstructPath(Index start, Index goal, std::vector<Index>& outPath) const;
+
+    std::vector<NodeState> m_nodes;
+    std::vector<HeapEntry> m_heap;
+    uint32_t m_generation = 0;
+};
+
+// ============================================================================
+// AStarSearchContext template implementation
+// ============================================================================
+
+template<HeuristicFunction H>
+CompactSearchResult AStarSearchContext::FindPath(
+    const CompactGraph& graph,
+    Index start,
+    Index goal,
+    H&& heuristic,
+    const CompactSearchParams& params,
+    std::vector<Index>& outPath) {
+
+    return FindPath(graph, start, goal, std::forward<H>(heuristic),
+        [](Index) { return true; }, params, outPath);
+}
+
+template<HeuristicFunction H, std::predicate<CompactGraph::Index> NodeFilter>
+CompactSearchResult AStarSearchContext::FindPath(
+    const CompactGraph& graph,
+    Index start,
+    Index goal,
+    H&& heuristic,
+    NodeFilter&& filter,
+    const CompactSearchParams& params,
+    std::vector<Index>& outPath) {
+
+    outPath.clear();
+    if (goal >= graph.GetNodeCount()) {
+        return CompactSearchResult{};
+    }
+
+    CompactSearchResult result = Search(graph, start, goal, heuristic, filter, params);
+    if (result.found) {
+        ReconstructPath(start, goal, outPath);
+    }
+    return result;
+}
+
+template<std::predicate<CompactGraph::Index> NodeFilter>
+int AStarSearchContext::ExpandAll(const CompactGraph& graph, Index start, NodeFilter&& filter, float maxCost) {
+    auto noHeuristic = [](const glm::vec3&, const glm::vec3&) { return 0.0f; };
+    CompactSearchParams params;
+    params.maxSearchDistance = maxCost;
+    return Search(graph, start, CompactGraph::INVALID_INDEX, noHeuristic, filter, params).nodesExplored;
+}
+
+template<typename H, typename NodeFilter>
+CompactSearchResult AStarSearchContext::Search(
+    const CompactGraph& graph,
+    Index start,
+    Index goal,
+    H& heuristic,
+    NodeFilter& filter,
+    const CompactSearchParams& params) {
+
+    CompactSearchResult result;
+
+    // goal == INVALID_INDEX floods every reachable node
+    const size_t nodeCount = graph.GetNodeCount();
+    const bool hasGoal = goal != CompactGraph::INVALID_INDEX;
+    if (start >= nodeCount || (hasGoal && goal >= nodeCount)) {
+        return result;
+    }
+    if (!graph.IsWalkable(start) || (hasGoal && !graph.IsWalkable(goal))) {
+        return result;
+    }
+
+    BeginSearch(nodeCount);
+    const glm::vec3 goalPosition = hasGoal ? graph.GetPosition(goal) : graph.GetPosition(start);
+    const float weight = params.heuristicWeight;
+
+    NodeState& startState = m_nodes[start];
+    startState.generation = m_generation;
+    startState.gCost = 0.0f;
+    startState.parent = CompactGraph::INVALID_INDEX;
+    Push(start, heuristic(graph.GetPosition(start), goalPosition) * weight, 0.0f);
+
+    while (!m_heap.empty()) {
+        const HeapEntry current = PopMin();
+        ++result.nodesExplored;
+
+        // Found goal (before the limit, so reaching it on the last allowed expansion counts)
+        if (current.node == goal) {
+            result.found = true;
+            result.totalCost = current.gCost;
+            return result;
+        }
+
+        // Check search limits
+        if (params.maxNodesExplored > 0 && result.nodesExplored >= params.maxNodesExplored) {
+            break;
+        }
+
+        if (params.maxSearchDistance > 0.0f && current.gCost > params.maxSearchDistance) {
+            continue;
+        }
+
+        const Index edgeEnd = graph.EdgeEnd(current.node);
+        for (Index edge = graph.EdgeBegin(current.node); edge < edgeEnd; ++edge) {
+            const Index neighbor = graph.GetEdgeTarget(edge);
+            NodeState& state = m_nodes[neighbor];
+            const bool seen = state.generation == m_generation;
+
+            if (seen && state.heapSlot == kClosed) continue;
+            if (!graph.IsWalkable(neighbor) || !filter(neighbor)) continue;
+
+            const float tentativeG = current.gCost + graph.GetEdgeWeightAt(edge);
+
+            if (!seen) {
+                state.generation = m_generation;
+                state.gCost = tentativeG;
+                state.parent = current.node;
+                const float h = heuristic(graph.GetPosition(neighbor), goalPosition) * weight;
+                Push(neighbor, tentativeG + h, tentativeG);
+            } else if (tentativeG < state.gCost) {
+                // Better route to an open node; its h is unchanged
+                const HeapEntry& entry = m_heap[state.heapSlot];
+                const float h = entry.fCost - entry.gCost;
+                state.gCost = tentativeG;
+                state.parent = current.node;
+                DecreaseKey(state.heapSlot, tentativeG + h, tentativeG);
+            }
+        }
+    }
+
+    return result;
+}
+
+} // namespace Nova
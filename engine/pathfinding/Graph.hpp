@@ -14,6 +14,7 @@ namespace Nova {
 
 // Forward declarations
 class Graph;
+class CompactGraph;
 struct PathNode;
 
 /**
@@ -259,6 +260,13 @@ public:
      */
     void SetSpatialIndexEnabled(bool enabled);
 
+    /**
+     * @brief Snapshot the graph into a contiguous CSR representation
+     *
+     * Use for static graphs queried many times; see CompactGraph.
+     */
+    [[nodiscard]] CompactGraph Freeze() const;
+
 private:
     std::unordered_map<int, PathNode> m_nodes;
     std::unordered_map<int, std::unordered_map<int, float>> m_weights;
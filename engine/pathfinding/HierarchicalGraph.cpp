@@ -0,0 +1,609 @@
+#include "pathfinding/HierarchicalGraph.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Nova {
+
+namespace {
+
+float Euclidean(const glm::vec3& a, const glm::vec3& b) {
+    return glm::distance(a, b);
+}
+
+/**
+ * @brief Walkable edge between two sectors, before entrances are grouped
+ */
+struct Crossing {
+    CompactGraph::Index a;
+    CompactGraph::Index b;
+    float costAB;
+    float costBA;
+};
+
+/**
+ * @brief Per-thread query scratch so FindPath does not allocate per call
+ */
+struct QueryScratch {
+    struct State {
+        float gCost;
+        uint32_t parent;
+        uint32_t generation;
+        bool closed;
+    };
+
+    struct OpenEntry {
+        float fCost;
+        float gCost;
+        uint32_t id;
+
+        // Min-heap on f; on ties prefer the deeper entry (higher g)
+        bool operator<(const OpenEntry& other) const {
+            return fCost > other.fCost || (fCost == other.fCost && gCost < other.gCost);
+        }
+    };
+
+    std::vector<State> states;
+    std::vector<OpenEntry> open;
+    std::vector<std::pair<uint32_t, float>> startCosts;
+    std::vector<std::pair<uint32_t, float>> goalCosts;
+    std::vector<uint32_t> abstractPath;
+    std::vector<CompactGraph::Index> waypoints;
+    std::vector<CompactGraph::Index> segment;
+    uint32_t generation = 0;
+
+    void Begin(size_t count) {
+        if (states.size() < count) {
+            states.resize(count, State{0.0f, 0, 0, false});
+        }
+        open.clear();
+        if (++generation == 0) {
+            for (State& state : states) state.generation = 0;
+            generation = 1;
+        }
+    }
+
+    State& Get(uint32_t id) {
+        State& state = states[id];
+        if (state.generation != generation) {
+            state = {std::numeric_limits<float>::infinity(), 0, generation, false};
+        }
+        return state;
+    }
+};
+
+thread_local QueryScratch t_scratch;
+
+} // namespace
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+HierarchicalGraph::HierarchicalGraph(const Graph& graph, const HierarchicalGraphConfig& config) {
+    Build(graph, config);
+}
+
+void HierarchicalGraph::Build(const Graph& graph, const HierarchicalGraphConfig& config) {
+    m_config = config;
+    m_base = graph.Freeze();
+
+    const size_t nodeCount = m_base.GetNodeCount();
+    m_sectorOf.assign(nodeCount, kInvalid);
+    m_portalOf.assign(nodeCount, kInvalid);
+    m_sectors.clear();
+    m_entrances.clear();
+    m_portals.clear();
+    m_freePortals.clear();
+    m_dirtySectors.clear();
+
+    // Assign nodes to sectors in dense order so IDs are deterministic
+    const float invSize = 1.0f / m_config.sectorSize;
+    std::unordered_map<int64_t, uint32_t> sectorByCell;
+    for (Index i = 0; i < nodeCount; ++i) {
+        const glm::vec3& position = m_base.GetPosition(i);
+        const int64_t x = static_cast<int64_t>(std::floor(position.x * invSize));
+        const int64_t z = static_cast<int64_t>(std::floor(position.z * invSize));
+        const int64_t key = (x << 32) ^ (z & 0xFFFFFFFF);
+
+        auto [it, inserted] = sectorByCell.try_emplace(key, static_cast<uint32_t>(m_sectors.size()));
+        if (inserted) {
+            m_sectors.emplace_back();
+        }
+        m_sectorOf[i] = it->second;
+    }
+
+    // Boundary nodes and sector adjacency come from the fixed topology
+    for (Index i = 0; i < nodeCount; ++i) {
+        const uint32_t sector = m_sectorOf[i];
+        bool boundary = false;
+        for (Index neighbor : m_base.GetNeighbors(i)) {
+            const uint32_t other = m_sectorOf[neighbor];
+            if (other != sector) {
+                boundary = true;
+                m_sectors[sector].neighbors.push_back(other);
+                m_sectors[other].neighbors.push_back(sector);
+            }
+        }
+        if (boundary) {
+            m_sectors[sector].boundary.push_back(i);
+        }
+    }
+
+    for (size_t s = 0; s < m_sectors.size(); ++s) {
+        auto& neighbors = m_sectors[s].neighbors;
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        MarkDirty(static_cast<uint32_t>(s));
+    }
+
+    Update();
+}
+
+// ============================================================================
+// Incremental Updates
+// ============================================================================
+
+void HierarchicalGraph::SetNodeWalkable(int nodeId, bool walkable) {
+    const Index index = m_base.ToIndex(nodeId);
+    if (index == CompactGraph::INVALID_INDEX || m_base.IsWalkable(index) == walkable) {
+        return;
+    }
+
+    m_base.SetWalkable(index, walkable);
+    MarkDirty(m_sectorOf[index]);
+}
+
+void HierarchicalGraph::MarkDirty(uint32_t sector) {
+    if (!m_sectors[sector].dirty) {
+        m_sectors[sector].dirty = true;
+        m_dirtySectors.push_back(sector);
+    }
+}
+
+void HierarchicalGraph::Update() {
+    if (m_dirtySectors.empty()) {
+        return;
+    }
+
+    // Entrances touching a dirty sector first, so every affected sector sees
+    // its final portal set when its costs are recomputed
+    std::vector<uint32_t> affected;
+    for (uint32_t sector : m_dirtySectors) {
+        affected.push_back(sector);
+        for (uint32_t neighbor : m_sectors[sector].neighbors) {
+            if (sector < neighbor || !m_sectors[neighbor].dirty) {
+                RebuildEntrances(sector, neighbor);
+            }
+            affected.push_back(neighbor);
+        }
+    }
+
+    std::sort(affected.begin(), affected.end());
+    affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+    for (uint32_t sector : affected) {
+        RebuildPortalCosts(sector);
+    }
+
+    for (uint32_t sector : m_dirtySectors) {
+        m_sectors[sector].dirty = false;
+    }
+    m_dirtySectors.clear();
+    m_lastUpdatedSectors = affected.size();
+}
+
+void HierarchicalGraph::RebuildEntrances(uint32_t sectorA, uint32_t sectorB) {
+    const uint32_t low = std::min(sectorA, sectorB);
+    const uint32_t high = std::max(sectorA, sectorB);
+
+    std::vector<EntranceLink>& links = m_entrances[PairKey(low, high)];
+    for (const EntranceLink& link : links) {
+        ReleasePortal(link.nodeA);
+        ReleasePortal(link.nodeB);
+    }
+    links.clear();
+
+    // Gather walkable crossings in both directions
+    constexpr float kInf = std::numeric_limits<float>::infinity();
+    std::vector<Crossing> crossings;
+    auto findCrossing = [&crossings](Index a, Index b) -> Crossing* {
+        for (Crossing& crossing : crossings) {
+            if (crossing.a == a && crossing.b == b) return &crossing;
+        }
+        return nullptr;
+    };
+
+    for (Index u : m_sectors[low].boundary) {
+        if (!m_base.IsWalkable(u)) continue;
+        for (Index edge = m_base.EdgeBegin(u); edge < m_base.EdgeEnd(u); ++edge) {
+            const Index v = m_base.GetEdgeTarget(edge);
+            if (m_sectorOf[v] != high || !m_base.IsWalkable(v)) continue;
+            crossings.push_back({u, v, m_base.GetEdgeWeightAt(edge), kInf});
+        }
+    }
+    for (Index v : m_sectors[high].boundary) {
+        if (!m_base.IsWalkable(v)) continue;
+        for (Index edge = m_base.EdgeBegin(v); edge < m_base.EdgeEnd(v); ++edge) {
+            const Index u = m_base.GetEdgeTarget(edge);
+            if (m_sectorOf[u] != low || !m_base.IsWalkable(u)) continue;
+            if (Crossing* crossing = findCrossing(u, v)) {
+                crossing->costBA = m_base.GetEdgeWeightAt(edge);
+            } else {
+                crossings.push_back({u, v, kInf, m_base.GetEdgeWeightAt(edge)});
+            }
+        }
+    }
+
+    if (crossings.empty()) {
+        return;
+    }
+
+    // Group crossings whose endpoints are shared or adjacent into entrances
+    auto adjacent = [this](Index x, Index y) {
+        return x == y ||
+            std::isfinite(m_base.GetEdgeWeight(x, y)) ||
+            std::isfinite(m_base.GetEdgeWeight(y, x));
+    };
+
+    std::vector<size_t> parent(crossings.size());
+    std::iota(parent.begin(), parent.end(), size_t{0});
+    auto find = [&parent](size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    for (size_t i = 0; i < crossings.size(); ++i) {
+        for (size_t j = i + 1; j < crossings.size(); ++j) {
+            if (adjacent(crossings[i].a, crossings[j].a) || adjacent(crossings[i].b, crossings[j].b)) {
+                parent[find(i)] = find(j);
+            }
+        }
+    }
+
+    std::vector<size_t> members;
+    for (size_t root = 0; root < crossings.size(); ++root) {
+        if (find(root) != root) continue;
+
+        members.clear();
+        glm::vec3 centroid(0.0f);
+        for (size_t i = 0; i < crossings.size(); ++i) {
+            if (find(i) == root) {
+                members.push_back(i);
+                centroid += m_base.GetPosition(crossings[i].a);
+            }
+        }
+        centroid /= static_cast<float>(members.size());
+
+        // Prefer crossings near the reference point, then the shortest edge
+        auto closestTo = [&](const glm::vec3& point, bool farthest) {
+            size_t best = members.front();
+            float bestScore = farthest ? -1.0f : kInf;
+            for (size_t i : members) {
+                const Crossing& c = crossings[i];
+                const float d = glm::distance(m_base.GetPosition(c.a), point);
+                const float score = d + 1e-3f * glm::distance(m_base.GetPosition(c.a), m_base.GetPosition(c.b));
+                if (farthest ? d > bestScore : score < bestScore) {
+                    best = i;
+                    bestScore = farthest ? d : score;
+                }
+            }
+            return best;
+        };
+
+        size_t distinctNodes = 0;
+        for (size_t k = 0; k < members.size(); ++k) {
+            bool seen = false;
+            for (size_t m = 0; m < k && !seen; ++m) {
+                seen = crossings[members[m]].a == crossings[members[k]].a;
+            }
+            distinctNodes += seen ? 0 : 1;
+        }
+
+        size_t chosen[2] = {closestTo(centroid, false), crossings.size()};
+        if (static_cast<int>(distinctNodes) > m_config.maxEntranceWidth) {
+            // Wide entrance: one portal at each end
+            chosen[0] = closestTo(centroid, true);
+            chosen[1] = closestTo(m_base.GetPosition(crossings[chosen[0]].a), true);
+        }
+
+        for (size_t pick : chosen) {
+            if (pick >= crossings.size()) continue;
+            const Crossing& c = crossings[pick];
+            links.push_back({c.a, c.b, c.costAB, c.costBA});
+            AcquirePortal(c.a);
+            AcquirePortal(c.b);
+        }
+    }
+}
+
+void HierarchicalGraph::RebuildPortalCosts(uint32_t sectorId) {
+    Sector& sector = m_sectors[sectorId];
+
+    sector.portals.clear();
+    for (uint32_t neighbor : sector.neighbors) {
+        auto it = m_entrances.find(PairKey(sectorId, neighbor));
+        if (it == m_entrances.end()) continue;
+
+        for (const EntranceLink& link : it->second) {
+            const uint32_t portal = m_portalOf[sectorId < neighbor ? link.nodeA : link.nodeB];
+            if (std::find(sector.portals.begin(), sector.portals.end(), portal) == sector.portals.end()) {
+                sector.portals.push_back(portal);
+            }
+        }
+    }
+
+    AStarSearchContext& context = AStarSearchContext::ForCurrentThread();
+    auto inSector = [this, sectorId](Index i) { return m_sectorOf[i] == sectorId; };
+
+    for (uint32_t id : sector.portals) {
+        Portal& portal = m_portals[id];
+        portal.edges.clear();
+
+        // Intra-sector costs to the other portals
+        context.ExpandAll(m_base, portal.node, inSector);
+        for (uint32_t other : sector.portals) {
+            if (other == id) continue;
+            const float cost = context.GetCost(m_portals[other].node);
+            if (std::isfinite(cost)) {
+                portal.edges.push_back({other, cost});
+            }
+        }
+
+        // Inter-sector links leaving this portal
+        for (uint32_t neighbor : sector.neighbors) {
+            auto it = m_entrances.find(PairKey(sectorId, neighbor));
+            if (it == m_entrances.end()) continue;
+
+            const bool lowSide = sectorId < neighbor;
+            for (const EntranceLink& link : it->second) {
+                if ((lowSide ? link.nodeA : link.nodeB) != portal.node) continue;
+                const float cost = lowSide ? link.costAB : link.costBA;
+                if (std::isfinite(cost)) {
+                    portal.edges.push_back({m_portalOf[lowSide ? link.nodeB : link.nodeA], cost});
+                }
+            }
+        }
+    }
+}
+
+uint32_t HierarchicalGraph::AcquirePortal(Index node) {
+    uint32_t id = m_portalOf[node];
+    if (id == kInvalid) {
+        if (!m_freePortals.empty()) {
+            id = m_freePortals.back();
+            m_freePortals.pop_back();
+        } else {
+            id = static_cast<uint32_t>(m_portals.size());
+            m_portals.emplace_back();
+        }
+
+        Portal& portal = m_portals[id];
+        portal.node = node;
+        portal.sector = m_sectorOf[node];
+        portal.refCount = 0;
+        portal.edges.clear();
+        m_portalOf[node] = id;
+    }
+
+    ++m_portals[id].refCount;
+    return id;
+}
+
+void HierarchicalGraph::ReleasePortal(Index node) {
+    const uint32_t id = m_portalOf[node];
+    if (id == kInvalid) return;
+
+    Portal& portal = m_portals[id];
+    if (--portal.refCount == 0) {
+        portal.node = CompactGraph::INVALID_INDEX;
+        portal.sector = kInvalid;
+        portal.edges.clear();
+        m_portalOf[node] = kInvalid;
+        m_freePortals.push_back(id);
+    }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+PathResult HierarchicalGraph::FindPath(int startId, int goalId, bool refine) const {
+    PathResult result;
+
+    const Index start = m_base.ToIndex(startId);
+    const Index goal = m_base.ToIndex(goalId);
+    if (start == CompactGraph::INVALID_INDEX || goal == CompactGraph::INVALID_INDEX) {
+        return result;
+    }
+    if (!m_base.IsWalkable(start) || !m_base.IsWalkable(goal)) {
+        return result;
+    }
+
+    QueryScratch& scratch = t_scratch;
+    AStarSearchContext& context = AStarSearchContext::ForCurrentThread();
+    const uint32_t startSector = m_sectorOf[start];
+    const uint32_t goalSector = m_sectorOf[goal];
+
+    auto appendNode = [this, &result](Index node) {
+        result.nodeIds.push_back(m_base.ToNodeId(node));
+        result.positions.push_back(m_base.GetPosition(node));
+    };
+
+    // Same sector: try the local search before going through portals
+    if (startSector == goalSector) {
+        auto inSector = [this, startSector](Index i) { return m_sectorOf[i] == startSector; };
+        const CompactSearchResult local =
+            context.FindPath(m_base, start, goal, Euclidean, inSector, {}, scratch.segment);
+        result.nodesExplored += local.nodesExplored;
+
+        if (local.found) {
+            result.found = true;
+            result.totalCost = local.totalCost;
+            for (Index node : scratch.segment) appendNode(node);
+            return result;
+        }
+    }
+
+    // Connect start and goal to the portals of their sectors
+    scratch.startCosts.clear();
+    auto inStartSector = [this, startSector](Index i) { return m_sectorOf[i] == startSector; };
+    result.nodesExplored += context.ExpandAll(m_base, start, inStartSector);
+    for (uint32_t portal : m_sectors[startSector].portals) {
+        const float cost = context.GetCost(m_portals[portal].node);
+        if (std::isfinite(cost)) {
+            scratch.startCosts.emplace_back(portal, cost);
+        }
+    }
+
+    scratch.goalCosts.clear();
+    auto inGoalSector = [this, goalSector](Index i) { return m_sectorOf[i] == goalSector; };
+    for (uint32_t portal : m_sectors[goalSector].portals) {
+        const CompactSearchResult toGoal = context.FindPath(
+            m_base, m_portals[portal].node, goal, Euclidean, inGoalSector, {}, scratch.segment);
+        result.nodesExplored += toGoal.nodesExplored;
+        if (toGoal.found) {
+            scratch.goalCosts.emplace_back(portal, toGoal.totalCost);
+        }
+    }
+
+    if (scratch.startCosts.empty() || scratch.goalCosts.empty()) {
+        return result;
+    }
+
+    // A* over portals with virtual start and goal nodes
+    const uint32_t virtualStart = static_cast<uint32_t>(m_portals.size());
+    const uint32_t virtualGoal = virtualStart + 1;
+    const glm::vec3& goalPosition = m_base.GetPosition(goal);
+
+    scratch.Begin(m_portals.size() + 2);
+    auto relax = [&scratch](uint32_t id, uint32_t parent, float gCost, float hCost) {
+        QueryScratch::State& state = scratch.Get(id);
+        if (state.closed || gCost >= state.gCost) return;
+        state.gCost = gCost;
+        state.parent = parent;
+        scratch.open.push_back({gCost + hCost, gCost, id});
+        std::push_heap(scratch.open.begin(), scratch.open.end());
+    };
+
+    for (const auto& [portal, cost] : scratch.startCosts) {
+        relax(portal, virtualStart, cost, Euclidean(m_base.GetPosition(m_portals[portal].node), goalPosition));
+    }
+
+    bool reached = false;
+    while (!scratch.open.empty()) {
+        std::pop_heap(scratch.open.begin(), scratch.open.end());
+        const QueryScratch::OpenEntry current = scratch.open.back();
+        scratch.open.pop_back();
+
+        QueryScratch::State& state = scratch.Get(current.id);
+        if (state.closed) continue;
+        state.closed = true;
+        ++result.nodesExplored;
+
+        if (current.id == virtualGoal) {
+            reached = true;
+            break;
+        }
+
+        const Portal& portal = m_portals[current.id];
+        if (portal.sector == goalSector) {
+            for (const auto& [goalPortal, cost] : scratch.goalCosts) {
+                if (goalPortal == current.id) {
+                    relax(virtualGoal, current.id, current.gCost + cost, 0.0f);
+                }
+            }
+        }
+
+        for (const AbstractEdge& edge : portal.edges) {
+            const float h = Euclidean(m_base.GetPosition(m_portals[edge.target].node), goalPosition);
+            relax(edge.target, current.id, current.gCost + edge.cost, h);
+        }
+    }
+
+    if (!reached) {
+        return result;
+    }
+
+    scratch.abstractPath.clear();
+    for (uint32_t id = scratch.Get(virtualGoal).parent; id != virtualStart; id = scratch.Get(id).parent) {
+        scratch.abstractPath.push_back(id);
+    }
+    std::reverse(scratch.abstractPath.begin(), scratch.abstractPath.end());
+
+    scratch.waypoints.clear();
+    scratch.waypoints.push_back(start);
+    for (uint32_t id : scratch.abstractPath) {
+        if (m_portals[id].node != scratch.waypoints.back()) {
+            scratch.waypoints.push_back(m_portals[id].node);
+        }
+    }
+    if (goal != scratch.waypoints.back()) {
+        scratch.waypoints.push_back(goal);
+    }
+
+    result.found = true;
+    if (!refine) {
+        result.totalCost = scratch.Get(virtualGoal).gCost;
+        for (Index node : scratch.waypoints) appendNode(node);
+        return result;
+    }
+
+    // Refine each corridor segment on the base graph
+    appendNode(start);
+    for (size_t i = 1; i < scratch.waypoints.size(); ++i) {
+        const Index from = scratch.waypoints[i - 1];
+        const Index to = scratch.waypoints[i];
+        const uint32_t sector = m_sectorOf[from];
+
+        if (sector != m_sectorOf[to]) {
+            // Entrance link: a single base edge
+            result.totalCost += m_base.GetEdgeWeight(from, to);
+            appendNode(to);
+            continue;
+        }
+
+        auto inSector = [this, sector](Index n) { return m_sectorOf[n] == sector; };
+        const CompactSearchResult segment =
+            context.FindPath(m_base, from, to, Euclidean, inSector, {}, scratch.segment);
+        result.nodesExplored += segment.nodesExplored;
+        if (!segment.found) {
+            // Stale abstract graph (Update() not called after changes)
+            return PathResult{};
+        }
+
+        result.totalCost += segment.totalCost;
+        for (size_t n = 1; n < scratch.segment.size(); ++n) {
+            appendNode(scratch.segment[n]);
+        }
+    }
+
+    return result;
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+HierarchicalGraphStats HierarchicalGraph::GetStats() const {
+    HierarchicalGraphStats stats;
+    stats.sectorCount = m_sectors.size();
+    stats.portalCount = m_portals.size() - m_freePortals.size();
+    for (const Portal& portal : m_portals) {
+        stats.abstractEdgeCount += portal.edges.size();
+    }
+    stats.lastUpdatedSectors = m_lastUpdatedSectors;
+    return stats;
+}
+
+int HierarchicalGraph::GetSector(int nodeId) const noexcept {
+    const Index index = m_base.ToIndex(nodeId);
+    if (index == CompactGraph::INVALID_INDEX) {
+        return -1;
+    }
+    return static_cast<int>(m_sectorOf[index]);
+}
+
+} // namespace Nova
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "pathfinding/CompactGraph.hpp"
+#include "pathfinding/Pathfinder.hpp"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <glm/glm.hpp>
+
+namespace Nova {
+
+/**
+ * @brief Configuration for hierarchical (HPA*) pathfinding
+ */
+struct HierarchicalGraphConfig {
+    float sectorSize = 16.0f;       // Sector edge length on the XZ plane (world units)
+    int maxEntranceWidth = 6;       // Entrances wider than this get a portal at each end
+};
+
+/**
+ * @brief Size of the abstract graph and of the last incremental update
+ */
+struct HierarchicalGraphStats {
+    size_t sectorCount = 0;
+    size_t portalCount = 0;
+    size_t abstractEdgeCount = 0;
+    size_t lastUpdatedSectors = 0;  // Sectors whose portal costs were recomputed by the last Update()
+};
+
+/**
+ * @brief Hierarchical pathfinding (HPA*) over a frozen navigation graph
+ *
+ * Nodes are clustered into square XZ sectors. Runs of walkable edges that
+ * cross a sector boundary form entrances, each represented by one or two
+ * portal node pairs. Portal-to-portal costs inside a sector are precomputed,
+ * so a query searches the small abstract graph of portals and then refines
+ * only the sectors along the chosen corridor on the base graph.
+ *
+ * Walkability changes mark their sector dirty; Update() recomputes only the
+ * entrances of dirty sectors and the portal costs of those sectors and their
+ * neighbors. Paths are near-optimal (portals constrain where sector borders
+ * are crossed).
+ *
+ * Queries are const and use per-thread scratch, so they may run concurrently
+ * between Update() calls.
+ */
+class HierarchicalGraph {
+public:
+    using Index = CompactGraph::Index;
+
+    HierarchicalGraph() = default;
+    explicit HierarchicalGraph(const Graph& graph, const HierarchicalGraphConfig& config = {});
+
+    /**
+     * @brief Rebuild the hierarchy from a graph
+     */
+    void Build(const Graph& graph, const HierarchicalGraphConfig& config = {});
+
+    /**
+     * @brief Change a node's walkable state and mark its sector dirty
+     */
+    void SetNodeWalkable(int nodeId, bool walkable);
+
+    /**
+     * @brief Recompute portals and costs of dirty sectors
+     *
+     * Call after a batch of SetNodeWalkable() changes, before querying.
+     */
+    void Update();
+
+    [[nodiscard]] bool HasPendingChanges() const noexcept { return !m_dirtySectors.empty(); }
+
+    /**
+     * @brief Find a path between two nodes of the source graph
+     * @param refine Expand to base graph nodes; if false only the start,
+     *               portal waypoints and goal are returned
+     * @return Path result (nodesExplored counts abstract and refinement work)
+     */
+    [[nodiscard]] PathResult FindPath(int startId, int goalId, bool refine = true) const;
+
+    [[nodiscard]] const CompactGraph& GetBaseGraph() const noexcept { return m_base; }
+    [[nodiscard]] const HierarchicalGraphConfig& GetConfig() const noexcept { return m_config; }
+    [[nodiscard]] HierarchicalGraphStats GetStats() const;
+
+    /**
+     * @brief Sector of a source graph node (-1 if unknown)
+     */
+    [[nodiscard]] int GetSector(int nodeId) const noexcept;
+
+private:
+    static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+
+    struct AbstractEdge {
+        uint32_t target;    // Portal ID
+        float cost;
+    };
+
+    struct Portal {
+        Index node = CompactGraph::INVALID_INDEX;
+        uint32_t sector = kInvalid;
+        uint32_t refCount = 0;  // Entrance links using this node
+        std::vector<AbstractEdge> edges;
+    };
+
+    /**
+     * @brief Portal pair crossing the boundary between two sectors
+     *
+     * nodeA lies in the lower-numbered sector of the pair.
+     */
+    struct EntranceLink {
+        Index nodeA;
+        Index nodeB;
+        float costAB;       // Infinity if the edge is one-way B -> A
+        float costBA;
+    };
+
+    struct Sector {
+        std::vector<Index> boundary;        // Nodes with an edge into another sector
+        std::vector<uint32_t> neighbors;    // Adjacent sector IDs
+        std::vector<uint32_t> portals;      // Portal IDs inside this sector
+        bool dirty = false;
+    };
+
+    [[nodiscard]] static uint64_t PairKey(uint32_t a, uint32_t b) noexcept {
+        if (a > b) std::swap(a, b);
+        return (static_cast<uint64_t>(a) << 32) | b;
+    }
+
+    void MarkDirty(uint32_t sector);
+    void RebuildEntrances(uint32_t sectorA, uint32_t sectorB);
+    void RebuildPortalCosts(uint32_t sector);
+    uint32_t AcquirePortal(Index node);
+    void ReleasePortal(Index node);
+
+    CompactGraph m_base;
+    HierarchicalGraphConfig m_config;
+
+    std::vector<uint32_t> m_sectorOf;           // Dense node index -> sector ID
+    std::vector<Sector> m_sectors;
+    std::unordered_map<uint64_t, std::vector<EntranceLink>> m_entrances;  // Keyed by PairKey
+
+    std::vector<uint32_t> m_portalOf;           // Dense node index -> portal ID
+    std::vector<Portal> m_portals;
+    std::vector<uint32_t> m_freePortals;
+
+    std::vector<uint32_t> m_dirtySectors;
+    size_t m_lastUpdatedSectors = 0;
+};
+
+} // namespace Nova
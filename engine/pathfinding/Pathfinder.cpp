@@ -1,6 +1,7 @@
 #include "pathfinding/Pathfinder.hpp"
 #define GLM_ENABLE_EXPERIMENTAL
 #include "pathfinding/Graph.hpp"
+#include "pathfinding/CompactGraph.hpp"
 #include <glm/gtx/norm.hpp>
 #include <queue>
 #include <stack>
@@ -67,6 +68,39 @@ PathResult Pathfinder::WeightedAStar(
     return AStarInternal(graph, startId, goalId, heuristic, weight, {});
 }
 
+PathResult Pathfinder::AStar(
+    const CompactGraph& graph,
+    int startId,
+    int goalId,
+    float weight) {
+
+    const CompactGraph::Index start = graph.ToIndex(startId);
+    const CompactGraph::Index goal = graph.ToIndex(goalId);
+
+    CompactSearchParams params;
+    params.heuristicWeight = weight;
+
+    thread_local std::vector<CompactGraph::Index> indices;
+    const CompactSearchResult search =
+        AStarSearchContext::ForCurrentThread().FindPath(graph, start, goal, params, indices);
+
+    PathResult result;
+    result.nodesExplored = search.nodesExplored;
+    if (!search.found) {
+        return result;
+    }
+
+    result.found = true;
+    result.totalCost = search.totalCost;
+    result.nodeIds.reserve(indices.size());
+    result.positions.reserve(indices.size());
+    for (CompactGraph::Index index : indices) {
+        result.nodeIds.push_back(graph.ToNodeId(index));
+        result.positions.push_back(graph.GetPosition(index));
+    }
+    return result;
+}
+
 PathResult Pathfinder::AStarInternal(
     const Graph& graph,
     int startId,
@@ -8,6 +8,7 @@
 namespace Nova {
 
 class Graph;
+class CompactGraph;
 class PathfindingContext;
 
 /**
@@ -127,6 +128,24 @@ public:
         float weight,
         HeuristicFunc heuristic = nullptr);
 
+    /**
+     * @brief A* on a frozen graph using the calling thread's search context
+     *
+     * Same results as AStar on the source Graph, without per-search node
+     * state allocation. Only the returned PathResult allocates.
+     *
+     * @param graph Frozen navigation graph (see Graph::Freeze)
+     * @param startId Starting node ID (as in the source Graph)
+     * @param goalId Target node ID (as in the source Graph)
+     * @param weight Heuristic weight (>1 for faster search)
+     * @return Path result
+     */
+    [[nodiscard]] static PathResult AStar(
+        const CompactGraph& graph,
+        int startId,
+        int goalId,
+        float weight = 1.0f);
+
     /**
      * @brief Dijkstra's algorithm (guaranteed shortest path)
      * @param graph The navigation graph
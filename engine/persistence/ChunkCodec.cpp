@@ -0,0 +1,356 @@
+#include "ChunkCodec.hpp"
+#include "WorldDatabase.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include <lz4.h>
+#include <zdict.h>
+#include <zstd.h>
+
+namespace Nova {
+
+// ============================================================================
+// NULL CODEC
+// ============================================================================
+
+bool NullChunkCodec::Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const {
+    output.assign(input.begin(), input.end());
+    return true;
+}
+
+bool NullChunkCodec::Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const {
+    if (input.size() != output.size()) return false;
+    if (!input.empty()) {
+        std::memcpy(output.data(), input.data(), input.size());
+    }
+    return true;
+}
+
+bool NullChunkCodec::IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const {
+    return size == input.size();
+}
+
+// ============================================================================
+// LZ4 CODEC
+// ============================================================================
+
+bool LZ4ChunkCodec::Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const {
+    if (input.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) return false;
+
+    output.resize(static_cast<size_t>(LZ4_compressBound(static_cast<int>(input.size()))));
+    const int written = LZ4_compress_fast(reinterpret_cast<const char*>(input.data()),
+                                          reinterpret_cast<char*>(output.data()),
+                                          static_cast<int>(input.size()),
+                                          static_cast<int>(output.size()), m_acceleration);
+    if (written <= 0) return false;
+    output.resize(static_cast<size_t>(written));
+    return true;
+}
+
+bool LZ4ChunkCodec::Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const {
+    if (input.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE) ||
+        output.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+        return false;
+    }
+    const int read = LZ4_decompress_safe(reinterpret_cast<const char*>(input.data()),
+                                         reinterpret_cast<char*>(output.data()),
+                                         static_cast<int>(input.size()),
+                                         static_cast<int>(output.size()));
+    return read >= 0 && static_cast<size_t>(read) == output.size();
+}
+
+bool LZ4ChunkCodec::IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const {
+    // An LZ4 block expands by at most 255x
+    return size / 255 <= input.size();
+}
+
+// ============================================================================
+// ZSTD CODEC
+// ============================================================================
+
+struct ZstdChunkCodec::Dictionary {
+    uint32_t id = 0;
+    ZSTD_CDict* compress = nullptr;
+    ZSTD_DDict* decompress = nullptr;
+
+    ~Dictionary() {
+        ZSTD_freeCDict(compress);
+        ZSTD_freeDDict(decompress);
+    }
+};
+
+namespace {
+
+// Contexts are reusable but not shareable; one pair per thread that codes chunks
+struct ZstdThreadContexts {
+    ZSTD_CCtx* compress = ZSTD_createCCtx();
+    ZSTD_DCtx* decompress = ZSTD_createDCtx();
+
+    ~ZstdThreadContexts() {
+        ZSTD_freeCCtx(compress);
+        ZSTD_freeDCtx(decompress);
+    }
+};
+
+ZstdThreadContexts& GetZstdContexts() {
+    thread_local ZstdThreadContexts contexts;
+    return contexts;
+}
+
+} // namespace
+
+ZstdChunkCodec::ZstdChunkCodec(int level)
+    : m_level(std::clamp(level, 1, ZSTD_maxCLevel())) {
+}
+
+ZstdChunkCodec::~ZstdChunkCodec() = default;
+
+bool ZstdChunkCodec::Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const {
+    std::shared_ptr<const Dictionary> dictionary;
+    {
+        std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+        auto world = m_worlds.find(m_activeWorld);
+        if (world != m_worlds.end()) {
+            dictionary = world->second.compression;
+        }
+    }
+
+    ZSTD_CCtx* context = GetZstdContexts().compress;
+    output.resize(ZSTD_compressBound(input.size()));
+    const size_t written = dictionary
+        ? ZSTD_compress_usingCDict(context, output.data(), output.size(), input.data(), input.size(),
+                                   dictionary->compress)
+        : ZSTD_compressCCtx(context, output.data(), output.size(), input.data(), input.size(), m_level);
+    if (ZSTD_isError(written)) return false;
+    output.resize(written);
+    return true;
+}
+
+bool ZstdChunkCodec::Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const {
+    ZSTD_DCtx* context = GetZstdContexts().decompress;
+
+    size_t read;
+    const uint32_t dictionaryId = ZSTD_getDictID_fromFrame(input.data(), input.size());
+    if (dictionaryId != 0) {
+        std::shared_ptr<const Dictionary> dictionary = FindDictionary(dictionaryId);
+        if (!dictionary) return false;
+        read = ZSTD_decompress_usingDDict(context, output.data(), output.size(), input.data(), input.size(),
+                                          dictionary->decompress);
+    } else {
+        read = ZSTD_decompressDCtx(context, output.data(), output.size(), input.data(), input.size());
+    }
+    return !ZSTD_isError(read) && read == output.size();
+}
+
+bool ZstdChunkCodec::IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const {
+    // Frames written by Compress() record their content size
+    const unsigned long long contentSize = ZSTD_getFrameContentSize(input.data(), input.size());
+    if (contentSize == ZSTD_CONTENTSIZE_ERROR) return false;
+    return contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize == size;
+}
+
+uint32_t ZstdChunkCodec::AddDictionary(std::span<const uint8_t> dictionary, int worldId) {
+    const uint32_t id = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+    if (id == 0) return 0;
+
+    auto entry = std::make_shared<Dictionary>();
+    entry->id = id;
+    entry->compress = ZSTD_createCDict(dictionary.data(), dictionary.size(), m_level);
+    entry->decompress = ZSTD_createDDict(dictionary.data(), dictionary.size());
+    if (!entry->compress || !entry->decompress) return 0;
+
+    std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+    WorldDictionaries& world = m_worlds[worldId];
+    world.byId[id] = entry;
+    world.compression = std::move(entry);
+    return id;
+}
+
+void ZstdChunkCodec::SetActiveWorld(int worldId) {
+    std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+    m_activeWorld = worldId;
+}
+
+int ZstdChunkCodec::GetActiveWorld() const {
+    std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+    return m_activeWorld;
+}
+
+bool ZstdChunkCodec::HasDictionary(uint32_t dictionaryId) const {
+    return FindDictionary(dictionaryId) != nullptr;
+}
+
+uint32_t ZstdChunkCodec::GetCompressionDictionaryId() const {
+    std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+    auto world = m_worlds.find(m_activeWorld);
+    return world != m_worlds.end() && world->second.compression ? world->second.compression->id : 0;
+}
+
+std::shared_ptr<const ZstdChunkCodec::Dictionary> ZstdChunkCodec::FindDictionary(uint32_t dictionaryId) const {
+    std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+    auto world = m_worlds.find(m_activeWorld);
+    if (world == m_worlds.end()) return nullptr;
+    auto it = world->second.byId.find(dictionaryId);
+    return it != world->second.byId.end() ? it->second : nullptr;
+}
+
+std::vector<uint8_t> ZstdChunkCodec::TrainDictionary(std::span<const std::span<const uint8_t>> samples,
+                                                     size_t capacity) {
+    // ZDICT wants the samples back to back
+    std::vector<uint8_t> joined;
+    std::vector<size_t> sizes;
+    sizes.reserve(samples.size());
+    for (std::span<const uint8_t> sample : samples) {
+        joined.insert(joined.end(), sample.begin(), sample.end());
+        sizes.push_back(sample.size());
+    }
+
+    std::vector<uint8_t> dictionary(capacity);
+    const size_t size = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), joined.data(),
+                                              sizes.data(), static_cast<unsigned>(sizes.size()));
+    if (ZDICT_isError(size)) return {};
+    dictionary.resize(size);
+    return dictionary;
+}
+
+// ============================================================================
+// BUFFER POOL
+// ============================================================================
+
+std::vector<uint8_t> ChunkBufferPool::Acquire(size_t size) {
+    const size_t bits = std::max<size_t>(std::bit_width(size > 0 ? size - 1 : 0), kMinClassBits);
+    const size_t sizeClass = bits - kMinClassBits;
+
+    if (sizeClass < kClassCount) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& freeList = m_free[sizeClass];
+        if (!freeList.empty()) {
+            std::vector<uint8_t> buffer = std::move(freeList.back());
+            freeList.pop_back();
+            m_reuses.fetch_add(1, std::memory_order_relaxed);
+            buffer.resize(size);
+            return buffer;
+        }
+    }
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    std::vector<uint8_t> buffer;
+    buffer.reserve(sizeClass < kClassCount ? size_t(1) << bits : size);
+    buffer.resize(size);
+    return buffer;
+}
+
+void ChunkBufferPool::Release(std::vector<uint8_t>&& buffer) {
+    // File under the largest class the capacity fully covers
+    const size_t capacity = buffer.capacity();
+    if (capacity < (size_t(1) << kMinClassBits)) return;
+    const size_t sizeClass = std::min<size_t>(std::bit_width(capacity) - 1 - kMinClassBits, kClassCount - 1);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& freeList = m_free[sizeClass];
+    if (freeList.size() < m_maxBuffersPerClass) {
+        freeList.push_back(std::move(buffer));
+    }
+}
+
+size_t ChunkBufferPool::GetPooledCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (const auto& freeList : m_free) {
+        count += freeList.size();
+    }
+    return count;
+}
+
+// ============================================================================
+// CODEC REGISTRY
+// ============================================================================
+
+ChunkCodecRegistry::ChunkCodecRegistry() {
+    auto zstd = std::make_unique<ZstdChunkCodec>();
+    m_zstd = zstd.get();
+    Register(std::make_unique<NullChunkCodec>());
+    Register(std::make_unique<LZ4ChunkCodec>());
+    Register(std::move(zstd));
+    SetSaveCodec("none");
+}
+
+void ChunkCodecRegistry::Register(std::unique_ptr<ChunkCodec> codec) {
+    for (auto& existing : m_codecs) {
+        if (std::string_view(existing->GetName()) == codec->GetName()) {
+            if (m_saveCodec.load(std::memory_order_acquire) == existing.get()) {
+                m_saveCodec.store(codec.get(), std::memory_order_release);
+            }
+            if (existing.get() == m_zstd) {
+                m_zstd = dynamic_cast<ZstdChunkCodec*>(codec.get());
+            }
+            existing = std::move(codec);
+            return;
+        }
+    }
+    m_codecs.push_back(std::move(codec));
+}
+
+const ChunkCodec* ChunkCodecRegistry::Find(std::string_view name) const {
+    for (const auto& codec : m_codecs) {
+        if (name == codec->GetName()) {
+            return codec.get();
+        }
+    }
+    return nullptr;
+}
+
+bool ChunkCodecRegistry::SetSaveCodec(std::string_view name) {
+    const ChunkCodec* codec = Find(name);
+    if (!codec) return false;
+    m_saveCodec.store(codec, std::memory_order_release);
+    return true;
+}
+
+bool ChunkCodecRegistry::Encode(ChunkData& chunk) const {
+    const ChunkCodec& codec = GetSaveCodec();
+    chunk.uncompressedSize = chunk.terrainData.size();
+    chunk.compressionType = "none";
+    if (std::string_view(codec.GetName()) == "none") return true;
+
+    std::vector<uint8_t> encoded;
+    if (!codec.Compress(chunk.terrainData, encoded)) return false;
+    if (encoded.size() < chunk.terrainData.size()) {
+        chunk.terrainData = std::move(encoded);
+        chunk.compressionType = codec.GetName();
+    }
+    return true;
+}
+
+bool ChunkCodecRegistry::Decode(ChunkData& chunk, ChunkBufferPool& pool) const {
+    if (chunk.compressionType == "none" || chunk.compressionType.empty() ||
+        (chunk.compressionType == "zlib" &&
+         (chunk.uncompressedSize == 0 || chunk.uncompressedSize == chunk.terrainData.size()))) {
+        chunk.compressionType = "none";
+        chunk.uncompressedSize = chunk.terrainData.size();
+        return true;
+    }
+
+    const ChunkCodec* codec = Find(chunk.compressionType);
+    if (!codec) return false;
+
+    // The stored size is untrusted: check it before allocating for it
+    if (chunk.uncompressedSize > kMaxDecodedSize ||
+        !codec->IsPlausibleDecodedSize(chunk.terrainData, chunk.uncompressedSize)) {
+        return false;
+    }
+
+    std::vector<uint8_t> decoded = pool.Acquire(chunk.uncompressedSize);
+    if (!codec->Decompress(chunk.terrainData, decoded)) {
+        pool.Release(std::move(decoded));
+        return false;
+    }
+
+    pool.Release(std::move(chunk.terrainData));
+    chunk.terrainData = std::move(decoded);
+    chunk.compressionType = "none";
+    return true;
+}
+
+} // namespace Nova
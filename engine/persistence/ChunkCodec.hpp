@@ -0,0 +1,244 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Nova {
+
+struct ChunkData;
+
+// ============================================================================
+// Chunk Codecs
+// ============================================================================
+
+/**
+ * @brief Compression codec for chunk terrain payloads
+ *
+ * GetName() is what WorldDatabase stores in Chunks.compression_type, so a
+ * chunk always decodes with the codec that wrote it. Compress/Decompress
+ * may be called from several threads at once.
+ */
+class ChunkCodec {
+public:
+    virtual ~ChunkCodec() = default;
+
+    [[nodiscard]] virtual const char* GetName() const = 0;
+
+    /**
+     * @brief Replace output with the encoded form of input
+     */
+    virtual bool Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const = 0;
+
+    /**
+     * @brief Decode input into output
+     * @param output Exactly the uncompressed size; anything else fails
+     */
+    virtual bool Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const = 0;
+
+    /**
+     * @brief Whether input can decode to size bytes, checked before the output is allocated
+     */
+    [[nodiscard]] virtual bool IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const {
+        (void)input;
+        (void)size;
+        return true;
+    }
+};
+
+/**
+ * @brief Stores payloads as they are ("none")
+ */
+class NullChunkCodec : public ChunkCodec {
+public:
+    [[nodiscard]] const char* GetName() const override { return "none"; }
+    bool Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const override;
+    bool Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const override;
+    [[nodiscard]] bool IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const override;
+};
+
+/**
+ * @brief LZ4 block compression ("lz4"): fastest decode, modest ratio
+ */
+class LZ4ChunkCodec : public ChunkCodec {
+public:
+    explicit LZ4ChunkCodec(int acceleration = 1) : m_acceleration(acceleration) {}
+
+    [[nodiscard]] const char* GetName() const override { return "lz4"; }
+    bool Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const override;
+    bool Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const override;
+    [[nodiscard]] bool IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const override;
+
+private:
+    int m_acceleration;
+};
+
+/**
+ * @brief Zstandard compression ("zstd") with optional trained dictionaries
+ *
+ * Chunks of one world (and one biome in particular) share most of their
+ * byte patterns, so a dictionary trained on a sample of them lets even a
+ * 32 KB chunk compress like a much larger stream. Dictionaries belong to
+ * one world and only the active world's are used: its newest for
+ * compression, and any of them (by the ID every frame records) for
+ * decompression, so older chunks keep decoding as long as their dictionary
+ * stays registered.
+ */
+class ZstdChunkCodec : public ChunkCodec {
+public:
+    explicit ZstdChunkCodec(int level = 3);
+    ~ZstdChunkCodec() override;
+
+    [[nodiscard]] const char* GetName() const override { return "zstd"; }
+    bool Compress(std::span<const uint8_t> input, std::vector<uint8_t>& output) const override;
+    bool Decompress(std::span<const uint8_t> input, std::span<uint8_t> output) const override;
+    [[nodiscard]] bool IsPlausibleDecodedSize(std::span<const uint8_t> input, size_t size) const override;
+
+    /**
+     * @brief Register a dictionary of a world; that world compresses with it from now on
+     * @return Dictionary ID, or 0 if the data is not a zstd dictionary
+     */
+    uint32_t AddDictionary(std::span<const uint8_t> dictionary, int worldId = 0);
+
+    /**
+     * @brief Code with the dictionaries of worldId (other worlds' stay registered)
+     */
+    void SetActiveWorld(int worldId);
+    [[nodiscard]] int GetActiveWorld() const;
+
+    // Of the active world
+    [[nodiscard]] bool HasDictionary(uint32_t dictionaryId) const;
+    [[nodiscard]] uint32_t GetCompressionDictionaryId() const;
+    [[nodiscard]] int GetLevel() const { return m_level; }
+
+    /**
+     * @brief Train a dictionary from sample payloads
+     * @param samples Representative uncompressed chunks (a few hundred is plenty)
+     * @param capacity Dictionary size limit in bytes
+     * @return Dictionary bytes, empty if training failed (e.g. too few samples)
+     */
+    static std::vector<uint8_t> TrainDictionary(std::span<const std::span<const uint8_t>> samples,
+                                                size_t capacity = 64 * 1024);
+
+private:
+    struct Dictionary;
+
+    struct WorldDictionaries {
+        std::map<uint32_t, std::shared_ptr<const Dictionary>> byId;
+        std::shared_ptr<const Dictionary> compression;      // Newest
+    };
+
+    std::shared_ptr<const Dictionary> FindDictionary(uint32_t dictionaryId) const;
+
+    int m_level;
+    mutable std::mutex m_dictionaryMutex;
+    std::map<int, WorldDictionaries> m_worlds;
+    int m_activeWorld = 0;
+};
+
+// ============================================================================
+// Decode Buffer Pool
+// ============================================================================
+
+/**
+ * @brief Size-classed free lists of chunk payload buffers
+ *
+ * Decoded chunks take a buffer sized by ChunkData::uncompressedSize and
+ * give it back when they are unloaded, so streaming through a region reuses
+ * the same few allocations. Thread-safe.
+ */
+class ChunkBufferPool {
+public:
+    explicit ChunkBufferPool(size_t maxBuffersPerClass = 64) : m_maxBuffersPerClass(maxBuffersPerClass) {}
+
+    /**
+     * @brief Buffer with size() == size (contents unspecified)
+     */
+    std::vector<uint8_t> Acquire(size_t size);
+
+    /**
+     * @brief Return a buffer (any vector; tiny ones are dropped)
+     */
+    void Release(std::vector<uint8_t>&& buffer);
+
+    [[nodiscard]] size_t GetPooledCount() const;
+    [[nodiscard]] uint64_t GetReuseCount() const { return m_reuses.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetAllocationCount() const { return m_allocations.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t kMinClassBits = 10;      // 1 KB
+    static constexpr size_t kClassCount = 16;        // Up to 32 MB
+
+    mutable std::mutex m_mutex;
+    std::array<std::vector<std::vector<uint8_t>>, kClassCount> m_free;
+    size_t m_maxBuffersPerClass;
+    std::atomic<uint64_t> m_reuses{0};
+    std::atomic<uint64_t> m_allocations{0};
+};
+
+// ============================================================================
+// Codec Registry
+// ============================================================================
+
+/**
+ * @brief Codecs by name, plus the one new chunk saves use
+ *
+ * Starts with "none", "lz4" and "zstd" registered and saves set to "none".
+ * Register codecs before streaming starts; SetSaveCodec may be called at
+ * any time.
+ */
+class ChunkCodecRegistry {
+public:
+    static constexpr size_t kMaxDecodedSize = 16u << 20;    // Largest chunk payload Decode() accepts
+
+    ChunkCodecRegistry();
+
+    /**
+     * @brief Add a codec, replacing one with the same name
+     */
+    void Register(std::unique_ptr<ChunkCodec> codec);
+
+    [[nodiscard]] const ChunkCodec* Find(std::string_view name) const;
+
+    bool SetSaveCodec(std::string_view name);
+    [[nodiscard]] const ChunkCodec& GetSaveCodec() const { return *m_saveCodec.load(std::memory_order_acquire); }
+
+    /**
+     * @brief The built-in zstd codec (for dictionaries)
+     */
+    [[nodiscard]] ZstdChunkCodec& GetZstd() { return *m_zstd; }
+
+    /**
+     * @brief Compress chunk.terrainData with the save codec
+     *
+     * Sets compressionType and uncompressedSize. Payloads that do not shrink
+     * are stored as "none".
+     */
+    bool Encode(ChunkData& chunk) const;
+
+    /**
+     * @brief Decompress chunk.terrainData into a pooled buffer
+     *
+     * Afterwards compressionType is "none". The compressed buffer goes back
+     * to the pool. Rows tagged "zlib" by older builds were never compressed
+     * and are accepted as they are. A stored uncompressedSize above
+     * kMaxDecodedSize, or one the codec rules out for the payload, fails
+     * before anything is allocated.
+     */
+    bool Decode(ChunkData& chunk, ChunkBufferPool& pool) const;
+
+private:
+    std::vector<std::unique_ptr<ChunkCodec>> m_codecs;
+    ZstdChunkCodec* m_zstd = nullptr;
+    std::atomic<const ChunkCodec*> m_saveCodec{nullptr};
+};
+
+} // namespace Nova
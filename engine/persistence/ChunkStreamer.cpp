@@ -1,15 +1,61 @@
 #include "ChunkStreamer.hpp"
+#include "../core/JobSystem.hpp"
 #include <chrono>
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
 
 namespace Nova {
 
+// Time constant of the view velocity filter, and how often it samples (seconds)
+static constexpr float kVelocitySmoothing = 0.25f;
+static constexpr float kVelocitySampleInterval = 0.05f;
+
+// A view not updated for this long is treated as standing still (milliseconds)
+static constexpr int64_t kVelocityStaleMs = 1000;
+
+// Slower views are not worth predicting (world units per second)
+static constexpr float kMinPrefetchSpeed = 1.0f;
+
+// Queued loads are only rescheduled when their deadline moves by more than this
+static constexpr int64_t kRescheduleThresholdMs = 250;
+
+// Saves are due this long after they are queued, so loads needed now go first
+static constexpr int64_t kSaveDeadlineMs = 1000;
+
+// Warmed destinations stay loaded this long after the arrival time
+static constexpr int64_t kWarmGraceMs = 10000;
+
 static uint64_t GetTimestamp() {
     return std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()
     ).count();
 }
 
+static int64_t GetSteadyTime() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+/**
+ * @brief Seconds until a point at offset comes within radius of a viewer
+ *        moving at velocity; infinity if it never does
+ */
+static float TimeToReach(glm::vec2 offset, glm::vec2 velocity, float radius) {
+    const float c = glm::dot(offset, offset) - radius * radius;
+    if (c <= 0.0f) return 0.0f;
+
+    // |offset - velocity * t| = radius, earliest root
+    const float a = glm::dot(velocity, velocity);
+    const float b = glm::dot(offset, velocity);
+    if (a <= 0.0f || b <= 0.0f) return std::numeric_limits<float>::infinity();
+    const float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) return std::numeric_limits<float>::infinity();
+    return (b - std::sqrt(discriminant)) / a;
+}
+
 ChunkStreamer::ChunkStreamer() = default;
 
 ChunkStreamer::~ChunkStreamer() {
@@ -23,6 +69,8 @@ bool ChunkStreamer::Initialize(WorldDatabase* database, int ioThreadCount) {
 
     m_database = database;
     m_ioRunning = true;
+    m_dictionaryWorldId = std::numeric_limits<int>::min();
+    SyncWorldDictionaries();
 
     // Start I/O threads
     for (int i = 0; i < ioThreadCount; i++) {
@@ -55,10 +103,19 @@ void ChunkStreamer::Shutdown() {
 void ChunkStreamer::Update(float deltaTime) {
     if (!m_database) return;
 
+    SyncWorldDictionaries();
+
     m_frameCounter++;
 
-    // Process chunk loads/unloads based on view positions
-    if (m_frameCounter % 10 == 0) { // Every 10 frames
+    // Process chunk loads/unloads based on view positions: every 10 frames,
+    // or right away after a teleport or a new warmed destination
+    bool replan = m_frameCounter % 10 == 0;
+    {
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+        replan = replan || m_viewsChanged;
+        m_viewsChanged = false;
+    }
+    if (replan) {
         UpdateLoadedChunks();
     }
 
@@ -80,7 +137,7 @@ void ChunkStreamer::Update(float deltaTime) {
 void ChunkStreamer::SetViewPosition(glm::vec3 position, int playerId) {
     std::lock_guard<std::mutex> lock(m_viewMutex);
     if (playerId < 0) playerId = 0;
-    m_viewPositions[playerId] = position;
+    TrackViewPosition(playerId, position);
 }
 
 void ChunkStreamer::SetViewDistance(float distance) {
@@ -89,7 +146,7 @@ void ChunkStreamer::SetViewDistance(float distance) {
 
 void ChunkStreamer::AddViewPosition(int playerId, glm::vec3 position) {
     std::lock_guard<std::mutex> lock(m_viewMutex);
-    m_viewPositions[playerId] = position;
+    TrackViewPosition(playerId, position);
 }
 
 void ChunkStreamer::RemoveViewPosition(int playerId) {
@@ -97,30 +154,132 @@ void ChunkStreamer::RemoveViewPosition(int playerId) {
     m_viewPositions.erase(playerId);
 }
 
+glm::vec3 ChunkStreamer::GetViewVelocity(int playerId) const {
+    std::lock_guard<std::mutex> lock(m_viewMutex);
+    auto it = m_viewPositions.find(playerId);
+    if (it == m_viewPositions.end() || GetSteadyTime() - it->second.lastSample > kVelocityStaleMs) {
+        return glm::vec3(0.0f);
+    }
+    return it->second.velocity;
+}
+
+void ChunkStreamer::TrackViewPosition(int playerId, glm::vec3 position) {
+    const int64_t now = GetSteadyTime();
+    auto [it, inserted] = m_viewPositions.try_emplace(playerId);
+    ViewState& view = it->second;
+    const glm::vec3 previous = view.position;
+    view.position = position;
+
+    if (inserted || glm::length(position - previous) > m_viewDistance * 0.5f) {
+        // New view or teleport: the old heading says nothing, plan around the new spot now
+        view.velocity = glm::vec3(0.0f);
+        view.samplePosition = position;
+        view.lastSample = now;
+        m_viewsChanged = true;
+        return;
+    }
+
+    const float dt = static_cast<float>(now - view.lastSample) * 0.001f;
+    if (dt < kVelocitySampleInterval) return;
+
+    if (dt * 1000.0f > static_cast<float>(kVelocityStaleMs)) {
+        // Resuming after a pause; don't smooth towards the stale estimate
+        view.velocity = glm::vec3(0.0f);
+    }
+    const glm::vec3 measured = (position - view.samplePosition) / dt;
+    const float blend = 1.0f - std::exp(-dt / kVelocitySmoothing);
+    view.velocity += (measured - view.velocity) * blend;
+    view.samplePosition = position;
+    view.lastSample = now;
+}
+
+int ChunkStreamer::WarmDestination(glm::vec3 destination, float secondsUntilArrival, float radius) {
+    const int64_t neededAt = GetSteadyTime() + static_cast<int64_t>(std::max(secondsUntilArrival, 0.0f) * 1000.0f);
+
+    std::lock_guard<std::mutex> lock(m_viewMutex);
+    const int handle = m_nextWarmHandle++;
+    WarmTarget& target = m_warmTargets[handle];
+    target.center = destination;
+    target.radius = radius > 0.0f ? radius : m_viewDistance;
+    target.neededAt = neededAt;
+    target.expiresAt = neededAt + kWarmGraceMs;
+    m_viewsChanged = true;
+    return handle;
+}
+
+void ChunkStreamer::CancelWarmDestination(int handle) {
+    std::lock_guard<std::mutex> lock(m_viewMutex);
+    if (m_warmTargets.erase(handle) > 0) {
+        m_viewsChanged = true;
+    }
+}
+
 void ChunkStreamer::LoadChunk(glm::ivec3 chunkPos, int priority, std::function<void(bool)> callback) {
+    QueueLoad(chunkPos, GetSteadyTime(), priority, false, std::move(callback));
+}
+
+void ChunkStreamer::QueueLoad(glm::ivec3 chunkPos, int64_t deadline, int priority, bool streamed,
+                              std::function<void(bool)> callback) {
     {
         std::lock_guard<std::mutex> lock(m_chunkMutex);
-        if (m_chunkStates[chunkPos] == ChunkLoadState::Loaded ||
-            m_chunkStates[chunkPos] == ChunkLoadState::Loading) {
+        auto state = m_chunkStates.find(chunkPos);
+        if (m_loadedChunks.count(chunkPos) > 0 ||
+            (state != m_chunkStates.end() && state->second == ChunkLoadState::Loading)) {
             if (callback) callback(true);
             return;
         }
         m_chunkStates[chunkPos] = ChunkLoadState::Queued;
     }
 
-    ChunkIORequest request;
-    request.type = ChunkIORequestType::Load;
-    request.chunkPos = chunkPos;
-    request.priority = priority;
-    request.timestamp = GetTimestamp();
-    request.callback = callback;
-
+    const int64_t now = GetSteadyTime();
+    bool prefetched = false;
     {
         std::lock_guard<std::mutex> lock(m_ioMutex);
-        m_ioQueue.push(request);
-        m_stats.pendingLoads++;
+        auto [it, inserted] = m_pendingLoads.try_emplace(chunkPos);
+        PendingLoad& pending = it->second;
+
+        if (callback) {
+            if (pending.callback) {
+                pending.callback = [first = std::move(pending.callback), second = std::move(callback)](bool success) {
+                    first(success);
+                    second(success);
+                };
+            } else {
+                pending.callback = std::move(callback);
+            }
+        }
+
+        if (inserted) {
+            pending.streamed = streamed;
+            prefetched = deadline > now;
+        } else {
+            // An explicit request pins the load; streaming only moves it when
+            // the need time shifts noticeably (and not once it is overdue)
+            pending.streamed = pending.streamed && streamed;
+            const int64_t shift = deadline - pending.deadline;
+            const bool sooner = shift < -kRescheduleThresholdMs;
+            const bool later = shift > kRescheduleThresholdMs && pending.deadline > now;
+            if (!sooner && !later) return;
+        }
+
+        pending.sequence = m_nextSequence++;
+        pending.deadline = deadline;
+
+        ChunkIORequest request;
+        request.type = ChunkIORequestType::Load;
+        request.chunkPos = chunkPos;
+        request.priority = priority;
+        request.timestamp = GetTimestamp();
+        request.deadline = deadline;
+        request.sequence = pending.sequence;
+        PushRequest(std::move(request));
     }
     m_ioCondition.notify_one();
+
+    if (prefetched) {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats.prefetchedLoads++;
+    }
 }
 
 void ChunkStreamer::SaveChunk(glm::ivec3 chunkPos, const ChunkData& data, std::function<void(bool)> callback) {
@@ -137,11 +296,15 @@ void ChunkStreamer::SaveChunk(glm::ivec3 chunkPos, const ChunkData& data, std::f
     request.data = data;
     request.priority = 50; // Medium priority
     request.timestamp = GetTimestamp();
+    request.deadline = GetSteadyTime() + kSaveDeadlineMs;
     request.callback = callback;
 
     {
         std::lock_guard<std::mutex> lock(m_ioMutex);
-        m_ioQueue.push(request);
+        PushRequest(std::move(request));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
         m_stats.pendingSaves++;
     }
     m_ioCondition.notify_one();
@@ -159,7 +322,11 @@ void ChunkStreamer::UnloadChunk(glm::ivec3 chunkPos, bool saveIfDirty) {
         }
     }
 
-    m_loadedChunks.erase(chunkPos);
+    auto it = m_loadedChunks.find(chunkPos);
+    if (it != m_loadedChunks.end()) {
+        m_bufferPool.Release(std::move(it->second.terrainData));
+        m_loadedChunks.erase(it);
+    }
     m_chunkStates.erase(chunkPos);
     m_dirtyChunks.erase(chunkPos);
     m_chunkAccessTime.erase(chunkPos);
@@ -254,6 +421,93 @@ void ChunkStreamer::PreloadChunksInRadius(glm::vec3 center, float radius) {
     }
 }
 
+bool ChunkStreamer::SetCompression(const std::string& codecName) {
+    return m_codecs.SetSaveCodec(codecName);
+}
+
+uint32_t ChunkStreamer::TrainCompressionDictionary(size_t maxSamples, size_t dictionaryBytes) {
+    if (!m_database) return 0;
+
+    SyncWorldDictionaries();
+    const int worldId = m_dictionaryWorldId.load(std::memory_order_acquire);
+    if (worldId < 0) {
+        LogError("Compression dictionary training needs a loaded world");
+        return 0;
+    }
+
+    // Copy the samples so training runs without the chunk lock
+    std::vector<std::vector<uint8_t>> samples;
+    {
+        std::lock_guard<std::mutex> lock(m_chunkMutex);
+        for (const auto& [chunkPos, chunk] : m_loadedChunks) {
+            if (samples.size() >= maxSamples) break;
+            if (!chunk.terrainData.empty()) {
+                samples.push_back(chunk.terrainData);
+            }
+        }
+    }
+
+    // Train on even samples, check the result on odd ones
+    std::vector<std::span<const uint8_t>> trainSpans;
+    std::vector<std::span<const uint8_t>> checkSpans;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        (i % 2 == 0 ? trainSpans : checkSpans).emplace_back(samples[i]);
+    }
+    std::vector<uint8_t> dictionary = ZstdChunkCodec::TrainDictionary(trainSpans, dictionaryBytes);
+    if (dictionary.empty()) {
+        LogError("Compression dictionary training failed (" + std::to_string(samples.size()) + " samples)");
+        return 0;
+    }
+
+    ZstdChunkCodec& zstd = m_codecs.GetZstd();
+
+    // Large, regular chunks often compress as well without one; keep the
+    // dictionary only if it actually shrinks the held-out chunks
+    ZstdChunkCodec plain(zstd.GetLevel());
+    ZstdChunkCodec trained(zstd.GetLevel());
+    if (trained.AddDictionary(dictionary) == 0) {
+        LogError("Trained compression dictionary is invalid");
+        return 0;
+    }
+    size_t plainBytes = 0;
+    size_t trainedBytes = 0;
+    std::vector<uint8_t> encoded;
+    for (std::span<const uint8_t> sample : checkSpans) {
+        if (plain.Compress(sample, encoded)) plainBytes += encoded.size();
+        if (trained.Compress(sample, encoded)) trainedBytes += encoded.size();
+    }
+    if (trainedBytes >= plainBytes) {
+        LogError("Compression dictionary does not improve on plain zstd (" + std::to_string(trainedBytes) +
+                 " vs " + std::to_string(plainBytes) + " bytes); not used");
+        return 0;
+    }
+
+    // Stored before use: chunks compressed with it must decode after a restart
+    const uint32_t dictionaryId = trained.GetCompressionDictionaryId();
+    if (!m_database->SaveChunkDictionary(worldId, dictionaryId, zstd.GetName(), dictionary) ||
+        zstd.AddDictionary(dictionary, worldId) != dictionaryId) {
+        LogError("Failed to store compression dictionary");
+        return 0;
+    }
+    return dictionaryId;
+}
+
+void ChunkStreamer::SyncWorldDictionaries() {
+    const int worldId = m_database->GetCurrentWorldId();
+    if (worldId == m_dictionaryWorldId.load(std::memory_order_acquire)) return;
+
+    std::lock_guard<std::mutex> lock(m_dictionaryMutex);
+    if (worldId == m_dictionaryWorldId.load(std::memory_order_relaxed)) return;
+
+    // Chunks saved with earlier dictionaries of this world must stay decodable
+    ZstdChunkCodec& zstd = m_codecs.GetZstd();
+    for (const auto& dictionary : m_database->LoadChunkDictionaries(worldId, zstd.GetName())) {
+        zstd.AddDictionary(dictionary, worldId);
+    }
+    zstd.SetActiveWorld(worldId);
+    m_dictionaryWorldId.store(worldId, std::memory_order_release);
+}
+
 void ChunkStreamer::SetAutoSaveEnabled(bool enabled) {
     m_autoSaveEnabled = enabled;
 }
@@ -283,6 +537,10 @@ ChunkStreamStats ChunkStreamer::GetStatistics() const {
     ChunkStreamStats stats = m_stats;
     stats.loadedChunks = GetLoadedChunkCount();
     stats.dirtyChunks = GetDirtyChunkCount();
+    {
+        std::lock_guard<std::mutex> ioLock(m_ioMutex);
+        stats.pendingLoads = m_pendingLoads.size();
+    }
 
     if (m_totalLoads > 0) {
         stats.avgLoadTime = m_totalLoadTime / static_cast<float>(m_totalLoads);
@@ -290,6 +548,13 @@ ChunkStreamStats ChunkStreamer::GetStatistics() const {
     if (m_totalSaves > 0) {
         stats.avgSaveTime = m_totalSaveTime / static_cast<float>(m_totalSaves);
     }
+    if (m_totalDecodes > 0) {
+        stats.avgDecodeTime = m_totalDecodeTime / static_cast<float>(m_totalDecodes);
+    }
+    stats.pooledBufferReuses = m_bufferPool.GetReuseCount();
+    if (m_totalArrivals > 0) {
+        stats.avgArrivalSlack = static_cast<float>(m_totalArrivalSlack / static_cast<double>(m_totalArrivals));
+    }
 
     return stats;
 }
@@ -309,52 +574,72 @@ size_t ChunkStreamer::GetPendingRequestCount() const {
     return m_ioQueue.size();
 }
 
+void ChunkStreamer::PushRequest(ChunkIORequest request) {
+    m_ioQueue.push_back(std::move(request));
+    std::push_heap(m_ioQueue.begin(), m_ioQueue.end());
+}
+
+ChunkIORequest ChunkStreamer::PopRequest() {
+    std::pop_heap(m_ioQueue.begin(), m_ioQueue.end());
+    ChunkIORequest request = std::move(m_ioQueue.back());
+    m_ioQueue.pop_back();
+    return request;
+}
+
 void ChunkStreamer::IOThreadFunc() {
+    std::vector<ChunkIORequest> loads;
+
     while (m_ioRunning) {
         ChunkIORequest request;
+        bool haveRequest = false;
+        loads.clear();
 
         {
             std::unique_lock<std::mutex> lock(m_ioMutex);
             m_ioCondition.wait(lock, [this] { return !m_ioQueue.empty() || !m_ioRunning; });
 
             if (!m_ioRunning) break;
-            if (m_ioQueue.empty()) continue;
-
-            request = m_ioQueue.top();
-            m_ioQueue.pop();
-        }
-
-        auto startTime = std::chrono::high_resolution_clock::now();
-        bool success = false;
-
-        switch (request.type) {
-            case ChunkIORequestType::Load: {
-                ChunkData chunk = m_database->LoadChunk(request.chunkPos.x, request.chunkPos.y, request.chunkPos.z);
-                success = chunk.isGenerated;
-
-                if (success) {
-                    std::lock_guard<std::mutex> lock(m_chunkMutex);
-                    m_loadedChunks[request.chunkPos] = chunk;
-                    m_chunkStates[request.chunkPos] = ChunkLoadState::Loaded;
-                    UpdateChunkAccess(request.chunkPos);
 
-                    if (OnChunkLoaded) {
-                        OnChunkLoaded(request.chunkPos, chunk);
+            // Loads next to each other in deadline order are read and decoded
+            // together; entries left behind by rescheduling or cancellation are dropped
+            while (!m_ioQueue.empty() && loads.size() < m_decodeBatchSize) {
+                if (m_ioQueue.front().type != ChunkIORequestType::Load) {
+                    if (loads.empty()) {
+                        request = PopRequest();
+                        haveRequest = true;
                     }
+                    break;
                 }
 
-                auto endTime = std::chrono::high_resolution_clock::now();
-                float loadTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
-                {
-                    std::lock_guard<std::mutex> lock(m_statsMutex);
-                    m_totalLoadTime += loadTime;
-                    m_totalLoads++;
-                    m_stats.pendingLoads--;
+                ChunkIORequest load = PopRequest();
+                auto pending = m_pendingLoads.find(load.chunkPos);
+                if (pending == m_pendingLoads.end() || pending->second.sequence != load.sequence) {
+                    continue;
                 }
-                break;
+                load.streamed = pending->second.streamed;
+                load.callback = std::move(pending->second.callback);
+                m_pendingLoads.erase(pending);
+                loads.push_back(std::move(load));
             }
+        }
+
+        if (!loads.empty()) {
+            LoadChunkBatch(loads);
+            continue;
+        }
+        if (!haveRequest) continue;
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        bool success = false;
 
+        switch (request.type) {
             case ChunkIORequestType::Save: {
+                SyncWorldDictionaries();
+                if (!m_codecs.Encode(request.data)) {
+                    LogError("Failed to compress chunk; saving it uncompressed");
+                    request.data.compressionType = "none";
+                    request.data.uncompressedSize = request.data.terrainData.size();
+                }
                 success = m_database->SaveChunk(request.chunkPos.x, request.chunkPos.y, request.chunkPos.z, request.data);
 
                 if (success) {
@@ -374,6 +659,7 @@ void ChunkStreamer::IOThreadFunc() {
                     m_totalSaveTime += saveTime;
                     m_totalSaves++;
                     m_stats.pendingSaves--;
+                    m_stats.totalBytesSaved += request.data.terrainData.size();
                 }
                 break;
             }
@@ -388,41 +674,258 @@ void ChunkStreamer::IOThreadFunc() {
     }
 }
 
+void ChunkStreamer::LoadChunkBatch(std::vector<ChunkIORequest>& requests) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    SyncWorldDictionaries();
+
+    {
+        std::lock_guard<std::mutex> lock(m_chunkMutex);
+        for (const ChunkIORequest& request : requests) {
+            m_chunkStates[request.chunkPos] = ChunkLoadState::Loading;
+        }
+    }
+
+    // Rows come from the database one at a time; decoding is what scales
+    std::vector<ChunkData> chunks(requests.size());
+    size_t bytesRead = 0;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const glm::ivec3 pos = requests[i].chunkPos;
+        chunks[i] = m_database->LoadChunk(pos.x, pos.y, pos.z);
+        bytesRead += chunks[i].terrainData.size();
+    }
+
+    std::vector<uint8_t> decoded(requests.size(), 0);
+    std::vector<float> decodeTimes(requests.size(), 0.0f);
+    JobSystem::Instance().ParallelFor(0, chunks.size(), 1, [&](size_t i) {
+        if (!chunks[i].isGenerated) return;
+        auto decodeStart = std::chrono::high_resolution_clock::now();
+        decoded[i] = m_codecs.Decode(chunks[i], m_bufferPool) ? 1 : 0;
+        decodeTimes[i] = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - decodeStart).count();
+    });
+
+    // Arrival against need time, for streamed loads (explicit loads have no real deadline)
+    const int64_t arrivedAt = GetSteadyTime();
+    double arrivalSlack = 0.0;
+    size_t arrivals = 0;
+    size_t popIns = 0;
+    float worstSlack = 0.0f;
+
+    size_t failures = 0;
+    size_t decodedCount = 0;
+    size_t bytesDecoded = 0;
+    float decodeTime = 0.0f;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const ChunkIORequest& request = requests[i];
+        const bool success = decoded[i] != 0;
+
+        if (success) {
+            decodedCount++;
+            bytesDecoded += chunks[i].terrainData.size();
+            decodeTime += decodeTimes[i];
+
+            if (request.streamed) {
+                const float slack = static_cast<float>(request.deadline - arrivedAt);
+                arrivalSlack += slack;
+                arrivals++;
+                if (slack < 0.0f) popIns++;
+                worstSlack = std::min(worstSlack, slack);
+            }
+
+            std::lock_guard<std::mutex> lock(m_chunkMutex);
+            auto [it, inserted] = m_loadedChunks.try_emplace(request.chunkPos);
+            if (inserted) {
+                it->second = std::move(chunks[i]);
+                UpdateChunkAccess(request.chunkPos);
+            } else {
+                // Saved or loaded again while this read was in flight; the in-memory copy wins
+                m_bufferPool.Release(std::move(chunks[i].terrainData));
+            }
+            if (m_chunkStates[request.chunkPos] == ChunkLoadState::Loading) {
+                m_chunkStates[request.chunkPos] = ChunkLoadState::Loaded;
+            }
+
+            if (inserted && OnChunkLoaded) {
+                OnChunkLoaded(request.chunkPos, it->second);
+            }
+        } else {
+            if (chunks[i].isGenerated) {
+                failures++;
+                LogError("Failed to decode chunk (" + chunks[i].compressionType + ")");
+            }
+            std::lock_guard<std::mutex> lock(m_chunkMutex);
+            auto state = m_chunkStates.find(request.chunkPos);
+            if (state != m_chunkStates.end() && state->second == ChunkLoadState::Loading) {
+                m_chunkStates.erase(state);
+            }
+        }
+
+        if (request.callback) {
+            request.callback(success);
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    float loadTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_totalLoadTime += loadTime;
+        m_totalLoads += requests.size();
+        m_stats.totalBytesLoaded += bytesRead;
+        m_stats.totalBytesDecoded += bytesDecoded;
+        m_stats.decodeFailures += failures;
+        m_totalDecodeTime += decodeTime;
+        m_totalDecodes += decodedCount;
+        m_totalArrivalSlack += arrivalSlack;
+        m_totalArrivals += arrivals;
+        m_stats.popInEvents += popIns;
+        m_stats.worstArrivalSlack = std::min(m_stats.worstArrivalSlack, worstSlack);
+    }
+}
+
 void ChunkStreamer::UpdateLoadedChunks() {
-    std::vector<glm::ivec3> viewPositions;
+    const int64_t now = GetSteadyTime();
+
+    struct Viewer {
+        glm::vec3 position;
+        glm::vec3 velocity;
+    };
+    std::vector<Viewer> viewers;
+    std::vector<WarmTarget> warmTargets;
     {
         std::lock_guard<std::mutex> lock(m_viewMutex);
-        for (const auto& [playerId, pos] : m_viewPositions) {
-            viewPositions.push_back(WorldToChunkPos(pos));
+        for (const auto& [playerId, view] : m_viewPositions) {
+            const bool moving = now - view.lastSample <= kVelocityStaleMs;
+            viewers.push_back({view.position, moving ? view.velocity : glm::vec3(0.0f)});
+        }
+        for (auto it = m_warmTargets.begin(); it != m_warmTargets.end();) {
+            if (it->second.expiresAt < now) {
+                it = m_warmTargets.erase(it);
+            } else {
+                warmTargets.push_back(it->second);
+                ++it;
+            }
+        }
+    }
+
+    if (viewers.empty() && warmTargets.empty()) return;
+
+    // Every wanted chunk with the time until it is needed (seconds) and a
+    // distance-based tie-break for chunks needed at the same time
+    struct Need {
+        float seconds;
+        int priority;
+    };
+    std::map<glm::ivec3, Need, ChunkPosLess> desiredChunks;
+    auto want = [&](glm::ivec3 column, int centerY, float seconds, int priority) {
+        for (int y = -2; y <= 2; y++) { // A few Y levels
+            glm::ivec3 chunkPos(column.x, centerY + y, column.z);
+            auto [it, inserted] = desiredChunks.try_emplace(chunkPos, Need{seconds, priority});
+            if (!inserted) {
+                it->second.seconds = std::min(it->second.seconds, seconds);
+                it->second.priority = std::max(it->second.priority, priority);
+            }
+        }
+    };
+
+    const float chunkSize = static_cast<float>(m_chunkSize);
+    auto columnCenter = [chunkSize](int x, int z) {
+        return (glm::vec2(static_cast<float>(x), static_cast<float>(z)) + 0.5f) * chunkSize;
+    };
+    auto distancePriority = [](float distance, float radius) {
+        return static_cast<int>((1.0f - std::clamp(distance / radius, 0.0f, 1.0f)) * 100);
+    };
+
+    // Views: the column disc around them, swept along the predicted path
+    for (const Viewer& viewer : viewers) {
+        const glm::vec2 origin(viewer.position.x, viewer.position.z);
+        glm::vec2 velocity(viewer.velocity.x, viewer.velocity.z);
+        if (glm::length(velocity) < kMinPrefetchSpeed || m_prefetchTime <= 0.0f) {
+            velocity = glm::vec2(0.0f);
+        }
+        const glm::vec2 pathEnd = origin + velocity * m_prefetchTime;
+        const glm::vec2 low = (glm::min(origin, pathEnd) - m_viewDistance) / chunkSize;
+        const glm::vec2 high = (glm::max(origin, pathEnd) + m_viewDistance) / chunkSize;
+
+        for (int x = static_cast<int>(std::floor(low.x)); x <= static_cast<int>(std::floor(high.x)); x++) {
+            for (int z = static_cast<int>(std::floor(low.y)); z <= static_cast<int>(std::floor(high.y)); z++) {
+                const glm::vec2 center = columnCenter(x, z);
+                const float seconds = TimeToReach(center - origin, velocity, m_viewDistance);
+                if (seconds > m_prefetchTime) continue;
+
+                const int centerY = WorldToChunkPos(viewer.position + viewer.velocity * seconds).y;
+                want(glm::ivec3(x, 0, z), centerY, seconds,
+                     distancePriority(glm::length(center - origin), m_viewDistance));
+            }
         }
     }
 
-    if (viewPositions.empty()) return;
+    // Warmed destinations: the column disc, due at arrival
+    for (const WarmTarget& target : warmTargets) {
+        const glm::vec2 origin(target.center.x, target.center.z);
+        const float seconds = static_cast<float>(std::max<int64_t>(target.neededAt - now, 0)) * 0.001f;
+        const glm::ivec3 centerChunk = WorldToChunkPos(target.center);
+        const int chunkRadius = static_cast<int>(std::ceil(target.radius / chunkSize));
 
-    // Determine which chunks should be loaded
-    std::set<glm::ivec3> desiredChunks;
-    int chunkRadius = static_cast<int>(std::ceil(m_viewDistance / m_chunkSize));
+        for (int x = centerChunk.x - chunkRadius; x <= centerChunk.x + chunkRadius; x++) {
+            for (int z = centerChunk.z - chunkRadius; z <= centerChunk.z + chunkRadius; z++) {
+                const float distance = glm::length(columnCenter(x, z) - origin);
+                if (distance > target.radius) continue;
+                want(glm::ivec3(x, 0, z), centerChunk.y, seconds, distancePriority(distance, target.radius));
+            }
+        }
+    }
 
-    for (const auto& centerChunk : viewPositions) {
-        for (int x = -chunkRadius; x <= chunkRadius; x++) {
-            for (int z = -chunkRadius; z <= chunkRadius; z++) {
-                for (int y = -2; y <= 2; y++) {
-                    glm::ivec3 chunkPos = centerChunk + glm::ivec3(x, y, z);
-                    desiredChunks.insert(chunkPos);
-                }
+    // Queue or reschedule what is missing
+    for (const auto& [chunkPos, need] : desiredChunks) {
+        const int64_t deadline = now + static_cast<int64_t>(need.seconds * 1000.0f);
+        QueueLoad(chunkPos, deadline, need.priority, true, nullptr);
+    }
+
+    // Cancel streamed loads that left range before being read
+    std::vector<std::pair<glm::ivec3, std::function<void(bool)>>> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(m_ioMutex);
+        for (auto it = m_pendingLoads.begin(); it != m_pendingLoads.end();) {
+            if (it->second.streamed && desiredChunks.count(it->first) == 0) {
+                cancelled.emplace_back(it->first, std::move(it->second.callback));
+                it = m_pendingLoads.erase(it);
+            } else {
+                ++it;
             }
         }
+
+        // Compact the heap once stale entries dominate it
+        if (m_ioQueue.size() > 2 * m_pendingLoads.size() + 256) {
+            std::erase_if(m_ioQueue, [this](const ChunkIORequest& request) {
+                if (request.type != ChunkIORequestType::Load) return false;
+                auto pending = m_pendingLoads.find(request.chunkPos);
+                return pending == m_pendingLoads.end() || pending->second.sequence != request.sequence;
+            });
+            std::make_heap(m_ioQueue.begin(), m_ioQueue.end());
+        }
     }
 
-    // Load new chunks
-    for (const auto& chunkPos : desiredChunks) {
-        if (!IsChunkLoaded(chunkPos)) {
-            int priority = CalculateChunkPriority(chunkPos);
-            LoadChunk(chunkPos, priority);
+    if (!cancelled.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(m_chunkMutex);
+            for (const auto& [chunkPos, callback] : cancelled) {
+                auto state = m_chunkStates.find(chunkPos);
+                if (state != m_chunkStates.end() && state->second == ChunkLoadState::Queued) {
+                    m_chunkStates.erase(state);
+                }
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_statsMutex);
+            m_stats.cancelledLoads += cancelled.size();
+        }
+        for (const auto& [chunkPos, callback] : cancelled) {
+            if (callback) callback(false);
         }
     }
 
-    // Unload distant chunks
+    // Unload chunks that are no longer wanted
     std::vector<glm::ivec3> chunksToUnload;
     {
         std::lock_guard<std::mutex> lock(m_chunkMutex);
@@ -455,11 +958,11 @@ glm::vec3 ChunkStreamer::GetClosestViewPosition(glm::ivec3 chunkPos) const {
     float minDist = FLT_MAX;
     glm::vec3 closest;
 
-    for (const auto& [playerId, pos] : m_viewPositions) {
-        float dist = glm::length(pos - chunkWorldPos);
+    for (const auto& [playerId, view] : m_viewPositions) {
+        float dist = glm::length(view.position - chunkWorldPos);
         if (dist < minDist) {
             minDist = dist;
-            closest = pos;
+            closest = view.position;
         }
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "WorldDatabase.hpp"
+#include "ChunkCodec.hpp"
 #include <thread>
 #include <queue>
 #include <mutex>
@@ -9,10 +10,23 @@
 #include <set>
 #include <map>
 #include <functional>
+#include <algorithm>
+#include <limits>
 #include <glm/glm.hpp>
 
 namespace Nova {
 
+/**
+ * @brief Strict ordering of chunk positions for ordered containers
+ */
+struct ChunkPosLess {
+    bool operator()(const glm::ivec3& a, const glm::ivec3& b) const {
+        if (a.x != b.x) return a.x < b.x;
+        if (a.y != b.y) return a.y < b.y;
+        return a.z < b.z;
+    }
+};
+
 /**
  * @brief Chunk I/O request types
  */
@@ -32,10 +46,17 @@ struct ChunkIORequest {
     ChunkData data;
     int priority = 0;
     uint64_t timestamp = 0;
+    int64_t deadline = 0;    // Steady-clock milliseconds the request is needed by
+    uint64_t sequence = 0;   // Loads: stale once the chunk is rescheduled or cancelled
+    bool streamed = false;   // Loads: queued by view streaming, deadline is a real need time
     std::function<void(bool)> callback;
 
+    /**
+     * @brief Heap order: earliest deadline first, then higher priority
+     */
     bool operator<(const ChunkIORequest& other) const {
-        return priority < other.priority; // Higher priority = higher value
+        if (deadline != other.deadline) return deadline > other.deadline;
+        return priority < other.priority;
     }
 };
 
@@ -65,6 +86,15 @@ struct ChunkStreamStats {
     size_t totalBytesSaved = 0;
     size_t cacheHits = 0;
     size_t cacheMisses = 0;
+    float avgDecodeTime = 0.0f;  // Milliseconds per chunk, on the decoding thread
+    size_t totalBytesDecoded = 0;  // Uncompressed bytes produced by decode
+    size_t decodeFailures = 0;
+    size_t pooledBufferReuses = 0;
+    size_t prefetchedLoads = 0;      // Loads queued ahead of need (predicted path, warmed destinations)
+    size_t cancelledLoads = 0;       // Queued loads dropped after leaving range
+    size_t popInEvents = 0;          // Loads that arrived after the chunk was needed
+    float avgArrivalSlack = 0.0f;    // Milliseconds from arrival to need; negative = late
+    float worstArrivalSlack = 0.0f;  // Milliseconds, most negative seen
 };
 
 /**
@@ -73,11 +103,16 @@ struct ChunkStreamStats {
  * Features:
  * - Load/unload chunks based on player proximity
  * - Background thread for I/O operations
- * - Priority-based loading (near > far)
+ * - Deadline scheduling: view velocity is tracked, chunks along the
+ *   predicted path are prefetched, and loads are ordered by time-to-need
+ * - Queued loads that leave range are cancelled; destinations of portal
+ *   jumps and fast travel can be warmed before arrival
  * - Automatic dirty chunk tracking
  * - Periodic auto-save
  * - LRU cache for chunk data
  * - Load/save statistics
+ * - Pluggable terrain compression (ChunkCodecRegistry); loads are read in
+ *   batches and decoded in parallel on the JobSystem into pooled buffers
  */
 class ChunkStreamer {
 public:
@@ -155,14 +190,45 @@ public:
      */
     void RemoveViewPosition(int playerId);
 
+    /**
+     * @brief Smoothed view velocity estimated from position updates
+     */
+    glm::vec3 GetViewVelocity(int playerId = 0) const;
+
+    /**
+     * @brief How far ahead along a view's path chunks are prefetched
+     * @param seconds Lookahead; 0 disables prediction
+     */
+    void SetPrefetchTime(float seconds) { m_prefetchTime = std::max(seconds, 0.0f); }
+    float GetPrefetchTime() const { return m_prefetchTime; }
+
+    /**
+     * @brief Load a destination's surroundings before a viewer gets there
+     *
+     * For portal jumps and fast travel: chunks within radius of destination
+     * are queued to be ready by the time of arrival and kept loaded until a
+     * few seconds after it.
+     *
+     * @param destination World position the viewer will appear at
+     * @param secondsUntilArrival Lead time (travel or portal channel time)
+     * @param radius Radius to warm; 0 = view distance
+     * @return Handle for CancelWarmDestination()
+     */
+    int WarmDestination(glm::vec3 destination, float secondsUntilArrival, float radius = 0.0f);
+
+    /**
+     * @brief Stop keeping a warmed destination loaded (e.g. travel cancelled)
+     */
+    void CancelWarmDestination(int handle);
+
     // =========================================================================
     // CHUNK OPERATIONS
     // =========================================================================
 
     /**
-     * @brief Load chunk (async)
+     * @brief Load chunk (async), needed now
      * @param chunkPos Chunk position
-     * @param priority Load priority (higher = load first)
+     * @param priority Load priority among requests due at the same time (higher = load first)
      * @param callback Optional completion callback
      */
     void LoadChunk(glm::ivec3 chunkPos, int priority = 0, std::function<void(bool)> callback = nullptr);
@@ -273,6 +339,41 @@ public:
      */
     size_t GetMaxCachedChunks() const { return m_maxCachedChunks; }
 
+    // =========================================================================
+    // COMPRESSION
+    // =========================================================================
+
+    /**
+     * @brief Codec used for chunk saves ("none", "lz4", "zstd" or a registered one)
+     * @return False if no codec has that name
+     */
+    bool SetCompression(const std::string& codecName);
+
+    /**
+     * @brief Codecs chunks are encoded and decoded with
+     */
+    ChunkCodecRegistry& GetCodecs() { return m_codecs; }
+
+    /**
+     * @brief Train a zstd dictionary on the loaded chunks and store it with the world
+     *
+     * Saves made with "zstd" use the newest dictionary from then on. Chunks
+     * are coded with the dictionaries of the world the database has loaded;
+     * they are (re)loaded whenever that world changes. Half of the samples
+     * are held back, and a dictionary that does not shrink them is
+     * discarded.
+     *
+     * @param maxSamples Loaded chunks to sample
+     * @param dictionaryBytes Dictionary size limit
+     * @return Dictionary ID, or 0 if training failed or did not pay off
+     */
+    uint32_t TrainCompressionDictionary(size_t maxSamples = 1024, size_t dictionaryBytes = 64 * 1024);
+
+    /**
+     * @brief Max load requests read and decoded together
+     */
+    void SetDecodeBatchSize(size_t batchSize) { m_decodeBatchSize = std::max<size_t>(batchSize, 1); }
+
     /**
      * @brief Clear chunk cache
      * @param saveFirst Save dirty chunks first
@@ -319,6 +420,9 @@ private:
     // Process chunk loads
     void ProcessChunkLoads();
 
+    // Read, decode (in parallel) and publish a batch of load requests
+    void LoadChunkBatch(std::vector<ChunkIORequest>& requests);
+
     // Process chunk saves
     void ProcessChunkSaves();
 
@@ -328,6 +432,20 @@ private:
     // Determine which chunks should be loaded
     void UpdateLoadedChunks();
 
+    // Load the current world's dictionaries if the database switched worlds
+    void SyncWorldDictionaries();
+
+    // Record a view position and update its velocity estimate (m_viewMutex held)
+    void TrackViewPosition(int playerId, glm::vec3 position);
+
+    // Queue or reschedule a load; streamed loads may be cancelled by UpdateLoadedChunks
+    void QueueLoad(glm::ivec3 chunkPos, int64_t deadline, int priority, bool streamed,
+                   std::function<void(bool)> callback);
+
+    // I/O queue heap operations (m_ioMutex held)
+    void PushRequest(ChunkIORequest request);
+    ChunkIORequest PopRequest();
+
     // Calculate chunk priority based on distance
     int CalculateChunkPriority(glm::ivec3 chunkPos) const;
 
@@ -346,28 +464,61 @@ private:
     WorldDatabase* m_database = nullptr;
 
     // Loaded chunks (in memory)
-    std::map<glm::ivec3, ChunkData> m_loadedChunks;
-    std::map<glm::ivec3, ChunkLoadState> m_chunkStates;
-    std::set<glm::ivec3> m_dirtyChunks;
+    std::map<glm::ivec3, ChunkData, ChunkPosLess> m_loadedChunks;
+    std::map<glm::ivec3, ChunkLoadState, ChunkPosLess> m_chunkStates;
+    std::set<glm::ivec3, ChunkPosLess> m_dirtyChunks;
     mutable std::mutex m_chunkMutex;
 
     // LRU cache
-    std::map<glm::ivec3, uint64_t> m_chunkAccessTime;
+    std::map<glm::ivec3, uint64_t, ChunkPosLess> m_chunkAccessTime;
     size_t m_maxCachedChunks = 1000;
 
     // View positions (for multiple players)
-    std::map<int, glm::vec3> m_viewPositions;
+    struct ViewState {
+        glm::vec3 position{0.0f};
+        glm::vec3 velocity{0.0f};        // Smoothed, world units per second
+        glm::vec3 samplePosition{0.0f};  // Position at the last velocity sample
+        int64_t lastSample = 0;          // Steady-clock milliseconds
+    };
+    struct WarmTarget {
+        glm::vec3 center{0.0f};
+        float radius = 0.0f;
+        int64_t neededAt = 0;
+        int64_t expiresAt = 0;
+    };
+    std::map<int, ViewState> m_viewPositions;
+    std::map<int, WarmTarget> m_warmTargets;
+    int m_nextWarmHandle = 1;
+    bool m_viewsChanged = false;     // Teleport or new target: re-plan on the next Update
+    float m_prefetchTime = 3.0f;
     float m_viewDistance = 200.0f;
     int m_chunkSize = 16; // Chunk size in world units
     mutable std::mutex m_viewMutex;
 
     // I/O threads
     std::vector<std::thread> m_ioThreads;
-    std::priority_queue<ChunkIORequest> m_ioQueue;
-    std::mutex m_ioMutex;
+    std::vector<ChunkIORequest> m_ioQueue;     // Heap ordered by ChunkIORequest::operator<
+    mutable std::mutex m_ioMutex;
+
+    // Queued loads; a heap entry whose sequence no longer matches is skipped
+    struct PendingLoad {
+        uint64_t sequence = 0;
+        int64_t deadline = 0;
+        bool streamed = false;
+        std::function<void(bool)> callback;
+    };
+    std::map<glm::ivec3, PendingLoad, ChunkPosLess> m_pendingLoads;
+    uint64_t m_nextSequence = 1;
     std::condition_variable m_ioCondition;
     std::atomic<bool> m_ioRunning{false};
 
+    // Compression
+    ChunkCodecRegistry m_codecs;
+    std::mutex m_dictionaryMutex;
+    std::atomic<int> m_dictionaryWorldId{std::numeric_limits<int>::min()};   // World the codecs are set up for
+    ChunkBufferPool m_bufferPool;
+    size_t m_decodeBatchSize = 32;
+
     // Auto-save
     bool m_autoSaveEnabled = true;
     float m_autoSaveInterval = 300.0f; // 5 minutes
@@ -380,16 +531,13 @@ private:
     size_t m_totalLoads = 0;
     float m_totalSaveTime = 0.0f;
     size_t m_totalSaves = 0;
+    float m_totalDecodeTime = 0.0f;
+    size_t m_totalDecodes = 0;
+    double m_totalArrivalSlack = 0.0;
+    size_t m_totalArrivals = 0;
 
     // Timing
     uint64_t m_frameCounter = 0;
 };
 
-// Helper for glm::ivec3 comparison in maps
-inline bool operator<(const glm::ivec3& a, const glm::ivec3& b) {
-    if (a.x != b.x) return a.x < b.x;
-    if (a.y != b.y) return a.y < b.y;
-    return a.z < b.z;
-}
-
 } // namespace Nova
@@ -6,6 +6,7 @@
 #include <iomanip>
 #include <cstring>
 #include <random>
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -44,6 +45,78 @@ static float GetTimeMs() {
     return std::chrono::duration<float, std::milli>(now - start).count();
 }
 
+// Same as in world_schema.sql
+static const char* const kChunkDictionariesSQL = R"(
+    CREATE TABLE IF NOT EXISTS ChunkDictionaries (
+        world_id INTEGER NOT NULL,
+        dictionary_id INTEGER NOT NULL,
+        codec TEXT NOT NULL,
+        data BLOB NOT NULL,
+        created_at INTEGER NOT NULL,
+        PRIMARY KEY (world_id, dictionary_id),
+        FOREIGN KEY (world_id) REFERENCES WorldMeta(world_id) ON DELETE CASCADE
+    );
+    INSERT OR IGNORE INTO SchemaMigrations (version, description)
+    VALUES (2, 'Chunk compression dictionaries');
+)";
+
+// Columns of every entity load (table alias e), in the order ReadEntityRow() reads them
+static const char* const kEntityColumns = R"(
+        e.entity_id, e.world_id, e.entity_type, e.entity_subtype, e.entity_uuid, e.chunk_x, e.chunk_y, e.chunk_z,
+        e.position_x, e.position_y, e.position_z, e.rotation_x, e.rotation_y, e.rotation_z, e.rotation_w,
+        e.velocity_x, e.velocity_y, e.velocity_z, e.scale_x, e.scale_y, e.scale_z, e.data, e.is_active, e.is_static,
+        e.owner_player_id, e.health, e.max_health, e.flags, e.created_at, e.modified_at
+)";
+
+static std::string ColumnText(sqlite3_stmt* stmt, int column) {
+    const unsigned char* text = sqlite3_column_text(stmt, column);
+    return text ? reinterpret_cast<const char*>(text) : std::string();
+}
+
+static void ReadEntityRow(sqlite3_stmt* stmt, Entity& entity) {
+    entity.entityId = sqlite3_column_int(stmt, 0);
+    entity.worldId = sqlite3_column_int(stmt, 1);
+    entity.entityType = ColumnText(stmt, 2);
+    entity.entitySubtype = ColumnText(stmt, 3);
+    entity.uuid = ColumnText(stmt, 4);
+    entity.chunkPos.x = sqlite3_column_int(stmt, 5);
+    entity.chunkPos.y = sqlite3_column_int(stmt, 6);
+    entity.chunkPos.z = sqlite3_column_int(stmt, 7);
+    entity.position.x = static_cast<float>(sqlite3_column_double(stmt, 8));
+    entity.position.y = static_cast<float>(sqlite3_column_double(stmt, 9));
+    entity.position.z = static_cast<float>(sqlite3_column_double(stmt, 10));
+    entity.rotation.x = static_cast<float>(sqlite3_column_double(stmt, 11));
+    entity.rotation.y = static_cast<float>(sqlite3_column_double(stmt, 12));
+    entity.rotation.z = static_cast<float>(sqlite3_column_double(stmt, 13));
+    entity.rotation.w = static_cast<float>(sqlite3_column_double(stmt, 14));
+    entity.velocity.x = static_cast<float>(sqlite3_column_double(stmt, 15));
+    entity.velocity.y = static_cast<float>(sqlite3_column_double(stmt, 16));
+    entity.velocity.z = static_cast<float>(sqlite3_column_double(stmt, 17));
+    entity.scale.x = static_cast<float>(sqlite3_column_double(stmt, 18));
+    entity.scale.y = static_cast<float>(sqlite3_column_double(stmt, 19));
+    entity.scale.z = static_cast<float>(sqlite3_column_double(stmt, 20));
+
+    const void* dataBlob = sqlite3_column_blob(stmt, 21);
+    int dataSize = sqlite3_column_bytes(stmt, 21);
+    if (dataBlob && dataSize > 0) {
+        entity.data.resize(dataSize);
+        std::memcpy(entity.data.data(), dataBlob, dataSize);
+    }
+
+    entity.isActive = sqlite3_column_int(stmt, 22) != 0;
+    entity.isStatic = sqlite3_column_int(stmt, 23) != 0;
+
+    if (sqlite3_column_type(stmt, 24) != SQLITE_NULL) {
+        entity.ownerPlayerId = sqlite3_column_int(stmt, 24);
+    }
+
+    entity.health = static_cast<float>(sqlite3_column_double(stmt, 25));
+    entity.maxHealth = static_cast<float>(sqlite3_column_double(stmt, 26));
+    entity.flags = sqlite3_column_int(stmt, 27);
+    entity.createdAt = sqlite3_column_int64(stmt, 28);
+    entity.modifiedAt = sqlite3_column_int64(stmt, 29);
+}
+
 // ============================================================================
 // CONSTRUCTOR / DESTRUCTOR
 // ============================================================================
@@ -119,6 +192,13 @@ bool WorldDatabase::Initialize(const std::string& dbPath) {
         }
     }
 
+    // Schema 2 migration for databases created before chunk dictionaries
+    if (!ExecuteSQL(kChunkDictionariesSQL)) {
+        sqlite3_close(m_db);
+        m_db = nullptr;
+        return false;
+    }
+
     // Prepare statements
     if (!PrepareStatements()) {
         LogError("Failed to prepare statements");
@@ -131,6 +211,8 @@ bool WorldDatabase::Initialize(const std::string& dbPath) {
 }
 
 void WorldDatabase::Shutdown() {
+    StopWriteBehind();
+
     std::lock_guard<std::mutex> lock(m_dbMutex);
 
     if (!m_db) return;
@@ -191,31 +273,63 @@ bool WorldDatabase::PrepareStatements() {
     }
 
     // Load entity
-    const char* sqlLoadEntity = R"(
-        SELECT entity_id, world_id, entity_type, entity_subtype, entity_uuid, chunk_x, chunk_y, chunk_z,
-               position_x, position_y, position_z, rotation_x, rotation_y, rotation_z, rotation_w,
-               velocity_x, velocity_y, velocity_z, scale_x, scale_y, scale_z, data, is_active, is_static,
-               owner_player_id, health, max_health, flags, created_at, modified_at
-        FROM Entities WHERE entity_id = ?
-    )";
-    if (sqlite3_prepare_v2(m_db, sqlLoadEntity, -1, &m_stmtLoadEntity, nullptr) != SQLITE_OK) {
+    const std::string sqlLoadEntity = std::string("SELECT") + kEntityColumns + "FROM Entities e WHERE e.entity_id = ?";
+    if (sqlite3_prepare_v2(m_db, sqlLoadEntity.c_str(), -1, &m_stmtLoadEntity, nullptr) != SQLITE_OK) {
         LogError("Failed to prepare load entity statement");
         return false;
     }
 
     // Load entity by UUID
-    const char* sqlLoadEntityByUUID = R"(
-        SELECT entity_id, world_id, entity_type, entity_subtype, entity_uuid, chunk_x, chunk_y, chunk_z,
-               position_x, position_y, position_z, rotation_x, rotation_y, rotation_z, rotation_w,
-               velocity_x, velocity_y, velocity_z, scale_x, scale_y, scale_z, data, is_active, is_static,
-               owner_player_id, health, max_health, flags, created_at, modified_at
-        FROM Entities WHERE entity_uuid = ?
-    )";
-    if (sqlite3_prepare_v2(m_db, sqlLoadEntityByUUID, -1, &m_stmtLoadEntityByUUID, nullptr) != SQLITE_OK) {
+    const std::string sqlLoadEntityByUUID = std::string("SELECT") + kEntityColumns + "FROM Entities e WHERE e.entity_uuid = ?";
+    if (sqlite3_prepare_v2(m_db, sqlLoadEntityByUUID.c_str(), -1, &m_stmtLoadEntityByUUID, nullptr) != SQLITE_OK) {
         LogError("Failed to prepare load entity by UUID statement");
         return false;
     }
 
+    // Load entities by ID (unused IN slots stay NULL and match nothing)
+    std::string sqlLoadEntities = std::string("SELECT") + kEntityColumns + "FROM Entities e WHERE e.entity_id IN (?";
+    for (size_t i = 1; i < kEntityBatchSize; ++i) {
+        sqlLoadEntities += ", ?";
+    }
+    sqlLoadEntities += ") ORDER BY e.entity_id";
+    if (sqlite3_prepare_v2(m_db, sqlLoadEntities.c_str(), -1, &m_stmtLoadEntities, nullptr) != SQLITE_OK) {
+        LogError("Failed to prepare load entities statement");
+        return false;
+    }
+
+    // Load entities in chunk
+    const std::string sqlLoadEntitiesInChunk = std::string("SELECT") + kEntityColumns + R"(FROM Entities e
+        WHERE e.world_id = ? AND e.chunk_x = ? AND e.chunk_y = ? AND e.chunk_z = ? AND e.is_active = 1
+    )";
+    if (sqlite3_prepare_v2(m_db, sqlLoadEntitiesInChunk.c_str(), -1, &m_stmtLoadEntitiesInChunk, nullptr) != SQLITE_OK) {
+        LogError("Failed to prepare load entities in chunk statement");
+        return false;
+    }
+
+    // Radius query: R-tree box first (CROSS JOIN keeps it the outer loop), exact sphere test in SQL
+    const std::string sqlQueryEntitiesInRadius = std::string("SELECT") + kEntityColumns + R"(FROM EntitySpatialIndex si
+        CROSS JOIN Entities e ON e.entity_id = si.id
+        WHERE si.min_x <= ?1 AND si.max_x >= ?2 AND
+              si.min_y <= ?3 AND si.max_y >= ?4 AND
+              si.min_z <= ?5 AND si.max_z >= ?6 AND
+              e.world_id = ?7 AND e.is_active = 1 AND
+              (e.position_x - ?8) * (e.position_x - ?8) +
+              (e.position_y - ?9) * (e.position_y - ?9) +
+              (e.position_z - ?10) * (e.position_z - ?10) <= ?11
+    )";
+    if (sqlite3_prepare_v2(m_db, sqlQueryEntitiesInRadius.c_str(), -1, &m_stmtQueryEntitiesInRadius, nullptr) != SQLITE_OK) {
+        LogError("Failed to prepare query entities in radius statement");
+        return false;
+    }
+
+    // Query entities by type
+    const std::string sqlQueryEntitiesByType = std::string("SELECT") + kEntityColumns +
+        "FROM Entities e WHERE e.world_id = ? AND e.entity_type = ? AND e.is_active = 1";
+    if (sqlite3_prepare_v2(m_db, sqlQueryEntitiesByType.c_str(), -1, &m_stmtQueryEntitiesByType, nullptr) != SQLITE_OK) {
+        LogError("Failed to prepare query entities by type statement");
+        return false;
+    }
+
     // Delete entity
     const char* sqlDeleteEntity = "DELETE FROM Entities WHERE entity_id = ?";
     if (sqlite3_prepare_v2(m_db, sqlDeleteEntity, -1, &m_stmtDeleteEntity, nullptr) != SQLITE_OK) {
@@ -302,6 +416,10 @@ void WorldDatabase::FinalizeStatements() {
     if (m_stmtLoadEntity) sqlite3_finalize(m_stmtLoadEntity);
     if (m_stmtLoadEntityByUUID) sqlite3_finalize(m_stmtLoadEntityByUUID);
     if (m_stmtDeleteEntity) sqlite3_finalize(m_stmtDeleteEntity);
+    if (m_stmtLoadEntities) sqlite3_finalize(m_stmtLoadEntities);
+    if (m_stmtLoadEntitiesInChunk) sqlite3_finalize(m_stmtLoadEntitiesInChunk);
+    if (m_stmtQueryEntitiesInRadius) sqlite3_finalize(m_stmtQueryEntitiesInRadius);
+    if (m_stmtQueryEntitiesByType) sqlite3_finalize(m_stmtQueryEntitiesByType);
     if (m_stmtSavePlayer) sqlite3_finalize(m_stmtSavePlayer);
     if (m_stmtLoadPlayer) sqlite3_finalize(m_stmtLoadPlayer);
     if (m_stmtSaveInventorySlot) sqlite3_finalize(m_stmtSaveInventorySlot);
@@ -316,6 +434,10 @@ void WorldDatabase::FinalizeStatements() {
     m_stmtLoadEntity = nullptr;
     m_stmtLoadEntityByUUID = nullptr;
     m_stmtDeleteEntity = nullptr;
+    m_stmtLoadEntities = nullptr;
+    m_stmtLoadEntitiesInChunk = nullptr;
+    m_stmtQueryEntitiesInRadius = nullptr;
+    m_stmtQueryEntitiesByType = nullptr;
     m_stmtSavePlayer = nullptr;
     m_stmtLoadPlayer = nullptr;
     m_stmtSaveInventorySlot = nullptr;
@@ -366,6 +488,9 @@ int WorldDatabase::CreateWorld(const std::string& name, int seed) {
 }
 
 bool WorldDatabase::LoadWorld(int worldId) {
+    // Queued writes belong to the world that is loaded now
+    FlushAndWait();
+
     std::lock_guard<std::mutex> lock(m_dbMutex);
     if (!m_db) return false;
 
@@ -430,6 +555,7 @@ void WorldDatabase::SaveWorld() {
 }
 
 void WorldDatabase::UnloadWorld() {
+    FlushAndWait();
     SaveWorld();
     m_currentWorldId = -1;
 }
@@ -564,6 +690,10 @@ std::vector<WorldMetadata> WorldDatabase::ListWorlds() {
 
 bool WorldDatabase::SaveChunk(int chunkX, int chunkY, int chunkZ, const ChunkData& data) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return SaveChunkLocked(chunkX, chunkY, chunkZ, data);
+}
+
+bool WorldDatabase::SaveChunkLocked(int chunkX, int chunkY, int chunkZ, const ChunkData& data) {
     if (!m_db || m_currentWorldId < 0 || !m_stmtSaveChunk) return false;
 
     float startTime = GetTimeMs();
@@ -640,7 +770,7 @@ ChunkData WorldDatabase::LoadChunk(int chunkX, int chunkY, int chunkZ) {
         chunk.isPopulated = sqlite3_column_int(m_stmtLoadChunk, 7) != 0;
         chunk.isDirty = sqlite3_column_int(m_stmtLoadChunk, 8) != 0;
         chunk.modifiedAt = sqlite3_column_int64(m_stmtLoadChunk, 9);
-        chunk.compressionType = reinterpret_cast<const char*>(sqlite3_column_text(m_stmtLoadChunk, 10));
+        chunk.compressionType = ColumnText(m_stmtLoadChunk, 10);
         chunk.uncompressedSize = sqlite3_column_int(m_stmtLoadChunk, 11);
         if (sqlite3_column_text(m_stmtLoadChunk, 12)) {
             chunk.checksum = reinterpret_cast<const char*>(sqlite3_column_text(m_stmtLoadChunk, 12));
@@ -760,6 +890,53 @@ std::vector<glm::ivec3> WorldDatabase::GetDirtyChunks() {
     return chunks;
 }
 
+bool WorldDatabase::SaveChunkDictionary(int worldId, uint32_t dictionaryId, const std::string& codec,
+                                        const std::vector<uint8_t>& dictionary) {
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    if (!m_db || worldId < 0) return false;
+
+    const char* sql = R"(
+        INSERT OR REPLACE INTO ChunkDictionaries (world_id, dictionary_id, codec, data, created_at)
+        VALUES (?, ?, ?, ?, ?)
+    )";
+    sqlite3_stmt* stmt;
+    if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        LogError("Failed to prepare save chunk dictionary statement");
+        return false;
+    }
+
+    sqlite3_bind_int(stmt, 1, worldId);
+    sqlite3_bind_int64(stmt, 2, dictionaryId);
+    sqlite3_bind_text(stmt, 3, codec.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_blob(stmt, 4, dictionary.data(), static_cast<int>(dictionary.size()), SQLITE_TRANSIENT);
+    sqlite3_bind_int64(stmt, 5, GetTimestamp());
+
+    int result = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+    return result == SQLITE_DONE;
+}
+
+std::vector<std::vector<uint8_t>> WorldDatabase::LoadChunkDictionaries(int worldId, const std::string& codec) {
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    std::vector<std::vector<uint8_t>> dictionaries;
+    if (!m_db || worldId < 0) return dictionaries;
+
+    const char* sql = "SELECT data FROM ChunkDictionaries WHERE world_id = ? AND codec = ? ORDER BY created_at, rowid";
+    sqlite3_stmt* stmt;
+    if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return dictionaries;
+    }
+
+    sqlite3_bind_int(stmt, 1, worldId);
+    sqlite3_bind_text(stmt, 2, codec.c_str(), -1, SQLITE_TRANSIENT);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        const auto* data = static_cast<const uint8_t*>(sqlite3_column_blob(stmt, 0));
+        dictionaries.emplace_back(data, data + sqlite3_column_bytes(stmt, 0));
+    }
+    sqlite3_finalize(stmt);
+    return dictionaries;
+}
+
 bool WorldDatabase::MarkChunkDirty(int chunkX, int chunkY, int chunkZ, bool dirty) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
     if (!m_db || m_currentWorldId < 0) return false;
@@ -788,6 +965,10 @@ bool WorldDatabase::MarkChunkDirty(int chunkX, int chunkY, int chunkZ, bool dirt
 
 int WorldDatabase::SaveEntity(const Entity& entity) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return SaveEntityLocked(entity);
+}
+
+int WorldDatabase::SaveEntityLocked(const Entity& entity) {
     if (!m_db || m_currentWorldId < 0 || !m_stmtSaveEntity) return -1;
 
     float startTime = GetTimeMs();
@@ -866,48 +1047,9 @@ Entity WorldDatabase::LoadEntity(int entityId) {
     sqlite3_bind_int(m_stmtLoadEntity, 1, entityId);
 
     if (sqlite3_step(m_stmtLoadEntity) == SQLITE_ROW) {
-        entity.entityId = sqlite3_column_int(m_stmtLoadEntity, 0);
-        entity.worldId = sqlite3_column_int(m_stmtLoadEntity, 1);
-        entity.entityType = reinterpret_cast<const char*>(sqlite3_column_text(m_stmtLoadEntity, 2));
-        entity.entitySubtype = reinterpret_cast<const char*>(sqlite3_column_text(m_stmtLoadEntity, 3));
-        entity.uuid = reinterpret_cast<const char*>(sqlite3_column_text(m_stmtLoadEntity, 4));
-        entity.chunkPos.x = sqlite3_column_int(m_stmtLoadEntity, 5);
-        entity.chunkPos.y = sqlite3_column_int(m_stmtLoadEntity, 6);
-        entity.chunkPos.z = sqlite3_column_int(m_stmtLoadEntity, 7);
-        entity.position.x = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 8));
-        entity.position.y = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 9));
-        entity.position.z = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 10));
-        entity.rotation.x = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 11));
-        entity.rotation.y = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 12));
-        entity.rotation.z = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 13));
-        entity.rotation.w = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 14));
-        entity.velocity.x = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 15));
-        entity.velocity.y = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 16));
-        entity.velocity.z = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 17));
-        entity.scale.x = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 18));
-        entity.scale.y = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 19));
-        entity.scale.z = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 20));
-
-        const void* dataBlob = sqlite3_column_blob(m_stmtLoadEntity, 21);
-        int dataSize = sqlite3_column_bytes(m_stmtLoadEntity, 21);
-        if (dataBlob && dataSize > 0) {
-            entity.data.resize(dataSize);
-            std::memcpy(entity.data.data(), dataBlob, dataSize);
-        }
-
-        entity.isActive = sqlite3_column_int(m_stmtLoadEntity, 22) != 0;
-        entity.isStatic = sqlite3_column_int(m_stmtLoadEntity, 23) != 0;
-
-        if (sqlite3_column_type(m_stmtLoadEntity, 24) != SQLITE_NULL) {
-            entity.ownerPlayerId = sqlite3_column_int(m_stmtLoadEntity, 24);
-        }
-
-        entity.health = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 25));
-        entity.maxHealth = static_cast<float>(sqlite3_column_double(m_stmtLoadEntity, 26));
-        entity.flags = sqlite3_column_int(m_stmtLoadEntity, 27);
-        entity.createdAt = sqlite3_column_int64(m_stmtLoadEntity, 28);
-        entity.modifiedAt = sqlite3_column_int64(m_stmtLoadEntity, 29);
+        ReadEntityRow(m_stmtLoadEntity, entity);
     }
+    sqlite3_reset(m_stmtLoadEntity);
 
     CheckSlowQuery("LoadEntity", GetTimeMs() - startTime);
     return entity;
@@ -923,16 +1065,19 @@ Entity WorldDatabase::LoadEntityByUUID(const std::string& uuid) {
     sqlite3_bind_text(m_stmtLoadEntityByUUID, 1, uuid.c_str(), -1, SQLITE_TRANSIENT);
 
     if (sqlite3_step(m_stmtLoadEntityByUUID) == SQLITE_ROW) {
-        // Same logic as LoadEntity...
-        entity.entityId = sqlite3_column_int(m_stmtLoadEntityByUUID, 0);
-        // ... (copy remaining fields similar to LoadEntity)
+        ReadEntityRow(m_stmtLoadEntityByUUID, entity);
     }
+    sqlite3_reset(m_stmtLoadEntityByUUID);
 
     return entity;
 }
 
 bool WorldDatabase::DeleteEntity(int entityId) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return DeleteEntityLocked(entityId);
+}
+
+bool WorldDatabase::DeleteEntityLocked(int entityId) {
     if (!m_db || !m_stmtDeleteEntity) return false;
 
     sqlite3_reset(m_stmtDeleteEntity);
@@ -943,55 +1088,62 @@ bool WorldDatabase::DeleteEntity(int entityId) {
     return result == SQLITE_DONE;
 }
 
-std::vector<Entity> WorldDatabase::LoadEntitiesInChunk(int chunkX, int chunkY, int chunkZ) {
+std::vector<Entity> WorldDatabase::LoadEntities(std::span<const int> entityIds) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
     std::vector<Entity> entities;
-    if (!m_db || m_currentWorldId < 0) return entities;
+    if (!m_db || !m_stmtLoadEntities || entityIds.empty()) return entities;
 
-    const char* sql = "SELECT entity_id FROM Entities WHERE world_id = ? AND chunk_x = ? AND chunk_y = ? AND chunk_z = ? AND is_active = 1";
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return entities;
+    float startTime = GetTimeMs();
+
+    // Sorted batches come back in ascending ID order as a whole
+    std::vector<int> ids(entityIds.begin(), entityIds.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    entities.reserve(ids.size());
+
+    for (size_t first = 0; first < ids.size(); first += kEntityBatchSize) {
+        const size_t count = std::min(kEntityBatchSize, ids.size() - first);
+        sqlite3_reset(m_stmtLoadEntities);
+        sqlite3_clear_bindings(m_stmtLoadEntities);
+        for (size_t i = 0; i < count; ++i) {
+            sqlite3_bind_int(m_stmtLoadEntities, static_cast<int>(i + 1), ids[first + i]);
+        }
+        ReadEntityRows(m_stmtLoadEntities, entities);
     }
 
-    sqlite3_bind_int(stmt, 1, m_currentWorldId);
-    sqlite3_bind_int(stmt, 2, chunkX);
-    sqlite3_bind_int(stmt, 3, chunkY);
-    sqlite3_bind_int(stmt, 4, chunkZ);
+    CheckSlowQuery("LoadEntities", GetTimeMs() - startTime);
+    return entities;
+}
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        int entityId = sqlite3_column_int(stmt, 0);
-        m_dbMutex.unlock();
-        entities.push_back(LoadEntity(entityId));
-        m_dbMutex.lock();
-    }
+std::vector<Entity> WorldDatabase::LoadEntitiesInChunk(int chunkX, int chunkY, int chunkZ) {
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    std::vector<Entity> entities;
+    if (!m_db || m_currentWorldId < 0 || !m_stmtLoadEntitiesInChunk) return entities;
 
-    sqlite3_finalize(stmt);
+    float startTime = GetTimeMs();
+
+    sqlite3_reset(m_stmtLoadEntitiesInChunk);
+    sqlite3_clear_bindings(m_stmtLoadEntitiesInChunk);
+    sqlite3_bind_int(m_stmtLoadEntitiesInChunk, 1, m_currentWorldId);
+    sqlite3_bind_int(m_stmtLoadEntitiesInChunk, 2, chunkX);
+    sqlite3_bind_int(m_stmtLoadEntitiesInChunk, 3, chunkY);
+    sqlite3_bind_int(m_stmtLoadEntitiesInChunk, 4, chunkZ);
+    ReadEntityRows(m_stmtLoadEntitiesInChunk, entities);
+
+    CheckSlowQuery("LoadEntitiesInChunk", GetTimeMs() - startTime);
     return entities;
 }
 
 EntityQueryResult WorldDatabase::QueryEntitiesInRadius(glm::vec3 center, float radius) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
     EntityQueryResult result;
-    if (!m_db || m_currentWorldId < 0) return result;
+    if (!m_db || m_currentWorldId < 0 || !m_stmtQueryEntitiesInRadius) return result;
 
     float startTime = GetTimeMs();
 
-    // Use R-tree spatial index for fast queries
-    const char* sql = R"(
-        SELECT e.entity_id FROM EntitySpatialIndex si
-        JOIN Entities e ON si.id = e.entity_id
-        WHERE si.min_x <= ? AND si.max_x >= ? AND
-              si.min_y <= ? AND si.max_y >= ? AND
-              si.min_z <= ? AND si.max_z >= ? AND
-              e.world_id = ? AND e.is_active = 1
-    )";
-
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return result;
-    }
-
+    sqlite3_stmt* stmt = m_stmtQueryEntitiesInRadius;
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
     sqlite3_bind_double(stmt, 1, center.x + radius);
     sqlite3_bind_double(stmt, 2, center.x - radius);
     sqlite3_bind_double(stmt, 3, center.y + radius);
@@ -999,21 +1151,12 @@ EntityQueryResult WorldDatabase::QueryEntitiesInRadius(glm::vec3 center, float r
     sqlite3_bind_double(stmt, 5, center.z + radius);
     sqlite3_bind_double(stmt, 6, center.z - radius);
     sqlite3_bind_int(stmt, 7, m_currentWorldId);
+    sqlite3_bind_double(stmt, 8, center.x);
+    sqlite3_bind_double(stmt, 9, center.y);
+    sqlite3_bind_double(stmt, 10, center.z);
+    sqlite3_bind_double(stmt, 11, static_cast<double>(radius) * radius);
+    ReadEntityRows(stmt, result.entities);
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        int entityId = sqlite3_column_int(stmt, 0);
-        m_dbMutex.unlock();
-        Entity entity = LoadEntity(entityId);
-        m_dbMutex.lock();
-
-        // Additional distance check (R-tree gives bounding box hits)
-        float distSq = glm::dot(entity.position - center, entity.position - center);
-        if (distSq <= radius * radius) {
-            result.entities.push_back(entity);
-        }
-    }
-
-    sqlite3_finalize(stmt);
     result.totalCount = result.entities.size();
     result.queryTime = GetTimeMs() - startTime;
 
@@ -1024,25 +1167,17 @@ EntityQueryResult WorldDatabase::QueryEntitiesInRadius(glm::vec3 center, float r
 std::vector<Entity> WorldDatabase::QueryEntitiesByType(const std::string& entityType) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
     std::vector<Entity> entities;
-    if (!m_db || m_currentWorldId < 0) return entities;
-
-    const char* sql = "SELECT entity_id FROM Entities WHERE world_id = ? AND entity_type = ? AND is_active = 1";
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        return entities;
-    }
+    if (!m_db || m_currentWorldId < 0 || !m_stmtQueryEntitiesByType) return entities;
 
-    sqlite3_bind_int(stmt, 1, m_currentWorldId);
-    sqlite3_bind_text(stmt, 2, entityType.c_str(), -1, SQLITE_TRANSIENT);
+    float startTime = GetTimeMs();
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        int entityId = sqlite3_column_int(stmt, 0);
-        m_dbMutex.unlock();
-        entities.push_back(LoadEntity(entityId));
-        m_dbMutex.lock();
-    }
+    sqlite3_reset(m_stmtQueryEntitiesByType);
+    sqlite3_clear_bindings(m_stmtQueryEntitiesByType);
+    sqlite3_bind_int(m_stmtQueryEntitiesByType, 1, m_currentWorldId);
+    sqlite3_bind_text(m_stmtQueryEntitiesByType, 2, entityType.c_str(), -1, SQLITE_TRANSIENT);
+    ReadEntityRows(m_stmtQueryEntitiesByType, entities);
 
-    sqlite3_finalize(stmt);
+    CheckSlowQuery("QueryEntitiesByType", GetTimeMs() - startTime);
     return entities;
 }
 
@@ -1226,6 +1361,10 @@ Player WorldDatabase::LoadPlayerById(int playerId) {
 
 bool WorldDatabase::SavePlayer(const Player& player) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return SavePlayerLocked(player);
+}
+
+bool WorldDatabase::SavePlayerLocked(const Player& player) {
     if (!m_db || !m_stmtSavePlayer) return false;
 
     float startTime = GetTimeMs();
@@ -1362,6 +1501,10 @@ std::vector<Player> WorldDatabase::GetOnlinePlayers() {
 
 bool WorldDatabase::SaveInventory(int playerId, const std::vector<InventorySlot>& inventory) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return SaveInventoryLocked(playerId, inventory);
+}
+
+bool WorldDatabase::SaveInventoryLocked(int playerId, const std::vector<InventorySlot>& inventory) {
     if (!m_db || !m_stmtSaveInventorySlot) return false;
 
     float startTime = GetTimeMs();
@@ -1461,6 +1604,10 @@ bool WorldDatabase::ClearInventory(int playerId) {
 
 bool WorldDatabase::SaveEquipment(int playerId, const std::map<std::string, EquipmentSlot>& equipment) {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return SaveEquipmentLocked(playerId, equipment);
+}
+
+bool WorldDatabase::SaveEquipmentLocked(int playerId, const std::map<std::string, EquipmentSlot>& equipment) {
     if (!m_db || !m_stmtSaveEquipment) return false;
 
     // Clear existing equipment
@@ -1688,6 +1835,7 @@ bool WorldDatabase::Commit() {
     bool success = ExecuteSQL("COMMIT");
     if (success) {
         m_inTransaction = false;
+        m_writesInTransaction = false;
     }
     return success;
 }
@@ -1699,6 +1847,7 @@ bool WorldDatabase::Rollback() {
     bool success = ExecuteSQL("ROLLBACK");
     if (success) {
         m_inTransaction = false;
+        m_writesInTransaction = false;
     }
     return success;
 }
@@ -1719,6 +1868,274 @@ void WorldDatabase::EndBatch() {
     }
 }
 
+// ============================================================================
+// WRITE-BEHIND QUEUE
+// ============================================================================
+
+namespace {
+
+enum class WriteTable : uint64_t { Chunk = 1, Entity, Player, Inventory, Equipment };
+
+// Coalescing key of a row; 0 = never coalesce
+uint64_t MakeRowKey(WriteTable table, int a, int b = 0, int c = 0) {
+    // 3 bit table, 20 bits per chunk coordinate, 32 bit IDs
+    if (table == WriteTable::Chunk) {
+        return (static_cast<uint64_t>(table) << 61) |
+               ((static_cast<uint64_t>(static_cast<uint32_t>(a)) & 0xFFFFF) << 40) |
+               ((static_cast<uint64_t>(static_cast<uint32_t>(b)) & 0xFFFFF) << 20) |
+               (static_cast<uint64_t>(static_cast<uint32_t>(c)) & 0xFFFFF);
+    }
+    return (static_cast<uint64_t>(table) << 61) | static_cast<uint32_t>(a);
+}
+
+} // namespace
+
+bool WorldDatabase::StartWriteBehind(const WriteBehindConfig& config) {
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    if (m_writeThread.joinable()) return false;
+
+    m_writeConfig = config;
+    m_writeStop = false;
+    m_writeThread = std::thread(&WorldDatabase::WriteBehindLoop, this);
+    return true;
+}
+
+void WorldDatabase::StopWriteBehind() {
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        if (!m_writeThread.joinable()) return;
+        m_writeStop = true;
+    }
+    m_writeCv.notify_all();
+    m_writeThread.join();
+}
+
+bool WorldDatabase::IsWriteBehindRunning() const {
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    return m_writeThread.joinable();
+}
+
+void WorldDatabase::QueueSaveChunk(int chunkX, int chunkY, int chunkZ, ChunkData data) {
+    data.chunkX = chunkX;
+    data.chunkY = chunkY;
+    data.chunkZ = chunkZ;
+    EnqueueWrite(MakeRowKey(WriteTable::Chunk, chunkX, chunkY, chunkZ), std::move(data));
+}
+
+void WorldDatabase::QueueSaveEntity(Entity entity, EntitySavedCallback onSaved) {
+    const uint64_t key = entity.entityId >= 0 ? MakeRowKey(WriteTable::Entity, entity.entityId) : 0;
+    EnqueueWrite(key, EntityWrite{std::move(entity), std::move(onSaved)});
+}
+
+void WorldDatabase::QueueDeleteEntity(int entityId) {
+    EnqueueWrite(MakeRowKey(WriteTable::Entity, entityId), EntityDeletion{entityId});
+}
+
+void WorldDatabase::QueueSavePlayer(Player player) {
+    const uint64_t key = player.playerId >= 0 ? MakeRowKey(WriteTable::Player, player.playerId) : 0;
+    EnqueueWrite(key, std::move(player));
+}
+
+void WorldDatabase::QueueSaveInventory(int playerId, std::vector<InventorySlot> inventory) {
+    EnqueueWrite(MakeRowKey(WriteTable::Inventory, playerId), InventoryWrite{playerId, std::move(inventory)});
+}
+
+void WorldDatabase::QueueSaveEquipment(int playerId, std::map<std::string, EquipmentSlot> equipment) {
+    EnqueueWrite(MakeRowKey(WriteTable::Equipment, playerId), EquipmentWrite{playerId, std::move(equipment)});
+}
+
+bool WorldDatabase::FlushAndWait() {
+    bool ok = true;
+    {
+        std::unique_lock<std::mutex> lock(m_writeMutex);
+        if (m_writeThread.joinable()) {
+            const uint64_t target = m_writeSequence;
+            const uint64_t committedBefore = m_committedSequence;
+            if (m_committedSequence < target) {
+                m_flushRequested = true;
+                m_writeCv.notify_all();
+                m_writeDoneCv.wait(lock, [this, target] { return m_committedSequence >= target; });
+            }
+            ok = m_failedSequence <= committedBefore;
+        }
+    }
+
+    // Writes that joined a manual transaction are only durable once it commits
+    std::lock_guard<std::mutex> dbLock(m_dbMutex);
+    return ok && !m_writesInTransaction;
+}
+
+void WorldDatabase::EnqueueWrite(uint64_t key, PendingWrite write) {
+    std::unique_lock<std::mutex> lock(m_writeMutex);
+    if (!m_writeThread.joinable()) {
+        lock.unlock();
+        int result = 0;
+        {
+            std::lock_guard<std::mutex> dbLock(m_dbMutex);
+            result = ApplyWrite(write);
+            m_writesInTransaction |= m_inTransaction;
+        }
+        if (auto* entity = std::get_if<EntityWrite>(&write); entity && entity->onSaved) {
+            entity->onSaved(result >= 0 ? result : -1);
+        }
+        return;
+    }
+
+    m_writeSequence++;
+    if (key != 0) {
+        auto [it, inserted] = m_pendingRows.try_emplace(key, m_pendingWrites.size());
+        if (!inserted) {
+            // Last write wins, in the slot of the first. Callbacks of replaced
+            // entity saves still run: chained, or told -1 after a deletion
+            PendingWrite& slot = m_pendingWrites[it->second];
+            if (auto* previous = std::get_if<EntityWrite>(&slot); previous && previous->onSaved) {
+                if (auto* next = std::get_if<EntityWrite>(&write)) {
+                    if (next->onSaved) {
+                        next->onSaved = [first = std::move(previous->onSaved), second = std::move(next->onSaved)](int id) {
+                            first(id);
+                            second(id);
+                        };
+                    } else {
+                        next->onSaved = std::move(previous->onSaved);
+                    }
+                } else {
+                    m_supersededSaves.push_back(std::move(previous->onSaved));
+                }
+            }
+            slot = std::move(write);
+            m_writesCoalesced++;
+            return;
+        }
+    }
+
+    if (m_pendingWrites.empty()) {
+        m_groupStart = std::chrono::steady_clock::now();
+    }
+    m_pendingWrites.push_back(std::move(write));
+    if (m_pendingWrites.size() == 1 || m_pendingWrites.size() >= m_writeConfig.maxGroupSize) {
+        m_writeCv.notify_one();
+    }
+}
+
+int WorldDatabase::ApplyWrite(const PendingWrite& write) {
+    bool success = false;
+    if (const auto* chunk = std::get_if<ChunkData>(&write)) {
+        success = SaveChunkLocked(chunk->chunkX, chunk->chunkY, chunk->chunkZ, *chunk);
+    } else if (const auto* entity = std::get_if<EntityWrite>(&write)) {
+        return SaveEntityLocked(entity->entity);
+    } else if (const auto* deletion = std::get_if<EntityDeletion>(&write)) {
+        success = DeleteEntityLocked(deletion->entityId);
+    } else if (const auto* player = std::get_if<Player>(&write)) {
+        success = SavePlayerLocked(*player);
+    } else if (const auto* inventory = std::get_if<InventoryWrite>(&write)) {
+        success = SaveInventoryLocked(inventory->playerId, inventory->inventory);
+    } else {
+        const auto& equipment = std::get<EquipmentWrite>(write);
+        success = SaveEquipmentLocked(equipment.playerId, equipment.equipment);
+    }
+    return success ? 1 : -1;
+}
+
+size_t WorldDatabase::CommitWriteGroup(std::vector<PendingWrite>& group, std::vector<SavedEntity>& saved) {
+    std::lock_guard<std::mutex> lock(m_dbMutex);
+    const auto failAll = [&group, &saved] {
+        for (PendingWrite& write : group) {
+            if (auto* entity = std::get_if<EntityWrite>(&write); entity && entity->onSaved) {
+                saved.emplace_back(std::move(entity->onSaved), -1);
+            }
+        }
+        return group.size();
+    };
+    if (!m_db) return failAll();
+
+    float startTime = GetTimeMs();
+
+    // Inside a manual transaction the group joins it, and is not durable yet
+    const bool ownTransaction = !m_inTransaction;
+    if (ownTransaction && !ExecuteSQL("BEGIN IMMEDIATE")) {
+        return failAll();
+    }
+
+    size_t failed = 0;
+    const size_t firstSaved = saved.size();
+    for (PendingWrite& write : group) {
+        const int result = ApplyWrite(write);
+        if (result < 0) {
+            failed++;
+        }
+        if (auto* entity = std::get_if<EntityWrite>(&write); entity && entity->onSaved) {
+            saved.emplace_back(std::move(entity->onSaved), result >= 0 ? result : -1);
+        }
+    }
+
+    if (!ownTransaction) {
+        m_writesInTransaction = true;
+    } else if (!ExecuteSQL("COMMIT")) {
+        ExecuteSQL("ROLLBACK");
+        failed = group.size();
+        for (size_t i = firstSaved; i < saved.size(); ++i) {
+            saved[i].second = -1;
+        }
+    }
+
+    CheckSlowQuery("WriteBehindCommit", GetTimeMs() - startTime);
+    return failed;
+}
+
+void WorldDatabase::WriteBehindLoop() {
+    std::unique_lock<std::mutex> lock(m_writeMutex);
+    std::vector<PendingWrite> group;
+    std::vector<EntitySavedCallback> superseded;
+    std::vector<SavedEntity> saved;
+
+    while (true) {
+        m_writeCv.wait(lock, [this] { return m_writeStop || !m_pendingWrites.empty(); });
+        if (m_pendingWrites.empty()) break;
+
+        // Let the group gather (and coalesce) writes until the window closes
+        const auto window = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<float, std::milli>(m_writeConfig.coalesceWindowMs));
+        m_writeCv.wait_until(lock, m_groupStart + window, [this] {
+            return m_writeStop || m_flushRequested || m_pendingWrites.size() >= m_writeConfig.maxGroupSize;
+        });
+
+        group.swap(m_pendingWrites);
+        superseded.swap(m_supersededSaves);
+        m_pendingRows.clear();
+        m_flushRequested = false;
+        const uint64_t sequence = m_writeSequence;
+        const auto groupStart = m_groupStart;
+
+        lock.unlock();
+        const size_t failed = CommitWriteGroup(group, saved);
+        const float latencyMs = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - groupStart).count();
+
+        // Callbacks run with no lock held, so they may query or queue more writes
+        for (auto& [onSaved, entityId] : saved) {
+            onSaved(entityId);
+        }
+        for (EntitySavedCallback& onSaved : superseded) {
+            onSaved(-1);
+        }
+        saved.clear();
+        superseded.clear();
+        lock.lock();
+
+        m_writesCommitted += group.size() - failed;
+        m_writesFailed += failed;
+        if (failed > 0) {
+            m_failedSequence = sequence;
+        }
+        m_groupCommits++;
+        m_totalCommitLatencyMs += latencyMs;
+        m_maxCommitLatencyMs = std::max(m_maxCommitLatencyMs, latencyMs);
+        m_committedSequence = sequence;
+        group.clear();
+        m_writeDoneCv.notify_all();
+    }
+}
+
 // ============================================================================
 // MAINTENANCE
 // ============================================================================
@@ -1800,8 +2217,26 @@ bool WorldDatabase::RestoreFromBackup(const std::string& backupPath) {
 }
 
 DatabaseStats WorldDatabase::GetStatistics() {
-    std::lock_guard<std::mutex> lock(m_dbMutex);
     DatabaseStats stats;
+    {
+        std::lock_guard<std::mutex> writeLock(m_writeMutex);
+        stats.writeQueueDepth = m_pendingWrites.size();
+        stats.writesQueued = m_writeSequence;
+        stats.writesCoalesced = m_writesCoalesced;
+        stats.writesCommitted = m_writesCommitted;
+        stats.writesFailed = m_writesFailed;
+        stats.groupCommits = m_groupCommits;
+        if (m_writeSequence > m_writesCoalesced) {
+            stats.coalescingRatio = static_cast<float>(m_writeSequence) /
+                                    static_cast<float>(m_writeSequence - m_writesCoalesced);
+        }
+        if (m_groupCommits > 0) {
+            stats.avgCommitLatencyMs = m_totalCommitLatencyMs / static_cast<float>(m_groupCommits);
+        }
+        stats.maxCommitLatencyMs = m_maxCommitLatencyMs;
+    }
+
+    std::lock_guard<std::mutex> lock(m_dbMutex);
     if (!m_db || m_currentWorldId < 0) return stats;
 
     // Get chunk counts
@@ -1838,7 +2273,7 @@ DatabaseStats WorldDatabase::GetStatistics() {
         sqlite3_finalize(stmt);
     }
 
-    stats.databaseSizeBytes = GetDatabaseSize();
+    stats.databaseSizeBytes = GetDatabaseSizeLocked();
     if (m_totalQueries > 0) {
         stats.avgQueryTime = m_totalQueryTime / static_cast<float>(m_totalQueries);
     }
@@ -1848,6 +2283,10 @@ DatabaseStats WorldDatabase::GetStatistics() {
 
 size_t WorldDatabase::GetDatabaseSize() {
     std::lock_guard<std::mutex> lock(m_dbMutex);
+    return GetDatabaseSizeLocked();
+}
+
+size_t WorldDatabase::GetDatabaseSizeLocked() {
     if (!m_db) return 0;
 
     size_t pageCount = 0;
@@ -1878,6 +2317,17 @@ size_t WorldDatabase::GetDatabaseSize() {
 // HELPER FUNCTIONS
 // ============================================================================
 
+void WorldDatabase::ReadEntityRows(sqlite3_stmt* stmt, std::vector<Entity>& entities) {
+    int result;
+    while ((result = sqlite3_step(stmt)) == SQLITE_ROW) {
+        ReadEntityRow(stmt, entities.emplace_back());
+    }
+    if (result != SQLITE_DONE) {
+        LogError("Failed to load entities: " + std::string(sqlite3_errmsg(m_db)));
+    }
+    sqlite3_reset(stmt);
+}
+
 bool WorldDatabase::ExecuteSQL(const std::string& sql) {
     if (!m_db) return false;
 
@@ -7,6 +7,12 @@
 #include <map>
 #include <set>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <unordered_map>
+#include <variant>
+#include <span>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <sqlite3.h>
@@ -29,7 +35,7 @@ struct ChunkData {
     int chunkX = 0;
     int chunkY = 0;
     int chunkZ = 0;
-    std::vector<uint8_t> terrainData;      // Compressed voxel data
+    std::vector<uint8_t> terrainData;      // Voxel data, encoded with compressionType
     std::vector<uint8_t> biomeData;        // Biome IDs
     std::vector<uint8_t> lightingData;     // Light values
     bool isGenerated = false;
@@ -37,7 +43,7 @@ struct ChunkData {
     bool isDirty = false;
     uint64_t modifiedAt = 0;
     int loadPriority = 0;
-    std::string compressionType = "zlib";
+    std::string compressionType = "none";  // ChunkCodec name: none, lz4, zstd
     size_t uncompressedSize = 0;
     std::string checksum;
 };
@@ -216,6 +222,25 @@ struct DatabaseStats {
     size_t onlinePlayers = 0;
     size_t databaseSizeBytes = 0;
     float avgQueryTime = 0.0f;
+
+    // Write-behind queue
+    size_t writeQueueDepth = 0;            // Distinct rows waiting for the writer
+    uint64_t writesQueued = 0;
+    uint64_t writesCoalesced = 0;          // Queued writes replaced by a later write to the same row
+    uint64_t writesCommitted = 0;
+    uint64_t writesFailed = 0;
+    uint64_t groupCommits = 0;
+    float coalescingRatio = 1.0f;          // Writes queued per row written
+    float avgCommitLatencyMs = 0.0f;       // First write of a group queued -> group committed
+    float maxCommitLatencyMs = 0.0f;
+};
+
+/**
+ * @brief Write-behind queue configuration
+ */
+struct WriteBehindConfig {
+    float coalesceWindowMs = 100.0f;       // How long a group gathers writes before it is committed
+    size_t maxGroupSize = 2048;            // Commit early once this many distinct rows are pending
 };
 
 /**
@@ -380,6 +405,18 @@ public:
      */
     bool MarkChunkDirty(int chunkX, int chunkY, int chunkZ, bool dirty = true);
 
+    /**
+     * @brief Store a trained chunk compression dictionary for a world
+     * @param dictionaryId ID embedded in the dictionary (and in every frame it encodes)
+     */
+    bool SaveChunkDictionary(int worldId, uint32_t dictionaryId, const std::string& codec,
+                             const std::vector<uint8_t>& dictionary);
+
+    /**
+     * @brief All chunk dictionaries of a world for a codec, oldest first
+     */
+    std::vector<std::vector<uint8_t>> LoadChunkDictionaries(int worldId, const std::string& codec);
+
     // =========================================================================
     // ENTITY OPERATIONS
     // =========================================================================
@@ -401,6 +438,13 @@ public:
      */
     Entity LoadEntityByUUID(const std::string& uuid);
 
+    /**
+     * @brief Load many entities with a few set-based queries
+     * @param entityIds Entity IDs (any order, duplicates allowed)
+     * @return Entities found, in ascending ID order (missing IDs are skipped)
+     */
+    std::vector<Entity> LoadEntities(std::span<const int> entityIds);
+
     /**
      * @brief Delete entity
      */
@@ -561,6 +605,54 @@ public:
      */
     bool IsInTransaction() const { return m_inTransaction; }
 
+    // =========================================================================
+    // WRITE-BEHIND QUEUE
+    // =========================================================================
+
+    /**
+     * @brief Start the background writer behind the Queue* calls
+     *
+     * Queue* calls return immediately. Writes to the same row (chunk, entity,
+     * player, inventory, equipment) queued within one coalescing window
+     * collapse into the last one, and each group is committed in a single
+     * transaction on the writer thread. Writes that land while a manual
+     * BeginTransaction()/BeginBatch() is open join it, and are only durable
+     * once the caller commits it (see FlushAndWait()). LoadWorld(),
+     * UnloadWorld() and Shutdown() flush the queue first. Without a running
+     * writer, Queue* calls save synchronously.
+     */
+    bool StartWriteBehind(const WriteBehindConfig& config = WriteBehindConfig{});
+
+    /**
+     * @brief Commit everything still queued and stop the writer thread
+     */
+    void StopWriteBehind();
+
+    bool IsWriteBehindRunning() const;
+
+    /**
+     * @brief Called on the writer thread once a queued entity save has committed
+     *
+     * Receives the entity's row ID (assigned by the save for new entities),
+     * or -1 if the save failed or a queued deletion of the entity replaced it.
+     */
+    using EntitySavedCallback = std::function<void(int entityId)>;
+
+    void QueueSaveChunk(int chunkX, int chunkY, int chunkZ, ChunkData data);
+    void QueueSaveEntity(Entity entity, EntitySavedCallback onSaved = nullptr);  // New entities (entityId < 0) are never coalesced
+    void QueueDeleteEntity(int entityId);
+    void QueueSavePlayer(Player player);
+    void QueueSaveInventory(int playerId, std::vector<InventorySlot> inventory);
+    void QueueSaveEquipment(int playerId, std::map<std::string, EquipmentSlot> equipment);
+
+    /**
+     * @brief Durability fence: block until every write queued before the call is committed
+     * @return false if a group committed while waiting had failed writes, or
+     *         if queued writes joined a manual transaction that is still open
+     *         (they are lost if it is rolled back)
+     */
+    bool FlushAndWait();
+
     // =========================================================================
     // MAINTENANCE
     // =========================================================================
@@ -612,6 +704,32 @@ private:
     bool PrepareStatements();
     void FinalizeStatements();
 
+    // Steps stmt to completion, appending one entity per row
+    void ReadEntityRows(sqlite3_stmt* stmt, std::vector<Entity>& entities);
+
+    // Write operations; the caller holds m_dbMutex
+    bool SaveChunkLocked(int chunkX, int chunkY, int chunkZ, const ChunkData& data);
+    int SaveEntityLocked(const Entity& entity);
+    bool DeleteEntityLocked(int entityId);
+    bool SavePlayerLocked(const Player& player);
+    bool SaveInventoryLocked(int playerId, const std::vector<InventorySlot>& inventory);
+    bool SaveEquipmentLocked(int playerId, const std::map<std::string, EquipmentSlot>& equipment);
+    size_t GetDatabaseSizeLocked();
+
+    // Write-behind queue
+    struct EntityWrite { Entity entity; EntitySavedCallback onSaved; };
+    struct EntityDeletion { int entityId; };
+    struct InventoryWrite { int playerId; std::vector<InventorySlot> inventory; };
+    struct EquipmentWrite { int playerId; std::map<std::string, EquipmentSlot> equipment; };
+    using PendingWrite = std::variant<ChunkData, EntityWrite, EntityDeletion, Player, InventoryWrite, EquipmentWrite>;
+
+    using SavedEntity = std::pair<EntitySavedCallback, int>;
+
+    void EnqueueWrite(uint64_t key, PendingWrite write);
+    int ApplyWrite(const PendingWrite& write);         // Entity ID for entity saves, otherwise 1; < 0 on failure
+    size_t CommitWriteGroup(std::vector<PendingWrite>& group, std::vector<SavedEntity>& saved);
+    void WriteBehindLoop();
+
     // Helper functions
     bool ExecuteSQL(const std::string& sql);
     int64_t GetLastInsertRowId();
@@ -626,6 +744,7 @@ private:
     std::string m_dbPath;
     int m_currentWorldId = -1;
     bool m_inTransaction = false;
+    bool m_writesInTransaction = false;     // Queued writes joined the open manual transaction
     int m_batchDepth = 0;
     mutable std::mutex m_dbMutex;
 
@@ -637,6 +756,10 @@ private:
     sqlite3_stmt* m_stmtLoadEntity = nullptr;
     sqlite3_stmt* m_stmtLoadEntityByUUID = nullptr;
     sqlite3_stmt* m_stmtDeleteEntity = nullptr;
+    sqlite3_stmt* m_stmtLoadEntities = nullptr;            // IN list of kEntityBatchSize IDs
+    sqlite3_stmt* m_stmtLoadEntitiesInChunk = nullptr;
+    sqlite3_stmt* m_stmtQueryEntitiesInRadius = nullptr;
+    sqlite3_stmt* m_stmtQueryEntitiesByType = nullptr;
     sqlite3_stmt* m_stmtSavePlayer = nullptr;
     sqlite3_stmt* m_stmtLoadPlayer = nullptr;
     sqlite3_stmt* m_stmtSaveInventorySlot = nullptr;
@@ -644,6 +767,30 @@ private:
     sqlite3_stmt* m_stmtSaveEquipment = nullptr;
     sqlite3_stmt* m_stmtLoadEquipment = nullptr;
 
+    static constexpr size_t kEntityBatchSize = 128;      // IDs per LoadEntities query
+
+    // Write-behind queue (m_writeMutex guards everything below except the thread)
+    WriteBehindConfig m_writeConfig;
+    std::thread m_writeThread;
+    mutable std::mutex m_writeMutex;
+    std::condition_variable m_writeCv;                      // Writer: writes pending, flush or stop
+    std::condition_variable m_writeDoneCv;                  // FlushAndWait: group committed
+    std::vector<PendingWrite> m_pendingWrites;
+    std::unordered_map<uint64_t, size_t> m_pendingRows;     // Row key -> index in m_pendingWrites
+    std::vector<EntitySavedCallback> m_supersededSaves;     // Saves replaced by a deletion, told -1
+    std::chrono::steady_clock::time_point m_groupStart;     // First write of the pending group
+    uint64_t m_writeSequence = 0;                           // Writes queued so far
+    uint64_t m_committedSequence = 0;                       // Writes the writer has finished
+    uint64_t m_failedSequence = 0;                          // m_writeSequence of the last group with failures
+    bool m_flushRequested = false;
+    bool m_writeStop = false;
+    uint64_t m_writesCoalesced = 0;
+    uint64_t m_writesCommitted = 0;
+    uint64_t m_writesFailed = 0;
+    uint64_t m_groupCommits = 0;
+    float m_totalCommitLatencyMs = 0.0f;
+    float m_maxCommitLatencyMs = 0.0f;
+
     // Performance tracking
     float m_totalQueryTime = 0.0f;
     size_t m_totalQueries = 0;
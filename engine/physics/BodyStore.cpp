@@ -0,0 +1,334 @@
+#include "BodyStore.hpp"
+#include "CollisionBody.hpp"
+#include "../core/SIMD.hpp"
+#include <cassert>
+#include <cmath>
+
+namespace Nova {
+
+namespace {
+
+using SIMD::FloatBatch;
+
+constexpr size_t kWidth = FloatBatch::Width;
+
+// Angular speed (squared) below which rotation is not integrated
+constexpr float kSpinEpsilon = 1e-6f;
+
+constexpr uint32_t kMovedFlags = PhysicsBodyStore::FlagBoundsDirty | PhysicsBodyStore::FlagBroadPhaseDirty;
+
+/**
+ * @brief (1 - damping)^dt, the per-step velocity scale
+ */
+float DampingFactor(float damping, float dt) {
+    return std::pow(1.0f - damping, dt);
+}
+
+} // anonymous namespace
+
+PhysicsBodyStore::~PhysicsBodyStore() {
+    Clear();
+}
+
+// ============================================================================
+// Attachment
+// ============================================================================
+
+PhysicsBodyStore::Slot PhysicsBodyStore::Attach(CollisionBody& body) {
+    assert(body.m_store == nullptr && "Body is already attached to a store");
+
+    const glm::vec3& p = body.m_position;
+    const glm::quat& q = body.m_rotation;
+    const glm::vec3& v = body.m_linearVelocity;
+    const glm::vec3& w = body.m_angularVelocity;
+    const glm::vec3& f = body.m_accumulatedForce;
+
+    const Slot slot = m_data.Add(
+        p.x, p.y, p.z,
+        q.x, q.y, q.z, q.w,
+        v.x, v.y, v.z,
+        w.x, w.y, w.z,
+        f.x, f.y, f.z,
+        0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f,
+        body.m_sleepTimer,
+        0.0f, 0.0f,
+        kMovedFlags,
+        &body);
+
+    body.m_store = this;
+    body.m_storeSlot = slot;
+    SyncProperties(slot, body);
+
+    if (glm::dot(body.m_accumulatedTorque, body.m_accumulatedTorque) > 0.0f) {
+        SetFlags(slot, FlagHasTorque);
+    }
+    return slot;
+}
+
+void PhysicsBodyStore::Detach(CollisionBody& body) {
+    const Slot slot = body.m_storeSlot;
+    if (body.m_store != this || slot >= Size() || GetBody(slot) != &body) return;
+
+    body.m_position = GetPosition(slot);
+    body.m_rotation = GetRotation(slot);
+    body.m_linearVelocity = GetLinearVelocity(slot);
+    body.m_angularVelocity = GetAngularVelocity(slot);
+    body.m_accumulatedForce = GetForce(slot);
+    body.m_sleepTimer = GetSleepTimer(slot);
+    if (GetFlags(slot) & FlagBoundsDirty) {
+        body.m_boundsDirty = true;
+    }
+
+    body.m_store = nullptr;
+    body.m_storeSlot = INVALID_SLOT;
+
+    // The last slot was swapped into the gap; point its body at the new slot
+    if (m_data.Remove(slot) != INVALID_SLOT) {
+        GetBody(slot)->m_storeSlot = slot;
+    }
+}
+
+void PhysicsBodyStore::Clear() {
+    while (Size() > 0) {
+        Detach(*GetBody(static_cast<Slot>(Size() - 1)));
+    }
+}
+
+void PhysicsBodyStore::SyncProperties(Slot slot, const CollisionBody& body) {
+    const bool dynamic = body.m_bodyType == BodyType::Dynamic;
+    const bool active = body.m_enabled && !body.m_sleeping;
+
+    m_data.Get<InverseMass>()[slot] = dynamic ? body.m_inverseMass : 0.0f;
+    m_data.Get<GravityScale>()[slot] = body.m_gravityScale;
+    m_data.Get<LinearDamping>()[slot] = body.m_linearDamping;
+    m_data.Get<AngularDamping>()[slot] = body.m_angularDamping;
+    m_data.Get<IntegrateMask>()[slot] = (active && dynamic) ? 1.0f : 0.0f;
+    m_data.Get<MoveMask>()[slot] = (active && body.m_bodyType != BodyType::Static) ? 1.0f : 0.0f;
+    UpdateDampingFactors(slot);
+
+    if (active) {
+        SetFlags(slot, FlagActive);
+    } else {
+        ClearFlags(slot, FlagActive);
+    }
+}
+
+void PhysicsBodyStore::UpdateDampingFactors(Slot slot) {
+    m_data.Get<LinearDampingFactor>()[slot] = DampingFactor(m_data.Get<LinearDamping>()[slot], m_dampingDt);
+    m_data.Get<AngularDampingFactor>()[slot] = DampingFactor(m_data.Get<AngularDamping>()[slot], m_dampingDt);
+}
+
+// ============================================================================
+// Batch Kernels
+// ============================================================================
+
+void PhysicsBodyStore::IntegrateTorques(float dt) {
+    // Torque is rare and needs the body's 3x3 inverse inertia, so it stays scalar
+    const size_t count = Size();
+    uint32_t* flags = m_data.Data<FlagBits>();
+    const float* mask = m_data.Data<IntegrateMask>();
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!(flags[i] & FlagHasTorque) || mask[i] == 0.0f) continue;
+        flags[i] &= ~FlagHasTorque;
+
+        CollisionBody& body = *m_data.Get<Body>()[i];
+        const Slot slot = static_cast<Slot>(i);
+        glm::vec3 angularAccel = body.m_inverseInertiaTensor * body.m_accumulatedTorque;
+        SetAngularVelocity(slot, GetAngularVelocity(slot) + angularAccel * dt);
+        body.m_accumulatedTorque = glm::vec3(0.0f);
+    }
+}
+
+void PhysicsBodyStore::IntegrateForces(const glm::vec3& gravity, float dt) {
+    if (dt != m_dampingDt) {
+        m_dampingDt = dt;
+        for (Slot slot = 0; slot < Size(); ++slot) {
+            UpdateDampingFactors(slot);
+        }
+    }
+
+    IntegrateTorques(dt);
+
+    const size_t count = Size();
+    const float* mask = m_data.Data<IntegrateMask>();
+    const float* invMass = m_data.Data<InverseMass>();
+    const float* gravityScale = m_data.Data<GravityScale>();
+    const float* linearDamping = m_data.Data<LinearDampingFactor>();
+    const float* angularDamping = m_data.Data<AngularDampingFactor>();
+    float* vel[3] = {m_data.Data<LinVelX>(), m_data.Data<LinVelY>(), m_data.Data<LinVelZ>()};
+    float* angVel[3] = {m_data.Data<AngVelX>(), m_data.Data<AngVelY>(), m_data.Data<AngVelZ>()};
+    float* force[3] = {m_data.Data<ForceX>(), m_data.Data<ForceY>(), m_data.Data<ForceZ>()};
+    const float g[3] = {gravity.x, gravity.y, gravity.z};
+
+    // v = (v + (g * gravityScale + F / m) * dt) * damping, masked to awake
+    // dynamic lanes; forces on those lanes are consumed
+    const FloatBatch one = FloatBatch::Broadcast(1.0f);
+    const FloatBatch dtBatch = FloatBatch::Broadcast(dt);
+
+    size_t i = 0;
+    for (; i + kWidth <= count; i += kWidth) {
+        const FloatBatch m = FloatBatch::Load(mask + i);
+        const FloatBatch stepDt = m * dtBatch;
+        const FloatBatch keep = one - m;
+        const FloatBatch im = FloatBatch::Load(invMass + i);
+        const FloatBatch gs = FloatBatch::Load(gravityScale + i);
+        const FloatBatch linScale = MulAdd(m, FloatBatch::Load(linearDamping + i) - one, one);
+        const FloatBatch angScale = MulAdd(m, FloatBatch::Load(angularDamping + i) - one, one);
+
+        for (int axis = 0; axis < 3; ++axis) {
+            const FloatBatch f = FloatBatch::Load(force[axis] + i);
+            const FloatBatch accel = MulAdd(f, im, gs * FloatBatch::Broadcast(g[axis]));
+            const FloatBatch v = MulAdd(accel, stepDt, FloatBatch::Load(vel[axis] + i));
+            (v * linScale).Store(vel[axis] + i);
+            (FloatBatch::Load(angVel[axis] + i) * angScale).Store(angVel[axis] + i);
+            (f * keep).Store(force[axis] + i);
+        }
+    }
+
+    for (; i < count; ++i) {
+        if (mask[i] == 0.0f) continue;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float accel = g[axis] * gravityScale[i] + force[axis][i] * invMass[i];
+            vel[axis][i] = (vel[axis][i] + accel * dt) * linearDamping[i];
+            angVel[axis][i] *= angularDamping[i];
+            force[axis][i] = 0.0f;
+        }
+    }
+}
+
+void PhysicsBodyStore::IntegratePositions(float dt) {
+    const size_t count = Size();
+    const float* mask = m_data.Data<MoveMask>();
+    float* pos[3] = {m_data.Data<PosX>(), m_data.Data<PosY>(), m_data.Data<PosZ>()};
+    const float* vel[3] = {m_data.Data<LinVelX>(), m_data.Data<LinVelY>(), m_data.Data<LinVelZ>()};
+    float* qx = m_data.Data<RotX>();
+    float* qy = m_data.Data<RotY>();
+    float* qz = m_data.Data<RotZ>();
+    float* qw = m_data.Data<RotW>();
+    const float* wx = m_data.Data<AngVelX>();
+    const float* wy = m_data.Data<AngVelY>();
+    const float* wz = m_data.Data<AngVelZ>();
+    uint32_t* flags = m_data.Data<FlagBits>();
+
+    const FloatBatch dtBatch = FloatBatch::Broadcast(dt);
+    const FloatBatch halfDt = FloatBatch::Broadcast(0.5f * dt);
+    const FloatBatch zero = FloatBatch::Broadcast(0.0f);
+    const FloatBatch spinEpsilon = FloatBatch::Broadcast(kSpinEpsilon);
+
+    size_t i = 0;
+    for (; i + kWidth <= count; i += kWidth) {
+        const FloatBatch m = FloatBatch::Load(mask + i);
+        const FloatBatch stepDt = m * dtBatch;
+
+        for (int axis = 0; axis < 3; ++axis) {
+            MulAdd(FloatBatch::Load(vel[axis] + i), stepDt, FloatBatch::Load(pos[axis] + i)).Store(pos[axis] + i);
+        }
+
+        // q += 0.5 * dt * (0, w) * q, then renormalize; only spinning, moving lanes
+        const FloatBatch x = FloatBatch::Load(qx + i);
+        const FloatBatch y = FloatBatch::Load(qy + i);
+        const FloatBatch z = FloatBatch::Load(qz + i);
+        const FloatBatch w = FloatBatch::Load(qw + i);
+        const FloatBatch ax = FloatBatch::Load(wx + i);
+        const FloatBatch ay = FloatBatch::Load(wy + i);
+        const FloatBatch az = FloatBatch::Load(wz + i);
+
+        const FloatBatch spin2 = MulAdd(ax, ax, MulAdd(ay, ay, az * az));
+        const FloatBatch rotate = And(CmpGt(m, zero), CmpGt(spin2, spinEpsilon));
+
+        const FloatBatch dw = zero - MulAdd(ax, x, MulAdd(ay, y, az * z));
+        const FloatBatch dx = MulAdd(ax, w, ay * z - az * y);
+        const FloatBatch dy = MulAdd(ay, w, az * x - ax * z);
+        const FloatBatch dz = MulAdd(az, w, ax * y - ay * x);
+
+        const FloatBatch nx = MulAdd(dx, halfDt, x);
+        const FloatBatch ny = MulAdd(dy, halfDt, y);
+        const FloatBatch nz = MulAdd(dz, halfDt, z);
+        const FloatBatch nw = MulAdd(dw, halfDt, w);
+        const FloatBatch length = Sqrt(MulAdd(nx, nx, MulAdd(ny, ny, MulAdd(nz, nz, nw * nw))));
+
+        Select(rotate, nx / length, x).Store(qx + i);
+        Select(rotate, ny / length, y).Store(qy + i);
+        Select(rotate, nz / length, z).Store(qz + i);
+        Select(rotate, nw / length, w).Store(qw + i);
+    }
+
+    for (; i < count; ++i) {
+        if (mask[i] == 0.0f) continue;
+        for (int axis = 0; axis < 3; ++axis) {
+            pos[axis][i] += vel[axis][i] * dt;
+        }
+
+        if (wx[i] * wx[i] + wy[i] * wy[i] + wz[i] * wz[i] > kSpinEpsilon) {
+            const float x = qx[i], y = qy[i], z = qz[i], w = qw[i];
+            const float nx = x + (wx[i] * w + wy[i] * z - wz[i] * y) * 0.5f * dt;
+            const float ny = y + (wy[i] * w + wz[i] * x - wx[i] * z) * 0.5f * dt;
+            const float nz = z + (wz[i] * w + wx[i] * y - wy[i] * x) * 0.5f * dt;
+            const float nw = w - (wx[i] * x + wy[i] * y + wz[i] * z) * 0.5f * dt;
+            const float length = std::sqrt(nx * nx + ny * ny + nz * nz + nw * nw);
+            qx[i] = nx / length;
+            qy[i] = ny / length;
+            qz[i] = nz / length;
+            qw[i] = nw / length;
+        }
+    }
+
+    for (i = 0; i < count; ++i) {
+        if (mask[i] != 0.0f) flags[i] |= kMovedFlags;
+    }
+}
+
+void PhysicsBodyStore::UpdateSleepTimers(float linearThreshold, float angularThreshold, float dt) {
+    const size_t count = Size();
+    const float* mask = m_data.Data<IntegrateMask>();
+    const float* vel[3] = {m_data.Data<LinVelX>(), m_data.Data<LinVelY>(), m_data.Data<LinVelZ>()};
+    const float* angVel[3] = {m_data.Data<AngVelX>(), m_data.Data<AngVelY>(), m_data.Data<AngVelZ>()};
+    float* timer = m_data.Data<SleepTimer>();
+
+    const float linear2 = linearThreshold * linearThreshold;
+    const float angular2 = angularThreshold * angularThreshold;
+
+    const FloatBatch zero = FloatBatch::Broadcast(0.0f);
+    const FloatBatch dtBatch = FloatBatch::Broadcast(dt);
+    const FloatBatch linearLimit = FloatBatch::Broadcast(linear2);
+    const FloatBatch angularLimit = FloatBatch::Broadcast(angular2);
+
+    size_t i = 0;
+    for (; i + kWidth <= count; i += kWidth) {
+        const FloatBatch vx = FloatBatch::Load(vel[0] + i);
+        const FloatBatch vy = FloatBatch::Load(vel[1] + i);
+        const FloatBatch vz = FloatBatch::Load(vel[2] + i);
+        const FloatBatch ax = FloatBatch::Load(angVel[0] + i);
+        const FloatBatch ay = FloatBatch::Load(angVel[1] + i);
+        const FloatBatch az = FloatBatch::Load(angVel[2] + i);
+
+        const FloatBatch speed2 = MulAdd(vx, vx, MulAdd(vy, vy, vz * vz));
+        const FloatBatch spin2 = MulAdd(ax, ax, MulAdd(ay, ay, az * az));
+        const FloatBatch slow = And(CmpLt(speed2, linearLimit), CmpLt(spin2, angularLimit));
+
+        const FloatBatch t = FloatBatch::Load(timer + i);
+        const FloatBatch updated = Select(slow, t + dtBatch, zero);
+        Select(CmpGt(FloatBatch::Load(mask + i), zero), updated, t).Store(timer + i);
+    }
+
+    for (; i < count; ++i) {
+        if (mask[i] == 0.0f) continue;
+        const float speed2 = vel[0][i] * vel[0][i] + vel[1][i] * vel[1][i] + vel[2][i] * vel[2][i];
+        const float spin2 = angVel[0][i] * angVel[0][i] + angVel[1][i] * angVel[1][i] + angVel[2][i] * angVel[2][i];
+        timer[i] = (speed2 < linear2 && spin2 < angular2) ? timer[i] + dt : 0.0f;
+    }
+}
+
+size_t PhysicsBodyStore::CountActive() const {
+    const size_t count = Size();
+    const uint32_t* flags = m_data.Data<FlagBits>();
+
+    size_t active = 0;
+    for (size_t i = 0; i < count; ++i) {
+        active += (flags[i] & FlagActive) ? 1 : 0;
+    }
+    return active;
+}
+
+} // namespace Nova
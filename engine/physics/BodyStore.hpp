@@ -0,0 +1,192 @@
+#pragma once
+
+#include "../core/SoA.hpp"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nova {
+
+class CollisionBody;
+
+/**
+ * @brief Data-oriented storage for the hot simulation state of world bodies
+ *
+ * Positions, rotations, velocities, forces, inverse mass, damping and sleep
+ * timers live in separate 64-byte aligned float arrays, one slot per body.
+ * Integration, damping and sleep checks run as SIMD batch kernels over the
+ * arrays instead of chasing a pointer per body.
+ *
+ * While a CollisionBody is attached, the store is authoritative for its
+ * kinematic state and the body's accessors read and write its slot. Slow
+ * changing properties (mass, damping, body type, sleep/enabled flags) stay
+ * on the body and are mirrored into the store by CollisionBody::SyncStore().
+ */
+class PhysicsBodyStore {
+public:
+    using Slot = uint32_t;
+    static constexpr Slot INVALID_SLOT = ~Slot{0};
+
+    /// Per-slot flag bits
+    enum Flags : uint32_t {
+        FlagBoundsDirty     = 1 << 0,  ///< Moved since the body's AABB cache was rebuilt
+        FlagBroadPhaseDirty = 1 << 1,  ///< Moved since the broad-phase proxy was refit
+        FlagHasTorque       = 1 << 2,  ///< Torque accumulated on the body this step
+        FlagActive          = 1 << 3   ///< Enabled and awake
+    };
+
+    PhysicsBodyStore() = default;
+    ~PhysicsBodyStore();
+
+    PhysicsBodyStore(const PhysicsBodyStore&) = delete;
+    PhysicsBodyStore& operator=(const PhysicsBodyStore&) = delete;
+
+    // =========================================================================
+    // Attachment
+    // =========================================================================
+
+    /**
+     * @brief Move a body's state into a new slot and make the body a handle to it
+     */
+    Slot Attach(CollisionBody& body);
+
+    /**
+     * @brief Copy the slot back into the body and release it (swap-remove)
+     */
+    void Detach(CollisionBody& body);
+
+    /**
+     * @brief Detach every body
+     */
+    void Clear();
+
+    /**
+     * @brief Point a slot at the body it was moved to
+     */
+    void Rebind(Slot slot, CollisionBody& body) { m_data.Get<Body>()[slot] = &body; }
+
+    [[nodiscard]] size_t Size() const { return m_data.Size(); }
+    [[nodiscard]] CollisionBody* GetBody(Slot slot) const { return m_data.Get<Body>()[slot]; }
+
+    /**
+     * @brief Mirror mass, damping, type and sleep state from the body
+     */
+    void SyncProperties(Slot slot, const CollisionBody& body);
+
+    // =========================================================================
+    // Element Access
+    // =========================================================================
+
+    [[nodiscard]] glm::vec3 GetPosition(Slot slot) const { return GetVec3<PosX>(slot); }
+    void SetPosition(Slot slot, const glm::vec3& value) { SetVec3<PosX>(slot, value); }
+
+    [[nodiscard]] glm::quat GetRotation(Slot slot) const {
+        return glm::quat(m_data.Get<RotW>()[slot], m_data.Get<RotX>()[slot],
+                         m_data.Get<RotY>()[slot], m_data.Get<RotZ>()[slot]);
+    }
+    void SetRotation(Slot slot, const glm::quat& value) {
+        m_data.Get<RotX>()[slot] = value.x;
+        m_data.Get<RotY>()[slot] = value.y;
+        m_data.Get<RotZ>()[slot] = value.z;
+        m_data.Get<RotW>()[slot] = value.w;
+    }
+
+    [[nodiscard]] glm::vec3 GetLinearVelocity(Slot slot) const { return GetVec3<LinVelX>(slot); }
+    void SetLinearVelocity(Slot slot, const glm::vec3& value) { SetVec3<LinVelX>(slot, value); }
+
+    [[nodiscard]] glm::vec3 GetAngularVelocity(Slot slot) const { return GetVec3<AngVelX>(slot); }
+    void SetAngularVelocity(Slot slot, const glm::vec3& value) { SetVec3<AngVelX>(slot, value); }
+
+    [[nodiscard]] glm::vec3 GetForce(Slot slot) const { return GetVec3<ForceX>(slot); }
+    void SetForce(Slot slot, const glm::vec3& value) { SetVec3<ForceX>(slot, value); }
+
+    [[nodiscard]] float GetSleepTimer(Slot slot) const { return m_data.Get<SleepTimer>()[slot]; }
+    void SetSleepTimer(Slot slot, float value) { m_data.Get<SleepTimer>()[slot] = value; }
+
+    [[nodiscard]] uint32_t GetFlags(Slot slot) const { return m_data.Get<FlagBits>()[slot]; }
+    void SetFlags(Slot slot, uint32_t flags) { m_data.Get<FlagBits>()[slot] |= flags; }
+    void ClearFlags(Slot slot, uint32_t flags) { m_data.Get<FlagBits>()[slot] &= ~flags; }
+
+    // =========================================================================
+    // Batch Kernels
+    // =========================================================================
+
+    /**
+     * @brief Gravity, accumulated forces and damping into velocity
+     *
+     * Applies to enabled, awake dynamic bodies and clears their forces.
+     */
+    void IntegrateForces(const glm::vec3& gravity, float dt);
+
+    /**
+     * @brief Velocity into position and rotation for enabled, awake non-static bodies
+     *
+     * Moved slots are flagged bounds- and broad-phase-dirty.
+     */
+    void IntegratePositions(float dt);
+
+    /**
+     * @brief Advance sleep timers of awake dynamic bodies
+     *
+     * A body's timer grows while both speeds are under their thresholds and
+     * resets otherwise; islands decide when to actually sleep.
+     */
+    void UpdateSleepTimers(float linearThreshold, float angularThreshold, float dt);
+
+    /**
+     * @brief Number of enabled, awake bodies
+     */
+    [[nodiscard]] size_t CountActive() const;
+
+private:
+    // Component indices into m_data
+    enum : size_t {
+        PosX, PosY, PosZ,
+        RotX, RotY, RotZ, RotW,
+        LinVelX, LinVelY, LinVelZ,
+        AngVelX, AngVelY, AngVelZ,
+        ForceX, ForceY, ForceZ,
+        InverseMass,
+        GravityScale,
+        LinearDamping,
+        AngularDamping,
+        LinearDampingFactor,   ///< (1 - damping)^dt for the cached dt
+        AngularDampingFactor,
+        SleepTimer,
+        IntegrateMask,         ///< 1 for enabled, awake dynamic bodies, else 0
+        MoveMask,              ///< 1 for enabled, awake non-static bodies, else 0
+        FlagBits,
+        Body
+    };
+
+    template<size_t X>
+    [[nodiscard]] glm::vec3 GetVec3(Slot slot) const {
+        return glm::vec3(m_data.Get<X>()[slot], m_data.Get<X + 1>()[slot], m_data.Get<X + 2>()[slot]);
+    }
+
+    template<size_t X>
+    void SetVec3(Slot slot, const glm::vec3& value) {
+        m_data.Get<X>()[slot] = value.x;
+        m_data.Get<X + 1>()[slot] = value.y;
+        m_data.Get<X + 2>()[slot] = value.z;
+    }
+
+    void UpdateDampingFactors(Slot slot);
+    void IntegrateTorques(float dt);
+
+    AlignedSoA<
+        float, float, float,
+        float, float, float, float,
+        float, float, float,
+        float, float, float,
+        float, float, float,
+        float, float, float, float, float, float, float,
+        float, float,
+        uint32_t,
+        CollisionBody*> m_data;
+
+    float m_dampingDt = 0.0f;  ///< dt the damping factors were computed for
+};
+
+} // namespace Nova
@@ -0,0 +1,285 @@
+#include "BroadPhase.hpp"
+
+namespace Nova {
+
+namespace {
+
+// Above this many new proxies in one Update(), a full sort beats incremental inserts
+constexpr size_t kIncrementalInsertLimit = 32;
+
+uint64_t MakePairKey(CollisionBody::BodyId a, CollisionBody::BodyId b) {
+    return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// SweepAndPruneBroadPhase
+// ============================================================================
+
+SweepAndPruneBroadPhase::SweepAndPruneBroadPhase(float margin) : m_margin(margin) {
+}
+
+SweepAndPruneBroadPhase::ProxyId SweepAndPruneBroadPhase::CreateProxy(
+    const AABB& aabb, CollisionBody::BodyId bodyId)
+{
+    ProxyId proxy;
+    if (!m_freeProxies.empty()) {
+        proxy = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    } else {
+        proxy = static_cast<ProxyId>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& p = m_proxies[proxy];
+    p.fatAABB = AABB{aabb.min - glm::vec3(m_margin), aabb.max + glm::vec3(m_margin)};
+    p.bodyId = bodyId;
+    p.alive = true;
+
+    m_insertedProxies.push_back(proxy);
+    ++m_proxyCount;
+    return proxy;
+}
+
+void SweepAndPruneBroadPhase::DestroyProxy(ProxyId proxy) {
+    if (proxy >= m_proxies.size() || !m_proxies[proxy].alive) return;
+
+    m_proxies[proxy].alive = false;
+    m_destroyedProxies.push_back(proxy);
+    --m_proxyCount;
+}
+
+bool SweepAndPruneBroadPhase::MoveProxy(ProxyId proxy, const AABB& aabb) {
+    Proxy& p = m_proxies[proxy];
+    if (p.fatAABB.min.x <= aabb.min.x && p.fatAABB.min.y <= aabb.min.y && p.fatAABB.min.z <= aabb.min.z &&
+        p.fatAABB.max.x >= aabb.max.x && p.fatAABB.max.y >= aabb.max.y && p.fatAABB.max.z >= aabb.max.z) {
+        return false;
+    }
+
+    p.fatAABB = AABB{aabb.min - glm::vec3(m_margin), aabb.max + glm::vec3(m_margin)};
+    m_moved = true;
+    return true;
+}
+
+void SweepAndPruneBroadPhase::Update() {
+    m_addedPairs.clear();
+    m_removedPairs.clear();
+
+    PurgeDestroyedProxies();
+
+    if (m_insertedProxies.size() > kIncrementalInsertLimit) {
+        RebuildAll();
+    } else if (m_moved || !m_insertedProxies.empty()) {
+        // New endpoints start past the end of every axis (overlapping nothing)
+        // and are swept into place by the insertion sort like any other move
+        for (ProxyId proxy : m_insertedProxies) {
+            for (auto& endpoints : m_endpoints) {
+                endpoints.push_back(Endpoint{0.0f, proxy << 1});
+                endpoints.push_back(Endpoint{0.0f, (proxy << 1) | 1u});
+            }
+        }
+        RefreshEndpointValues();
+        for (int axis = 0; axis < kAxisCount; ++axis) {
+            InsertionSortAxis(axis);
+        }
+    }
+
+    m_insertedProxies.clear();
+    m_moved = false;
+}
+
+void SweepAndPruneBroadPhase::Clear() {
+    m_proxies.clear();
+    m_freeProxies.clear();
+    m_destroyedProxies.clear();
+    m_insertedProxies.clear();
+    m_proxyCount = 0;
+    m_moved = false;
+
+    for (auto& endpoints : m_endpoints) {
+        endpoints.clear();
+    }
+
+    m_pairs.clear();
+    m_pairStamps.clear();
+    m_pairIndex.clear();
+    m_addedPairs.clear();
+    m_removedPairs.clear();
+}
+
+void SweepAndPruneBroadPhase::RefreshEndpointValues() {
+    for (int axis = 0; axis < kAxisCount; ++axis) {
+        for (Endpoint& endpoint : m_endpoints[axis]) {
+            const AABB& fat = m_proxies[endpoint.GetProxy()].fatAABB;
+            endpoint.value = endpoint.IsMax() ? fat.max[axis] : fat.min[axis];
+        }
+    }
+}
+
+void SweepAndPruneBroadPhase::InsertionSortAxis(int axis) {
+    // Mins sort before maxes at equal values so touching bounds overlap,
+    // matching AABB::Intersects
+    auto less = [](const Endpoint& a, const Endpoint& b) {
+        return a.value < b.value || (a.value == b.value && !a.IsMax() && b.IsMax());
+    };
+
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+    for (size_t i = 1; i < endpoints.size(); ++i) {
+        const Endpoint endpoint = endpoints[i];
+        size_t j = i;
+
+        while (j > 0 && less(endpoint, endpoints[j - 1])) {
+            const Endpoint& swapped = endpoints[j - 1];
+
+            if (!endpoint.IsMax() && swapped.IsMax()) {
+                // Min moved below another max: the intervals now overlap on this axis
+                if (FatOverlap(endpoint.GetProxy(), swapped.GetProxy())) {
+                    AddPair(endpoint.GetProxy(), swapped.GetProxy());
+                }
+            } else if (endpoint.IsMax() && !swapped.IsMax()) {
+                // Max moved below another min: the intervals separated
+                RemovePair(endpoint.GetProxy(), swapped.GetProxy());
+            }
+
+            endpoints[j] = swapped;
+            --j;
+        }
+
+        endpoints[j] = endpoint;
+    }
+}
+
+void SweepAndPruneBroadPhase::RebuildAll() {
+    for (ProxyId proxy : m_insertedProxies) {
+        for (auto& endpoints : m_endpoints) {
+            endpoints.push_back(Endpoint{0.0f, proxy << 1});
+            endpoints.push_back(Endpoint{0.0f, (proxy << 1) | 1u});
+        }
+    }
+    RefreshEndpointValues();
+
+    for (auto& endpoints : m_endpoints) {
+        std::sort(endpoints.begin(), endpoints.end(), [](const Endpoint& a, const Endpoint& b) {
+            return a.value < b.value || (a.value == b.value && !a.IsMax() && b.IsMax());
+        });
+    }
+
+    // Sweep the X axis, stamping every overlapping pair; unstamped pairs are stale
+    ++m_stamp;
+    m_active.clear();
+
+    for (const Endpoint& endpoint : m_endpoints[0]) {
+        const ProxyId proxy = endpoint.GetProxy();
+
+        if (endpoint.IsMax()) {
+            auto it = std::find(m_active.begin(), m_active.end(), proxy);
+            if (it != m_active.end()) {
+                *it = m_active.back();
+                m_active.pop_back();
+            }
+            continue;
+        }
+
+        for (ProxyId other : m_active) {
+            if (!FatOverlap(proxy, other)) continue;
+
+            auto it = m_pairIndex.find(MakePairKey(m_proxies[proxy].bodyId, m_proxies[other].bodyId));
+            if (it != m_pairIndex.end()) {
+                m_pairStamps[it->second] = m_stamp;
+            } else {
+                AddPair(proxy, other);
+            }
+        }
+        m_active.push_back(proxy);
+    }
+
+    for (size_t i = m_pairs.size(); i-- > 0;) {
+        if (m_pairStamps[i] != m_stamp) {
+            m_removedPairs.push_back(m_pairs[i]);
+            RemovePairAt(i);
+        }
+    }
+}
+
+void SweepAndPruneBroadPhase::PurgeDestroyedProxies() {
+    if (m_destroyedProxies.empty()) return;
+
+    auto isDead = [this](const Endpoint& endpoint) {
+        return !m_proxies[endpoint.GetProxy()].alive;
+    };
+    for (auto& endpoints : m_endpoints) {
+        endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), isDead), endpoints.end());
+    }
+
+    m_insertedProxies.erase(
+        std::remove_if(m_insertedProxies.begin(), m_insertedProxies.end(),
+            [this](ProxyId proxy) { return !m_proxies[proxy].alive; }),
+        m_insertedProxies.end());
+
+    std::vector<CollisionBody::BodyId> deadBodies;
+    deadBodies.reserve(m_destroyedProxies.size());
+    for (ProxyId proxy : m_destroyedProxies) {
+        deadBodies.push_back(m_proxies[proxy].bodyId);
+    }
+    std::sort(deadBodies.begin(), deadBodies.end());
+
+    for (size_t i = m_pairs.size(); i-- > 0;) {
+        const CollisionPair& pair = m_pairs[i];
+        if (std::binary_search(deadBodies.begin(), deadBodies.end(), pair.bodyA) ||
+            std::binary_search(deadBodies.begin(), deadBodies.end(), pair.bodyB)) {
+            m_removedPairs.push_back(pair);
+            RemovePairAt(i);
+        }
+    }
+
+    // Slots are only reusable once their endpoints are gone
+    for (ProxyId proxy : m_destroyedProxies) {
+        m_proxies[proxy].bodyId = CollisionBody::INVALID_ID;
+        m_freeProxies.push_back(proxy);
+    }
+    m_destroyedProxies.clear();
+}
+
+void SweepAndPruneBroadPhase::AddPair(ProxyId a, ProxyId b) {
+    CollisionBody::BodyId bodyA = m_proxies[a].bodyId;
+    CollisionBody::BodyId bodyB = m_proxies[b].bodyId;
+    if (bodyA > bodyB) std::swap(bodyA, bodyB);
+
+    auto [it, inserted] = m_pairIndex.try_emplace(MakePairKey(bodyA, bodyB),
+                                                  static_cast<uint32_t>(m_pairs.size()));
+    if (!inserted) return;
+
+    m_pairs.push_back(CollisionPair{bodyA, bodyB});
+    m_pairStamps.push_back(m_stamp);
+    m_addedPairs.push_back(CollisionPair{bodyA, bodyB});
+}
+
+void SweepAndPruneBroadPhase::RemovePair(ProxyId a, ProxyId b) {
+    auto it = m_pairIndex.find(MakePairKey(m_proxies[a].bodyId, m_proxies[b].bodyId));
+    if (it == m_pairIndex.end()) return;
+
+    m_removedPairs.push_back(m_pairs[it->second]);
+    RemovePairAt(it->second);
+}
+
+void SweepAndPruneBroadPhase::RemovePairAt(size_t index) {
+    const CollisionPair removed = m_pairs[index];
+    const size_t last = m_pairs.size() - 1;
+
+    if (index != last) {
+        m_pairs[index] = m_pairs[last];
+        m_pairStamps[index] = m_pairStamps[last];
+        m_pairIndex[MakePairKey(m_pairs[index].bodyA, m_pairs[index].bodyB)] = static_cast<uint32_t>(index);
+    }
+
+    m_pairs.pop_back();
+    m_pairStamps.pop_back();
+    m_pairIndex.erase(MakePairKey(removed.bodyA, removed.bodyB));
+}
+
+bool SweepAndPruneBroadPhase::FatOverlap(ProxyId a, ProxyId b) const {
+    return m_proxies[a].fatAABB.Intersects(m_proxies[b].fatAABB);
+}
+
+} // namespace Nova
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "CollisionBody.hpp"
+#include "CollisionShape.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+
+/**
+ * @brief Collision pair for tracking contacts between bodies
+ */
+struct CollisionPair {
+    CollisionBody::BodyId bodyA;
+    CollisionBody::BodyId bodyB;
+
+    bool operator==(const CollisionPair& other) const {
+        return (bodyA == other.bodyA && bodyB == other.bodyB) ||
+               (bodyA == other.bodyB && bodyB == other.bodyA);
+    }
+};
+
+struct CollisionPairHash {
+    size_t operator()(const CollisionPair& pair) const {
+        auto minId = std::min(pair.bodyA, pair.bodyB);
+        auto maxId = std::max(pair.bodyA, pair.bodyB);
+        return std::hash<uint64_t>{}(static_cast<uint64_t>(minId) << 32 | maxId);
+    }
+};
+
+/**
+ * @brief Persistent sweep-and-prune broad phase
+ *
+ * Keeps one sorted endpoint array per axis across steps. Each proxy stores a
+ * fattened AABB, so a body that moves inside its margin costs nothing; bodies
+ * that leave it have their endpoints re-sorted with insertion sort, which is
+ * close to linear because frame-to-frame motion is small. Overlapping pairs
+ * are only created or destroyed where endpoints swap, and every Update()
+ * reports the pairs that were added and removed.
+ *
+ * Large batches of new proxies (level load, mass spawns) trigger a full
+ * re-sort and sweep instead of thousands of incremental inserts.
+ *
+ * Pairs are reported in terms of fat bounds; callers test the tight bounds
+ * before narrow phase.
+ */
+class SweepAndPruneBroadPhase {
+public:
+    using ProxyId = uint32_t;
+    static constexpr ProxyId INVALID_PROXY = ~0u;
+
+    explicit SweepAndPruneBroadPhase(float margin = 0.1f);
+
+    /**
+     * @brief Register a body's bounds
+     * @return Proxy handle used for subsequent moves and removal
+     */
+    ProxyId CreateProxy(const AABB& aabb, CollisionBody::BodyId bodyId);
+
+    /**
+     * @brief Remove a proxy; its pairs are reported as removed on the next Update()
+     */
+    void DestroyProxy(ProxyId proxy);
+
+    /**
+     * @brief Update a proxy's tight bounds
+     * @return true if the bounds left the fat AABB and the proxy was re-inserted
+     */
+    bool MoveProxy(ProxyId proxy, const AABB& aabb);
+
+    /**
+     * @brief Apply pending creates, moves and removals and refresh pair deltas
+     */
+    void Update();
+
+    /**
+     * @brief Remove all proxies and pairs
+     */
+    void Clear();
+
+    /**
+     * @brief All pairs whose fat bounds currently overlap (bodyA < bodyB)
+     */
+    [[nodiscard]] const std::vector<CollisionPair>& GetPairs() const noexcept { return m_pairs; }
+
+    /**
+     * @brief Pairs that started overlapping during the last Update()
+     */
+    [[nodiscard]] const std::vector<CollisionPair>& GetAddedPairs() const noexcept { return m_addedPairs; }
+
+    /**
+     * @brief Pairs that stopped overlapping (or lost a proxy) during the last Update()
+     */
+    [[nodiscard]] const std::vector<CollisionPair>& GetRemovedPairs() const noexcept { return m_removedPairs; }
+
+    [[nodiscard]] const AABB& GetFatAABB(ProxyId proxy) const { return m_proxies[proxy].fatAABB; }
+    [[nodiscard]] size_t GetProxyCount() const noexcept { return m_proxyCount; }
+
+    [[nodiscard]] float GetMargin() const noexcept { return m_margin; }
+    void SetMargin(float margin) { m_margin = margin; }
+
+private:
+    struct Proxy {
+        AABB fatAABB;
+        CollisionBody::BodyId bodyId = CollisionBody::INVALID_ID;
+        bool alive = false;
+    };
+
+    /**
+     * @brief Interval endpoint; data packs (proxy << 1) | isMax
+     */
+    struct Endpoint {
+        float value;
+        uint32_t data;
+
+        [[nodiscard]] ProxyId GetProxy() const noexcept { return data >> 1; }
+        [[nodiscard]] bool IsMax() const noexcept { return (data & 1u) != 0; }
+    };
+
+    static constexpr int kAxisCount = 3;
+
+    void RefreshEndpointValues();
+    void InsertionSortAxis(int axis);
+    void RebuildAll();
+    void PurgeDestroyedProxies();
+
+    void AddPair(ProxyId a, ProxyId b);
+    void RemovePair(ProxyId a, ProxyId b);
+    void RemovePairAt(size_t index);
+    [[nodiscard]] bool FatOverlap(ProxyId a, ProxyId b) const;
+
+    float m_margin;
+
+    std::vector<Proxy> m_proxies;
+    std::vector<ProxyId> m_freeProxies;
+    std::vector<ProxyId> m_destroyedProxies;  // Released to the free list after the next Update()
+    std::vector<ProxyId> m_insertedProxies;   // Created since the last Update()
+    size_t m_proxyCount = 0;
+    bool m_moved = false;
+
+    std::vector<Endpoint> m_endpoints[kAxisCount];
+
+    // Persistent pair set: dense array + key -> index for O(1) add/remove
+    std::vector<CollisionPair> m_pairs;
+    std::vector<uint32_t> m_pairStamps;
+    std::unordered_map<uint64_t, uint32_t> m_pairIndex;
+    uint32_t m_stamp = 0;
+
+    std::vector<CollisionPair> m_addedPairs;
+    std::vector<CollisionPair> m_removedPairs;
+
+    // Scratch for full rebuilds
+    std::vector<ProxyId> m_active;
+};
+
+} // namespace Nova
@@ -2,6 +2,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <algorithm>
+#include <utility>
 
 namespace Nova {
 
@@ -95,6 +96,69 @@ CollisionBody::CollisionBody(BodyType type) : m_id(s_nextId++), m_bodyType(type)
     }
 }
 
+CollisionBody::~CollisionBody() {
+    if (m_store) {
+        m_store->Detach(*this);
+    }
+}
+
+CollisionBody::CollisionBody(CollisionBody&& other) noexcept {
+    MoveFrom(other);
+}
+
+CollisionBody& CollisionBody::operator=(CollisionBody&& other) noexcept {
+    if (this != &other) {
+        if (m_store) {
+            m_store->Detach(*this);
+        }
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+void CollisionBody::MoveFrom(CollisionBody& other) noexcept {
+    m_id = other.m_id;
+    m_bodyType = other.m_bodyType;
+    m_enabled = other.m_enabled;
+    m_sleeping = other.m_sleeping;
+    m_sleepTimer = other.m_sleepTimer;
+    m_position = other.m_position;
+    m_rotation = other.m_rotation;
+    m_linearVelocity = other.m_linearVelocity;
+    m_angularVelocity = other.m_angularVelocity;
+    m_accumulatedForce = other.m_accumulatedForce;
+    m_accumulatedTorque = other.m_accumulatedTorque;
+    m_mass = other.m_mass;
+    m_inverseMass = other.m_inverseMass;
+    m_inertiaTensor = other.m_inertiaTensor;
+    m_inverseInertiaTensor = other.m_inverseInertiaTensor;
+    m_linearDamping = other.m_linearDamping;
+    m_angularDamping = other.m_angularDamping;
+    m_gravityScale = other.m_gravityScale;
+    m_shapes = std::move(other.m_shapes);
+    m_collisionLayer = other.m_collisionLayer;
+    m_collisionMask = other.m_collisionMask;
+    m_boundsDirty = other.m_boundsDirty;
+    m_worldAABB = other.m_worldAABB;
+    m_broadPhaseProxy = other.m_broadPhaseProxy;
+    m_solverIndex = other.m_solverIndex;
+    m_onCollisionEnter = std::move(other.m_onCollisionEnter);
+    m_onCollisionStay = std::move(other.m_onCollisionStay);
+    m_onCollisionExit = std::move(other.m_onCollisionExit);
+    m_onTriggerEnter = std::move(other.m_onTriggerEnter);
+    m_onTriggerStay = std::move(other.m_onTriggerStay);
+    m_onTriggerExit = std::move(other.m_onTriggerExit);
+    m_contactBodies = std::move(other.m_contactBodies);
+    m_userData = other.m_userData;
+
+    // Take over the store slot; the moved-from body must not detach it
+    m_store = std::exchange(other.m_store, nullptr);
+    m_storeSlot = std::exchange(other.m_storeSlot, PhysicsBodyStore::INVALID_SLOT);
+    if (m_store) {
+        m_store->Rebind(m_storeSlot, *this);
+    }
+}
+
 void CollisionBody::SetBodyType(BodyType type) {
     if (m_bodyType == type) return;
 
@@ -104,89 +168,142 @@ void CollisionBody::SetBodyType(BodyType type) {
         m_mass = 0.0f;
         m_inverseMass = 0.0f;
         m_inverseInertiaTensor = glm::mat3(0.0f);
-        m_linearVelocity = glm::vec3(0.0f);
-        m_angularVelocity = glm::vec3(0.0f);
+        WriteLinearVelocity(glm::vec3(0.0f));
+        WriteAngularVelocity(glm::vec3(0.0f));
+        SyncStore();
     } else {
         RecalculateMassProperties();
     }
 }
 
+void CollisionBody::WakeUp() {
+    if (m_sleeping) {
+        m_sleeping = false;
+        SyncStore();
+    }
+    WriteSleepTimer(0.0f);
+}
+
 void CollisionBody::SetPosition(const glm::vec3& pos) {
-    m_position = pos;
-    m_boundsDirty = true;
+    if (m_store) {
+        m_store->SetPosition(m_storeSlot, pos);
+    } else {
+        m_position = pos;
+    }
+    MarkBoundsDirty();
     WakeUp();
 }
 
 void CollisionBody::SetRotation(const glm::quat& rot) {
-    m_rotation = glm::normalize(rot);
-    m_boundsDirty = true;
+    if (m_store) {
+        m_store->SetRotation(m_storeSlot, glm::normalize(rot));
+    } else {
+        m_rotation = glm::normalize(rot);
+    }
+    MarkBoundsDirty();
     WakeUp();
 }
 
 glm::mat4 CollisionBody::GetTransformMatrix() const {
-    glm::mat4 mat = glm::mat4_cast(m_rotation);
-    mat[3] = glm::vec4(m_position, 1.0f);
+    glm::mat4 mat = glm::mat4_cast(GetRotation());
+    mat[3] = glm::vec4(GetPosition(), 1.0f);
     return mat;
 }
 
 void CollisionBody::SetLinearVelocity(const glm::vec3& vel) {
     if (m_bodyType == BodyType::Static) return;
-    m_linearVelocity = vel;
+    WriteLinearVelocity(vel);
     WakeUp();
 }
 
 void CollisionBody::SetAngularVelocity(const glm::vec3& vel) {
     if (m_bodyType == BodyType::Static) return;
-    m_angularVelocity = vel;
+    WriteAngularVelocity(vel);
     WakeUp();
 }
 
 void CollisionBody::ApplyForce(const glm::vec3& force) {
     if (m_bodyType != BodyType::Dynamic) return;
-    m_accumulatedForce += force;
+    WriteForce(GetAccumulatedForce() + force);
     WakeUp();
 }
 
 void CollisionBody::ApplyForceAtPoint(const glm::vec3& force, const glm::vec3& point) {
     if (m_bodyType != BodyType::Dynamic) return;
-    m_accumulatedForce += force;
-    m_accumulatedTorque += glm::cross(point - m_position, force);
+    WriteForce(GetAccumulatedForce() + force);
+    ApplyTorque(glm::cross(point - GetPosition(), force));
     WakeUp();
 }
 
 void CollisionBody::ApplyTorque(const glm::vec3& torque) {
     if (m_bodyType != BodyType::Dynamic) return;
     m_accumulatedTorque += torque;
+    if (m_store) {
+        m_store->SetFlags(m_storeSlot, PhysicsBodyStore::FlagHasTorque);
+    }
     WakeUp();
 }
 
 void CollisionBody::ApplyImpulse(const glm::vec3& impulse) {
     if (m_bodyType != BodyType::Dynamic) return;
-    m_linearVelocity += impulse * m_inverseMass;
+    WriteLinearVelocity(GetLinearVelocity() + impulse * m_inverseMass);
     WakeUp();
 }
 
 void CollisionBody::ApplyImpulseAtPoint(const glm::vec3& impulse, const glm::vec3& point) {
     if (m_bodyType != BodyType::Dynamic) return;
 
-    m_linearVelocity += impulse * m_inverseMass;
+    WriteLinearVelocity(GetLinearVelocity() + impulse * m_inverseMass);
 
-    glm::vec3 r = point - m_position;
+    glm::vec3 r = point - GetPosition();
     glm::vec3 angularImpulse = glm::cross(r, impulse);
-    m_angularVelocity += m_inverseInertiaTensor * angularImpulse;
+    WriteAngularVelocity(GetAngularVelocity() + m_inverseInertiaTensor * angularImpulse);
 
     WakeUp();
 }
 
 void CollisionBody::ClearForces() {
-    m_accumulatedForce = glm::vec3(0.0f);
+    WriteForce(glm::vec3(0.0f));
     m_accumulatedTorque = glm::vec3(0.0f);
 }
 
+void CollisionBody::WriteLinearVelocity(const glm::vec3& vel) {
+    if (m_store) {
+        m_store->SetLinearVelocity(m_storeSlot, vel);
+    } else {
+        m_linearVelocity = vel;
+    }
+}
+
+void CollisionBody::WriteAngularVelocity(const glm::vec3& vel) {
+    if (m_store) {
+        m_store->SetAngularVelocity(m_storeSlot, vel);
+    } else {
+        m_angularVelocity = vel;
+    }
+}
+
+void CollisionBody::WriteForce(const glm::vec3& force) {
+    if (m_store) {
+        m_store->SetForce(m_storeSlot, force);
+    } else {
+        m_accumulatedForce = force;
+    }
+}
+
+void CollisionBody::WriteSleepTimer(float time) {
+    if (m_store) {
+        m_store->SetSleepTimer(m_storeSlot, time);
+    } else {
+        m_sleepTimer = time;
+    }
+}
+
 void CollisionBody::SetMass(float mass) {
     if (m_bodyType == BodyType::Static) {
         m_mass = 0.0f;
         m_inverseMass = 0.0f;
+        SyncStore();
         return;
     }
 
@@ -201,12 +318,14 @@ void CollisionBody::RecalculateMassProperties() {
         m_inverseMass = 0.0f;
         m_inertiaTensor = glm::mat3(0.0f);
         m_inverseInertiaTensor = glm::mat3(0.0f);
+        SyncStore();
         return;
     }
 
     if (m_shapes.empty()) {
         m_inertiaTensor = glm::mat3(m_mass);
         m_inverseInertiaTensor = glm::mat3(1.0f / m_mass);
+        SyncStore();
         return;
     }
 
@@ -266,18 +385,19 @@ void CollisionBody::RecalculateMassProperties() {
     }
 
     m_inverseInertiaTensor = glm::inverse(m_inertiaTensor);
+    SyncStore();
 }
 
 size_t CollisionBody::AddShape(const CollisionShape& shape) {
     m_shapes.push_back(shape);
-    m_boundsDirty = true;
+    MarkBoundsDirty();
     RecalculateMassProperties();
     return m_shapes.size() - 1;
 }
 
 size_t CollisionBody::AddShape(CollisionShape&& shape) {
     m_shapes.push_back(std::move(shape));
-    m_boundsDirty = true;
+    MarkBoundsDirty();
     RecalculateMassProperties();
     return m_shapes.size() - 1;
 }
@@ -285,14 +405,14 @@ size_t CollisionBody::AddShape(CollisionShape&& shape) {
 void CollisionBody::RemoveShape(size_t index) {
     if (index < m_shapes.size()) {
         m_shapes.erase(m_shapes.begin() + static_cast<ptrdiff_t>(index));
-        m_boundsDirty = true;
+        MarkBoundsDirty();
         RecalculateMassProperties();
     }
 }
 
 void CollisionBody::ClearShapes() {
     m_shapes.clear();
-    m_boundsDirty = true;
+    MarkBoundsDirty();
     RecalculateMassProperties();
 }
 
@@ -302,7 +422,19 @@ bool CollisionBody::ShouldCollideWith(const CollisionBody& other) const {
            (other.m_collisionLayer & m_collisionMask) != 0;
 }
 
+void CollisionBody::MarkBoundsDirty() {
+    m_boundsDirty = true;
+    if (m_store) {
+        m_store->SetFlags(m_storeSlot, PhysicsBodyStore::FlagBoundsDirty | PhysicsBodyStore::FlagBroadPhaseDirty);
+    }
+}
+
 AABB CollisionBody::GetWorldAABB() const {
+    // Bodies moved by the world's integration kernels are flagged in the store
+    if (m_store && (m_store->GetFlags(m_storeSlot) & PhysicsBodyStore::FlagBoundsDirty)) {
+        m_store->ClearFlags(m_storeSlot, PhysicsBodyStore::FlagBoundsDirty);
+        m_boundsDirty = true;
+    }
     if (m_boundsDirty) {
         UpdateWorldAABB();
     }
@@ -311,7 +443,8 @@ AABB CollisionBody::GetWorldAABB() const {
 
 void CollisionBody::UpdateWorldAABB() const {
     if (m_shapes.empty()) {
-        m_worldAABB = AABB{m_position, m_position};
+        const glm::vec3 position = GetPosition();
+        m_worldAABB = AABB{position, position};
         m_boundsDirty = false;
         return;
     }
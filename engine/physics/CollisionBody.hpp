@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CollisionShape.hpp"
+#include "BodyStore.hpp"
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <memory>
@@ -115,13 +116,14 @@ public:
 
     CollisionBody();
     explicit CollisionBody(BodyType type);
-    ~CollisionBody() = default;
+    ~CollisionBody();
 
-    // Non-copyable, movable
+    // Non-copyable, movable (only while not attached to a world). A body
+    // attached to a body store hands its slot to the moved-to body.
     CollisionBody(const CollisionBody&) = delete;
     CollisionBody& operator=(const CollisionBody&) = delete;
-    CollisionBody(CollisionBody&&) noexcept = default;
-    CollisionBody& operator=(CollisionBody&&) noexcept = default;
+    CollisionBody(CollisionBody&& other) noexcept;
+    CollisionBody& operator=(CollisionBody&& other) noexcept;
 
     // =========================================================================
     // Body Type and State
@@ -137,20 +139,24 @@ public:
     [[nodiscard]] bool IsDynamic() const noexcept { return m_bodyType == BodyType::Dynamic; }
 
     [[nodiscard]] bool IsEnabled() const noexcept { return m_enabled; }
-    void SetEnabled(bool enabled) { m_enabled = enabled; }
+    void SetEnabled(bool enabled) { m_enabled = enabled; SyncStore(); }
 
     [[nodiscard]] bool IsSleeping() const noexcept { return m_sleeping; }
-    void SetSleeping(bool sleeping) { m_sleeping = sleeping; }
-    void WakeUp() { m_sleeping = false; m_sleepTimer = 0.0f; }
+    void SetSleeping(bool sleeping) { m_sleeping = sleeping; SyncStore(); }
+    void WakeUp();
 
     // =========================================================================
     // Transform
     // =========================================================================
 
-    [[nodiscard]] const glm::vec3& GetPosition() const noexcept { return m_position; }
+    [[nodiscard]] glm::vec3 GetPosition() const noexcept {
+        return m_store ? m_store->GetPosition(m_storeSlot) : m_position;
+    }
     void SetPosition(const glm::vec3& pos);
 
-    [[nodiscard]] const glm::quat& GetRotation() const noexcept { return m_rotation; }
+    [[nodiscard]] glm::quat GetRotation() const noexcept {
+        return m_store ? m_store->GetRotation(m_storeSlot) : m_rotation;
+    }
     void SetRotation(const glm::quat& rot);
 
     [[nodiscard]] glm::mat4 GetTransformMatrix() const;
@@ -159,10 +165,14 @@ public:
     // Velocity (for dynamic bodies)
     // =========================================================================
 
-    [[nodiscard]] const glm::vec3& GetLinearVelocity() const noexcept { return m_linearVelocity; }
+    [[nodiscard]] glm::vec3 GetLinearVelocity() const noexcept {
+        return m_store ? m_store->GetLinearVelocity(m_storeSlot) : m_linearVelocity;
+    }
     void SetLinearVelocity(const glm::vec3& vel);
 
-    [[nodiscard]] const glm::vec3& GetAngularVelocity() const noexcept { return m_angularVelocity; }
+    [[nodiscard]] glm::vec3 GetAngularVelocity() const noexcept {
+        return m_store ? m_store->GetAngularVelocity(m_storeSlot) : m_angularVelocity;
+    }
     void SetAngularVelocity(const glm::vec3& vel);
 
     /**
@@ -195,7 +205,9 @@ public:
      */
     void ClearForces();
 
-    [[nodiscard]] const glm::vec3& GetAccumulatedForce() const noexcept { return m_accumulatedForce; }
+    [[nodiscard]] glm::vec3 GetAccumulatedForce() const noexcept {
+        return m_store ? m_store->GetForce(m_storeSlot) : m_accumulatedForce;
+    }
     [[nodiscard]] const glm::vec3& GetAccumulatedTorque() const noexcept { return m_accumulatedTorque; }
 
     // =========================================================================
@@ -220,17 +232,17 @@ public:
     // =========================================================================
 
     [[nodiscard]] float GetLinearDamping() const noexcept { return m_linearDamping; }
-    void SetLinearDamping(float damping) { m_linearDamping = glm::clamp(damping, 0.0f, 1.0f); }
+    void SetLinearDamping(float damping) { m_linearDamping = glm::clamp(damping, 0.0f, 1.0f); SyncStore(); }
 
     [[nodiscard]] float GetAngularDamping() const noexcept { return m_angularDamping; }
-    void SetAngularDamping(float damping) { m_angularDamping = glm::clamp(damping, 0.0f, 1.0f); }
+    void SetAngularDamping(float damping) { m_angularDamping = glm::clamp(damping, 0.0f, 1.0f); SyncStore(); }
 
     // =========================================================================
     // Gravity
     // =========================================================================
 
     [[nodiscard]] float GetGravityScale() const noexcept { return m_gravityScale; }
-    void SetGravityScale(float scale) { m_gravityScale = scale; }
+    void SetGravityScale(float scale) { m_gravityScale = scale; SyncStore(); }
 
     // =========================================================================
     // Collision Shapes
@@ -285,7 +297,7 @@ public:
     /**
      * @brief Mark bounds as dirty (will recompute on next query)
      */
-    void MarkBoundsDirty() { m_boundsDirty = true; }
+    void MarkBoundsDirty();
 
     // =========================================================================
     // Collision Callbacks
@@ -337,9 +349,23 @@ public:
 
 private:
     friend class PhysicsWorld;
+    friend class ContactSolver;
+    friend class PhysicsBodyStore;
 
     void SetId(BodyId id) { m_id = id; }
     void UpdateWorldAABB() const;
+    void MoveFrom(CollisionBody& other) noexcept;
+
+    // Kinematic state lives in the world's body store while attached
+    void WriteLinearVelocity(const glm::vec3& vel);
+    void WriteAngularVelocity(const glm::vec3& vel);
+    void WriteForce(const glm::vec3& force);
+    void WriteSleepTimer(float time);
+
+    /// Mirror mass, damping, type and sleep state into the body store
+    void SyncStore() {
+        if (m_store) m_store->SyncProperties(m_storeSlot, *this);
+    }
 
     // Callback invocation (called by PhysicsWorld)
     void OnCollisionEnter(CollisionBody& other, const ContactInfo& contact);
@@ -363,7 +389,7 @@ private:
     bool m_sleeping = false;
     float m_sleepTimer = 0.0f;
 
-    // Transform
+    // Transform (stale while attached to a body store)
     glm::vec3 m_position{0.0f};
     glm::quat m_rotation{1.0f, 0.0f, 0.0f, 0.0f};
 
@@ -397,6 +423,14 @@ private:
     mutable bool m_boundsDirty = true;
     mutable AABB m_worldAABB;
 
+    // Broad-phase registration (managed by PhysicsWorld)
+    uint32_t m_broadPhaseProxy = ~0u;
+    uint32_t m_solverIndex = 0;     ///< Position in the world's body list during a step
+
+    // Body store slot holding the kinematic state (managed by PhysicsWorld)
+    PhysicsBodyStore* m_store = nullptr;
+    PhysicsBodyStore::Slot m_storeSlot = PhysicsBodyStore::INVALID_SLOT;
+
     // Callbacks
     CollisionCallback m_onCollisionEnter;
     CollisionCallback m_onCollisionStay;
@@ -0,0 +1,302 @@
+#include "ContactSolver.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Nova {
+
+namespace {
+
+// Normals closer than this (cosine) are treated as the same contact feature
+constexpr float kWarmStartNormalTolerance = 0.95f;
+
+/**
+ * @brief Deterministic tangent basis so warm-started friction impulses stay meaningful
+ */
+void ComputeTangents(const glm::vec3& normal, glm::vec3& tangent1, glm::vec3& tangent2) {
+    if (std::abs(normal.x) >= 0.57735f) {
+        tangent1 = glm::normalize(glm::vec3(normal.y, -normal.x, 0.0f));
+    } else {
+        tangent1 = glm::normalize(glm::vec3(0.0f, normal.z, -normal.y));
+    }
+    tangent2 = glm::cross(normal, tangent1);
+}
+
+float EffectiveMass(float invMassSum,
+                    const glm::mat3& invInertiaA, const glm::vec3& rA,
+                    const glm::mat3& invInertiaB, const glm::vec3& rB,
+                    const glm::vec3& axis) {
+    glm::vec3 crossA = glm::cross(rA, axis);
+    glm::vec3 crossB = glm::cross(rB, axis);
+    float k = invMassSum +
+              glm::dot(crossA, invInertiaA * crossA) +
+              glm::dot(crossB, invInertiaB * crossB);
+    return k > 0.0f ? 1.0f / k : 0.0f;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// ContactManifold
+// ============================================================================
+
+uint32_t ContactManifold::Update(const std::vector<ContactPoint>& contacts, bool warmStarting) {
+    const std::array<ManifoldPoint, kMaxPoints> previous = points;
+    const uint32_t previousCount = pointCount;
+    bool matched[kMaxPoints] = {};
+
+    pointCount = 0;
+    for (const auto& cp : contacts) {
+        const CollisionShape& shapeA = bodyA->GetShape(static_cast<size_t>(cp.shapeIndexA));
+        const CollisionShape& shapeB = bodyB->GetShape(static_cast<size_t>(cp.shapeIndexB));
+
+        // Triggers report overlaps but never push bodies apart
+        if (shapeA.IsTrigger() || shapeB.IsTrigger()) continue;
+
+        uint32_t slot = pointCount;
+        if (pointCount == kMaxPoints) {
+            // Full: replace the shallowest point if this one is deeper
+            slot = 0;
+            for (uint32_t i = 1; i < kMaxPoints; ++i) {
+                if (points[i].penetration < points[slot].penetration) slot = i;
+            }
+            if (points[slot].penetration >= cp.penetration) continue;
+        } else {
+            ++pointCount;
+        }
+
+        ManifoldPoint& point = points[slot];
+        point = ManifoldPoint{};
+        point.position = cp.position;
+        point.normal = cp.normal;
+        point.penetration = cp.penetration;
+        point.shapeIndexA = cp.shapeIndexA;
+        point.shapeIndexB = cp.shapeIndexB;
+        point.friction = std::sqrt(shapeA.GetMaterial().friction * shapeB.GetMaterial().friction);
+        point.restitution = std::min(shapeA.GetMaterial().restitution, shapeB.GetMaterial().restitution);
+    }
+
+    if (!warmStarting) {
+        return pointCount;
+    }
+
+    // Inherit impulses from the nearest previous point on the same shape pair
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        ManifoldPoint& point = points[i];
+        int best = -1;
+        float bestDist2 = 0.0f;
+
+        for (uint32_t j = 0; j < previousCount; ++j) {
+            const ManifoldPoint& old = previous[j];
+            if (matched[j]) continue;
+            if (old.shapeIndexA != point.shapeIndexA || old.shapeIndexB != point.shapeIndexB) continue;
+            if (glm::dot(old.normal, point.normal) < kWarmStartNormalTolerance) continue;
+
+            glm::vec3 delta = old.position - point.position;
+            float dist2 = glm::dot(delta, delta);
+            if (best < 0 || dist2 < bestDist2) {
+                best = static_cast<int>(j);
+                bestDist2 = dist2;
+            }
+        }
+
+        if (best >= 0) {
+            matched[best] = true;
+            point.normalImpulse = previous[best].normalImpulse;
+            point.tangentImpulse[0] = previous[best].tangentImpulse[0];
+            point.tangentImpulse[1] = previous[best].tangentImpulse[1];
+        }
+    }
+
+    return pointCount;
+}
+
+// ============================================================================
+// ContactSolver
+// ============================================================================
+
+/**
+ * @brief Velocities of a manifold's two bodies, gathered once from the body store
+ *
+ * Impulses accumulate in locals and are written back for dynamic bodies only.
+ */
+class ContactSolver::ManifoldVelocities {
+public:
+    explicit ManifoldVelocities(ContactManifold& manifold)
+        : m_bodyA(*manifold.bodyA)
+        , m_bodyB(*manifold.bodyB)
+        , m_dynamicA(m_bodyA.m_bodyType == BodyType::Dynamic)
+        , m_dynamicB(m_bodyB.m_bodyType == BodyType::Dynamic)
+        , m_linearA(m_bodyA.GetLinearVelocity())
+        , m_angularA(m_bodyA.GetAngularVelocity())
+        , m_linearB(m_bodyB.GetLinearVelocity())
+        , m_angularB(m_bodyB.GetAngularVelocity()) {
+    }
+
+    void ApplyImpulse(const ManifoldPoint& point, const glm::vec3& impulse) {
+        if (m_dynamicA) {
+            m_linearA -= impulse * m_bodyA.m_inverseMass;
+            m_angularA -= m_bodyA.m_inverseInertiaTensor * glm::cross(point.rA, impulse);
+        }
+        if (m_dynamicB) {
+            m_linearB += impulse * m_bodyB.m_inverseMass;
+            m_angularB += m_bodyB.m_inverseInertiaTensor * glm::cross(point.rB, impulse);
+        }
+    }
+
+    [[nodiscard]] glm::vec3 RelativeVelocity(const ManifoldPoint& point) const {
+        return m_linearB + glm::cross(m_angularB, point.rB) -
+               m_linearA - glm::cross(m_angularA, point.rA);
+    }
+
+    void WriteBack() {
+        if (m_dynamicA) {
+            m_bodyA.WriteLinearVelocity(m_linearA);
+            m_bodyA.WriteAngularVelocity(m_angularA);
+        }
+        if (m_dynamicB) {
+            m_bodyB.WriteLinearVelocity(m_linearB);
+            m_bodyB.WriteAngularVelocity(m_angularB);
+        }
+    }
+
+private:
+    CollisionBody& m_bodyA;
+    CollisionBody& m_bodyB;
+    const bool m_dynamicA;
+    const bool m_dynamicB;
+    glm::vec3 m_linearA;
+    glm::vec3 m_angularA;
+    glm::vec3 m_linearB;
+    glm::vec3 m_angularB;
+};
+
+void ContactSolver::Solve(ContactManifold* const* manifolds, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+        Prepare(*manifolds[i]);
+    }
+
+    if (m_settings.warmStarting) {
+        for (size_t i = 0; i < count; ++i) {
+            WarmStart(*manifolds[i]);
+        }
+    }
+
+    for (int iteration = 0; iteration < m_settings.velocityIterations; ++iteration) {
+        for (size_t i = 0; i < count; ++i) {
+            SolveVelocities(*manifolds[i]);
+        }
+    }
+}
+
+void ContactSolver::Prepare(ContactManifold& manifold) const {
+    const CollisionBody& bodyA = *manifold.bodyA;
+    const CollisionBody& bodyB = *manifold.bodyB;
+
+    const bool dynamicA = bodyA.m_bodyType == BodyType::Dynamic;
+    const bool dynamicB = bodyB.m_bodyType == BodyType::Dynamic;
+    const float invMassA = dynamicA ? bodyA.m_inverseMass : 0.0f;
+    const float invMassB = dynamicB ? bodyB.m_inverseMass : 0.0f;
+    const glm::mat3 invInertiaA = dynamicA ? bodyA.m_inverseInertiaTensor : glm::mat3(0.0f);
+    const glm::mat3 invInertiaB = dynamicB ? bodyB.m_inverseInertiaTensor : glm::mat3(0.0f);
+
+    const float invDt = m_settings.dt > 0.0f ? 1.0f / m_settings.dt : 0.0f;
+
+    const glm::vec3 positionA = bodyA.GetPosition();
+    const glm::vec3 positionB = bodyB.GetPosition();
+    const glm::vec3 linearA = bodyA.GetLinearVelocity();
+    const glm::vec3 angularA = bodyA.GetAngularVelocity();
+    const glm::vec3 linearB = bodyB.GetLinearVelocity();
+    const glm::vec3 angularB = bodyB.GetAngularVelocity();
+
+    for (uint32_t i = 0; i < manifold.pointCount; ++i) {
+        ManifoldPoint& point = manifold.points[i];
+
+        point.rA = point.position - positionA;
+        point.rB = point.position - positionB;
+        ComputeTangents(point.normal, point.tangent[0], point.tangent[1]);
+
+        const float invMassSum = invMassA + invMassB;
+        point.normalMass = EffectiveMass(invMassSum, invInertiaA, point.rA, invInertiaB, point.rB, point.normal);
+        point.tangentMass[0] = EffectiveMass(invMassSum, invInertiaA, point.rA, invInertiaB, point.rB, point.tangent[0]);
+        point.tangentMass[1] = EffectiveMass(invMassSum, invInertiaA, point.rA, invInertiaB, point.rB, point.tangent[1]);
+
+        // Bounce only for real impacts; resting contacts would otherwise jitter
+        glm::vec3 relVel = linearB + glm::cross(angularB, point.rB) -
+                           linearA - glm::cross(angularA, point.rA);
+        float velAlongNormal = glm::dot(relVel, point.normal);
+
+        float restitutionBias = 0.0f;
+        if (velAlongNormal < -m_settings.restitutionThreshold) {
+            restitutionBias = -point.restitution * velAlongNormal;
+        }
+
+        // Baumgarte stabilization as a separating velocity target
+        float penetrationBias = m_settings.baumgarte * invDt *
+                                std::max(point.penetration - m_settings.allowedPenetration, 0.0f);
+
+        point.velocityBias = std::max(restitutionBias, penetrationBias);
+
+        if (!m_settings.warmStarting) {
+            point.normalImpulse = 0.0f;
+            point.tangentImpulse[0] = 0.0f;
+            point.tangentImpulse[1] = 0.0f;
+        }
+    }
+}
+
+void ContactSolver::WarmStart(ContactManifold& manifold) const {
+    ManifoldVelocities vel(manifold);
+
+    for (uint32_t i = 0; i < manifold.pointCount; ++i) {
+        const ManifoldPoint& point = manifold.points[i];
+        glm::vec3 impulse = point.normalImpulse * point.normal +
+                            point.tangentImpulse[0] * point.tangent[0] +
+                            point.tangentImpulse[1] * point.tangent[1];
+        vel.ApplyImpulse(point, impulse);
+    }
+
+    vel.WriteBack();
+}
+
+void ContactSolver::SolveVelocities(ContactManifold& manifold) const {
+    ManifoldVelocities vel(manifold);
+
+    auto applyImpulse = [&vel](const ManifoldPoint& point, const glm::vec3& impulse) {
+        vel.ApplyImpulse(point, impulse);
+    };
+
+    auto relativeVelocity = [&vel](const ManifoldPoint& point) {
+        return vel.RelativeVelocity(point);
+    };
+
+    for (uint32_t i = 0; i < manifold.pointCount; ++i) {
+        ManifoldPoint& point = manifold.points[i];
+
+        // Friction first, bounded by the current normal impulse (Coulomb cone as a box)
+        const float maxFriction = point.friction * point.normalImpulse;
+        for (int axis = 0; axis < 2; ++axis) {
+            float velAlongTangent = glm::dot(relativeVelocity(point), point.tangent[axis]);
+            float lambda = -point.tangentMass[axis] * velAlongTangent;
+
+            float previous = point.tangentImpulse[axis];
+            point.tangentImpulse[axis] = glm::clamp(previous + lambda, -maxFriction, maxFriction);
+            lambda = point.tangentImpulse[axis] - previous;
+
+            applyImpulse(point, lambda * point.tangent[axis]);
+        }
+
+        // Normal impulse with accumulated clamping (never pulls bodies together)
+        float velAlongNormal = glm::dot(relativeVelocity(point), point.normal);
+        float lambda = point.normalMass * (point.velocityBias - velAlongNormal);
+
+        float previous = point.normalImpulse;
+        point.normalImpulse = std::max(previous + lambda, 0.0f);
+        lambda = point.normalImpulse - previous;
+
+        applyImpulse(point, lambda * point.normal);
+    }
+
+    vel.WriteBack();
+}
+
+} // namespace Nova
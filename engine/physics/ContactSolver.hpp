@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CollisionBody.hpp"
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Nova {
+
+/**
+ * @brief Contact point persisted across steps with its accumulated impulses
+ */
+struct ManifoldPoint {
+    glm::vec3 position{0.0f};   ///< World space contact point
+    glm::vec3 normal{0.0f};     ///< Contact normal (from A to B)
+    float penetration = 0.0f;
+    int shapeIndexA = 0;
+    int shapeIndexB = 0;
+    float friction = 0.5f;
+    float restitution = 0.0f;
+
+    // Accumulated impulses, carried into the next step for warm starting
+    float normalImpulse = 0.0f;
+    float tangentImpulse[2] = {0.0f, 0.0f};
+
+    // Solver scratch, rebuilt every step
+    glm::vec3 rA{0.0f};
+    glm::vec3 rB{0.0f};
+    glm::vec3 tangent[2] = {glm::vec3(0.0f), glm::vec3(0.0f)};
+    float normalMass = 0.0f;
+    float tangentMass[2] = {0.0f, 0.0f};
+    float velocityBias = 0.0f;
+};
+
+/**
+ * @brief Cached contact manifold between two bodies
+ *
+ * Created by the narrow phase and kept while the bodies touch (or sleep
+ * together), so impulses from the previous step can seed the solver.
+ */
+struct ContactManifold {
+    static constexpr size_t kMaxPoints = 4;
+
+    CollisionBody* bodyA = nullptr;
+    CollisionBody* bodyB = nullptr;
+    std::array<ManifoldPoint, kMaxPoints> points;
+    uint32_t pointCount = 0;
+    uint64_t lastUpdateStep = 0;
+
+    /**
+     * @brief Replace the points with a fresh narrow-phase result
+     *
+     * Non-trigger points are kept (deepest first when there are more than
+     * kMaxPoints). Points from the same shape pair with a similar normal
+     * inherit the previous step's impulses.
+     *
+     * @return Number of solvable points
+     */
+    uint32_t Update(const std::vector<ContactPoint>& contacts, bool warmStarting);
+};
+
+/**
+ * @brief Solver tuning shared by all islands in a step
+ */
+struct ContactSolverSettings {
+    float dt = 1.0f / 60.0f;
+    int velocityIterations = 8;
+    float baumgarte = 0.2f;             ///< Fraction of penetration removed per step
+    float allowedPenetration = 0.01f;   ///< Slop left uncorrected to keep contacts stable
+    float restitutionThreshold = 1.0f;  ///< Closing speed below which bounce is ignored
+    bool warmStarting = true;
+};
+
+/**
+ * @brief Sequential-impulse solver for one island's manifolds
+ *
+ * Solves normal and two-axis friction impulses with accumulated clamping and
+ * Baumgarte position bias. Each manifold gathers its bodies' velocities from
+ * the world's body store once, solves in locals and writes the dynamic ones
+ * back. Non-dynamic bodies are only read, so islands that share static or
+ * kinematic bodies can be solved concurrently.
+ */
+class ContactSolver {
+public:
+    explicit ContactSolver(const ContactSolverSettings& settings) : m_settings(settings) {}
+
+    void Solve(ContactManifold* const* manifolds, size_t count) const;
+
+private:
+    class ManifoldVelocities;
+
+    void Prepare(ContactManifold& manifold) const;
+    void WarmStart(ContactManifold& manifold) const;
+    void SolveVelocities(ContactManifold& manifold) const;
+
+    ContactSolverSettings m_settings;
+};
+
+} // namespace Nova
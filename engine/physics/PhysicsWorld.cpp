@@ -1,10 +1,12 @@
 #include "PhysicsWorld.hpp"
+#include "../core/JobSystem.hpp"
 #include "../graphics/debug/DebugDraw.hpp"
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <algorithm>
 #include <cmath>
 #include <chrono>
+#include <limits>
 
 namespace Nova {
 
@@ -12,6 +14,19 @@ namespace {
 
 constexpr float kEpsilon = 1e-6f;
 
+// Below this many contacts the job dispatch costs more than the solve
+constexpr size_t kMinParallelSolveContacts = 256;
+
+constexpr uint32_t kNoIsland = ~0u;
+
+uint32_t FindRoot(std::vector<uint32_t>& parent, uint32_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];  // Path halving
+        i = parent[i];
+    }
+    return i;
+}
+
 // Closest point on line segment
 glm::vec3 ClosestPointOnSegment(const glm::vec3& point, const glm::vec3& a, const glm::vec3& b) {
     glm::vec3 ab = b - a;
@@ -84,7 +99,9 @@ void ClosestPointsOnSegments(
 
 PhysicsWorld::PhysicsWorld() = default;
 
-PhysicsWorld::PhysicsWorld(const PhysicsWorldConfig& config) : m_config(config) {
+PhysicsWorld::PhysicsWorld(const PhysicsWorldConfig& config)
+    : m_config(config)
+    , m_broadPhase(config.broadPhaseMargin) {
 }
 
 PhysicsWorld::~PhysicsWorld() {
@@ -114,6 +131,7 @@ void PhysicsWorld::Step(float deltaTime) {
 
 void PhysicsWorld::FixedStep() {
     const float dt = m_config.fixedTimestep;
+    ++m_stepCount;
 
     // Store previous contacts for enter/exit detection
     m_previousContacts = m_activeContacts;
@@ -131,10 +149,9 @@ void PhysicsWorld::FixedStep() {
     BroadPhase();
     NarrowPhase();
 
-    // Solve constraints
-    for (int i = 0; i < m_config.velocityIterations; ++i) {
-        ResolveCollisions(dt);
-    }
+    // Solve constraints per island
+    BuildIslands();
+    SolveIslands(dt);
 
     IntegrateVelocities(dt);
     UpdateSleepStates(dt);
@@ -189,89 +206,57 @@ void PhysicsWorld::FixedStep() {
 
     // Update stats
     m_stats.bodyCount = m_bodies.size();
-    m_stats.activeBodyCount = 0;
-    for (const auto& body : m_bodies) {
-        if (body && !body->IsSleeping() && body->IsEnabled()) {
-            ++m_stats.activeBodyCount;
-        }
-    }
+    m_stats.activeBodyCount = m_bodyStore.CountActive();
 }
 
 void PhysicsWorld::IntegrateForces(float dt) {
-    for (auto& body : m_bodies) {
-        if (!body || !body->IsEnabled() || body->IsSleeping()) continue;
-        if (body->GetBodyType() != BodyType::Dynamic) continue;
-
-        // Apply gravity
-        glm::vec3 gravity = m_config.gravity * body->GetGravityScale();
-        body->ApplyForce(gravity * body->GetMass());
-
-        // Integrate forces to velocity
-        glm::vec3 linearAccel = body->GetAccumulatedForce() * body->GetInverseMass();
-        body->SetLinearVelocity(body->GetLinearVelocity() + linearAccel * dt);
-
-        glm::vec3 angularAccel = body->GetInverseInertiaTensor() * body->GetAccumulatedTorque();
-        body->SetAngularVelocity(body->GetAngularVelocity() + angularAccel * dt);
-
-        // Apply damping
-        float linearDamping = std::pow(1.0f - body->GetLinearDamping(), dt);
-        float angularDamping = std::pow(1.0f - body->GetAngularDamping(), dt);
-        body->SetLinearVelocity(body->GetLinearVelocity() * linearDamping);
-        body->SetAngularVelocity(body->GetAngularVelocity() * angularDamping);
-
-        body->ClearForces();
-    }
+    // Gravity, forces and damping for every awake dynamic body in one SIMD pass
+    m_bodyStore.IntegrateForces(m_config.gravity, dt);
 }
 
 void PhysicsWorld::BroadPhase() {
     m_broadPhasePairs.clear();
-    RebuildSpatialHash();
-
-    std::unordered_set<CollisionPair, CollisionPairHash> testedPairs;
 
-    for (auto& body : m_bodies) {
-        if (!body || !body->IsEnabled()) continue;
+    // Refit only bodies whose bounds changed (awake bodies, or ones moved by user code)
+    for (PhysicsBodyStore::Slot slot = 0; slot < m_bodyStore.Size(); ++slot) {
+        if (!(m_bodyStore.GetFlags(slot) & PhysicsBodyStore::FlagBroadPhaseDirty)) continue;
+        m_bodyStore.ClearFlags(slot, PhysicsBodyStore::FlagBroadPhaseDirty);
 
-        AABB aabb = body->GetWorldAABB();
-        std::vector<glm::ivec3> cells;
-        GetCellsForAABB(aabb, cells);
-
-        for (const auto& cell : cells) {
-            size_t hash = HashCell(cell);
-            auto it = m_spatialHash.find(hash);
-            if (it == m_spatialHash.end()) continue;
-
-            for (auto otherId : it->second.bodies) {
-                if (otherId == body->GetId()) continue;
+        const CollisionBody* body = m_bodyStore.GetBody(slot);
+        m_broadPhase.MoveProxy(body->m_broadPhaseProxy, body->GetWorldAABB());
+    }
 
-                CollisionPair pair{body->GetId(), otherId};
-                if (testedPairs.find(pair) != testedPairs.end()) continue;
-                testedPairs.insert(pair);
+    m_broadPhase.Update();
 
-                CollisionBody* other = GetBody(otherId);
-                if (!other || !other->IsEnabled()) continue;
+    for (const auto& pair : m_broadPhase.GetPairs()) {
+        CollisionBody* bodyA = GetBody(pair.bodyA);
+        CollisionBody* bodyB = GetBody(pair.bodyB);
+        if (!bodyA || !bodyB) continue;
+        if (!bodyA->IsEnabled() || !bodyB->IsEnabled()) continue;
 
-                // Skip if both static
-                if (body->IsStatic() && other->IsStatic()) continue;
+        // Skip if both static
+        if (bodyA->IsStatic() && bodyB->IsStatic()) continue;
 
-                // Skip if both sleeping
-                if (body->IsSleeping() && other->IsSleeping()) continue;
+        // Skip if both sleeping
+        if (bodyA->IsSleeping() && bodyB->IsSleeping()) continue;
 
-                // Check layer filtering
-                if (!body->ShouldCollideWith(*other)) continue;
+        // Check layer filtering
+        if (!bodyA->ShouldCollideWith(*bodyB)) continue;
 
-                // AABB test
-                if (aabb.Intersects(other->GetWorldAABB())) {
-                    m_broadPhasePairs.push_back(pair);
-                }
-            }
+        // Broad phase pairs use fat bounds; confirm with the tight ones
+        if (bodyA->GetWorldAABB().Intersects(bodyB->GetWorldAABB())) {
+            m_broadPhasePairs.push_back(pair);
         }
     }
 
     m_stats.broadPhasePairs = m_broadPhasePairs.size();
+    m_stats.broadPhasePairsAdded = m_broadPhase.GetAddedPairs().size();
+    m_stats.broadPhasePairsRemoved = m_broadPhase.GetRemovedPairs().size();
 }
 
 void PhysicsWorld::NarrowPhase() {
+    ContactInfo contact;
+
     for (const auto& pair : m_broadPhasePairs) {
         CollisionBody* bodyA = GetBody(pair.bodyA);
         CollisionBody* bodyB = GetBody(pair.bodyB);
@@ -279,7 +264,6 @@ void PhysicsWorld::NarrowPhase() {
 
         ++m_stats.narrowPhaseTests;
 
-        ContactInfo contact;
         if (TestCollision(*bodyA, *bodyB, contact)) {
             m_activeContacts.insert(pair);
             ++m_stats.contactCount;
@@ -287,124 +271,235 @@ void PhysicsWorld::NarrowPhase() {
             bodyA->AddContact(pair.bodyB);
             bodyB->AddContact(pair.bodyA);
 
+            uint64_t key = MakeContactKey(pair.bodyA, pair.bodyB);
+
             // Cache contact info for event dispatch
             if (m_eventsEnabled && !contact.points.empty()) {
-                uint64_t key = MakeContactKey(pair.bodyA, pair.bodyB);
                 m_contactInfoCache[key] = ConvertContactPoints(contact.points);
             }
+
+            // Refresh the cached manifold, carrying impulses over from last step
+            ContactManifold& manifold = m_manifolds[key];
+            const bool sameOrder = manifold.bodyA == bodyA && manifold.bodyB == bodyB;
+            manifold.bodyA = bodyA;
+            manifold.bodyB = bodyB;
+            if (manifold.Update(contact.points, m_config.warmStarting && sameOrder) == 0) {
+                m_manifolds.erase(key);  // Trigger-only overlap: nothing to solve
+            } else {
+                manifold.lastUpdateStep = m_stepCount;
+            }
         }
     }
-}
 
-void PhysicsWorld::ResolveCollisions(float dt) {
-    for (const auto& pair : m_activeContacts) {
-        CollisionBody* bodyA = GetBody(pair.bodyA);
-        CollisionBody* bodyB = GetBody(pair.bodyB);
-        if (!bodyA || !bodyB) continue;
+    // Drop manifolds that stopped touching. Pairs where both bodies sleep are
+    // skipped by the broad phase, so keep those to hold their island together.
+    for (auto it = m_manifolds.begin(); it != m_manifolds.end();) {
+        if (it->second.lastUpdateStep == m_stepCount) {
+            ++it;
+            continue;
+        }
 
-        ContactInfo contact;
-        if (TestCollision(*bodyA, *bodyB, contact)) {
-            for (const auto& cp : contact.points) {
-                ResolveContact(*bodyA, *bodyB, cp, dt);
-            }
+        const auto idA = static_cast<CollisionBody::BodyId>(it->first >> 32);
+        const auto idB = static_cast<CollisionBody::BodyId>(it->first & 0xFFFFFFFFu);
+        CollisionBody* bodyA = GetBody(idA);
+        CollisionBody* bodyB = GetBody(idB);
+
+        if (bodyA && bodyB && bodyA->IsSleeping() && bodyB->IsSleeping()) {
+            m_activeContacts.insert(CollisionPair{idA, idB});
+            ++it;
+        } else {
+            it = m_manifolds.erase(it);
         }
     }
 }
 
-void PhysicsWorld::IntegrateVelocities(float dt) {
-    for (auto& body : m_bodies) {
-        if (!body || !body->IsEnabled() || body->IsSleeping()) continue;
-        if (body->GetBodyType() == BodyType::Static) continue;
-
-        // Integrate position
-        body->SetPosition(body->GetPosition() + body->GetLinearVelocity() * dt);
-
-        // Integrate rotation
-        glm::vec3 angVel = body->GetAngularVelocity();
-        if (glm::length2(angVel) > kEpsilon) {
-            glm::quat spin = glm::quat(0.0f, angVel.x, angVel.y, angVel.z);
-            glm::quat rot = body->GetRotation();
-            rot = rot + (spin * rot) * (dt * 0.5f);
-            body->SetRotation(glm::normalize(rot));
-        }
+void PhysicsWorld::BuildIslands() {
+    const auto bodyCount = static_cast<uint32_t>(m_bodies.size());
 
-        body->MarkBoundsDirty();
+    m_unionFind.resize(bodyCount);
+    for (uint32_t i = 0; i < bodyCount; ++i) {
+        m_unionFind[i] = i;
+        if (m_bodies[i]) m_bodies[i]->m_solverIndex = i;
     }
-}
 
-void PhysicsWorld::UpdateSleepStates(float dt) {
-    for (auto& body : m_bodies) {
-        if (!body || !body->IsEnabled()) continue;
-        if (body->GetBodyType() != BodyType::Dynamic) continue;
+    auto isSimulated = [](const CollisionBody* body) {
+        return body->IsEnabled() && body->GetBodyType() == BodyType::Dynamic;
+    };
 
-        float linearSpeed2 = glm::length2(body->GetLinearVelocity());
-        float angularSpeed2 = glm::length2(body->GetAngularVelocity());
+    // Union dynamic bodies that touch; static and kinematic bodies don't link islands
+    for (auto& [key, manifold] : m_manifolds) {
+        if (!isSimulated(manifold.bodyA) || !isSimulated(manifold.bodyB)) continue;
 
-        float linearThreshold2 = m_config.linearSleepThreshold * m_config.linearSleepThreshold;
-        float angularThreshold2 = m_config.angularSleepThreshold * m_config.angularSleepThreshold;
+        uint32_t rootA = FindRoot(m_unionFind, manifold.bodyA->m_solverIndex);
+        uint32_t rootB = FindRoot(m_unionFind, manifold.bodyB->m_solverIndex);
+        if (rootA != rootB) {
+            m_unionFind[rootB] = rootA;
+        }
+    }
 
-        if (linearSpeed2 < linearThreshold2 && angularSpeed2 < angularThreshold2) {
-            body->m_sleepTimer += dt;
-            if (body->m_sleepTimer >= m_config.sleepTimeThreshold) {
-                body->SetSleeping(true);
-                body->SetLinearVelocity(glm::vec3(0.0f));
-                body->SetAngularVelocity(glm::vec3(0.0f));
-            }
-        } else {
-            body->m_sleepTimer = 0.0f;
+    // Number the islands and count their bodies
+    m_islands.clear();
+    m_bodyIsland.assign(bodyCount, kNoIsland);
+    for (uint32_t i = 0; i < bodyCount; ++i) {
+        const CollisionBody* body = m_bodies[i].get();
+        if (!body || !isSimulated(body)) continue;
+
+        uint32_t root = FindRoot(m_unionFind, i);
+        if (m_bodyIsland[root] == kNoIsland) {
+            m_bodyIsland[root] = static_cast<uint32_t>(m_islands.size());
+            m_islands.emplace_back();
         }
+        m_bodyIsland[i] = m_bodyIsland[root];
+        ++m_islands[m_bodyIsland[i]].bodyCount;
     }
-}
 
-void PhysicsWorld::RebuildSpatialHash() {
-    m_spatialHash.clear();
+    // Each manifold belongs to the island of its dynamic body
+    auto manifoldIsland = [&](const ContactManifold& manifold) {
+        if (!manifold.bodyA->IsEnabled() || !manifold.bodyB->IsEnabled()) return kNoIsland;
+        if (isSimulated(manifold.bodyA)) return m_bodyIsland[manifold.bodyA->m_solverIndex];
+        if (isSimulated(manifold.bodyB)) return m_bodyIsland[manifold.bodyB->m_solverIndex];
+        return kNoIsland;
+    };
+
+    for (auto& [key, manifold] : m_manifolds) {
+        uint32_t island = manifoldIsland(manifold);
+        if (island != kNoIsland) ++m_islands[island].manifoldCount;
+    }
 
-    for (auto& body : m_bodies) {
-        if (!body || !body->IsEnabled()) continue;
+    // Prefix sums, then scatter bodies and manifolds into contiguous ranges
+    uint32_t bodyOffset = 0;
+    uint32_t manifoldOffset = 0;
+    for (Island& island : m_islands) {
+        island.bodyBegin = bodyOffset;
+        island.manifoldBegin = manifoldOffset;
+        bodyOffset += island.bodyCount;
+        manifoldOffset += island.manifoldCount;
+        island.bodyCount = 0;
+        island.manifoldCount = 0;
+    }
 
-        AABB aabb = body->GetWorldAABB();
-        std::vector<glm::ivec3> cells;
-        GetCellsForAABB(aabb, cells);
+    m_islandBodies.resize(bodyOffset);
+    m_islandManifolds.resize(manifoldOffset);
 
-        for (const auto& cell : cells) {
-            size_t hash = HashCell(cell);
-            m_spatialHash[hash].bodies.push_back(body->GetId());
-        }
+    for (uint32_t i = 0; i < bodyCount; ++i) {
+        if (m_bodyIsland[i] == kNoIsland) continue;
+        Island& island = m_islands[m_bodyIsland[i]];
+        m_islandBodies[island.bodyBegin + island.bodyCount++] = m_bodies[i].get();
     }
-}
 
-void PhysicsWorld::GetCellsForAABB(const AABB& aabb, std::vector<glm::ivec3>& cells) const {
-    cells.clear();
+    for (auto& [key, manifold] : m_manifolds) {
+        uint32_t islandIndex = manifoldIsland(manifold);
+        if (islandIndex == kNoIsland) continue;
+        Island& island = m_islands[islandIndex];
+        m_islandManifolds[island.manifoldBegin + island.manifoldCount++] = &manifold;
+    }
 
-    glm::ivec3 minCell = GetCellCoord(aabb.min);
-    glm::ivec3 maxCell = GetCellCoord(aabb.max);
+    // An island is awake if any body is, or a moving kinematic body pushes it;
+    // waking propagates to every body in the island
+    m_stats.islandCount = m_islands.size();
+    m_stats.awakeIslandCount = 0;
 
-    for (int x = minCell.x; x <= maxCell.x; ++x) {
-        for (int y = minCell.y; y <= maxCell.y; ++y) {
-            for (int z = minCell.z; z <= maxCell.z; ++z) {
-                cells.emplace_back(x, y, z);
+    for (Island& island : m_islands) {
+        island.awake = false;
+        for (uint32_t i = 0; i < island.bodyCount && !island.awake; ++i) {
+            island.awake = !m_islandBodies[island.bodyBegin + i]->IsSleeping();
+        }
+        for (uint32_t i = 0; i < island.manifoldCount && !island.awake; ++i) {
+            const ContactManifold* manifold = m_islandManifolds[island.manifoldBegin + i];
+            for (const CollisionBody* body : {manifold->bodyA, manifold->bodyB}) {
+                if (body->IsKinematic() &&
+                    (glm::length2(body->GetLinearVelocity()) > kEpsilon ||
+                     glm::length2(body->GetAngularVelocity()) > kEpsilon)) {
+                    island.awake = true;
+                }
+            }
+        }
+
+        if (!island.awake) continue;
+        ++m_stats.awakeIslandCount;
+
+        for (uint32_t i = 0; i < island.bodyCount; ++i) {
+            CollisionBody* body = m_islandBodies[island.bodyBegin + i];
+            if (body->IsSleeping()) {
+                body->WakeUp();
             }
         }
     }
 }
 
-glm::ivec3 PhysicsWorld::GetCellCoord(const glm::vec3& pos) const {
-    return glm::ivec3(
-        static_cast<int>(std::floor(pos.x / m_config.cellSize)),
-        static_cast<int>(std::floor(pos.y / m_config.cellSize)),
-        static_cast<int>(std::floor(pos.z / m_config.cellSize))
-    );
+void PhysicsWorld::SolveIslands(float dt) {
+    ContactSolverSettings settings;
+    settings.dt = dt;
+    settings.velocityIterations = m_config.velocityIterations;
+    settings.baumgarte = m_config.baumgarte;
+    settings.allowedPenetration = m_config.allowedPenetration;
+    settings.restitutionThreshold = m_config.restitutionThreshold;
+    settings.warmStarting = m_config.warmStarting;
+    const ContactSolver solver(settings);
+
+    m_solveOrder.clear();
+    size_t totalContacts = 0;
+    for (uint32_t i = 0; i < m_islands.size(); ++i) {
+        if (m_islands[i].awake && m_islands[i].manifoldCount > 0) {
+            m_solveOrder.push_back(i);
+            totalContacts += m_islands[i].manifoldCount;
+        }
+    }
+
+    auto solveIsland = [this, &solver](size_t orderIndex) {
+        const Island& island = m_islands[m_solveOrder[orderIndex]];
+        solver.Solve(&m_islandManifolds[island.manifoldBegin], island.manifoldCount);
+    };
+
+    auto& jobSystem = JobSystem::Instance();
+    if (m_config.parallelIslands && jobSystem.IsInitialized() &&
+        m_solveOrder.size() > 1 && totalContacts >= kMinParallelSolveContacts) {
+        // Largest islands first so a collapsing structure doesn't finish last
+        std::sort(m_solveOrder.begin(), m_solveOrder.end(), [this](uint32_t a, uint32_t b) {
+            return m_islands[a].manifoldCount > m_islands[b].manifoldCount;
+        });
+
+        const size_t jobs = static_cast<size_t>(jobSystem.GetWorkerCount() + 1) * 4;
+        const size_t batchSize = std::max<size_t>(1, m_solveOrder.size() / jobs);
+        jobSystem.ParallelFor(0, m_solveOrder.size(), batchSize, solveIsland);
+    } else {
+        for (size_t i = 0; i < m_solveOrder.size(); ++i) {
+            solveIsland(i);
+        }
+    }
 }
 
-size_t PhysicsWorld::HashCell(const glm::ivec3& cell) const {
-    // Simple hash combining
-    size_t h = 0;
-    h ^= std::hash<int>{}(cell.x) + 0x9e3779b9 + (h << 6) + (h >> 2);
-    h ^= std::hash<int>{}(cell.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
-    h ^= std::hash<int>{}(cell.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
-    return h;
+void PhysicsWorld::IntegrateVelocities(float dt) {
+    // Positions and rotations of awake non-static bodies; moved slots are
+    // flagged for AABB and broad-phase refits
+    m_bodyStore.IntegratePositions(dt);
 }
 
+void PhysicsWorld::UpdateSleepStates(float dt) {
+    // Every awake dynamic body is in an island, so advance all timers in one pass
+    m_bodyStore.UpdateSleepTimers(m_config.linearSleepThreshold, m_config.angularSleepThreshold, dt);
+
+    // Islands sleep as a unit once every body has been slow for long enough;
+    // putting one body of a stack to sleep would leave the rest pushing on it
+    for (const Island& island : m_islands) {
+        if (!island.awake) continue;
+
+        float minSleepTime = std::numeric_limits<float>::max();
+        for (uint32_t i = 0; i < island.bodyCount; ++i) {
+            const CollisionBody* body = m_islandBodies[island.bodyBegin + i];
+            minSleepTime = std::min(minSleepTime, m_bodyStore.GetSleepTimer(body->m_storeSlot));
+        }
+
+        if (minSleepTime < m_config.sleepTimeThreshold) continue;
+
+        for (uint32_t i = 0; i < island.bodyCount; ++i) {
+            CollisionBody* body = m_islandBodies[island.bodyBegin + i];
+            body->SetSleeping(true);
+            m_bodyStore.SetLinearVelocity(body->m_storeSlot, glm::vec3(0.0f));
+            m_bodyStore.SetAngularVelocity(body->m_storeSlot, glm::vec3(0.0f));
+        }
+    }
+}
 bool PhysicsWorld::TestCollision(CollisionBody& bodyA, CollisionBody& bodyB, ContactInfo& contact) const {
     contact.bodyA = &bodyA;
     contact.bodyB = &bodyB;
@@ -610,13 +705,14 @@ bool PhysicsWorld::TestSphereBox(
         return false;
     }
 
+    // Normal points from the sphere toward the box (A to B, as for the other tests)
     float dist = std::sqrt(dist2);
     if (dist < kEpsilon) {
         // Sphere center inside box
-        contact.normal = glm::vec3(0, 1, 0);
+        contact.normal = glm::vec3(0, -1, 0);
         contact.penetration = sphereRadius;
     } else {
-        contact.normal = delta / dist;
+        contact.normal = -delta / dist;
         contact.penetration = sphereRadius - dist;
     }
 
@@ -632,25 +728,74 @@ bool PhysicsWorld::TestBoxBox(
         return false;
     }
 
-    // Generate contact point at overlap center
-    ContactPoint cp;
-    cp.position = (boxA.center + boxB.center) * 0.5f;
-    cp.normal = glm::normalize(boxB.center - boxA.center);
-    if (glm::length2(cp.normal) < kEpsilon) {
-        cp.normal = glm::vec3(0, 1, 0);
+    const glm::vec3 axesA[3] = {boxA.GetAxis(0), boxA.GetAxis(1), boxA.GetAxis(2)};
+    const glm::vec3 axesB[3] = {boxB.GetAxis(0), boxB.GetAxis(1), boxB.GetAxis(2)};
+    const glm::vec3 delta = boxB.center - boxA.center;
+
+    auto projectedRadius = [](const glm::vec3 (&axes)[3], const glm::vec3& halfExtents, const glm::vec3& axis) {
+        return std::abs(glm::dot(axes[0], axis)) * halfExtents.x +
+               std::abs(glm::dot(axes[1], axis)) * halfExtents.y +
+               std::abs(glm::dot(axes[2], axis)) * halfExtents.z;
+    };
+
+    // Face axis of least penetration gives the normal (edge axes only matter
+    // for the separation test above)
+    glm::vec3 normal(0.0f, 1.0f, 0.0f);
+    float penetration = std::numeric_limits<float>::max();
+    for (int i = 0; i < 6; ++i) {
+        const glm::vec3& axis = i < 3 ? axesA[i] : axesB[i - 3];
+        const float distance = glm::dot(delta, axis);
+        const float overlap = projectedRadius(axesA, boxA.halfExtents, axis) +
+                              projectedRadius(axesB, boxB.halfExtents, axis) - std::abs(distance);
+
+        // Slight preference for A's faces keeps the reference face stable
+        if (overlap < penetration * (i < 3 ? 1.0f : 0.95f)) {
+            penetration = overlap;
+            normal = distance < 0.0f ? -axis : axis;
+        }
     }
 
-    // Estimate penetration from overlap
-    AABB aabbA = boxA.GetAABB();
-    AABB aabbB = boxB.GetAABB();
-    glm::vec3 overlap(
-        std::min(aabbA.max.x, aabbB.max.x) - std::max(aabbA.min.x, aabbB.min.x),
-        std::min(aabbA.max.y, aabbB.max.y) - std::max(aabbA.min.y, aabbB.min.y),
-        std::min(aabbA.max.z, aabbB.max.z) - std::max(aabbA.min.z, aabbB.min.z)
-    );
-    cp.penetration = std::min({overlap.x, overlap.y, overlap.z});
+    // Corners of one box inside the other (with slop) become the manifold
+    const float supportA = glm::dot(boxA.center, normal) + projectedRadius(axesA, boxA.halfExtents, normal);
+    const float supportB = glm::dot(boxB.center, normal) - projectedRadius(axesB, boxB.halfExtents, normal);
+    constexpr float kCornerSlop = 0.02f;
+
+    auto insideWithSlop = [](const OBB& box, const glm::vec3& point) {
+        OBB expanded = box;
+        expanded.halfExtents += glm::vec3(kCornerSlop);
+        return expanded.Contains(point);
+    };
+
+    const size_t firstContact = contacts.size();
+    for (const glm::vec3& corner : boxB.GetCorners()) {
+        if (!insideWithSlop(boxA, corner)) continue;
+        ContactPoint cp;
+        cp.position = corner;
+        cp.normal = normal;
+        cp.penetration = std::max(supportA - glm::dot(corner, normal), 0.0f);
+        contacts.push_back(cp);
+    }
+
+    if (contacts.size() == firstContact) {
+        for (const glm::vec3& corner : boxA.GetCorners()) {
+            if (!insideWithSlop(boxB, corner)) continue;
+            ContactPoint cp;
+            cp.position = corner;
+            cp.normal = normal;
+            cp.penetration = std::max(glm::dot(corner, normal) - supportB, 0.0f);
+            contacts.push_back(cp);
+        }
+    }
+
+    if (contacts.size() == firstContact) {
+        // Edge-edge: no corner is inside, use the midpoint of the closest features
+        ContactPoint cp;
+        cp.position = (boxA.ClosestPoint(boxB.center) + boxB.ClosestPoint(boxA.center)) * 0.5f;
+        cp.normal = normal;
+        cp.penetration = penetration;
+        contacts.push_back(cp);
+    }
 
-    contacts.push_back(cp);
     return true;
 }
 
@@ -697,129 +842,29 @@ bool PhysicsWorld::TestSphereCapsule(
         return false;
     }
 
+    // Normal points from the sphere toward the capsule (A to B)
     float dist = std::sqrt(dist2);
     if (dist < kEpsilon) {
-        contact.normal = glm::vec3(0, 1, 0);
+        contact.normal = glm::vec3(0, -1, 0);
         contact.penetration = radiusSum;
     } else {
-        contact.normal = delta / dist;
+        contact.normal = -delta / dist;
         contact.penetration = radiusSum - dist;
     }
 
-    contact.position = closest + contact.normal * capsuleRadius;
+    contact.position = closest - contact.normal * capsuleRadius;
     return true;
 }
 
-void PhysicsWorld::ResolveContact(CollisionBody& bodyA, CollisionBody& bodyB,
-                                   const ContactPoint& contact, float dt)
-{
-    // Skip if both are non-dynamic
-    if (bodyA.GetBodyType() != BodyType::Dynamic &&
-        bodyB.GetBodyType() != BodyType::Dynamic) {
-        return;
-    }
-
-    // Get inverse masses
-    float invMassA = bodyA.GetInverseMass();
-    float invMassB = bodyB.GetInverseMass();
-    float invMassSum = invMassA + invMassB;
-
-    if (invMassSum < kEpsilon) return;
-
-    // Calculate relative velocity at contact point
-    glm::vec3 rA = contact.position - bodyA.GetPosition();
-    glm::vec3 rB = contact.position - bodyB.GetPosition();
-
-    glm::vec3 velA = bodyA.GetLinearVelocity() + glm::cross(bodyA.GetAngularVelocity(), rA);
-    glm::vec3 velB = bodyB.GetLinearVelocity() + glm::cross(bodyB.GetAngularVelocity(), rB);
-    glm::vec3 relVel = velB - velA;
-
-    float velAlongNormal = glm::dot(relVel, contact.normal);
-
-    // Don't resolve if separating
-    if (velAlongNormal > 0) return;
-
-    // Get combined restitution
-    float restitution = 0.0f;
-    if (bodyA.GetShapeCount() > 0 && bodyB.GetShapeCount() > 0) {
-        restitution = std::min(
-            bodyA.GetShape(0).GetMaterial().restitution,
-            bodyB.GetShape(0).GetMaterial().restitution
-        );
-    }
-
-    // Calculate impulse scalar
-    float j = -(1.0f + restitution) * velAlongNormal;
-
-    // Include rotational effect
-    glm::vec3 crossA = glm::cross(rA, contact.normal);
-    glm::vec3 crossB = glm::cross(rB, contact.normal);
-
-    float angularEffectA = glm::dot(crossA, bodyA.GetInverseInertiaTensor() * crossA);
-    float angularEffectB = glm::dot(crossB, bodyB.GetInverseInertiaTensor() * crossB);
-
-    j /= invMassSum + angularEffectA + angularEffectB;
-
-    // Apply impulse
-    glm::vec3 impulse = j * contact.normal;
-
-    if (bodyA.GetBodyType() == BodyType::Dynamic) {
-        bodyA.ApplyImpulseAtPoint(-impulse, contact.position);
-    }
-    if (bodyB.GetBodyType() == BodyType::Dynamic) {
-        bodyB.ApplyImpulseAtPoint(impulse, contact.position);
-    }
-
-    // Position correction (Baumgarte stabilization)
-    float slop = m_config.allowedPenetration;
-    float correction = std::max(contact.penetration - slop, 0.0f) * m_config.baumgarte;
-    glm::vec3 correctionVec = correction / invMassSum * contact.normal;
-
-    if (bodyA.GetBodyType() == BodyType::Dynamic) {
-        bodyA.SetPosition(bodyA.GetPosition() - correctionVec * invMassA);
-    }
-    if (bodyB.GetBodyType() == BodyType::Dynamic) {
-        bodyB.SetPosition(bodyB.GetPosition() + correctionVec * invMassB);
-    }
-
-    // Friction impulse
-    glm::vec3 tangent = relVel - velAlongNormal * contact.normal;
-    if (glm::length2(tangent) > kEpsilon) {
-        tangent = glm::normalize(tangent);
-
-        float friction = 0.5f;
-        if (bodyA.GetShapeCount() > 0 && bodyB.GetShapeCount() > 0) {
-            friction = std::sqrt(
-                bodyA.GetShape(0).GetMaterial().friction *
-                bodyB.GetShape(0).GetMaterial().friction
-            );
-        }
-
-        float jt = -glm::dot(relVel, tangent);
-        jt /= invMassSum;
-
-        // Coulomb friction
-        glm::vec3 frictionImpulse;
-        if (std::abs(jt) < j * friction) {
-            frictionImpulse = jt * tangent;
-        } else {
-            frictionImpulse = -j * friction * tangent;
-        }
-
-        if (bodyA.GetBodyType() == BodyType::Dynamic) {
-            bodyA.ApplyImpulse(-frictionImpulse * invMassA);
-        }
-        if (bodyB.GetBodyType() == BodyType::Dynamic) {
-            bodyB.ApplyImpulse(frictionImpulse * invMassB);
-        }
-    }
-}
-
 CollisionBody* PhysicsWorld::AddBody(std::unique_ptr<CollisionBody> body) {
     if (!body) return nullptr;
 
     CollisionBody* ptr = body.get();
     m_bodyMap[ptr->GetId()] = ptr;
+
+    const PhysicsBodyStore::Slot slot = m_bodyStore.Attach(*ptr);
+    ptr->m_broadPhaseProxy = m_broadPhase.CreateProxy(ptr->GetWorldAABB(), ptr->GetId());
+    m_bodyStore.ClearFlags(slot, PhysicsBodyStore::FlagBroadPhaseDirty);
     m_bodies.push_back(std::move(body));
     return ptr;
 }
@@ -835,7 +880,13 @@ void PhysicsWorld::RemoveBody(CollisionBody* body) {
 }
 
 void PhysicsWorld::RemoveBody(CollisionBody::BodyId id) {
-    m_bodyMap.erase(id);
+    auto it = m_bodyMap.find(id);
+    if (it != m_bodyMap.end()) {
+        m_broadPhase.DestroyProxy(it->second->m_broadPhaseProxy);
+        it->second->m_broadPhaseProxy = SweepAndPruneBroadPhase::INVALID_PROXY;
+        m_bodyStore.Detach(*it->second);
+        m_bodyMap.erase(it);
+    }
     m_bodies.erase(
         std::remove_if(m_bodies.begin(), m_bodies.end(),
             [id](const std::unique_ptr<CollisionBody>& b) {
@@ -856,9 +907,14 @@ const CollisionBody* PhysicsWorld::GetBody(CollisionBody::BodyId id) const {
 }
 
 void PhysicsWorld::Clear() {
+    m_bodyStore.Clear();
     m_bodies.clear();
     m_bodyMap.clear();
-    m_spatialHash.clear();
+    m_broadPhase.Clear();
+    m_manifolds.clear();
+    m_islands.clear();
+    m_islandBodies.clear();
+    m_islandManifolds.clear();
     m_activeContacts.clear();
     m_previousContacts.clear();
     m_broadPhasePairs.clear();
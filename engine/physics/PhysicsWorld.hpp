@@ -1,8 +1,11 @@
 #pragma once
 
+#include "BodyStore.hpp"
+#include "BroadPhase.hpp"
 #include "CollisionBody.hpp"
 #include "CollisionShape.hpp"
 #include "CollisionEvents.hpp"
+#include "ContactSolver.hpp"
 #include <glm/glm.hpp>
 #include <memory>
 #include <vector>
@@ -60,8 +63,8 @@ struct PhysicsWorldConfig {
     int velocityIterations = 8;
     int positionIterations = 3;
 
-    // Spatial hash configuration
-    float cellSize = 10.0f;
+    // Broad phase: bodies moving less than this are not re-sorted
+    float broadPhaseMargin = 0.1f;
 
     // Sleep thresholds
     float linearSleepThreshold = 0.1f;
@@ -72,34 +75,11 @@ struct PhysicsWorldConfig {
     float contactBreakingThreshold = 0.02f;
     float allowedPenetration = 0.01f;
     float baumgarte = 0.2f;  ///< Position correction factor
-};
-
-/**
- * @brief Spatial hash cell for broad-phase collision detection
- */
-struct SpatialHashCell {
-    std::vector<CollisionBody::BodyId> bodies;
-};
-
-/**
- * @brief Collision pair for tracking contacts between bodies
- */
-struct CollisionPair {
-    CollisionBody::BodyId bodyA;
-    CollisionBody::BodyId bodyB;
+    float restitutionThreshold = 1.0f;  ///< Closing speed (m/s) below which contacts don't bounce
 
-    bool operator==(const CollisionPair& other) const {
-        return (bodyA == other.bodyA && bodyB == other.bodyB) ||
-               (bodyA == other.bodyB && bodyB == other.bodyA);
-    }
-};
-
-struct CollisionPairHash {
-    size_t operator()(const CollisionPair& pair) const {
-        auto minId = std::min(pair.bodyA, pair.bodyB);
-        auto maxId = std::max(pair.bodyA, pair.bodyB);
-        return std::hash<uint64_t>{}(static_cast<uint64_t>(minId) << 32 | maxId);
-    }
+    // Contact solver
+    bool warmStarting = true;     ///< Seed the solver with last step's cached impulses
+    bool parallelIslands = true;  ///< Solve independent islands on the JobSystem
 };
 
 /**
@@ -147,7 +127,10 @@ public:
     // =========================================================================
 
     [[nodiscard]] const PhysicsWorldConfig& GetConfig() const noexcept { return m_config; }
-    void SetConfig(const PhysicsWorldConfig& config) { m_config = config; }
+    void SetConfig(const PhysicsWorldConfig& config) {
+        m_config = config;
+        m_broadPhase.SetMargin(config.broadPhaseMargin);
+    }
 
     [[nodiscard]] const glm::vec3& GetGravity() const noexcept { return m_config.gravity; }
     void SetGravity(const glm::vec3& gravity) { m_config.gravity = gravity; }
@@ -376,8 +359,12 @@ public:
         size_t bodyCount = 0;
         size_t activeBodyCount = 0;
         size_t broadPhasePairs = 0;
+        size_t broadPhasePairsAdded = 0;    ///< Fat-bounds pairs created this step
+        size_t broadPhasePairsRemoved = 0;  ///< Fat-bounds pairs destroyed this step
         size_t narrowPhaseTests = 0;
         size_t contactCount = 0;
+        size_t islandCount = 0;       ///< Dynamic body islands (connected by contacts)
+        size_t awakeIslandCount = 0;  ///< Islands simulated this step
         size_t collisionEvents = 0;  ///< Number of collision events dispatched
         size_t triggerEvents = 0;    ///< Number of trigger events dispatched
         float stepTime = 0.0f;
@@ -385,21 +372,26 @@ public:
 
     [[nodiscard]] const Stats& GetStats() const { return m_stats; }
 
+    /**
+     * @brief Persistent broad phase (pairs and last-step deltas)
+     */
+    [[nodiscard]] const SweepAndPruneBroadPhase& GetBroadPhase() const noexcept { return m_broadPhase; }
+
+    /**
+     * @brief SoA storage holding the kinematic state of every body in the world
+     */
+    [[nodiscard]] const PhysicsBodyStore& GetBodyStore() const noexcept { return m_bodyStore; }
+
 private:
     // Simulation steps
     void IntegrateForces(float dt);
     void BroadPhase();
     void NarrowPhase();
-    void ResolveCollisions(float dt);
+    void BuildIslands();
+    void SolveIslands(float dt);
     void IntegrateVelocities(float dt);
     void UpdateSleepStates(float dt);
 
-    // Spatial hash operations
-    void RebuildSpatialHash();
-    void GetCellsForAABB(const AABB& aabb, std::vector<glm::ivec3>& cells) const;
-    [[nodiscard]] glm::ivec3 GetCellCoord(const glm::vec3& pos) const;
-    [[nodiscard]] size_t HashCell(const glm::ivec3& cell) const;
-
     // Collision detection
     bool TestCollision(CollisionBody& bodyA, CollisionBody& bodyB, ContactInfo& contact) const;
     bool TestShapeCollision(
@@ -432,10 +424,6 @@ private:
         const glm::vec3& capsuleStart, const glm::vec3& capsuleEnd, float capsuleRadius,
         ContactPoint& contact) const;
 
-    // Collision resolution
-    void ResolveContact(CollisionBody& bodyA, CollisionBody& bodyB,
-                        const ContactPoint& contact, float dt);
-
     // Event dispatch helpers
     void DispatchCollisionEvents();
     std::vector<CollisionContact> ConvertContactPoints(const std::vector<ContactPoint>& points) const;
@@ -454,16 +442,40 @@ private:
     // Configuration
     PhysicsWorldConfig m_config;
 
-    // Bodies
+    // Bodies; kinematic state lives in m_bodyStore (declared first so it outlives them)
+    PhysicsBodyStore m_bodyStore;
     std::vector<std::unique_ptr<CollisionBody>> m_bodies;
     std::unordered_map<CollisionBody::BodyId, CollisionBody*> m_bodyMap;
 
-    // Spatial hash for broad phase
-    std::unordered_map<size_t, SpatialHashCell> m_spatialHash;
+    // Persistent broad phase; each body holds its proxy handle
+    SweepAndPruneBroadPhase m_broadPhase;
 
     // Collision pairs from broad phase
     std::vector<CollisionPair> m_broadPhasePairs;
 
+    // Cached manifolds for warm starting, keyed by MakeContactKey
+    std::unordered_map<uint64_t, ContactManifold> m_manifolds;
+    uint64_t m_stepCount = 0;
+
+    /**
+     * @brief Dynamic bodies connected through contacts; solved and put to sleep together
+     */
+    struct Island {
+        uint32_t bodyBegin = 0;
+        uint32_t bodyCount = 0;
+        uint32_t manifoldBegin = 0;
+        uint32_t manifoldCount = 0;
+        bool awake = false;
+    };
+
+    // Rebuilt every step (members to keep their capacity)
+    std::vector<Island> m_islands;
+    std::vector<CollisionBody*> m_islandBodies;
+    std::vector<ContactManifold*> m_islandManifolds;
+    std::vector<uint32_t> m_unionFind;
+    std::vector<uint32_t> m_bodyIsland;
+    std::vector<uint32_t> m_solveOrder;
+
     // Active contacts
     std::unordered_set<CollisionPair, CollisionPairHash> m_activeContacts;
     std::unordered_set<CollisionPair, CollisionPairHash> m_previousContacts;
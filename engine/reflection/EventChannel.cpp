@@ -0,0 +1,89 @@
+#include "EventChannel.hpp"
+
+namespace Nova {
+namespace Reflect {
+
+// ============================================================================
+// Channel Registry
+// ============================================================================
+
+namespace {
+
+struct ChannelRegistry {
+    std::mutex mutex;
+    std::vector<EventChannelBase*> channels;
+
+    std::mutex dispatchMutex;
+    std::vector<EventChannelBase*> dispatching;  // Snapshot reused every frame; guarded by mutex
+};
+
+ChannelRegistry& GetRegistry() {
+    static ChannelRegistry registry;
+    return registry;
+}
+
+// Set while this thread is inside DispatchAll, which a handler must not re-enter
+thread_local bool t_dispatchingAll = false;
+
+struct DispatchAllScope {
+    DispatchAllScope() { t_dispatchingAll = true; }
+    ~DispatchAllScope() { t_dispatchingAll = false; }
+};
+
+} // namespace
+
+void EventChannels::Register(EventChannelBase* channel) {
+    ChannelRegistry& registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    if (std::find(registry.channels.begin(), registry.channels.end(), channel) == registry.channels.end()) {
+        registry.channels.push_back(channel);
+    }
+    channel->m_registered = true;
+}
+
+void EventChannels::Unregister(EventChannelBase* channel) {
+    ChannelRegistry& registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto& channels = registry.channels;
+    channels.erase(std::remove(channels.begin(), channels.end(), channel), channels.end());
+    channel->m_registered = false;
+
+    // A handler may destroy a channel DispatchAll has yet to reach
+    std::replace(registry.dispatching.begin(), registry.dispatching.end(), channel,
+                 static_cast<EventChannelBase*>(nullptr));
+}
+
+size_t EventChannels::DispatchAll() {
+    assert(!t_dispatchingAll && "EventChannels::DispatchAll called from a handler");
+    if (t_dispatchingAll) {
+        return 0;
+    }
+    ChannelRegistry& registry = GetRegistry();
+
+    // Handlers may touch channels that register on first use, so dispatch outside the lock
+    std::lock_guard dispatchLock(registry.dispatchMutex);
+    DispatchAllScope dispatching;
+    {
+        std::lock_guard lock(registry.mutex);
+        registry.dispatching.assign(registry.channels.begin(), registry.channels.end());
+    }
+
+    size_t dispatched = 0;
+    for (size_t i = 0;; ++i) {
+        EventChannelBase* channel = nullptr;
+        {
+            std::lock_guard lock(registry.mutex);
+            if (i >= registry.dispatching.size()) {
+                break;
+            }
+            channel = registry.dispatching[i];
+        }
+        if (channel) {
+            dispatched += channel->Dispatch();
+        }
+    }
+    return dispatched;
+}
+
+} // namespace Reflect
+} // namespace Nova
@@ -0,0 +1,407 @@
+#pragma once
+
+#include "EventBus.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+namespace Reflect {
+
+/**
+ * @brief Type-erased view of a channel so the engine can flush them all per frame
+ */
+class EventChannelBase {
+public:
+    virtual ~EventChannelBase() = default;
+
+    /**
+     * @brief Hand everything published since the last dispatch to subscribers
+     *
+     * Must not be called from one of the channel's own handlers: that asserts
+     * in debug builds and dispatches nothing otherwise.
+     * @return Number of events dispatched
+     */
+    virtual size_t Dispatch() = 0;
+
+    /**
+     * @brief Events published but not yet dispatched
+     */
+    [[nodiscard]] virtual size_t GetPendingCount() const = 0;
+
+protected:
+    // Identifies the channel in per-thread caches; unlike the address it is never reused
+    const uint64_t m_serial = s_nextSerial.fetch_add(1, std::memory_order_relaxed);
+
+    // Set by EventChannels::Register, so the destructor knows to unregister
+    bool m_registered = false;
+
+private:
+    friend class EventChannels;
+
+    static inline std::atomic<uint64_t> s_nextSerial{1};
+};
+
+/**
+ * @brief Channels the engine dispatches at the end of each frame's update
+ *
+ * EventChannel<T>::Instance() registers itself; locally owned channels may
+ * be registered too, or dispatched by their owner. A registered channel
+ * unregisters itself when destroyed, also from inside a DispatchAll handler.
+ */
+class EventChannels {
+public:
+    static void Register(EventChannelBase* channel);
+    static void Unregister(EventChannelBase* channel);
+
+    /**
+     * @brief Dispatch every registered channel
+     *
+     * Must not be called from a handler; like a re-entrant Dispatch() it
+     * asserts in debug builds and dispatches nothing otherwise.
+     * @return Total number of events dispatched
+     */
+    static size_t DispatchAll();
+};
+
+/**
+ * @brief Compile-time typed, batched event stream
+ *
+ * The high-frequency counterpart to EventBus. Payloads are plain structs
+ * instead of string-keyed std::any maps, and nothing is timestamped or
+ * looked up by name. Publish appends to a buffer owned by the calling
+ * thread, so producers on different threads never contend. Dispatch, called
+ * once per frame, swaps each thread's buffer for its empty twin and hands
+ * the whole frame's events to every subscriber as one span. Both buffers keep
+ * their capacity, so a channel stops allocating once it has seen its peak
+ * frame. Thread buffers live as long as the channel, which suits the main
+ * thread and JobSystem workers rather than short-lived threads.
+ *
+ * Ordering: events from one thread keep their publish order; batches from
+ * different threads are concatenated in the order the threads first
+ * published. Events published by handlers during Dispatch arrive in the next
+ * dispatch; handlers must not call Dispatch themselves.
+ *
+ * Usage:
+ * @code
+ * struct DamageEvent { uint32_t target; uint32_t source; float amount; };
+ *
+ * auto& damage = EventChannel<DamageEvent>::Instance();
+ * damage.Subscribe([](std::span<const DamageEvent> events) {
+ *     for (const DamageEvent& e : events) { ... }
+ * });
+ *
+ * damage.Publish({targetId, attackerId, 12.5f});  // any thread
+ * @endcode
+ */
+template<typename T>
+class EventChannel final : public EventChannelBase {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "EventChannel payloads must be plain data");
+
+public:
+    using Handler = std::function<void(std::span<const T>)>;
+
+    struct Stats {
+        uint64_t dispatchedEvents = 0;
+        uint64_t dispatches = 0;
+        size_t largestBatch = 0;
+        size_t threadBuffers = 0;
+    };
+
+    EventChannel() = default;
+
+    ~EventChannel() override {
+        if (m_registered) {
+            EventChannels::Unregister(this);
+        }
+    }
+
+    EventChannel(const EventChannel&) = delete;
+    EventChannel& operator=(const EventChannel&) = delete;
+
+    /**
+     * @brief Process-wide channel for T, dispatched by the engine every frame
+     */
+    static EventChannel& Instance() {
+        static EventChannel channel(RegisterTag{});
+        return channel;
+    }
+
+    // =========================================================================
+    // Publishing
+    // =========================================================================
+
+    /**
+     * @brief Queue an event for the next dispatch; safe from any thread
+     */
+    void Publish(const T& event) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        buffer.Lock();
+        buffer.pending.push_back(event);
+        buffer.Unlock();
+    }
+
+    /**
+     * @brief Queue a batch of events for the next dispatch
+     */
+    void PublishBatch(std::span<const T> events) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        buffer.Lock();
+        buffer.pending.insert(buffer.pending.end(), events.begin(), events.end());
+        buffer.Unlock();
+    }
+
+    // =========================================================================
+    // Subscription
+    // =========================================================================
+
+    /**
+     * @brief Subscribe to batches; higher priorities run first
+     * @return Subscription ID
+     */
+    size_t Subscribe(Handler handler, EventPriority priority = EventPriority::Normal) {
+        std::lock_guard lock(m_subscriberMutex);
+        auto subscribers = std::make_shared<std::vector<Subscriber>>(*m_subscribers);
+        const size_t id = m_nextSubscriptionId++;
+        subscribers->push_back({id, priority, std::move(handler)});
+        std::stable_sort(subscribers->begin(), subscribers->end(), [](const Subscriber& a, const Subscriber& b) {
+            return static_cast<int>(a.priority) > static_cast<int>(b.priority);
+        });
+        m_subscribers = std::move(subscribers);
+        return id;
+    }
+
+    bool Unsubscribe(size_t subscriptionId) {
+        std::lock_guard lock(m_subscriberMutex);
+        auto subscribers = std::make_shared<std::vector<Subscriber>>(*m_subscribers);
+        auto it = std::find_if(subscribers->begin(), subscribers->end(),
+                               [subscriptionId](const Subscriber& s) { return s.id == subscriptionId; });
+        if (it == subscribers->end()) {
+            return false;
+        }
+        subscribers->erase(it);
+        m_subscribers = std::move(subscribers);
+        return true;
+    }
+
+    [[nodiscard]] size_t GetSubscriberCount() const {
+        std::lock_guard lock(m_subscriberMutex);
+        return m_subscribers->size();
+    }
+
+    // =========================================================================
+    // Dispatch
+    // =========================================================================
+
+    size_t Dispatch() override {
+        // A handler dispatching its own channel would deadlock on m_dispatchMutex
+        const std::thread::id self = std::this_thread::get_id();
+        const bool reentrant = m_dispatchingThread.load(std::memory_order_relaxed) == self;
+        assert(!reentrant && "EventChannel::Dispatch called from one of its handlers");
+        if (reentrant) {
+            return 0;
+        }
+
+        std::lock_guard dispatchLock(m_dispatchMutex);
+        DispatchingScope dispatching(m_dispatchingThread, self);
+
+        // Frame boundary: take every thread's pending buffer, leaving its empty twin behind
+        std::vector<ThreadBuffer*>& draining = m_draining;  // Scratch reused every frame
+        draining.clear();
+        {
+            std::lock_guard lock(m_bufferMutex);
+            for (auto& buffer : m_buffers) {
+                buffer->Lock();
+                buffer->pending.swap(buffer->draining);
+                buffer->Unlock();
+                if (!buffer->draining.empty()) {
+                    draining.push_back(buffer.get());
+                }
+            }
+        }
+
+        if (draining.empty()) {
+            return 0;
+        }
+
+        // A single producer's buffer is dispatched in place; several are joined first
+        std::span<const T> batch;
+        if (draining.size() == 1) {
+            batch = draining.front()->draining;
+        } else {
+            m_joined.clear();
+            for (ThreadBuffer* buffer : draining) {
+                m_joined.insert(m_joined.end(), buffer->draining.begin(), buffer->draining.end());
+            }
+            batch = m_joined;
+        }
+
+        std::shared_ptr<const std::vector<Subscriber>> subscribers;
+        {
+            std::lock_guard lock(m_subscriberMutex);
+            subscribers = m_subscribers;
+        }
+        for (const Subscriber& subscriber : *subscribers) {
+            subscriber.handler(batch);
+        }
+
+        const size_t count = batch.size();
+        for (ThreadBuffer* buffer : draining) {
+            buffer->draining.clear();
+        }
+
+        m_dispatchedEvents.fetch_add(count, std::memory_order_relaxed);
+        m_dispatches.fetch_add(1, std::memory_order_relaxed);
+        if (count > m_largestBatch.load(std::memory_order_relaxed)) {
+            m_largestBatch.store(count, std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    [[nodiscard]] size_t GetPendingCount() const override {
+        std::lock_guard lock(m_bufferMutex);
+        size_t count = 0;
+        for (const auto& buffer : m_buffers) {
+            buffer->Lock();
+            count += buffer->pending.size();
+            buffer->Unlock();
+        }
+        return count;
+    }
+
+    /**
+     * @brief Drop all pending events without dispatching them
+     */
+    void ClearPending() {
+        std::lock_guard lock(m_bufferMutex);
+        for (auto& buffer : m_buffers) {
+            buffer->Lock();
+            buffer->pending.clear();
+            buffer->Unlock();
+        }
+    }
+
+    [[nodiscard]] Stats GetStats() const {
+        Stats stats;
+        stats.dispatchedEvents = m_dispatchedEvents.load(std::memory_order_relaxed);
+        stats.dispatches = m_dispatches.load(std::memory_order_relaxed);
+        stats.largestBatch = m_largestBatch.load(std::memory_order_relaxed);
+        std::lock_guard lock(m_bufferMutex);
+        stats.threadBuffers = m_buffers.size();
+        return stats;
+    }
+
+private:
+    struct RegisterTag {};
+
+    static constexpr size_t kThreadCacheSlots = 16;
+
+    explicit EventChannel(RegisterTag) {
+        EventChannels::Register(this);
+    }
+
+    struct Subscriber {
+        size_t id;
+        EventPriority priority;
+        Handler handler;
+    };
+
+    /**
+     * @brief One producer thread's double buffer
+     *
+     * Only the owning thread appends to pending and only Dispatch swaps it, so
+     * the lock is uncontended except for the instant of the swap.
+     */
+    struct alignas(64) ThreadBuffer {
+        std::vector<T> pending;
+        std::vector<T> draining;
+        mutable std::atomic<bool> busy{false};
+
+        void Lock() const {
+            while (busy.exchange(true, std::memory_order_acquire)) {
+                while (busy.load(std::memory_order_relaxed)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void Unlock() const {
+            busy.store(false, std::memory_order_release);
+        }
+    };
+
+    /**
+     * @brief Records the dispatching thread so re-entry can be caught
+     */
+    class DispatchingScope {
+    public:
+        DispatchingScope(std::atomic<std::thread::id>& owner, std::thread::id self) : m_owner(owner) {
+            m_owner.store(self, std::memory_order_relaxed);
+        }
+        ~DispatchingScope() { m_owner.store(std::thread::id(), std::memory_order_relaxed); }
+
+    private:
+        std::atomic<std::thread::id>& m_owner;
+    };
+
+    ThreadBuffer& GetThreadBuffer() {
+        // Direct-mapped by channel serial, so a thread alternating between a
+        // few channels of one type keeps a hit for each; a collision only
+        // costs the locked lookup in RegisterThread
+        struct CachedBuffer {
+            uint64_t serial = 0;
+            ThreadBuffer* buffer = nullptr;
+        };
+        thread_local std::array<CachedBuffer, kThreadCacheSlots> t_cache;
+
+        CachedBuffer& cached = t_cache[m_serial % kThreadCacheSlots];
+        if (cached.serial != m_serial) {
+            cached = {m_serial, &RegisterThread()};
+        }
+        return *cached.buffer;
+    }
+
+    ThreadBuffer& RegisterThread() {
+        std::lock_guard lock(m_bufferMutex);
+        auto [it, inserted] = m_bufferByThread.try_emplace(std::this_thread::get_id(), nullptr);
+        if (inserted) {
+            m_buffers.push_back(std::make_unique<ThreadBuffer>());
+            it->second = m_buffers.back().get();
+        }
+        return *it->second;
+    }
+
+    // Producer buffers
+    mutable std::mutex m_bufferMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    std::unordered_map<std::thread::id, ThreadBuffer*> m_bufferByThread;
+
+    // Subscribers, copied on write so handlers may (un)subscribe during dispatch
+    mutable std::mutex m_subscriberMutex;
+    std::shared_ptr<const std::vector<Subscriber>> m_subscribers = std::make_shared<std::vector<Subscriber>>();
+    size_t m_nextSubscriptionId = 1;
+
+    // Dispatch state
+    std::mutex m_dispatchMutex;
+    std::atomic<std::thread::id> m_dispatchingThread{};
+    std::vector<ThreadBuffer*> m_draining;
+    std::vector<T> m_joined;
+
+    // Stats
+    std::atomic<uint64_t> m_dispatchedEvents{0};
+    std::atomic<uint64_t> m_dispatches{0};
+    std::atomic<size_t> m_largestBatch{0};
+};
+
+} // namespace Reflect
+} // namespace Nova
@@ -7,6 +7,9 @@
 #include <engine/core/Profiler.hpp>
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <mutex>
+#include <utility>
 
 namespace Vehement {
 
@@ -107,19 +110,71 @@ float Entity::DistanceSquaredTo(const Entity& other) const {
 // EntityManager Implementation
 // ============================================================================
 
+namespace {
+
+template<size_t... I>
+std::array<Nova::ECS::ComponentMask, sizeof...(I)> MakeTypeMasks(std::index_sequence<I...>) {
+    return {Nova::ECS::MakeComponentMask<EntityTypeTag<static_cast<EntityType>(I)>>()...};
+}
+
+// Create with the tag for a runtime EntityType so the entity lands in its final archetype directly
+template<size_t... I>
+Nova::ECS::EntityHandle CreateTagged(Nova::ECS::World& world, EntityType type, EntityObject&& object,
+                                     SpatialCellKey cell, std::index_sequence<I...>) {
+    Nova::ECS::EntityHandle handle;
+    const bool tagged = ((static_cast<size_t>(type) == I &&
+                          (handle = world.Create(std::move(object), cell,
+                                                 EntityTypeTag<static_cast<EntityType>(I)>{}),
+                           true)) || ...);
+    if (!tagged) {
+        handle = world.Create(std::move(object), cell);
+    }
+    return handle;
+}
+
+} // namespace
+
 EntityManager::EntityManager() {
     m_spatialConfig.cellSize = 10.0f;
     m_spatialConfig.enabled = true;
+    m_typeCachesDirty.fill(true);
 }
 
 EntityManager::EntityManager(const SpatialConfig& config)
     : m_spatialConfig(config) {
+    m_typeCachesDirty.fill(true);
 }
 
 EntityManager::~EntityManager() {
     Clear();
 }
 
+const Nova::ECS::ComponentMask& EntityManager::GetTypeMask(EntityType type) {
+    static const auto masks = MakeTypeMasks(std::make_index_sequence<NUM_ENTITY_TYPES>{});
+    static const Nova::ECS::ComponentMask none;
+    const size_t typeIndex = static_cast<size_t>(type);
+    return typeIndex < NUM_ENTITY_TYPES ? masks[typeIndex] : none;
+}
+
+template<typename F>
+void EntityManager::VisitEntities(const Nova::ECS::ComponentMask& filter, F&& fn) {
+    m_world.ForEach<EntityObject>(filter, [&fn](EntityObject& object) {
+        fn(*object.entity);
+    });
+    ApplyPendingChanges();
+}
+
+template<typename F>
+void EntityManager::VisitEntities(const Nova::ECS::ComponentMask& filter, F&& fn) const {
+    m_world.ForEachChunk(filter | Nova::ECS::MakeComponentMask<EntityObject>(),
+                         [&fn](const Nova::ECS::ChunkView& view) {
+        const EntityObject* objects = view.Get<EntityObject>();
+        for (uint32_t i = 0; i < view.Count(); ++i) {
+            fn(static_cast<const Entity&>(*objects[i].entity));
+        }
+    });
+}
+
 Entity::EntityId EntityManager::AddEntity(std::unique_ptr<Entity> entity) {
     if (!entity) {
         return Entity::INVALID_ID;
@@ -127,26 +182,69 @@ Entity::EntityId EntityManager::AddEntity(std::unique_ptr<Entity> entity) {
 
     Entity::EntityId id = entity->GetId();
 
-    // Add to spatial hash
+    if (m_world.IsIterating()) {
+        m_pendingAdds.push_back(std::move(entity));
+        return id;
+    }
+
+    InsertEntity(std::move(entity));
+    return id;
+}
+
+void EntityManager::InsertEntity(std::unique_ptr<Entity> entity) {
+    Entity::EntityId id = entity->GetId();
+
+    // Re-adding an ID replaces the previous entity, as the map storage did
+    if (m_handles.count(id) != 0) {
+        EraseEntity(id);
+    }
+
+    const int64_t cellKey = GetSpatialKey(entity->GetPosition());
     if (m_spatialConfig.enabled) {
-        AddToSpatialHash(id, entity->GetPosition());
+        AddToSpatialHash(id, cellKey);
     }
 
-    m_entities[id] = std::move(entity);
-    m_renderOrderDirty = true;
+    const EntityType type = entity->GetType();
+    m_handles[id] = CreateTagged(m_world, type, EntityObject{std::move(entity)}, SpatialCellKey{cellKey},
+                                 std::make_index_sequence<NUM_ENTITY_TYPES>{});
 
-    return id;
+    MarkTypeCacheDirty(type);
+    m_renderOrderDirty = true;
 }
 
 bool EntityManager::RemoveEntity(Entity::EntityId id) {
-    auto it = m_entities.find(id);
-    if (it == m_entities.end()) {
+    if (m_world.IsIterating()) {
+        auto pending = std::find_if(m_pendingAdds.begin(), m_pendingAdds.end(),
+                                    [id](const std::unique_ptr<Entity>& entity) { return entity->GetId() == id; });
+        if (pending != m_pendingAdds.end()) {
+            m_pendingAdds.erase(pending);
+            return true;
+        }
+
+        if (m_handles.count(id) == 0) {
+            return false;
+        }
+        if (std::find(m_pendingRemovals.begin(), m_pendingRemovals.end(), id) == m_pendingRemovals.end()) {
+            m_pendingRemovals.push_back(id);
+        }
+        return true;
+    }
+
+    if (m_handles.count(id) == 0) {
         return false;
     }
 
+    EraseEntity(id);
+    return true;
+}
+
+void EntityManager::EraseEntity(Entity::EntityId id) {
+    auto it = m_handles.find(id);
+    const Nova::ECS::EntityHandle handle = it->second;
+
     // Remove from spatial hash
     if (m_spatialConfig.enabled) {
-        RemoveFromSpatialHash(id, it->second->GetPosition());
+        RemoveFromSpatialHash(id, m_world.Get<SpatialCellKey>(handle)->key);
     }
 
     // Clear player reference if this is the player
@@ -154,20 +252,48 @@ bool EntityManager::RemoveEntity(Entity::EntityId id) {
         m_player = nullptr;
     }
 
-    m_entities.erase(it);
+    MarkTypeCacheDirty(m_world.Get<EntityObject>(handle)->entity->GetType());
+    m_handles.erase(it);
+    m_world.Destroy(handle);
     m_renderOrderDirty = true;
+}
 
-    return true;
+void EntityManager::ApplyPendingChanges() {
+    if (m_world.IsIterating()) {
+        return;
+    }
+
+    // Removals first so a pending add reusing an ID isn't removed with the old entity
+    while (!m_pendingRemovals.empty()) {
+        std::vector<Entity::EntityId> removals = std::move(m_pendingRemovals);
+        m_pendingRemovals.clear();
+        for (Entity::EntityId id : removals) {
+            RemoveEntity(id);
+        }
+    }
+
+    std::vector<std::unique_ptr<Entity>> adds = std::move(m_pendingAdds);
+    m_pendingAdds.clear();
+    for (auto& entity : adds) {
+        InsertEntity(std::move(entity));
+    }
+}
+
+void EntityManager::MarkTypeCacheDirty(EntityType type) {
+    const size_t typeIndex = static_cast<size_t>(type);
+    if (typeIndex < NUM_ENTITY_TYPES) {
+        m_typeCachesDirty[typeIndex] = true;
+    }
 }
 
 void EntityManager::RemoveMarkedEntities() {
     std::vector<Entity::EntityId> toRemove;
 
-    for (const auto& [id, entity] : m_entities) {
-        if (entity->IsMarkedForRemoval()) {
-            toRemove.push_back(id);
+    VisitEntities({}, [&toRemove](Entity& entity) {
+        if (entity.IsMarkedForRemoval()) {
+            toRemove.push_back(entity.GetId());
         }
-    }
+    });
 
     for (Entity::EntityId id : toRemove) {
         RemoveEntity(id);
@@ -175,74 +301,82 @@ void EntityManager::RemoveMarkedEntities() {
 }
 
 void EntityManager::Clear() {
-    m_entities.clear();
+    if (m_world.IsIterating()) {
+        for (const auto& [id, handle] : m_handles) {
+            RemoveEntity(id);
+        }
+        m_pendingAdds.clear();
+        return;
+    }
+
+    m_world.Clear();
+    m_handles.clear();
+    m_pendingAdds.clear();
+    m_pendingRemovals.clear();
     m_spatialHash.clear();
     m_player = nullptr;
+    m_renderOrder.clear();
     m_renderOrderDirty = true;
+    InvalidateEntityCaches();
 }
 
 Entity* EntityManager::GetEntity(Entity::EntityId id) {
-    auto it = m_entities.find(id);
-    return it != m_entities.end() ? it->second.get() : nullptr;
+    return const_cast<Entity*>(std::as_const(*this).GetEntity(id));
 }
 
 const Entity* EntityManager::GetEntity(Entity::EntityId id) const {
-    auto it = m_entities.find(id);
-    return it != m_entities.end() ? it->second.get() : nullptr;
-}
+    auto it = m_handles.find(id);
+    if (it != m_handles.end()) {
+        return m_world.Get<EntityObject>(it->second)->entity.get();
+    }
 
-void EntityManager::Update(float deltaTime) {
-    // Store old positions for spatial hash update
-    std::vector<std::pair<Entity::EntityId, glm::vec3>> oldPositions;
-    if (m_spatialConfig.enabled) {
-        oldPositions.reserve(m_entities.size());
-        for (const auto& [id, entity] : m_entities) {
-            oldPositions.emplace_back(id, entity->GetPosition());
+    for (const auto& entity : m_pendingAdds) {
+        if (entity->GetId() == id) {
+            return entity.get();
         }
     }
+    return nullptr;
+}
 
+Nova::ECS::EntityHandle EntityManager::GetHandle(Entity::EntityId id) const {
+    auto it = m_handles.find(id);
+    return it != m_handles.end() ? it->second : Nova::ECS::kNullEntity;
+}
+
+void EntityManager::Update(float deltaTime) {
     // Update all entities
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive()) {
-            entity->Update(deltaTime);
+    VisitEntities({}, [deltaTime](Entity& entity) {
+        if (entity.IsActive()) {
+            entity.Update(deltaTime);
         }
-    }
+    });
 
     // Update spatial hash for moved entities
-    if (m_spatialConfig.enabled) {
-        for (const auto& [id, oldPos] : oldPositions) {
-            Entity* entity = GetEntity(id);
-            if (entity) {
-                const glm::vec3& newPos = entity->GetPosition();
-                if (GetSpatialKey(oldPos) != GetSpatialKey(newPos)) {
-                    UpdateSpatialHash(id, oldPos, newPos);
-                }
-            }
-        }
-    }
+    RefreshSpatialHash();
 
     // Remove dead entities
     RemoveMarkedEntities();
 
     m_renderOrderDirty = true;
+    InvalidateEntityCaches();
 }
 
 void EntityManager::UpdateAI(float deltaTime, Nova::Graph* navGraph) {
+    NOVA_PROFILE_SCOPE("EntityManager::UpdateAI");
+
     // Update zombie AI
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive() && entity->GetType() == EntityType::Zombie) {
-            Zombie* zombie = static_cast<Zombie*>(entity.get());
-            zombie->UpdateAI(deltaTime, *this, navGraph);
+    VisitEntities(GetTypeMask(EntityType::Zombie), [&](Entity& entity) {
+        if (entity.IsActive()) {
+            static_cast<Zombie&>(entity).UpdateAI(deltaTime, *this, navGraph);
         }
-    }
+    });
 
     // Update NPC AI
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive() && entity->GetType() == EntityType::NPC) {
-            NPC* npc = static_cast<NPC*>(entity.get());
-            npc->UpdateAI(deltaTime, *this, navGraph);
+    VisitEntities(GetTypeMask(EntityType::NPC), [&](Entity& entity) {
+        if (entity.IsActive()) {
+            static_cast<NPC&>(entity).UpdateAI(deltaTime, *this, navGraph);
         }
-    }
+    });
 }
 
 void EntityManager::Render(Nova::Renderer& renderer) {
@@ -258,13 +392,13 @@ void EntityManager::Render(Nova::Renderer& renderer,
     // Build render order if dirty
     if (m_renderOrderDirty) {
         m_renderOrder.clear();
-        m_renderOrder.reserve(m_entities.size());
+        m_renderOrder.reserve(m_world.GetEntityCount());
 
-        for (auto& [id, entity] : m_entities) {
-            if (entity->IsActive()) {
-                m_renderOrder.push_back(entity.get());
+        VisitEntities({}, [this](Entity& entity) {
+            if (entity.IsActive()) {
+                m_renderOrder.push_back(&entity);
             }
-        }
+        });
 
         m_renderOrderDirty = false;
     }
@@ -320,11 +454,11 @@ std::vector<Entity::EntityId> EntityManager::GetCollidingEntities(Entity::Entity
         }
     } else {
         // Brute force
-        for (const auto& [id, other] : m_entities) {
-            if (id != entityId && entity->CollidesWith(*other)) {
-                result.push_back(id);
+        VisitEntities({}, [&](const Entity& other) {
+            if (other.GetId() != entityId && entity->CollidesWith(other)) {
+                result.push_back(other.GetId());
             }
-        }
+        });
     }
 
     return result;
@@ -354,25 +488,26 @@ void EntityManager::ProcessCollisions() {
     // Track processed pairs to avoid duplicate callbacks
     std::vector<std::pair<Entity::EntityId, Entity::EntityId>> processedPairs;
 
-    for (auto& [id, entity] : m_entities) {
-        if (!entity->IsActive() || !entity->IsCollidable()) {
-            continue;
+    VisitEntities({}, [&](Entity& entity) {
+        if (!entity.IsActive() || !entity.IsCollidable()) {
+            return;
         }
 
+        const Entity::EntityId id = entity.GetId();
         auto collisions = GetCollidingEntities(id);
         for (Entity::EntityId otherId : collisions) {
             // Check if pair already processed
-            auto pair = std::minmax(id, otherId);
+            std::pair<Entity::EntityId, Entity::EntityId> pair = std::minmax(id, otherId);
             if (std::find(processedPairs.begin(), processedPairs.end(), pair) == processedPairs.end()) {
                 processedPairs.push_back(pair);
 
                 Entity* other = GetEntity(otherId);
                 if (other) {
-                    m_collisionCallback(*entity, *other);
+                    m_collisionCallback(entity, *other);
                 }
             }
         }
-    }
+    });
 }
 
 std::vector<Entity*> EntityManager::FindEntitiesInRadius(const glm::vec3& position, float radius) {
@@ -397,14 +532,14 @@ std::vector<Entity*> EntityManager::FindEntitiesInRadius(const glm::vec3& positi
             }
         }
     } else {
-        for (auto& [id, entity] : m_entities) {
-            if (entity->IsActive()) {
-                glm::vec3 diff = entity->GetPosition() - position;
+        VisitEntities({}, [&](Entity& entity) {
+            if (entity.IsActive()) {
+                glm::vec3 diff = entity.GetPosition() - position;
                 if (glm::dot(diff, diff) <= radiusSq) {
-                    result.push_back(entity.get());
+                    result.push_back(&entity);
                 }
             }
-        }
+        });
     }
 
     return result;
@@ -441,39 +576,24 @@ std::vector<Entity*> EntityManager::FindEntitiesInRadius(
 }
 
 Entity* EntityManager::GetNearestEntity(const glm::vec3& position) {
-    Entity* nearest = nullptr;
-    float nearestDistSq = std::numeric_limits<float>::max();
-
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive()) {
-            glm::vec3 diff = entity->GetPosition() - position;
-            float distSq = glm::dot(diff, diff);
-
-            if (distSq < nearestDistSq) {
-                nearestDistSq = distSq;
-                nearest = entity.get();
-            }
-        }
-    }
-
-    return nearest;
+    return GetNearestEntity(position, [](const Entity&) { return true; });
 }
 
 Entity* EntityManager::GetNearestEntity(const glm::vec3& position, EntityType type) {
     Entity* nearest = nullptr;
     float nearestDistSq = std::numeric_limits<float>::max();
 
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive() && entity->GetType() == type) {
-            glm::vec3 diff = entity->GetPosition() - position;
+    VisitEntities(GetTypeMask(type), [&](Entity& entity) {
+        if (entity.IsActive() && entity.GetType() == type) {
+            glm::vec3 diff = entity.GetPosition() - position;
             float distSq = glm::dot(diff, diff);
 
             if (distSq < nearestDistSq) {
                 nearestDistSq = distSq;
-                nearest = entity.get();
+                nearest = &entity;
             }
         }
-    }
+    });
 
     return nearest;
 }
@@ -482,43 +602,42 @@ Entity* EntityManager::GetNearestEntity(const glm::vec3& position, EntityPredica
     Entity* nearest = nullptr;
     float nearestDistSq = std::numeric_limits<float>::max();
 
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive() && predicate(*entity)) {
-            glm::vec3 diff = entity->GetPosition() - position;
+    VisitEntities({}, [&](Entity& entity) {
+        if (entity.IsActive() && predicate(entity)) {
+            glm::vec3 diff = entity.GetPosition() - position;
             float distSq = glm::dot(diff, diff);
 
             if (distSq < nearestDistSq) {
                 nearestDistSq = distSq;
-                nearest = entity.get();
+                nearest = &entity;
             }
         }
-    }
+    });
 
     return nearest;
 }
 
 void EntityManager::ForEachEntity(EntityCallback callback) {
-    for (auto& [id, entity] : m_entities) {
-        callback(*entity);
-    }
+    VisitEntities({}, callback);
 }
 
 void EntityManager::ForEachEntity(EntityType type, EntityCallback callback) {
-    for (auto& [id, entity] : m_entities) {
-        if (entity->GetType() == type) {
-            callback(*entity);
+    VisitEntities(GetTypeMask(type), [&](Entity& entity) {
+        if (entity.GetType() == type) {
+            callback(entity);
         }
-    }
+    });
 }
 
 std::vector<Entity*> EntityManager::GetEntitiesByType(EntityType type) {
     std::vector<Entity*> result;
+    result.reserve(m_world.Count(GetTypeMask(type)));
 
-    for (auto& [id, entity] : m_entities) {
-        if (entity->GetType() == type) {
-            result.push_back(entity.get());
+    VisitEntities(GetTypeMask(type), [&](Entity& entity) {
+        if (entity.GetType() == type) {
+            result.push_back(&entity);
         }
-    }
+    });
 
     return result;
 }
@@ -526,42 +645,46 @@ std::vector<Entity*> EntityManager::GetEntitiesByType(EntityType type) {
 std::vector<Entity*> EntityManager::GetEntities(EntityPredicate predicate) {
     std::vector<Entity*> result;
 
-    for (auto& [id, entity] : m_entities) {
-        if (predicate(*entity)) {
-            result.push_back(entity.get());
+    VisitEntities({}, [&](Entity& entity) {
+        if (predicate(entity)) {
+            result.push_back(&entity);
         }
-    }
+    });
 
     return result;
 }
 
 size_t EntityManager::GetEntityCount(EntityType type) const {
+    if (static_cast<size_t>(type) < NUM_ENTITY_TYPES) {
+        return m_world.Count(GetTypeMask(type));
+    }
+
     size_t count = 0;
-    for (const auto& [id, entity] : m_entities) {
-        if (entity->GetType() == type) {
+    VisitEntities({}, [&](const Entity& entity) {
+        if (entity.GetType() == type) {
             count++;
         }
-    }
+    });
     return count;
 }
 
 size_t EntityManager::GetAliveEntityCount() const {
     size_t count = 0;
-    for (const auto& [id, entity] : m_entities) {
-        if (entity->IsAlive()) {
+    VisitEntities({}, [&](const Entity& entity) {
+        if (entity.IsAlive()) {
             count++;
         }
-    }
+    });
     return count;
 }
 
 size_t EntityManager::GetAliveEntityCount(EntityType type) const {
     size_t count = 0;
-    for (const auto& [id, entity] : m_entities) {
-        if (entity->GetType() == type && entity->IsAlive()) {
+    VisitEntities(GetTypeMask(type), [&](const Entity& entity) {
+        if (entity.GetType() == type && entity.IsAlive()) {
             count++;
         }
-    }
+    });
     return count;
 }
 
@@ -572,9 +695,10 @@ void EntityManager::RebuildSpatialHash() {
         return;
     }
 
-    for (const auto& [id, entity] : m_entities) {
-        AddToSpatialHash(id, entity->GetPosition());
-    }
+    m_world.ForEach<EntityObject, SpatialCellKey>([this](EntityObject& object, SpatialCellKey& cell) {
+        cell.key = GetSpatialKey(object.entity->GetPosition());
+        AddToSpatialHash(object.entity->GetId(), cell.key);
+    });
 }
 
 void EntityManager::SetSpatialCellSize(float size) {
@@ -593,13 +717,11 @@ int64_t EntityManager::GetSpatialKey(int x, int z) const {
     return (static_cast<int64_t>(x) << 32) | (static_cast<int64_t>(z) & 0xFFFFFFFF);
 }
 
-void EntityManager::AddToSpatialHash(Entity::EntityId id, const glm::vec3& position) {
-    int64_t key = GetSpatialKey(position);
+void EntityManager::AddToSpatialHash(Entity::EntityId id, int64_t key) {
     m_spatialHash[key].entityIds.push_back(id);
 }
 
-void EntityManager::RemoveFromSpatialHash(Entity::EntityId id, const glm::vec3& position) {
-    int64_t key = GetSpatialKey(position);
+void EntityManager::RemoveFromSpatialHash(Entity::EntityId id, int64_t key) {
     auto it = m_spatialHash.find(key);
 
     if (it != m_spatialHash.end()) {
@@ -612,9 +734,38 @@ void EntityManager::RemoveFromSpatialHash(Entity::EntityId id, const glm::vec3&
     }
 }
 
-void EntityManager::UpdateSpatialHash(Entity::EntityId id, const glm::vec3& oldPos, const glm::vec3& newPos) {
-    RemoveFromSpatialHash(id, oldPos);
-    AddToSpatialHash(id, newPos);
+void EntityManager::RefreshSpatialHash() {
+    if (!m_spatialConfig.enabled) {
+        return;
+    }
+
+    NOVA_PROFILE_SCOPE("EntityManager::UpdateSpatialHash");
+
+    // Each entity remembers the cell it is filed under, so only cell changes touch the hash
+    m_spatialMoves.clear();
+    m_world.ForEach<EntityObject, SpatialCellKey>([this](EntityObject& object, SpatialCellKey& cell) {
+        const int64_t key = GetSpatialKey(object.entity->GetPosition());
+        if (key != cell.key) {
+            m_spatialMoves.push_back({object.entity->GetId(), cell.key, key});
+            cell.key = key;
+        }
+    });
+
+    // Removal scans the whole cell, so when many entities move at once (a
+    // crowd spawned at the origin and then placed, say) refiling everything
+    // is linear where moving them one by one would be quadratic
+    if (m_spatialMoves.size() * 4 > m_world.GetEntityCount()) {
+        m_spatialHash.clear();
+        m_world.ForEach<EntityObject, SpatialCellKey>([this](EntityObject& object, SpatialCellKey& cell) {
+            AddToSpatialHash(object.entity->GetId(), cell.key);
+        });
+        return;
+    }
+
+    for (const SpatialMove& move : m_spatialMoves) {
+        RemoveFromSpatialHash(move.id, move.from);
+        AddToSpatialHash(move.id, move.to);
+    }
 }
 
 std::vector<int64_t> EntityManager::GetNearbyCells(const glm::vec3& position, float radius) const {
@@ -640,58 +791,32 @@ std::vector<int64_t> EntityManager::GetNearbyCells(const glm::vec3& position, fl
 void EntityManager::UpdateParallel(float deltaTime, bool useParallel) {
     NOVA_PROFILE_SCOPE("EntityManager::UpdateParallel");
 
-    // Store old positions for spatial hash update
-    std::vector<std::pair<Entity::EntityId, glm::vec3>> oldPositions;
-    if (m_spatialConfig.enabled) {
-        oldPositions.reserve(m_entities.size());
-        for (const auto& [id, entity] : m_entities) {
-            if (entity->IsActive()) {
-                oldPositions.emplace_back(id, entity->GetPosition());
-            }
-        }
-    }
-
-    // Build flat array for cache-efficient iteration
-    std::vector<Entity*> activeEntities;
-    activeEntities.reserve(m_entities.size());
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive()) {
-            activeEntities.push_back(entity.get());
-        }
-    }
-
     // Update entities
-    if (!useParallel || activeEntities.size() < 50 || !Nova::JobSystem::Instance().IsInitialized()) {
+    if (!useParallel || m_world.GetEntityCount() < 50 || !Nova::JobSystem::Instance().IsInitialized()) {
         // Sequential update
-        for (Entity* entity : activeEntities) {
-            entity->Update(deltaTime);
-        }
+        VisitEntities({}, [deltaTime](Entity& entity) {
+            if (entity.IsActive()) {
+                entity.Update(deltaTime);
+            }
+        });
     } else {
-        // Parallel update
-        Nova::JobSystem::Instance().ParallelFor(0, activeEntities.size(), [&](size_t i) {
-            activeEntities[i]->Update(deltaTime);
+        // Parallel update over row ranges of the entity chunks
+        m_world.ParallelForEach<EntityObject>([deltaTime](EntityObject& object) {
+            if (object.entity->IsActive()) {
+                object.entity->Update(deltaTime);
+            }
         });
+        ApplyPendingChanges();
     }
 
     // Update spatial hash for moved entities
-    if (m_spatialConfig.enabled) {
-        NOVA_PROFILE_SCOPE("EntityManager::UpdateSpatialHash");
-        for (const auto& [id, oldPos] : oldPositions) {
-            Entity* entity = GetEntity(id);
-            if (entity) {
-                const glm::vec3& newPos = entity->GetPosition();
-                if (GetSpatialKey(oldPos) != GetSpatialKey(newPos)) {
-                    UpdateSpatialHash(id, oldPos, newPos);
-                }
-            }
-        }
-    }
+    RefreshSpatialHash();
 
     // Remove dead entities
     RemoveMarkedEntities();
 
     m_renderOrderDirty = true;
-    m_allCachesDirty = true;
+    InvalidateEntityCaches();
 }
 
 void EntityManager::ForEachEntityOptimized(EntityType type, EntityCallback callback) {
@@ -722,15 +847,16 @@ const std::vector<Entity*>& EntityManager::GetCachedEntitiesByType(EntityType ty
         return empty;
     }
 
-    // Rebuild cache if dirty
-    if (m_allCachesDirty || m_typeCachesDirty[typeIndex]) {
-        m_typeCaches[typeIndex].clear();
+    // Rebuild cache if dirty; only this type's chunks are walked
+    if (m_typeCachesDirty[typeIndex]) {
+        auto& cache = m_typeCaches[typeIndex];
+        cache.clear();
 
-        for (auto& [id, entity] : m_entities) {
-            if (entity->GetType() == type && entity->IsActive()) {
-                m_typeCaches[typeIndex].push_back(entity.get());
+        VisitEntities(GetTypeMask(type), [&cache](Entity& entity) {
+            if (entity.IsActive()) {
+                cache.push_back(&entity);
             }
-        }
+        });
 
         m_typeCachesDirty[typeIndex] = false;
     }
@@ -739,31 +865,16 @@ const std::vector<Entity*>& EntityManager::GetCachedEntitiesByType(EntityType ty
 }
 
 void EntityManager::InvalidateEntityCaches() {
-    m_allCachesDirty = true;
+    m_typeCachesDirty.fill(true);
     m_renderOrderDirty = true;
 }
 
 void EntityManager::BuildEntityCaches() {
     NOVA_PROFILE_SCOPE("EntityManager::BuildEntityCaches");
 
-    // Clear all caches
-    for (auto& cache : m_typeCaches) {
-        cache.clear();
-    }
-
-    // Build all caches in single pass
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive()) {
-            size_t typeIndex = static_cast<size_t>(entity->GetType());
-            if (typeIndex < NUM_ENTITY_TYPES) {
-                m_typeCaches[typeIndex].push_back(entity.get());
-            }
-        }
-    }
-
-    m_allCachesDirty = false;
-    for (auto& dirty : m_typeCachesDirty) {
-        dirty = false;
+    for (size_t typeIndex = 0; typeIndex < NUM_ENTITY_TYPES; ++typeIndex) {
+        m_typeCachesDirty[typeIndex] = true;
+        (void)GetCachedEntitiesByType(static_cast<EntityType>(typeIndex));
     }
 }
 
@@ -776,12 +887,12 @@ void EntityManager::ProcessCollisionsParallel(CollisionCallback callback) {
 
     // Build list of collidable entities
     std::vector<Entity*> collidables;
-    collidables.reserve(m_entities.size());
-    for (auto& [id, entity] : m_entities) {
-        if (entity->IsActive() && entity->IsCollidable()) {
-            collidables.push_back(entity.get());
+    collidables.reserve(m_world.GetEntityCount());
+    VisitEntities({}, [&collidables](Entity& entity) {
+        if (entity.IsActive() && entity.IsCollidable()) {
+            collidables.push_back(&entity);
         }
-    }
+    });
 
     // For smaller sets, use sequential processing
     if (collidables.size() < 100 || !Nova::JobSystem::Instance().IsInitialized()) {
@@ -847,15 +958,20 @@ void EntityManager::SetPositionsSoA(const std::vector<Entity::EntityId>& entityI
     }
 
     for (size_t i = 0; i < entityIds.size(); ++i) {
-        Entity* entity = GetEntity(entityIds[i]);
-        if (entity) {
-            glm::vec3 oldPos = entity->GetPosition();
-            entity->SetPosition(positions[i]);
-
-            // Update spatial hash
-            if (m_spatialConfig.enabled && GetSpatialKey(oldPos) != GetSpatialKey(positions[i])) {
-                UpdateSpatialHash(entityIds[i], oldPos, positions[i]);
-            }
+        auto it = m_handles.find(entityIds[i]);
+        if (it == m_handles.end()) {
+            continue;
+        }
+
+        m_world.Get<EntityObject>(it->second)->entity->SetPosition(positions[i]);
+
+        // Update spatial hash
+        SpatialCellKey* cell = m_world.Get<SpatialCellKey>(it->second);
+        const int64_t key = GetSpatialKey(positions[i]);
+        if (m_spatialConfig.enabled && key != cell->key) {
+            RemoveFromSpatialHash(entityIds[i], cell->key);
+            AddToSpatialHash(entityIds[i], key);
+            cell->key = key;
         }
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Entity.hpp"
+#include <engine/ecs/World.hpp>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -36,12 +37,46 @@ struct SpatialConfig {
     bool enabled = true;
 };
 
+// ============================================================================
+// ECS Components
+// ============================================================================
+
+/**
+ * @brief Owns the polymorphic Entity behind an ECS entity
+ *
+ * The Entity object itself never moves, so Entity pointers handed out by the
+ * manager stay valid while the component row is relocated between chunks.
+ */
+struct EntityObject {
+    std::unique_ptr<Entity> entity;
+};
+
+/**
+ * @brief Spatial hash cell the entity is currently filed under
+ */
+struct SpatialCellKey {
+    int64_t key = 0;
+};
+
+/**
+ * @brief Tag splitting entities into one archetype per EntityType
+ */
+template<EntityType Type>
+struct EntityTypeTag {};
+
 /**
  * @brief Entity Manager for Vehement2
  *
  * Manages all game entities including creation, destruction, updating,
  * and rendering. Provides efficient spatial queries for collision detection
  * and AI targeting.
+ *
+ * Entities are stored in a Nova::ECS::World: each one is an ECS entity with
+ * an EntityObject, its SpatialCellKey and the tag for its EntityType, so
+ * per-type passes walk only that type's chunks. The Entity-based API below is
+ * a facade over that store; new systems can attach their own components via
+ * GetWorld() and GetHandle(). Entities added or removed while the manager is
+ * iterating are applied once the outermost iteration finishes.
  */
 class EntityManager {
 public:
@@ -64,6 +99,9 @@ public:
 
     /**
      * @brief Add an entity to the manager
+     *
+     * During iteration the entity is reachable through GetEntity straight
+     * away but only joins iteration and counts once the iteration ends.
      * @param entity Unique pointer to entity (ownership transferred)
      * @return Entity ID assigned to the entity
      */
@@ -116,6 +154,26 @@ public:
     template<typename T>
     [[nodiscard]] const T* GetEntityAs(Entity::EntityId id) const;
 
+    /**
+     * @brief Get the ECS handle of an entity
+     * @return Null handle if the entity is unknown or still pending addition
+     */
+    [[nodiscard]] Nova::ECS::EntityHandle GetHandle(Entity::EntityId id) const;
+
+    /**
+     * @brief Component store backing the manager
+     *
+     * Systems may add their own components to entity handles; structural
+     * changes must not be made while the manager is iterating.
+     */
+    [[nodiscard]] Nova::ECS::World& GetWorld() noexcept { return m_world; }
+    [[nodiscard]] const Nova::ECS::World& GetWorld() const noexcept { return m_world; }
+
+    /**
+     * @brief Component mask selecting entities of one EntityType
+     */
+    [[nodiscard]] static const Nova::ECS::ComponentMask& GetTypeMask(EntityType type);
+
     // =========================================================================
     // Player Access
     // =========================================================================
@@ -296,7 +354,7 @@ public:
     // =========================================================================
 
     /** @brief Get total entity count */
-    [[nodiscard]] size_t GetEntityCount() const noexcept { return m_entities.size(); }
+    [[nodiscard]] size_t GetEntityCount() const noexcept { return m_world.GetEntityCount(); }
 
     /** @brief Get count of entities by type */
     [[nodiscard]] size_t GetEntityCount(EntityType type) const;
@@ -329,6 +387,9 @@ public:
 
     /**
      * @brief Update all entities with parallel execution
+     *
+     * Work is split into row ranges of the ECS chunks, so one job updates a
+     * contiguous run of entities of the same type.
      * @param deltaTime Time since last frame
      * @param useParallel Use job system for parallel updates
      */
@@ -357,7 +418,10 @@ public:
     [[nodiscard]] const std::vector<Entity*>& GetCachedEntitiesByType(EntityType type);
 
     /**
-     * @brief Invalidate entity caches (call after add/remove)
+     * @brief Invalidate entity caches
+     *
+     * Adds and removals invalidate the affected type on their own; call this
+     * after changing entities' active state outside Update.
      */
     void InvalidateEntityCaches();
 
@@ -394,12 +458,23 @@ private:
     Entity::EntityId m_nextId = 1;
 
     // Entity storage
-    std::unordered_map<Entity::EntityId, std::unique_ptr<Entity>> m_entities;
+    Nova::ECS::World m_world;
+    std::unordered_map<Entity::EntityId, Nova::ECS::EntityHandle> m_handles;
     Player* m_player = nullptr;
 
+    // Changes requested while iterating, applied when the iteration ends
+    std::vector<std::unique_ptr<Entity>> m_pendingAdds;
+    std::vector<Entity::EntityId> m_pendingRemovals;
+
     // Spatial partitioning
+    struct SpatialMove {
+        Entity::EntityId id;
+        int64_t from;
+        int64_t to;
+    };
     SpatialConfig m_spatialConfig;
     std::unordered_map<int64_t, SpatialHashCell> m_spatialHash;
+    std::vector<SpatialMove> m_spatialMoves;  // Scratch for RefreshSpatialHash
 
     // Callbacks
     CollisionCallback m_collisionCallback;
@@ -412,14 +487,24 @@ private:
     static constexpr size_t NUM_ENTITY_TYPES = 8;  // Adjust based on EntityType enum
     mutable std::array<std::vector<Entity*>, NUM_ENTITY_TYPES> m_typeCaches;
     mutable std::array<bool, NUM_ENTITY_TYPES> m_typeCachesDirty;
-    mutable bool m_allCachesDirty = true;
+
+    // Storage helpers
+    void InsertEntity(std::unique_ptr<Entity> entity);
+    void EraseEntity(Entity::EntityId id);
+    void ApplyPendingChanges();
+    void MarkTypeCacheDirty(EntityType type);
+
+    template<typename F>
+    void VisitEntities(const Nova::ECS::ComponentMask& filter, F&& fn);
+    template<typename F>
+    void VisitEntities(const Nova::ECS::ComponentMask& filter, F&& fn) const;
 
     // Spatial hash helpers
     [[nodiscard]] int64_t GetSpatialKey(const glm::vec3& position) const;
     [[nodiscard]] int64_t GetSpatialKey(int x, int z) const;
-    void AddToSpatialHash(Entity::EntityId id, const glm::vec3& position);
-    void RemoveFromSpatialHash(Entity::EntityId id, const glm::vec3& position);
-    void UpdateSpatialHash(Entity::EntityId id, const glm::vec3& oldPos, const glm::vec3& newPos);
+    void AddToSpatialHash(Entity::EntityId id, int64_t key);
+    void RemoveFromSpatialHash(Entity::EntityId id, int64_t key);
+    void RefreshSpatialHash();
 
     // Get nearby cells for query
     [[nodiscard]] std::vector<int64_t> GetNearbyCells(const glm::vec3& position, float radius) const;
@@ -42,34 +42,30 @@ void NPC::Update(float deltaTime) {
 }
 
 void NPC::Render(Nova::Renderer& renderer) {
-    // Apply visual effects based on infection state
-    if (IsInfected()) {
-        // Calculate infection progress (0 = just infected, 1 = about to turn)
-        float progress = GetInfectionProgress();
-
-        // Tint color transitions from normal to sickly green as infection progresses
-        // At start (0%): subtle green tint
-        // Near end (100%): deep green/grey zombie-like color
-        float greenTint = 0.7f + 0.3f * (1.0f - progress);   // Decreases green
-        float redTint = 1.0f - 0.5f * progress;               // Decreases red
-        float blueTint = 1.0f - 0.4f * progress;              // Decreases blue
-
-        // Apply tint through renderer (renderer handles color modulation)
-        renderer.SetColorTint(glm::vec4(redTint, greenTint, blueTint, 1.0f));
-
-        // If turning, add pulsing effect
-        if (IsTurning()) {
-            float pulse = (std::sin(m_infectionTimer * 10.0f) + 1.0f) * 0.5f;
-            renderer.SetColorTint(glm::vec4(redTint * pulse, greenTint, blueTint * pulse, 1.0f));
-        }
+    Entity::Render(renderer);
+}
+
+glm::vec4 NPC::GetInfectionTint() const {
+    if (!IsInfected()) {
+        return glm::vec4(1.0f);
     }
 
-    Entity::Render(renderer);
+    // Calculate infection progress (0 = just infected, 1 = about to turn)
+    float progress = GetInfectionProgress();
 
-    // Reset tint after rendering
-    if (IsInfected()) {
-        renderer.SetColorTint(glm::vec4(1.0f));
+    // Tint color transitions from normal to sickly green as infection progresses
+    // At start (0%): subtle green tint
+    // Near end (100%): deep green/grey zombie-like color
+    float greenTint = 0.7f + 0.3f * (1.0f - progress);   // Decreases green
+    float redTint = 1.0f - 0.5f * progress;               // Decreases red
+    float blueTint = 1.0f - 0.4f * progress;              // Decreases blue
+
+    // If turning, add pulsing effect
+    if (IsTurning()) {
+        float pulse = (std::sin(m_infectionTimer * 10.0f) + 1.0f) * 0.5f;
+        return glm::vec4(redTint * pulse, greenTint, blueTint * pulse, 1.0f);
     }
+    return glm::vec4(redTint, greenTint, blueTint, 1.0f);
 }
 
 void NPC::UpdateAI(float deltaTime, EntityManager& entityManager, Nova::Graph* navGraph) {
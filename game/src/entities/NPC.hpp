@@ -185,6 +185,14 @@ public:
         return 1.0f - (m_infectionTimer / m_infectionDuration);
     }
 
+    /**
+     * @brief Colour to modulate the NPC's sprite with
+     *
+     * White when healthy; shifts toward sickly green as the infection
+     * progresses and pulses while turning.
+     */
+    [[nodiscard]] glm::vec4 GetInfectionTint() const;
+
     /** @brief Set infection duration (time before turning) */
     void SetInfectionDuration(float duration) noexcept { m_infectionDuration = duration; }
 
@@ -1,6 +1,7 @@
 #include "Zombie.hpp"
 #include "EntityManager.hpp"
 #include "NPC.hpp"
+#include "Player.hpp"
 #include <engine/pathfinding/Graph.hpp>
 #include <engine/math/Random.hpp>
 #include <engine/graphics/Renderer.hpp>
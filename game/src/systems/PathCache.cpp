@@ -1,36 +1,92 @@
 #include "PathCache.hpp"
+#include <engine/core/JobSystem.hpp>
 #include <algorithm>
 #include <cmath>
 
 namespace Vehement {
 namespace Systems {
 
+namespace {
+
+/**
+ * @brief Adapts a blocking compute function to the incremental interface
+ */
+class BlockingPathSearch : public IncrementalPathSearch {
+public:
+    BlockingPathSearch(PathComputeFunction func, const glm::vec3& start, const glm::vec3& goal)
+        : m_func(std::move(func)), m_start(start), m_goal(goal) {}
+
+    PathSearchStep Step(uint32_t /*nodeBudget*/, PathResult& result) override {
+        result = m_func(m_start, m_goal);
+        return {result.IsValid() ? PathSearchState::Found : PathSearchState::Failed, 0};
+    }
+
+private:
+    PathComputeFunction m_func;
+    glm::vec3 m_start;
+    glm::vec3 m_goal;
+};
+
+// Step() calls per slice; the slice clock is checked between them
+constexpr uint32_t kStepsPerSlice = 4;
+
+// Unsigned throughout: quantised coordinates may be negative
+uint64_t HashCell(const glm::ivec3& cell) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) * 73856093ull ^
+           static_cast<uint64_t>(static_cast<uint32_t>(cell.y)) * 19349663ull ^
+           static_cast<uint64_t>(static_cast<uint32_t>(cell.z)) * 83492791ull;
+}
+
+double SecondsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::max(0.0, std::chrono::duration<double>(to - from).count());
+}
+
+} // namespace
+
+// ============================================================================
+// LatencyHistogram Implementation
+// ============================================================================
+
+void LatencyHistogram::Record(double seconds) {
+    const double micros = seconds * 1e6;
+    size_t bucket = 0;
+    while (bucket + 1 < kBucketCount && micros >= static_cast<double>(1ull << bucket)) {
+        ++bucket;
+    }
+
+    ++buckets[bucket];
+    ++count;
+    totalSeconds += seconds;
+    maxSeconds = std::max(maxSeconds, seconds);
+}
+
+double LatencyHistogram::GetPercentile(double percentile) const {
+    if (count == 0) return 0.0;
+
+    const uint64_t target = static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 1.0) * count));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += buckets[i];
+        if (seen >= std::max<uint64_t>(target, 1)) {
+            return std::min(static_cast<double>(1ull << i) * 1e-6, maxSeconds);
+        }
+    }
+    return maxSeconds;
+}
+
 // ============================================================================
 // PathCache Implementation
 // ============================================================================
 
 PathCache::PathCache(const Config& config)
     : m_config(config)
+    , m_sliceJobs(std::make_unique<Nova::JobCounter>())
 {
-    // Start worker threads for async requests
-    if (config.asyncThreadCount > 0) {
-        for (size_t i = 0; i < config.asyncThreadCount; ++i) {
-            m_workers.emplace_back(&PathCache::WorkerThread, this);
-        }
-    }
 }
 
 PathCache::~PathCache() {
-    // Signal workers to stop
-    m_running = false;
-    m_requestCondition.notify_all();
-
-    // Wait for workers to finish
-    for (auto& worker : m_workers) {
-        if (worker.joinable()) {
-            worker.join();
-        }
-    }
+    // Slices reference this cache; let running ones finish
+    m_sliceJobs->Wait();
 }
 
 PathResult PathCache::GetPath(const glm::vec3& start, const glm::vec3& goal,
@@ -110,29 +166,49 @@ PathRequestHandle PathCache::RequestPathAsync(EntityId entityId,
         return handle;
     }
 
-    // Queue async request
-    {
-        std::lock_guard<std::mutex> lock(m_requestMutex);
+    AsyncRequest request;
+    request.requestId = handle.requestId;
+    request.entityId = entityId;
+    request.start = start;
+    request.goal = goal;
+    request.callback = std::move(callback);
+    request.status = PathRequestStatus::Pending;
+    request.submitTime = m_currentTime;
+    request.queuedAt = Clock::now();
 
-        if (m_pendingRequests.size() >= m_config.maxQueuedRequests) {
-            handle.status = PathRequestStatus::Failed;
-            return handle;
-        }
+    const RequestKey key = MakeRequestKey(start, goal);
 
-        AsyncRequest request;
-        request.requestId = handle.requestId;
-        request.entityId = entityId;
-        request.start = start;
-        request.goal = goal;
-        request.callback = callback;
-        request.status = PathRequestStatus::Pending;
-        request.submitTime = m_currentTime;
+    std::lock_guard<std::mutex> lock(m_requestMutex);
 
-        m_pendingRequests.push(request);
+    // Join an identical in-flight search
+    auto it = m_inFlight.find(key);
+    if (it != m_inFlight.end()) {
+        it->second->waiters.push_back(std::move(request));
+        m_requestKeys[handle.requestId] = key;
+        ++m_stats.coalescedRequests;
+        return handle;
     }
 
-    m_requestCondition.notify_one();
-    ++m_stats.pendingRequests;
+    if (m_inFlight.size() >= m_config.maxQueuedRequests ||
+        (!m_searchFactory && !m_pathComputeFunc)) {
+        handle.status = PathRequestStatus::Failed;
+        return handle;
+    }
+
+    auto search = std::make_unique<InFlightSearch>();
+    search->key = key;
+    search->start = start;
+    search->goal = goal;
+    search->submitTime = m_currentTime;
+    search->search = m_searchFactory
+        ? m_searchFactory(start, goal)
+        : std::make_unique<BlockingPathSearch>(m_pathComputeFunc, start, goal);
+    search->waiters.push_back(std::move(request));
+
+    m_inFlight.emplace(key, std::move(search));
+    m_requestKeys[handle.requestId] = key;
+    m_runQueue.push_back(key);
+    m_stats.pendingRequests = m_inFlight.size();
 
     return handle;
 }
@@ -140,7 +216,18 @@ PathRequestHandle PathCache::RequestPathAsync(EntityId entityId,
 bool PathCache::CancelRequest(uint64_t requestId) {
     std::lock_guard<std::mutex> lock(m_requestMutex);
 
-    // Can't cancel in-progress requests, but mark completed for removal
+    // Detach from its in-flight search; a search nobody waits for is dropped at dispatch
+    auto keyIt = m_requestKeys.find(requestId);
+    if (keyIt != m_requestKeys.end()) {
+        auto& waiters = m_inFlight.at(keyIt->second)->waiters;
+        waiters.erase(std::remove_if(waiters.begin(), waiters.end(), [requestId](const AsyncRequest& r) {
+            return r.requestId == requestId;
+        }), waiters.end());
+        m_requestKeys.erase(keyIt);
+        return true;
+    }
+
+    // Mark completed for removal
     auto it = m_completedRequests.find(requestId);
     if (it != m_completedRequests.end()) {
         it->second.status = PathRequestStatus::Cancelled;
@@ -153,6 +240,18 @@ bool PathCache::CancelRequest(uint64_t requestId) {
 void PathCache::CancelEntityRequests(EntityId entityId) {
     std::lock_guard<std::mutex> lock(m_requestMutex);
 
+    for (auto& [key, search] : m_inFlight) {
+        auto& waiters = search->waiters;
+        for (auto it = waiters.begin(); it != waiters.end();) {
+            if (it->entityId == entityId) {
+                m_requestKeys.erase(it->requestId);
+                it = waiters.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
     for (auto& [id, request] : m_completedRequests) {
         if (request.entityId == entityId) {
             request.status = PathRequestStatus::Cancelled;
@@ -168,6 +267,11 @@ PathRequestStatus PathCache::GetRequestStatus(uint64_t requestId) const {
         return it->second.status;
     }
 
+    auto keyIt = m_requestKeys.find(requestId);
+    if (keyIt != m_requestKeys.end() && m_inFlight.at(keyIt->second)->started) {
+        return PathRequestStatus::InProgress;
+    }
+
     return PathRequestStatus::Pending;
 }
 
@@ -190,22 +294,37 @@ void PathCache::ProcessCompletedRequests() {
         std::lock_guard<std::mutex> lock(m_requestMutex);
 
         for (auto it = m_completedRequests.begin(); it != m_completedRequests.end();) {
-            if (it->second.status == PathRequestStatus::Complete ||
-                it->second.status == PathRequestStatus::Failed) {
-                toProcess.push_back(it->second);
+            if (it->second.status != PathRequestStatus::Pending &&
+                it->second.status != PathRequestStatus::InProgress) {
+                toProcess.push_back(std::move(it->second));
                 it = m_completedRequests.erase(it);
             } else {
                 ++it;
             }
         }
+
+        m_stats.searchSlices = m_searchSlices;
+        m_stats.pendingRequests = m_inFlight.size();
     }
 
     // Invoke callbacks outside the lock
     for (const auto& request : toProcess) {
-        if (request.callback && request.status != PathRequestStatus::Cancelled) {
+        if (request.status == PathRequestStatus::Cancelled) {
+            continue;
+        }
+
+        if (request.status == PathRequestStatus::Complete) {
+            CachePath(request.start, request.goal, request.result);
+        }
+
+        if (request.callback) {
             request.callback(request.entityId, request.result);
         }
 
+        m_stats.queuedLatency.Record(SecondsBetween(request.queuedAt, request.startedAt));
+        m_stats.computeLatency.Record(SecondsBetween(request.startedAt, request.finishedAt));
+        m_stats.deliveryLatency.Record(SecondsBetween(request.finishedAt, Clock::now()));
+
         if (request.status == PathRequestStatus::Complete) {
             ++m_stats.asyncRequestsCompleted;
         } else if (request.status == PathRequestStatus::Failed) {
@@ -219,6 +338,11 @@ void PathCache::SetPathComputeFunction(PathComputeFunction func) {
     m_pathComputeFunc = func;
 }
 
+void PathCache::SetPathSearchFactory(PathSearchFactory factory) {
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+    m_searchFactory = std::move(factory);
+}
+
 void PathCache::SharePath(EntityId entityId, const glm::vec3& position,
                            const glm::vec3& goal, const PathResult& path) {
     if (!path.IsValid()) return;
@@ -476,11 +600,7 @@ void PathCache::Update(float currentTime) {
         lastPrune = currentTime;
     }
 
-    // Update pending request count
-    {
-        std::lock_guard<std::mutex> lock(m_requestMutex);
-        m_stats.pendingRequests = m_pendingRequests.size();
-    }
+    DispatchSearches();
 
     // Prune old shared paths
     {
@@ -500,13 +620,31 @@ void PathCache::ResetStats() {
     m_stats.currentCacheSize = m_cache.size();
 }
 
+PathCache::RequestKey PathCache::MakeRequestKey(const glm::vec3& start, const glm::vec3& goal) const {
+    // Same start cell, goal snapped to goalTolerance-sized regions
+    const float region = std::max(m_config.goalTolerance, m_positionQuantization);
+    RequestKey key;
+    key.startCell = QuantizePosition(start);
+    key.goalRegion = glm::ivec3(
+        static_cast<int>(std::floor(goal.x / region)),
+        static_cast<int>(std::floor(goal.y / region)),
+        static_cast<int>(std::floor(goal.z / region))
+    );
+    return key;
+}
+
+size_t PathCache::RequestKeyHash::operator()(const RequestKey& key) const noexcept {
+    const uint64_t h = HashCell(key.startCell) * 0x9E3779B97F4A7C15ull ^ HashCell(key.goalRegion);
+    return static_cast<size_t>(h ^ (h >> 32));
+}
+
 uint64_t PathCache::MakeCacheKey(const glm::vec3& start, const glm::vec3& goal) const {
     glm::ivec3 qStart = QuantizePosition(start);
     glm::ivec3 qGoal = QuantizePosition(goal);
 
     // Simple hash combining quantized positions
-    uint64_t h1 = (qStart.x * 73856093) ^ (qStart.y * 19349663) ^ (qStart.z * 83492791);
-    uint64_t h2 = (qGoal.x * 73856093) ^ (qGoal.y * 19349663) ^ (qGoal.z * 83492791);
+    const uint64_t h1 = HashCell(qStart);
+    const uint64_t h2 = HashCell(qGoal);
 
     return (h1 << 32) | (h2 & 0xFFFFFFFF);
 }
@@ -536,47 +674,101 @@ void PathCache::EvictLRU() {
     }
 }
 
-void PathCache::WorkerThread() {
-    while (m_running) {
-        AsyncRequest request;
+void PathCache::DispatchSearches() {
+    std::vector<InFlightSearch*> batch;
 
-        {
-            std::unique_lock<std::mutex> lock(m_requestMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
 
-            m_requestCondition.wait(lock, [this] {
-                return !m_running || !m_pendingRequests.empty();
-            });
+        // One slice per runnable search, round-robin, within the frame budget
+        const size_t sliceSize = std::max<uint32_t>(m_config.nodesPerSlice, 1);
+        const size_t maxSlices = std::max<size_t>(m_config.nodeBudgetPerFrame / sliceSize, 1);
+        size_t queued = m_runQueue.size();
 
-            if (!m_running) break;
+        while (queued-- > 0 && batch.size() < maxSlices) {
+            const RequestKey key = m_runQueue.front();
+            m_runQueue.pop_front();
 
-            if (m_pendingRequests.empty()) continue;
+            auto it = m_inFlight.find(key);
+            if (it == m_inFlight.end()) continue;
+            InFlightSearch& search = *it->second;
 
-            request = m_pendingRequests.front();
-            m_pendingRequests.pop();
+            if (search.waiters.empty()) {
+                m_inFlight.erase(it);
+                continue;
+            }
+            if (m_currentTime - search.submitTime > m_config.requestTimeout) {
+                search.result = PathResult{};
+                FinishSearchLocked(search, PathRequestStatus::Failed);
+                continue;
+            }
+
+            batch.push_back(&search);
         }
 
-        // Check for timeout
-        if (m_currentTime - request.submitTime > m_config.requestTimeout) {
-            request.status = PathRequestStatus::Failed;
-        } else {
-            // Compute path
-            request.status = PathRequestStatus::InProgress;
+        m_stats.pendingRequests = m_inFlight.size();
+    }
 
-            if (m_pathComputeFunc) {
-                request.result = m_pathComputeFunc(request.start, request.goal);
-                request.status = request.result.IsValid() ?
-                    PathRequestStatus::Complete : PathRequestStatus::Failed;
-            } else {
-                request.status = PathRequestStatus::Failed;
-            }
+    Nova::JobSystem& jobSystem = Nova::JobSystem::Instance();
+    for (InFlightSearch* search : batch) {
+        if (jobSystem.IsInitialized()) {
+            jobSystem.Submit([this, search]() { RunSlice(*search); }, *m_sliceJobs);
+        } else {
+            RunSlice(*search);
         }
+    }
+}
 
-        // Store completed request
-        {
-            std::lock_guard<std::mutex> lock(m_requestMutex);
-            m_completedRequests[request.requestId] = request;
-        }
+void PathCache::RunSlice(InFlightSearch& search) {
+    // Only this slice touches the search and its result until it is requeued
+    if (!search.started) {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        search.startedAt = Clock::now();
+        search.started = true;
     }
+
+    // Step in chunks so the clock is checked within the slice, and stop at
+    // whichever of the node and time limits is reached first
+    const uint32_t nodeLimit = std::max<uint32_t>(m_config.nodesPerSlice, 1);
+    const uint32_t chunk = std::max<uint32_t>(nodeLimit / kStepsPerSlice, 1);
+    const Clock::time_point deadline = Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(m_config.sliceTimeBudgetMs));
+
+    PathSearchStep step;
+    uint32_t expanded = 0;
+    do {
+        step = search.search->Step(std::min(chunk, nodeLimit - expanded), search.result);
+        expanded += std::min(step.nodesExpanded, nodeLimit - expanded);
+    } while (step.state == PathSearchState::Running && expanded < nodeLimit && Clock::now() < deadline);
+
+    std::lock_guard<std::mutex> lock(m_requestMutex);
+    ++m_searchSlices;
+
+    if (step.state == PathSearchState::Running) {
+        m_runQueue.push_back(search.key);
+        return;
+    }
+
+    const bool found = step.state == PathSearchState::Found && search.result.IsValid();
+    FinishSearchLocked(search, found ? PathRequestStatus::Complete : PathRequestStatus::Failed);
+}
+
+void PathCache::FinishSearchLocked(InFlightSearch& search, PathRequestStatus status) {
+    const Clock::time_point now = Clock::now();
+    const Clock::time_point startedAt = search.started ? search.startedAt : now;
+
+    for (AsyncRequest& request : search.waiters) {
+        request.status = status;
+        request.result = search.result;
+        request.startedAt = std::max(startedAt, request.queuedAt);
+        request.finishedAt = now;
+        m_requestKeys.erase(request.requestId);
+        const uint64_t requestId = request.requestId;
+        m_completedRequests[requestId] = std::move(request);
+    }
+
+    // Destroys the search
+    m_inFlight.erase(search.key);
 }
 
 // ============================================================================
@@ -3,16 +3,21 @@
 #include <glm/glm.hpp>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
+#include <deque>
+#include <array>
+#include <chrono>
 #include <memory>
 #include <functional>
 #include <atomic>
 #include <mutex>
-#include <thread>
-#include <condition_variable>
-#include <future>
 #include <cstdint>
 
+namespace Nova {
+    class JobCounter;
+}
+
 namespace Vehement {
 namespace Systems {
 
@@ -84,6 +89,63 @@ using PathCompleteCallback = std::function<void(EntityId, const PathResult&)>;
  */
 using PathComputeFunction = std::function<PathResult(const glm::vec3&, const glm::vec3&)>;
 
+/**
+ * @brief State of an incremental search after a step
+ */
+enum class PathSearchState : uint8_t {
+    Running,        // Budget exhausted, call Step() again
+    Found,          // Result holds the path
+    Failed          // No path exists
+};
+
+struct PathSearchStep {
+    PathSearchState state = PathSearchState::Failed;
+    uint32_t nodesExpanded = 0;
+};
+
+/**
+ * @brief Resumable path search (injected dependency)
+ *
+ * Step() runs on job workers, one call at a time per search; it must keep
+ * its open/closed sets between calls so long searches can be time-sliced.
+ */
+class IncrementalPathSearch {
+public:
+    virtual ~IncrementalPathSearch() = default;
+
+    /**
+     * @brief Expand at most nodeBudget nodes
+     * @param result Filled in when the search finishes with Found
+     */
+    virtual PathSearchStep Step(uint32_t nodeBudget, PathResult& result) = 0;
+};
+
+/**
+ * @brief Creates a resumable search for a start/goal pair (injected dependency)
+ */
+using PathSearchFactory = std::function<std::unique_ptr<IncrementalPathSearch>(const glm::vec3&, const glm::vec3&)>;
+
+/**
+ * @brief Log2-bucketed latency histogram (1 us to ~8 s)
+ */
+struct LatencyHistogram {
+    static constexpr size_t kBucketCount = 24;
+
+    std::array<uint64_t, kBucketCount> buckets{};   // Bucket i counts samples below 2^i us
+    uint64_t count = 0;
+    double totalSeconds = 0.0;
+    double maxSeconds = 0.0;
+
+    void Record(double seconds);
+
+    [[nodiscard]] double GetMean() const { return count > 0 ? totalSeconds / count : 0.0; }
+
+    /**
+     * @brief Upper bound (seconds) of the bucket holding the given percentile (0-1)
+     */
+    [[nodiscard]] double GetPercentile(double percentile) const;
+};
+
 // ============================================================================
 // Hierarchical Path Cache
 // ============================================================================
@@ -121,6 +183,13 @@ struct RegionPath {
  * - Hierarchical pathfinding for distant goals
  * - Async path requests with callback
  * - LRU cache eviction
+ *
+ * Async requests with the same start cell and goal region share one
+ * in-flight search. Update() hands each runnable search one time slice on
+ * the Nova::JobSystem, up to nodeBudgetPerFrame expansions per call; a
+ * slice ends after nodesPerSlice expansions or sliceTimeBudgetMs, whichever
+ * comes first, and unfinished searches are resumed on later frames.
+ * Without an initialized JobSystem slices run inline.
  */
 class PathCache {
 public:
@@ -134,9 +203,11 @@ public:
         float goalTolerance = 1.0f;         // Goals within this are considered same
 
         // Async settings
-        size_t asyncThreadCount = 2;
-        size_t maxQueuedRequests = 100;
+        size_t maxQueuedRequests = 1000;    // Distinct in-flight searches (coalesced requests are free)
         float requestTimeout = 5.0f;        // Seconds before request times out
+        size_t nodeBudgetPerFrame = 20000;  // Node expansions dispatched per Update()
+        uint32_t nodesPerSlice = 2000;      // Expansions per job before a search yields
+        float sliceTimeBudgetMs = 2.0f;     // Wall-clock time per job before a search yields
 
         // Hierarchical settings
         bool enableHierarchical = true;
@@ -217,15 +288,26 @@ public:
 
     /**
      * @brief Process completed async requests (call from main thread)
-     * Invokes callbacks for completed requests
+     * Caches found paths, invokes callbacks and records delivery latency
      */
     void ProcessCompletedRequests();
 
     /**
      * @brief Set the pathfinding function for async requests
+     *
+     * Runs each search to completion in one slice; prefer
+     * SetPathSearchFactory() for long searches.
      */
     void SetPathComputeFunction(PathComputeFunction func);
 
+    /**
+     * @brief Set the resumable search used for async requests
+     *
+     * Takes precedence over the compute function. Called on the thread that
+     * submits the request.
+     */
+    void SetPathSearchFactory(PathSearchFactory factory);
+
     // =========================================================================
     // Path Sharing
     // =========================================================================
@@ -312,7 +394,7 @@ public:
     void PruneExpired(float currentTime);
 
     /**
-     * @brief Update cache (call periodically)
+     * @brief Update cache and dispatch search slices (call once per frame)
      */
     void Update(float currentTime);
 
@@ -327,7 +409,14 @@ public:
         uint64_t asyncRequestsCompleted = 0;
         uint64_t asyncRequestsFailed = 0;
         size_t currentCacheSize = 0;
-        size_t pendingRequests = 0;
+        size_t pendingRequests = 0;         // Distinct in-flight searches
+        uint64_t coalescedRequests = 0;     // Async requests that joined an in-flight search
+        uint64_t searchSlices = 0;          // Time slices run
+
+        // Per-stage latency of delivered async requests
+        LatencyHistogram queuedLatency;     // Submitted -> first slice started
+        LatencyHistogram computeLatency;    // First slice -> search finished
+        LatencyHistogram deliveryLatency;   // Search finished -> callback invoked
 
         [[nodiscard]] float GetHitRate() const {
             uint64_t total = cacheHits + cacheMisses;
@@ -348,6 +437,8 @@ private:
         bool valid = true;
     };
 
+    using Clock = std::chrono::steady_clock;
+
     // Async request
     struct AsyncRequest {
         uint64_t requestId = 0;
@@ -358,6 +449,36 @@ private:
         PathRequestStatus status = PathRequestStatus::Pending;
         PathResult result;
         float submitTime = 0.0f;
+        Clock::time_point queuedAt{};
+        Clock::time_point startedAt{};
+        Clock::time_point finishedAt{};
+    };
+
+    // Quantised start cell and goal region; requests with equal keys share a search
+    struct RequestKey {
+        glm::ivec3 startCell{0};
+        glm::ivec3 goalRegion{0};
+
+        bool operator==(const RequestKey& other) const {
+            return startCell == other.startCell && goalRegion == other.goalRegion;
+        }
+    };
+
+    struct RequestKeyHash {
+        size_t operator()(const RequestKey& key) const noexcept;
+    };
+
+    // One search shared by every request with the same start cell and goal region
+    struct InFlightSearch {
+        RequestKey key;
+        glm::vec3 start{0.0f};
+        glm::vec3 goal{0.0f};
+        std::vector<AsyncRequest> waiters;
+        std::unique_ptr<IncrementalPathSearch> search;
+        PathResult result;
+        float submitTime = 0.0f;
+        Clock::time_point startedAt{};
+        bool started = false;
     };
 
     // Shared path entry
@@ -371,13 +492,16 @@ private:
 
     // Cache key generation
     [[nodiscard]] uint64_t MakeCacheKey(const glm::vec3& start, const glm::vec3& goal) const;
+    [[nodiscard]] RequestKey MakeRequestKey(const glm::vec3& start, const glm::vec3& goal) const;
     [[nodiscard]] glm::ivec3 QuantizePosition(const glm::vec3& pos) const;
 
     // LRU eviction
     void EvictLRU();
 
-    // Worker thread function
-    void WorkerThread();
+    // Async pipeline
+    void DispatchSearches();
+    void RunSlice(InFlightSearch& search);
+    void FinishSearchLocked(InFlightSearch& search, PathRequestStatus status);
 
     Config m_config;
     Stats m_stats;
@@ -387,15 +511,17 @@ private:
     std::unordered_map<uint64_t, CacheEntry> m_cache;
     mutable std::mutex m_cacheMutex;
 
-    // Async request handling
-    std::queue<AsyncRequest> m_pendingRequests;
+    // Async request handling (all guarded by m_requestMutex)
+    std::unordered_map<RequestKey, std::unique_ptr<InFlightSearch>, RequestKeyHash> m_inFlight;
+    std::deque<RequestKey> m_runQueue;                         // Runnable request keys
+    std::unordered_map<uint64_t, RequestKey> m_requestKeys;    // Request ID -> request key
     std::unordered_map<uint64_t, AsyncRequest> m_completedRequests;
-    std::vector<std::thread> m_workers;
-    std::mutex m_requestMutex;
-    std::condition_variable m_requestCondition;
-    std::atomic<bool> m_running{true};
+    uint64_t m_searchSlices = 0;
+    mutable std::mutex m_requestMutex;
+    std::unique_ptr<Nova::JobCounter> m_sliceJobs;
     std::atomic<uint64_t> m_nextRequestId{1};
     PathComputeFunction m_pathComputeFunc;
+    PathSearchFactory m_searchFactory;
 
     // Path sharing
     std::unordered_map<EntityId, SharedPathEntry> m_sharedPaths;
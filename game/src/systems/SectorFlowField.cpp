@@ -0,0 +1,670 @@
+#include "SectorFlowField.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace Vehement {
+namespace Systems {
+
+namespace {
+
+// Neighbor offsets (8-directional), same order as FlowField
+constexpr int kDX[] = {-1, 0, 1, -1, 1, -1, 0, 1};
+constexpr int kDY[] = {-1, -1, -1, 0, 0, 1, 1, 1};
+
+// Integer step costs (straight 5, diagonal 7 ~ 5 * sqrt(2)), scaled by cell cost
+constexpr uint32_t kStraightStep = 5;
+constexpr uint32_t kDiagonalStep = 7;
+
+const glm::vec2 kDirections[8] = {
+    glm::vec2(-0.70710678f, -0.70710678f), glm::vec2(0.0f, -1.0f), glm::vec2(0.70710678f, -0.70710678f),
+    glm::vec2(-1.0f, 0.0f),                                        glm::vec2(1.0f, 0.0f),
+    glm::vec2(-0.70710678f, 0.70710678f),  glm::vec2(0.0f, 1.0f),  glm::vec2(0.70710678f, 0.70710678f),
+};
+
+uint8_t DirectionIndex(const glm::ivec2& offset) {
+    for (uint8_t i = 0; i < 8; ++i) {
+        if (kDX[i] == offset.x && kDY[i] == offset.y) return i;
+    }
+    return SectorFlowFieldManager::kNoDirection;
+}
+
+uint64_t HashCombine(uint64_t hash, uint64_t value) {
+    value *= 0x9e3779b97f4a7c15ull;
+    value ^= value >> 31;
+    return (hash ^ value) * 0xbf58476d1ce4e5b9ull;
+}
+
+uint32_t SaturatingAdd(uint32_t a, uint32_t b) {
+    const uint32_t sum = a + b;
+    return sum < a ? std::numeric_limits<uint32_t>::max() - 1 : sum;
+}
+
+} // namespace
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+SectorFlowFieldManager::SectorFlowFieldManager(const SectorFlowFieldConfig& config)
+    : m_config(config)
+{
+    m_config.sectorSize = std::max(2, m_config.sectorSize);
+    m_sectorsX = (m_config.width + m_config.sectorSize - 1) / m_config.sectorSize;
+    m_sectorsY = (m_config.height + m_config.sectorSize - 1) / m_config.sectorSize;
+
+    m_costs.assign(static_cast<size_t>(m_config.width) * m_config.height, 1);
+    m_sectors.resize(static_cast<size_t>(m_sectorsX) * m_sectorsY);
+
+    // Edges between horizontal neighbors first, then vertical neighbors
+    const size_t edgeCount = static_cast<size_t>(std::max(0, m_sectorsX - 1)) * m_sectorsY +
+                             static_cast<size_t>(m_sectorsX) * std::max(0, m_sectorsY - 1);
+    m_edgePortals.resize(edgeCount);
+    m_edgeDirty.assign(edgeCount, 0);
+
+    const size_t sectorCells = static_cast<size_t>(m_config.sectorSize) * m_config.sectorSize;
+    m_floodCost.resize(sectorCells);
+    m_floodExit.resize(sectorCells);
+
+    for (uint32_t edge = 0; edge < edgeCount; ++edge) {
+        MarkEdgeDirty(edge);
+    }
+    for (uint32_t sector = 0; sector < m_sectors.size(); ++sector) {
+        m_sectors[sector].dirty = true;
+        m_dirtySectors.push_back(sector);
+    }
+    Update();
+}
+
+// ============================================================================
+// Terrain Setup
+// ============================================================================
+
+void SectorFlowFieldManager::SetCellState(int x, int y, CellState state) {
+    switch (state) {
+        case CellState::Blocked:
+            SetCellCost(x, y, kBlockedCost);
+            break;
+        case CellState::Danger:
+            SetCellCost(x, y, static_cast<uint8_t>(std::min(254, 1 + static_cast<int>(m_config.dangerCost))));
+            break;
+        default:
+            SetCellCost(x, y, 1);
+            break;
+    }
+}
+
+void SectorFlowFieldManager::SetCellCost(int x, int y, uint8_t cost) {
+    if (!IsValidGrid(x, y)) return;
+
+    cost = std::max<uint8_t>(cost, 1);
+    uint8_t& cell = m_costs[GetCellIndex(x, y)];
+    if (cell == cost) return;
+
+    cell = cost;
+    MarkCellDirty(x, y);
+}
+
+void SectorFlowFieldManager::FillRect(int x, int y, int width, int height, CellState state) {
+    for (int dy = 0; dy < height; ++dy) {
+        for (int dx = 0; dx < width; ++dx) {
+            SetCellState(x + dx, y + dy, state);
+        }
+    }
+}
+
+bool SectorFlowFieldManager::IsWalkable(int x, int y) const {
+    return IsValidGrid(x, y) && m_costs[GetCellIndex(x, y)] != kBlockedCost;
+}
+
+// ============================================================================
+// Sector Bookkeeping
+// ============================================================================
+
+glm::ivec2 SectorFlowFieldManager::SectorOrigin(uint32_t sector) const {
+    return glm::ivec2(static_cast<int>(sector) % m_sectorsX, static_cast<int>(sector) / m_sectorsX) *
+           m_config.sectorSize;
+}
+
+glm::ivec2 SectorFlowFieldManager::SectorExtent(uint32_t sector) const {
+    const glm::ivec2 origin = SectorOrigin(sector);
+    return glm::ivec2(std::min(m_config.sectorSize, m_config.width - origin.x),
+                      std::min(m_config.sectorSize, m_config.height - origin.y));
+}
+
+int SectorFlowFieldManager::GetSectorIndex(int x, int y) const {
+    if (!IsValidGrid(x, y)) return -1;
+    return (y / m_config.sectorSize) * m_sectorsX + (x / m_config.sectorSize);
+}
+
+uint32_t SectorFlowFieldManager::EdgeBetween(uint32_t sectorA, uint32_t sectorB) const {
+    const uint32_t low = std::min(sectorA, sectorB);
+    const int sx = static_cast<int>(low) % m_sectorsX;
+    const int sy = static_cast<int>(low) / m_sectorsX;
+
+    if (std::max(sectorA, sectorB) == low + 1) {
+        return static_cast<uint32_t>(sy * (m_sectorsX - 1) + sx);
+    }
+    const uint32_t horizontalCount = static_cast<uint32_t>((m_sectorsX - 1) * m_sectorsY);
+    return horizontalCount + static_cast<uint32_t>(sy * m_sectorsX + sx);
+}
+
+std::vector<uint32_t> SectorFlowFieldManager::SectorEdges(uint32_t sector) const {
+    std::vector<uint32_t> edges;
+    const int sx = static_cast<int>(sector) % m_sectorsX;
+    const int sy = static_cast<int>(sector) / m_sectorsX;
+
+    if (sx > 0) edges.push_back(EdgeBetween(sector - 1, sector));
+    if (sx < m_sectorsX - 1) edges.push_back(EdgeBetween(sector, sector + 1));
+    if (sy > 0) edges.push_back(EdgeBetween(sector - m_sectorsX, sector));
+    if (sy < m_sectorsY - 1) edges.push_back(EdgeBetween(sector, sector + m_sectorsX));
+    return edges;
+}
+
+void SectorFlowFieldManager::MarkEdgeDirty(uint32_t edge) {
+    if (!m_edgeDirty[edge]) {
+        m_edgeDirty[edge] = 1;
+        m_dirtyEdges.push_back(edge);
+    }
+}
+
+void SectorFlowFieldManager::MarkCellDirty(int x, int y) {
+    const uint32_t sector = static_cast<uint32_t>(GetSectorIndex(x, y));
+    if (!m_sectors[sector].dirty) {
+        m_sectors[sector].dirty = true;
+        m_dirtySectors.push_back(sector);
+    }
+
+    // Cells on a sector border can change that edge's portals
+    const glm::ivec2 local = glm::ivec2(x, y) - SectorOrigin(sector);
+    const glm::ivec2 extent = SectorExtent(sector);
+    const int sx = static_cast<int>(sector) % m_sectorsX;
+    const int sy = static_cast<int>(sector) / m_sectorsX;
+
+    if (local.x == 0 && sx > 0) MarkEdgeDirty(EdgeBetween(sector - 1, sector));
+    if (local.x == extent.x - 1 && sx < m_sectorsX - 1) MarkEdgeDirty(EdgeBetween(sector, sector + 1));
+    if (local.y == 0 && sy > 0) MarkEdgeDirty(EdgeBetween(sector - m_sectorsX, sector));
+    if (local.y == extent.y - 1 && sy < m_sectorsY - 1) MarkEdgeDirty(EdgeBetween(sector, sector + m_sectorsX));
+}
+
+void SectorFlowFieldManager::Update() {
+    if (m_dirtySectors.empty() && m_dirtyEdges.empty()) {
+        return;
+    }
+
+    const uint32_t horizontalCount = static_cast<uint32_t>((m_sectorsX - 1) * m_sectorsY);
+    std::vector<uint32_t> relink = m_dirtySectors;
+
+    for (uint32_t edge : m_dirtyEdges) {
+        RebuildEdgePortals(edge);
+        m_edgeDirty[edge] = 0;
+
+        uint32_t low;
+        if (edge < horizontalCount) {
+            const int sy = static_cast<int>(edge) / (m_sectorsX - 1);
+            const int sx = static_cast<int>(edge) % (m_sectorsX - 1);
+            low = static_cast<uint32_t>(sy * m_sectorsX + sx);
+            relink.push_back(low + 1);
+        } else {
+            low = edge - horizontalCount;
+            relink.push_back(low + static_cast<uint32_t>(m_sectorsX));
+        }
+        relink.push_back(low);
+    }
+
+    std::sort(relink.begin(), relink.end());
+    relink.erase(std::unique(relink.begin(), relink.end()), relink.end());
+    for (uint32_t sector : relink) {
+        RebuildSectorLinks(sector);
+        m_sectors[sector].dirty = false;
+        ++m_sectors[sector].version;
+    }
+
+    m_dirtySectors.clear();
+    m_dirtyEdges.clear();
+    m_lastRebuiltSectors = relink.size();
+    ++m_graphVersion;
+}
+
+void SectorFlowFieldManager::RebuildEdgePortals(uint32_t edge) {
+    std::vector<uint32_t>& portals = m_edgePortals[edge];
+    for (uint32_t id : portals) {
+        m_portals[id] = Portal{};
+        m_freePortals.push_back(id);
+    }
+    portals.clear();
+
+    const uint32_t horizontalCount = static_cast<uint32_t>((m_sectorsX - 1) * m_sectorsY);
+    uint32_t sectorA;
+    uint32_t sectorB;
+    glm::ivec2 startA;
+    glm::ivec2 step;
+    glm::ivec2 normal;
+    int span;
+
+    if (edge < horizontalCount) {
+        const int sy = static_cast<int>(edge) / (m_sectorsX - 1);
+        const int sx = static_cast<int>(edge) % (m_sectorsX - 1);
+        sectorA = static_cast<uint32_t>(sy * m_sectorsX + sx);
+        sectorB = sectorA + 1;
+        startA = SectorOrigin(sectorA) + glm::ivec2(SectorExtent(sectorA).x - 1, 0);
+        step = glm::ivec2(0, 1);
+        normal = glm::ivec2(1, 0);
+        span = SectorExtent(sectorA).y;
+    } else {
+        sectorA = edge - horizontalCount;
+        sectorB = sectorA + static_cast<uint32_t>(m_sectorsX);
+        startA = SectorOrigin(sectorA) + glm::ivec2(0, SectorExtent(sectorA).y - 1);
+        step = glm::ivec2(1, 0);
+        normal = glm::ivec2(0, 1);
+        span = SectorExtent(sectorA).x;
+    }
+
+    // Maximal runs where both sides are walkable become portals
+    int runStart = -1;
+    for (int i = 0; i <= span; ++i) {
+        bool open = false;
+        if (i < span) {
+            const glm::ivec2 a = startA + step * i;
+            const glm::ivec2 b = a + normal;
+            open = IsWalkable(a.x, a.y) && IsWalkable(b.x, b.y);
+        }
+
+        if (open && runStart < 0) {
+            runStart = i;
+        } else if (!open && runStart >= 0) {
+            uint32_t id;
+            if (!m_freePortals.empty()) {
+                id = m_freePortals.back();
+                m_freePortals.pop_back();
+            } else {
+                id = static_cast<uint32_t>(m_portals.size());
+                m_portals.emplace_back();
+            }
+
+            Portal& portal = m_portals[id];
+            portal.sector[0] = sectorA;
+            portal.sector[1] = sectorB;
+            portal.start[0] = startA + step * runStart;
+            portal.start[1] = portal.start[0] + normal;
+            portal.step = step;
+            portal.length = i - runStart;
+            portals.push_back(id);
+            runStart = -1;
+        }
+    }
+}
+
+void SectorFlowFieldManager::RebuildSectorLinks(uint32_t sectorId) {
+    Sector& sector = m_sectors[sectorId];
+    sector.portals.clear();
+    for (uint32_t edge : SectorEdges(sectorId)) {
+        sector.portals.insert(sector.portals.end(), m_edgePortals[edge].begin(), m_edgePortals[edge].end());
+    }
+
+    const glm::ivec2 origin = SectorOrigin(sectorId);
+    for (uint32_t id : sector.portals) {
+        Portal& portal = m_portals[id];
+        const int side = portal.sector[0] == sectorId ? 0 : 1;
+        portal.links[side].clear();
+
+        m_seeds.clear();
+        m_seeds.push_back({portal.Center(side), 0, kNoDirection});
+        FloodSector(sectorId, m_seeds);
+
+        for (uint32_t otherId : sector.portals) {
+            if (otherId == id) continue;
+            const Portal& other = m_portals[otherId];
+            const glm::ivec2 local = other.Center(other.sector[0] == sectorId ? 0 : 1) - origin;
+            const uint32_t cost = m_floodCost[static_cast<size_t>(local.y) * m_config.sectorSize + local.x];
+            if (cost != kUnreachable) {
+                portal.links[side].push_back({otherId, cost});
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Integration
+// ============================================================================
+
+void SectorFlowFieldManager::FloodSector(uint32_t sector, const std::vector<Seed>& seeds) {
+    const glm::ivec2 origin = SectorOrigin(sector);
+    const glm::ivec2 extent = SectorExtent(sector);
+    const int stride = m_config.sectorSize;
+
+    std::fill(m_floodCost.begin(), m_floodCost.end(), kUnreachable);
+    std::fill(m_floodExit.begin(), m_floodExit.end(), kNoDirection);
+    m_floodHeap.clear();
+
+    auto walkable = [&](int lx, int ly) {
+        return lx >= 0 && ly >= 0 && lx < extent.x && ly < extent.y &&
+               m_costs[GetCellIndex(origin.x + lx, origin.y + ly)] != kBlockedCost;
+    };
+
+    for (const Seed& seed : seeds) {
+        const glm::ivec2 local = seed.cell - origin;
+        const uint32_t index = static_cast<uint32_t>(local.y * stride + local.x);
+        if (!walkable(local.x, local.y) || seed.cost >= m_floodCost[index]) continue;
+        m_floodCost[index] = seed.cost;
+        m_floodExit[index] = seed.exitDirection;
+        m_floodHeap.emplace_back(seed.cost, index);
+    }
+    std::make_heap(m_floodHeap.begin(), m_floodHeap.end(), std::greater<>());
+
+    // Dijkstra inside the sector; diagonals may not cut blocked corners
+    while (!m_floodHeap.empty()) {
+        std::pop_heap(m_floodHeap.begin(), m_floodHeap.end(), std::greater<>());
+        const auto [cost, index] = m_floodHeap.back();
+        m_floodHeap.pop_back();
+        if (cost > m_floodCost[index]) continue;
+
+        const int lx = static_cast<int>(index) % stride;
+        const int ly = static_cast<int>(index) / stride;
+
+        for (int i = 0; i < 8; ++i) {
+            const int nx = lx + kDX[i];
+            const int ny = ly + kDY[i];
+            if (!walkable(nx, ny)) continue;
+
+            const bool diagonal = kDX[i] != 0 && kDY[i] != 0;
+            if (diagonal && (!walkable(lx + kDX[i], ly) || !walkable(lx, ly + kDY[i]))) continue;
+
+            const uint32_t neighbor = static_cast<uint32_t>(ny * stride + nx);
+            const uint32_t stepCost = (diagonal ? kDiagonalStep : kStraightStep) *
+                m_costs[GetCellIndex(origin.x + nx, origin.y + ny)];
+            const uint32_t total = SaturatingAdd(cost, stepCost);
+
+            if (total < m_floodCost[neighbor]) {
+                m_floodCost[neighbor] = total;
+                m_floodExit[neighbor] = kNoDirection;
+                m_floodHeap.emplace_back(total, neighbor);
+                std::push_heap(m_floodHeap.begin(), m_floodHeap.end(), std::greater<>());
+            }
+        }
+    }
+}
+
+void SectorFlowFieldManager::StoreField(uint32_t sector, SectorField& field) {
+    const glm::ivec2 extent = SectorExtent(sector);
+    const int stride = m_config.sectorSize;
+    const size_t cells = static_cast<size_t>(stride) * stride;
+
+    field.integration.assign(cells, std::numeric_limits<uint16_t>::max());
+    field.directions.assign(cells, kNoDirection);
+
+    uint32_t base = kUnreachable;
+    for (uint32_t cost : m_floodCost) base = std::min(base, cost);
+    if (base == kUnreachable) return;
+
+    auto floodAt = [&](int lx, int ly) {
+        if (lx < 0 || ly < 0 || lx >= extent.x || ly >= extent.y) return kUnreachable;
+        return m_floodCost[static_cast<size_t>(ly) * stride + lx];
+    };
+
+    for (int ly = 0; ly < extent.y; ++ly) {
+        for (int lx = 0; lx < extent.x; ++lx) {
+            const size_t index = static_cast<size_t>(ly) * stride + lx;
+            const uint32_t cost = m_floodCost[index];
+            if (cost == kUnreachable) continue;
+
+            field.integration[index] = static_cast<uint16_t>(std::min<uint32_t>(cost - base, 0xFFFE));
+
+            if (m_floodExit[index] != kNoDirection) {
+                field.directions[index] = m_floodExit[index];
+                continue;
+            }
+
+            // Steepest descent, with the same corner rule as the flood
+            uint32_t best = cost;
+            for (uint8_t i = 0; i < 8; ++i) {
+                const uint32_t neighborCost = floodAt(lx + kDX[i], ly + kDY[i]);
+                if (neighborCost >= best) continue;
+                if (kDX[i] != 0 && kDY[i] != 0 &&
+                    (floodAt(lx + kDX[i], ly) == kUnreachable || floodAt(lx, ly + kDY[i]) == kUnreachable)) {
+                    continue;
+                }
+                best = neighborCost;
+                field.directions[index] = i;
+            }
+        }
+    }
+
+    ++m_sectorFieldsBuilt;
+}
+
+// ============================================================================
+// Route Layer
+// ============================================================================
+
+SectorFlowFieldManager::RouteField& SectorFlowFieldManager::GetRoute(const std::vector<glm::ivec2>& goals,
+                                                                     const std::vector<uint32_t>& goalSectors) {
+    uint64_t key = 0x5ec70ull;
+    for (const glm::ivec2& goal : goals) {
+        key = HashCombine(key, (static_cast<uint64_t>(goal.x) << 32) | static_cast<uint32_t>(goal.y));
+    }
+
+    auto it = m_routes.find(key);
+    if (it != m_routes.end() && it->second.goals == goals) {
+        ++m_cacheHits;
+        it->second.lastAccess = ++m_accessCounter;
+        return it->second;
+    }
+
+    ++m_cacheMisses;
+    if (it != m_routes.end()) {
+        m_routes.erase(it);
+    }
+    while (m_routes.size() >= m_config.maxCachedFields) {
+        EvictLRU(m_routes);
+    }
+
+    RouteField& route = m_routes[key];
+    route.goals = goals;
+    route.goalSectors = goalSectors;
+    route.lastAccess = ++m_accessCounter;
+    ComputeRoute(route);
+    return route;
+}
+
+void SectorFlowFieldManager::ComputeRoute(RouteField& route) {
+    route.portalDistance.assign(m_portals.size(), kUnreachable);
+    route.portalVia.assign(m_portals.size(), kInvalid);
+    route.graphVersion = m_graphVersion;
+
+    // Seed goal-sector portals with their distance to the goals inside the
+    // sector, taken at the portal cell nearest to a goal. Portals walled off
+    // from every goal stay unreachable from this side.
+    m_portalHeap.clear();
+    for (uint32_t goalSector : route.goalSectors) {
+        m_seeds.clear();
+        for (const glm::ivec2& goal : route.goals) {
+            if (GetSectorIndex(goal.x, goal.y) == static_cast<int>(goalSector)) {
+                m_seeds.push_back({goal, 0, kNoDirection});
+            }
+        }
+        FloodSector(goalSector, m_seeds);
+
+        const glm::ivec2 origin = SectorOrigin(goalSector);
+        for (uint32_t id : m_sectors[goalSector].portals) {
+            const Portal& portal = m_portals[id];
+            const int side = portal.sector[0] == goalSector ? 0 : 1;
+            uint32_t distance = kUnreachable;
+            for (int i = 0; i < portal.length; ++i) {
+                const glm::ivec2 local = portal.start[side] + portal.step * i - origin;
+                distance = std::min(distance, m_floodCost[static_cast<size_t>(local.y) * m_config.sectorSize + local.x]);
+            }
+            if (distance < route.portalDistance[id]) {
+                route.portalDistance[id] = distance;
+                route.portalVia[id] = goalSector;
+                m_portalHeap.emplace_back(distance, id);
+            }
+        }
+    }
+    std::make_heap(m_portalHeap.begin(), m_portalHeap.end(), std::greater<>());
+
+    while (!m_portalHeap.empty()) {
+        std::pop_heap(m_portalHeap.begin(), m_portalHeap.end(), std::greater<>());
+        const auto [distance, id] = m_portalHeap.back();
+        m_portalHeap.pop_back();
+        if (distance > route.portalDistance[id]) continue;
+
+        const Portal& portal = m_portals[id];
+        for (int side = 0; side < 2; ++side) {
+            for (const PortalLink& link : portal.links[side]) {
+                const uint32_t total = SaturatingAdd(distance, link.cost);
+                if (total < route.portalDistance[link.portal]) {
+                    route.portalDistance[link.portal] = total;
+                    route.portalVia[link.portal] = portal.sector[side];
+                    m_portalHeap.emplace_back(total, link.portal);
+                    std::push_heap(m_portalHeap.begin(), m_portalHeap.end(), std::greater<>());
+                }
+            }
+        }
+    }
+}
+
+const SectorFlowFieldManager::SectorField& SectorFlowFieldManager::GetRouteSectorField(
+    RouteField& route, uint32_t sector) {
+
+    if (route.graphVersion != m_graphVersion) {
+        ComputeRoute(route);
+    }
+
+    auto [it, inserted] = route.sectors.try_emplace(sector);
+    SectorField& field = it->second;
+    if (!inserted && field.graphVersion == m_graphVersion) {
+        return field;
+    }
+
+    // Goal cells of this sector, then every portal whose route continues
+    // into the neighboring sector (in a goal sector: out and back in again)
+    m_seeds.clear();
+    uint64_t seedKey = HashCombine(0x5eedull, m_sectors[sector].version);
+    for (const glm::ivec2& goal : route.goals) {
+        if (GetSectorIndex(goal.x, goal.y) == static_cast<int>(sector)) {
+            m_seeds.push_back({goal, 0, kNoDirection});
+        }
+    }
+    for (uint32_t id : m_sectors[sector].portals) {
+        const uint32_t distance = route.portalDistance[id];
+        if (distance == kUnreachable || route.portalVia[id] == sector) continue;
+
+        const Portal& portal = m_portals[id];
+        const int side = portal.sector[0] == sector ? 0 : 1;
+        const uint8_t exit = DirectionIndex(portal.start[1 - side] - portal.start[side]);
+        for (int i = 0; i < portal.length; ++i) {
+            m_seeds.push_back({portal.start[side] + portal.step * i, distance, exit});
+        }
+        seedKey = HashCombine(HashCombine(seedKey, id), distance);
+    }
+
+    // Graph changed elsewhere but this sector's inputs did not
+    if (!inserted && field.seedKey == seedKey) {
+        field.graphVersion = m_graphVersion;
+        return field;
+    }
+
+    FloodSector(sector, m_seeds);
+    StoreField(sector, field);
+    field.seedKey = seedKey;
+    field.graphVersion = m_graphVersion;
+    return field;
+}
+
+template<typename Cache>
+void SectorFlowFieldManager::EvictLRU(Cache& cache) {
+    if (cache.empty()) return;
+
+    auto lru = cache.begin();
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if (it->second.lastAccess < lru->second.lastAccess) {
+            lru = it;
+        }
+    }
+    cache.erase(lru);
+}
+
+// ============================================================================
+// Flow Queries
+// ============================================================================
+
+glm::vec2 SectorFlowFieldManager::GetFlowDirection(const glm::vec2& worldPos, const glm::vec2& goalWorld) {
+    return GetFlowDirection(worldPos, std::span<const glm::vec2>(&goalWorld, 1));
+}
+
+glm::vec2 SectorFlowFieldManager::GetFlowDirection(const glm::vec2& worldPos,
+                                                   std::span<const glm::vec2> goalsWorld) {
+    Update();
+
+    const glm::ivec2 cell = WorldToGrid(worldPos);
+    if (!IsWalkable(cell.x, cell.y)) {
+        return glm::vec2(0.0f);
+    }
+
+    m_goalCells.clear();
+    m_goalSectors.clear();
+    for (const glm::vec2& goal : goalsWorld) {
+        const glm::ivec2 goalCell = WorldToGrid(goal);
+        if (IsWalkable(goalCell.x, goalCell.y)) {
+            m_goalCells.push_back(goalCell);
+            m_goalSectors.push_back(static_cast<uint32_t>(GetSectorIndex(goalCell.x, goalCell.y)));
+        }
+    }
+    if (m_goalCells.empty()) {
+        return glm::vec2(0.0f);
+    }
+
+    std::sort(m_goalCells.begin(), m_goalCells.end(), [](const glm::ivec2& a, const glm::ivec2& b) {
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    });
+    m_goalCells.erase(std::unique(m_goalCells.begin(), m_goalCells.end()), m_goalCells.end());
+    std::sort(m_goalSectors.begin(), m_goalSectors.end());
+    m_goalSectors.erase(std::unique(m_goalSectors.begin(), m_goalSectors.end()), m_goalSectors.end());
+
+    const uint32_t sector = static_cast<uint32_t>(GetSectorIndex(cell.x, cell.y));
+    const glm::ivec2 local = cell - SectorOrigin(sector);
+    const size_t index = static_cast<size_t>(local.y) * m_config.sectorSize + local.x;
+
+    const SectorField& field = GetRouteSectorField(GetRoute(m_goalCells, m_goalSectors), sector);
+
+    const uint8_t direction = field.directions[index];
+    return direction == kNoDirection ? glm::vec2(0.0f) : kDirections[direction];
+}
+
+size_t SectorFlowFieldManager::GetFieldMemoryUsage() const {
+    size_t bytes = 0;
+    auto add = [&bytes](const std::unordered_map<uint32_t, SectorField>& sectors) {
+        for (const auto& [sector, field] : sectors) {
+            bytes += field.integration.size() * sizeof(uint16_t) + field.directions.size();
+        }
+    };
+    for (const auto& [key, route] : m_routes) add(route.sectors);
+    return bytes;
+}
+
+// ============================================================================
+// Coordinate Conversion
+// ============================================================================
+
+glm::ivec2 SectorFlowFieldManager::WorldToGrid(const glm::vec2& worldPos) const {
+    glm::vec2 local = worldPos - m_config.origin;
+    return glm::ivec2(
+        static_cast<int>(std::floor(local.x / m_config.cellSize)),
+        static_cast<int>(std::floor(local.y / m_config.cellSize))
+    );
+}
+
+glm::vec2 SectorFlowFieldManager::GridToWorld(int x, int y) const {
+    return m_config.origin + glm::vec2(
+        (x + 0.5f) * m_config.cellSize,
+        (y + 0.5f) * m_config.cellSize
+    );
+}
+
+bool SectorFlowFieldManager::IsValidGrid(int x, int y) const {
+    return x >= 0 && x < m_config.width && y >= 0 && y < m_config.height;
+}
+
+} // namespace Systems
+} // namespace Vehement
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "FlowField.hpp"
+#include <glm/glm.hpp>
+#include <vector>
+#include <span>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+
+namespace Vehement {
+namespace Systems {
+
+/**
+ * @brief Configuration for the sectorised flow field manager
+ */
+struct SectorFlowFieldConfig {
+    int width = 1024;             // Grid width in cells
+    int height = 1024;            // Grid height in cells
+    float cellSize = 1.0f;        // World units per cell
+    glm::vec2 origin{0.0f};       // World position of grid origin
+
+    int sectorSize = 32;          // Sector edge length in cells
+    uint8_t dangerCost = 10;      // Extra cost of Danger cells (Walkable = 1)
+    size_t maxCachedFields = 32;  // Cached routes (LRU)
+};
+
+// ============================================================================
+// Sector Flow Field Manager - Lazy, Cached Fields for Large Maps
+// ============================================================================
+
+/**
+ * @brief Sectorised, lazily evaluated flow fields shared by many move orders
+ *
+ * The map is split into square sectors. Walkable runs along each shared
+ * sector edge form portals, and portal-to-portal costs inside every sector
+ * are precomputed. A move order resolves to a route cached by its goal
+ * cells, so all units sent to the same goals share it:
+ * - Each goal-sector portal is seeded with its distance to the goals inside
+ *   that sector; portals cut off from the goals (e.g. by an internal wall)
+ *   stay unreachable, so the route reaches them around the wall instead.
+ * - A portal-graph Dijkstra spreads those distances over the whole map.
+ * - Sector fields along the route are integrated on first use. Goal sectors
+ *   are flooded from the goal cells and from any of their portals whose
+ *   route leads out and back in, so no walkable cell is left stranded.
+ *
+ * Per cell the map stores a u8 cost; a computed sector field stores a u16
+ * integration value and a packed u8 direction. Terrain edits rebuild only
+ * the portals and costs of the touched sectors (and their edge neighbors);
+ * cached fields revalidate lazily against sector versions and portal seeds.
+ */
+class SectorFlowFieldManager {
+public:
+    static constexpr uint8_t kBlockedCost = 255;
+    static constexpr uint8_t kNoDirection = 8;
+
+    explicit SectorFlowFieldManager(const SectorFlowFieldConfig& config);
+    ~SectorFlowFieldManager() = default;
+
+    // Non-copyable, movable
+    SectorFlowFieldManager(const SectorFlowFieldManager&) = delete;
+    SectorFlowFieldManager& operator=(const SectorFlowFieldManager&) = delete;
+    SectorFlowFieldManager(SectorFlowFieldManager&&) noexcept = default;
+    SectorFlowFieldManager& operator=(SectorFlowFieldManager&&) noexcept = default;
+
+    // =========================================================================
+    // Terrain Setup
+    // =========================================================================
+
+    /**
+     * @brief Set cell state at grid coordinates (Goal is treated as Walkable)
+     */
+    void SetCellState(int x, int y, CellState state);
+
+    /**
+     * @brief Set raw cell cost (1-254, or kBlockedCost)
+     */
+    void SetCellCost(int x, int y, uint8_t cost);
+
+    /**
+     * @brief Fill rectangle with state
+     */
+    void FillRect(int x, int y, int width, int height, CellState state);
+
+    /**
+     * @brief Rebuild portals and intra-sector costs of edited sectors
+     *
+     * Called implicitly by queries; call explicitly to control when the
+     * work happens (e.g. once per frame after building placement).
+     */
+    void Update();
+
+    // =========================================================================
+    // Flow Queries
+    // =========================================================================
+
+    /**
+     * @brief Get flow direction toward a goal
+     * @param worldPos Unit position in world coordinates
+     * @param goalWorld Goal position in world coordinates
+     * @return Normalized direction, or zero at the goal / when unreachable
+     */
+    [[nodiscard]] glm::vec2 GetFlowDirection(const glm::vec2& worldPos, const glm::vec2& goalWorld);
+
+    /**
+     * @brief Get flow direction toward the nearest of several goals
+     */
+    [[nodiscard]] glm::vec2 GetFlowDirection(const glm::vec2& worldPos,
+                                              std::span<const glm::vec2> goalsWorld);
+
+    /**
+     * @brief Check if a cell is walkable
+     */
+    [[nodiscard]] bool IsWalkable(int x, int y) const;
+
+    // =========================================================================
+    // Coordinate Conversion
+    // =========================================================================
+
+    [[nodiscard]] glm::ivec2 WorldToGrid(const glm::vec2& worldPos) const;
+    [[nodiscard]] glm::vec2 GridToWorld(int x, int y) const;
+    [[nodiscard]] bool IsValidGrid(int x, int y) const;
+    [[nodiscard]] int GetSectorIndex(int x, int y) const;
+
+    [[nodiscard]] const SectorFlowFieldConfig& GetConfig() const { return m_config; }
+
+    // =========================================================================
+    // Statistics
+    // =========================================================================
+
+    [[nodiscard]] size_t GetSectorCount() const { return m_sectors.size(); }
+    [[nodiscard]] size_t GetPortalCount() const { return m_portals.size() - m_freePortals.size(); }
+    [[nodiscard]] size_t GetCachedRouteCount() const { return m_routes.size(); }
+    [[nodiscard]] size_t GetCacheHits() const { return m_cacheHits; }
+    [[nodiscard]] size_t GetCacheMisses() const { return m_cacheMisses; }
+
+    /**
+     * @brief Sector fields integrated so far (route and goal layers)
+     */
+    [[nodiscard]] size_t GetSectorFieldsBuilt() const { return m_sectorFieldsBuilt; }
+
+    /**
+     * @brief Sectors whose portals/costs the last Update() recomputed
+     */
+    [[nodiscard]] size_t GetLastRebuiltSectorCount() const { return m_lastRebuiltSectors; }
+
+    /**
+     * @brief Bytes held by cached sector fields
+     */
+    [[nodiscard]] size_t GetFieldMemoryUsage() const;
+
+private:
+    static constexpr uint32_t kUnreachable = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+
+    struct PortalLink {
+        uint32_t portal;
+        uint32_t cost;
+    };
+
+    /**
+     * @brief Walkable window on the edge between two sectors
+     *
+     * Side 0 is the left/top sector, side 1 the right/bottom one. Cells of
+     * both sides run from start[side] along `step` for `length` cells.
+     */
+    struct Portal {
+        uint32_t sector[2] = {kInvalid, kInvalid};
+        glm::ivec2 start[2]{};
+        glm::ivec2 step{0};
+        int length = 0;
+        std::vector<PortalLink> links[2];   // Portals reachable inside sector[side]
+
+        [[nodiscard]] glm::ivec2 Center(int side) const { return start[side] + step * (length / 2); }
+    };
+
+    struct Sector {
+        std::vector<uint32_t> portals;
+        uint32_t version = 0;
+        bool dirty = false;
+    };
+
+    /**
+     * @brief Integrated field for one sector (u16 integration + packed direction)
+     */
+    struct SectorField {
+        std::vector<uint16_t> integration;
+        std::vector<uint8_t> directions;
+        uint64_t seedKey = 0;
+        uint64_t graphVersion = 0;
+    };
+
+    /**
+     * @brief Portal-graph distances to a set of goal cells
+     */
+    struct RouteField {
+        std::vector<glm::ivec2> goals;
+        std::vector<uint32_t> goalSectors;
+        std::vector<uint32_t> portalDistance;
+        std::vector<uint32_t> portalVia;    // Sector the route continues into from each portal
+        uint64_t graphVersion = 0;
+        uint64_t lastAccess = 0;
+        std::unordered_map<uint32_t, SectorField> sectors;
+    };
+
+    struct Seed {
+        glm::ivec2 cell;
+        uint32_t cost;
+        uint8_t exitDirection;
+    };
+
+    [[nodiscard]] size_t GetCellIndex(int x, int y) const {
+        return static_cast<size_t>(y) * static_cast<size_t>(m_config.width) + static_cast<size_t>(x);
+    }
+    [[nodiscard]] glm::ivec2 SectorOrigin(uint32_t sector) const;
+    [[nodiscard]] glm::ivec2 SectorExtent(uint32_t sector) const;
+
+    void MarkCellDirty(int x, int y);
+    void MarkEdgeDirty(uint32_t edge);
+    void RebuildEdgePortals(uint32_t edge);
+    void RebuildSectorLinks(uint32_t sector);
+    [[nodiscard]] uint32_t EdgeBetween(uint32_t sectorA, uint32_t sectorB) const;
+    [[nodiscard]] std::vector<uint32_t> SectorEdges(uint32_t sector) const;
+
+    void FloodSector(uint32_t sector, const std::vector<Seed>& seeds);
+    void StoreField(uint32_t sector, SectorField& field);
+
+    RouteField& GetRoute(const std::vector<glm::ivec2>& goals, const std::vector<uint32_t>& goalSectors);
+    void ComputeRoute(RouteField& route);
+    const SectorField& GetRouteSectorField(RouteField& route, uint32_t sector);
+
+    template<typename Cache>
+    void EvictLRU(Cache& cache);
+
+    SectorFlowFieldConfig m_config;
+    int m_sectorsX = 0;
+    int m_sectorsY = 0;
+
+    std::vector<uint8_t> m_costs;
+    std::vector<Sector> m_sectors;
+    std::vector<std::vector<uint32_t>> m_edgePortals;   // Portal IDs per sector edge
+    std::vector<uint8_t> m_edgeDirty;
+    std::vector<uint32_t> m_dirtyEdges;
+    std::vector<Portal> m_portals;
+    std::vector<uint32_t> m_freePortals;
+    std::vector<uint32_t> m_dirtySectors;
+    uint64_t m_graphVersion = 1;
+
+    std::unordered_map<uint64_t, RouteField> m_routes;
+    uint64_t m_accessCounter = 0;
+
+    // Scratch for sector floods, indexed by local cell (sectorSize^2)
+    std::vector<uint32_t> m_floodCost;
+    std::vector<uint8_t> m_floodExit;
+    std::vector<std::pair<uint32_t, uint32_t>> m_floodHeap;
+    std::vector<std::pair<uint32_t, uint32_t>> m_portalHeap;
+    std::vector<Seed> m_seeds;
+    std::vector<glm::ivec2> m_goalCells;
+    std::vector<uint32_t> m_goalSectors;
+
+    size_t m_cacheHits = 0;
+    size_t m_cacheMisses = 0;
+    size_t m_sectorFieldsBuilt = 0;
+    size_t m_lastRebuiltSectors = 0;
+};
+
+} // namespace Systems
+} // namespace Vehement
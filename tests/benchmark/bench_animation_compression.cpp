@@ -0,0 +1,187 @@
+/**
+ * @file bench_animation_compression.cpp
+ * @brief Decode cost of compressed clips against full-precision keyframes
+ *
+ * One 60-bone, 2 second clip with 60 fps source keys, sampled forward at
+ * 60 Hz as a playing character would. Compared:
+ * - Animation::EvaluateInto: full keyframes, name-keyed matrices
+ * - ClipBinding::Sample: full keyframes, bone-indexed pose
+ * - CompressedClipSampler::Sample: segmented, quantised clip
+ * - CompressedClipSampler after random seeks (no cursor reuse)
+ *
+ * items/s counts decoded bones. The compressed variants also report the
+ * clip's size and its ratio against the source keyframes.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "animation/Animation.hpp"
+#include "animation/CompressedClip.hpp"
+#include "animation/Pose.hpp"
+#include "animation/Skeleton.hpp"
+#include "import/AnimationCompressor.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr size_t kBoneCount = 60;
+constexpr float kSourceRate = 60.0f;
+constexpr float kDuration = 2.0f;
+constexpr float kDeltaTime = 1.0f / 60.0f;
+
+std::string BoneName(size_t index) {
+    return "Bone" + std::to_string(index);
+}
+
+Skeleton BuildRig() {
+    SkeletonBuilder builder;
+    for (size_t i = 0; i < kBoneCount; ++i) {
+        builder.AddBone(BoneName(i), i == 0 ? "" : BoneName((i - 1) / 2), glm::mat4(1.0f),
+                        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.1f, 0.0f)));
+    }
+    return builder.Build();
+}
+
+ImportedClip BuildSourceClip() {
+    ImportedClip clip;
+    clip.name = "Run";
+    clip.duration = kDuration;
+
+    const int frames = static_cast<int>(kDuration * kSourceRate) + 1;
+    for (size_t bone = 0; bone < kBoneCount; ++bone) {
+        ImportedChannel channel;
+        channel.boneName = BoneName(bone);
+        for (int f = 0; f < frames; ++f) {
+            const float t = static_cast<float>(f) / kSourceRate;
+            const float phase = t * 3.0f + static_cast<float>(bone) * 0.7f;
+
+            ImportedKeyframe key;
+            key.time = t;
+            key.position = glm::vec3(0.0f, 0.1f, 0.0f);
+            if (bone == 0 || bone % 7 == 0) {
+                key.position += glm::vec3(0.3f * std::sin(phase), 0.05f * std::sin(2.0f * phase), t * 0.5f);
+            }
+            key.rotation = glm::angleAxis(0.6f * std::sin(phase), glm::normalize(glm::vec3(1.0f, 0.3f, 0.1f))) *
+                           glm::angleAxis(0.3f * std::cos(1.3f * phase), glm::vec3(0.0f, 0.0f, 1.0f));
+            key.scale = glm::vec3(1.0f);
+            channel.keyframes.push_back(key);
+        }
+        clip.channels.push_back(std::move(channel));
+    }
+    return clip;
+}
+
+Animation ToAnimation(const ImportedClip& source) {
+    Animation animation(source.name);
+    animation.SetDuration(source.duration);
+    for (const auto& imported : source.channels) {
+        AnimationChannel channel;
+        channel.nodeName = imported.boneName;
+        for (const auto& key : imported.keyframes) {
+            channel.keyframes.push_back({key.time, key.position, key.rotation, key.scale});
+        }
+        animation.AddChannel(channel);
+    }
+    return animation;
+}
+
+CompressedClip Compress(const ImportedClip& source, ClipCompressionStats& stats) {
+    ClipCompressionSettings settings;
+    settings.sampleRate = kSourceRate;
+    settings.rotationTolerance = 1.0e-6f;
+    return AnimationCompressor(settings).Compress(source, &stats);
+}
+
+float Advance(float time) {
+    time += kDeltaTime;
+    return time > kDuration ? time - kDuration : time;
+}
+
+} // namespace
+
+static void BM_Clip_EvaluateMatrices(benchmark::State& state) {
+    const Animation animation = ToAnimation(BuildSourceClip());
+    std::unordered_map<std::string, glm::mat4> transforms;
+    float time = 0.0f;
+
+    for (auto _ : state) {
+        animation.EvaluateInto(time, transforms);
+        benchmark::DoNotOptimize(transforms);
+        time = Advance(time);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBoneCount);
+}
+BENCHMARK(BM_Clip_EvaluateMatrices);
+
+static void BM_Clip_BindingSample(benchmark::State& state) {
+    const Animation animation = ToAnimation(BuildSourceClip());
+    const Skeleton skeleton = BuildRig();
+    const ClipBinding binding(animation, skeleton);
+    std::vector<uint32_t> cursors(kBoneCount, 0);
+    Pose pose;
+    float time = 0.0f;
+
+    for (auto _ : state) {
+        binding.Sample(time, pose, cursors);
+        benchmark::DoNotOptimize(pose.Data(Pose::RotationW));
+        time = Advance(time);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBoneCount);
+    state.counters["bytes"] = static_cast<double>(kBoneCount * (kDuration * kSourceRate + 1) * sizeof(Keyframe));
+}
+BENCHMARK(BM_Clip_BindingSample);
+
+static void BM_Clip_CompressedSample(benchmark::State& state) {
+    ClipCompressionStats stats;
+    const CompressedClip clip = Compress(BuildSourceClip(), stats);
+    const Skeleton skeleton = BuildRig();
+    CompressedClipSampler sampler(clip, skeleton);
+    Pose pose;
+    float time = 0.0f;
+
+    for (auto _ : state) {
+        sampler.Sample(time, pose);
+        benchmark::DoNotOptimize(pose.Data(Pose::RotationW));
+        time = Advance(time);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBoneCount);
+    state.counters["bytes"] = static_cast<double>(stats.compressedBytes);
+    state.counters["ratio"] = stats.GetRatio();
+}
+BENCHMARK(BM_Clip_CompressedSample);
+
+static void BM_Clip_CompressedRandomSeek(benchmark::State& state) {
+    ClipCompressionStats stats;
+    const CompressedClip clip = Compress(BuildSourceClip(), stats);
+    const Skeleton skeleton = BuildRig();
+    CompressedClipSampler sampler(clip, skeleton);
+    Pose pose;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> times(0.0f, kDuration);
+    std::vector<float> seeks(1024);
+    for (float& t : seeks) {
+        t = times(rng);
+    }
+    size_t next = 0;
+
+    for (auto _ : state) {
+        sampler.Sample(seeks[next++ & 1023], pose);
+        benchmark::DoNotOptimize(pose.Data(Pose::RotationW));
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBoneCount);
+}
+BENCHMARK(BM_Clip_CompressedRandomSeek);
@@ -0,0 +1,207 @@
+/**
+ * @file bench_animation_pose.cpp
+ * @brief Characters animated per millisecond: name-keyed matrices vs bone-indexed SoA poses
+ *
+ * Every character has a 60-bone rig and three layers: a walk/run crossfade
+ * on the base layer, an upper-body wave masked to the spine branch, and an
+ * additive lean. Each iteration advances every character one frame and
+ * writes its skinning matrices.
+ *
+ * The legacy side is what AnimationController used to do: evaluate every
+ * clip into a string-keyed map of matrices, blend matrices per bone name and
+ * let the skeleton look each bone up again to build the hierarchy. The pose
+ * side is AnimationController as it is now: clips bound to bone indices at
+ * load time, SoA sampling and blending, and the SIMD hierarchy pass.
+ *
+ * Argument: character count. items/s counts animated characters.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "animation/Animation.hpp"
+#include "animation/AnimationController.hpp"
+#include "animation/Skeleton.hpp"
+#include "animation/blending/BlendMask.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr size_t kBoneCount = 60;
+constexpr int kKeysPerClip = 31;
+constexpr float kDeltaTime = 1.0f / 60.0f;
+constexpr float kBaseRunWeight = 0.3f;
+constexpr float kAdditiveWeight = 0.5f;
+
+std::string BoneName(size_t index) {
+    return "Bone" + std::to_string(index);
+}
+
+/**
+ * @brief Binary-tree rig; bone 1 and its subtree form the upper body
+ */
+Skeleton BuildRig() {
+    SkeletonBuilder builder;
+    for (size_t i = 0; i < kBoneCount; ++i) {
+        const glm::mat4 local = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.1f, 0.02f * static_cast<float>(i % 3)));
+        builder.AddBone(BoneName(i), i == 0 ? "" : BoneName((i - 1) / 2), glm::mat4(1.0f), local);
+    }
+    return builder.Build();
+}
+
+std::shared_ptr<Animation> BuildClip(const std::string& name, float frequency, float amplitude) {
+    auto clip = std::make_shared<Animation>(name);
+    clip->SetDuration(1.0f);
+    for (size_t bone = 0; bone < kBoneCount; ++bone) {
+        AnimationChannel channel;
+        channel.nodeName = BoneName(bone);
+        for (int k = 0; k < kKeysPerClip; ++k) {
+            const float t = static_cast<float>(k) / static_cast<float>(kKeysPerClip - 1);
+            const float phase = frequency * t * 6.2831853f + static_cast<float>(bone);
+            Keyframe key;
+            key.time = t;
+            key.position = glm::vec3(0.0f, 0.1f, amplitude * std::sin(phase));
+            key.rotation = glm::angleAxis(amplitude * std::cos(phase), glm::vec3(1.0f, 0.0f, 0.0f));
+            key.scale = glm::vec3(1.0f);
+            channel.keyframes.push_back(key);
+        }
+        clip->AddChannel(channel);
+    }
+    return clip;
+}
+
+struct Clips {
+    std::shared_ptr<Animation> walk = BuildClip("Walk", 1.0f, 0.2f);
+    std::shared_ptr<Animation> run = BuildClip("Run", 2.0f, 0.4f);
+    std::shared_ptr<Animation> wave = BuildClip("Wave", 3.0f, 0.3f);
+    std::shared_ptr<Animation> lean = BuildClip("Lean", 0.5f, 0.1f);
+};
+
+// =============================================================================
+// Legacy: name-keyed matrices
+// =============================================================================
+
+struct LegacyCharacter {
+    float time = 0.0f;
+    std::unordered_map<std::string, glm::mat4> walk;
+    std::unordered_map<std::string, glm::mat4> run;
+    std::unordered_map<std::string, glm::mat4> wave;
+    std::unordered_map<std::string, glm::mat4> lean;
+    std::unordered_map<std::string, glm::mat4> blended;
+    std::vector<glm::mat4> matrices;
+};
+
+void AnimateLegacy(LegacyCharacter& character, const Clips& clips, const Skeleton& skeleton,
+                   const std::vector<float>& upperBodyWeights) {
+    character.time = std::fmod(character.time + kDeltaTime, 1.0f);
+    const float t = character.time;
+
+    clips.walk->EvaluateInto(t, character.walk);
+    clips.run->EvaluateInto(t, character.run);
+    clips.wave->EvaluateInto(t, character.wave);
+    clips.lean->EvaluateInto(t, character.lean);
+
+    const auto& bones = skeleton.GetBones();
+    for (size_t i = 0; i < bones.size(); ++i) {
+        const std::string& name = bones[i].name;
+        glm::mat4 transform = BlendTransforms(character.walk[name], character.run[name], kBaseRunWeight);
+        if (upperBodyWeights[i] > 0.0f) {
+            transform = BlendTransforms(transform, character.wave[name], upperBodyWeights[i]);
+        }
+        transform = transform * BlendTransforms(glm::mat4(1.0f), character.lean[name], kAdditiveWeight);
+        character.blended[name] = transform;
+    }
+
+    skeleton.CalculateBoneMatricesInto(character.blended, character.matrices);
+}
+
+// =============================================================================
+// Pose: AnimationController
+// =============================================================================
+
+std::unique_ptr<AnimationController> MakeController(Skeleton& skeleton, const Clips& clips,
+                                                    const std::shared_ptr<const BlendMask>& upperBody) {
+    auto controller = std::make_unique<AnimationController>(&skeleton);
+    controller->AddAnimation("Walk", clips.walk);
+    controller->AddAnimation("Run", clips.run);
+    controller->AddAnimation("Wave", clips.wave);
+    controller->AddAnimation("Lean", clips.lean);
+
+    // A crossfade that never finishes keeps both base clips sampled every frame
+    controller->Play("Walk", 0.0f);
+    controller->Update(0.0f);
+    controller->Play("Run", 1.0e6f);
+
+    controller->PlayOnLayer(1, "Wave", 0.0f);
+    controller->SetLayerMask(1, upperBody);
+
+    controller->PlayOnLayer(2, "Lean", 0.0f);
+    controller->SetLayerBlendMode(2, BlendMode::Additive);
+    controller->SetLayerWeight(2, kAdditiveWeight);
+    return controller;
+}
+
+} // namespace
+
+static void BM_Animation_LegacyMatrices(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Clips clips;
+    Skeleton skeleton = BuildRig();
+
+    BlendMask upperBody("UpperBody");
+    upperBody.SetSkeleton(&skeleton);
+    upperBody.SetBranchWeight(BoneName(1), 1.0f);
+    const std::vector<float> upperBodyWeights = upperBody.GetWeights();
+
+    std::vector<LegacyCharacter> characters(count);
+    for (size_t i = 0; i < count; ++i) {
+        characters[i].time = static_cast<float>(i) / static_cast<float>(count);
+        characters[i].matrices.resize(kBoneCount);
+    }
+
+    for (auto _ : state) {
+        for (auto& character : characters) {
+            AnimateLegacy(character, clips, skeleton, upperBodyWeights);
+        }
+        benchmark::DoNotOptimize(characters.back().matrices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Animation_LegacyMatrices)->Arg(64)->Arg(256)->Unit(benchmark::kMillisecond);
+
+static void BM_Animation_PoseController(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Clips clips;
+    Skeleton skeleton = BuildRig();
+
+    auto upperBody = std::make_shared<BlendMask>("UpperBody");
+    upperBody->SetSkeleton(&skeleton);
+    upperBody->SetBranchWeight(BoneName(1), 1.0f);
+
+    std::vector<std::unique_ptr<AnimationController>> controllers;
+    for (size_t i = 0; i < count; ++i) {
+        controllers.push_back(MakeController(skeleton, clips, upperBody));
+        controllers.back()->Update(static_cast<float>(i) / static_cast<float>(count));
+    }
+    std::vector<glm::mat4> matrices(kBoneCount * count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            controllers[i]->Update(kDeltaTime);
+            controllers[i]->GetBoneMatricesInto(std::span<glm::mat4>(matrices).subspan(i * kBoneCount, kBoneCount));
+        }
+        benchmark::DoNotOptimize(matrices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Animation_PoseController)->Arg(64)->Arg(256)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,279 @@
+/**
+ * @file bench_chunk_codec.cpp
+ * @brief Benchmarks for chunk terrain compression codecs
+ *
+ * Chunks are 32^3 one-byte voxels cut from a generated world: rolling
+ * heightmap terrain in grassland, desert and tundra biomes, stone with ore
+ * below, air above. The corpus mixes surface, underground and sky chunks
+ * roughly as a streaming radius around a player would.
+ *
+ * Codec arguments: 0 = none, 1 = lz4, 2 = zstd, 3 = zstd with a dictionary
+ * trained on a separate sample of the same world. Bytes/s counts
+ * uncompressed bytes; "ratio" is uncompressed / compressed size. Full 32 KB
+ * chunks leave a dictionary little to add; it pays off on smaller payloads.
+ *
+ * RegionDecode times ChunkStreamer's batch decode step for 256 chunks:
+ * ChunkCodecRegistry::Decode into pooled buffers, serially or spread over
+ * the JobSystem.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "core/JobSystem.hpp"
+#include "persistence/ChunkCodec.hpp"
+#include "persistence/WorldDatabase.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr int kChunkEdge = 32;
+constexpr size_t kChunkBytes = kChunkEdge * kChunkEdge * kChunkEdge;
+constexpr size_t kCorpusChunks = 256;
+
+enum Block : uint8_t {
+    Air = 0, Stone, Granite, Gravel, Dirt, Grass, Sand, Sandstone, Snow, Ice, Water, CoalOre, IronOre, Log, Leaves, Flower
+};
+
+float Wave(float x, float y, float z, float phase) {
+    return std::sin(x * 0.11f + phase) * std::cos(z * 0.09f - phase) + std::sin(y * 0.13f + x * 0.07f);
+}
+
+/**
+ * @brief One chunk of a generated world
+ */
+std::vector<uint8_t> GenerateChunk(int cx, int cy, int cz, uint32_t seed) {
+    std::mt19937 rng(seed ^ static_cast<uint32_t>(cx * 73856093 ^ cy * 19349663 ^ cz * 83492791));
+    std::uniform_int_distribution<int> roll(0, 999);
+
+    // Biome bands along x: grassland, desert, tundra
+    const int biome = ((cx % 3) + 3) % 3;
+    const uint8_t top = biome == 0 ? Grass : (biome == 1 ? Sand : Snow);
+    const uint8_t under = biome == 1 ? Sandstone : Dirt;
+    const float phase = static_cast<float>(seed % 1000) * 0.01f;
+
+    std::vector<uint8_t> voxels(kChunkBytes, Air);
+    for (int z = 0; z < kChunkEdge; ++z) {
+        for (int x = 0; x < kChunkEdge; ++x) {
+            const float wx = static_cast<float>(cx * kChunkEdge + x);
+            const float wz = static_cast<float>(cz * kChunkEdge + z);
+            const int height = 40 + static_cast<int>(12.0f * std::sin(wx * 0.05f + phase) * std::cos(wz * 0.04f) +
+                                                     4.0f * std::sin(wx * 0.17f + wz * 0.13f)) + roll(rng) % 2;
+            const int dirtDepth = 2 + roll(rng) % 3;
+            for (int y = 0; y < kChunkEdge; ++y) {
+                const int wy = cy * kChunkEdge + y;
+                const float wave = Wave(wx, static_cast<float>(wy), wz, phase);
+                uint8_t block = Air;
+                if (wy < height - dirtDepth) {
+                    if (wave > 1.55f) {
+                        block = wy < 0 ? Water : Air;          // Caves
+                    } else if (roll(rng) < 12) {
+                        block = roll(rng) < 700 ? CoalOre : IronOre;
+                    } else if (wave < -1.2f) {
+                        block = Granite;
+                    } else if (wave > 1.3f) {
+                        block = Gravel;
+                    } else {
+                        block = Stone;
+                    }
+                } else if (wy < height - 1) {
+                    block = under;
+                } else if (wy == height - 1) {
+                    block = (biome == 2 && wy < 36) ? Ice : top;
+                } else if (wy < 36) {
+                    block = Water;
+                } else if (wy == height && biome == 0 && roll(rng) < 40) {
+                    block = Flower;
+                } else if (biome == 0 && wy < height + 6 && ((x * 7 + z * 13) % 97) == 0) {
+                    block = wy < height + 4 ? Log : Leaves;
+                }
+                voxels[(y * kChunkEdge + z) * kChunkEdge + x] = block;
+            }
+        }
+    }
+    return voxels;
+}
+
+/**
+ * @brief Chunks around a point: 8 x 8 columns, four layers (two underground,
+ * surface, sky)
+ */
+std::vector<std::vector<uint8_t>> GenerateRegion(int originX, int originZ, uint32_t seed) {
+    std::vector<std::vector<uint8_t>> chunks;
+    chunks.reserve(kCorpusChunks);
+    for (int cz = 0; cz < 8; ++cz) {
+        for (int cx = 0; cx < 8; ++cx) {
+            for (int cy = -1; cy < 3; ++cy) {
+                chunks.push_back(GenerateChunk(originX + cx, cy, originZ + cz, seed));
+            }
+        }
+    }
+    return chunks;
+}
+
+/**
+ * @brief Shared corpus, plus a dictionary trained on a different region
+ */
+struct Corpus {
+    std::vector<std::vector<uint8_t>> chunks;
+    std::vector<uint8_t> dictionary;
+
+    static const Corpus& Get() {
+        static const Corpus corpus = [] {
+            Corpus c;
+            c.chunks = GenerateRegion(0, 0, 7);
+            const std::vector<std::vector<uint8_t>> samples = GenerateRegion(-40, 25, 7);
+            std::vector<std::span<const uint8_t>> spans(samples.begin(), samples.end());
+            c.dictionary = ZstdChunkCodec::TrainDictionary(spans, 16 * 1024);
+            return c;
+        }();
+        return corpus;
+    }
+};
+
+/**
+ * @brief Codec by benchmark argument, owned by a registry
+ */
+ChunkCodecRegistry& GetRegistry(int codecArg) {
+    static std::unique_ptr<ChunkCodecRegistry> registries[4];
+    auto& registry = registries[codecArg];
+    if (!registry) {
+        registry = std::make_unique<ChunkCodecRegistry>();
+        static const char* names[] = {"none", "lz4", "zstd", "zstd"};
+        registry->SetSaveCodec(names[codecArg]);
+        if (codecArg == 3) {
+            registry->GetZstd().AddDictionary(Corpus::Get().dictionary);
+        }
+    }
+    return *registry;
+}
+
+const char* CodecLabel(int codecArg) {
+    static const char* labels[] = {"none", "lz4", "zstd", "zstd+dict"};
+    return labels[codecArg];
+}
+
+std::vector<std::vector<uint8_t>> CompressCorpus(const ChunkCodec& codec, size_t& compressedBytes) {
+    std::vector<std::vector<uint8_t>> encoded(Corpus::Get().chunks.size());
+    compressedBytes = 0;
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        codec.Compress(Corpus::Get().chunks[i], encoded[i]);
+        compressedBytes += encoded[i].size();
+    }
+    return encoded;
+}
+
+void ReportThroughput(benchmark::State& state, int codecArg, size_t compressedBytes) {
+    const size_t rawBytes = Corpus::Get().chunks.size() * kChunkBytes;
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(rawBytes));
+    state.counters["ratio"] = static_cast<double>(rawBytes) / static_cast<double>(std::max<size_t>(compressedBytes, 1));
+    state.SetLabel(CodecLabel(codecArg));
+}
+
+} // namespace
+
+// ============================================================================
+// Codec Throughput
+// ============================================================================
+
+static void BM_ChunkCodec_Compress(benchmark::State& state) {
+    const int codecArg = static_cast<int>(state.range(0));
+    const ChunkCodec& codec = GetRegistry(codecArg).GetSaveCodec();
+    const Corpus& corpus = Corpus::Get();
+
+    std::vector<uint8_t> encoded;
+    size_t compressedBytes = 0;
+    for (auto _ : state) {
+        compressedBytes = 0;
+        for (const auto& chunk : corpus.chunks) {
+            codec.Compress(chunk, encoded);
+            compressedBytes += encoded.size();
+        }
+        benchmark::DoNotOptimize(encoded.data());
+    }
+    ReportThroughput(state, codecArg, compressedBytes);
+}
+BENCHMARK(BM_ChunkCodec_Compress)->DenseRange(0, 3)->Unit(benchmark::kMillisecond);
+
+static void BM_ChunkCodec_Decompress(benchmark::State& state) {
+    const int codecArg = static_cast<int>(state.range(0));
+    const ChunkCodec& codec = GetRegistry(codecArg).GetSaveCodec();
+
+    size_t compressedBytes = 0;
+    const std::vector<std::vector<uint8_t>> encoded = CompressCorpus(codec, compressedBytes);
+    std::vector<uint8_t> decoded(kChunkBytes);
+    for (auto _ : state) {
+        for (const auto& chunk : encoded) {
+            codec.Decompress(chunk, decoded);
+        }
+        benchmark::DoNotOptimize(decoded.data());
+    }
+    ReportThroughput(state, codecArg, compressedBytes);
+}
+BENCHMARK(BM_ChunkCodec_Decompress)->DenseRange(0, 3)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Region Decode
+// ============================================================================
+
+/**
+ * @brief range(0) is the codec, range(1) toggles JobSystem decode
+ */
+static void BM_ChunkCodec_RegionDecode(benchmark::State& state) {
+    auto& js = JobSystem::Instance();
+    if (!js.IsInitialized()) {
+        (void)js.Initialize();
+    }
+
+    const int codecArg = static_cast<int>(state.range(0));
+    const bool parallel = state.range(1) != 0;
+    const ChunkCodecRegistry& registry = GetRegistry(codecArg);
+    const Corpus& corpus = Corpus::Get();
+
+    // Encoded rows as LoadChunk returns them
+    std::vector<ChunkData> rows(corpus.chunks.size());
+    size_t compressedBytes = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i].terrainData = corpus.chunks[i];
+        registry.Encode(rows[i]);
+        compressedBytes += rows[i].terrainData.size();
+    }
+
+    ChunkBufferPool pool;
+    std::vector<ChunkData> batch(rows.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < rows.size(); ++i) {
+            batch[i].compressionType = rows[i].compressionType;
+            batch[i].uncompressedSize = rows[i].uncompressedSize;
+            batch[i].terrainData = pool.Acquire(rows[i].terrainData.size());
+            std::copy(rows[i].terrainData.begin(), rows[i].terrainData.end(), batch[i].terrainData.begin());
+        }
+        state.ResumeTiming();
+
+        if (parallel) {
+            js.ParallelFor(0, batch.size(), 1, [&](size_t i) { registry.Decode(batch[i], pool); });
+        } else {
+            for (ChunkData& chunk : batch) {
+                registry.Decode(chunk, pool);
+            }
+        }
+
+        state.PauseTiming();
+        for (ChunkData& chunk : batch) {
+            pool.Release(std::move(chunk.terrainData));
+        }
+        state.ResumeTiming();
+    }
+    ReportThroughput(state, codecArg, compressedBytes);
+}
+BENCHMARK(BM_ChunkCodec_RegionDecode)
+    ->ArgsProduct({{1, 2, 3}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
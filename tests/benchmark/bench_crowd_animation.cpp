@@ -0,0 +1,172 @@
+/**
+ * @file bench_crowd_animation.cpp
+ * @brief Battle-sized crowds: per-unit AnimationController updates vs CrowdAnimator
+ *
+ * Units share a 60-bone rig and three one-second clips (idle, walk, attack)
+ * and stand on a 240 x 240 battlefield around the camera. Each starts its
+ * clip at a random time; a quarter of them are in a long crossfade, so
+ * their poses can never be shared. Each iteration is one frame: every
+ * unit's skinning matrices written to its own buffer.
+ *
+ * - PerController: Update() and GetBoneMatricesInto() for every unit
+ * - Crowd: CrowdAnimator on the calling thread (range(1) = 0) or fanned
+ *   out over the JobSystem (range(1) = 1)
+ *
+ * Argument: unit count. items/s counts animated units.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "animation/Animation.hpp"
+#include "animation/AnimationController.hpp"
+#include "animation/CrowdAnimator.hpp"
+#include "animation/Skeleton.hpp"
+#include "core/JobSystem.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr size_t kBoneCount = 60;
+constexpr int kKeysPerClip = 31;
+constexpr float kDeltaTime = 1.0f / 60.0f;
+constexpr float kFieldHalfSize = 120.0f;
+
+std::string BoneName(size_t index) {
+    return "Bone" + std::to_string(index);
+}
+
+Skeleton BuildRig() {
+    SkeletonBuilder builder;
+    for (size_t i = 0; i < kBoneCount; ++i) {
+        builder.AddBone(BoneName(i), i == 0 ? "" : BoneName((i - 1) / 2), glm::mat4(1.0f),
+                        glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.1f, 0.0f)));
+    }
+    return builder.Build();
+}
+
+std::shared_ptr<Animation> BuildClip(const std::string& name, float frequency, float amplitude) {
+    auto clip = std::make_shared<Animation>(name);
+    clip->SetDuration(1.0f);
+    for (size_t bone = 0; bone < kBoneCount; ++bone) {
+        AnimationChannel channel;
+        channel.nodeName = BoneName(bone);
+        for (int k = 0; k < kKeysPerClip; ++k) {
+            const float t = static_cast<float>(k) / static_cast<float>(kKeysPerClip - 1);
+            const float phase = frequency * t * 6.2831853f + static_cast<float>(bone);
+            Keyframe key;
+            key.time = t;
+            key.position = glm::vec3(0.0f, 0.1f, amplitude * std::sin(phase));
+            key.rotation = glm::angleAxis(amplitude * std::cos(phase), glm::vec3(1.0f, 0.0f, 0.0f));
+            key.scale = glm::vec3(1.0f);
+            channel.keyframes.push_back(key);
+        }
+        clip->AddChannel(channel);
+    }
+    return clip;
+}
+
+struct Battle {
+    Skeleton skeleton = BuildRig();
+    std::shared_ptr<Animation> idle = BuildClip("Idle", 1.0f, 0.05f);
+    std::shared_ptr<Animation> walk = BuildClip("Walk", 1.0f, 0.2f);
+    std::shared_ptr<Animation> attack = BuildClip("Attack", 2.0f, 0.5f);
+
+    std::vector<std::unique_ptr<AnimationController>> controllers;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::mat4> matrices;
+
+    explicit Battle(size_t count) : matrices(count * kBoneCount) {
+        static const char* kClips[] = {"Idle", "Walk", "Attack"};
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto controller = std::make_unique<AnimationController>(&skeleton);
+            controller->AddAnimation("Idle", idle);
+            controller->AddAnimation("Walk", walk);
+            controller->AddAnimation("Attack", attack);
+            controller->Play(kClips[i % 3], 0.0f);
+            controller->SetCurrentTime(unit(rng));
+            if (i % 4 == 3) {
+                // Never finishes within the benchmark
+                controller->Play(kClips[(i + 1) % 3], 1.0e6f);
+            }
+            controllers.push_back(std::move(controller));
+            positions.emplace_back((unit(rng) * 2.0f - 1.0f) * kFieldHalfSize, 0.0f,
+                                   (unit(rng) * 2.0f - 1.0f) * kFieldHalfSize);
+        }
+    }
+
+    std::span<glm::mat4> MatricesOf(size_t i) {
+        return std::span<glm::mat4>(matrices).subspan(i * kBoneCount, kBoneCount);
+    }
+};
+
+void EnsureJobSystem() {
+    auto& js = JobSystem::Instance();
+    if (!js.IsInitialized()) {
+        (void)js.Initialize();
+    }
+}
+
+} // namespace
+
+static void BM_Crowd_PerController(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Battle battle(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            battle.controllers[i]->Update(kDeltaTime);
+            battle.controllers[i]->GetBoneMatricesInto(battle.MatricesOf(i));
+        }
+        benchmark::DoNotOptimize(battle.matrices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Crowd_PerController)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_Crowd_Animator(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Battle battle(count);
+
+    CrowdAnimationSettings settings;
+    settings.useJobSystem = state.range(1) != 0;
+    if (settings.useJobSystem) {
+        EnsureJobSystem();
+    }
+
+    CrowdAnimator crowd(settings);
+    for (size_t i = 0; i < count; ++i) {
+        const auto id = crowd.Add(battle.controllers[i].get(), battle.MatricesOf(i));
+        crowd.SetPosition(id, battle.positions[i]);
+    }
+
+    double evaluated = 0.0;
+    double shared = 0.0;
+    for (auto _ : state) {
+        crowd.Update(kDeltaTime, glm::vec3(0.0f));
+        benchmark::DoNotOptimize(battle.matrices.data());
+        evaluated += static_cast<double>(crowd.GetStats().evaluated);
+        shared += static_cast<double>(crowd.GetStats().shared);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["evaluated"] = benchmark::Counter(evaluated, benchmark::Counter::kAvgIterations);
+    state.counters["shared"] = benchmark::Counter(shared, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_Crowd_Animator)
+    ->Args({256, 0})->Args({1024, 0})
+    ->Args({256, 1})->Args({1024, 1})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,143 @@
+/**
+ * @file bench_culling.cpp
+ * @brief Frustum culling and LOD selection for 100k and 1M instances
+ *
+ * Instances are scattered through a 2 km cube and the camera frustum keeps
+ * roughly a fifth of them. Compared:
+ * - ScalarAoS: the per-instance loop ParallelCullingSystem used to run in
+ *   each job (transform the sphere centre, six plane tests, then LOD),
+ *   over std::vector<SDFInstance>
+ * - SoA: CullingBounds through the SIMD kernels, sphere and AABB tests plus
+ *   LOD in one pass; range(1) = 0 runs on the calling thread, 1 on the
+ *   JobSystem
+ *
+ * items/s counts tested instances.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "core/JobSystem.hpp"
+#include "graphics/ParallelCullingSystem.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Graphics;
+
+namespace {
+
+constexpr float kWorldHalfSize = 1000.0f;
+
+std::vector<SDFInstance> BuildInstances(size_t count) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> position(-kWorldHalfSize, kWorldHalfSize);
+    std::uniform_real_distribution<float> size(0.5f, 8.0f);
+
+    std::vector<SDFInstance> instances(count);
+    for (size_t i = 0; i < count; i++) {
+        SDFInstance& instance = instances[i];
+        instance.boundingSphereCenter = Vector3(position(rng), position(rng), position(rng));
+        instance.boundingSphereRadius = size(rng);
+        const Vector3& c = instance.boundingSphereCenter;
+        const float half = instance.boundingSphereRadius * 0.7f;
+        instance.aabbMin = Vector3(c.x - half, c.y - half, c.z - half);
+        instance.aabbMax = Vector3(c.x + half, c.y + half, c.z + half);
+        instance.instanceID = static_cast<uint32_t>(i);
+    }
+    return instances;
+}
+
+/**
+ * @brief 45 degree pyramid looking down +z from the world's -z face
+ */
+CullingCamera BuildCamera() {
+    CullingCamera camera;
+    camera.position = Vector3(0.0f, 0.0f, -kWorldHalfSize);
+    camera.fov = 45.0f;
+
+    // Side planes lean in by half the field of view: normal (cos, 0, sin) through the apex
+    const float c = 0.92387953f;
+    const float s = 0.38268343f;
+    const float apex = -kWorldHalfSize;
+    camera.frustum.planes[0] = Vector4(c, 0.0f, s, -s * apex);
+    camera.frustum.planes[1] = Vector4(-c, 0.0f, s, -s * apex);
+    camera.frustum.planes[2] = Vector4(0.0f, c, s, -s * apex);
+    camera.frustum.planes[3] = Vector4(0.0f, -c, s, -s * apex);
+    camera.frustum.planes[4] = Vector4(0.0f, 0.0f, 1.0f, -apex - 0.1f);
+    camera.frustum.planes[5] = Vector4(0.0f, 0.0f, -1.0f, kWorldHalfSize);
+    return camera;
+}
+
+void EnsureJobSystem() {
+    auto& js = Nova::JobSystem::Instance();
+    if (!js.IsInitialized()) {
+        (void)js.Initialize();
+    }
+}
+
+uint32_t ScalarLOD(const SDFInstance& instance, const Vector3& worldCenter, const CullingCamera& camera) {
+    const float distance = glm::length(worldCenter - camera.position);
+    const float screenHeight = 2.0f * std::tan(camera.fov * 3.14159265f / 360.0f) * distance;
+    const float projectedSize = instance.boundingSphereRadius * 2.0f / screenHeight;
+    if (projectedSize > 0.3f) return 0;
+    if (projectedSize > 0.15f) return 1;
+    if (projectedSize > 0.075f) return 2;
+    if (projectedSize > 0.0375f) return 3;
+    return 4;
+}
+
+} // namespace
+
+static void BM_Culling_ScalarAoS(benchmark::State& state) {
+    const auto instances = BuildInstances(static_cast<size_t>(state.range(0)));
+    const CullingCamera camera = BuildCamera();
+    std::vector<uint32_t> visible;
+    std::vector<uint32_t> lods;
+
+    for (auto _ : state) {
+        visible.clear();
+        lods.clear();
+        for (const SDFInstance& instance : instances) {
+            const Vector3 worldCenter = Vector3(instance.transform * Vector4(instance.boundingSphereCenter, 1.0f));
+            if (camera.frustum.TestSphere(worldCenter, instance.boundingSphereRadius)) {
+                visible.push_back(instance.instanceID);
+                lods.push_back(ScalarLOD(instance, worldCenter, camera));
+            }
+        }
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::DoNotOptimize(lods.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["visible"] = static_cast<double>(visible.size());
+}
+BENCHMARK(BM_Culling_ScalarAoS)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_Culling_SoA(benchmark::State& state) {
+    if (state.range(1) != 0) {
+        EnsureJobSystem();
+    }
+
+    CullingBounds bounds;
+    bounds.Assign(BuildInstances(static_cast<size_t>(state.range(0))), true);
+    const CullingCamera camera = BuildCamera();
+
+    ParallelCullingSystem::Config config;
+    config.useJobSystem = state.range(1) != 0;
+    ParallelCullingSystem culling(config);
+    CullingResult result;
+
+    for (auto _ : state) {
+        culling.CullBounds(bounds, camera, result);
+        benchmark::DoNotOptimize(result.visibleIndices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["visible"] = static_cast<double>(result.totalVisible);
+}
+BENCHMARK(BM_Culling_SoA)
+    ->Args({100000, 0})->Args({1000000, 0})
+    ->Args({100000, 1})->Args({1000000, 1})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,324 @@
+/**
+ * @file bench_ecs.cpp
+ * @brief Update throughput of the archetype ECS against map-of-objects storage
+ *
+ * Both sides hold the same population, two zombies per NPC, and run the same
+ * frame: every zombie steers toward a target and every entity integrates its
+ * velocity. The legacy layout mirrors what Vehement::EntityManager used to
+ * do: an unordered_map of heap-allocated polymorphic entities, filtered by
+ * type and updated through virtual calls. Entities are spawned interleaved
+ * with other allocations, as they are over a play session, so they do not
+ * end up neatly adjacent on the heap.
+ *
+ * The ECS side stores Position/Velocity/Steering in chunks split by type tag;
+ * the parallel variant spreads those chunks over the JobSystem.
+ *
+ * The EntityManager cases drive the game's own Vehement::EntityManager with
+ * real zombies. Its facade still owns one polymorphic Entity per row and
+ * calls Update/UpdateAI virtually, so they measure what the game gets today
+ * rather than what native component systems can reach.
+ *
+ * Argument: entity count (1k / 10k / 100k). items/s counts entity updates.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "core/JobSystem.hpp"
+#include "ecs/World.hpp"
+#include "entities/EntityManager.hpp"
+#include "entities/Zombie.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr float kDeltaTime = 1.0f / 60.0f;
+constexpr float kTargetX = 50.0f;
+constexpr float kTargetZ = 50.0f;
+
+// =============================================================================
+// Legacy Layout
+// =============================================================================
+
+enum class LegacyType : uint8_t { Zombie, NPC };
+
+class LegacyEntity {
+public:
+    explicit LegacyEntity(LegacyType type) : m_type(type) {}
+    virtual ~LegacyEntity() = default;
+
+    virtual void Update(float deltaTime) {
+        m_x += m_vx * deltaTime;
+        m_z += m_vz * deltaTime;
+    }
+
+    LegacyType GetType() const { return m_type; }
+    bool IsActive() const { return m_active; }
+
+    // Roughly the size and field spread of Vehement::Entity
+    float m_x = 0.0f, m_y = 0.0f, m_z = 0.0f;
+    float m_vx = 0.0f, m_vy = 0.0f, m_vz = 0.0f;
+    float m_rotation = 0.0f;
+    float m_health = 100.0f, m_maxHealth = 100.0f;
+    float m_moveSpeed = 3.0f;
+    float m_collisionRadius = 0.5f;
+    LegacyType m_type;
+    bool m_active = true;
+    std::string m_name = "entity";
+    std::string m_texturePath = "textures/entity.png";
+    uint8_t m_padding[96] = {};
+};
+
+class LegacyZombie : public LegacyEntity {
+public:
+    LegacyZombie() : LegacyEntity(LegacyType::Zombie) {}
+
+    void UpdateAI() {
+        const float dx = kTargetX - m_x;
+        const float dz = kTargetZ - m_z;
+        const float length = std::sqrt(dx * dx + dz * dz) + 1e-4f;
+        m_vx = dx / length * m_moveSpeed;
+        m_vz = dz / length * m_moveSpeed;
+    }
+
+    float m_aggro = 1.0f;
+};
+
+class LegacyNPC : public LegacyEntity {
+public:
+    LegacyNPC() : LegacyEntity(LegacyType::NPC) {}
+};
+
+struct LegacyStore {
+    std::unordered_map<uint32_t, std::unique_ptr<LegacyEntity>> entities;
+    std::vector<std::unique_ptr<uint8_t[]>> ballast;
+};
+
+// =============================================================================
+// ECS Layout
+// =============================================================================
+
+struct Position {
+    float x = 0.0f;
+    float z = 0.0f;
+};
+
+struct Velocity {
+    float x = 0.0f;
+    float z = 0.0f;
+};
+
+struct Steering {
+    float moveSpeed = 3.0f;
+};
+
+struct ZombieTag {};
+struct NPCTag {};
+
+// =============================================================================
+// Population
+// =============================================================================
+
+void BuildLegacy(LegacyStore& store, size_t count) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, 100.0f);
+    std::uniform_int_distribution<size_t> ballastSize(16, 512);
+
+    store.entities.reserve(count);
+    for (uint32_t id = 1; id <= count; ++id) {
+        std::unique_ptr<LegacyEntity> entity;
+        if (id % 3 == 0) {
+            entity = std::make_unique<LegacyNPC>();
+        } else {
+            entity = std::make_unique<LegacyZombie>();
+        }
+        entity->m_x = coord(rng);
+        entity->m_z = coord(rng);
+        store.entities.emplace(id, std::move(entity));
+        store.ballast.push_back(std::make_unique<uint8_t[]>(ballastSize(rng)));
+    }
+}
+
+void BuildECS(ECS::World& world, size_t count) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, 100.0f);
+
+    for (uint32_t id = 1; id <= count; ++id) {
+        const Position position{coord(rng), coord(rng)};
+        if (id % 3 == 0) {
+            world.Create(position, Velocity{}, NPCTag{});
+        } else {
+            world.Create(position, Velocity{}, Steering{}, ZombieTag{});
+        }
+    }
+}
+
+void BuildEntityManager(Vehement::EntityManager& manager, size_t count) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(0.0f, 100.0f);
+
+    for (size_t i = 0; i < count; ++i) {
+        auto* zombie = manager.CreateEntity<Vehement::Zombie>();
+        zombie->SetPosition(glm::vec3(coord(rng), 0.0f, coord(rng)));
+    }
+}
+
+void EnsureJobSystem() {
+    auto& js = JobSystem::Instance();
+    if (!js.IsInitialized()) {
+        (void)js.Initialize();
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// Benchmarks
+// =============================================================================
+
+static void BM_ECS_LegacyMapUpdate(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    LegacyStore store;
+    BuildLegacy(store, count);
+
+    for (auto _ : state) {
+        for (auto& [id, entity] : store.entities) {
+            if (entity->IsActive() && entity->GetType() == LegacyType::Zombie) {
+                static_cast<LegacyZombie*>(entity.get())->UpdateAI();
+            }
+        }
+        for (auto& [id, entity] : store.entities) {
+            if (entity->IsActive()) {
+                entity->Update(kDeltaTime);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_LegacyMapUpdate)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ECS_ChunkUpdate(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    ECS::World world;
+    BuildECS(world, count);
+    const ECS::ComponentMask zombies = ECS::MakeComponentMask<ZombieTag>();
+
+    for (auto _ : state) {
+        world.ForEach<const Position, Velocity, const Steering>(
+            zombies, [](const Position& p, Velocity& v, const Steering& s) {
+                const float dx = kTargetX - p.x;
+                const float dz = kTargetZ - p.z;
+                const float length = std::sqrt(dx * dx + dz * dz) + 1e-4f;
+                v.x = dx / length * s.moveSpeed;
+                v.z = dz / length * s.moveSpeed;
+            });
+        world.ForEach<Position, const Velocity>([](Position& p, const Velocity& v) {
+            p.x += v.x * kDeltaTime;
+            p.z += v.z * kDeltaTime;
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_ChunkUpdate)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ECS_ChunkUpdateParallel(benchmark::State& state) {
+    EnsureJobSystem();
+    const size_t count = static_cast<size_t>(state.range(0));
+    ECS::World world;
+    BuildECS(world, count);
+    const ECS::ComponentMask zombies = ECS::MakeComponentMask<ZombieTag>();
+
+    for (auto _ : state) {
+        world.ParallelForEach<const Position, Velocity, const Steering>(
+            zombies, [](const Position& p, Velocity& v, const Steering& s) {
+                const float dx = kTargetX - p.x;
+                const float dz = kTargetZ - p.z;
+                const float length = std::sqrt(dx * dx + dz * dz) + 1e-4f;
+                v.x = dx / length * s.moveSpeed;
+                v.z = dz / length * s.moveSpeed;
+            });
+        world.ParallelForEach<Position, const Velocity>([](Position& p, const Velocity& v) {
+            p.x += v.x * kDeltaTime;
+            p.z += v.z * kDeltaTime;
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_ChunkUpdateParallel)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ECS_CreateDestroy(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    ECS::World world;
+    std::vector<ECS::EntityHandle> handles;
+    handles.reserve(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            handles.push_back(world.Create(Position{}, Velocity{}, Steering{}, ZombieTag{}));
+        }
+        for (ECS::EntityHandle handle : handles) {
+            world.Destroy(handle);
+        }
+        handles.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_CreateDestroy)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ECS_EntityManagerUpdate(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    Vehement::EntityManager manager;
+    BuildEntityManager(manager, count);
+
+    for (auto _ : state) {
+        manager.Update(kDeltaTime);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_EntityManagerUpdate)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ECS_EntityManagerUpdateParallel(benchmark::State& state) {
+    EnsureJobSystem();
+    const size_t count = static_cast<size_t>(state.range(0));
+    Vehement::EntityManager manager;
+    BuildEntityManager(manager, count);
+
+    for (auto _ : state) {
+        manager.UpdateParallel(kDeltaTime);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_EntityManagerUpdateParallel)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ECS_EntityManagerUpdateAI(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    Vehement::EntityManager manager;
+    BuildEntityManager(manager, count);
+
+    // No player or NPCs: every zombie looks for a target, then idles or wanders
+    for (auto _ : state) {
+        manager.UpdateAI(kDeltaTime, nullptr);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ECS_EntityManagerUpdateAI)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
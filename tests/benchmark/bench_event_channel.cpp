@@ -0,0 +1,154 @@
+/**
+ * @file bench_event_channel.cpp
+ * @brief Event throughput of typed EventChannels against the string-keyed EventBus
+ *
+ * Each iteration is one frame: publish N damage events, then deliver them to a
+ * single subscriber that sums the amounts. The EventBus side builds a BusEvent
+ * per hit with its payload in the std::any map and publishes it synchronously,
+ * which is how gameplay code used it. The channel side appends plain structs
+ * to the publishing thread's buffer and dispatches the frame as one span.
+ *
+ * The threaded variants split publishing across four producers, as systems
+ * running on the JobSystem would.
+ *
+ * Argument: events per frame. items/s counts delivered events.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "reflection/EventBus.hpp"
+#include "reflection/EventChannel.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace Nova::Reflect;
+
+namespace {
+
+constexpr int kProducers = 4;
+
+struct DamageEvent {
+    uint32_t target = 0;
+    uint32_t source = 0;
+    float amount = 0.0f;
+};
+
+void PublishBusRange(EventBus& bus, int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+        BusEvent event("OnDamage");
+        event.SetData("target", static_cast<uint32_t>(i));
+        event.SetData("source", 1u);
+        event.SetData("amount", 1.0f);
+        bus.Publish(event);
+    }
+}
+
+void PublishChannelRange(EventChannel<DamageEvent>& channel, int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+        channel.Publish({static_cast<uint32_t>(i), 1u, 1.0f});
+    }
+}
+
+template<typename Fn>
+void RunProducers(int64_t count, Fn&& publish) {
+    std::vector<std::thread> threads;
+    threads.reserve(kProducers);
+    for (int t = 0; t < kProducers; ++t) {
+        threads.emplace_back([&publish, count, t] {
+            publish(count * t / kProducers, count * (t + 1) / kProducers);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// Single Producer
+// =============================================================================
+
+static void BM_EventBus_Publish(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    EventBus& bus = EventBus::Instance();
+    bus.SetHistoryEnabled(false);
+    float total = 0.0f;
+    const size_t id = bus.Subscribe("OnDamage", [&total](BusEvent& event) {
+        total += event.GetDataOr<float>("amount", 0.0f);
+    });
+
+    for (auto _ : state) {
+        PublishBusRange(bus, 0, count);
+        benchmark::DoNotOptimize(total);
+    }
+
+    bus.Unsubscribe(id);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EventBus_Publish)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_EventChannel_PublishDispatch(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    EventChannel<DamageEvent> channel;
+    float total = 0.0f;
+    channel.Subscribe([&total](std::span<const DamageEvent> events) {
+        for (const DamageEvent& e : events) {
+            total += e.amount;
+        }
+    });
+
+    for (auto _ : state) {
+        PublishChannelRange(channel, 0, count);
+        channel.Dispatch();
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EventChannel_PublishDispatch)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// Multiple Producers
+// =============================================================================
+
+static void BM_EventBus_PublishThreaded(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    EventBus& bus = EventBus::Instance();
+    bus.SetHistoryEnabled(false);
+    std::atomic<uint64_t> delivered{0};
+    const size_t id = bus.Subscribe("OnDamage", [&delivered](BusEvent&) {
+        delivered.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    for (auto _ : state) {
+        RunProducers(count, [&bus](int64_t begin, int64_t end) { PublishBusRange(bus, begin, end); });
+    }
+
+    bus.Unsubscribe(id);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EventBus_PublishThreaded)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void BM_EventChannel_PublishDispatchThreaded(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    EventChannel<DamageEvent> channel;
+    float total = 0.0f;
+    channel.Subscribe([&total](std::span<const DamageEvent> events) {
+        for (const DamageEvent& e : events) {
+            total += e.amount;
+        }
+    });
+
+    for (auto _ : state) {
+        RunProducers(count, [&channel](int64_t begin, int64_t end) { PublishChannelRange(channel, begin, end); });
+        channel.Dispatch();
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EventChannel_PublishDispatchThreaded)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond)->UseRealTime();
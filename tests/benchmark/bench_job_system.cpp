@@ -0,0 +1,135 @@
+/**
+ * @file bench_job_system.cpp
+ * @brief Scaling benchmarks for the work-stealing job system
+ *
+ * Each benchmark is registered for 1..N worker threads so the output reads
+ * as a scaling curve; the job system is re-initialized whenever the worker
+ * count changes.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "core/JobSystem.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace Nova;
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+static void EnsureWorkers(uint32_t workers) {
+    auto& js = JobSystem::Instance();
+    if (js.IsInitialized() && js.GetWorkerCount() == workers) {
+        return;
+    }
+    js.Shutdown();
+
+    JobSystemConfig config;
+    config.workerThreads = workers;
+    (void)js.Initialize(config);
+}
+
+static void WorkerCounts(benchmark::internal::Benchmark* bench) {
+    const uint32_t maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t workers = 1; workers <= maxWorkers; workers *= 2) {
+        bench->Arg(workers);
+    }
+    if ((maxWorkers & (maxWorkers - 1)) != 0) {
+        bench->Arg(maxWorkers);
+    }
+}
+
+static float BusyWork(size_t i) {
+    float x = static_cast<float>(i);
+    for (int k = 0; k < 32; ++k) {
+        x = std::sqrt(x * 1.0001f + 1.0f);
+    }
+    return x;
+}
+
+// =============================================================================
+// Submission Throughput
+// =============================================================================
+
+static void BM_JobSystem_SubmitEmpty(benchmark::State& state) {
+    EnsureWorkers(static_cast<uint32_t>(state.range(0)));
+    constexpr int numJobs = 4096;
+
+    for (auto _ : state) {
+        JobCounter counter;
+        for (int i = 0; i < numJobs; ++i) {
+            JobSystem::Instance().Submit([]() {}, counter);
+        }
+        counter.Wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * numJobs);
+}
+BENCHMARK(BM_JobSystem_SubmitEmpty)->Apply(WorkerCounts)->UseRealTime();
+
+static void BM_JobSystem_NestedSubmit(benchmark::State& state) {
+    // Fan-out from inside jobs: exercises per-worker deques and stealing
+    EnsureWorkers(static_cast<uint32_t>(state.range(0)));
+    constexpr int numParents = 64;
+    constexpr int numChildren = 64;
+
+    for (auto _ : state) {
+        JobCounter parents;
+        for (int p = 0; p < numParents; ++p) {
+            JobSystem::Instance().Submit([]() {
+                JobCounter children;
+                for (int c = 0; c < numChildren; ++c) {
+                    JobSystem::Instance().Submit([c]() {
+                        benchmark::DoNotOptimize(BusyWork(c));
+                    }, children);
+                }
+                while (!children.IsComplete()) {
+                    JobSystem::Instance().YieldAndProcess();
+                }
+            }, parents);
+        }
+        parents.Wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * numParents * numChildren);
+}
+BENCHMARK(BM_JobSystem_NestedSubmit)->Apply(WorkerCounts)->UseRealTime();
+
+// =============================================================================
+// Parallel Loops
+// =============================================================================
+
+static void BM_JobSystem_ParallelFor(benchmark::State& state) {
+    EnsureWorkers(static_cast<uint32_t>(state.range(0)));
+    constexpr size_t count = 1 << 16;
+    std::vector<float> output(count);
+
+    for (auto _ : state) {
+        JobSystem::Instance().ParallelFor(0, count, 256, [&output](size_t i) {
+            output[i] = BusyWork(i);
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_JobSystem_ParallelFor)->Apply(WorkerCounts)->UseRealTime();
+
+static void BM_JobSystem_ParallelReduce(benchmark::State& state) {
+    EnsureWorkers(static_cast<uint32_t>(state.range(0)));
+    std::vector<float> data(1 << 18, 1.0f);
+
+    for (auto _ : state) {
+        float sum = Parallel::Reduce(data.begin(), data.end(), 0.0f,
+            [](float a, float b) { return a + b; });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_JobSystem_ParallelReduce)->Apply(WorkerCounts)->UseRealTime();
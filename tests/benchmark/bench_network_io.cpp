@@ -0,0 +1,301 @@
+/**
+ * @file bench_network_io.cpp
+ * @brief Loopback benchmarks for the network I/O thread
+ *
+ * One iteration is one server tick with N simulated clients on loopback:
+ * every client sends one 32 byte input, the game thread collects all of
+ * them, answers each client with 8 events of 48 bytes, and the clients read
+ * the answers. "Epoll" runs the server on NetworkIOThread (recvmmsg /
+ * sendmmsg, per-client coalescing); "Legacy" mirrors the previous
+ * ReplicationChannel path on the game thread (one recvfrom / sendto per
+ * packet, a vector per received packet, linear peer lookup).
+ *
+ * Counters: packets/s counts datagrams in both directions and msgs/s the
+ * inputs and events they carry (coalescing lowers the first, not the
+ * second); in_p99_us is client send -> game thread, out_p99_us is game
+ * thread send -> client receive; dgrams/tick is server datagrams sent per
+ * tick. Client simulation runs on the benchmark thread and is included in
+ * the time.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "networking/NetworkIOThread.hpp"
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Nova;
+
+namespace {
+
+constexpr size_t kInputSize = 32;
+constexpr size_t kEventSize = 48;
+constexpr size_t kEventsPerClient = 8;
+constexpr auto kTickTimeout = std::chrono::milliseconds(500);
+
+uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void WriteStamp(uint8_t* out, uint64_t timeNs, uint32_t tick) {
+    std::memcpy(out, &timeNs, sizeof(timeNs));
+    std::memcpy(out + 8, &tick, sizeof(tick));
+}
+
+void ReadStamp(const uint8_t* in, uint64_t& timeNs, uint32_t& tick) {
+    std::memcpy(&timeNs, in, sizeof(timeNs));
+    std::memcpy(&tick, in + 8, sizeof(tick));
+}
+
+double Percentile99(std::vector<uint64_t>& samples) {
+    if (samples.empty()) return 0.0;
+    const size_t index = samples.size() * 99 / 100;
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+    return static_cast<double>(samples[index]) / 1000.0;
+}
+
+/**
+ * @brief Non-blocking UDP sockets standing in for remote players
+ */
+struct ClientFarm {
+    std::vector<int> sockets;
+    std::vector<uint32_t> answeredTick;
+    sockaddr_in server{};
+    uint64_t datagramsReceived = 0;
+
+    ClientFarm(size_t count, uint16_t serverPort) {
+        server.sin_family = AF_INET;
+        server.sin_port = htons(serverPort);
+        inet_pton(AF_INET, "127.0.0.1", &server.sin_addr);
+        for (size_t i = 0; i < count; ++i) {
+            const int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+            sockets.push_back(fd);
+        }
+        answeredTick.assign(count, 0);
+    }
+
+    ~ClientFarm() {
+        for (int fd : sockets) close(fd);
+    }
+
+    /**
+     * @brief Each client sends one input; framed=true adds the I/O thread's length prefix
+     */
+    void SendInputs(uint32_t tick, bool framed) {
+        uint8_t datagram[2 + kInputSize] = {};
+        uint8_t* input = datagram;
+        size_t size = kInputSize;
+        if (framed) {
+            datagram[0] = static_cast<uint8_t>(kInputSize);
+            input = datagram + 2;
+            size += 2;
+        }
+        for (int fd : sockets) {
+            WriteStamp(input, NowNs(), tick);
+            sendto(fd, datagram, size, 0, reinterpret_cast<const sockaddr*>(&server), sizeof(server));
+        }
+    }
+
+    /**
+     * @brief Read answers until every client saw its stamped event of this tick
+     */
+    void ReceiveAnswers(uint32_t tick, bool framed, std::vector<uint64_t>& latencies) {
+        uint8_t datagram[NetBuffer::kCapacity];
+        size_t pending = sockets.size();
+        const auto deadline = std::chrono::steady_clock::now() + kTickTimeout;
+        while (pending > 0 && std::chrono::steady_clock::now() < deadline) {
+            for (size_t i = 0; i < sockets.size(); ++i) {
+                ssize_t size;
+                while ((size = recv(sockets[i], datagram, sizeof(datagram), 0)) > 0) {
+                    datagramsReceived++;
+                    const uint8_t* event = framed ? datagram + 2 : datagram;
+                    uint64_t sentNs;
+                    uint32_t eventTick;
+                    ReadStamp(event, sentNs, eventTick);
+                    if (event[12] == 0 && eventTick == tick && answeredTick[i] != tick) {
+                        answeredTick[i] = tick;
+                        latencies.push_back(NowNs() - sentNs);
+                        pending--;
+                    }
+                }
+            }
+            if (pending > 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+void ReportCounters(benchmark::State& state, uint64_t datagrams, uint64_t serverSent,
+                    std::vector<uint64_t>& inbound, std::vector<uint64_t>& outbound) {
+    const double messages = static_cast<double>(state.iterations()) * static_cast<double>(state.range(0)) *
+                            static_cast<double>(1 + kEventsPerClient);
+    state.counters["packets/s"] = benchmark::Counter(static_cast<double>(datagrams), benchmark::Counter::kIsRate);
+    state.counters["msgs/s"] = benchmark::Counter(messages, benchmark::Counter::kIsRate);
+    state.counters["in_p99_us"] = Percentile99(inbound);
+    state.counters["out_p99_us"] = Percentile99(outbound);
+    state.counters["dgrams/tick"] = static_cast<double>(serverSent) / static_cast<double>(state.iterations());
+}
+
+} // namespace
+
+// ============================================================================
+// Epoll I/O Thread
+// ============================================================================
+
+static void BM_NetIO_Tick_Epoll(benchmark::State& state) {
+    const size_t clientCount = static_cast<size_t>(state.range(0));
+    NetworkIOThread server;
+    if (!server.Listen(0)) {
+        state.SkipWithError("Listen failed");
+        return;
+    }
+    ClientFarm clients(clientCount, server.GetLocalPort());
+
+    std::vector<uint32_t> inputFrom;
+    std::vector<uint64_t> inbound;
+    std::vector<uint64_t> outbound;
+    uint8_t event[kEventSize] = {};
+    uint32_t tick = 0;
+
+    for (auto _ : state) {
+        ++tick;
+        clients.SendInputs(tick, true);
+
+        // Game thread: collect this tick's inputs
+        inputFrom.clear();
+        const auto deadline = std::chrono::steady_clock::now() + kTickTimeout;
+        while (inputFrom.size() < clientCount && std::chrono::steady_clock::now() < deadline) {
+            NetBuffer* buffer = server.Poll();
+            if (!buffer) {
+                std::this_thread::yield();
+                continue;
+            }
+            NetworkIOThread::ForEachMessage(*buffer, [&](std::span<const uint8_t> input) {
+                uint64_t sentNs;
+                uint32_t inputTick;
+                ReadStamp(input.data(), sentNs, inputTick);
+                inbound.push_back(NowNs() - sentNs);
+                if (inputTick == tick) inputFrom.push_back(buffer->clientId);
+            });
+            server.Release(buffer);
+        }
+
+        // Game thread: answer every client, then flush once
+        for (uint32_t clientId : inputFrom) {
+            for (size_t e = 0; e < kEventsPerClient; ++e) {
+                WriteStamp(event, NowNs(), tick);
+                event[12] = static_cast<uint8_t>(e);
+                server.Send(clientId, event);
+            }
+        }
+        server.Flush();
+
+        clients.ReceiveAnswers(tick, true, outbound);
+    }
+
+    const NetworkIOThread::Stats stats = server.GetStats();
+    ReportCounters(state, stats.datagramsReceived + clients.datagramsReceived, stats.datagramsSent, inbound, outbound);
+    state.counters["syscalls/tick"] = static_cast<double>(stats.sendCalls + stats.receiveCalls) /
+                                      static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_NetIO_Tick_Epoll)->Arg(256)->Arg(512)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// ============================================================================
+// Legacy Game-Thread Sockets
+// ============================================================================
+
+static void BM_NetIO_Tick_Legacy(benchmark::State& state) {
+    const size_t clientCount = static_cast<size_t>(state.range(0));
+    const int server = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    int bufferBytes = 4 << 20;
+    setsockopt(server, SOL_SOCKET, SO_RCVBUF, &bufferBytes, sizeof(bufferBytes));
+    setsockopt(server, SOL_SOCKET, SO_SNDBUF, &bufferBytes, sizeof(bufferBytes));
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = INADDR_ANY;
+    bind(server, reinterpret_cast<sockaddr*>(&local), sizeof(local));
+    socklen_t localLength = sizeof(local);
+    getsockname(server, reinterpret_cast<sockaddr*>(&local), &localLength);
+    ClientFarm clients(clientCount, ntohs(local.sin_port));
+
+    std::vector<sockaddr_in> peers;
+    std::vector<uint32_t> inputFrom;
+    std::vector<uint64_t> inbound;
+    std::vector<uint64_t> outbound;
+    uint64_t received = 0;
+    uint64_t sent = 0;
+    uint32_t tick = 0;
+
+    for (auto _ : state) {
+        ++tick;
+        clients.SendInputs(tick, false);
+
+        inputFrom.clear();
+        const auto deadline = std::chrono::steady_clock::now() + kTickTimeout;
+        while (inputFrom.size() < clientCount && std::chrono::steady_clock::now() < deadline) {
+            std::vector<uint8_t> buffer(65536);
+            sockaddr_in from{};
+            socklen_t fromLength = sizeof(from);
+            const ssize_t size = recvfrom(server, buffer.data(), buffer.size(), 0,
+                                          reinterpret_cast<sockaddr*>(&from), &fromLength);
+            if (size <= 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            received++;
+            std::vector<uint8_t> input(buffer.begin(), buffer.begin() + size);
+
+            uint32_t clientId = 0;
+            for (size_t i = 0; i < peers.size(); ++i) {
+                if (peers[i].sin_addr.s_addr == from.sin_addr.s_addr && peers[i].sin_port == from.sin_port) {
+                    clientId = static_cast<uint32_t>(i + 1);
+                    break;
+                }
+            }
+            if (clientId == 0) {
+                peers.push_back(from);
+                clientId = static_cast<uint32_t>(peers.size());
+            }
+
+            uint64_t sentNs;
+            uint32_t inputTick;
+            ReadStamp(input.data(), sentNs, inputTick);
+            inbound.push_back(NowNs() - sentNs);
+            if (inputTick == tick) inputFrom.push_back(clientId);
+        }
+
+        for (uint32_t clientId : inputFrom) {
+            const sockaddr_in& peer = peers[clientId - 1];
+            for (size_t e = 0; e < kEventsPerClient; ++e) {
+                std::vector<uint8_t> event(kEventSize);
+                WriteStamp(event.data(), NowNs(), tick);
+                event[12] = static_cast<uint8_t>(e);
+                sendto(server, event.data(), event.size(), 0, reinterpret_cast<const sockaddr*>(&peer), sizeof(peer));
+                sent++;
+            }
+        }
+
+        clients.ReceiveAnswers(tick, false, outbound);
+    }
+
+    close(server);
+    ReportCounters(state, received + clients.datagramsReceived, sent, inbound, outbound);
+    state.counters["syscalls/tick"] = static_cast<double>(received + sent) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_NetIO_Tick_Legacy)->Arg(256)->Arg(512)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+#endif
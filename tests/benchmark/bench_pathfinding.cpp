@@ -0,0 +1,182 @@
+/**
+ * @file bench_pathfinding.cpp
+ * @brief Performance benchmarks for A* on Graph, frozen CompactGraph and HPA*
+ *
+ * All variants solve the same fixed-seed start/goal pairs on a static
+ * 1024x1024 grid and a proximity-connected random graph.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "pathfinding/CompactGraph.hpp"
+#include "pathfinding/HierarchicalGraph.hpp"
+#include "pathfinding/Pathfinder.hpp"
+#include "math/Random.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr int kQueryCount = 16;
+
+struct BenchGraph {
+    Graph graph;
+    CompactGraph compact;
+    HierarchicalGraph hierarchy;
+    std::vector<std::pair<int, int>> queries;
+};
+
+void MakeQueries(BenchGraph& bench, int nodeCount) {
+    Random::Seed(7);
+    for (int i = 0; i < kQueryCount; ++i) {
+        bench.queries.emplace_back(Random::Range(0, nodeCount - 1), Random::Range(0, nodeCount - 1));
+    }
+}
+
+// Graphs are built once per process; BuildGrid(1024, 1024) takes seconds
+BenchGraph& GridGraph() {
+    static const std::unique_ptr<BenchGraph> bench = [] {
+        auto b = std::make_unique<BenchGraph>();
+        b->graph.BuildGrid(1024, 1024);
+        b->compact = b->graph.Freeze();
+        b->hierarchy.Build(b->graph);
+        MakeQueries(*b, 1024 * 1024);
+        return b;
+    }();
+    return *bench;
+}
+
+BenchGraph& RandomGraph() {
+    static const std::unique_ptr<BenchGraph> bench = [] {
+        auto b = std::make_unique<BenchGraph>();
+        Random::Seed(42);
+        b->graph.BuildRandom(4000, 3.5f, 200.0f);
+        b->compact = b->graph.Freeze();
+        b->hierarchy.Build(b->graph, HierarchicalGraphConfig{25.0f});
+        MakeQueries(*b, 4000);
+        return b;
+    }();
+    return *bench;
+}
+
+void RunLegacy(benchmark::State& state, const BenchGraph& bench) {
+    size_t query = 0;
+    int64_t explored = 0;
+    for (auto _ : state) {
+        const auto& [start, goal] = bench.queries[query++ % bench.queries.size()];
+        PathResult result = Pathfinder::AStar(bench.graph, start, goal);
+        explored += result.nodesExplored;
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["NodesExplored"] = benchmark::Counter(
+        static_cast<double>(explored), benchmark::Counter::kIsRate);
+}
+
+void RunCompact(benchmark::State& state, const BenchGraph& bench) {
+    AStarSearchContext& context = AStarSearchContext::ForCurrentThread();
+    std::vector<CompactGraph::Index> path;
+    size_t query = 0;
+    int64_t explored = 0;
+    for (auto _ : state) {
+        const auto& [start, goal] = bench.queries[query++ % bench.queries.size()];
+        CompactSearchResult result = context.FindPath(
+            bench.compact, bench.compact.ToIndex(start), bench.compact.ToIndex(goal), {}, path);
+        explored += result.nodesExplored;
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(path.data());
+    }
+    state.counters["NodesExplored"] = benchmark::Counter(
+        static_cast<double>(explored), benchmark::Counter::kIsRate);
+}
+
+void RunHierarchical(benchmark::State& state, const BenchGraph& bench, bool refine) {
+    size_t query = 0;
+    int64_t explored = 0;
+    for (auto _ : state) {
+        const auto& [start, goal] = bench.queries[query++ % bench.queries.size()];
+        PathResult result = bench.hierarchy.FindPath(start, goal, refine);
+        explored += result.nodesExplored;
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["NodesExplored"] = benchmark::Counter(
+        static_cast<double>(explored), benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+// =============================================================================
+// Grid Benchmarks
+// =============================================================================
+
+static void BM_AStar_Grid1024_Graph(benchmark::State& state) {
+    RunLegacy(state, GridGraph());
+}
+BENCHMARK(BM_AStar_Grid1024_Graph)->Unit(benchmark::kMillisecond);
+
+static void BM_AStar_Grid1024_CompactGraph(benchmark::State& state) {
+    RunCompact(state, GridGraph());
+}
+BENCHMARK(BM_AStar_Grid1024_CompactGraph)->Unit(benchmark::kMillisecond);
+
+static void BM_AStar_Grid1024_Hierarchical(benchmark::State& state) {
+    RunHierarchical(state, GridGraph(), true);
+}
+BENCHMARK(BM_AStar_Grid1024_Hierarchical)->Unit(benchmark::kMicrosecond);
+
+static void BM_AStar_Grid1024_HierarchicalAbstract(benchmark::State& state) {
+    RunHierarchical(state, GridGraph(), false);
+}
+BENCHMARK(BM_AStar_Grid1024_HierarchicalAbstract)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Toggle one node (a building placed and removed) and repair the hierarchy
+ */
+static void BM_Hierarchical_Grid1024_LocalUpdate(benchmark::State& state) {
+    HierarchicalGraph& hierarchy = GridGraph().hierarchy;
+    const int nodeId = 512 * 1024 + 520;
+    bool walkable = false;
+    for (auto _ : state) {
+        hierarchy.SetNodeWalkable(nodeId, walkable);
+        hierarchy.Update();
+        walkable = !walkable;
+    }
+    hierarchy.SetNodeWalkable(nodeId, true);
+    hierarchy.Update();
+}
+BENCHMARK(BM_Hierarchical_Grid1024_LocalUpdate)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// Random Graph Benchmarks
+// =============================================================================
+
+static void BM_AStar_Random_Graph(benchmark::State& state) {
+    RunLegacy(state, RandomGraph());
+}
+BENCHMARK(BM_AStar_Random_Graph)->Unit(benchmark::kMicrosecond);
+
+static void BM_AStar_Random_CompactGraph(benchmark::State& state) {
+    RunCompact(state, RandomGraph());
+}
+BENCHMARK(BM_AStar_Random_CompactGraph)->Unit(benchmark::kMicrosecond);
+
+static void BM_AStar_Random_Hierarchical(benchmark::State& state) {
+    RunHierarchical(state, RandomGraph(), true);
+}
+BENCHMARK(BM_AStar_Random_Hierarchical)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// Freeze Cost
+// =============================================================================
+
+static void BM_Graph_Freeze_Random(benchmark::State& state) {
+    const BenchGraph& bench = RandomGraph();
+    for (auto _ : state) {
+        CompactGraph compact = bench.graph.Freeze();
+        benchmark::DoNotOptimize(compact);
+    }
+}
+BENCHMARK(BM_Graph_Freeze_Random)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,299 @@
+/**
+ * @file bench_persistence.cpp
+ * @brief Benchmarks for WorldDatabase entity loads
+ *
+ * Each world holds N entities (10k / 100k) spread over a 2048 x 2048 area,
+ * so a radius 64 query around the centre touches a "town" of ~3 * N / 1000
+ * entities. "PerRow" repeats the previous shape of the radius query: collect
+ * R-tree hits, then one LoadEntity() round trip per hit. Counters report rows
+ * returned per call and rows/s.
+ *
+ * The autosave benchmarks time what the game thread pays to save 1000 moved
+ * entities: a synchronous BeginBatch()/SaveEntity()/EndBatch() versus
+ * QueueSaveEntity() calls picked up by the write-behind thread.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "persistence/WorldDatabase.hpp"
+
+#include <sqlite3.h>
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr float kWorldExtent = 2048.0f;
+constexpr float kChunkSize = 32.0f;
+constexpr float kTownRadius = 64.0f;
+constexpr size_t kBlobSize = 96;
+
+/**
+ * @brief A populated world database, built once per entity count
+ */
+struct BenchWorld {
+    std::string path;
+    WorldDatabase db;
+    sqlite3* raw = nullptr;            // Second connection for the per-row baseline's R-tree scan
+    std::vector<int> entityIds;
+
+    ~BenchWorld() {
+        if (raw) sqlite3_close(raw);
+        db.Shutdown();
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + "-wal");
+        std::filesystem::remove(path + "-shm");
+    }
+};
+
+bool CreateSchema(const std::string& path) {
+    std::ifstream schemaFile(NOVA_WORLD_SCHEMA_PATH);
+    if (!schemaFile) return false;
+    std::stringstream schema;
+    schema << schemaFile.rdbuf();
+
+    sqlite3* db = nullptr;
+    if (sqlite3_open(path.c_str(), &db) != SQLITE_OK) {
+        sqlite3_close(db);
+        return false;
+    }
+    const bool ok = sqlite3_exec(db, schema.str().c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+    sqlite3_close(db);
+    return ok;
+}
+
+BenchWorld* GetWorld(size_t entityCount) {
+    static std::map<size_t, std::unique_ptr<BenchWorld>> worlds;
+    auto it = worlds.find(entityCount);
+    if (it != worlds.end()) return it->second.get();
+
+    auto world = std::make_unique<BenchWorld>();
+    world->path = (std::filesystem::temp_directory_path() /
+                   ("nova_bench_world_" + std::to_string(entityCount) + ".db")).string();
+    std::filesystem::remove(world->path);
+    if (!CreateSchema(world->path) || !world->db.Initialize(world->path)) return nullptr;
+
+    const int worldId = world->db.CreateWorld("bench", 42);
+    if (worldId < 0 || !world->db.LoadWorld(worldId)) return nullptr;
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(-kWorldExtent * 0.5f, kWorldExtent * 0.5f);
+    const char* types[] = {"npc", "building", "item"};
+
+    Entity entity;
+    entity.entitySubtype = "bench";
+    entity.data.assign(kBlobSize, 0x5A);
+    world->db.BeginTransaction();
+    for (size_t i = 0; i < entityCount; ++i) {
+        entity.entityType = types[i % 3];
+        entity.position = glm::vec3(coord(rng), 0.0f, coord(rng));
+        entity.chunkPos = glm::ivec3(static_cast<int>(std::floor(entity.position.x / kChunkSize)), 0,
+                                     static_cast<int>(std::floor(entity.position.z / kChunkSize)));
+        const int id = world->db.SaveEntity(entity);
+        if (id >= 0) world->entityIds.push_back(id);
+    }
+    world->db.Commit();
+
+    if (sqlite3_open_v2(world->path.c_str(), &world->raw, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        return nullptr;
+    }
+    return worlds.emplace(entityCount, std::move(world)).first->second.get();
+}
+
+void ReportRows(benchmark::State& state, size_t rows) {
+    state.counters["rows"] = static_cast<double>(rows);
+    state.counters["rows/s"] = benchmark::Counter(static_cast<double>(rows) * static_cast<double>(state.iterations()),
+                                                  benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+// ============================================================================
+// Radius Query
+// ============================================================================
+
+static void BM_WorldDB_RadiusQuery(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+
+    size_t rows = 0;
+    for (auto _ : state) {
+        EntityQueryResult result = world->db.QueryEntitiesInRadius(glm::vec3(0.0f), kTownRadius);
+        rows = result.entities.size();
+        benchmark::DoNotOptimize(result);
+    }
+    ReportRows(state, rows);
+}
+BENCHMARK(BM_WorldDB_RadiusQuery)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_WorldDB_RadiusQuery_PerRow(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+
+    size_t rows = 0;
+    for (auto _ : state) {
+        // Statement prepared per call, then one LoadEntity per hit, as before
+        sqlite3_stmt* stmt = nullptr;
+        sqlite3_prepare_v2(world->raw, R"(
+            SELECT id FROM EntitySpatialIndex
+            WHERE min_x <= ? AND max_x >= ? AND min_y <= ? AND max_y >= ? AND min_z <= ? AND max_z >= ?
+        )", -1, &stmt, nullptr);
+        sqlite3_bind_double(stmt, 1, kTownRadius);
+        sqlite3_bind_double(stmt, 2, -kTownRadius);
+        sqlite3_bind_double(stmt, 3, kTownRadius);
+        sqlite3_bind_double(stmt, 4, -kTownRadius);
+        sqlite3_bind_double(stmt, 5, kTownRadius);
+        sqlite3_bind_double(stmt, 6, -kTownRadius);
+
+        std::vector<Entity> entities;
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            Entity entity = world->db.LoadEntity(sqlite3_column_int(stmt, 0));
+            if (glm::length(entity.position) <= kTownRadius) {
+                entities.push_back(std::move(entity));
+            }
+        }
+        sqlite3_finalize(stmt);
+        rows = entities.size();
+        benchmark::DoNotOptimize(entities);
+    }
+    ReportRows(state, rows);
+}
+BENCHMARK(BM_WorldDB_RadiusQuery_PerRow)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Chunk and Bulk Loads
+// ============================================================================
+
+static void BM_WorldDB_LoadEntitiesInChunk(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+
+    size_t rows = 0;
+    for (auto _ : state) {
+        rows = 0;
+        for (int x = -2; x < 2; ++x) {
+            for (int z = -2; z < 2; ++z) {
+                std::vector<Entity> entities = world->db.LoadEntitiesInChunk(x, 0, z);
+                rows += entities.size();
+                benchmark::DoNotOptimize(entities);
+            }
+        }
+    }
+    ReportRows(state, rows);
+}
+BENCHMARK(BM_WorldDB_LoadEntitiesInChunk)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_WorldDB_LoadEntities(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+
+    // 1000 scattered IDs, the shape of a player's saved surroundings
+    std::vector<int> ids;
+    for (size_t i = 0; i < world->entityIds.size(); i += world->entityIds.size() / 1000) {
+        ids.push_back(world->entityIds[i]);
+    }
+
+    for (auto _ : state) {
+        std::vector<Entity> entities = world->db.LoadEntities(ids);
+        benchmark::DoNotOptimize(entities);
+    }
+    ReportRows(state, ids.size());
+}
+BENCHMARK(BM_WorldDB_LoadEntities)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_WorldDB_LoadEntity_Loop(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+
+    std::vector<int> ids;
+    for (size_t i = 0; i < world->entityIds.size(); i += world->entityIds.size() / 1000) {
+        ids.push_back(world->entityIds[i]);
+    }
+
+    for (auto _ : state) {
+        std::vector<Entity> entities;
+        entities.reserve(ids.size());
+        for (int id : ids) {
+            entities.push_back(world->db.LoadEntity(id));
+        }
+        benchmark::DoNotOptimize(entities);
+    }
+    ReportRows(state, ids.size());
+}
+BENCHMARK(BM_WorldDB_LoadEntity_Loop)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Autosave
+// ============================================================================
+
+static void BM_WorldDB_Autosave_Sync(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+    std::vector<Entity> entities = world->db.LoadEntities(std::span<const int>(world->entityIds.data(), 1000));
+
+    for (auto _ : state) {
+        world->db.BeginBatch();
+        for (Entity& entity : entities) {
+            entity.position.y += 1.0f;
+            world->db.SaveEntity(entity);
+        }
+        world->db.EndBatch();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(entities.size()));
+}
+BENCHMARK(BM_WorldDB_Autosave_Sync)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_WorldDB_Autosave_WriteBehind(benchmark::State& state) {
+    BenchWorld* world = GetWorld(static_cast<size_t>(state.range(0)));
+    if (!world) {
+        state.SkipWithError("Failed to build world database");
+        return;
+    }
+    std::vector<Entity> entities = world->db.LoadEntities(std::span<const int>(world->entityIds.data(), 1000));
+    world->db.StartWriteBehind();
+
+    for (auto _ : state) {
+        for (const Entity& entity : entities) {
+            Entity moved = entity;
+            moved.position.y += 1.0f;
+            world->db.QueueSaveEntity(std::move(moved));
+        }
+    }
+
+    world->db.FlushAndWait();
+    const DatabaseStats stats = world->db.GetStatistics();
+    world->db.StopWriteBehind();
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(entities.size()));
+    state.counters["coalescing"] = stats.coalescingRatio;
+    state.counters["commit_ms"] = stats.avgCommitLatencyMs;
+}
+BENCHMARK(BM_WorldDB_Autosave_WriteBehind)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
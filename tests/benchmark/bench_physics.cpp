@@ -0,0 +1,382 @@
+/**
+ * @file bench_physics.cpp
+ * @brief Broad-phase and world step benchmarks over body counts
+ *
+ * The legacy benchmark reproduces the per-step spatial hash rebuild that
+ * PhysicsWorld used before the persistent sweep-and-prune broad phase, so
+ * both can be compared on the same scene. The island benchmark compares the
+ * serial and JobSystem-parallel contact solve on many independent stacks.
+ * The integration benchmarks compare the old per-body pointer-chasing loops
+ * with the SoA body store kernels, reported in bodies/us.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "core/JobSystem.hpp"
+#include "physics/BodyStore.hpp"
+#include "physics/BroadPhase.hpp"
+#include "physics/PhysicsWorld.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace Nova;
+
+// =============================================================================
+// Scene
+// =============================================================================
+
+namespace {
+
+/**
+ * @brief RTS-like crowd: units on a plane, a fraction moving each step
+ */
+struct CrowdScene {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> velocities;
+    std::vector<AABB> bounds;
+    std::mt19937 rng{42};
+
+    explicit CrowdScene(size_t count) {
+        // Keep density constant so pair counts scale linearly with body count
+        const float extent = std::sqrt(static_cast<float>(count)) * 3.0f;
+        std::uniform_real_distribution<float> pos(0.0f, extent);
+        std::uniform_real_distribution<float> vel(-1.0f, 1.0f);
+
+        for (size_t i = 0; i < count; ++i) {
+            positions.emplace_back(pos(rng), 0.5f, pos(rng));
+            velocities.emplace_back(vel(rng), 0.0f, vel(rng));
+            bounds.push_back(AABB{positions.back() - glm::vec3(0.5f), positions.back() + glm::vec3(0.5f)});
+        }
+    }
+
+    void Advance(float dt) {
+        for (size_t i = 0; i < positions.size(); ++i) {
+            // A quarter of the crowd is idle at any time
+            if ((i & 3) == 0) continue;
+            positions[i] += velocities[i] * dt;
+            bounds[i] = AABB{positions[i] - glm::vec3(0.5f), positions[i] + glm::vec3(0.5f)};
+        }
+    }
+};
+
+/**
+ * @brief The spatial hash rebuild PhysicsWorld ran every step before SAP
+ */
+class LegacySpatialHash {
+public:
+    explicit LegacySpatialHash(float cellSize) : m_cellSize(cellSize) {}
+
+    size_t FindPairs(const std::vector<AABB>& bounds) {
+        m_hash.clear();
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            std::vector<glm::ivec3> cells;
+            GetCells(bounds[i], cells);
+            for (const auto& cell : cells) {
+                m_hash[HashCell(cell)].push_back(static_cast<CollisionBody::BodyId>(i + 1));
+            }
+        }
+
+        size_t pairCount = 0;
+        std::unordered_set<CollisionPair, CollisionPairHash> testedPairs;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            const auto id = static_cast<CollisionBody::BodyId>(i + 1);
+            std::vector<glm::ivec3> cells;
+            GetCells(bounds[i], cells);
+
+            for (const auto& cell : cells) {
+                auto it = m_hash.find(HashCell(cell));
+                if (it == m_hash.end()) continue;
+
+                for (auto otherId : it->second) {
+                    if (otherId == id) continue;
+                    CollisionPair pair{id, otherId};
+                    if (testedPairs.find(pair) != testedPairs.end()) continue;
+                    testedPairs.insert(pair);
+
+                    if (bounds[i].Intersects(bounds[otherId - 1])) {
+                        ++pairCount;
+                    }
+                }
+            }
+        }
+        return pairCount;
+    }
+
+private:
+    void GetCells(const AABB& aabb, std::vector<glm::ivec3>& cells) const {
+        glm::ivec3 minCell = glm::ivec3(glm::floor(aabb.min / m_cellSize));
+        glm::ivec3 maxCell = glm::ivec3(glm::floor(aabb.max / m_cellSize));
+        for (int x = minCell.x; x <= maxCell.x; ++x) {
+            for (int y = minCell.y; y <= maxCell.y; ++y) {
+                for (int z = minCell.z; z <= maxCell.z; ++z) {
+                    cells.emplace_back(x, y, z);
+                }
+            }
+        }
+    }
+
+    static size_t HashCell(const glm::ivec3& cell) {
+        size_t h = 0;
+        h ^= std::hash<int>{}(cell.x) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<int>{}(cell.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<int>{}(cell.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+
+    float m_cellSize;
+    std::unordered_map<size_t, std::vector<CollisionBody::BodyId>> m_hash;
+};
+
+/**
+ * @brief Heap-allocated body with the field layout CollisionBody had before the SoA store
+ *
+ * The cold block stands in for shapes, callbacks and contact lists, which
+ * pushed the hot fields of consecutive bodies onto different cache lines.
+ */
+struct LegacyBody {
+    BodyType type = BodyType::Dynamic;
+    bool enabled = true;
+    bool sleeping = false;
+    float sleepTimer = 0.0f;
+    glm::vec3 position{0.0f};
+    glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::vec3 linearVelocity{0.0f};
+    glm::vec3 angularVelocity{0.0f};
+    glm::vec3 force{0.0f};
+    glm::vec3 torque{0.0f};
+    float inverseMass = 1.0f;
+    glm::mat3 inverseInertia{1.0f};
+    float linearDamping = 0.01f;
+    float angularDamping = 0.05f;
+    float gravityScale = 1.0f;
+    bool boundsDirty = true;
+    char cold[320] = {};
+};
+
+/**
+ * @brief The per-body integration loops PhysicsWorld ran before the body store
+ */
+void LegacyIntegrate(std::vector<std::unique_ptr<LegacyBody>>& bodies, const glm::vec3& gravity, float dt) {
+    for (auto& body : bodies) {
+        if (!body->enabled || body->sleeping || body->type != BodyType::Dynamic) continue;
+        body->linearVelocity += (gravity * body->gravityScale + body->force * body->inverseMass) * dt;
+        body->angularVelocity += body->inverseInertia * body->torque * dt;
+        body->linearVelocity *= std::pow(1.0f - body->linearDamping, dt);
+        body->angularVelocity *= std::pow(1.0f - body->angularDamping, dt);
+        body->force = glm::vec3(0.0f);
+        body->torque = glm::vec3(0.0f);
+    }
+
+    for (auto& body : bodies) {
+        if (!body->enabled || body->sleeping || body->type == BodyType::Static) continue;
+        body->position += body->linearVelocity * dt;
+        const glm::vec3 w = body->angularVelocity;
+        if (glm::dot(w, w) > 1e-6f) {
+            glm::quat spin(0.0f, w.x, w.y, w.z);
+            body->rotation = glm::normalize(body->rotation + (spin * body->rotation) * (dt * 0.5f));
+        }
+        body->boundsDirty = true;
+    }
+
+    for (auto& body : bodies) {
+        if (!body->enabled || body->sleeping || body->type != BodyType::Dynamic) continue;
+        const bool slow = glm::dot(body->linearVelocity, body->linearVelocity) < 0.01f &&
+                          glm::dot(body->angularVelocity, body->angularVelocity) < 0.01f;
+        body->sleepTimer = slow ? body->sleepTimer + dt : 0.0f;
+    }
+}
+
+constexpr float kStepDt = 1.0f / 60.0f;
+
+} // namespace
+
+// =============================================================================
+// Broad Phase
+// =============================================================================
+
+static void BM_BroadPhase_LegacySpatialHash(benchmark::State& state) {
+    CrowdScene scene(static_cast<size_t>(state.range(0)));
+    LegacySpatialHash hash(10.0f);
+
+    for (auto _ : state) {
+        scene.Advance(kStepDt);
+        benchmark::DoNotOptimize(hash.FindPairs(scene.bounds));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BroadPhase_LegacySpatialHash)->RangeMultiplier(2)->Range(1 << 10, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+static void BM_BroadPhase_SweepAndPrune(benchmark::State& state) {
+    CrowdScene scene(static_cast<size_t>(state.range(0)));
+    SweepAndPruneBroadPhase broadPhase(0.1f);
+
+    std::vector<SweepAndPruneBroadPhase::ProxyId> proxies;
+    for (size_t i = 0; i < scene.bounds.size(); ++i) {
+        proxies.push_back(broadPhase.CreateProxy(scene.bounds[i], static_cast<CollisionBody::BodyId>(i + 1)));
+    }
+    broadPhase.Update();
+
+    size_t deltas = 0;
+    for (auto _ : state) {
+        scene.Advance(kStepDt);
+        for (size_t i = 0; i < proxies.size(); ++i) {
+            broadPhase.MoveProxy(proxies[i], scene.bounds[i]);
+        }
+        broadPhase.Update();
+        deltas += broadPhase.GetAddedPairs().size() + broadPhase.GetRemovedPairs().size();
+        benchmark::DoNotOptimize(broadPhase.GetPairs().size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["pairs"] = static_cast<double>(broadPhase.GetPairs().size());
+    state.counters["deltas/step"] = benchmark::Counter(static_cast<double>(deltas) / state.iterations());
+}
+BENCHMARK(BM_BroadPhase_SweepAndPrune)->RangeMultiplier(2)->Range(1 << 10, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// World Step
+// =============================================================================
+
+static void BM_PhysicsWorld_FixedStep(benchmark::State& state) {
+    PhysicsWorldConfig config;
+    config.gravity = glm::vec3(0.0f);
+    config.velocityIterations = 1;
+    PhysicsWorld world(config);
+
+    CrowdScene scene(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < scene.positions.size(); ++i) {
+        auto* body = world.CreateBody(BodyType::Dynamic);
+        body->AddShape(CollisionShape::CreateSphere(0.5f));
+        body->SetPosition(scene.positions[i]);
+        body->SetLinearVelocity(scene.velocities[i]);
+        body->SetLinearDamping(0.0f);
+    }
+
+    for (auto _ : state) {
+        world.FixedStep();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["broadPhasePairs"] = static_cast<double>(world.GetStats().broadPhasePairs);
+}
+BENCHMARK(BM_PhysicsWorld_FixedStep)->RangeMultiplier(2)->Range(1 << 10, 1 << 13)->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// Contact Islands
+// =============================================================================
+
+/**
+ * @brief Collapsing-rubble scene: many short box stacks, each its own island
+ *
+ * range(0) is the stack count, range(1) toggles parallel island solving.
+ */
+static void BM_PhysicsWorld_IslandStacks(benchmark::State& state) {
+    auto& js = JobSystem::Instance();
+    if (!js.IsInitialized()) {
+        (void)js.Initialize();
+    }
+
+    PhysicsWorldConfig config;
+    config.parallelIslands = state.range(1) != 0;
+    config.linearSleepThreshold = 0.0f;  // Keep every island awake
+    config.angularSleepThreshold = 0.0f;
+    PhysicsWorld world(config);
+
+    const int stacks = static_cast<int>(state.range(0));
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(stacks))));
+
+    auto* ground = world.CreateBody(BodyType::Static);
+    ground->AddShape(CollisionShape::CreateBox(glm::vec3(side * 2.0f + 2.0f, 0.5f, side * 2.0f + 2.0f)));
+    ground->SetPosition(glm::vec3(side, -0.5f, side));
+
+    for (int s = 0; s < stacks; ++s) {
+        const float x = static_cast<float>(s % side) * 2.0f;
+        const float z = static_cast<float>(s / side) * 2.0f;
+        for (int level = 0; level < 4; ++level) {
+            auto* box = world.CreateBody(BodyType::Dynamic);
+            box->AddShape(CollisionShape::CreateBox(glm::vec3(0.5f)));
+            box->SetPosition(glm::vec3(x, 0.5f + static_cast<float>(level), z));
+        }
+    }
+
+    // Settle so the measured steps have persistent, warm-started manifolds
+    for (int i = 0; i < 30; ++i) {
+        world.FixedStep();
+    }
+
+    for (auto _ : state) {
+        world.FixedStep();
+    }
+
+    state.SetItemsProcessed(state.iterations() * stacks);
+    state.counters["islands"] = static_cast<double>(world.GetStats().awakeIslandCount);
+    state.counters["contacts"] = static_cast<double>(world.GetStats().contactCount);
+}
+BENCHMARK(BM_PhysicsWorld_IslandStacks)
+    ->ArgsProduct({{64, 256, 1024}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// =============================================================================
+// Body Integration
+// =============================================================================
+
+// Millions of bodies per second, i.e. bodies/us
+static void SetBodiesPerMicrosecond(benchmark::State& state) {
+    state.counters["MBodies"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * state.range(0)) / 1e6, benchmark::Counter::kIsRate);
+}
+
+static void BM_Integration_LegacyPerBody(benchmark::State& state) {
+    CrowdScene scene(static_cast<size_t>(state.range(0)));
+    std::vector<std::unique_ptr<LegacyBody>> bodies;
+    for (size_t i = 0; i < scene.positions.size(); ++i) {
+        auto body = std::make_unique<LegacyBody>();
+        body->position = scene.positions[i];
+        body->linearVelocity = scene.velocities[i];
+        body->angularVelocity = glm::vec3(0.0f, scene.velocities[i].x, 0.0f);
+        body->sleeping = (i & 3) == 0;
+        bodies.push_back(std::move(body));
+    }
+
+    const glm::vec3 gravity(0.0f, -9.81f, 0.0f);
+    for (auto _ : state) {
+        LegacyIntegrate(bodies, gravity, kStepDt);
+        benchmark::DoNotOptimize(bodies.front()->position);
+    }
+
+    SetBodiesPerMicrosecond(state);
+}
+BENCHMARK(BM_Integration_LegacyPerBody)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+
+static void BM_Integration_BodyStore(benchmark::State& state) {
+    CrowdScene scene(static_cast<size_t>(state.range(0)));
+    std::vector<std::unique_ptr<CollisionBody>> bodies;
+    PhysicsBodyStore store;
+    for (size_t i = 0; i < scene.positions.size(); ++i) {
+        auto body = std::make_unique<CollisionBody>(BodyType::Dynamic);
+        body->SetPosition(scene.positions[i]);
+        body->SetLinearVelocity(scene.velocities[i]);
+        body->SetAngularVelocity(glm::vec3(0.0f, scene.velocities[i].x, 0.0f));
+        body->SetSleeping((i & 3) == 0);
+        store.Attach(*body);
+        bodies.push_back(std::move(body));
+    }
+
+    const glm::vec3 gravity(0.0f, -9.81f, 0.0f);
+    for (auto _ : state) {
+        store.IntegrateForces(gravity, kStepDt);
+        store.IntegratePositions(kStepDt);
+        store.UpdateSleepTimers(0.1f, 0.1f, kStepDt);
+        benchmark::DoNotOptimize(store.GetPosition(0));
+    }
+
+    SetBodiesPerMicrosecond(state);
+    store.Clear();
+}
+BENCHMARK(BM_Integration_BodyStore)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
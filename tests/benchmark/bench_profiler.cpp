@@ -0,0 +1,70 @@
+/**
+ * @file bench_profiler.cpp
+ * @brief Per-scope overhead of the statistics profiler vs trace capture
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "core/Profiler.hpp"
+#include "core/TraceCapture.hpp"
+
+#include <cstdio>
+#include <string>
+
+using namespace Nova;
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+static std::string BenchTracePath() {
+    return "bench_trace_capture.json";
+}
+
+// =============================================================================
+// Statistics Profiler
+// =============================================================================
+
+static void BM_Profiler_Scope(benchmark::State& state) {
+    Profiler::Instance().SetEnabled(true);
+
+    for (auto _ : state) {
+        NOVA_PROFILE_SCOPE("BenchScope");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Profiler_Scope)->ThreadRange(1, 8);
+
+// =============================================================================
+// Trace Capture
+// =============================================================================
+
+static void BM_TraceCapture_ScopeIdle(benchmark::State& state) {
+    // Instrumented but no session running: a single relaxed load
+    for (auto _ : state) {
+        NOVA_TRACE_SCOPE("BenchScope");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceCapture_ScopeIdle);
+
+static void BM_TraceCapture_ScopeCapturing(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        TraceCaptureConfig config;
+        config.filepath = BenchTracePath();
+        config.flushIntervalMs = 10;
+        TraceCapture::Instance().Start(config);
+    }
+
+    for (auto _ : state) {
+        NOVA_TRACE_SCOPE("BenchScope");
+        benchmark::ClobberMemory();
+    }
+
+    if (state.thread_index() == 0) {
+        TraceCapture::Instance().Stop();
+        state.counters["dropped"] = static_cast<double>(TraceCapture::Instance().GetDroppedEventCount());
+        std::remove(BenchTracePath().c_str());
+    }
+}
+BENCHMARK(BM_TraceCapture_ScopeCapturing)->ThreadRange(1, 8);
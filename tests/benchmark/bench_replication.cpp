@@ -0,0 +1,288 @@
+/**
+ * @file bench_replication.cpp
+ * @brief Performance benchmarks for the replication wire formats and interest management
+ *
+ * Compares the dynamic string-keyed event format with schema-compiled,
+ * bit-packed events on a unit move (position, rotation, velocity).
+ * "bytes/event" reports the wire size of one event.
+ *
+ * The interest benchmarks run one server tick (10% of units moving, every
+ * client selecting its updates) against a brute-force entities x clients scan.
+ *
+ * The snapshot benchmarks encode one client's view of 200 units per tick,
+ * delta-compressed against an acked baseline versus a full snapshot.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "networking/EventSchema.hpp"
+#include "networking/InterestManager.hpp"
+#include "networking/ReplicationSystem.hpp"
+#include "networking/SnapshotDelta.hpp"
+
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr const char* kSchemaType = "bench.move";
+constexpr const char* kDynamicType = "bench.move.dynamic";
+
+const EventSchema& RegisterBenchTypes() {
+    static const EventSchema* schema = [] {
+        auto& registry = EventTypeRegistry::Instance();
+
+        EventTypeConfig config;
+        config.typeName = kDynamicType;
+        config.defaultCategory = ReplicationCategory::EntityMovement;
+        config.defaultReliabilityMode = ReliabilityMode::Unreliable;
+        registry.RegisterType(config);
+
+        config.typeName = kSchemaType;
+        config.fields = {
+            {"position", FieldEncoding::QuantizedVec3, -8192.0f, 8192.0f, 20},
+            {"rotation", FieldEncoding::Quaternion, 0.0f, 1.0f, 10},
+            {"velocity", FieldEncoding::QuantizedVec3, -64.0f, 64.0f, 12}
+        };
+        registry.RegisterType(config);
+        return registry.GetSchema(kSchemaType);
+    }();
+    return *schema;
+}
+
+NetworkEvent MakeMoveEvent(const char* type) {
+    NetworkEvent event;
+    RegisterBenchTypes().InitEvent(event);
+    event.eventType = type;
+    event.eventId = 981234;
+    event.sourceEntityId = 50123;
+    event.sourceClientId = 4;
+    event.timestamp = 1700000000000ull;
+    event.properties[0].value = glm::vec3(1023.5f, 12.25f, -4096.75f);
+    event.properties[1].value = glm::quat(0.9238795f, 0.0f, 0.3826834f, 0.0f);
+    event.properties[2].value = glm::vec3(3.5f, 0.0f, -1.25f);
+    return event;
+}
+
+void SetEventCounters(benchmark::State& state, size_t bytesPerEvent) {
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytesPerEvent));
+    state.counters["bytes/event"] = static_cast<double>(bytesPerEvent);
+}
+
+constexpr float kWorldSize = 4096.0f;
+constexpr float kViewRadius = 150.0f;
+
+struct InterestScene {
+    std::vector<glm::vec3> units;
+    std::vector<glm::vec3> clients;
+    std::mt19937 rng{7};
+
+    InterestScene(size_t unitCount, size_t clientCount) {
+        std::uniform_real_distribution<float> coord(0.0f, kWorldSize);
+        for (size_t i = 0; i < unitCount; ++i) {
+            units.emplace_back(coord(rng), 0.0f, coord(rng));
+        }
+        for (size_t i = 0; i < clientCount; ++i) {
+            clients.emplace_back(coord(rng), 0.0f, coord(rng));
+        }
+    }
+
+    // Moves 10% of the units by up to 5 units, returns their indices
+    const std::vector<size_t>& Step() {
+        std::uniform_int_distribution<size_t> pick(0, units.size() - 1);
+        std::uniform_real_distribution<float> step(-5.0f, 5.0f);
+        moved.clear();
+        for (size_t i = 0; i < units.size() / 10; ++i) {
+            const size_t unit = pick(rng);
+            units[unit] += glm::vec3(step(rng), 0.0f, step(rng));
+            moved.push_back(unit);
+        }
+        return moved;
+    }
+
+    std::vector<size_t> moved;
+};
+
+} // namespace
+
+// ============================================================================
+// Encode
+// ============================================================================
+
+static void BM_Event_Serialize_Dynamic(benchmark::State& state) {
+    const NetworkEvent event = MakeMoveEvent(kDynamicType);
+    auto& replication = ReplicationSystem::Instance();
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::vector<uint8_t> data = replication.SerializeEvent(event);
+        bytes = data.size();
+        benchmark::DoNotOptimize(data.data());
+    }
+    SetEventCounters(state, bytes);
+}
+BENCHMARK(BM_Event_Serialize_Dynamic);
+
+static void BM_Event_Serialize_Schema(benchmark::State& state) {
+    const NetworkEvent event = MakeMoveEvent(kSchemaType);
+    auto& replication = ReplicationSystem::Instance();
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::vector<uint8_t> data = replication.SerializeEvent(event);
+        bytes = data.size();
+        benchmark::DoNotOptimize(data.data());
+    }
+    SetEventCounters(state, bytes);
+}
+BENCHMARK(BM_Event_Serialize_Schema);
+
+static void BM_Event_Encode_Schema(benchmark::State& state) {
+    const EventSchema& schema = RegisterBenchTypes();
+    const NetworkEvent event = MakeMoveEvent(kSchemaType);
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        bytes = EventCodec::Encode(schema, event, buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    SetEventCounters(state, bytes);
+}
+BENCHMARK(BM_Event_Encode_Schema);
+
+// ============================================================================
+// Decode
+// ============================================================================
+
+static void BM_Event_Deserialize_Dynamic(benchmark::State& state) {
+    auto& replication = ReplicationSystem::Instance();
+    const std::vector<uint8_t> data = replication.SerializeEvent(MakeMoveEvent(kDynamicType));
+
+    for (auto _ : state) {
+        NetworkEvent event = replication.DeserializeEvent(data);
+        benchmark::DoNotOptimize(event.properties.data());
+    }
+    SetEventCounters(state, data.size());
+}
+BENCHMARK(BM_Event_Deserialize_Dynamic);
+
+static void BM_Event_Decode_Schema(benchmark::State& state) {
+    const EventSchema& schema = RegisterBenchTypes();
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+    const size_t size = EventCodec::Encode(schema, MakeMoveEvent(kSchemaType), buffer);
+    const std::span<const uint8_t> data(buffer.data(), size);
+
+    // Decoding into the same event reuses its property storage
+    NetworkEvent event;
+    for (auto _ : state) {
+        EventCodec::Decode(schema, data, event);
+        benchmark::DoNotOptimize(event.properties.data());
+    }
+    SetEventCounters(state, size);
+}
+BENCHMARK(BM_Event_Decode_Schema);
+
+// ============================================================================
+// Interest Management
+// ============================================================================
+
+static void BM_Interest_Tick_Grid(benchmark::State& state) {
+    InterestScene scene(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+    InterestManager interest;
+    for (size_t i = 0; i < scene.units.size(); ++i) {
+        interest.UpdateEntity(i, scene.units[i]);
+    }
+    for (size_t c = 0; c < scene.clients.size(); ++c) {
+        interest.SetClientPosition(static_cast<uint32_t>(c), scene.clients[c], kViewRadius);
+    }
+    interest.Update(0.05f);
+
+    std::vector<uint64_t> selected;
+    size_t tests = 0;
+    for (auto _ : state) {
+        for (size_t unit : scene.Step()) {
+            interest.UpdateEntity(unit, scene.units[unit]);
+        }
+        interest.Update(0.05f);
+        tests = interest.GetStats().relevanceTests;
+        for (size_t c = 0; c < scene.clients.size(); ++c) {
+            interest.SelectUpdates(static_cast<uint32_t>(c), selected);
+            benchmark::DoNotOptimize(selected.data());
+        }
+    }
+    state.counters["tests/tick"] = static_cast<double>(tests);
+}
+BENCHMARK(BM_Interest_Tick_Grid)->Args({1500, 64})->Args({10000, 64})->Unit(benchmark::kMicrosecond);
+
+static void BM_Interest_Tick_BruteForce(benchmark::State& state) {
+    InterestScene scene(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+    const float radiusSq = kViewRadius * kViewRadius;
+
+    std::vector<uint64_t> selected;
+    for (auto _ : state) {
+        scene.Step();
+        for (const glm::vec3& client : scene.clients) {
+            selected.clear();
+            for (size_t i = 0; i < scene.units.size(); ++i) {
+                const glm::vec3 offset = scene.units[i] - client;
+                if (glm::dot(offset, offset) <= radiusSq) {
+                    selected.push_back(i);
+                }
+            }
+            benchmark::DoNotOptimize(selected.data());
+        }
+    }
+    state.counters["tests/tick"] = static_cast<double>(scene.units.size() * scene.clients.size());
+}
+BENCHMARK(BM_Interest_Tick_BruteForce)->Args({1500, 64})->Args({10000, 64})->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Snapshot Delta Compression
+// ============================================================================
+
+static void RunSnapshotBenchmark(benchmark::State& state, bool acknowledge) {
+    const EventSchema& schema = RegisterBenchTypes();
+    InterestScene scene(200, 0);
+    SnapshotHistory history;
+    NetworkEvent event = MakeMoveEvent(kSchemaType);
+    std::vector<uint64_t> visible;
+    for (size_t i = 0; i < scene.units.size(); ++i) {
+        event.properties[0].value = scene.units[i];
+        history.SetEntityState(i + 1, schema, event);
+        visible.push_back(i + 1);
+    }
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> packet{};
+    size_t bytes = 0;
+    for (auto _ : state) {
+        for (size_t unit : scene.Step()) {
+            event.properties[0].value = scene.units[unit];
+            history.SetEntityState(unit + 1, schema, event);
+        }
+        const uint32_t tick = history.Capture(0);
+        bytes = history.Encode(1, visible, packet);
+        if (acknowledge) {
+            history.Acknowledge(1, tick);
+        }
+        benchmark::DoNotOptimize(packet.data());
+    }
+    state.counters["bytes/packet"] = static_cast<double>(bytes);
+    state.counters["entities/packet"] = static_cast<double>(history.GetStats().entitiesCreated +
+                                                            history.GetStats().entitiesUpdated) /
+                                        static_cast<double>(history.GetStats().packetsEncoded);
+}
+
+static void BM_Snapshot_Tick_Delta(benchmark::State& state) {
+    RunSnapshotBenchmark(state, true);
+}
+BENCHMARK(BM_Snapshot_Tick_Delta)->Unit(benchmark::kMicrosecond);
+
+static void BM_Snapshot_Tick_Full(benchmark::State& state) {
+    RunSnapshotBenchmark(state, false);
+}
+BENCHMARK(BM_Snapshot_Tick_Full)->Unit(benchmark::kMicrosecond);
@@ -8,7 +8,10 @@
 
 #include "animation/Animation.hpp"
 #include "animation/AnimationController.hpp"
+#include "animation/CrowdAnimator.hpp"
 #include "animation/Skeleton.hpp"
+#include "animation/Pose.hpp"
+#include "animation/blending/BlendMask.hpp"
 
 #include "utils/TestHelpers.hpp"
 #include "utils/Generators.hpp"
@@ -619,3 +622,452 @@ TEST(AnimationPerformanceTest, SequentialPlaybackOptimization) {
     Keyframe afterReset = channel.Interpolate(50.0f);
     EXPECT_VEC3_NEAR(glm::vec3(50.0f), afterReset.position, 0.001f);
 }
+
+// =============================================================================
+// Pose Tests
+// =============================================================================
+
+class PoseTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Root -> Hips -> Spine -> Head, Hips -> Leg
+        skeleton = SkeletonBuilder()
+            .AddBone("Root")
+            .AddBone("Hips", "Root", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.0f, 0.0f)))
+            .AddBone("Spine", "Hips", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.5f, 0.0f)))
+            .AddBone("Head", "Spine", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.5f, 0.0f)))
+            .AddBone("Leg", "Hips", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.2f, -0.5f, 0.0f)))
+            .Build();
+
+        walk = std::make_shared<Animation>("Walk");
+        walk->SetDuration(1.0f);
+        walk->AddChannel(MakeChannel("Hips", glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(2.0f, 1.0f, 0.0f),
+                                     glm::angleAxis(1.2f, glm::vec3(0.0f, 1.0f, 0.0f))));
+        walk->AddChannel(MakeChannel("Leg", glm::vec3(0.2f, -0.5f, 0.0f), glm::vec3(0.2f, -0.5f, 1.0f),
+                                     glm::angleAxis(0.8f, glm::vec3(1.0f, 0.0f, 0.0f))));
+        walk->AddChannel(MakeChannel("Tail", glm::vec3(0.0f), glm::vec3(1.0f), glm::quat(1, 0, 0, 0)));
+
+        wave = std::make_shared<Animation>("Wave");
+        wave->SetDuration(1.0f);
+        wave->AddChannel(MakeChannel("Spine", glm::vec3(0.0f, 0.5f, 0.0f), glm::vec3(0.0f, 0.5f, 0.0f),
+                                     glm::angleAxis(1.0f, glm::vec3(0.0f, 0.0f, 1.0f))));
+        wave->AddChannel(MakeChannel("Hips", glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f),
+                                     glm::angleAxis(-1.0f, glm::vec3(0.0f, 1.0f, 0.0f))));
+    }
+
+    static AnimationChannel MakeChannel(const std::string& name, const glm::vec3& from, const glm::vec3& to,
+                                        const glm::quat& endRotation) {
+        AnimationChannel channel;
+        channel.nodeName = name;
+        for (int i = 0; i <= 8; ++i) {
+            const float t = static_cast<float>(i) / 8.0f;
+            channel.keyframes.push_back({t, glm::mix(from, to, t), glm::slerp(glm::quat(1, 0, 0, 0), endRotation, t),
+                                         glm::vec3(1.0f + t)});
+        }
+        return channel;
+    }
+
+    Skeleton skeleton;
+    std::shared_ptr<Animation> walk;
+    std::shared_ptr<Animation> wave;
+};
+
+TEST_F(PoseTest, BindingMapsChannelsToBoneIndices) {
+    ClipBinding binding(*walk, skeleton);
+
+    ASSERT_EQ(5u, binding.GetBoneCount());
+    EXPECT_EQ(2u, binding.GetBoundChannelCount());
+
+    auto channels = binding.GetChannelForBone();
+    EXPECT_EQ(-1, channels[0]);
+    EXPECT_EQ(0, channels[1]);
+    EXPECT_EQ(-1, channels[2]);
+    EXPECT_EQ(1, channels[4]);
+}
+
+TEST_F(PoseTest, SampleMatchesChannelInterpolation) {
+    ClipBinding binding(*walk, skeleton);
+    std::vector<uint32_t> cursors(binding.GetBoneCount(), 0);
+    Pose pose;
+
+    for (float t = 0.0f; t <= 1.0f; t += 0.07f) {
+        binding.Sample(t, pose, cursors);
+
+        Keyframe expected = walk->GetChannel("Hips")->Interpolate(t);
+        EXPECT_VEC3_NEAR(expected.position, pose.GetTranslation(1), 0.0001f);
+        EXPECT_VEC3_NEAR(expected.scale, pose.GetScale(1), 0.0001f);
+        EXPECT_TRUE(QuatEqual(expected.rotation, pose.GetRotation(1), 0.001f));
+
+        // Unanimated bones keep their rest transform
+        EXPECT_VEC3_NEAR(glm::vec3(0.0f, 0.5f, 0.0f), pose.GetTranslation(2), 0.0001f);
+        EXPECT_QUAT_EQ(glm::quat(1, 0, 0, 0), pose.GetRotation(2));
+    }
+
+    // Jumping backwards falls back from the cursor to a search
+    binding.Sample(0.25f, pose, cursors);
+    EXPECT_VEC3_NEAR(glm::vec3(0.5f, 1.0f, 0.0f), pose.GetTranslation(1), 0.0001f);
+}
+
+TEST_F(PoseTest, BlendEndpointsAndMidpoint) {
+    Pose a(skeleton.GetBoneCount());
+    Pose b(skeleton.GetBoneCount());
+    b.SetBone(1, glm::vec3(10.0f, 0.0f, 0.0f), glm::angleAxis(1.0f, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(3.0f));
+
+    Pose out;
+    PoseOps::Blend(a, b, 0.0f, out);
+    EXPECT_VEC3_EQ(glm::vec3(0.0f), out.GetTranslation(1));
+    EXPECT_QUAT_EQ(glm::quat(1, 0, 0, 0), out.GetRotation(1));
+
+    PoseOps::Blend(a, b, 1.0f, out);
+    EXPECT_VEC3_EQ(glm::vec3(10.0f, 0.0f, 0.0f), out.GetTranslation(1));
+    EXPECT_QUAT_EQ(b.GetRotation(1), out.GetRotation(1));
+    EXPECT_VEC3_EQ(glm::vec3(3.0f), out.GetScale(1));
+
+    PoseOps::Blend(a, b, 0.5f, out);
+    EXPECT_VEC3_EQ(glm::vec3(5.0f, 0.0f, 0.0f), out.GetTranslation(1));
+    EXPECT_QUAT_EQ(glm::angleAxis(0.5f, glm::vec3(0.0f, 1.0f, 0.0f)), out.GetRotation(1));
+    EXPECT_VEC3_EQ(glm::vec3(2.0f), out.GetScale(1));
+}
+
+TEST_F(PoseTest, BlendTakesShortestArc) {
+    Pose a(1);
+    Pose b(1);
+    const glm::quat rotation = glm::angleAxis(0.6f, glm::vec3(1.0f, 0.0f, 0.0f));
+    b.SetBone(0, glm::vec3(0.0f), -rotation, glm::vec3(1.0f));  // Same rotation, opposite hemisphere
+
+    Pose out;
+    PoseOps::Blend(a, b, 0.5f, out);
+    EXPECT_QUAT_EQ(glm::angleAxis(0.3f, glm::vec3(1.0f, 0.0f, 0.0f)), out.GetRotation(0));
+}
+
+TEST_F(PoseTest, MaskedBlendOnlyAffectsWeightedBones) {
+    Pose a(skeleton.GetBoneCount());
+    Pose b(skeleton.GetBoneCount());
+    for (size_t i = 0; i < skeleton.GetBoneCount(); ++i) {
+        b.SetBone(i, glm::vec3(4.0f), glm::quat(1, 0, 0, 0), glm::vec3(1.0f));
+    }
+
+    const float perBone[] = {0.0f, 0.0f, 1.0f, 0.5f};  // Leg past the end gets 0
+    BoneWeights weights;
+    PoseOps::FillBoneWeights(perBone, skeleton.GetBoneCount(), weights);
+    ASSERT_GE(weights.size(), a.GetStride());
+
+    Pose out;
+    PoseOps::Blend(a, b, 1.0f, weights, out);
+    EXPECT_VEC3_EQ(glm::vec3(0.0f), out.GetTranslation(1));
+    EXPECT_VEC3_EQ(glm::vec3(4.0f), out.GetTranslation(2));
+    EXPECT_VEC3_EQ(glm::vec3(2.0f), out.GetTranslation(3));
+    EXPECT_VEC3_EQ(glm::vec3(0.0f), out.GetTranslation(4));
+}
+
+TEST_F(PoseTest, AdditiveBlend) {
+    Pose base(2);
+    base.SetBone(0, glm::vec3(1.0f, 0.0f, 0.0f), glm::angleAxis(0.4f, glm::vec3(0.0f, 0.0f, 1.0f)), glm::vec3(2.0f));
+
+    Pose additive(2);
+    additive.SetBone(0, glm::vec3(0.0f, 2.0f, 0.0f), glm::angleAxis(0.2f, glm::vec3(0.0f, 0.0f, 1.0f)), glm::vec3(1.5f));
+
+    Pose out;
+    PoseOps::BlendAdditive(base, additive, 1.0f, {}, out);
+    EXPECT_VEC3_EQ(glm::vec3(1.0f, 2.0f, 0.0f), out.GetTranslation(0));
+    EXPECT_QUAT_EQ(glm::angleAxis(0.6f, glm::vec3(0.0f, 0.0f, 1.0f)), out.GetRotation(0));
+    EXPECT_VEC3_EQ(glm::vec3(3.0f), out.GetScale(0));
+
+    PoseOps::BlendAdditive(base, additive, 0.5f, {}, out);
+    EXPECT_VEC3_EQ(glm::vec3(1.0f, 1.0f, 0.0f), out.GetTranslation(0));
+    EXPECT_QUAT_EQ(glm::angleAxis(0.5f, glm::vec3(0.0f, 0.0f, 1.0f)), out.GetRotation(0));
+
+    // Identity additive leaves the base untouched
+    EXPECT_VEC3_EQ(glm::vec3(0.0f), out.GetTranslation(1));
+    EXPECT_VEC3_EQ(glm::vec3(1.0f), out.GetScale(1));
+}
+
+TEST_F(PoseTest, SkinningMatricesMatchNamedTransforms) {
+    skeleton.SetGlobalInverseTransform(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
+
+    ClipBinding binding(*walk, skeleton);
+    std::vector<uint32_t> cursors(binding.GetBoneCount(), 0);
+    Pose pose;
+    binding.Sample(0.4f, pose, cursors);
+
+    std::vector<glm::mat4> expected(skeleton.GetBoneCount());
+    skeleton.CalculateBoneMatricesInto(walk->Evaluate(0.4f), expected);
+
+    std::vector<glm::mat4> actual(skeleton.GetBoneCount());
+    skeleton.CalculateBoneMatricesInto(pose, actual);
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_TRUE(Mat4Equal(expected[i], actual[i], 0.001f)) << "bone " << i;
+    }
+}
+
+TEST_F(PoseTest, ControllerMasksUpperBodyLayer) {
+    AnimationController controller(&skeleton);
+    controller.AddAnimation("Walk", walk);
+    controller.AddAnimation("Wave", wave);
+
+    auto upperBody = std::make_shared<BlendMask>("UpperBody");
+    upperBody->SetSkeleton(&skeleton);
+    upperBody->SetBranchWeight("Spine", 1.0f);
+
+    controller.Play("Walk", 0.0f);
+    controller.PlayOnLayer(1, "Wave", 0.0f);
+    controller.SetLayerMask(1, upperBody);
+    controller.Update(0.5f);
+
+    const Pose& pose = controller.GetPose();
+    ASSERT_EQ(skeleton.GetBoneCount(), pose.GetBoneCount());
+
+    // Hips are outside the mask: walk only
+    EXPECT_VEC3_NEAR(glm::vec3(1.0f, 1.0f, 0.0f), pose.GetTranslation(1), 0.0001f);
+    EXPECT_TRUE(QuatEqual(glm::angleAxis(0.6f, glm::vec3(0.0f, 1.0f, 0.0f)), pose.GetRotation(1), 0.001f));
+
+    // Spine is fully overridden by the wave
+    EXPECT_TRUE(QuatEqual(glm::angleAxis(0.5f, glm::vec3(0.0f, 0.0f, 1.0f)), pose.GetRotation(2), 0.001f));
+
+    // Named transforms for tools follow the pose
+    const auto& transforms = controller.GetBoneTransforms();
+    EXPECT_VEC3_NEAR(glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(transforms.at("Hips")[3]), 0.0001f);
+}
+
+TEST_F(PoseTest, ControllerCrossfadeIsWeightedAverage) {
+    AnimationController controller(&skeleton);
+    controller.AddAnimation("Walk", walk);
+    controller.AddAnimation("Wave", wave);
+
+    controller.Play("Walk", 0.0f);
+    controller.Update(0.25f);
+    controller.Play("Wave", 1.0f);
+    controller.Update(0.25f);
+
+    // Halfway through the crossfade: walk at 0.5s weighted with wave at 0.25s
+    const Pose& pose = controller.GetPose();
+    const float walkX = walk->GetChannel("Hips")->Interpolate(0.5f).position.x;
+    EXPECT_NEAR(walkX * 0.75f, pose.GetTranslation(1).x, 0.0001f);
+}
+
+TEST_F(PoseTest, ControllerReportsSingleClipOnlyWhenUnblended) {
+    AnimationController controller(&skeleton);
+    controller.AddAnimation("Walk", walk);
+    controller.AddAnimation("Wave", wave);
+
+    float time = -1.0f;
+    EXPECT_EQ(nullptr, controller.GetSingleClip(time));
+
+    controller.Play("Walk", 0.0f);
+    controller.Update(0.25f);
+    EXPECT_EQ(walk.get(), controller.GetSingleClip(time));
+    EXPECT_FLOAT_EQ(0.25f, time);
+
+    // Crossfading: two weighted instances
+    controller.Play("Wave", 1.0f);
+    controller.Update(0.25f);
+    EXPECT_EQ(nullptr, controller.GetSingleClip(time));
+
+    // A partially weighted base layer blends over the rest pose
+    controller.Play("Walk", 0.0f);
+    controller.Update(0.0f);
+    controller.SetLayerWeight(0, 0.5f);
+    EXPECT_EQ(nullptr, controller.GetSingleClip(time));
+}
+
+TEST_F(PoseTest, SampleAcrossRigsWithTheSameStride) {
+    // Five and six bones pad to the same stride; the thread's scratch pose
+    // must still be sized for each rig
+    Skeleton tailed = SkeletonBuilder()
+        .AddBone("Root")
+        .AddBone("Hips", "Root", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.0f, 0.0f)))
+        .AddBone("Spine", "Hips", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.5f, 0.0f)))
+        .AddBone("Head", "Spine", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.5f, 0.0f)))
+        .AddBone("Leg", "Hips", glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.2f, -0.5f, 0.0f)))
+        .AddBone("Tail", "Hips")
+        .Build();
+    ASSERT_EQ(Pose(skeleton.GetBoneCount()).GetStride(), Pose(tailed.GetBoneCount()).GetStride());
+
+    ClipBinding small(*walk, skeleton);
+    ClipBinding large(*walk, tailed);
+    std::vector<uint32_t> smallCursors(small.GetBoneCount(), 0);
+    std::vector<uint32_t> largeCursors(large.GetBoneCount(), 0);
+    Pose pose;
+
+    small.Sample(0.5f, pose, smallCursors);
+    ASSERT_EQ(5u, pose.GetBoneCount());
+    large.Sample(0.5f, pose, largeCursors);
+    ASSERT_EQ(6u, pose.GetBoneCount());
+    EXPECT_VEC3_NEAR(walk->GetChannel("Tail")->Interpolate(0.5f).position, pose.GetTranslation(5), 0.0001f);
+
+    small.Sample(0.25f, pose, smallCursors);
+    ASSERT_EQ(5u, pose.GetBoneCount());
+    EXPECT_VEC3_NEAR(walk->GetChannel("Leg")->Interpolate(0.25f).position, pose.GetTranslation(4), 0.0001f);
+}
+
+TEST_F(PoseTest, ControllerReleasesBindingsOfReplacedClips) {
+    AnimationController controller(&skeleton);
+    controller.AddAnimation("Walk", walk);
+    controller.Play("Walk", 0.0f);
+    controller.Update(0.25f);
+
+    // Replaced while playing: the instance carries on with the new clip
+    controller.AddAnimation("Walk", wave);
+    EXPECT_EQ(wave.get(), controller.GetAnimation("Walk"));
+    controller.Update(0.25f);
+    float time = -1.0f;
+    EXPECT_EQ(wave.get(), controller.GetSingleClip(time));
+    EXPECT_FLOAT_EQ(0.5f, time);
+    EXPECT_TRUE(QuatEqual(wave->GetChannel("Spine")->Interpolate(0.5f).rotation,
+                          controller.GetPose().GetRotation(2), 0.001f));
+
+    // A clip allocated where the old one lived must get a binding of its own
+    const Animation* oldAddress = walk.get();
+    walk.reset();
+    std::vector<std::shared_ptr<Animation>> clips;
+    for (int i = 0; i < 16 && (clips.empty() || clips.back().get() != oldAddress); ++i) {
+        auto clip = std::make_shared<Animation>("Nod");
+        clip->SetDuration(1.0f);
+        clip->AddChannel(MakeChannel("Head", glm::vec3(0.0f, 0.5f, 0.0f), glm::vec3(0.0f, 0.5f, 1.0f),
+                                     glm::angleAxis(0.5f, glm::vec3(1.0f, 0.0f, 0.0f))));
+        clips.push_back(std::move(clip));
+    }
+    const std::shared_ptr<Animation> nod = clips.back();
+
+    controller.AddAnimation("Nod", nod);
+    controller.Play("Nod", 0.0f);
+    controller.Update(0.5f);
+    EXPECT_VEC3_NEAR(nod->GetChannel("Head")->Interpolate(0.5f).position,
+                     controller.GetPose().GetTranslation(3), 0.0001f);
+    EXPECT_VEC3_NEAR(glm::vec3(0.2f, -0.5f, 0.0f), controller.GetPose().GetTranslation(4), 0.0001f);
+}
+
+// =============================================================================
+// Crowd Animator Tests
+// =============================================================================
+
+class CrowdAnimatorTest : public PoseTest {
+protected:
+    std::unique_ptr<AnimationController> MakeController(const std::string& clip) {
+        auto controller = std::make_unique<AnimationController>(&skeleton);
+        controller->AddAnimation("Walk", walk);
+        controller->AddAnimation("Wave", wave);
+        controller->Play(clip, 0.0f);
+        return controller;
+    }
+
+    static bool MatricesEqual(std::span<const glm::mat4> a, std::span<const glm::mat4> b) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (!Mat4Equal(a[i], b[i], 1e-5f)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr float kFrame = 1.0f / 60.0f;
+};
+
+TEST_F(CrowdAnimatorTest, NearInstancesMatchControllerUpdate) {
+    CrowdAnimationSettings settings;
+    settings.phaseQuantum = 0.0f;
+    CrowdAnimator crowd(settings);
+
+    auto crowdController = MakeController("Walk");
+    auto reference = MakeController("Walk");
+    std::vector<glm::mat4> crowdMatrices(skeleton.GetBoneCount());
+    std::vector<glm::mat4> expected(skeleton.GetBoneCount());
+    crowd.Add(crowdController.get(), crowdMatrices);
+
+    for (int frame = 0; frame < 10; ++frame) {
+        crowd.Update(kFrame, glm::vec3(0.0f));
+        reference->Update(kFrame);
+        reference->GetBoneMatricesInto(expected);
+
+        EXPECT_EQ(1u, crowd.GetStats().evaluated);
+        EXPECT_TRUE(MatricesEqual(expected, crowdMatrices)) << "frame " << frame;
+    }
+}
+
+TEST_F(CrowdAnimatorTest, DistantInstancesEvaluateAtReducedRate) {
+    CrowdAnimator crowd;
+    auto controller = MakeController("Walk");
+    auto reference = MakeController("Walk");
+    std::vector<glm::mat4> matrices(skeleton.GetBoneCount());
+    std::vector<glm::mat4> expected(skeleton.GetBoneCount());
+    const auto id = crowd.Add(controller.get(), matrices);
+
+    crowd.SetPosition(id, glm::vec3(45.0f, 0.0f, 0.0f));
+    EXPECT_EQ(2u, crowd.GetUpdateInterval(id, glm::vec3(0.0f)));
+    crowd.SetPosition(id, glm::vec3(0.0f, 0.0f, 500.0f));
+    EXPECT_EQ(8u, crowd.GetUpdateInterval(id, glm::vec3(0.0f)));
+
+    // The first update always evaluates; after that one frame in eight does
+    int evaluations = 0;
+    for (int frame = 0; frame < 33; ++frame) {
+        crowd.Update(kFrame, glm::vec3(0.0f));
+        reference->Update(kFrame);
+        if (crowd.GetStats().evaluated == 1) {
+            ++evaluations;
+
+            // Time kept advancing while skipped, so the pose is current when it is evaluated
+            reference->GetBoneMatricesInto(expected);
+            EXPECT_TRUE(MatricesEqual(expected, matrices)) << "frame " << frame;
+        } else {
+            EXPECT_EQ(1u, crowd.GetStats().skipped);
+        }
+    }
+    EXPECT_EQ(5, evaluations);
+
+    // Invalidate forces the next update
+    crowd.Invalidate(id);
+    crowd.Update(kFrame, glm::vec3(0.0f));
+    EXPECT_EQ(1u, crowd.GetStats().evaluated);
+}
+
+TEST_F(CrowdAnimatorTest, SamePhaseSharesOneEvaluation) {
+    CrowdAnimator crowd;
+    std::vector<std::unique_ptr<AnimationController>> controllers;
+    std::vector<std::vector<glm::mat4>> matrices(6, std::vector<glm::mat4>(skeleton.GetBoneCount()));
+    for (size_t i = 0; i < 5; ++i) {
+        controllers.push_back(MakeController("Walk"));
+        crowd.Add(controllers.back().get(), matrices[i]);
+    }
+
+    // A crossfading unit can't borrow another unit's pose
+    controllers.push_back(MakeController("Walk"));
+    controllers.back()->Play("Wave", 1.0f);
+    crowd.Add(controllers.back().get(), matrices[5]);
+
+    crowd.Update(kFrame, glm::vec3(0.0f));
+    EXPECT_EQ(6u, crowd.GetStats().instances);
+    EXPECT_EQ(2u, crowd.GetStats().evaluated);
+    EXPECT_EQ(4u, crowd.GetStats().shared);
+    for (size_t i = 1; i < 5; ++i) {
+        EXPECT_TRUE(MatricesEqual(matrices[0], matrices[i]));
+    }
+    EXPECT_FALSE(MatricesEqual(matrices[0], matrices[5]));
+
+    // Out of phase: everyone evaluates
+    controllers[1]->SetCurrentTime(0.5f);
+    crowd.Update(kFrame, glm::vec3(0.0f));
+    EXPECT_EQ(3u, crowd.GetStats().evaluated);
+    EXPECT_EQ(3u, crowd.GetStats().shared);
+}
+
+TEST_F(CrowdAnimatorTest, RemovedInstancesStopUpdating) {
+    CrowdAnimator crowd;
+    auto first = MakeController("Walk");
+    auto second = MakeController("Wave");
+    std::vector<glm::mat4> firstMatrices(skeleton.GetBoneCount());
+    std::vector<glm::mat4> secondMatrices(skeleton.GetBoneCount());
+
+    const auto firstId = crowd.Add(first.get(), firstMatrices);
+    crowd.Add(second.get(), secondMatrices);
+    crowd.Remove(firstId);
+    EXPECT_EQ(1u, crowd.GetInstanceCount());
+
+    crowd.Update(kFrame, glm::vec3(0.0f));
+    EXPECT_EQ(1u, crowd.GetStats().evaluated);
+    EXPECT_FLOAT_EQ(0.0f, first->GetCurrentTime());
+    EXPECT_FLOAT_EQ(kFrame, second->GetCurrentTime());
+
+    // Freed ids are reused
+    EXPECT_EQ(firstId, crowd.Add(first.get(), firstMatrices));
+}
@@ -0,0 +1,423 @@
+/**
+ * @file test_animation_compression.cpp
+ * @brief Unit tests and report harness for compressed animation clips
+ *
+ * Test categories:
+ * - Channel classification (default / constant / animated)
+ * - Per-channel error bounds and model-space error
+ * - Cursor playback vs random seeks
+ * - Serialization
+ *
+ * CompressionReport prints the compression ratio, the maximum model-space
+ * bone position error and the decode cost per bone for a 60-bone clip.
+ */
+
+#include <gtest/gtest.h>
+
+#include "animation/CompressedClip.hpp"
+#include "animation/Skeleton.hpp"
+#include "import/AnimationCompressor.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr size_t kBoneCount = 60;
+constexpr float kSourceRate = 60.0f;
+constexpr float kDuration = 2.0f;
+
+std::string BoneName(size_t index) {
+    return "Bone" + std::to_string(index);
+}
+
+glm::vec3 RestOffset(size_t bone) {
+    return glm::vec3(0.02f * static_cast<float>(bone % 3), 0.1f, 0.0f);
+}
+
+Skeleton BuildRig() {
+    SkeletonBuilder builder;
+    for (size_t i = 0; i < kBoneCount; ++i) {
+        builder.AddBone(BoneName(i), i == 0 ? "" : BoneName((i - 1) / 2), glm::mat4(1.0f),
+                        glm::translate(glm::mat4(1.0f), RestOffset(i)));
+    }
+    return builder.Build();
+}
+
+/**
+ * @brief 60 fps source clip: every bone rotates, the root and every 7th bone
+ *        translate, bone 3 scales, the rest hold their offset with unit scale
+ */
+ImportedClip BuildSourceClip(float duration = kDuration) {
+    ImportedClip clip;
+    clip.name = "Run";
+    clip.duration = duration;
+
+    const int frames = static_cast<int>(duration * kSourceRate) + 1;
+    for (size_t bone = 0; bone < kBoneCount; ++bone) {
+        ImportedChannel channel;
+        channel.boneName = BoneName(bone);
+        for (int f = 0; f < frames; ++f) {
+            const float t = static_cast<float>(f) / kSourceRate;
+            const float phase = t * 3.0f + static_cast<float>(bone) * 0.7f;
+
+            ImportedKeyframe key;
+            key.time = t;
+            key.position = RestOffset(bone);
+            if (bone == 0 || bone % 7 == 0) {
+                key.position += glm::vec3(0.3f * std::sin(phase), 0.05f * std::sin(2.0f * phase), t * 0.5f);
+            }
+            key.rotation = glm::angleAxis(0.6f * std::sin(phase), glm::normalize(glm::vec3(1.0f, 0.3f, 0.1f))) *
+                           glm::angleAxis(0.3f * std::cos(1.3f * phase), glm::vec3(0.0f, 0.0f, 1.0f));
+            key.scale = bone == 3 ? glm::vec3(1.0f + 0.2f * std::sin(phase)) : glm::vec3(1.0f);
+            channel.keyframes.push_back(key);
+        }
+        clip.channels.push_back(std::move(channel));
+    }
+    return clip;
+}
+
+/**
+ * @brief Model-space bone positions from local keys, parent-first
+ */
+std::vector<glm::vec3> ModelPositions(const Skeleton& skeleton, const std::vector<glm::mat4>& locals) {
+    std::vector<glm::mat4> model(locals.size());
+    std::vector<glm::vec3> positions(locals.size());
+    const auto& bones = skeleton.GetBones();
+    for (size_t i = 0; i < bones.size(); ++i) {
+        model[i] = bones[i].parentIndex >= 0 ? model[bones[i].parentIndex] * locals[i] : locals[i];
+        positions[i] = glm::vec3(model[i][3]);
+    }
+    return positions;
+}
+
+std::vector<glm::mat4> SourceLocals(const ImportedClip& clip, int frame) {
+    std::vector<glm::mat4> locals;
+    for (const auto& channel : clip.channels) {
+        locals.push_back(KeyframeToMatrix(channel.keyframes[frame]));
+    }
+    return locals;
+}
+
+std::vector<glm::mat4> PoseLocals(const Pose& pose) {
+    std::vector<glm::mat4> locals;
+    for (size_t i = 0; i < pose.GetBoneCount(); ++i) {
+        locals.push_back(pose.GetLocalMatrix(i));
+    }
+    return locals;
+}
+
+/**
+ * @brief Byte positions of fields in CompressedClip::Serialize() output
+ */
+struct SerializedLayout {
+    size_t firstTrackModes = 0;         ///< translation, rotation, scale bytes
+    size_t firstConstantTrackOffset = 0;
+    size_t firstChannelKind = 0;
+    size_t firstSegment = 0;            ///< Segment 0 in the segment data
+
+    SerializedLayout(const CompressedClip& clip, const std::vector<uint8_t>& data) {
+        // magic, version, name, duration, frame duration, frame count, segment frames, track count
+        size_t offset = 2 * sizeof(uint32_t) + sizeof(uint32_t) + clip.GetName().size() + 5 * sizeof(uint32_t);
+        for (const CompressedClip::Track& track : clip.GetTracks()) {
+            const size_t modes = offset + sizeof(uint32_t) + track.boneName.size();
+            if (firstTrackModes == 0) {
+                firstTrackModes = modes;
+            }
+            const bool hasConstant = track.translation == CompressedClip::ChannelMode::Constant ||
+                                     track.rotation == CompressedClip::ChannelMode::Constant ||
+                                     track.scale == CompressedClip::ChannelMode::Constant;
+            if (hasConstant && firstConstantTrackOffset == 0) {
+                firstConstantTrackOffset = modes + 3;
+            }
+            offset = modes + 3 + sizeof(uint32_t);
+        }
+
+        firstChannelKind = offset + sizeof(uint32_t) + offsetof(CompressedClip::AnimatedChannel, kind);
+        offset += sizeof(uint32_t) + clip.GetAnimatedChannels().size() * sizeof(CompressedClip::AnimatedChannel);
+
+        uint32_t constantCount = 0;
+        std::memcpy(&constantCount, data.data() + offset, sizeof(uint32_t));
+        offset += sizeof(uint32_t) + constantCount * sizeof(float);
+
+        uint32_t firstSegmentOffset = 0;
+        std::memcpy(&firstSegmentOffset, data.data() + offset + sizeof(uint32_t), sizeof(uint32_t));
+        offset += sizeof(uint32_t) + (clip.GetSegmentCount() + 1) * sizeof(uint32_t);
+        firstSegment = offset + sizeof(uint32_t) + firstSegmentOffset;
+    }
+};
+
+} // namespace
+
+// =============================================================================
+// Classification
+// =============================================================================
+
+TEST(AnimationCompressionTest, ClassifiesDefaultConstantAndAnimatedChannels) {
+    const ImportedClip source = BuildSourceClip();
+    ClipCompressionStats stats;
+    const CompressedClip clip = AnimationCompressor().Compress(source, &stats);
+
+    // Rotations: all animated. Translations: 9 moving, 51 constant offsets. Scale: 1 animated.
+    EXPECT_EQ(stats.animatedChannels, kBoneCount + 9 + 1);
+    EXPECT_EQ(stats.constantChannels, kBoneCount - 9);
+    EXPECT_EQ(stats.defaultChannels, kBoneCount - 1);
+
+    const auto& tracks = clip.GetTracks();
+    ASSERT_EQ(tracks.size(), kBoneCount);
+    EXPECT_EQ(tracks[1].translation, CompressedClip::ChannelMode::Constant);
+    EXPECT_EQ(tracks[1].scale, CompressedClip::ChannelMode::Default);
+    EXPECT_EQ(tracks[3].scale, CompressedClip::ChannelMode::Animated);
+    EXPECT_EQ(tracks[7].translation, CompressedClip::ChannelMode::Animated);
+    EXPECT_FLOAT_EQ(clip.GetConstantTranslation(tracks[1]).x, RestOffset(1).x);
+
+    EXPECT_EQ(clip.GetFrameCount(), 61u);
+    EXPECT_EQ(clip.GetSegmentCount(), 4u);
+    EXPECT_LT(stats.storedKeys, stats.sampledKeys + clip.GetSegmentCount() * stats.animatedChannels);
+}
+
+TEST(AnimationCompressionTest, StaticClipStoresNoSegmentKeys) {
+    ImportedClip source;
+    source.name = "Idle";
+    source.duration = 1.0f;
+    ImportedChannel channel;
+    channel.boneName = BoneName(0);
+    channel.keyframes = {{0.0f, glm::vec3(0.0f), glm::quat(1, 0, 0, 0), glm::vec3(1.0f)},
+                         {1.0f, glm::vec3(0.0f), glm::quat(1, 0, 0, 0), glm::vec3(1.0f)}};
+    source.channels.push_back(channel);
+
+    ClipCompressionStats stats;
+    const CompressedClip clip = AnimationCompressor().Compress(source, &stats);
+    EXPECT_EQ(stats.defaultChannels, 3u);
+    EXPECT_EQ(stats.animatedChannels, 0u);
+    EXPECT_TRUE(clip.GetAnimatedChannels().empty());
+}
+
+// =============================================================================
+// Error Bounds
+// =============================================================================
+
+TEST(AnimationCompressionTest, DecodedChannelsStayWithinTolerance) {
+    const ImportedClip source = BuildSourceClip();
+    ClipCompressionSettings settings;
+    settings.sampleRate = kSourceRate;
+    ClipCompressionStats stats;
+    const CompressedClip clip = AnimationCompressor(settings).Compress(source, &stats);
+
+    EXPECT_LE(stats.maxPositionError, settings.positionTolerance);
+    EXPECT_LE(stats.maxRotationError, settings.rotationTolerance);
+    EXPECT_LE(stats.maxScaleError, settings.scaleTolerance);
+
+    const Skeleton skeleton = BuildRig();
+    CompressedClipSampler sampler(clip, skeleton);
+    Pose pose;
+    const int frames = static_cast<int>(kDuration * kSourceRate) + 1;
+    for (int f = 0; f < frames; ++f) {
+        sampler.Sample(static_cast<float>(f) / kSourceRate, pose);
+        for (size_t bone = 0; bone < kBoneCount; ++bone) {
+            const ImportedKeyframe& key = source.channels[bone].keyframes[f];
+            EXPECT_LE(glm::length(pose.GetTranslation(bone) - key.position), settings.positionTolerance + 1e-5f);
+            EXPECT_LE(1.0f - std::abs(glm::dot(pose.GetRotation(bone), key.rotation)), settings.rotationTolerance + 1e-5f);
+            EXPECT_LE(glm::length(pose.GetScale(bone) - key.scale), settings.scaleTolerance + 1e-5f);
+        }
+    }
+}
+
+TEST(AnimationCompressionTest, CompressionReport) {
+    const ImportedClip source = BuildSourceClip();
+    ClipCompressionSettings settings;
+    settings.sampleRate = kSourceRate;
+    settings.rotationTolerance = 1.0e-6f;  // ~0.16 degrees; the import default allows ~1.6
+    ClipCompressionStats stats;
+    const CompressedClip clip = AnimationCompressor(settings).Compress(source, &stats);
+
+    const Skeleton skeleton = BuildRig();
+    CompressedClipSampler sampler(clip, skeleton);
+    Pose pose;
+
+    float maxModelError = 0.0f;
+    const int frames = static_cast<int>(kDuration * kSourceRate) + 1;
+    for (int f = 0; f < frames; ++f) {
+        sampler.Sample(static_cast<float>(f) / kSourceRate, pose);
+        const auto expected = ModelPositions(skeleton, SourceLocals(source, f));
+        const auto actual = ModelPositions(skeleton, PoseLocals(pose));
+        for (size_t bone = 0; bone < kBoneCount; ++bone) {
+            maxModelError = std::max(maxModelError, glm::distance(expected[bone], actual[bone]));
+        }
+    }
+
+    // Decode cost: forward playback at 60 Hz over many loops
+    constexpr int kSamples = 20000;
+    const auto start = std::chrono::steady_clock::now();
+    float time = 0.0f;
+    for (int i = 0; i < kSamples; ++i) {
+        sampler.Sample(time, pose);
+        time += 1.0f / 60.0f;
+        if (time > kDuration) {
+            time -= kDuration;
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const double nsPerBone = std::chrono::duration<double, std::nano>(elapsed).count() / (kSamples * double(kBoneCount));
+
+    std::cout << "[ compression ] ratio " << stats.GetRatio() << ":1 (" << stats.sourceBytes << " -> "
+              << stats.compressedBytes << " bytes), keys " << stats.storedKeys << "/" << stats.sampledKeys
+              << ", max model-space position error " << maxModelError << ", decode " << nsPerBone << " ns/bone\n";
+    RecordProperty("CompressionRatio", std::to_string(stats.GetRatio()));
+    RecordProperty("MaxPositionError", std::to_string(maxModelError));
+    RecordProperty("DecodeNsPerBone", std::to_string(nsPerBone));
+
+    EXPECT_GT(stats.GetRatio(), 4.0f);
+    EXPECT_LT(maxModelError, 0.01f);
+}
+
+// =============================================================================
+// Sampling
+// =============================================================================
+
+TEST(AnimationCompressionTest, CursorPlaybackMatchesRandomSeeks) {
+    const CompressedClip clip = AnimationCompressor().Compress(BuildSourceClip());
+    const Skeleton skeleton = BuildRig();
+
+    CompressedClipSampler playing(clip, skeleton);
+    Pose played;
+    Pose seeked;
+    for (float t = 0.0f; t <= kDuration; t += 0.013f) {
+        playing.Sample(t, played);
+
+        CompressedClipSampler fresh(clip, skeleton);
+        fresh.Sample(t, seeked);
+        for (size_t bone = 0; bone < kBoneCount; ++bone) {
+            ASSERT_EQ(played.GetTranslation(bone), seeked.GetTranslation(bone)) << "t=" << t;
+            ASSERT_EQ(played.GetRotation(bone), seeked.GetRotation(bone)) << "t=" << t;
+        }
+    }
+
+    // Backwards within a segment and across segments
+    for (float t : {1.9f, 1.2f, 1.15f, 0.1f, 0.05f, 1.99f}) {
+        playing.Sample(t, played);
+        CompressedClipSampler fresh(clip, skeleton);
+        fresh.Sample(t, seeked);
+        EXPECT_EQ(played.GetRotation(5), seeked.GetRotation(5)) << "t=" << t;
+    }
+}
+
+TEST(AnimationCompressionTest, UnknownBonesKeepRestPose) {
+    const CompressedClip clip = AnimationCompressor().Compress(BuildSourceClip());
+
+    Skeleton skeleton = BuildRig();
+    skeleton.AddBone(Bone{"Prop", static_cast<int>(kBoneCount - 1), glm::mat4(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, 1.0f))});
+
+    CompressedClipSampler sampler(clip, skeleton);
+    Pose pose;
+    sampler.Sample(0.5f, pose);
+    ASSERT_EQ(pose.GetBoneCount(), kBoneCount + 1);
+    EXPECT_EQ(pose.GetTranslation(kBoneCount), glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+TEST(AnimationCompressionTest, LongSegmentsKeepTheirKeyCount) {
+    // With zero tolerance every frame of a full segment is a key, so the
+    // segment holds segmentFrames + 1 keys and the count must fit its byte
+    const ImportedClip source = BuildSourceClip(5.0f);
+    ClipCompressionSettings settings;
+    settings.sampleRate = kSourceRate;
+    settings.segmentFrames = 1000;
+    settings.positionTolerance = 0.0f;
+    settings.rotationTolerance = 0.0f;
+    settings.scaleTolerance = 0.0f;
+    ClipCompressionStats stats;
+    const CompressedClip clip = AnimationCompressor(settings).Compress(source, &stats);
+    EXPECT_EQ(clip.GetSegmentFrames(), 254u);
+
+    const Skeleton skeleton = BuildRig();
+    CompressedClipSampler sampler(clip, skeleton);
+    Pose pose;
+    const int frames = static_cast<int>(5.0f * kSourceRate) + 1;
+    for (int f = 0; f < frames; ++f) {
+        sampler.Sample(static_cast<float>(f) / kSourceRate, pose);
+        for (size_t bone = 0; bone < kBoneCount; ++bone) {
+            const ImportedKeyframe& key = source.channels[bone].keyframes[f];
+            EXPECT_LE(glm::length(pose.GetTranslation(bone) - key.position), stats.maxPositionError + 1e-5f);
+            EXPECT_LE(1.0f - std::abs(glm::dot(pose.GetRotation(bone), key.rotation)), stats.maxRotationError + 1e-5f);
+        }
+    }
+}
+
+// =============================================================================
+// Serialization
+// =============================================================================
+
+TEST(AnimationCompressionTest, SerializeRoundTrip) {
+    const CompressedClip clip = AnimationCompressor().Compress(BuildSourceClip());
+    const std::vector<uint8_t> data = clip.Serialize();
+
+    CompressedClip loaded;
+    ASSERT_TRUE(CompressedClip::Deserialize(data, loaded));
+    EXPECT_EQ(loaded.GetName(), "Run");
+    EXPECT_EQ(loaded.GetSegmentCount(), clip.GetSegmentCount());
+    EXPECT_EQ(loaded.GetMemoryUsage(), clip.GetMemoryUsage());
+
+    const Skeleton skeleton = BuildRig();
+    CompressedClipSampler original(clip, skeleton);
+    CompressedClipSampler roundTrip(loaded, skeleton);
+    Pose a;
+    Pose b;
+    original.Sample(0.77f, a);
+    roundTrip.Sample(0.77f, b);
+    for (size_t bone = 0; bone < kBoneCount; ++bone) {
+        EXPECT_EQ(a.GetTranslation(bone), b.GetTranslation(bone));
+        EXPECT_EQ(a.GetRotation(bone), b.GetRotation(bone));
+    }
+
+    // Truncated data is rejected
+    CompressedClip truncated;
+    EXPECT_FALSE(CompressedClip::Deserialize(std::span<const uint8_t>(data).first(data.size() / 2), truncated));
+}
+
+TEST(AnimationCompressionTest, DeserializeRejectsCorruptedData) {
+    const CompressedClip clip = AnimationCompressor().Compress(BuildSourceClip());
+    const std::vector<uint8_t> data = clip.Serialize();
+    const SerializedLayout layout(clip, data);
+    ASSERT_NE(layout.firstConstantTrackOffset, 0u);
+
+    auto rejects = [&data](size_t offset, const void* bytes, size_t size) {
+        std::vector<uint8_t> corrupted = data;
+        std::memcpy(corrupted.data() + offset, bytes, size);
+        CompressedClip loaded;
+        return !CompressedClip::Deserialize(corrupted, loaded);
+    };
+
+    ASSERT_EQ(data[layout.firstTrackModes], static_cast<uint8_t>(clip.GetTracks()[0].translation));
+    ASSERT_EQ(data[layout.firstChannelKind], static_cast<uint8_t>(clip.GetAnimatedChannels()[0].kind));
+
+    const uint8_t badMode = 7;
+    const uint8_t badKind = 9;
+    const uint32_t pastConstants = 0xFFFFFFF0u;
+    EXPECT_TRUE(rejects(layout.firstTrackModes, &badMode, 1));
+    EXPECT_TRUE(rejects(layout.firstTrackModes + 2, &badMode, 1));
+    EXPECT_TRUE(rejects(layout.firstChannelKind, &badKind, 1));
+    EXPECT_TRUE(rejects(layout.firstConstantTrackOffset, &pastConstants, sizeof(pastConstants)));
+
+    // Segment 0 blocks: offset past the segment, no keys, and more keys than
+    // the last block (which ends the segment) has room for
+    const size_t lastChannel = clip.GetAnimatedChannels().size() - 1;
+    uint32_t firstBlock = 0;
+    uint32_t lastBlock = 0;
+    std::memcpy(&firstBlock, data.data() + layout.firstSegment, sizeof(uint32_t));
+    std::memcpy(&lastBlock, data.data() + layout.firstSegment + lastChannel * sizeof(uint32_t), sizeof(uint32_t));
+    const uint32_t pastSegment = 1u << 20;
+    const uint8_t noKeys = 0;
+    const uint8_t tooManyKeys = 255;
+    EXPECT_TRUE(rejects(layout.firstSegment, &pastSegment, sizeof(pastSegment)));
+    EXPECT_TRUE(rejects(layout.firstSegment + firstBlock, &noKeys, 1));
+    EXPECT_TRUE(rejects(layout.firstSegment + lastBlock, &tooManyKeys, 1));
+}
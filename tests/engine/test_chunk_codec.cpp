@@ -0,0 +1,306 @@
+/**
+ * @file test_chunk_codec.cpp
+ * @brief Unit tests for chunk compression codecs and the decode buffer pool
+ *
+ * Test categories:
+ * - Round trips through none / lz4 / zstd
+ * - Trained zstd dictionaries, scoped to a world
+ * - ChunkCodecRegistry encode / decode of ChunkData
+ * - ChunkBufferPool size classes
+ */
+
+#include <gtest/gtest.h>
+
+#include "persistence/ChunkCodec.hpp"
+#include "persistence/WorldDatabase.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr int kChunkEdge = 32;
+
+/**
+ * @brief Layered terrain column data: stone, dirt, a grass top, air above
+ */
+std::vector<uint8_t> MakeTerrain(uint32_t seed, uint8_t topBlock = 3) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> jitter(-1, 1);
+    std::uniform_int_distribution<int> ore(0, 199);
+
+    std::vector<uint8_t> voxels(kChunkEdge * kChunkEdge * kChunkEdge, 0);
+    int height = 16;
+    for (int z = 0; z < kChunkEdge; ++z) {
+        for (int x = 0; x < kChunkEdge; ++x) {
+            height = std::clamp(height + jitter(rng), 8, 24);
+            for (int y = 0; y < height; ++y) {
+                uint8_t block = y < height - 4 ? 1 : (y < height - 1 ? 2 : topBlock);
+                if (block == 1 && ore(rng) == 0) block = 7;
+                voxels[(y * kChunkEdge + z) * kChunkEdge + x] = block;
+            }
+        }
+    }
+    return voxels;
+}
+
+std::vector<uint8_t> MakeNoise(size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> bytes(size);
+    for (uint8_t& byte : bytes) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    return bytes;
+}
+
+} // namespace
+
+// =============================================================================
+// Codec Tests
+// =============================================================================
+
+TEST(ChunkCodecTest, AllCodecsRoundTrip) {
+    const std::vector<uint8_t> terrain = MakeTerrain(1);
+    NullChunkCodec none;
+    LZ4ChunkCodec lz4;
+    ZstdChunkCodec zstd;
+
+    for (const ChunkCodec* codec : {static_cast<const ChunkCodec*>(&none), static_cast<const ChunkCodec*>(&lz4),
+                                    static_cast<const ChunkCodec*>(&zstd)}) {
+        std::vector<uint8_t> encoded;
+        ASSERT_TRUE(codec->Compress(terrain, encoded)) << codec->GetName();
+        std::vector<uint8_t> decoded(terrain.size());
+        ASSERT_TRUE(codec->Decompress(encoded, decoded)) << codec->GetName();
+        EXPECT_EQ(terrain, decoded) << codec->GetName();
+    }
+
+    std::vector<uint8_t> lz4Encoded;
+    std::vector<uint8_t> zstdEncoded;
+    lz4.Compress(terrain, lz4Encoded);
+    zstd.Compress(terrain, zstdEncoded);
+    EXPECT_LT(lz4Encoded.size(), terrain.size() / 4);
+    EXPECT_LT(zstdEncoded.size(), lz4Encoded.size());
+}
+
+TEST(ChunkCodecTest, DecompressRequiresExactSize) {
+    const std::vector<uint8_t> terrain = MakeTerrain(2);
+    LZ4ChunkCodec lz4;
+    ZstdChunkCodec zstd;
+
+    for (const ChunkCodec* codec : {static_cast<const ChunkCodec*>(&lz4), static_cast<const ChunkCodec*>(&zstd)}) {
+        std::vector<uint8_t> encoded;
+        ASSERT_TRUE(codec->Compress(terrain, encoded));
+        std::vector<uint8_t> tooSmall(terrain.size() - 1);
+        std::vector<uint8_t> tooLarge(terrain.size() + 1);
+        EXPECT_FALSE(codec->Decompress(encoded, tooSmall)) << codec->GetName();
+        EXPECT_FALSE(codec->Decompress(encoded, tooLarge)) << codec->GetName();
+    }
+}
+
+TEST(ChunkCodecTest, ZstdDictionaryShrinksChunksAndTravelsByID) {
+    std::vector<std::vector<uint8_t>> samples;
+    for (uint32_t seed = 100; seed < 400; ++seed) {
+        samples.push_back(MakeTerrain(seed));
+    }
+    std::vector<std::span<const uint8_t>> sampleSpans(samples.begin(), samples.end());
+    const std::vector<uint8_t> dictionary = ZstdChunkCodec::TrainDictionary(sampleSpans, 16 * 1024);
+    ASSERT_FALSE(dictionary.empty());
+
+    const std::vector<uint8_t> terrain = MakeTerrain(7);
+    ZstdChunkCodec plain;
+    std::vector<uint8_t> plainEncoded;
+    ASSERT_TRUE(plain.Compress(terrain, plainEncoded));
+
+    ZstdChunkCodec trained;
+    const uint32_t dictionaryId = trained.AddDictionary(dictionary);
+    ASSERT_NE(0u, dictionaryId);
+    EXPECT_EQ(dictionaryId, trained.GetCompressionDictionaryId());
+    std::vector<uint8_t> trainedEncoded;
+    ASSERT_TRUE(trained.Compress(terrain, trainedEncoded));
+    EXPECT_LT(trainedEncoded.size(), plainEncoded.size());
+
+    // A codec without the dictionary cannot decode; registering it fixes that
+    std::vector<uint8_t> decoded(terrain.size());
+    ZstdChunkCodec reader;
+    EXPECT_FALSE(reader.Decompress(trainedEncoded, decoded));
+    EXPECT_TRUE(reader.Decompress(plainEncoded, decoded));
+    ASSERT_EQ(dictionaryId, reader.AddDictionary(dictionary));
+    ASSERT_TRUE(reader.Decompress(trainedEncoded, decoded));
+    EXPECT_EQ(terrain, decoded);
+
+    EXPECT_EQ(0u, reader.AddDictionary(MakeNoise(1024, 1)));
+}
+
+TEST(ChunkCodecTest, ZstdDictionariesBelongToOneWorld) {
+    std::vector<std::vector<uint8_t>> samples;
+    for (uint32_t seed = 100; seed < 400; ++seed) {
+        samples.push_back(MakeTerrain(seed));
+    }
+    std::vector<std::span<const uint8_t>> sampleSpans(samples.begin(), samples.end());
+    const std::vector<uint8_t> dictionary = ZstdChunkCodec::TrainDictionary(sampleSpans, 16 * 1024);
+    ASSERT_FALSE(dictionary.empty());
+
+    ZstdChunkCodec zstd;
+    const uint32_t dictionaryId = zstd.AddDictionary(dictionary, 1);
+    ASSERT_NE(0u, dictionaryId);
+
+    // World 0 is active: world 1's dictionary is neither used nor found
+    const std::vector<uint8_t> terrain = MakeTerrain(9);
+    EXPECT_EQ(0u, zstd.GetCompressionDictionaryId());
+    EXPECT_FALSE(zstd.HasDictionary(dictionaryId));
+
+    zstd.SetActiveWorld(1);
+    EXPECT_EQ(dictionaryId, zstd.GetCompressionDictionaryId());
+    std::vector<uint8_t> worldOneEncoded;
+    ASSERT_TRUE(zstd.Compress(terrain, worldOneEncoded));
+
+    // A world without dictionaries compresses plainly, and cannot read world 1's frames
+    zstd.SetActiveWorld(2);
+    EXPECT_EQ(2, zstd.GetActiveWorld());
+    std::vector<uint8_t> worldTwoEncoded;
+    ASSERT_TRUE(zstd.Compress(terrain, worldTwoEncoded));
+    std::vector<uint8_t> decoded(terrain.size());
+    EXPECT_FALSE(zstd.Decompress(worldOneEncoded, decoded));
+    ZstdChunkCodec fresh;
+    ASSERT_TRUE(fresh.Decompress(worldTwoEncoded, decoded));
+    EXPECT_EQ(terrain, decoded);
+
+    zstd.SetActiveWorld(1);
+    ASSERT_TRUE(zstd.Decompress(worldOneEncoded, decoded));
+    EXPECT_EQ(terrain, decoded);
+}
+
+// =============================================================================
+// Registry Tests
+// =============================================================================
+
+TEST(ChunkCodecRegistryTest, EncodeThenDecodeRestoresTerrain) {
+    ChunkCodecRegistry codecs;
+    ChunkBufferPool pool;
+    ASSERT_FALSE(codecs.SetSaveCodec("brotli"));
+
+    for (const char* name : {"none", "lz4", "zstd"}) {
+        ASSERT_TRUE(codecs.SetSaveCodec(name));
+        ChunkData chunk;
+        chunk.terrainData = MakeTerrain(3);
+        const std::vector<uint8_t> original = chunk.terrainData;
+
+        ASSERT_TRUE(codecs.Encode(chunk));
+        EXPECT_EQ(std::string(name), chunk.compressionType);
+        EXPECT_EQ(original.size(), chunk.uncompressedSize);
+
+        ASSERT_TRUE(codecs.Decode(chunk, pool));
+        EXPECT_EQ("none", chunk.compressionType);
+        EXPECT_EQ(original, chunk.terrainData);
+        pool.Release(std::move(chunk.terrainData));
+    }
+    EXPECT_GT(pool.GetReuseCount(), 0u);
+}
+
+TEST(ChunkCodecRegistryTest, IncompressibleChunksAreStoredRaw) {
+    ChunkCodecRegistry codecs;
+    ASSERT_TRUE(codecs.SetSaveCodec("lz4"));
+
+    ChunkData chunk;
+    chunk.terrainData = MakeNoise(4096, 5);
+    const std::vector<uint8_t> original = chunk.terrainData;
+    ASSERT_TRUE(codecs.Encode(chunk));
+    EXPECT_EQ("none", chunk.compressionType);
+    EXPECT_EQ(original, chunk.terrainData);
+}
+
+TEST(ChunkCodecRegistryTest, DecodeHandlesLegacyAndUnknownRows) {
+    ChunkCodecRegistry codecs;
+    ChunkBufferPool pool;
+
+    // Rows written before codecs existed say "zlib" but hold raw bytes
+    ChunkData legacy;
+    legacy.compressionType = "zlib";
+    legacy.terrainData = MakeTerrain(4);
+    const std::vector<uint8_t> original = legacy.terrainData;
+    ASSERT_TRUE(codecs.Decode(legacy, pool));
+    EXPECT_EQ(original, legacy.terrainData);
+    EXPECT_EQ(original.size(), legacy.uncompressedSize);
+
+    ChunkData unknown;
+    unknown.compressionType = "brotli";
+    unknown.uncompressedSize = 64;
+    unknown.terrainData = MakeNoise(32, 2);
+    EXPECT_FALSE(codecs.Decode(unknown, pool));
+
+    ChunkData corrupt;
+    corrupt.compressionType = "lz4";
+    corrupt.uncompressedSize = 4096;
+    corrupt.terrainData = MakeNoise(100, 3);
+    EXPECT_FALSE(codecs.Decode(corrupt, pool));
+}
+
+TEST(ChunkCodecRegistryTest, DecodeRejectsImplausibleSizesBeforeAllocating) {
+    ChunkCodecRegistry codecs;
+    ChunkBufferPool pool;
+
+    // Valid payloads whose stored size was tampered with
+    for (const char* name : {"lz4", "zstd"}) {
+        ASSERT_TRUE(codecs.SetSaveCodec(name));
+        ChunkData chunk;
+        chunk.terrainData = MakeTerrain(5);
+        ASSERT_TRUE(codecs.Encode(chunk));
+        const ChunkData encoded = chunk;
+
+        chunk.uncompressedSize = size_t(1) << 40;
+        EXPECT_FALSE(codecs.Decode(chunk, pool)) << name;
+        chunk = encoded;
+        chunk.uncompressedSize = ChunkCodecRegistry::kMaxDecodedSize;
+        EXPECT_FALSE(codecs.Decode(chunk, pool)) << name;
+    }
+
+    // zstd frames carry their content size
+    ChunkData zstdChunk;
+    zstdChunk.terrainData = MakeTerrain(6);
+    ASSERT_TRUE(codecs.Encode(zstdChunk));
+    zstdChunk.uncompressedSize += 1;
+    EXPECT_FALSE(codecs.Decode(zstdChunk, pool));
+
+    ChunkData garbage;
+    garbage.compressionType = "zstd";
+    garbage.uncompressedSize = 4096;
+    garbage.terrainData = MakeNoise(64, 4);
+    EXPECT_FALSE(codecs.Decode(garbage, pool));
+
+    EXPECT_EQ(0u, pool.GetAllocationCount());
+}
+
+// =============================================================================
+// Buffer Pool Tests
+// =============================================================================
+
+TEST(ChunkBufferPoolTest, ReusesBuffersOfTheSameSizeClass) {
+    ChunkBufferPool pool(2);
+
+    std::vector<uint8_t> buffer = pool.Acquire(30000);
+    EXPECT_EQ(30000u, buffer.size());
+    EXPECT_GE(buffer.capacity(), 32768u);
+    const uint8_t* storage = buffer.data();
+    pool.Release(std::move(buffer));
+    EXPECT_EQ(1u, pool.GetPooledCount());
+
+    // Same 32 KB class: same storage comes back
+    std::vector<uint8_t> again = pool.Acquire(32768);
+    EXPECT_EQ(storage, again.data());
+    EXPECT_EQ(1u, pool.GetReuseCount());
+
+    // Different class: fresh allocation
+    std::vector<uint8_t> larger = pool.Acquire(40000);
+    EXPECT_EQ(2u, pool.GetAllocationCount());
+
+    // Free list limit per class
+    pool.Release(std::move(again));
+    pool.Release(pool.Acquire(20000));
+    pool.Release(std::vector<uint8_t>(32768));
+    EXPECT_LE(pool.GetPooledCount(), 2u);
+    pool.Release(std::vector<uint8_t>(16));
+    EXPECT_LE(pool.GetPooledCount(), 2u);
+}
@@ -0,0 +1,372 @@
+/**
+ * @file test_chunk_streamer.cpp
+ * @brief Unit tests for ChunkStreamer against a real world database
+ *
+ * Test categories:
+ * - Compression dictionaries follow the world the database has loaded
+ * - View velocity tracking and prefetching along the predicted path
+ * - Deadline-ordered scheduling of the I/O queue
+ */
+
+#include <gtest/gtest.h>
+
+#include "persistence/ChunkStreamer.hpp"
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr int kChunkEdge = 32;
+
+bool WaitFor(const std::function<bool()>& condition, std::chrono::milliseconds timeout = std::chrono::milliseconds(5000)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/**
+ * @brief Layered terrain column data, as in test_chunk_codec.cpp
+ */
+std::vector<uint8_t> MakeTerrain(uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> jitter(-1, 1);
+    std::uniform_int_distribution<int> ore(0, 199);
+
+    std::vector<uint8_t> voxels(kChunkEdge * kChunkEdge * kChunkEdge, 0);
+    int height = 16;
+    for (int z = 0; z < kChunkEdge; ++z) {
+        for (int x = 0; x < kChunkEdge; ++x) {
+            height = std::clamp(height + jitter(rng), 8, 24);
+            for (int y = 0; y < height; ++y) {
+                uint8_t block = y < height - 4 ? 1 : (y < height - 1 ? 2 : 3);
+                if (block == 1 && ore(rng) == 0) block = 7;
+                voxels[(y * kChunkEdge + z) * kChunkEdge + x] = block;
+            }
+        }
+    }
+    return voxels;
+}
+
+ChunkData MakeChunk(glm::ivec3 pos, uint32_t seed) {
+    ChunkData chunk;
+    chunk.chunkX = pos.x;
+    chunk.chunkY = pos.y;
+    chunk.chunkZ = pos.z;
+    chunk.terrainData = MakeTerrain(seed);
+    chunk.isGenerated = true;
+    return chunk;
+}
+
+/**
+ * @brief Walk the default view along +x at a steady speed, reporting
+ *        positions the way a frame loop would
+ * @return Final position
+ */
+glm::vec3 WalkView(ChunkStreamer& streamer, float speed, std::chrono::milliseconds duration) {
+    const auto start = std::chrono::steady_clock::now();
+    glm::vec3 position(0.0f);
+    streamer.SetViewPosition(position);
+    while (std::chrono::steady_clock::now() - start < duration) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        position.x = speed * seconds;
+        streamer.SetViewPosition(position);
+    }
+    return position;
+}
+
+/**
+ * @brief Database file with the world schema; worlds are created by the tests
+ */
+class ChunkStreamerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        m_path = (std::filesystem::temp_directory_path() /
+                  (std::string("nova_streamer_") + info->name() + ".db")).string();
+        RemoveFiles();
+
+        std::ifstream schemaFile(NOVA_WORLD_SCHEMA_PATH);
+        ASSERT_TRUE(schemaFile) << NOVA_WORLD_SCHEMA_PATH;
+        std::stringstream schema;
+        schema << schemaFile.rdbuf();
+        sqlite3* raw = nullptr;
+        ASSERT_EQ(SQLITE_OK, sqlite3_open(m_path.c_str(), &raw));
+        const int result = sqlite3_exec(raw, schema.str().c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(raw);
+        ASSERT_EQ(SQLITE_OK, result);
+
+        ASSERT_TRUE(m_db.Initialize(m_path));
+    }
+
+    void TearDown() override {
+        m_db.Shutdown();
+        RemoveFiles();
+    }
+
+    void RemoveFiles() {
+        std::filesystem::remove(m_path);
+        std::filesystem::remove(m_path + "-wal");
+        std::filesystem::remove(m_path + "-shm");
+    }
+
+    static bool SaveAndWait(ChunkStreamer& streamer, glm::ivec3 pos, const ChunkData& chunk) {
+        std::atomic<int> result{-1};
+        streamer.SaveChunk(pos, chunk, [&result](bool success) { result = success ? 1 : 0; });
+        return WaitFor([&result] { return result >= 0; }) && result == 1;
+    }
+
+    /**
+     * @brief Streamer on a fresh world with the given chunks stored
+     */
+    std::unique_ptr<ChunkStreamer> MakeStreamer(const std::vector<glm::ivec3>& stored) {
+        const int worldId = m_db.CreateWorld("stream", 1);
+        EXPECT_GE(worldId, 0);
+        EXPECT_TRUE(m_db.LoadWorld(worldId));
+        uint32_t seed = 1;
+        for (const glm::ivec3& pos : stored) {
+            EXPECT_TRUE(m_db.SaveChunk(pos.x, pos.y, pos.z, MakeChunk(pos, seed++)));
+        }
+
+        auto streamer = std::make_unique<ChunkStreamer>();
+        EXPECT_TRUE(streamer->Initialize(&m_db));
+        streamer->SetAutoSaveEnabled(false);
+        return streamer;
+    }
+
+    static bool LoadAndWait(ChunkStreamer& streamer, glm::ivec3 pos) {
+        std::atomic<int> result{-1};
+        streamer.LoadChunk(pos, 0, [&result](bool success) { result = success ? 1 : 0; });
+        return WaitFor([&] { return result >= 0 && streamer.IsChunkLoaded(pos); }) && result == 1;
+    }
+
+    std::string m_path;
+    WorldDatabase m_db;
+};
+
+} // namespace
+
+// =============================================================================
+// Compression Dictionary Tests
+// =============================================================================
+
+TEST_F(ChunkStreamerTest, DictionariesFollowTheLoadedWorld) {
+    const int worldA = m_db.CreateWorld("a", 1);
+    const int worldB = m_db.CreateWorld("b", 2);
+    ASSERT_GE(worldA, 0);
+    ASSERT_GE(worldB, 0);
+
+    // Initialized before any world is loaded
+    auto streamer = std::make_unique<ChunkStreamer>();
+    ASSERT_TRUE(streamer->Initialize(&m_db));
+    streamer->SetAutoSaveEnabled(false);
+    ASSERT_TRUE(streamer->SetCompression("zstd"));
+
+    ASSERT_TRUE(m_db.LoadWorld(worldA));
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(m_db.SaveChunk(i, 0, 0, MakeChunk(glm::ivec3(i, 0, 0), 100 + i)));
+    }
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(LoadAndWait(*streamer, glm::ivec3(i, 0, 0)));
+    }
+    const uint32_t dictionaryId = streamer->TrainCompressionDictionary(1024, 16 * 1024);
+    ASSERT_NE(0u, dictionaryId);
+    EXPECT_EQ(dictionaryId, streamer->GetCodecs().GetZstd().GetCompressionDictionaryId());
+    streamer->UnloadAllChunks(false);
+
+    // World B has no dictionary: its chunks must not be compressed with A's
+    ASSERT_TRUE(m_db.LoadWorld(worldB));
+    const glm::ivec3 pos(5, 0, 5);
+    const ChunkData chunk = MakeChunk(pos, 7);
+    ASSERT_TRUE(SaveAndWait(*streamer, pos, chunk));
+    EXPECT_EQ(0u, streamer->GetCodecs().GetZstd().GetCompressionDictionaryId());
+
+    // A restart only has B's (absent) dictionaries to decode with
+    streamer->Shutdown();
+    streamer = std::make_unique<ChunkStreamer>();
+    ASSERT_TRUE(streamer->Initialize(&m_db));
+    streamer->SetAutoSaveEnabled(false);
+    ASSERT_TRUE(LoadAndWait(*streamer, pos));
+    ASSERT_NE(nullptr, streamer->GetChunk(pos));
+    EXPECT_EQ(chunk.terrainData, streamer->GetChunk(pos)->terrainData);
+    EXPECT_EQ(0u, streamer->GetStatistics().decodeFailures);
+    streamer->UnloadAllChunks(false);
+
+    // Back in A, its stored dictionary is loaded again and used
+    ASSERT_TRUE(m_db.LoadWorld(worldA));
+    ASSERT_TRUE(streamer->SetCompression("zstd"));
+    ASSERT_TRUE(SaveAndWait(*streamer, pos, chunk));
+    EXPECT_EQ(dictionaryId, streamer->GetCodecs().GetZstd().GetCompressionDictionaryId());
+    streamer->UnloadAllChunks(false);
+    ASSERT_TRUE(LoadAndWait(*streamer, pos));
+    EXPECT_EQ(chunk.terrainData, streamer->GetChunk(pos)->terrainData);
+    streamer->Shutdown();
+}
+
+// =============================================================================
+// View Path Prediction Tests
+// =============================================================================
+
+TEST_F(ChunkStreamerTest, ViewVelocityFollowsMovementAndResetsOnTeleport) {
+    auto streamer = MakeStreamer({});
+    streamer->SetViewDistance(64.0f);
+
+    // Four filter time constants of steady movement
+    const glm::vec3 position = WalkView(*streamer, 30.0f, std::chrono::milliseconds(1000));
+    const glm::vec3 velocity = streamer->GetViewVelocity(0);
+    EXPECT_NEAR(30.0f, velocity.x, 3.0f);
+    EXPECT_NEAR(0.0f, velocity.z, 0.5f);
+
+    // A jump of more than half the view distance is not movement
+    streamer->SetViewPosition(position + glm::vec3(1000.0f, 0.0f, 0.0f));
+    EXPECT_EQ(glm::vec3(0.0f), streamer->GetViewVelocity(0));
+
+    EXPECT_EQ(glm::vec3(0.0f), streamer->GetViewVelocity(7));
+    streamer->Shutdown();
+}
+
+TEST_F(ChunkStreamerTest, PrefetchesAlongThePredictedPath) {
+    // Walking +x at 30 units/s ends near x = 30 with a 64 unit view distance:
+    // column 8 (centre x = 136) comes into range in about 1.4 s, column -6
+    // (centre x = -88) is as far behind and never does
+    const glm::ivec3 ahead(8, 0, 0);
+    const glm::ivec3 behind(-6, 0, 0);
+    auto streamer = MakeStreamer({ahead, behind, glm::ivec3(2, 0, 0)});
+    streamer->SetViewDistance(64.0f);
+    streamer->SetPrefetchTime(3.0f);
+
+    WalkView(*streamer, 30.0f, std::chrono::milliseconds(1000));
+    streamer->Update(0.0f);
+
+    EXPECT_TRUE(WaitFor([&] { return streamer->IsChunkLoaded(ahead); }));
+    EXPECT_TRUE(WaitFor([&] { return streamer->IsChunkLoaded(glm::ivec3(2, 0, 0)); }));
+    EXPECT_EQ(ChunkLoadState::Unloaded, streamer->GetChunkState(behind));
+    EXPECT_GT(streamer->GetStatistics().prefetchedLoads, 0u);
+    streamer->Shutdown();
+}
+
+TEST_F(ChunkStreamerTest, WithoutPrefetchOnlyTheViewDiscIsLoaded) {
+    const glm::ivec3 ahead(8, 0, 0);
+    const glm::ivec3 near(2, 0, 0);
+    auto streamer = MakeStreamer({ahead, near});
+    streamer->SetViewDistance(64.0f);
+    streamer->SetPrefetchTime(0.0f);
+
+    WalkView(*streamer, 30.0f, std::chrono::milliseconds(1000));
+    streamer->Update(0.0f);
+
+    EXPECT_TRUE(WaitFor([&] { return streamer->IsChunkLoaded(near); }));
+    EXPECT_EQ(ChunkLoadState::Unloaded, streamer->GetChunkState(ahead));
+    EXPECT_EQ(0u, streamer->GetStatistics().prefetchedLoads);
+    streamer->Shutdown();
+}
+
+// =============================================================================
+// Deadline Scheduling Tests
+// =============================================================================
+
+TEST(ChunkIORequestTest, HeapPopsEarliestDeadlineThenHighestPriority) {
+    auto make = [](int64_t deadline, int priority) {
+        ChunkIORequest request;
+        request.type = ChunkIORequestType::Load;
+        request.deadline = deadline;
+        request.priority = priority;
+        return request;
+    };
+
+    std::vector<ChunkIORequest> heap;
+    for (const auto& [deadline, priority] : std::vector<std::pair<int64_t, int>>{
+             {300, 100}, {100, 10}, {200, 50}, {100, 90}, {50, 0}}) {
+        heap.push_back(make(deadline, priority));
+        std::push_heap(heap.begin(), heap.end());
+    }
+
+    std::vector<std::pair<int64_t, int>> order;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end());
+        order.emplace_back(heap.back().deadline, heap.back().priority);
+        heap.pop_back();
+    }
+    const std::vector<std::pair<int64_t, int>> expected{{50, 0}, {100, 90}, {100, 10}, {200, 50}, {300, 100}};
+    EXPECT_EQ(expected, order);
+}
+
+TEST_F(ChunkStreamerTest, LoadsNeededNowOvertakeWarmedDestinations) {
+    // The warmed disc (radius 16 around chunk 0,0) is its centre column and
+    // the four columns beside it; the centre is nearest, so goes first
+    const glm::ivec3 blocker(20, 0, 20);
+    const glm::ivec3 urgent(-20, 0, -20);
+    const std::vector<glm::ivec3> warmed = {
+        glm::ivec3(0, 0, 0), glm::ivec3(1, 0, 0), glm::ivec3(-1, 0, 0), glm::ivec3(0, 0, 1), glm::ivec3(0, 0, -1)};
+    std::vector<glm::ivec3> stored = warmed;
+    stored.push_back(blocker);
+    stored.push_back(urgent);
+    auto streamer = MakeStreamer(stored);
+    streamer->SetDecodeBatchSize(1);
+
+    std::mutex orderMutex;
+    std::vector<glm::ivec3> order;
+    streamer->OnChunkLoaded = [&](glm::ivec3 pos, const ChunkData&) {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(pos);
+    };
+
+    // Hold the I/O thread in the blocker's callback while the queue fills
+    std::mutex gateMutex;
+    std::condition_variable gate;
+    bool blocked = false;
+    bool released = false;
+    streamer->LoadChunk(blocker, 0, [&](bool) {
+        std::unique_lock<std::mutex> lock(gateMutex);
+        blocked = true;
+        gate.notify_all();
+        gate.wait(lock, [&] { return released; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(gateMutex);
+        ASSERT_TRUE(gate.wait_for(lock, std::chrono::seconds(5), [&] { return blocked; }));
+    }
+
+    streamer->WarmDestination(glm::vec3(8.0f, 8.0f, 8.0f), 5.0f, 16.0f);
+    streamer->Update(0.0f);
+    streamer->LoadChunk(urgent, 0, nullptr);
+    {
+        std::lock_guard<std::mutex> lock(gateMutex);
+        released = true;
+    }
+    gate.notify_all();
+
+    ASSERT_TRUE(WaitFor([&] {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        return order.size() == stored.size();
+    }));
+    streamer->Shutdown();
+
+    EXPECT_EQ(blocker, order[0]);
+    EXPECT_EQ(urgent, order[1]);
+    EXPECT_EQ(glm::ivec3(0, 0, 0), order[2]);
+    for (const glm::ivec3& pos : warmed) {
+        EXPECT_NE(order.end(), std::find(order.begin() + 2, order.end(), pos));
+    }
+    EXPECT_GT(streamer->GetStatistics().prefetchedLoads, 0u);
+}
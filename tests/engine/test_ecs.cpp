@@ -0,0 +1,297 @@
+/**
+ * @file test_ecs.cpp
+ * @brief Unit tests for the archetype/chunk entity component store
+ *
+ * Test categories:
+ * - Generational handles
+ * - Archetype moves on Add / Remove
+ * - Dense chunks and cache-line aligned columns
+ * - Serial and parallel queries
+ * - Non-trivial component lifetimes
+ */
+
+#include <gtest/gtest.h>
+
+#include "ecs/World.hpp"
+#include "core/JobSystem.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+using namespace Nova;
+using namespace Nova::ECS;
+
+namespace {
+
+struct Position {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct Velocity {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct Health {
+    float value = 100.0f;
+};
+
+struct FrozenTag {};
+
+struct Tracked {
+    std::shared_ptr<int> counter;
+};
+
+} // namespace
+
+// =============================================================================
+// Handles
+// =============================================================================
+
+TEST(ECSWorldTest, CreateAndGet) {
+    World world;
+    EntityHandle e = world.Create(Position{1, 2, 3}, Velocity{4, 5, 6});
+
+    ASSERT_TRUE(world.IsAlive(e));
+    EXPECT_EQ(world.GetEntityCount(), 1u);
+    ASSERT_NE(world.Get<Position>(e), nullptr);
+    EXPECT_FLOAT_EQ(world.Get<Position>(e)->y, 2.0f);
+    EXPECT_FLOAT_EQ(world.Get<Velocity>(e)->z, 6.0f);
+    EXPECT_EQ(world.Get<Health>(e), nullptr);
+    EXPECT_FALSE(world.Has<Health>(e));
+}
+
+TEST(ECSWorldTest, StaleHandlesDoNotResolveAfterSlotReuse) {
+    World world;
+    EntityHandle first = world.Create(Position{1, 0, 0});
+    ASSERT_TRUE(world.Destroy(first));
+    EXPECT_FALSE(world.IsAlive(first));
+    EXPECT_FALSE(world.Destroy(first));
+
+    EntityHandle second = world.Create(Position{2, 0, 0});
+    EXPECT_EQ(second.index, first.index);
+    EXPECT_NE(second.generation, first.generation);
+    EXPECT_EQ(world.Get<Position>(first), nullptr);
+    EXPECT_FLOAT_EQ(world.Get<Position>(second)->x, 2.0f);
+    EXPECT_FALSE(EntityHandle{}.IsValid());
+    EXPECT_EQ(EntityHandle::FromU64(second.ToU64()), second);
+}
+
+TEST(ECSWorldTest, DestroyKeepsOtherHandlesValid) {
+    World world;
+    std::vector<EntityHandle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.push_back(world.Create(Position{static_cast<float>(i), 0, 0}));
+    }
+
+    // Removing from the front forces the tail rows to be moved into the holes
+    for (int i = 0; i < 1000; i += 3) {
+        ASSERT_TRUE(world.Destroy(handles[i]));
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(world.IsAlive(handles[i]));
+        } else {
+            ASSERT_NE(world.Get<Position>(handles[i]), nullptr);
+            EXPECT_FLOAT_EQ(world.Get<Position>(handles[i])->x, static_cast<float>(i));
+        }
+    }
+}
+
+// =============================================================================
+// Structural Changes
+// =============================================================================
+
+TEST(ECSWorldTest, AddAndRemoveMoveBetweenArchetypes) {
+    World world;
+    EntityHandle a = world.Create(Position{1, 0, 0});
+    EntityHandle b = world.Create(Position{2, 0, 0});
+
+    ASSERT_TRUE(world.Add(a, Velocity{0, 1, 0}));
+    EXPECT_EQ(world.GetArchetypeCount(), 2u);
+    EXPECT_FLOAT_EQ(world.Get<Position>(a)->x, 1.0f);
+    EXPECT_FLOAT_EQ(world.Get<Velocity>(a)->y, 1.0f);
+    EXPECT_FLOAT_EQ(world.Get<Position>(b)->x, 2.0f);
+
+    // Adding a component the entity already has overwrites in place
+    ASSERT_TRUE(world.Add(a, Velocity{0, 7, 0}));
+    EXPECT_FLOAT_EQ(world.Get<Velocity>(a)->y, 7.0f);
+    EXPECT_EQ(world.GetArchetypeCount(), 2u);
+
+    ASSERT_TRUE(world.Add<FrozenTag>(a));
+    EXPECT_TRUE(world.Has<FrozenTag>(a));
+    ASSERT_TRUE(world.Remove<Velocity>(a));
+    EXPECT_FALSE(world.Has<Velocity>(a));
+    EXPECT_TRUE(world.Has<FrozenTag>(a));
+    EXPECT_FLOAT_EQ(world.Get<Position>(a)->x, 1.0f);
+    EXPECT_FALSE(world.Remove<Velocity>(a));
+}
+
+TEST(ECSWorldTest, ComponentLifetimesAreBalanced) {
+    auto counter = std::make_shared<int>(0);
+    {
+        World world;
+        std::vector<EntityHandle> handles;
+        for (int i = 0; i < 600; ++i) {
+            handles.push_back(world.Create(Tracked{counter}, Position{}));
+        }
+        EXPECT_EQ(counter.use_count(), 601);
+
+        for (int i = 0; i < 600; i += 2) {
+            world.Destroy(handles[i]);
+        }
+        EXPECT_EQ(counter.use_count(), 301);
+
+        for (int i = 1; i < 600; i += 4) {
+            world.Remove<Position>(handles[i]);
+            world.Add(handles[i], Health{});
+        }
+        EXPECT_EQ(counter.use_count(), 301);
+
+        world.Remove<Tracked>(handles[1]);
+        EXPECT_EQ(counter.use_count(), 300);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+// =============================================================================
+// Chunk Layout
+// =============================================================================
+
+TEST(ECSWorldTest, ChunksAreDenseAndColumnsCacheLineAligned) {
+    World world;
+    for (int i = 0; i < 5000; ++i) {
+        world.Create(Position{}, Velocity{}, Health{});
+    }
+
+    const Archetype& archetype = *world.GetArchetypes().front();
+    ASSERT_GT(archetype.GetChunkCount(), 1u);
+    EXPECT_GT(archetype.GetChunkCapacity(), 100u);
+
+    for (size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk) {
+        if (chunk + 1 < archetype.GetChunkCount()) {
+            EXPECT_EQ(archetype.GetCount(chunk), archetype.GetChunkCapacity());
+        }
+        for (ComponentTypeId id : archetype.GetComponents()) {
+            auto address = reinterpret_cast<uintptr_t>(archetype.GetColumn(chunk, id));
+            EXPECT_EQ(address % kComponentColumnAlignment, 0u);
+        }
+    }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+TEST(ECSWorldTest, ForEachVisitsMatchingEntitiesOnly) {
+    World world;
+    for (int i = 0; i < 300; ++i) {
+        world.Create(Position{}, Velocity{1, 0, 0});
+    }
+    for (int i = 0; i < 200; ++i) {
+        world.Create(Position{});
+    }
+    for (int i = 0; i < 100; ++i) {
+        world.Create(Position{}, Velocity{1, 0, 0}, FrozenTag{});
+    }
+
+    int visited = 0;
+    world.ForEach<Position, const Velocity>([&](Position& p, const Velocity& v) {
+        p.x += v.x;
+        ++visited;
+    });
+    EXPECT_EQ(visited, 400);
+
+    std::set<uint64_t> frozen;
+    world.ForEach<Position>(MakeComponentMask<FrozenTag>(), [&](EntityHandle handle, Position& p) {
+        frozen.insert(handle.ToU64());
+        EXPECT_FLOAT_EQ(p.x, 1.0f);
+    });
+    EXPECT_EQ(frozen.size(), 100u);
+    EXPECT_EQ(world.Count(MakeComponentMask<Position>()), 600u);
+    EXPECT_EQ(world.Count(MakeComponentMask<Velocity>()), 400u);
+}
+
+TEST(ECSWorldTest, ParallelForEachUpdatesEveryEntityOnce) {
+    auto& jobs = JobSystem::Instance();
+    if (!jobs.IsInitialized()) {
+        (void)jobs.Initialize();
+    }
+
+    World world;
+    std::vector<EntityHandle> handles;
+    for (int i = 0; i < 20000; ++i) {
+        handles.push_back(world.Create(Position{}, Velocity{1, 2, 3}));
+    }
+
+    for (int frame = 0; frame < 3; ++frame) {
+        world.ParallelForEach<Position, const Velocity>([](Position& p, const Velocity& v) {
+            p.x += v.x;
+            p.y += v.y;
+            p.z += v.z;
+        });
+    }
+
+    for (EntityHandle handle : handles) {
+        const Position* p = world.Get<Position>(handle);
+        ASSERT_NE(p, nullptr);
+        EXPECT_FLOAT_EQ(p->z, 9.0f);
+    }
+}
+
+TEST(ECSWorldTest, ParallelForEachChunkSplitsChunksIntoRowRanges) {
+    auto& jobs = JobSystem::Instance();
+    if (!jobs.IsInitialized()) {
+        (void)jobs.Initialize();
+    }
+
+    World world;
+    std::vector<EntityHandle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.push_back(world.Create(Position{static_cast<float>(i), 0.0f, 0.0f}));
+    }
+
+    // Rows stay paired with their handles, and every row is visited once
+    std::mutex mutex;
+    size_t views = 0;
+    size_t rows = 0;
+    uint32_t largest = 0;
+    std::set<uint32_t> seen;
+    world.ParallelForEachChunk(MakeComponentMask<Position>(), [&](const ChunkView& view) {
+        const Position* positions = view.Get<Position>();
+        const EntityHandle* viewHandles = view.Handles();
+        std::lock_guard<std::mutex> lock(mutex);
+        ++views;
+        rows += view.Count();
+        largest = std::max(largest, view.Count());
+        for (uint32_t i = 0; i < view.Count(); ++i) {
+            EXPECT_EQ(world.Get<Position>(viewHandles[i]), &positions[i]);
+            seen.insert(static_cast<uint32_t>(positions[i].x));
+        }
+    }, 100);
+
+    EXPECT_EQ(rows, handles.size());
+    EXPECT_EQ(seen.size(), handles.size());
+    EXPECT_LE(largest, 100u);
+    EXPECT_GE(views, 10u);
+}
+
+TEST(ECSWorldTest, ClearInvalidatesHandles) {
+    World world;
+    EntityHandle e = world.Create(Position{});
+    world.Clear();
+    EXPECT_FALSE(world.IsAlive(e));
+    EXPECT_EQ(world.GetEntityCount(), 0u);
+
+    EntityHandle reused = world.Create(Position{});
+    EXPECT_TRUE(world.IsAlive(reused));
+    EXPECT_NE(reused, e);
+}
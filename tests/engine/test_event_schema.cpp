@@ -0,0 +1,334 @@
+/**
+ * @file test_event_schema.cpp
+ * @brief Unit tests for compiled event schemas and the bit-packed event codec
+ *
+ * Test categories:
+ * - BitWriter/BitReader primitives (varints, quantisation, quaternions)
+ * - EventCodec round trips, unknown properties and storage reuse
+ * - EventTypeRegistry type IDs and ReplicationSystem wire formats
+ */
+
+#include <gtest/gtest.h>
+
+#include "networking/EventSchema.hpp"
+#include "networking/ReplicationSystem.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+EventSchema MakeMoveSchema() {
+    EventSchema schema;
+    schema.typeId = 7;
+    schema.typeName = "test.move";
+    schema.defaultCategory = static_cast<uint8_t>(ReplicationCategory::EntityMovement);
+    schema.defaultReliabilityMode = static_cast<uint8_t>(ReliabilityMode::Unreliable);
+    schema.fields = {
+        {"position", FieldEncoding::QuantizedVec3, -1024.0f, 1024.0f, 20},
+        {"rotation", FieldEncoding::Quaternion, 0.0f, 1.0f, 12},
+        {"speed", FieldEncoding::QuantizedFloat, 0.0f, 20.0f, 8},
+        {"state", FieldEncoding::Int32, 0.0f, 1.0f, 0}
+    };
+    return schema;
+}
+
+NetworkEvent MakeMoveEvent(const EventSchema& schema) {
+    NetworkEvent event;
+    schema.InitEvent(event);
+    event.eventId = 1234;
+    event.sourceEntityId = 42;
+    event.sourceClientId = 3;
+    event.timestamp = 1700000000000ull;
+    event.properties[0].value = glm::vec3(100.25f, -3.5f, 512.0f);
+    event.properties[1].value = glm::quat(0.9238795f, 0.0f, 0.3826834f, 0.0f);
+    event.properties[2].value = 7.5f;
+    event.properties[3].value = int32_t{-2};
+    return event;
+}
+
+float QuatDot(const glm::quat& a, const glm::quat& b) {
+    return std::abs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+}
+
+} // namespace
+
+// =============================================================================
+// Bit Stream Tests
+// =============================================================================
+
+TEST(BitStreamTest, PrimitivesRoundTrip) {
+    std::array<uint8_t, 128> buffer{};
+    BitWriter writer(buffer);
+    writer.WriteBits(5, 3);
+    writer.WriteBool(true);
+    writer.WriteVarUInt(0);
+    writer.WriteVarUInt(127);
+    writer.WriteVarUInt(128);
+    writer.WriteVarUInt(std::numeric_limits<uint64_t>::max());
+    writer.WriteVarInt(-1);
+    writer.WriteVarInt(std::numeric_limits<int64_t>::min());
+    writer.WriteFloat(3.25f);
+    writer.WriteDouble(-1.0e100);
+    writer.WriteBits64(0x123456789ABCull, 48);
+    const size_t size = writer.Finish();
+    ASSERT_GT(size, 0u);
+
+    BitReader reader(std::span<const uint8_t>(buffer.data(), size));
+    EXPECT_EQ(5u, reader.ReadBits(3));
+    EXPECT_TRUE(reader.ReadBool());
+    EXPECT_EQ(0u, reader.ReadVarUInt());
+    EXPECT_EQ(127u, reader.ReadVarUInt());
+    EXPECT_EQ(128u, reader.ReadVarUInt());
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), reader.ReadVarUInt());
+    EXPECT_EQ(-1, reader.ReadVarInt());
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), reader.ReadVarInt());
+    EXPECT_FLOAT_EQ(3.25f, reader.ReadFloat());
+    EXPECT_DOUBLE_EQ(-1.0e100, reader.ReadDouble());
+    EXPECT_EQ(0x123456789ABCull, reader.ReadBits64(48));
+    EXPECT_FALSE(reader.HasError());
+}
+
+TEST(BitStreamTest, SmallVarIntsTakeOneByte) {
+    std::array<uint8_t, 8> buffer{};
+    BitWriter writer(buffer);
+    writer.WriteVarInt(-64);
+    EXPECT_EQ(1u, writer.Finish());
+}
+
+TEST(BitStreamTest, OverflowAndTruncationAreReported) {
+    std::array<uint8_t, 4> buffer{};
+    BitWriter writer(buffer);
+    writer.WriteFloat(1.0f);
+    writer.WriteBits(1, 1);
+    EXPECT_EQ(0u, writer.Finish());
+    EXPECT_TRUE(writer.HasOverflowed());
+
+    BitReader reader(std::span<const uint8_t>(buffer.data(), 2));
+    reader.ReadBits(16);
+    EXPECT_FALSE(reader.HasError());
+    EXPECT_EQ(0u, reader.ReadBits(1));
+    EXPECT_TRUE(reader.HasError());
+}
+
+TEST(BitStreamTest, QuantizationErrorIsWithinHalfStep) {
+    std::array<uint8_t, 64> buffer{};
+    const float values[] = {-100.0f, -33.3f, 0.0f, 12.345f, 100.0f, 250.0f};
+
+    BitWriter writer(buffer);
+    for (float v : values) {
+        writer.WriteQuantized(v, -100.0f, 100.0f, 12);
+    }
+    const size_t size = writer.Finish();
+    EXPECT_EQ((6u * 12u + 7u) / 8u, size);
+
+    BitReader reader(std::span<const uint8_t>(buffer.data(), size));
+    const float halfStep = 0.5f * 200.0f / 4095.0f;
+    for (float v : values) {
+        const float expected = std::min(v, 100.0f);  // Out-of-range values clamp
+        EXPECT_NEAR(expected, reader.ReadQuantized(-100.0f, 100.0f, 12), halfStep + 1e-4f);
+    }
+}
+
+TEST(BitStreamTest, SmallestThreeQuaternionsPreserveRotation) {
+    std::mt19937 rng(11);
+    std::normal_distribution<float> dist;
+
+    for (int i = 0; i < 200; ++i) {
+        glm::quat q(dist(rng), dist(rng), dist(rng), dist(rng));
+        const float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        q = glm::quat(q.w / length, q.x / length, q.y / length, q.z / length);
+
+        std::array<uint8_t, 8> buffer{};
+        BitWriter writer(buffer);
+        writer.WriteQuaternion(q, 10);
+        ASSERT_EQ(4u, writer.Finish());  // 2 + 3 * 10 bits
+
+        BitReader reader(buffer);
+        const glm::quat decoded = reader.ReadQuaternion(10);
+        EXPECT_GT(QuatDot(q, decoded), 0.9999f);
+    }
+}
+
+// =============================================================================
+// Codec Tests
+// =============================================================================
+
+TEST(EventCodecTest, RoundTripIsCompact) {
+    const EventSchema schema = MakeMoveSchema();
+    const NetworkEvent event = MakeMoveEvent(schema);
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+    const size_t size = EventCodec::Encode(schema, event, buffer);
+    ASSERT_GT(size, 0u);
+    EXPECT_LE(size, 28u);  // 12 bytes of varint IDs and timestamp, 16 of slots
+    EXPECT_EQ(7u, EventCodec::PeekTypeId(std::span<const uint8_t>(buffer.data(), size)));
+
+    NetworkEvent decoded;
+    ASSERT_TRUE(EventCodec::Decode(schema, std::span<const uint8_t>(buffer.data(), size), decoded));
+    EXPECT_EQ("test.move", decoded.eventType);
+    EXPECT_EQ(1234u, decoded.eventId);
+    EXPECT_EQ(42u, decoded.sourceEntityId);
+    EXPECT_EQ(3u, decoded.sourceClientId);
+    EXPECT_EQ(1700000000000ull, decoded.timestamp);
+    EXPECT_EQ(ReplicationCategory::EntityMovement, decoded.category);
+    EXPECT_EQ(ReliabilityMode::Unreliable, decoded.reliabilityMode);
+
+    ASSERT_EQ(4u, decoded.properties.size());
+    const glm::vec3 position = std::get<glm::vec3>(decoded.properties[0].value);
+    EXPECT_NEAR(100.25f, position.x, 2e-3f);
+    EXPECT_NEAR(-3.5f, position.y, 2e-3f);
+    EXPECT_NEAR(512.0f, position.z, 2e-3f);
+    EXPECT_GT(QuatDot(std::get<glm::quat>(event.properties[1].value),
+                      std::get<glm::quat>(decoded.properties[1].value)), 0.9999f);
+    EXPECT_NEAR(7.5f, std::get<float>(decoded.properties[2].value), 0.04f);
+    EXPECT_EQ(-2, std::get<int32_t>(decoded.properties[3].value));
+}
+
+TEST(EventCodecTest, MissingAndOutOfOrderPropertiesAreMatchedByName) {
+    const EventSchema schema = MakeMoveSchema();
+    NetworkEvent event;
+    event.eventType = schema.typeName;
+    event.properties.push_back({"state", EventValue(int32_t{9})});
+    event.properties.push_back({"position", EventValue(glm::vec3(1.0f, 2.0f, 3.0f))});
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+    const size_t size = EventCodec::Encode(schema, event, buffer);
+    NetworkEvent decoded;
+    ASSERT_TRUE(EventCodec::Decode(schema, std::span<const uint8_t>(buffer.data(), size), decoded));
+
+    // Decoded properties come back in slot order
+    ASSERT_EQ(2u, decoded.properties.size());
+    EXPECT_EQ("position", decoded.properties[0].name);
+    EXPECT_EQ("state", decoded.properties[1].name);
+    EXPECT_EQ(9, std::get<int32_t>(decoded.properties[1].value));
+}
+
+TEST(EventCodecTest, UnknownPropertiesAndHeaderOverridesSurvive) {
+    const EventSchema schema = MakeMoveSchema();
+    NetworkEvent event = MakeMoveEvent(schema);
+    event.priority = EventPriority::Critical;
+    event.reliabilityMode = ReliabilityMode::ReliableOrdered;
+    event.properties[3].value = std::string("wrong type");  // Slot type mismatch
+    event.properties.push_back({"note", EventValue(std::string("hello"))});
+    event.properties.push_back({"blob", EventValue(std::vector<uint8_t>{1, 2, 3})});
+    event.properties.push_back({"exact", EventValue(0.1)});
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+    const size_t size = EventCodec::Encode(schema, event, buffer);
+    NetworkEvent decoded;
+    ASSERT_TRUE(EventCodec::Decode(schema, std::span<const uint8_t>(buffer.data(), size), decoded));
+
+    EXPECT_EQ(EventPriority::Critical, decoded.priority);
+    EXPECT_EQ(ReliabilityMode::ReliableOrdered, decoded.reliabilityMode);
+    EXPECT_EQ("wrong type", decoded.GetPropertyAs<std::string>("state"));
+    EXPECT_EQ("hello", decoded.GetPropertyAs<std::string>("note"));
+    EXPECT_EQ((std::vector<uint8_t>{1, 2, 3}), decoded.GetPropertyAs<std::vector<uint8_t>>("blob"));
+    EXPECT_DOUBLE_EQ(0.1, decoded.GetPropertyAs<double>("exact"));
+    EXPECT_EQ(event.properties.size(), decoded.properties.size());
+}
+
+TEST(EventCodecTest, DecodeReusesPropertyStorage) {
+    const EventSchema schema = MakeMoveSchema();
+    const NetworkEvent event = MakeMoveEvent(schema);
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+    const size_t size = EventCodec::Encode(schema, event, buffer);
+    const std::span<const uint8_t> data(buffer.data(), size);
+
+    NetworkEvent decoded;
+    ASSERT_TRUE(EventCodec::Decode(schema, data, decoded));
+    const EventProperty* storage = decoded.properties.data();
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(EventCodec::Decode(schema, data, decoded));
+    }
+    EXPECT_EQ(storage, decoded.properties.data());
+    EXPECT_EQ(4u, decoded.properties.size());
+}
+
+TEST(EventCodecTest, RejectsWrongTypeAndTruncatedData) {
+    const EventSchema schema = MakeMoveSchema();
+    const NetworkEvent event = MakeMoveEvent(schema);
+
+    std::array<uint8_t, EventCodec::kMaxEventSize> buffer{};
+    const size_t size = EventCodec::Encode(schema, event, buffer);
+
+    EventSchema other = schema;
+    other.typeId = 8;
+    NetworkEvent decoded;
+    EXPECT_FALSE(EventCodec::Decode(other, std::span<const uint8_t>(buffer.data(), size), decoded));
+    EXPECT_FALSE(EventCodec::Decode(schema, std::span<const uint8_t>(buffer.data(), size - 3), decoded));
+
+    // Too small an output buffer reports failure instead of truncating
+    std::array<uint8_t, 8> tiny{};
+    EXPECT_EQ(0u, EventCodec::Encode(schema, event, tiny));
+}
+
+// =============================================================================
+// Registry Tests
+// =============================================================================
+
+TEST(EventSchemaRegistryTest, TypesGetStableIds) {
+    auto& registry = EventTypeRegistry::Instance();
+
+    EventTypeConfig config;
+    config.typeName = "test.schema.a";
+    config.fields = {{"value", FieldEncoding::UInt32, 0.0f, 1.0f, 0}};
+    registry.RegisterType(config);
+
+    const EventSchema* schema = registry.GetSchema("test.schema.a");
+    ASSERT_NE(nullptr, schema);
+    EXPECT_NE(EventCodec::kDynamicTypeId, schema->typeId);
+    EXPECT_EQ(schema, registry.GetSchema(schema->typeId));
+    const uint64_t hash = registry.GetSchemaHash();
+
+    // Re-registering keeps the ID and the schema object
+    config.fields.push_back({"extra", FieldEncoding::Bool, 0.0f, 1.0f, 0});
+    registry.RegisterType(config);
+    EXPECT_EQ(schema, registry.GetSchema("test.schema.a"));
+    EXPECT_EQ(2u, schema->fields.size());
+    EXPECT_NE(hash, registry.GetSchemaHash());
+
+    // Types without fields have no schema
+    EventTypeConfig dynamic;
+    dynamic.typeName = "test.schema.dynamic";
+    registry.RegisterType(dynamic);
+    EXPECT_EQ(nullptr, registry.GetSchema("test.schema.dynamic"));
+
+    registry.UnregisterType("test.schema.a");
+    EXPECT_EQ(nullptr, registry.GetSchema("test.schema.a"));
+    registry.UnregisterType("test.schema.dynamic");
+}
+
+TEST(EventSchemaRegistryTest, SerializeEventUsesSchemaWhenRegistered) {
+    auto& registry = EventTypeRegistry::Instance();
+    EventTypeConfig config;
+    config.typeName = "test.schema.move";
+    config.fields = MakeMoveSchema().fields;
+    registry.RegisterType(config);
+    const EventSchema* schema = registry.GetSchema("test.schema.move");
+    ASSERT_NE(nullptr, schema);
+
+    NetworkEvent event = MakeMoveEvent(*schema);
+    auto& replication = ReplicationSystem::Instance();
+    const std::vector<uint8_t> packed = replication.SerializeEvent(event);
+    EXPECT_EQ(schema->typeId, EventCodec::PeekTypeId(packed));
+    EXPECT_EQ("test.schema.move", replication.DeserializeEvent(packed).eventType);
+
+    // Unregistered types fall back to the dynamic format
+    event.eventType = "test.schema.unregistered";
+    const std::vector<uint8_t> dynamic = replication.SerializeEvent(event);
+    EXPECT_EQ(EventCodec::kDynamicTypeId, EventCodec::PeekTypeId(dynamic));
+    EXPECT_GT(dynamic.size(), packed.size());
+
+    const NetworkEvent decoded = replication.DeserializeEvent(dynamic);
+    EXPECT_EQ("test.schema.unregistered", decoded.eventType);
+    EXPECT_EQ(4u, decoded.properties.size());
+
+    registry.UnregisterType("test.schema.move");
+}
@@ -0,0 +1,270 @@
+/**
+ * @file test_interest_manager.cpp
+ * @brief Unit tests for grid-based interest management and send budgets
+ *
+ * Test categories:
+ * - Incremental visible sets (entity and client movement, removal)
+ * - Agreement with a brute-force relevancy check
+ * - Priority accumulators under a per-client byte budget
+ */
+
+#include <gtest/gtest.h>
+
+#include "networking/InterestManager.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+InterestConfig MakeConfig(size_t bytesPerTick = 4096) {
+    InterestConfig config;
+    config.cellSize = 50.0f;
+    config.defaultBytesPerTick = bytesPerTick;
+    config.defaultUpdateBytes = 32;
+    return config;
+}
+
+} // namespace
+
+// =============================================================================
+// Visible Set Tests
+// =============================================================================
+
+TEST(InterestManagerTest, VisibleSetFollowsEntityMovement) {
+    InterestManager interest(MakeConfig());
+    interest.SetClientPosition(1, glm::vec3(0.0f), 100.0f);
+    interest.UpdateEntity(10, glm::vec3(50.0f, 0.0f, 0.0f));
+    interest.Update(0.05f);
+    EXPECT_TRUE(interest.IsVisibleTo(10, 1));
+
+    interest.UpdateEntity(10, glm::vec3(500.0f, 0.0f, 0.0f));
+    interest.Update(0.05f);
+    EXPECT_FALSE(interest.IsVisibleTo(10, 1));
+
+    interest.UpdateEntity(10, glm::vec3(-20.0f, 5.0f, 60.0f));
+    interest.Update(0.05f);
+    EXPECT_TRUE(interest.IsVisibleTo(10, 1));
+}
+
+TEST(InterestManagerTest, VisibleSetFollowsClientMovement) {
+    InterestManager interest(MakeConfig());
+    interest.UpdateEntity(10, glm::vec3(0.0f));
+    interest.UpdateEntity(11, glm::vec3(1000.0f, 0.0f, 1000.0f));
+    interest.SetClientPosition(1, glm::vec3(0.0f), 100.0f);
+    interest.Update(0.05f);
+    EXPECT_TRUE(interest.IsVisibleTo(10, 1));
+    EXPECT_FALSE(interest.IsVisibleTo(11, 1));
+
+    interest.SetClientPosition(1, glm::vec3(1000.0f, 0.0f, 990.0f), 100.0f);
+    interest.Update(0.05f);
+    EXPECT_FALSE(interest.IsVisibleTo(10, 1));
+    EXPECT_TRUE(interest.IsVisibleTo(11, 1));
+    EXPECT_EQ(1u, interest.GetVisibleCount(1));
+}
+
+TEST(InterestManagerTest, OnlyNearbyEntitiesAreTested) {
+    InterestManager interest(MakeConfig());
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coord(0.0f, 4096.0f);
+    for (uint64_t id = 1; id <= 10000; ++id) {
+        interest.UpdateEntity(id, glm::vec3(coord(rng), 0.0f, coord(rng)));
+    }
+    interest.SetClientPosition(1, glm::vec3(2048.0f, 0.0f, 2048.0f), 100.0f);
+    interest.Update(0.05f);
+
+    // Move 100 entities: only those near the client are re-tested
+    for (uint64_t id = 1; id <= 100; ++id) {
+        interest.UpdateEntity(id, glm::vec3(coord(rng), 0.0f, coord(rng)));
+    }
+    interest.Update(0.05f);
+    EXPECT_LT(interest.GetStats().relevanceTests, 10u);
+}
+
+TEST(InterestManagerTest, ClientWithoutAreasSeesEverything) {
+    InterestManager interest(MakeConfig());
+    interest.AddClient(1);
+    interest.UpdateEntity(10, glm::vec3(0.0f));
+    interest.UpdateEntity(11, glm::vec3(1.0e5f, 0.0f, -1.0e5f));
+    interest.Update(0.05f);
+    EXPECT_EQ(2u, interest.GetVisibleCount(1));
+
+    const std::vector<uint32_t> clients = interest.GetClientsInterestedIn(11, glm::vec3(1.0e5f, 0.0f, -1.0e5f));
+    EXPECT_EQ(std::vector<uint32_t>{1}, clients);
+}
+
+TEST(InterestManagerTest, RelevanceUsesAllAreas) {
+    InterestManager interest(MakeConfig());
+    interest.SetClientPosition(1, glm::vec3(0.0f), 100.0f);
+    interest.AddInterestArea(1, glm::vec3(400.0f, 0.0f, 0.0f), 50.0f, 2.0f);
+    interest.SetClientPosition(2, glm::vec3(400.0f, 0.0f, 0.0f), 10.0f);
+
+    EXPECT_TRUE(interest.IsRelevant(0, glm::vec3(420.0f, 0.0f, 0.0f), 1));
+    EXPECT_FALSE(interest.IsRelevant(0, glm::vec3(200.0f, 0.0f, 0.0f), 1));
+    EXPECT_GT(interest.GetRelevanceScore(0, glm::vec3(400.0f, 0.0f, 0.0f), 1),
+              interest.GetRelevanceScore(0, glm::vec3(0.0f), 1));
+    EXPECT_TRUE(interest.IsRelevant(0, glm::vec3(0.0f), 99));  // Unknown client
+
+    std::vector<uint32_t> clients = interest.GetClientsInterestedIn(0, glm::vec3(405.0f, 0.0f, 0.0f));
+    std::sort(clients.begin(), clients.end());
+    EXPECT_EQ((std::vector<uint32_t>{1, 2}), clients);
+    EXPECT_EQ(std::vector<uint32_t>{1}, interest.GetClientsInterestedIn(0, glm::vec3(30.0f, 0.0f, 0.0f)));
+}
+
+TEST(InterestManagerTest, RemovalCleansUp) {
+    InterestManager interest(MakeConfig());
+    interest.SetClientPosition(1, glm::vec3(0.0f), 100.0f);
+    interest.SetClientPosition(2, glm::vec3(0.0f), 100.0f);
+    interest.UpdateEntity(10, glm::vec3(10.0f, 0.0f, 0.0f));
+    interest.UpdateEntity(11, glm::vec3(20.0f, 0.0f, 0.0f));
+    interest.Update(0.05f);
+    EXPECT_EQ(4u, interest.GetStats().visiblePairs);
+
+    interest.RemoveEntity(10);
+    EXPECT_FALSE(interest.HasEntity(10));
+    EXPECT_EQ(1u, interest.GetVisibleCount(1));
+    EXPECT_TRUE(interest.IsVisibleTo(11, 2));
+
+    interest.RemoveClient(1);
+    EXPECT_FALSE(interest.HasClient(1));
+    EXPECT_EQ(1u, interest.GetStats().visiblePairs);
+
+    interest.RemoveEntity(11);
+    interest.RemoveClient(2);
+    EXPECT_EQ(0u, interest.GetStats().cellCount);
+}
+
+TEST(InterestManagerTest, MatchesBruteForceUnderRandomMotion) {
+    InterestManager interest(MakeConfig());
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> step(-40.0f, 40.0f);
+
+    constexpr uint64_t kEntities = 400;
+    constexpr uint32_t kClients = 8;
+    std::vector<glm::vec3> entities(kEntities);
+    std::vector<glm::vec3> clients(kClients);
+    const float radius = 120.0f;
+
+    for (uint64_t id = 0; id < kEntities; ++id) {
+        entities[id] = glm::vec3(coord(rng), 0.0f, coord(rng));
+        interest.UpdateEntity(id, entities[id]);
+    }
+
+    for (int tick = 0; tick < 30; ++tick) {
+        for (uint32_t c = 0; c < kClients; ++c) {
+            if (tick == 0 || rng() % 4 == 0) {
+                clients[c] = glm::vec3(coord(rng), 0.0f, coord(rng));
+                interest.SetClientPosition(c, clients[c], radius);
+            }
+        }
+        for (uint64_t id = 0; id < kEntities; ++id) {
+            if (rng() % 3 == 0) {
+                entities[id] += glm::vec3(step(rng), 0.0f, step(rng));
+                interest.UpdateEntity(id, entities[id]);
+            }
+        }
+        interest.Update(0.05f);
+
+        for (uint32_t c = 0; c < kClients; ++c) {
+            for (uint64_t id = 0; id < kEntities; ++id) {
+                const glm::vec3 offset = entities[id] - clients[c];
+                const bool expected = glm::dot(offset, offset) <= radius * radius;
+                ASSERT_EQ(expected, interest.IsVisibleTo(id, c)) << "tick " << tick << " client " << c << " entity " << id;
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Budget Tests
+// =============================================================================
+
+TEST(InterestManagerTest, BudgetPicksMostRelevantFirst) {
+    InterestManager interest(MakeConfig(10 * 32));
+    interest.SetClientPosition(1, glm::vec3(0.0f), 1000.0f);
+    for (uint64_t id = 1; id <= 100; ++id) {
+        interest.UpdateEntity(id, glm::vec3(static_cast<float>(id) * 9.0f, 0.0f, 0.0f));
+    }
+    interest.Update(0.05f);
+
+    std::vector<uint64_t> selected;
+    interest.SelectUpdates(1, selected);
+    ASSERT_EQ(10u, selected.size());
+    for (size_t i = 0; i < selected.size(); ++i) {
+        EXPECT_EQ(i + 1, selected[i]);
+    }
+    EXPECT_EQ(90u, interest.GetStats().deferredUpdates);
+}
+
+TEST(InterestManagerTest, UnchangedEntitiesAreNotResent) {
+    InterestManager interest(MakeConfig());
+    interest.SetClientPosition(1, glm::vec3(0.0f), 100.0f);
+    interest.UpdateEntity(10, glm::vec3(5.0f, 0.0f, 0.0f));
+    interest.Update(0.05f);
+
+    std::vector<uint64_t> selected;
+    interest.SelectUpdates(1, selected);
+    EXPECT_EQ(std::vector<uint64_t>{10}, selected);
+
+    interest.Update(0.05f);
+    interest.SelectUpdates(1, selected);
+    EXPECT_TRUE(selected.empty());
+
+    interest.MarkEntityChanged(10);
+    interest.Update(0.05f);
+    interest.SelectUpdates(1, selected);
+    EXPECT_EQ(std::vector<uint64_t>{10}, selected);
+}
+
+TEST(InterestManagerTest, DistantEntitiesAreNotStarved) {
+    InterestManager interest(MakeConfig(20 * 32));
+    interest.SetClientPosition(1, glm::vec3(0.0f), 1000.0f);
+
+    // 200 entities all changing every tick, budget for 20 per tick
+    std::set<uint64_t> delivered;
+    std::vector<uint64_t> selected;
+    size_t nearUpdates = 0;
+    size_t farUpdates = 0;
+    for (int tick = 0; tick < 100; ++tick) {
+        for (uint64_t id = 1; id <= 200; ++id) {
+            interest.UpdateEntity(id, glm::vec3(static_cast<float>(id) * 4.9f, 0.0f, 0.0f));
+        }
+        interest.Update(0.05f);
+        interest.SelectUpdates(1, selected);
+        EXPECT_EQ(20u, selected.size());
+        for (uint64_t id : selected) {
+            delivered.insert(id);
+            nearUpdates += id <= 20 ? 1 : 0;
+            farUpdates += id > 180 ? 1 : 0;
+        }
+    }
+
+    EXPECT_EQ(200u, delivered.size());
+    EXPECT_GT(nearUpdates, farUpdates * 3);
+}
+
+TEST(InterestManagerTest, PriorityScalesUpdateRate) {
+    InterestManager interest(MakeConfig(32));
+    interest.SetClientPosition(1, glm::vec3(0.0f), 100.0f);
+    interest.UpdateEntity(1, glm::vec3(10.0f, 0.0f, 0.0f));
+    interest.UpdateEntity(2, glm::vec3(-10.0f, 0.0f, 0.0f));
+    interest.SetEntityPriority(2, 4.0f);
+
+    int highPriority = 0;
+    std::vector<uint64_t> selected;
+    for (int tick = 0; tick < 50; ++tick) {
+        interest.UpdateEntity(1, glm::vec3(10.0f, 0.0f, 0.0f));
+        interest.UpdateEntity(2, glm::vec3(-10.0f, 0.0f, 0.0f));
+        interest.Update(0.05f);
+        interest.SelectUpdates(1, selected);
+        ASSERT_EQ(1u, selected.size());
+        highPriority += selected[0] == 2 ? 1 : 0;
+    }
+    EXPECT_GE(highPriority, 35);
+    EXPECT_LT(highPriority, 50);
+}
@@ -366,10 +366,187 @@ TEST_F(JobSystemTest, ConcurrentSubmit) {
     EXPECT_EQ(400, counter);
 }
 
+// =============================================================================
+// Work Stealing Tests
+// =============================================================================
+
+TEST_F(JobSystemTest, NestedSubmitFromWorker) {
+    // Jobs submitted from a worker land in its own deque and get stolen by others
+    std::atomic<int> counter{0};
+    JobCounter outer;
+
+    for (int i = 0; i < 8; ++i) {
+        JobSystem::Instance().Submit([&counter]() {
+            JobCounter inner;
+            for (int j = 0; j < 64; ++j) {
+                JobSystem::Instance().Submit([&counter]() {
+                    counter++;
+                }, inner);
+            }
+            inner.Wait();
+        }, outer);
+    }
+
+    outer.Wait();
+
+    EXPECT_EQ(8 * 64, counter);
+}
+
+TEST_F(JobSystemTest, MoreJobsThanQueueCapacity) {
+    // Exceeding the slot pool makes the submitter help instead of failing
+    constexpr int numJobs = 20000;
+    std::atomic<int> counter{0};
+    JobCounter jobCounter;
+
+    for (int i = 0; i < numJobs; ++i) {
+        JobSystem::Instance().Submit([&counter]() {
+            counter++;
+        }, jobCounter);
+    }
+
+    jobCounter.Wait();
+
+    EXPECT_EQ(numJobs, counter);
+    EXPECT_EQ(0u, JobSystem::Instance().GetPendingJobCount());
+}
+
+TEST_F(JobSystemTest, LargeCaptureRunsAndIsDestroyed) {
+    // Captures larger than the inline slot storage fall back to the heap
+    auto tracker = std::make_shared<int>(0);
+    std::array<char, 256> payload{};
+    payload[255] = 7;
+    std::atomic<int> result{0};
+
+    auto handle = JobSystem::Instance().Submit([tracker, payload, &result]() {
+        result = payload[255];
+    });
+    handle.Wait();
+
+    EXPECT_EQ(7, result);
+    EXPECT_EQ(1, tracker.use_count());
+}
+
+TEST_F(JobSystemTest, HandleCompletesAfterSlotReuse) {
+    auto first = JobSystem::Instance().Submit([]() {});
+    first.Wait();
+
+    // Recycle slots many times; the stale handle must stay complete
+    for (int i = 0; i < 1000; ++i) {
+        JobSystem::Instance().Submit([]() {}).Wait();
+    }
+
+    EXPECT_TRUE(first.IsComplete());
+}
+
+// =============================================================================
+// Nested Wait Tests
+// =============================================================================
+
+TEST_F(JobSystemTest, NestedParallelForInsideJobs) {
+    // More waiting parents than workers: blocking waits would deadlock here
+    const uint32_t parents = JobSystem::Instance().GetWorkerCount() * 4;
+    std::atomic<int> counter{0};
+
+    JobSystem::Instance().ParallelFor(0, parents, 1, [&counter](size_t) {
+        JobSystem::Instance().ParallelFor(0, 256, 16, [&counter](size_t) {
+            counter++;
+        });
+    });
+
+    EXPECT_EQ(static_cast<int>(parents * 256), counter);
+}
+
+TEST_F(JobSystemTest, ParallelSortDeepRecursion) {
+    std::vector<int> data(200000);
+    std::mt19937 gen(1234);
+    for (auto& val : data) {
+        val = static_cast<int>(gen());
+    }
+
+    // Small threshold forces many levels of nested Submit + Wait
+    Parallel::Sort(data.begin(), data.end(), std::less<>{}, 1000);
+
+    EXPECT_TRUE(std::is_sorted(data.begin(), data.end()));
+}
+
+TEST_F(JobSystemTest, JobHandleWaitInsideJob) {
+    std::atomic<int> value{0};
+
+    auto outer = JobSystem::Instance().Submit([&value]() {
+        auto inner = JobSystem::Instance().Submit([&value]() {
+            value = 1;
+        });
+        inner.Wait();
+        value = value * 10;
+    });
+    outer.Wait();
+
+    EXPECT_EQ(10, value);
+}
+
 // =============================================================================
 // Dependencies Tests
 // =============================================================================
 
+TEST_F(JobSystemTest, SubmitAfter_WaitsForAllDependencies) {
+    std::atomic<int> finished{0};
+    std::atomic<int> seenByDependent{-1};
+    JobCounter dependencies;
+
+    // A and C
+    for (int i = 0; i < 2; ++i) {
+        JobSystem::Instance().Submit([&finished]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            finished++;
+        }, dependencies);
+    }
+
+    // B runs after A and C
+    auto handle = JobSystem::Instance().SubmitAfter(dependencies, [&finished, &seenByDependent]() {
+        seenByDependent = finished.load();
+    });
+
+    handle.Wait();
+    dependencies.Wait();
+
+    EXPECT_EQ(2, seenByDependent);
+}
+
+TEST_F(JobSystemTest, SubmitAfter_CompletedDependencyRunsImmediately) {
+    JobCounter done;
+    std::atomic<bool> ran{false};
+
+    auto handle = JobSystem::Instance().SubmitAfter(done, [&ran]() {
+        ran = true;
+    });
+    handle.Wait();
+
+    EXPECT_TRUE(ran);
+}
+
+TEST_F(JobSystemTest, SubmitAfter_Chain) {
+    std::vector<int> sequence;
+    std::mutex sequenceMutex;
+    auto record = [&sequence, &sequenceMutex](int value) {
+        std::lock_guard lock(sequenceMutex);
+        sequence.push_back(value);
+    };
+
+    JobCounter first, second, third;
+    JobSystem::Instance().Submit([&record]() { record(1); }, first);
+    JobSystem::Instance().SubmitAfter(first, [&record]() { record(2); }, second);
+    JobSystem::Instance().SubmitAfter(second, [&record]() { record(3); }, third);
+
+    third.Wait();
+    second.Wait();
+    first.Wait();
+
+    ASSERT_EQ(3, sequence.size());
+    EXPECT_EQ(1, sequence[0]);
+    EXPECT_EQ(2, sequence[1]);
+    EXPECT_EQ(3, sequence[2]);
+}
+
 TEST_F(JobSystemTest, ChainedJobs) {
     std::vector<int> sequence;
     std::mutex sequenceMutex;
@@ -491,3 +668,37 @@ TEST_F(JobSystemTest, Performance_ParallelSpeedup) {
     // Parallel should be faster (or at least not much slower)
     // Note: For small workloads, overhead may dominate
 }
+
+// =============================================================================
+// Shutdown Tests
+// =============================================================================
+
+TEST_F(JobSystemTest, ShutdownFinishesJobsWaitingOnNestedWork) {
+    // Jobs still running or queued when Shutdown() starts wait on nested work
+    // that has to keep being served until every deque is empty
+    auto& js = JobSystem::Instance();
+    std::atomic<int> finished{0};
+    std::atomic<int> nested{0};
+
+    JobCounter outer;
+    for (int i = 0; i < 64; ++i) {
+        js.Submit([&js, &finished, &nested]() {
+            JobCounter inner;
+            for (int j = 0; j < 4; ++j) {
+                js.Submit([&nested]() {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    nested++;
+                }, inner);
+            }
+            inner.Wait();
+            finished++;
+        }, outer);
+    }
+
+    js.Shutdown();
+
+    EXPECT_TRUE(outer.IsComplete());
+    EXPECT_EQ(64, finished.load());
+    EXPECT_EQ(64 * 4, nested.load());
+    EXPECT_FALSE(js.IsInitialized());
+}
@@ -0,0 +1,402 @@
+/**
+ * @file test_network_io_thread.cpp
+ * @brief Unit tests for the epoll network I/O thread and its SPSC queue
+ *
+ * Test categories:
+ * - BoundedSPSCQueue ordering and capacity
+ * - Loopback delivery, client IDs and replies
+ * - Per-client coalescing into MTU-sized datagrams
+ * - Back-pressure when the game thread stops polling
+ * - Fragmentation of oversized messages and the server's peer cap
+ */
+
+#include <gtest/gtest.h>
+
+#include "core/WorkStealingDeque.hpp"
+#include "networking/NetworkIOThread.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+using namespace Nova;
+
+namespace {
+
+bool WaitFor(const std::function<bool()>& condition, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    return true;
+}
+
+struct ReceivedMessage {
+    uint32_t clientId;
+    std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Poll every datagram currently queued and split it into messages
+ */
+size_t Drain(NetworkIOThread& io, std::vector<ReceivedMessage>& out) {
+    size_t datagrams = 0;
+    while (NetBuffer* buffer = io.Poll()) {
+        io.ReadMessages(*buffer, [&](std::span<const uint8_t> message) {
+            out.push_back({buffer->clientId, std::vector<uint8_t>(message.begin(), message.end())});
+        });
+        io.Release(buffer);
+        datagrams++;
+    }
+    return datagrams;
+}
+
+std::vector<uint8_t> MakeMessage(size_t size, uint8_t seed) {
+    std::vector<uint8_t> message(size);
+    for (size_t i = 0; i < size; ++i) {
+        message[i] = static_cast<uint8_t>(seed + i);
+    }
+    return message;
+}
+
+} // namespace
+
+// =============================================================================
+// SPSC Queue Tests
+// =============================================================================
+
+TEST(BoundedSPSCQueueTest, RejectsPushWhenFull) {
+    BoundedSPSCQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(4));
+
+    int value = -1;
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(0, value);
+    EXPECT_TRUE(queue.TryPush(4));
+    EXPECT_EQ(4u, queue.SizeApprox());
+}
+
+TEST(BoundedSPSCQueueTest, PreservesOrderAcrossThreads) {
+    BoundedSPSCQueue<uint32_t> queue(64);
+    constexpr uint32_t kCount = 200000;
+
+    std::thread producer([&queue] {
+        for (uint32_t i = 1; i <= kCount; ++i) {
+            while (!queue.TryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 1;
+    while (expected <= kCount) {
+        uint32_t value = 0;
+        if (queue.TryPop(value)) {
+            ASSERT_EQ(expected, value);
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    uint32_t extra = 0;
+    EXPECT_FALSE(queue.TryPop(extra));
+}
+
+#ifdef __linux__
+
+// =============================================================================
+// Loopback Tests
+// =============================================================================
+
+TEST(NetworkIOThreadTest, ClientAndServerExchangeMessages) {
+    NetworkIOThread server;
+    ASSERT_TRUE(server.Listen(0)) << server.GetLastError();
+    NetworkIOThread client;
+    ASSERT_TRUE(client.Connect("127.0.0.1", server.GetLocalPort())) << client.GetLastError();
+
+    const std::vector<uint8_t> header = {0xAA, 0xBB};
+    ASSERT_TRUE(client.Send(0, MakeMessage(10, 1)));
+    ASSERT_TRUE(client.Send(0, header, MakeMessage(20, 2)));
+    ASSERT_TRUE(client.Send(0, MakeMessage(30, 3)));
+    client.Flush();
+
+    std::vector<ReceivedMessage> received;
+    size_t datagrams = 0;
+    ASSERT_TRUE(WaitFor([&] { datagrams += Drain(server, received); return received.size() == 3; }));
+    EXPECT_EQ(1u, datagrams);
+    EXPECT_EQ(1u, received[0].clientId);
+    EXPECT_EQ(MakeMessage(10, 1), received[0].data);
+    EXPECT_EQ(22u, received[1].data.size());
+    EXPECT_EQ(0xAA, received[1].data[0]);
+    EXPECT_EQ(MakeMessage(30, 3), received[2].data);
+
+    // Reply to the ID the server assigned
+    ASSERT_TRUE(server.Send(received[0].clientId, MakeMessage(40, 4)));
+    server.Flush();
+
+    std::vector<ReceivedMessage> replies;
+    ASSERT_TRUE(WaitFor([&] { Drain(client, replies); return !replies.empty(); }));
+    EXPECT_EQ(0u, replies[0].clientId);
+    EXPECT_EQ(MakeMessage(40, 4), replies[0].data);
+}
+
+TEST(NetworkIOThreadTest, CoalescesUpToDatagramSize) {
+    NetIOConfig config;
+    config.datagramSize = 1200;
+    NetworkIOThread server;
+    ASSERT_TRUE(server.Listen(0));
+    NetworkIOThread client(config);
+    ASSERT_TRUE(client.Connect("127.0.0.1", server.GetLocalPort()));
+
+    // 102 byte frames: 11 per 1200 byte datagram
+    for (uint8_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(client.Send(0, MakeMessage(100, i)));
+    }
+    client.Flush();
+
+    std::vector<ReceivedMessage> received;
+    ASSERT_TRUE(WaitFor([&] { Drain(server, received); return received.size() == 100; }));
+    for (uint8_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(MakeMessage(100, i), received[i].data);
+    }
+
+    const NetworkIOThread::Stats stats = client.GetStats();
+    EXPECT_EQ(100u, stats.messagesSent);
+    EXPECT_EQ(10u, stats.datagramsSent);
+    EXPECT_LE(stats.bytesSent, 10u * 1200u);
+    EXPECT_EQ(10u, server.GetStats().datagramsReceived);
+}
+
+TEST(NetworkIOThreadTest, OversizedMessagesAreRejected) {
+    NetworkIOThread server;
+    ASSERT_TRUE(server.Listen(0));
+    NetworkIOThread client;
+    ASSERT_TRUE(client.Connect("127.0.0.1", server.GetLocalPort()));
+
+    EXPECT_FALSE(client.Send(0, MakeMessage(NetworkIOThread::kMaxFragmentedMessageSize + 1, 0)));
+    EXPECT_TRUE(client.Send(0, MakeMessage(NetworkIOThread::kMaxMessageSize, 0)));
+    client.Flush();
+
+    std::vector<ReceivedMessage> received;
+    ASSERT_TRUE(WaitFor([&] { Drain(server, received); return !received.empty(); }));
+    EXPECT_EQ(NetworkIOThread::kMaxMessageSize, received[0].data.size());
+    EXPECT_EQ(1u, client.GetStats().sendDropped);
+    EXPECT_EQ(0u, client.GetStats().messagesFragmented);
+
+    // Server never heard from client 99
+    EXPECT_TRUE(server.Send(99, MakeMessage(8, 0)));
+    server.Flush();
+    EXPECT_TRUE(WaitFor([&] { return server.GetStats().sendDropped == 1; }));
+}
+
+TEST(NetworkIOThreadTest, FragmentsMessagesLargerThanADatagram) {
+    NetworkIOThread server;
+    ASSERT_TRUE(server.Listen(0));
+    NetworkIOThread client;
+    ASSERT_TRUE(client.Connect("127.0.0.1", server.GetLocalPort()));
+
+    // Small messages either side stay whole; the large ones are split
+    const std::vector<uint8_t> header = {0xAA, 0xBB, 0xCC};
+    ASSERT_TRUE(client.Send(0, MakeMessage(10, 1)));
+    ASSERT_TRUE(client.Send(0, header, MakeMessage(20000, 2)));
+    ASSERT_TRUE(client.Send(0, MakeMessage(NetworkIOThread::kMaxMessageSize + 1, 3)));
+    ASSERT_TRUE(client.Send(0, MakeMessage(NetworkIOThread::kMaxFragmentedMessageSize, 4)));
+    ASSERT_TRUE(client.Send(0, MakeMessage(30, 5)));
+    client.Flush();
+
+    std::vector<ReceivedMessage> received;
+    ASSERT_TRUE(WaitFor([&] { Drain(server, received); return received.size() == 5; }));
+    EXPECT_EQ(MakeMessage(10, 1), received[0].data);
+    ASSERT_EQ(20003u, received[1].data.size());
+    EXPECT_EQ(0xCC, received[1].data[2]);
+    EXPECT_TRUE(std::equal(received[1].data.begin() + 3, received[1].data.end(), MakeMessage(20000, 2).begin()));
+    EXPECT_EQ(MakeMessage(NetworkIOThread::kMaxMessageSize + 1, 3), received[2].data);
+    EXPECT_EQ(MakeMessage(NetworkIOThread::kMaxFragmentedMessageSize, 4), received[3].data);
+    EXPECT_EQ(MakeMessage(30, 5), received[4].data);
+
+    EXPECT_EQ(3u, client.GetStats().messagesFragmented);
+    EXPECT_EQ(3u, server.GetStats().messagesReassembled);
+    EXPECT_EQ(0u, server.GetStats().fragmentsDropped);
+}
+
+TEST(NetworkIOThreadTest, DropsMalformedFragments) {
+    NetworkIOThread server;
+    ASSERT_TRUE(server.Listen(0));
+
+    sockaddr_in serverAddr{};
+    serverAddr.sin_family = AF_INET;
+    serverAddr.sin_port = htons(server.GetLocalPort());
+    inet_pton(AF_INET, "127.0.0.1", &serverAddr.sin_addr);
+    const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(fd, 0);
+
+    // Index past the count, a count of one and a short middle fragment,
+    // then a whole message so the test knows when all have arrived
+    const auto sendFrame = [&](uint8_t index, uint8_t count, size_t chunkSize) {
+        const size_t length = NetworkIOThread::kFragmentHeaderSize + chunkSize;
+        std::vector<uint8_t> datagram = {static_cast<uint8_t>(length & 0xFF),
+                                         static_cast<uint8_t>((length >> 8) | 0x80), 7, 0, index, count};
+        datagram.resize(NetworkIOThread::kFrameHeaderSize + length, 0x55);
+        sendto(fd, datagram.data(), datagram.size(), 0, reinterpret_cast<const sockaddr*>(&serverAddr), sizeof(serverAddr));
+    };
+    sendFrame(3, 2, 10);
+    sendFrame(0, 1, 10);
+    sendFrame(0, 2, 10);
+    const uint8_t whole[3] = {1, 0, 9};
+    sendto(fd, whole, sizeof(whole), 0, reinterpret_cast<const sockaddr*>(&serverAddr), sizeof(serverAddr));
+
+    std::vector<ReceivedMessage> received;
+    ASSERT_TRUE(WaitFor([&] { Drain(server, received); return !received.empty(); }));
+    ASSERT_EQ(1u, received.size());
+    EXPECT_EQ(9, received[0].data[0]);
+    EXPECT_EQ(3u, server.GetStats().fragmentsDropped);
+    EXPECT_EQ(0u, server.GetStats().messagesReassembled);
+    close(fd);
+}
+
+TEST(NetworkIOThreadTest, ServerTellsManyClientsApart) {
+    NetworkIOThread server;
+    ASSERT_TRUE(server.Listen(0));
+
+    sockaddr_in serverAddr{};
+    serverAddr.sin_family = AF_INET;
+    serverAddr.sin_port = htons(server.GetLocalPort());
+    inet_pton(AF_INET, "127.0.0.1", &serverAddr.sin_addr);
+
+    // Raw sockets framing one message each: [length][client index]
+    constexpr int kClients = 64;
+    std::vector<int> sockets;
+    for (int i = 0; i < kClients; ++i) {
+        const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(fd, 0);
+        const uint8_t datagram[3] = {1, 0, static_cast<uint8_t>(i)};
+        sendto(fd, datagram, sizeof(datagram), 0, reinterpret_cast<const sockaddr*>(&serverAddr), sizeof(serverAddr));
+        sockets.push_back(fd);
+    }
+
+    std::vector<ReceivedMessage> received;
+    ASSERT_TRUE(WaitFor([&] { Drain(server, received); return received.size() == kClients; }));
+    std::set<uint32_t> clientIds;
+    for (const ReceivedMessage& message : received) {
+        clientIds.insert(message.clientId);
+        ASSERT_TRUE(server.Send(message.clientId, message.data));
+    }
+    EXPECT_EQ(static_cast<size_t>(kClients), clientIds.size());
+    server.Flush();
+
+    // Every client gets its own index back
+    for (int i = 0; i < kClients; ++i) {
+        uint8_t reply[8] = {};
+        ssize_t size = -1;
+        ASSERT_TRUE(WaitFor([&] { size = recv(sockets[i], reply, sizeof(reply), MSG_DONTWAIT); return size > 0; }));
+        EXPECT_EQ(3, size);
+        EXPECT_EQ(i, reply[2]);
+        close(sockets[i]);
+    }
+}
+
+TEST(NetworkIOThreadTest, DropsWhenGameThreadFallsBehind) {
+    NetIOConfig config;
+    config.bufferCount = 8;
+    NetworkIOThread server(config);
+    ASSERT_TRUE(server.Listen(0));
+    NetworkIOThread client;
+    ASSERT_TRUE(client.Connect("127.0.0.1", server.GetLocalPort()));
+
+    // One datagram per message; the server does not poll until all arrived
+    for (uint8_t i = 0; i < 40; ++i) {
+        ASSERT_TRUE(client.Send(0, MakeMessage(1100, i)));
+    }
+    client.Flush();
+    ASSERT_TRUE(WaitFor([&] {
+        const NetworkIOThread::Stats stats = server.GetStats();
+        return stats.datagramsReceived + stats.receiveDropped == 40;
+    }));
+    EXPECT_EQ(8u, server.GetStats().datagramsReceived);
+
+    std::vector<ReceivedMessage> received;
+    EXPECT_EQ(8u, Drain(server, received));
+    EXPECT_EQ(MakeMessage(1100, 0), received[0].data);
+
+    // Released buffers are reused
+    ASSERT_TRUE(client.Send(0, MakeMessage(10, 7)));
+    client.Flush();
+    received.clear();
+    ASSERT_TRUE(WaitFor([&] { Drain(server, received); return !received.empty(); }));
+    EXPECT_EQ(MakeMessage(10, 7), received[0].data);
+}
+
+TEST(NetworkIOThreadTest, CapsPeerTableAndEvictsIdlePeers) {
+    NetIOConfig config;
+    config.maxPeers = 4;
+    config.peerIdleTimeoutMs = 200;
+    NetworkIOThread server(config);
+    ASSERT_TRUE(server.Listen(0));
+
+    sockaddr_in serverAddr{};
+    serverAddr.sin_family = AF_INET;
+    serverAddr.sin_port = htons(server.GetLocalPort());
+    inet_pton(AF_INET, "127.0.0.1", &serverAddr.sin_addr);
+
+    std::vector<int> sockets;
+    const auto sendFrom = [&](int socketIndex) {
+        const uint8_t datagram[3] = {1, 0, static_cast<uint8_t>(socketIndex)};
+        sendto(sockets[socketIndex], datagram, sizeof(datagram), 0,
+               reinterpret_cast<const sockaddr*>(&serverAddr), sizeof(serverAddr));
+    };
+    for (int i = 0; i < 6; ++i) {
+        const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(fd, 0);
+        sockets.push_back(fd);
+    }
+
+    // The table fills up; further addresses are refused while nobody is idle
+    std::vector<ReceivedMessage> received;
+    for (int i = 0; i < 4; ++i) {
+        sendFrom(i);
+        ASSERT_TRUE(WaitFor([&] { Drain(server, received); return received.size() == static_cast<size_t>(i + 1); }));
+    }
+    sendFrom(4);
+    ASSERT_TRUE(WaitFor([&] { return server.GetStats().peersRefused == 1; }));
+    EXPECT_EQ(0u, server.GetStats().peersEvicted);
+
+    // Peer 0 keeps talking; the other three go quiet and are forgotten
+    const auto idleUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    while (std::chrono::steady_clock::now() < idleUntil) {
+        sendFrom(0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    sendFrom(5);
+    ASSERT_TRUE(WaitFor([&] {
+        Drain(server, received);
+        return !received.empty() && received.back().data[0] == 5;
+    }));
+    EXPECT_EQ(3u, server.GetStats().peersEvicted);
+    EXPECT_EQ(1u, server.GetStats().peersRefused);
+
+    // Peer 0 kept its ID; the newcomer got a fresh one
+    EXPECT_EQ(received[0].clientId, received[received.size() - 2].clientId);
+    EXPECT_EQ(received[3].clientId + 1, received.back().clientId);
+
+    for (int fd : sockets) {
+        close(fd);
+    }
+}
+
+#endif
@@ -0,0 +1,411 @@
+/**
+ * @file test_pathfinding.cpp
+ * @brief Unit tests for frozen CSR graphs and the reusable A* search context
+ *
+ * Test categories:
+ * - Graph::Freeze layout (dense indices, offsets, weights, removed nodes)
+ * - A* on CompactGraph against Pathfinder::AStar on the source Graph
+ * - Walkability, search limits and context reuse across graphs
+ * - Hierarchical (HPA*) paths, local updates and abstract-only queries
+ */
+
+#include <gtest/gtest.h>
+
+#include "pathfinding/CompactGraph.hpp"
+#include "pathfinding/HierarchicalGraph.hpp"
+#include "pathfinding/Pathfinder.hpp"
+#include "math/Random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+constexpr float kCostTolerance = 1e-3f;
+
+void ExpectValidPath(const Graph& graph, const PathResult& path, int start, int goal) {
+    ASSERT_TRUE(path.found);
+    ASSERT_FALSE(path.nodeIds.empty());
+    EXPECT_EQ(path.nodeIds.front(), start);
+    EXPECT_EQ(path.nodeIds.back(), goal);
+    EXPECT_EQ(path.positions.size(), path.nodeIds.size());
+
+    float cost = 0.0f;
+    for (size_t i = 1; i < path.nodeIds.size(); ++i) {
+        ASSERT_TRUE(graph.HasEdge(path.nodeIds[i - 1], path.nodeIds[i]));
+        cost += graph.GetEdgeWeight(path.nodeIds[i - 1], path.nodeIds[i]);
+    }
+    EXPECT_NEAR(cost, path.totalCost, 1e-2f);
+}
+
+/**
+ * @brief 64x64 grid with a vertical wall at x = 32 that has a gap at y = 40
+ */
+class HierarchicalGraphTest : public ::testing::Test {
+protected:
+    static constexpr int kSize = 64;
+    static constexpr int kWallX = 32;
+    static constexpr int kGapY = 40;
+
+    static int Id(int x, int y) { return y * kSize + x; }
+
+    void SetUp() override {
+        graph.BuildGrid(kSize, kSize);
+        for (int y = 0; y < kSize; ++y) {
+            if (y != kGapY) {
+                graph.SetNodeWalkable(Id(kWallX, y), false);
+            }
+        }
+        config.sectorSize = 16.0f;
+    }
+
+    Graph graph;
+    HierarchicalGraphConfig config;
+};
+
+} // namespace
+
+// =============================================================================
+// Freeze Tests
+// =============================================================================
+
+TEST(CompactGraphTest, FreezeMatchesGraphTopology) {
+    Graph graph;
+    graph.BuildGrid(8, 6);
+
+    CompactGraph compact = graph.Freeze();
+    ASSERT_EQ(compact.GetNodeCount(), graph.GetNodeCount());
+
+    size_t edgeCount = 0;
+    for (const auto& [id, node] : graph.GetNodes()) {
+        const CompactGraph::Index index = compact.ToIndex(id);
+        ASSERT_NE(index, CompactGraph::INVALID_INDEX);
+        EXPECT_EQ(compact.ToNodeId(index), id);
+        EXPECT_EQ(compact.GetPosition(index), node.position);
+        EXPECT_EQ(compact.IsWalkable(index), node.walkable);
+
+        auto neighbors = compact.GetNeighbors(index);
+        auto weights = compact.GetEdgeWeights(index);
+        ASSERT_EQ(neighbors.size(), node.neighbors.size());
+        for (size_t i = 0; i < neighbors.size(); ++i) {
+            EXPECT_EQ(compact.ToNodeId(neighbors[i]), node.neighbors[i]);
+            EXPECT_FLOAT_EQ(weights[i], graph.GetEdgeWeight(id, node.neighbors[i]));
+        }
+        edgeCount += node.neighbors.size();
+    }
+    EXPECT_EQ(compact.GetEdgeCount(), edgeCount);
+}
+
+TEST(CompactGraphTest, FreezeSkipsRemovedNodes) {
+    Graph graph;
+    graph.BuildGrid(4, 4);
+    graph.RemoveNode(5);
+    graph.SetNodeWalkable(10, false);
+
+    CompactGraph compact = graph.Freeze();
+    EXPECT_EQ(compact.GetNodeCount(), 15u);
+    EXPECT_EQ(compact.ToIndex(5), CompactGraph::INVALID_INDEX);
+    EXPECT_EQ(compact.ToIndex(-1), CompactGraph::INVALID_INDEX);
+    EXPECT_EQ(compact.ToIndex(1000), CompactGraph::INVALID_INDEX);
+    EXPECT_FALSE(compact.IsWalkable(compact.ToIndex(10)));
+
+    // Dense order follows node IDs
+    EXPECT_EQ(compact.ToIndex(4), 4u);
+    EXPECT_EQ(compact.ToIndex(6), 5u);
+
+    for (CompactGraph::Index i = 0; i < compact.GetNodeCount(); ++i) {
+        for (CompactGraph::Index neighbor : compact.GetNeighbors(i)) {
+            EXPECT_NE(compact.ToNodeId(neighbor), 5);
+        }
+    }
+}
+
+TEST(CompactGraphTest, EdgeWeightLookup) {
+    Graph graph;
+    int a = graph.AddNode(glm::vec3(0.0f));
+    int b = graph.AddNode(glm::vec3(3.0f, 0.0f, 4.0f), 2.0f);
+    graph.AddEdge(a, b);
+
+    CompactGraph compact = graph.Freeze();
+    EXPECT_FLOAT_EQ(compact.GetEdgeWeight(compact.ToIndex(a), compact.ToIndex(b)), graph.GetEdgeWeight(a, b));
+    EXPECT_TRUE(std::isinf(compact.GetEdgeWeight(compact.ToIndex(b), compact.ToIndex(a))));
+}
+
+// =============================================================================
+// Search Tests
+// =============================================================================
+
+TEST(CompactAStarTest, GridMatchesLegacyAStar) {
+    Graph graph;
+    graph.BuildGrid(32, 32);
+    // A wall with a single gap forces a detour
+    for (int y = 0; y < 31; ++y) {
+        graph.SetNodeWalkable(y * 32 + 16, false);
+    }
+    CompactGraph compact = graph.Freeze();
+
+    const int pairs[][2] = {{0, 1023}, {31, 992}, {5, 27}, {100, 100}, {40, 600}};
+    for (const auto& pair : pairs) {
+        PathResult legacy = Pathfinder::AStar(graph, pair[0], pair[1]);
+        PathResult frozen = Pathfinder::AStar(compact, pair[0], pair[1]);
+
+        ASSERT_EQ(frozen.found, legacy.found);
+        EXPECT_NEAR(frozen.totalCost, legacy.totalCost, kCostTolerance);
+        ASSERT_FALSE(frozen.nodeIds.empty());
+        EXPECT_EQ(frozen.nodeIds.front(), pair[0]);
+        EXPECT_EQ(frozen.nodeIds.back(), pair[1]);
+        EXPECT_EQ(frozen.positions.size(), frozen.nodeIds.size());
+
+        float pathCost = 0.0f;
+        for (size_t i = 1; i < frozen.nodeIds.size(); ++i) {
+            ASSERT_TRUE(graph.HasEdge(frozen.nodeIds[i - 1], frozen.nodeIds[i]));
+            ASSERT_TRUE(graph.GetNode(frozen.nodeIds[i])->walkable);
+            pathCost += graph.GetEdgeWeight(frozen.nodeIds[i - 1], frozen.nodeIds[i]);
+        }
+        EXPECT_NEAR(pathCost, frozen.totalCost, kCostTolerance);
+    }
+}
+
+TEST(CompactAStarTest, RandomGraphMatchesLegacyAStar) {
+    Random::Seed(1234);
+    Graph graph;
+    graph.BuildRandom(400, 9.0f, 100.0f);
+    CompactGraph compact = graph.Freeze();
+
+    Random::Seed(99);
+    for (int i = 0; i < 25; ++i) {
+        const int start = Random::Range(0, 399);
+        const int goal = Random::Range(0, 399);
+
+        PathResult legacy = Pathfinder::AStar(graph, start, goal);
+        PathResult frozen = Pathfinder::AStar(compact, start, goal);
+
+        ASSERT_EQ(frozen.found, legacy.found) << start << " -> " << goal;
+        if (legacy.found) {
+            EXPECT_NEAR(frozen.totalCost, legacy.totalCost, kCostTolerance);
+        }
+    }
+}
+
+TEST(CompactAStarTest, UnwalkableEndpointsAndInvalidIds) {
+    Graph graph;
+    graph.BuildGrid(4, 4);
+    CompactGraph compact = graph.Freeze();
+    compact.SetWalkable(compact.ToIndex(15), false);
+
+    EXPECT_FALSE(Pathfinder::AStar(compact, 0, 15).found);
+    EXPECT_FALSE(Pathfinder::AStar(compact, 15, 0).found);
+    EXPECT_FALSE(Pathfinder::AStar(compact, 0, 99).found);
+    EXPECT_FALSE(Pathfinder::AStar(compact, -3, 0).found);
+    EXPECT_TRUE(Pathfinder::AStar(compact, 0, 14).found);
+}
+
+TEST(CompactAStarTest, DisconnectedGoalExhaustsSearch) {
+    Graph graph;
+    int a = graph.AddNode(glm::vec3(0.0f));
+    int b = graph.AddNode(glm::vec3(1.0f, 0.0f, 0.0f));
+    int c = graph.AddNode(glm::vec3(5.0f, 0.0f, 0.0f));
+    graph.AddBidirectionalEdge(a, b);
+
+    CompactGraph compact = graph.Freeze();
+    PathResult result = Pathfinder::AStar(compact, a, c);
+    EXPECT_FALSE(result.found);
+    EXPECT_EQ(result.nodesExplored, 2);
+}
+
+TEST(CompactAStarTest, RespectsSearchLimits) {
+    Graph graph;
+    graph.BuildGrid(64, 64);
+    CompactGraph compact = graph.Freeze();
+
+    AStarSearchContext context;
+    std::vector<CompactGraph::Index> path;
+
+    CompactSearchParams params;
+    params.maxNodesExplored = 10;
+    CompactSearchResult result = context.FindPath(compact, 0, 64 * 64 - 1, params, path);
+    EXPECT_FALSE(result.found);
+    EXPECT_EQ(result.nodesExplored, 10);
+    EXPECT_TRUE(path.empty());
+
+    params = {};
+    params.maxSearchDistance = 5.0f;
+    EXPECT_FALSE(context.FindPath(compact, 0, 64 * 64 - 1, params, path).found);
+    EXPECT_TRUE(context.FindPath(compact, 0, 3, params, path).found);
+
+    // Reaching the goal on the last allowed expansion still succeeds
+    params = {};
+    params.maxNodesExplored = 2;
+    result = context.FindPath(compact, 0, 1, params, path);
+    EXPECT_TRUE(result.found);
+    EXPECT_EQ(result.nodesExplored, 2);
+}
+
+TEST(CompactAStarTest, ContextReusedAcrossSearchesAndGraphs) {
+    Graph small;
+    small.BuildGrid(4, 4);
+    Graph large;
+    large.BuildGrid(16, 16);
+    CompactGraph smallCompact = small.Freeze();
+    CompactGraph largeCompact = large.Freeze();
+
+    AStarSearchContext context;
+    std::vector<CompactGraph::Index> path;
+
+    for (int i = 0; i < 3; ++i) {
+        CompactSearchResult a = context.FindPath(smallCompact, 0, 15, {}, path);
+        ASSERT_TRUE(a.found);
+        EXPECT_NEAR(a.totalCost, 3.0f * 1.41421356f, kCostTolerance);
+        EXPECT_EQ(path.size(), 4u);
+
+        CompactSearchResult b = context.FindPath(largeCompact, 0, 255, {}, path);
+        ASSERT_TRUE(b.found);
+        EXPECT_NEAR(b.totalCost, 15.0f * 1.41421356f, kCostTolerance);
+        EXPECT_EQ(path.size(), 16u);
+    }
+}
+
+TEST(CompactAStarTest, CustomHeuristic) {
+    Graph graph;
+    graph.BuildGrid(16, 16, 1.0f, false);
+    CompactGraph compact = graph.Freeze();
+
+    auto manhattan = [](const glm::vec3& a, const glm::vec3& b) {
+        return std::abs(a.x - b.x) + std::abs(a.z - b.z);
+    };
+
+    AStarSearchContext context;
+    std::vector<CompactGraph::Index> path;
+    CompactSearchResult result = context.FindPath(compact, 0, 255, manhattan, {}, path);
+    ASSERT_TRUE(result.found);
+    EXPECT_NEAR(result.totalCost, 30.0f, kCostTolerance);
+    EXPECT_EQ(path.size(), 31u);
+}
+
+// =============================================================================
+// Hierarchical Pathfinding Tests
+// =============================================================================
+
+TEST_F(HierarchicalGraphTest, BuildsSectorsAndPortals) {
+    HierarchicalGraph hierarchy(graph, config);
+    HierarchicalGraphStats stats = hierarchy.GetStats();
+
+    EXPECT_EQ(stats.sectorCount, 16u);
+    EXPECT_GT(stats.portalCount, 0u);
+    EXPECT_GT(stats.abstractEdgeCount, stats.portalCount);
+    EXPECT_EQ(stats.lastUpdatedSectors, 16u);
+    EXPECT_FALSE(hierarchy.HasPendingChanges());
+
+    EXPECT_EQ(hierarchy.GetSector(Id(0, 0)), hierarchy.GetSector(Id(15, 15)));
+    EXPECT_NE(hierarchy.GetSector(Id(0, 0)), hierarchy.GetSector(Id(16, 0)));
+    EXPECT_EQ(hierarchy.GetSector(-5), -1);
+}
+
+TEST_F(HierarchicalGraphTest, PathsAreValidAndNearOptimal) {
+    HierarchicalGraph hierarchy(graph, config);
+
+    const int pairs[][2] = {
+        {Id(0, 0), Id(63, 63)},
+        {Id(2, 60), Id(60, 2)},
+        {Id(31, 0), Id(33, 0)},
+        {Id(5, 5), Id(10, 12)},
+        {Id(0, 63), Id(20, 1)},
+    };
+    for (const auto& pair : pairs) {
+        PathResult optimal = Pathfinder::AStar(graph, pair[0], pair[1]);
+        PathResult path = hierarchy.FindPath(pair[0], pair[1]);
+
+        ASSERT_TRUE(optimal.found);
+        ExpectValidPath(graph, path, pair[0], pair[1]);
+        for (int id : path.nodeIds) {
+            EXPECT_TRUE(graph.GetNode(id)->walkable);
+        }
+        EXPECT_GE(path.totalCost, optimal.totalCost - kCostTolerance);
+        EXPECT_LE(path.totalCost, optimal.totalCost * 1.25f);
+    }
+}
+
+TEST_F(HierarchicalGraphTest, AbstractQueryReturnsPortalWaypoints) {
+    HierarchicalGraph hierarchy(graph, config);
+    const int start = Id(1, 1);
+    const int goal = Id(62, 3);
+
+    PathResult refined = hierarchy.FindPath(start, goal);
+    PathResult coarse = hierarchy.FindPath(start, goal, false);
+
+    ASSERT_TRUE(coarse.found);
+    EXPECT_EQ(coarse.nodeIds.front(), start);
+    EXPECT_EQ(coarse.nodeIds.back(), goal);
+    EXPECT_LT(coarse.nodeIds.size(), refined.nodeIds.size());
+    EXPECT_NEAR(coarse.totalCost, refined.totalCost, 1e-2f);
+
+    // Every waypoint lies on the refined path, in order
+    size_t cursor = 0;
+    for (int id : coarse.nodeIds) {
+        while (cursor < refined.nodeIds.size() && refined.nodeIds[cursor] != id) ++cursor;
+        ASSERT_LT(cursor, refined.nodeIds.size());
+    }
+}
+
+TEST_F(HierarchicalGraphTest, ClosingGapUpdatesOnlyNearbySectors) {
+    HierarchicalGraph hierarchy(graph, config);
+    const int start = Id(2, 2);
+    const int goal = Id(60, 60);
+    ASSERT_TRUE(hierarchy.FindPath(start, goal).found);
+
+    hierarchy.SetNodeWalkable(Id(kWallX, kGapY), false);
+    EXPECT_TRUE(hierarchy.HasPendingChanges());
+    hierarchy.Update();
+
+    // The changed sector and its (up to 8) neighbors
+    EXPECT_LE(hierarchy.GetStats().lastUpdatedSectors, 9u);
+    EXPECT_FALSE(hierarchy.FindPath(start, goal).found);
+
+    hierarchy.SetNodeWalkable(Id(kWallX, kGapY), true);
+    hierarchy.Update();
+    PathResult reopened = hierarchy.FindPath(start, goal);
+    ExpectValidPath(graph, reopened, start, goal);
+    EXPECT_NE(std::find(reopened.nodeIds.begin(), reopened.nodeIds.end(), Id(kWallX, kGapY)),
+        reopened.nodeIds.end());
+}
+
+TEST_F(HierarchicalGraphTest, UnwalkableEndpointsAndInvalidIds) {
+    HierarchicalGraph hierarchy(graph, config);
+
+    EXPECT_FALSE(hierarchy.FindPath(Id(kWallX, 0), Id(0, 0)).found);
+    EXPECT_FALSE(hierarchy.FindPath(Id(0, 0), Id(kWallX, 1)).found);
+    EXPECT_FALSE(hierarchy.FindPath(-1, Id(0, 0)).found);
+    EXPECT_FALSE(hierarchy.FindPath(Id(0, 0), kSize * kSize).found);
+
+    PathResult self = hierarchy.FindPath(Id(3, 3), Id(3, 3));
+    ASSERT_TRUE(self.found);
+    EXPECT_EQ(self.nodeIds.size(), 1u);
+}
+
+TEST(HierarchicalGraphRandomTest, MatchesReachabilityOfAStar) {
+    Random::Seed(4321);
+    Graph graph;
+    graph.BuildRandom(600, 7.0f, 120.0f);
+
+    HierarchicalGraphConfig config;
+    config.sectorSize = 30.0f;
+    HierarchicalGraph hierarchy(graph, config);
+
+    Random::Seed(17);
+    for (int i = 0; i < 30; ++i) {
+        const int start = Random::Range(0, 599);
+        const int goal = Random::Range(0, 599);
+
+        PathResult optimal = Pathfinder::AStar(graph, start, goal);
+        PathResult path = hierarchy.FindPath(start, goal);
+
+        ASSERT_EQ(path.found, optimal.found) << start << " -> " << goal;
+        if (optimal.found) {
+            ExpectValidPath(graph, path, start, goal);
+            EXPECT_GE(path.totalCost, optimal.totalCost - kCostTolerance);
+        }
+    }
+}
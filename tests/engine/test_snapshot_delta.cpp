@@ -0,0 +1,421 @@
+/**
+ * @file test_snapshot_delta.cpp
+ * @brief Unit tests for snapshot delta compression against acknowledged baselines
+ *
+ * Test categories:
+ * - Field-granular deltas, creation and removal
+ * - Baselines follow acks, not the last packet sent
+ * - Deferred entities and packet size limits
+ * - Packet loss simulation (drop, duplicate, reorder) in both directions
+ */
+
+#include <gtest/gtest.h>
+
+#include "networking/SnapshotDelta.hpp"
+#include "networking/ReplicationSystem.hpp"
+
+#include <array>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+EventSchema MakeUnitSchema() {
+    EventSchema schema;
+    schema.typeId = 7;
+    schema.typeName = "test.unit";
+    schema.fields = {
+        {"position", FieldEncoding::QuantizedVec3, -1024.0f, 1024.0f, 18},
+        {"rotation", FieldEncoding::Quaternion, 0.0f, 1.0f, 10},
+        {"health", FieldEncoding::UInt32, 0.0f, 1.0f, 0},
+        {"order", FieldEncoding::String, 0.0f, 1.0f, 0}
+    };
+    return schema;
+}
+
+struct UnitState {
+    glm::vec3 position{0.0f};
+    uint32_t health = 100;
+    std::string order = "idle";
+};
+
+class SnapshotDeltaTest : public ::testing::Test {
+protected:
+    void SetUnit(uint64_t entityId, const UnitState& unit) {
+        NetworkEvent event;
+        m_schema.InitEvent(event);
+        event.properties[0].value = unit.position;
+        event.properties[2].value = unit.health;
+        event.properties[3].value = unit.order;
+        ASSERT_TRUE(m_history.SetEntityState(entityId, m_schema, event));
+    }
+
+    size_t Encode(std::span<const uint64_t> visible) {
+        return m_history.Encode(kClient, visible, m_packet);
+    }
+
+    SnapshotReceiver::Result Deliver(size_t size) {
+        return m_receiver.Receive(std::span<const uint8_t>(m_packet.data(), size));
+    }
+
+    void Ack(uint32_t tick) {
+        std::array<uint8_t, 16> ack{};
+        const size_t size = SnapshotReceiver::EncodeAck(tick, ack);
+        ASSERT_TRUE(m_history.ReceiveAck(kClient, std::span<const uint8_t>(ack.data(), size)));
+    }
+
+    // The receiver's view at tick must match the server's world at tick
+    void ExpectMatches(uint32_t tick, uint64_t entityId) {
+        NetworkEvent expected;
+        NetworkEvent actual;
+        ASSERT_TRUE(m_history.GetEntityState(tick, entityId, expected)) << "entity " << entityId;
+        ASSERT_TRUE(m_receiver.GetEntityState(tick, entityId, actual)) << "entity " << entityId;
+        ASSERT_EQ(expected.properties.size(), actual.properties.size());
+        for (size_t i = 0; i < expected.properties.size(); ++i) {
+            EXPECT_TRUE(expected.properties[i].value == actual.properties[i].value)
+                << "entity " << entityId << " field " << expected.properties[i].name;
+        }
+    }
+
+    glm::vec3 ReceivedPosition(uint64_t entityId) {
+        NetworkEvent event;
+        EXPECT_TRUE(m_receiver.GetEntityState(entityId, event));
+        return std::get<glm::vec3>(event.properties[0].value);
+    }
+
+    static constexpr uint32_t kClient = 3;
+
+    EventSchema m_schema = MakeUnitSchema();
+    SnapshotHistory m_history;
+    SnapshotReceiver m_receiver{[this](uint32_t typeId) { return typeId == m_schema.typeId ? &m_schema : nullptr; }};
+    std::array<uint8_t, EventCodec::kMaxEventSize> m_packet{};
+};
+
+} // namespace
+
+// =============================================================================
+// Delta Encoding Tests
+// =============================================================================
+
+TEST_F(SnapshotDeltaTest, FirstPacketCarriesFullState) {
+    SetUnit(1, {glm::vec3(10.0f, 0.0f, 5.0f), 80, "attack"});
+    SetUnit(2, {glm::vec3(-3.0f, 1.0f, 7.5f), 100, "idle"});
+    const uint32_t tick = m_history.Capture(1000);
+
+    const std::vector<uint64_t> visible = {2, 1};
+    EXPECT_EQ(SnapshotReceiver::Result::Applied, Deliver(Encode(visible)));
+    EXPECT_EQ(tick, m_receiver.GetLatestTick());
+    EXPECT_EQ(1000u, m_receiver.GetLatestTimestamp());
+    EXPECT_EQ(2u, m_receiver.GetEntityCount());
+    EXPECT_EQ(2u, m_receiver.GetChangedEntities().size());
+    ExpectMatches(tick, 1);
+    ExpectMatches(tick, 2);
+    EXPECT_EQ(1u, m_history.GetStats().fullPackets);
+}
+
+TEST_F(SnapshotDeltaTest, UnchangedWorldSendsOnlyHeader) {
+    for (uint64_t id = 1; id <= 50; ++id) {
+        SetUnit(id, {glm::vec3(static_cast<float>(id), 0.0f, 0.0f)});
+    }
+    std::vector<uint64_t> visible;
+    for (uint64_t id = 1; id <= 50; ++id) visible.push_back(id);
+
+    const uint32_t first = m_history.Capture(0);
+    const size_t fullSize = Encode(visible);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(fullSize));
+    Ack(first);
+
+    m_history.Capture(50);
+    const size_t deltaSize = Encode(visible);
+    EXPECT_LE(deltaSize, 8u);
+    EXPECT_LT(deltaSize * 20, fullSize);
+    EXPECT_EQ(SnapshotReceiver::Result::Applied, Deliver(deltaSize));
+    EXPECT_EQ(50u, m_receiver.GetEntityCount());
+    EXPECT_TRUE(m_receiver.GetChangedEntities().empty());
+}
+
+TEST_F(SnapshotDeltaTest, OnlyChangedFieldsAreSent) {
+    SetUnit(1, {glm::vec3(1.0f, 2.0f, 3.0f), 100, "move to the northern ridge"});
+    const std::vector<uint64_t> visible = {1};
+    const uint32_t first = m_history.Capture(0);
+    const size_t fullSize = Encode(visible);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(fullSize));
+    Ack(first);
+
+    SetUnit(1, {glm::vec3(1.0f, 2.0f, 3.0f), 75, "move to the northern ridge"});
+    const uint32_t second = m_history.Capture(0);
+    const size_t deltaSize = Encode(visible);
+    EXPECT_EQ(SnapshotReceiver::Result::Applied, Deliver(deltaSize));
+    EXPECT_LT(deltaSize * 3, fullSize);
+    EXPECT_EQ(1u, m_history.GetStats().fieldsWritten);
+    EXPECT_EQ(std::vector<uint64_t>{1}, m_receiver.GetChangedEntities());
+    ExpectMatches(second, 1);
+}
+
+TEST_F(SnapshotDeltaTest, BaselineIsLastAckNotLastSent) {
+    const std::vector<uint64_t> visible = {1};
+    SetUnit(1, {glm::vec3(0.0f)});
+    const uint32_t first = m_history.Capture(0);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(Encode(visible)));
+    Ack(first);
+
+    // Lost packet: the client never sees the first move
+    SetUnit(1, {glm::vec3(10.0f, 0.0f, 0.0f)});
+    m_history.Capture(0);
+    Encode(visible);
+
+    SetUnit(1, {glm::vec3(20.0f, 0.0f, 0.0f), 50});
+    const uint32_t third = m_history.Capture(0);
+    EXPECT_EQ(SnapshotReceiver::Result::Applied, Deliver(Encode(visible)));
+    ExpectMatches(third, 1);
+    EXPECT_NEAR(20.0f, ReceivedPosition(1).x, 0.01f);
+}
+
+TEST_F(SnapshotDeltaTest, EntitiesLeavingViewAreRemoved) {
+    SetUnit(1, {});
+    SetUnit(2, {});
+    SetUnit(3, {});
+    const std::vector<uint64_t> all = {1, 2, 3};
+    const uint32_t first = m_history.Capture(0);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(Encode(all)));
+    Ack(first);
+
+    // 2 leaves the view, 3 is destroyed
+    m_history.RemoveEntity(3);
+    m_history.Capture(0);
+    const std::vector<uint64_t> visible = {1, 3};
+    EXPECT_EQ(SnapshotReceiver::Result::Applied, Deliver(Encode(visible)));
+    EXPECT_EQ(1u, m_receiver.GetEntityCount());
+    EXPECT_EQ((std::vector<uint64_t>{2, 3}), m_receiver.GetRemovedEntities());
+    EXPECT_EQ(2u, m_history.GetStats().entitiesRemoved);
+}
+
+TEST_F(SnapshotDeltaTest, DeferredEntitiesKeepHeldState) {
+    SetUnit(1, {glm::vec3(0.0f)});
+    const std::vector<uint64_t> visible = {1};
+    const std::vector<uint64_t> none;
+    const uint32_t first = m_history.Capture(0);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(Encode(visible)));
+    Ack(first);
+
+    SetUnit(1, {glm::vec3(30.0f, 0.0f, 0.0f)});
+    const uint32_t second = m_history.Capture(0);
+    size_t size = m_history.Encode(kClient, visible, none, m_packet);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(size));
+    Ack(second);
+    EXPECT_NEAR(0.0f, ReceivedPosition(1).x, 0.01f);
+
+    m_history.Capture(0);
+    size = m_history.Encode(kClient, visible, visible, m_packet);
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(size));
+    EXPECT_NEAR(30.0f, ReceivedPosition(1).x, 0.01f);
+}
+
+TEST_F(SnapshotDeltaTest, PacketsStayWithinMtu) {
+    std::vector<uint64_t> visible;
+    for (uint64_t id = 1; id <= 400; ++id) {
+        SetUnit(id, {glm::vec3(static_cast<float>(id), 0.0f, -static_cast<float>(id)), 100, "patrol"});
+        visible.push_back(id);
+    }
+
+    for (int tick = 0; tick < 10 && m_receiver.GetEntityCount() < 400; ++tick) {
+        const uint32_t current = m_history.Capture(0);
+        const size_t size = Encode(visible);
+        EXPECT_GT(size, 0u);
+        EXPECT_LE(size, EventCodec::kMaxEventSize);
+        ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(size));
+        Ack(current);
+    }
+    EXPECT_EQ(400u, m_receiver.GetEntityCount());
+    EXPECT_GT(m_history.GetStats().entriesDeferred, 0u);
+}
+
+TEST_F(SnapshotDeltaTest, ReceiverRejectsUnusablePackets) {
+    const std::vector<uint64_t> visible = {1};
+    SetUnit(1, {});
+    const uint32_t first = m_history.Capture(0);
+    const size_t firstSize = Encode(visible);
+    EXPECT_EQ(SnapshotReceiver::Result::Malformed, Deliver(firstSize - 1));
+    ASSERT_EQ(SnapshotReceiver::Result::Applied, Deliver(firstSize));
+    EXPECT_EQ(SnapshotReceiver::Result::Duplicate, Deliver(firstSize));
+    Ack(first);
+
+    // Pretend the client acked a tick it never received
+    SetUnit(1, {glm::vec3(5.0f)});
+    const uint32_t second = m_history.Capture(0);
+    Encode(visible);
+    Ack(second);
+    SetUnit(1, {glm::vec3(6.0f)});
+    m_history.Capture(0);
+    EXPECT_EQ(SnapshotReceiver::Result::MissingBaseline, Deliver(Encode(visible)));
+}
+
+// =============================================================================
+// Packet Loss Simulation
+// =============================================================================
+
+namespace {
+
+uint32_t PacketTick(std::span<const uint8_t> packet) {
+    BitReader reader(packet);
+    reader.ReadVarUInt();
+    return static_cast<uint32_t>(reader.ReadVarUInt());
+}
+
+/**
+ * @brief Unreliable link that drops, duplicates and reorders packets
+ */
+class LossyLink {
+public:
+    LossyLink(uint32_t seed, float dropRate, float duplicateRate, uint32_t maxDelay)
+        : m_rng(seed), m_dropRate(dropRate), m_duplicateRate(duplicateRate), m_maxDelay(maxDelay) {}
+
+    void Send(std::vector<uint8_t> packet, uint32_t now) {
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+        std::uniform_int_distribution<uint32_t> delay(0, m_maxDelay);
+        if (chance(m_rng) < m_dropRate) return;
+        if (chance(m_rng) < m_duplicateRate) {
+            m_inFlight.emplace(now + delay(m_rng), packet);
+        }
+        m_inFlight.emplace(now + delay(m_rng), std::move(packet));
+    }
+
+    std::vector<std::vector<uint8_t>> Receive(uint32_t now) {
+        std::vector<std::vector<uint8_t>> arrived;
+        auto end = m_inFlight.upper_bound(now);
+        for (auto it = m_inFlight.begin(); it != end; ++it) {
+            arrived.push_back(std::move(it->second));
+        }
+        m_inFlight.erase(m_inFlight.begin(), end);
+
+        // Same-tick arrivals come in random order too
+        std::shuffle(arrived.begin(), arrived.end(), m_rng);
+        return arrived;
+    }
+
+    void SetLoss(float dropRate, float duplicateRate, uint32_t maxDelay) {
+        m_dropRate = dropRate;
+        m_duplicateRate = duplicateRate;
+        m_maxDelay = maxDelay;
+    }
+
+private:
+    std::mt19937 m_rng;
+    float m_dropRate;
+    float m_duplicateRate;
+    uint32_t m_maxDelay;
+    std::multimap<uint32_t, std::vector<uint8_t>> m_inFlight;
+};
+
+} // namespace
+
+TEST_F(SnapshotDeltaTest, SurvivesLossDuplicationAndReordering) {
+    LossyLink toClient(11, 0.25f, 0.1f, 3);
+    LossyLink toServer(12, 0.25f, 0.1f, 3);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> step(-6.0f, 6.0f);
+    std::uniform_int_distribution<uint32_t> damage(0, 3);
+
+    std::map<uint64_t, UnitState> units;
+    uint64_t nextId = 1;
+    for (; nextId <= 60; ++nextId) {
+        units[nextId].position = glm::vec3(step(rng) * 10.0f, 0.0f, step(rng) * 10.0f);
+    }
+
+    std::map<uint32_t, std::vector<uint64_t>> visibleAt;
+    size_t applied = 0;
+    size_t stale = 0;
+    const float viewRadius = 60.0f;
+
+    auto runTick = [&](uint32_t now) {
+        // Simulate: move, damage, spawn and destroy units
+        for (auto it = units.begin(); it != units.end();) {
+            UnitState& unit = it->second;
+            if (rng() % 50 == 0) {
+                m_history.RemoveEntity(it->first);
+                it = units.erase(it);
+                continue;
+            }
+            if (rng() % 3 == 0) unit.position += glm::vec3(step(rng), 0.0f, step(rng));
+            if (rng() % 10 == 0) unit.health -= std::min(unit.health, damage(rng));
+            if (rng() % 40 == 0) unit.order = unit.order == "idle" ? "attack" : "idle";
+            SetUnit(it->first, unit);
+            ++it;
+        }
+        if (rng() % 2 == 0) {
+            units[nextId].position = glm::vec3(step(rng) * 10.0f, 0.0f, step(rng) * 10.0f);
+            SetUnit(nextId, units[nextId]);
+            ++nextId;
+        }
+
+        const uint32_t tick = m_history.Capture(now);
+        std::vector<uint64_t>& visible = visibleAt[tick];
+        for (const auto& [id, unit] : units) {
+            if (glm::dot(unit.position, unit.position) <= viewRadius * viewRadius) {
+                visible.push_back(id);
+            }
+        }
+        const size_t size = Encode(visible);
+        ASSERT_GT(size, 0u);
+        toClient.Send(std::vector<uint8_t>(m_packet.begin(), m_packet.begin() + static_cast<std::ptrdiff_t>(size)), now);
+
+        for (const auto& packet : toClient.Receive(now)) {
+            const auto result = m_receiver.Receive(packet);
+            ASSERT_NE(SnapshotReceiver::Result::Malformed, result);
+            ASSERT_NE(SnapshotReceiver::Result::MissingBaseline, result);
+            if (result != SnapshotReceiver::Result::Applied && result != SnapshotReceiver::Result::Stale) continue;
+
+            // Every decoded snapshot equals the server's world, limited to what was visible
+            const uint32_t packetTick = PacketTick(packet);
+            for (uint64_t id : visibleAt[packetTick]) {
+                ExpectMatches(packetTick, id);
+            }
+            if (result == SnapshotReceiver::Result::Applied) {
+                EXPECT_EQ(visibleAt[packetTick].size(), m_receiver.GetEntityCount());
+                ++applied;
+            } else {
+                ++stale;
+            }
+
+            std::array<uint8_t, 16> ack{};
+            const size_t ackSize = SnapshotReceiver::EncodeAck(packetTick, ack);
+            toServer.Send(std::vector<uint8_t>(ack.begin(), ack.begin() + static_cast<std::ptrdiff_t>(ackSize)), now);
+        }
+
+        for (const auto& ack : toServer.Receive(now)) {
+            EXPECT_TRUE(m_history.ReceiveAck(kClient, ack));
+        }
+    };
+
+    uint32_t now = 1;
+    uint64_t warmupFullPackets = 0;
+    for (; now <= 300; ++now) {
+        runTick(now);
+        if (HasFatalFailure()) return;
+        if (now == 30) warmupFullPackets = m_history.GetStats().fullPackets;
+    }
+    EXPECT_GT(applied, 100u);
+    EXPECT_GT(stale, 0u);
+    EXPECT_GT(m_history.GetStats().entitiesUpdated, 0u);
+
+    // Full states only until the first ack gets through
+    EXPECT_EQ(warmupFullPackets, m_history.GetStats().fullPackets);
+
+    // Once the link is clean the client converges on the server's view
+    toClient.SetLoss(0.0f, 0.0f, 0);
+    toServer.SetLoss(0.0f, 0.0f, 0);
+    for (uint32_t end = now + 5; now < end; ++now) {
+        runTick(now);
+        if (HasFatalFailure()) return;
+    }
+    const uint32_t last = m_history.GetCurrentTick();
+    EXPECT_EQ(last, m_receiver.GetLatestTick());
+    EXPECT_EQ(visibleAt[last].size(), m_receiver.GetEntityCount());
+    for (uint64_t id : visibleAt[last]) {
+        ExpectMatches(last, id);
+    }
+}
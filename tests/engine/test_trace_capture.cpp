@@ -0,0 +1,129 @@
+/**
+ * @file test_trace_capture.cpp
+ * @brief Unit tests for per-thread trace capture and Chrome trace export
+ */
+
+#include <gtest/gtest.h>
+
+#include "core/TraceCapture.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Nova;
+using json = nlohmann::json;
+
+namespace {
+
+std::filesystem::path TracePath(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+json ReadTrace(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    return json::parse(file);
+}
+
+} // namespace
+
+TEST(TraceCaptureTest, WritesChromeTraceJson) {
+    const auto path = TracePath("nova_test_trace.json");
+
+    TraceCaptureConfig config;
+    config.filepath = path.string();
+    config.flushIntervalMs = 1;
+    ASSERT_TRUE(TraceCapture::Instance().Start(config));
+    EXPECT_FALSE(TraceCapture::Instance().Start(config));
+
+    for (int i = 0; i < 10; ++i) {
+        NOVA_TRACE_SCOPE("Test::Outer");
+        NOVA_TRACE_SCOPE("Test::\"Quoted\"");
+    }
+    NOVA_TRACE_INSTANT("Test::Marker");
+
+    std::thread worker([] {
+        TraceCapture::Instance().SetThreadName("Test Worker");
+        for (int i = 0; i < 5; ++i) {
+            NOVA_TRACE_SCOPE("Test::Worker");
+        }
+    });
+    worker.join();
+
+    TraceCapture::Instance().Stop();
+    EXPECT_EQ(26u, TraceCapture::Instance().GetWrittenEventCount());
+    EXPECT_EQ(0u, TraceCapture::Instance().GetDroppedEventCount());
+
+    const json trace = ReadTrace(path);
+    ASSERT_TRUE(trace.contains("traceEvents"));
+    EXPECT_EQ(0, trace["otherData"]["droppedEvents"].get<int>());
+
+    int outer = 0, quoted = 0, markers = 0, workerScopes = 0;
+    std::set<std::string> threadNames;
+    for (const json& event : trace["traceEvents"]) {
+        const std::string name = event["name"];
+        const std::string phase = event["ph"];
+        if (phase == "M") {
+            if (name == "thread_name") {
+                threadNames.insert(event["args"]["name"].get<std::string>());
+            }
+            continue;
+        }
+        if (phase == "X") {
+            EXPECT_GE(event["dur"].get<double>(), 0.0);
+        }
+        outer += name == "Test::Outer";
+        quoted += name == "Test::\"Quoted\"";
+        markers += name == "Test::Marker" && phase == "i";
+        workerScopes += name == "Test::Worker";
+    }
+    EXPECT_EQ(10, outer);
+    EXPECT_EQ(10, quoted);
+    EXPECT_EQ(1, markers);
+    EXPECT_EQ(5, workerScopes);
+    EXPECT_EQ(1u, threadNames.count("Test Worker"));
+
+    std::filesystem::remove(path);
+}
+
+TEST(TraceCaptureTest, ThreadsRegisterWhileFlushing) {
+    // Rings are registered and names interned while the flusher is writing
+    const auto path = TracePath("nova_test_trace_threads.json");
+
+    TraceCaptureConfig config;
+    config.filepath = path.string();
+    config.flushIntervalMs = 1;
+    ASSERT_TRUE(TraceCapture::Instance().Start(config));
+
+    constexpr int kThreads = 8;
+    constexpr int kScopes = 200;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            const TraceNameId id = TraceCapture::InternName("Test::Thread" + std::to_string(t));
+            for (int i = 0; i < kScopes; ++i) {
+                TraceScope scope(id);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    TraceCapture::Instance().Stop();
+    EXPECT_EQ(static_cast<uint64_t>(kThreads * kScopes), TraceCapture::Instance().GetWrittenEventCount());
+
+    const json trace = ReadTrace(path);
+    size_t complete = 0;
+    for (const json& event : trace["traceEvents"]) {
+        complete += event["ph"] == "X";
+    }
+    EXPECT_EQ(static_cast<size_t>(kThreads * kScopes), complete);
+
+    std::filesystem::remove(path);
+}
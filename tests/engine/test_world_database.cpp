@@ -0,0 +1,283 @@
+/**
+ * @file test_world_database.cpp
+ * @brief Unit tests for WorldDatabase entity queries
+ *
+ * Test categories:
+ * - LoadEntities batching, ordering and missing IDs
+ * - QueryEntitiesInRadius boundary and empty results
+ * - Write-behind queue: coalescing, assigned IDs and the durability fence
+ */
+
+#include <gtest/gtest.h>
+
+#include "persistence/WorldDatabase.hpp"
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+/**
+ * @brief Fresh database file with the world schema and one loaded world
+ */
+class WorldDatabaseTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        m_path = (std::filesystem::temp_directory_path() /
+                  (std::string("nova_test_") + info->name() + ".db")).string();
+        RemoveFiles();
+
+        std::ifstream schemaFile(NOVA_WORLD_SCHEMA_PATH);
+        ASSERT_TRUE(schemaFile) << NOVA_WORLD_SCHEMA_PATH;
+        std::stringstream schema;
+        schema << schemaFile.rdbuf();
+        sqlite3* raw = nullptr;
+        ASSERT_EQ(SQLITE_OK, sqlite3_open(m_path.c_str(), &raw));
+        const int result = sqlite3_exec(raw, schema.str().c_str(), nullptr, nullptr, nullptr);
+        sqlite3_close(raw);
+        ASSERT_EQ(SQLITE_OK, result);
+
+        ASSERT_TRUE(m_db.Initialize(m_path));
+        m_worldId = m_db.CreateWorld("test", 7);
+        ASSERT_GE(m_worldId, 0);
+        ASSERT_TRUE(m_db.LoadWorld(m_worldId));
+    }
+
+    void TearDown() override {
+        m_db.Shutdown();
+        RemoveFiles();
+    }
+
+    void RemoveFiles() {
+        std::filesystem::remove(m_path);
+        std::filesystem::remove(m_path + "-wal");
+        std::filesystem::remove(m_path + "-shm");
+    }
+
+    int SaveAt(const glm::vec3& position, const std::string& type = "npc") {
+        Entity entity;
+        entity.entityType = type;
+        entity.entitySubtype = "test";
+        entity.position = position;
+        entity.data = {1, 2, 3};
+        return m_db.SaveEntity(entity);
+    }
+
+    /**
+     * @brief Entity rows as seen by a second connection (committed data only)
+     */
+    int CountCommittedEntities() {
+        sqlite3* raw = nullptr;
+        int count = -1;
+        if (sqlite3_open_v2(m_path.c_str(), &raw, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK) {
+            sqlite3_stmt* stmt = nullptr;
+            if (sqlite3_prepare_v2(raw, "SELECT COUNT(*) FROM Entities", -1, &stmt, nullptr) == SQLITE_OK &&
+                sqlite3_step(stmt) == SQLITE_ROW) {
+                count = sqlite3_column_int(stmt, 0);
+            }
+            sqlite3_finalize(stmt);
+        }
+        sqlite3_close(raw);
+        return count;
+    }
+
+    // Long window: nothing commits until the test flushes
+    static WriteBehindConfig SlowWriter() {
+        WriteBehindConfig config;
+        config.coalesceWindowMs = 60000.0f;
+        return config;
+    }
+
+    std::string m_path;
+    WorldDatabase m_db;
+    int m_worldId = -1;
+};
+
+std::vector<int> IdsOf(const std::vector<Entity>& entities) {
+    std::vector<int> ids;
+    for (const Entity& entity : entities) {
+        ids.push_back(entity.entityId);
+    }
+    return ids;
+}
+
+} // namespace
+
+// =============================================================================
+// LoadEntities Tests
+// =============================================================================
+
+TEST_F(WorldDatabaseTest, LoadEntitiesReturnsRowsInIdOrder) {
+    // More than one IN-list batch
+    std::vector<int> saved;
+    m_db.BeginTransaction();
+    for (int i = 0; i < 300; ++i) {
+        saved.push_back(SaveAt(glm::vec3(static_cast<float>(i), 0.0f, 0.0f)));
+        ASSERT_GE(saved.back(), 0);
+    }
+    m_db.Commit();
+
+    // Reversed, with a duplicate and an ID that does not exist
+    std::vector<int> request(saved.rbegin(), saved.rend());
+    request.push_back(saved[5]);
+    request.push_back(saved.back() + 1000);
+
+    const std::vector<Entity> loaded = m_db.LoadEntities(request);
+    EXPECT_EQ(saved, IdsOf(loaded));
+    EXPECT_EQ(glm::vec3(5.0f, 0.0f, 0.0f), loaded[5].position);
+    EXPECT_EQ("test", loaded[5].entitySubtype);
+    EXPECT_EQ((std::vector<uint8_t>{1, 2, 3}), loaded[5].data);
+}
+
+TEST_F(WorldDatabaseTest, LoadEntitiesWithNoMatchesIsEmpty) {
+    const int id = SaveAt(glm::vec3(0.0f));
+    ASSERT_GE(id, 0);
+
+    EXPECT_TRUE(m_db.LoadEntities({}).empty());
+    const std::vector<int> missing = {id + 1, id + 2};
+    EXPECT_TRUE(m_db.LoadEntities(missing).empty());
+}
+
+// =============================================================================
+// Radius Query Tests
+// =============================================================================
+
+TEST_F(WorldDatabaseTest, RadiusQueryIncludesEntityOnBoundary) {
+    const glm::vec3 center(100.0f, 5.0f, -40.0f);
+    const int onBoundary = SaveAt(center + glm::vec3(10.0f, 0.0f, 0.0f));
+    const int inside = SaveAt(center + glm::vec3(0.0f, -3.0f, 4.0f));
+    // Just outside the sphere, and inside its bounding box but not the sphere
+    SaveAt(center + glm::vec3(0.0f, 0.0f, 10.01f));
+    SaveAt(center + glm::vec3(8.0f, 0.0f, 8.0f));
+
+    const EntityQueryResult result = m_db.QueryEntitiesInRadius(center, 10.0f);
+    std::vector<int> ids = IdsOf(result.entities);
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ((std::vector<int>{onBoundary, inside}), ids);
+    EXPECT_EQ(2u, result.totalCount);
+}
+
+TEST_F(WorldDatabaseTest, RadiusQueryWithNothingInRangeIsEmpty) {
+    const glm::vec3 center(0.0f);
+    EXPECT_TRUE(m_db.QueryEntitiesInRadius(center, 50.0f).entities.empty());
+
+    // Outside the radius, and inside it but inactive
+    SaveAt(glm::vec3(60.0f, 0.0f, 0.0f));
+    Entity inactive;
+    inactive.entityType = "item";
+    inactive.position = glm::vec3(1.0f, 0.0f, 0.0f);
+    inactive.isActive = false;
+    ASSERT_GE(m_db.SaveEntity(inactive), 0);
+
+    const EntityQueryResult result = m_db.QueryEntitiesInRadius(center, 50.0f);
+    EXPECT_TRUE(result.entities.empty());
+    EXPECT_EQ(0u, result.totalCount);
+}
+
+// =============================================================================
+// Write-Behind Tests
+// =============================================================================
+
+TEST_F(WorldDatabaseTest, QueuedWritesCommitAtTheFence) {
+    ASSERT_TRUE(m_db.StartWriteBehind(SlowWriter()));
+
+    Entity entity;
+    entity.entityType = "npc";
+    for (int i = 0; i < 5; ++i) {
+        entity.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+        m_db.QueueSaveEntity(entity);
+    }
+    EXPECT_EQ(0, CountCommittedEntities());
+
+    EXPECT_TRUE(m_db.FlushAndWait());
+    EXPECT_EQ(5, CountCommittedEntities());
+    EXPECT_EQ(5u, m_db.GetStatistics().writesCommitted);
+    EXPECT_EQ(1u, m_db.GetStatistics().groupCommits);
+
+    // Nothing pending: the fence returns straight away
+    EXPECT_TRUE(m_db.FlushAndWait());
+    m_db.StopWriteBehind();
+}
+
+TEST_F(WorldDatabaseTest, WritesToTheSameRowCoalesce) {
+    const int id = SaveAt(glm::vec3(0.0f));
+    ASSERT_GE(id, 0);
+    ASSERT_TRUE(m_db.StartWriteBehind(SlowWriter()));
+
+    Entity entity = m_db.LoadEntity(id);
+    std::vector<int> reported;
+    for (int i = 1; i <= 10; ++i) {
+        entity.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+        m_db.QueueSaveEntity(entity, [&reported](int entityId) { reported.push_back(entityId); });
+    }
+    ASSERT_TRUE(m_db.FlushAndWait());
+
+    const DatabaseStats stats = m_db.GetStatistics();
+    EXPECT_EQ(9u, stats.writesCoalesced);
+    EXPECT_EQ(1u, stats.writesCommitted);
+    EXPECT_EQ(glm::vec3(10.0f, 0.0f, 0.0f), m_db.LoadEntity(id).position);
+
+    // Every caller hears about the one save that replaced theirs
+    EXPECT_EQ(std::vector<int>(10, id), reported);
+    m_db.StopWriteBehind();
+}
+
+TEST_F(WorldDatabaseTest, QueuedNewEntityReportsItsRowId) {
+    ASSERT_TRUE(m_db.StartWriteBehind(SlowWriter()));
+
+    std::atomic<int> assignedId{-2};
+    Entity entity;
+    entity.entityType = "building";
+    entity.position = glm::vec3(3.0f, 4.0f, 5.0f);
+    m_db.QueueSaveEntity(entity, [&assignedId](int entityId) { assignedId = entityId; });
+    EXPECT_EQ(-2, assignedId.load());
+
+    ASSERT_TRUE(m_db.FlushAndWait());
+    ASSERT_GE(assignedId.load(), 0);
+    const Entity loaded = m_db.LoadEntity(assignedId);
+    EXPECT_EQ("building", loaded.entityType);
+    EXPECT_EQ(entity.position, loaded.position);
+
+    // A deletion queued over a save supersedes it
+    Entity existing = loaded;
+    int superseded = 0;
+    m_db.QueueSaveEntity(existing, [&superseded](int entityId) { superseded = entityId; });
+    m_db.QueueDeleteEntity(existing.entityId);
+    ASSERT_TRUE(m_db.FlushAndWait());
+    EXPECT_EQ(-1, superseded);
+    EXPECT_EQ(0, CountCommittedEntities());
+    m_db.StopWriteBehind();
+}
+
+TEST_F(WorldDatabaseTest, FenceReportsWritesHeldByAnOpenTransaction) {
+    ASSERT_TRUE(m_db.StartWriteBehind(SlowWriter()));
+
+    ASSERT_TRUE(m_db.BeginTransaction());
+    Entity entity;
+    entity.entityType = "item";
+    m_db.QueueSaveEntity(entity);
+    EXPECT_FALSE(m_db.FlushAndWait());
+    EXPECT_FALSE(m_db.FlushAndWait());
+
+    // Rolling back discards them, as the fence warned
+    ASSERT_TRUE(m_db.Rollback());
+    EXPECT_EQ(0, CountCommittedEntities());
+
+    ASSERT_TRUE(m_db.BeginTransaction());
+    m_db.QueueSaveEntity(entity);
+    EXPECT_FALSE(m_db.FlushAndWait());
+    ASSERT_TRUE(m_db.Commit());
+    EXPECT_TRUE(m_db.FlushAndWait());
+    EXPECT_EQ(1, CountCommittedEntities());
+    m_db.StopWriteBehind();
+}
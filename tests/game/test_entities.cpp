@@ -7,13 +7,16 @@
 #include <gmock/gmock.h>
 
 #include "entities/Entity.hpp"
+#include "entities/EntityManager.hpp"
 #include "entities/Player.hpp"
 #include "entities/Zombie.hpp"
 #include "entities/NPC.hpp"
 
 #include "utils/TestHelpers.hpp"
 #include "mocks/MockServices.hpp"
+#include "core/JobSystem.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -582,6 +585,193 @@ TEST(EntityPropertyTest, Distance_TriangleInequality) {
     }
 }
 
+// =============================================================================
+// Entity Manager Tests
+// =============================================================================
+
+class EntityManagerTest : public ::testing::Test {
+protected:
+    class CountingEntity : public Entity {
+    public:
+        explicit CountingEntity(EntityType type = EntityType::Zombie) : Entity(type) {}
+
+        void Update(float deltaTime) override {
+            Entity::Update(deltaTime);
+            updateCount++;
+        }
+
+        int updateCount = 0;
+    };
+
+    CountingEntity* Spawn(EntityType type, const glm::vec3& position = glm::vec3(0.0f)) {
+        CountingEntity* entity = manager.CreateEntity<CountingEntity>(type);
+        entity->SetPosition(position);
+        return entity;
+    }
+
+    EntityManager manager;
+};
+
+TEST_F(EntityManagerTest, AddsDuringIterationJoinAfterIt) {
+    Spawn(EntityType::Zombie);
+    Spawn(EntityType::Zombie);
+
+    Entity::EntityId addedId = Entity::INVALID_ID;
+    int visited = 0;
+    manager.ForEachEntity([&](Entity&) {
+        if (visited++ == 0) {
+            auto added = std::make_unique<CountingEntity>(EntityType::NPC);
+            Entity* raw = added.get();
+            addedId = manager.AddEntity(std::move(added));
+
+            // Reachable straight away, but not counted or visited yet
+            EXPECT_EQ(raw, manager.GetEntity(addedId));
+            EXPECT_EQ(2u, manager.GetEntityCount());
+        }
+    });
+
+    EXPECT_EQ(2, visited);
+    EXPECT_EQ(3u, manager.GetEntityCount());
+    EXPECT_EQ(1u, manager.GetEntityCount(EntityType::NPC));
+    ASSERT_NE(nullptr, manager.GetEntity(addedId));
+    EXPECT_TRUE(manager.GetHandle(addedId).IsValid());
+}
+
+TEST_F(EntityManagerTest, RemovesDuringIterationApplyAfterIt) {
+    CountingEntity* first = Spawn(EntityType::Zombie);
+    CountingEntity* second = Spawn(EntityType::Zombie);
+    const Entity::EntityId firstId = first->GetId();
+    const Entity::EntityId secondId = second->GetId();
+
+    int visited = 0;
+    manager.ForEachEntity([&](Entity& entity) {
+        visited++;
+        if (entity.GetId() == firstId) {
+            EXPECT_TRUE(manager.RemoveEntity(secondId));
+            EXPECT_TRUE(manager.RemoveEntity(secondId));  // Queued once
+            EXPECT_NE(nullptr, manager.GetEntity(secondId));
+        } else {
+            EXPECT_TRUE(manager.RemoveEntity(firstId));
+        }
+    });
+
+    // Both rows were still visited; the removals land once iteration ends
+    EXPECT_EQ(2, visited);
+    EXPECT_EQ(0u, manager.GetEntityCount());
+    EXPECT_EQ(nullptr, manager.GetEntity(firstId));
+    EXPECT_EQ(nullptr, manager.GetEntity(secondId));
+}
+
+TEST_F(EntityManagerTest, AddThenRemoveDuringIterationCancels) {
+    Spawn(EntityType::Zombie);
+
+    manager.ForEachEntity([&](Entity&) {
+        auto added = std::make_unique<CountingEntity>(EntityType::Zombie);
+        const Entity::EntityId id = manager.AddEntity(std::move(added));
+        EXPECT_TRUE(manager.RemoveEntity(id));
+        EXPECT_EQ(nullptr, manager.GetEntity(id));
+    });
+
+    EXPECT_EQ(1u, manager.GetEntityCount());
+}
+
+TEST_F(EntityManagerTest, SpatialCellKeyFollowsMovedEntities) {
+    CountingEntity* entity = Spawn(EntityType::Zombie, glm::vec3(5.0f, 0.0f, 5.0f));
+    const Nova::ECS::EntityHandle handle = manager.GetHandle(entity->GetId());
+    const SpatialCellKey* cell = manager.GetWorld().Get<SpatialCellKey>(handle);
+    ASSERT_NE(nullptr, cell);
+    const int64_t startKey = cell->key;
+    EXPECT_EQ(1u, manager.FindEntitiesInRadius(glm::vec3(5.0f, 0.0f, 5.0f), 1.0f).size());
+
+    // Moving within the cell keeps the key
+    entity->SetPosition(glm::vec3(6.0f, 0.0f, 6.0f));
+    manager.Update(0.016f);
+    EXPECT_EQ(startKey, manager.GetWorld().Get<SpatialCellKey>(handle)->key);
+
+    // Moving across cells refiles the entity under the new one only
+    entity->SetPosition(glm::vec3(55.0f, 0.0f, 35.0f));
+    manager.Update(0.016f);
+    EXPECT_NE(startKey, manager.GetWorld().Get<SpatialCellKey>(handle)->key);
+    EXPECT_EQ(1u, manager.FindEntitiesInRadius(glm::vec3(55.0f, 0.0f, 35.0f), 1.0f).size());
+    EXPECT_TRUE(manager.FindEntitiesInRadius(glm::vec3(5.0f, 0.0f, 5.0f), 5.0f).empty());
+
+    // And removal clears it from the hash
+    manager.RemoveEntity(entity->GetId());
+    EXPECT_TRUE(manager.FindEntitiesInRadius(glm::vec3(55.0f, 0.0f, 35.0f), 1.0f).empty());
+}
+
+TEST_F(EntityManagerTest, CrowdPlacedAfterSpawnIsRefiledInOneUpdate) {
+    // Spawned at the origin, then spread over a 10 x 10 grid of cells
+    std::vector<CountingEntity*> crowd;
+    for (int i = 0; i < 100; ++i) {
+        crowd.push_back(Spawn(EntityType::Zombie));
+    }
+    for (int i = 0; i < 100; ++i) {
+        crowd[i]->SetPosition(glm::vec3((i % 10) * 50.0f + 5.0f, 0.0f, (i / 10) * 50.0f + 5.0f));
+    }
+    manager.Update(0.016f);
+
+    EXPECT_TRUE(manager.FindEntitiesInRadius(glm::vec3(0.0f), 1.0f).empty());
+    for (int i = 0; i < 100; ++i) {
+        const auto found = manager.FindEntitiesInRadius(crowd[i]->GetPosition(), 1.0f);
+        ASSERT_EQ(1u, found.size());
+        EXPECT_EQ(crowd[i], found[0]);
+    }
+
+    // Afterwards a single mover still goes through the incremental path
+    crowd[0]->SetPosition(glm::vec3(5.0f, 0.0f, 505.0f));
+    manager.Update(0.016f);
+    EXPECT_EQ(1u, manager.FindEntitiesInRadius(glm::vec3(5.0f, 0.0f, 505.0f), 1.0f).size());
+    EXPECT_TRUE(manager.FindEntitiesInRadius(glm::vec3(5.0f, 0.0f, 5.0f), 1.0f).empty());
+}
+
+TEST_F(EntityManagerTest, TypeCachesTrackAddsRemovesAndActivity) {
+    for (int i = 0; i < 3; ++i) {
+        Spawn(EntityType::Zombie);
+    }
+    CountingEntity* npc = Spawn(EntityType::NPC);
+
+    EXPECT_EQ(3u, manager.GetCachedEntitiesByType(EntityType::Zombie).size());
+    EXPECT_EQ(1u, manager.GetCachedEntitiesByType(EntityType::NPC).size());
+
+    // An add or removal invalidates its own type
+    CountingEntity* zombie = Spawn(EntityType::Zombie);
+    EXPECT_EQ(4u, manager.GetCachedEntitiesByType(EntityType::Zombie).size());
+    manager.RemoveEntity(npc->GetId());
+    EXPECT_TRUE(manager.GetCachedEntitiesByType(EntityType::NPC).empty());
+
+    // Inactive entities drop out once the caches are invalidated
+    zombie->SetActive(false);
+    manager.InvalidateEntityCaches();
+    const auto& zombies = manager.GetCachedEntitiesByType(EntityType::Zombie);
+    EXPECT_EQ(3u, zombies.size());
+    EXPECT_EQ(zombies.end(), std::find(zombies.begin(), zombies.end(), zombie));
+}
+
+TEST_F(EntityManagerTest, ParallelUpdateUpdatesEveryEntityOnce) {
+    auto& jobs = Nova::JobSystem::Instance();
+    if (!jobs.IsInitialized()) {
+        ASSERT_TRUE(jobs.Initialize());
+    }
+
+    // Fewer entities than one ECS chunk holds per type
+    std::vector<CountingEntity*> entities;
+    for (int i = 0; i < 300; ++i) {
+        entities.push_back(Spawn(i % 3 == 0 ? EntityType::NPC : EntityType::Zombie,
+                                 glm::vec3(static_cast<float>(i), 0.0f, 0.0f)));
+    }
+
+    manager.UpdateParallel(0.016f);
+    for (CountingEntity* entity : entities) {
+        EXPECT_EQ(1, entity->updateCount);
+    }
+
+    manager.UpdateParallel(0.016f, false);
+    for (CountingEntity* entity : entities) {
+        EXPECT_EQ(2, entity->updateCount);
+    }
+}
+
 // =============================================================================
 // Zombie Entity Tests (if available)
 // =============================================================================
@@ -0,0 +1,206 @@
+/**
+ * @file test_flow_field.cpp
+ * @brief Unit tests for sectorised, cached flow fields
+ */
+
+#include <gtest/gtest.h>
+
+#include "systems/SectorFlowField.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace Vehement::Systems;
+
+namespace {
+
+SectorFlowFieldConfig MakeConfig(int size, int sectorSize) {
+    SectorFlowFieldConfig config;
+    config.width = size;
+    config.height = size;
+    config.sectorSize = sectorSize;
+    return config;
+}
+
+/**
+ * @brief Follow the field cell by cell; returns true if a goal is reached
+ */
+bool WalkToGoal(SectorFlowFieldManager& manager, glm::ivec2 cell,
+                const std::vector<glm::vec2>& goals, int maxSteps = 4096) {
+    for (int step = 0; step < maxSteps; ++step) {
+        for (const glm::vec2& goal : goals) {
+            if (manager.WorldToGrid(goal) == cell) return true;
+        }
+
+        const glm::vec2 dir = manager.GetFlowDirection(manager.GridToWorld(cell.x, cell.y), goals);
+        if (dir.x == 0.0f && dir.y == 0.0f) return false;
+
+        cell = cell + glm::ivec2(static_cast<int>(std::lround(dir.x)), static_cast<int>(std::lround(dir.y)));
+        if (!manager.IsWalkable(cell.x, cell.y)) return false;
+    }
+    return false;
+}
+
+} // namespace
+
+// =============================================================================
+// Direction Tests
+// =============================================================================
+
+TEST(SectorFlowFieldTest, OpenMapLeadsToGoal) {
+    SectorFlowFieldManager manager(MakeConfig(128, 16));
+    const std::vector<glm::vec2> goal = {manager.GridToWorld(100, 90)};
+
+    EXPECT_TRUE(WalkToGoal(manager, {5, 5}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {120, 3}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {100, 89}, goal));
+}
+
+TEST(SectorFlowFieldTest, RoutesAroundWalls) {
+    SectorFlowFieldManager manager(MakeConfig(96, 16));
+
+    // Wall spanning several sectors with a single gap at the bottom
+    manager.FillRect(48, 0, 2, 90, CellState::Blocked);
+    const std::vector<glm::vec2> goal = {manager.GridToWorld(80, 10)};
+
+    EXPECT_TRUE(WalkToGoal(manager, {10, 10}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {30, 80}, goal));
+}
+
+TEST(SectorFlowFieldTest, UnreachableGoalGivesZero) {
+    SectorFlowFieldManager manager(MakeConfig(64, 16));
+    manager.FillRect(30, 0, 4, 64, CellState::Blocked);
+
+    const glm::vec2 dir = manager.GetFlowDirection(manager.GridToWorld(5, 5), manager.GridToWorld(50, 50));
+    EXPECT_FLOAT_EQ(0.0f, dir.x);
+    EXPECT_FLOAT_EQ(0.0f, dir.y);
+
+    // Blocked goal cells are ignored
+    const glm::vec2 blocked = manager.GetFlowDirection(manager.GridToWorld(5, 5), manager.GridToWorld(31, 5));
+    EXPECT_FLOAT_EQ(0.0f, blocked.x);
+    EXPECT_FLOAT_EQ(0.0f, blocked.y);
+}
+
+TEST(SectorFlowFieldTest, MultipleGoalsPickNearest) {
+    SectorFlowFieldManager manager(MakeConfig(128, 16));
+    const std::vector<glm::vec2> goals = {manager.GridToWorld(10, 64), manager.GridToWorld(120, 64)};
+
+    const glm::vec2 left = manager.GetFlowDirection(manager.GridToWorld(30, 64), goals);
+    const glm::vec2 right = manager.GetFlowDirection(manager.GridToWorld(100, 64), goals);
+    EXPECT_LT(left.x, 0.0f);
+    EXPECT_GT(right.x, 0.0f);
+
+    EXPECT_TRUE(WalkToGoal(manager, {60, 5}, goals));
+}
+
+TEST(SectorFlowFieldTest, DangerCellsAreAvoided) {
+    SectorFlowFieldManager manager(MakeConfig(64, 32));
+
+    // Danger band between start and goal, with a clear detour around its top
+    manager.FillRect(20, 12, 4, 52, CellState::Danger);
+    const std::vector<glm::vec2> goal = {manager.GridToWorld(30, 20)};
+
+    glm::ivec2 cell(10, 20);
+    bool touchedDanger = false;
+    for (int step = 0; step < 256 && manager.WorldToGrid(goal[0]) != cell; ++step) {
+        const glm::vec2 dir = manager.GetFlowDirection(manager.GridToWorld(cell.x, cell.y), goal);
+        ASSERT_FALSE(dir.x == 0.0f && dir.y == 0.0f);
+        cell = cell + glm::ivec2(static_cast<int>(std::lround(dir.x)), static_cast<int>(std::lround(dir.y)));
+        touchedDanger |= cell.x >= 20 && cell.x < 24 && cell.y >= 12;
+    }
+    EXPECT_EQ(manager.WorldToGrid(goal[0]), cell);
+    EXPECT_FALSE(touchedDanger);
+}
+
+TEST(SectorFlowFieldTest, SplitGoalSectorLeadsAroundWall) {
+    SectorFlowFieldManager manager(MakeConfig(64, 16));
+
+    // Wall through the goal sector: its right half and the portals on that
+    // side only reach the goal by leaving the sector and coming back in
+    manager.FillRect(8, 0, 1, 16, CellState::Blocked);
+    const std::vector<glm::vec2> goal = {manager.GridToWorld(3, 3)};
+
+    EXPECT_TRUE(WalkToGoal(manager, {12, 5}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {15, 0}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {30, 5}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {12, 30}, goal));
+    EXPECT_TRUE(WalkToGoal(manager, {3, 40}, goal));
+}
+
+// =============================================================================
+// Laziness and Caching Tests
+// =============================================================================
+
+TEST(SectorFlowFieldTest, IntegratesOnlySectorsOnRoute) {
+    SectorFlowFieldManager manager(MakeConfig(512, 32));
+    ASSERT_EQ(256u, manager.GetSectorCount());
+
+    const std::vector<glm::vec2> goal = {manager.GridToWorld(500, 500)};
+    EXPECT_TRUE(WalkToGoal(manager, {5, 5}, goal));
+
+    // A diagonal walk touches a few dozen sectors, not the whole map
+    EXPECT_LT(manager.GetSectorFieldsBuilt(), 48u);
+    EXPECT_LT(manager.GetFieldMemoryUsage(), 48u * 32u * 32u * 3u);
+}
+
+TEST(SectorFlowFieldTest, OrdersToSameGoalShareRoute) {
+    SectorFlowFieldManager manager(MakeConfig(256, 32));
+
+    (void)manager.GetFlowDirection(manager.GridToWorld(5, 5), manager.GridToWorld(200, 200));
+    const size_t built = manager.GetSectorFieldsBuilt();
+    const size_t hits = manager.GetCacheHits();
+
+    // Another unit in an already integrated sector: the route is reused
+    (void)manager.GetFlowDirection(manager.GridToWorld(20, 10), manager.GridToWorld(200, 200));
+    EXPECT_EQ(1u, manager.GetCachedRouteCount());
+    EXPECT_EQ(hits + 1, manager.GetCacheHits());
+    EXPECT_EQ(built, manager.GetSectorFieldsBuilt());
+}
+
+TEST(SectorFlowFieldTest, CacheEvictsLeastRecentlyUsed) {
+    SectorFlowFieldConfig config = MakeConfig(128, 16);
+    config.maxCachedFields = 2;
+    SectorFlowFieldManager manager(config);
+
+    const glm::vec2 unit = manager.GridToWorld(1, 1);
+    (void)manager.GetFlowDirection(unit, manager.GridToWorld(100, 100));
+    (void)manager.GetFlowDirection(unit, manager.GridToWorld(40, 100));
+    (void)manager.GetFlowDirection(unit, manager.GridToWorld(100, 40));
+    EXPECT_EQ(2u, manager.GetCachedRouteCount());
+}
+
+// =============================================================================
+// Incremental Update Tests
+// =============================================================================
+
+TEST(SectorFlowFieldTest, EditRebuildsOnlyLocalSectors) {
+    SectorFlowFieldManager manager(MakeConfig(512, 32));
+
+    // Interior edit: only its own sector
+    manager.FillRect(100, 100, 4, 4, CellState::Blocked);
+    manager.Update();
+    EXPECT_EQ(1u, manager.GetLastRebuiltSectorCount());
+
+    // Edit touching a sector edge: that sector and its neighbor
+    manager.FillRect(126, 200, 4, 4, CellState::Blocked);
+    manager.Update();
+    EXPECT_EQ(2u, manager.GetLastRebuiltSectorCount());
+}
+
+TEST(SectorFlowFieldTest, CachedFieldsFollowTerrainChanges) {
+    SectorFlowFieldManager manager(MakeConfig(128, 16));
+    const std::vector<glm::vec2> goal = {manager.GridToWorld(100, 20)};
+    EXPECT_TRUE(WalkToGoal(manager, {10, 20}, goal));
+
+    // Wall off the straight route, leaving a gap at the bottom
+    manager.FillRect(60, 0, 3, 120, CellState::Blocked);
+    EXPECT_TRUE(WalkToGoal(manager, {10, 20}, goal));
+
+    // Close the gap: the goal becomes unreachable
+    manager.FillRect(60, 120, 3, 8, CellState::Blocked);
+    EXPECT_FALSE(WalkToGoal(manager, {10, 20}, goal));
+
+    // Reopen and the cached route recovers
+    manager.FillRect(60, 50, 3, 4, CellState::Walkable);
+    EXPECT_TRUE(WalkToGoal(manager, {10, 20}, goal));
+}
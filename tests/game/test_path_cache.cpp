@@ -0,0 +1,351 @@
+/**
+ * @file test_path_cache.cpp
+ * @brief Unit tests for the PathCache async request pipeline
+ */
+
+#include <gtest/gtest.h>
+
+#include "systems/PathCache.hpp"
+#include "core/JobSystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Vehement::Systems;
+
+namespace {
+
+/**
+ * @brief Search that expands one node per unit of X distance, then succeeds
+ */
+class LineSearch : public IncrementalPathSearch {
+public:
+    LineSearch(const glm::vec3& start, const glm::vec3& goal)
+        : m_start(start), m_goal(goal),
+          m_remaining(static_cast<uint32_t>(std::abs(goal.x - start.x))) {}
+
+    PathSearchStep Step(uint32_t nodeBudget, PathResult& result) override {
+        const uint32_t expanded = std::min(nodeBudget, m_remaining);
+        m_remaining -= expanded;
+        if (m_remaining > 0) {
+            return {PathSearchState::Running, expanded};
+        }
+
+        result.waypoints = {PathWaypoint{m_start}, PathWaypoint{m_goal}};
+        result.totalCost = std::abs(m_goal.x - m_start.x);
+        result.valid = true;
+        return {PathSearchState::Found, expanded};
+    }
+
+private:
+    glm::vec3 m_start;
+    glm::vec3 m_goal;
+    uint32_t m_remaining;
+};
+
+struct SearchCounter {
+    std::atomic<int> created{0};
+
+    PathSearchFactory Factory() {
+        return [this](const glm::vec3& start, const glm::vec3& goal) {
+            ++created;
+            return std::make_unique<LineSearch>(start, goal);
+        };
+    }
+};
+
+PathCache::Config MakeConfig(uint32_t nodesPerSlice, size_t nodeBudgetPerFrame) {
+    PathCache::Config config;
+    config.nodesPerSlice = nodesPerSlice;
+    config.nodeBudgetPerFrame = nodeBudgetPerFrame;
+    return config;
+}
+
+} // namespace
+
+// =============================================================================
+// Coalescing Tests
+// =============================================================================
+
+TEST(PathCachePipelineTest, IdenticalRequestsShareOneSearch) {
+    PathCache cache(MakeConfig(1000, 10000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    int delivered = 0;
+    for (EntityId id = 1; id <= 50; ++id) {
+        // Goals differ slightly but fall in the same goal region
+        const glm::vec3 goal(100.0f + (id % 3) * 0.1f, 0.0f, 0.2f);
+        cache.RequestPathAsync(id, glm::vec3(0.1f, 0.0f, 0.1f), goal,
+                               [&delivered](EntityId, const PathResult& path) {
+                                   delivered += path.IsValid() ? 1 : 0;
+                               });
+    }
+
+    EXPECT_EQ(1, counter.created.load());
+    EXPECT_EQ(49u, cache.GetStats().coalescedRequests);
+    EXPECT_EQ(1u, cache.GetStats().pendingRequests);
+
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_EQ(50, delivered);
+    EXPECT_EQ(50u, cache.GetStats().asyncRequestsCompleted);
+}
+
+TEST(PathCachePipelineTest, DifferentStartsSearchSeparately) {
+    PathCache cache(MakeConfig(1000, 10000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    cache.RequestPathAsync(1, glm::vec3(0.0f), glm::vec3(50.0f, 0.0f, 0.0f), nullptr);
+    cache.RequestPathAsync(2, glm::vec3(10.0f, 0.0f, 0.0f), glm::vec3(50.0f, 0.0f, 0.0f), nullptr);
+    EXPECT_EQ(2, counter.created.load());
+    EXPECT_EQ(0u, cache.GetStats().coalescedRequests);
+}
+
+TEST(PathCachePipelineTest, StartsWithCollidingHashesSearchSeparately) {
+    PathCache cache(MakeConfig(1000, 10000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    // Start cells (-497, 0, 106) and (-463, 0, -440) used to hash to the same key
+    const glm::vec3 goal(50.0f, 0.0f, 0.0f);
+    cache.RequestPathAsync(1, glm::vec3(-248.25f, 0.0f, 53.25f), goal, nullptr);
+    cache.RequestPathAsync(2, glm::vec3(-231.25f, 0.0f, -219.75f), goal, nullptr);
+    EXPECT_EQ(2, counter.created.load());
+    EXPECT_EQ(0u, cache.GetStats().coalescedRequests);
+}
+
+TEST(PathCachePipelineTest, CancelledWaiterIsSkipped) {
+    PathCache cache(MakeConfig(1000, 10000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    std::vector<EntityId> delivered;
+    auto callback = [&delivered](EntityId id, const PathResult&) { delivered.push_back(id); };
+    PathRequestHandle first = cache.RequestPathAsync(1, glm::vec3(0.0f), glm::vec3(20.0f, 0.0f, 0.0f), callback);
+    cache.RequestPathAsync(2, glm::vec3(0.0f), glm::vec3(20.0f, 0.0f, 0.0f), callback);
+
+    EXPECT_TRUE(cache.CancelRequest(first.requestId));
+
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    ASSERT_EQ(1u, delivered.size());
+    EXPECT_EQ(2u, delivered[0]);
+}
+
+TEST(PathCachePipelineTest, SearchWithoutWaitersIsDropped) {
+    PathCache cache(MakeConfig(1000, 10000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    cache.RequestPathAsync(7, glm::vec3(0.0f), glm::vec3(20.0f, 0.0f, 0.0f), nullptr);
+    cache.CancelEntityRequests(7);
+
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_EQ(0u, cache.GetStats().searchSlices);
+    EXPECT_EQ(0u, cache.GetStats().pendingRequests);
+}
+
+// =============================================================================
+// Time Slicing Tests
+// =============================================================================
+
+TEST(PathCachePipelineTest, LongSearchIsTimeSliced) {
+    PathCache cache(MakeConfig(100, 100));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    bool done = false;
+    PathRequestHandle handle = cache.RequestPathAsync(
+        1, glm::vec3(0.0f), glm::vec3(450.0f, 0.0f, 0.0f),
+        [&done](EntityId, const PathResult& path) { done = path.IsValid(); });
+    EXPECT_EQ(PathRequestStatus::Pending, cache.GetRequestStatus(handle.requestId));
+
+    // 450 nodes at 100 per frame: resumes across five frames
+    for (int frame = 0; frame < 4; ++frame) {
+        cache.Update(0.0f);
+        cache.ProcessCompletedRequests();
+        EXPECT_FALSE(done);
+    }
+    EXPECT_EQ(PathRequestStatus::InProgress, cache.GetRequestStatus(handle.requestId));
+
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_TRUE(done);
+    EXPECT_EQ(5u, cache.GetStats().searchSlices);
+    EXPECT_TRUE(cache.HasCachedPath(glm::vec3(0.0f), glm::vec3(450.0f, 0.0f, 0.0f)));
+}
+
+TEST(PathCachePipelineTest, SliceStopsAtTimeBudget) {
+    // Search that never finishes and takes 5 ms per step
+    class SlowSearch : public IncrementalPathSearch {
+    public:
+        explicit SlowSearch(std::atomic<int>& steps) : m_steps(steps) {}
+
+        PathSearchStep Step(uint32_t nodeBudget, PathResult&) override {
+            ++m_steps;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            return {PathSearchState::Running, nodeBudget};
+        }
+
+    private:
+        std::atomic<int>& m_steps;
+    };
+
+    PathCache::Config config = MakeConfig(1000, 1000);
+    config.sliceTimeBudgetMs = 1.0f;
+    PathCache cache(config);
+    std::atomic<int> steps{0};
+    cache.SetPathSearchFactory([&steps](const glm::vec3&, const glm::vec3&) {
+        return std::make_unique<SlowSearch>(steps);
+    });
+
+    cache.RequestPathAsync(1, glm::vec3(0.0f), glm::vec3(50.0f, 0.0f, 0.0f), nullptr);
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_EQ(1u, cache.GetStats().searchSlices);
+    EXPECT_EQ(1, steps.load());
+
+    // With time to spare the slice runs until its node limit
+    config.sliceTimeBudgetMs = 1000.0f;
+    PathCache patient(config);
+    steps = 0;
+    patient.SetPathSearchFactory([&steps](const glm::vec3&, const glm::vec3&) {
+        return std::make_unique<SlowSearch>(steps);
+    });
+    patient.RequestPathAsync(1, glm::vec3(0.0f), glm::vec3(50.0f, 0.0f, 0.0f), nullptr);
+    patient.Update(0.0f);
+    patient.ProcessCompletedRequests();
+    EXPECT_EQ(1u, patient.GetStats().searchSlices);
+    EXPECT_GT(steps.load(), 1);
+}
+
+TEST(PathCachePipelineTest, FrameBudgetIsSharedRoundRobin) {
+    PathCache cache(MakeConfig(100, 200));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    int delivered = 0;
+    auto callback = [&delivered](EntityId, const PathResult&) { ++delivered; };
+    for (int i = 0; i < 4; ++i) {
+        cache.RequestPathAsync(i + 1, glm::vec3(i * 10.0f, 0.0f, 0.0f),
+                               glm::vec3(i * 10.0f + 50.0f, 0.0f, 0.0f), callback);
+    }
+
+    // Two slices per frame, each search finishes in one slice
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_EQ(2, delivered);
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_EQ(4, delivered);
+}
+
+TEST(PathCachePipelineTest, ComputeFunctionRunsAsSingleSlice) {
+    PathCache cache(MakeConfig(10, 10));
+    cache.SetPathComputeFunction([](const glm::vec3& start, const glm::vec3& goal) {
+        PathResult result;
+        result.waypoints = {PathWaypoint{start}, PathWaypoint{goal}};
+        result.valid = true;
+        return result;
+    });
+
+    bool done = false;
+    cache.RequestPathAsync(1, glm::vec3(0.0f), glm::vec3(500.0f, 0.0f, 0.0f),
+                           [&done](EntityId, const PathResult& path) { done = path.IsValid(); });
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_TRUE(done);
+}
+
+TEST(PathCachePipelineTest, StaleRequestsTimeOut) {
+    PathCache::Config config = MakeConfig(10, 10);
+    config.requestTimeout = 1.0f;
+    PathCache cache(config);
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    bool failed = false;
+    cache.RequestPathAsync(1, glm::vec3(0.0f), glm::vec3(1000.0f, 0.0f, 0.0f),
+                           [&failed](EntityId, const PathResult& path) { failed = !path.IsValid(); });
+    cache.Update(0.5f);
+    cache.Update(2.0f);
+    cache.ProcessCompletedRequests();
+    EXPECT_TRUE(failed);
+    EXPECT_EQ(1u, cache.GetStats().asyncRequestsFailed);
+}
+
+// =============================================================================
+// Statistics Tests
+// =============================================================================
+
+TEST(PathCachePipelineTest, LatencyHistogramsCountDeliveredRequests) {
+    PathCache cache(MakeConfig(1000, 10000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    for (EntityId id = 1; id <= 10; ++id) {
+        cache.RequestPathAsync(id, glm::vec3(static_cast<float>(id), 0.0f, 0.0f),
+                               glm::vec3(100.0f, 0.0f, 0.0f), nullptr);
+    }
+    cache.Update(0.0f);
+    cache.ProcessCompletedRequests();
+
+    const PathCache::Stats& stats = cache.GetStats();
+    EXPECT_EQ(10u, stats.queuedLatency.count);
+    EXPECT_EQ(10u, stats.computeLatency.count);
+    EXPECT_EQ(10u, stats.deliveryLatency.count);
+    EXPECT_GE(stats.queuedLatency.GetPercentile(0.99), stats.queuedLatency.GetPercentile(0.5));
+    EXPECT_LE(stats.queuedLatency.GetPercentile(1.0), stats.queuedLatency.maxSeconds);
+}
+
+TEST(LatencyHistogramTest, PercentilesUseBucketBounds) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 90; ++i) histogram.Record(10e-6);
+    for (int i = 0; i < 10; ++i) histogram.Record(5e-3);
+
+    EXPECT_EQ(100u, histogram.count);
+    EXPECT_NEAR(16e-6, histogram.GetPercentile(0.5), 1e-9);
+    EXPECT_NEAR(5e-3, histogram.GetPercentile(0.99), 1e-9);
+    EXPECT_NEAR(0.509e-3, histogram.GetMean(), 1e-6);
+}
+
+// =============================================================================
+// JobSystem Tests
+// =============================================================================
+
+TEST(PathCachePipelineTest, SlicesRunOnJobSystem) {
+    auto& jobSystem = Nova::JobSystem::Instance();
+    if (!jobSystem.IsInitialized()) {
+        Nova::JobSystemConfig config;
+        config.workerThreads = 4;
+        ASSERT_TRUE(jobSystem.Initialize(config));
+    }
+
+    PathCache cache(MakeConfig(50, 100000));
+    SearchCounter counter;
+    cache.SetPathSearchFactory(counter.Factory());
+
+    std::atomic<int> delivered{0};
+    for (EntityId id = 1; id <= 200; ++id) {
+        cache.RequestPathAsync(id, glm::vec3(static_cast<float>(id % 40), 0.0f, 0.0f),
+                               glm::vec3(300.0f, 0.0f, static_cast<float>(id % 5)),
+                               [&delivered](EntityId, const PathResult&) { ++delivered; });
+    }
+    EXPECT_EQ(200u, counter.created.load() + cache.GetStats().coalescedRequests);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (delivered < 200 && std::chrono::steady_clock::now() < deadline) {
+        cache.Update(0.0f);
+        cache.ProcessCompletedRequests();
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(200, delivered.load());
+    EXPECT_EQ(0u, cache.GetStats().pendingRequests);
+}
@@ -0,0 +1,199 @@
+/**
+ * @file test_parallel_culling.cpp
+ * @brief Unit tests for the SIMD ParallelCullingSystem
+ *
+ * The batched kernels are checked against the scalar Frustum tests and
+ * CalculateLOD() on the same objects, serially and on the JobSystem.
+ */
+
+#include <gtest/gtest.h>
+
+#include "graphics/ParallelCullingSystem.hpp"
+#include "core/JobSystem.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Graphics;
+
+namespace {
+
+/**
+ * @brief Axis-aligned box [-extent, extent]^3 as six inward-facing planes
+ */
+Frustum MakeBoxFrustum(float extent) {
+    Frustum frustum;
+    frustum.planes[0] = Vector4(1.0f, 0.0f, 0.0f, extent);
+    frustum.planes[1] = Vector4(-1.0f, 0.0f, 0.0f, extent);
+    frustum.planes[2] = Vector4(0.0f, 1.0f, 0.0f, extent);
+    frustum.planes[3] = Vector4(0.0f, -1.0f, 0.0f, extent);
+    frustum.planes[4] = Vector4(0.0f, 0.0f, 1.0f, extent);
+    frustum.planes[5] = Vector4(0.0f, 0.0f, -1.0f, extent);
+    return frustum;
+}
+
+std::vector<SDFInstance> MakeInstances(size_t count, float spread) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> position(-spread, spread);
+    std::uniform_real_distribution<float> size(0.1f, 4.0f);
+
+    std::vector<SDFInstance> instances(count);
+    for (size_t i = 0; i < count; i++) {
+        SDFInstance& instance = instances[i];
+        instance.boundingSphereCenter = Vector3(position(rng), position(rng), position(rng));
+        instance.boundingSphereRadius = size(rng);
+        const float half = instance.boundingSphereRadius * 0.7f;
+        const Vector3& c = instance.boundingSphereCenter;
+        instance.aabbMin = Vector3(c.x - half, c.y - half, c.z - half);
+        instance.aabbMax = Vector3(c.x + half, c.y + half, c.z + half);
+        instance.instanceID = static_cast<uint32_t>(i);
+    }
+    return instances;
+}
+
+CullingCamera MakeCamera(float extent) {
+    CullingCamera camera;
+    camera.position = Vector3(0.0f, 0.0f, -extent);
+    camera.frustum = MakeBoxFrustum(extent);
+    return camera;
+}
+
+void ExpectMatchesScalar(ParallelCullingSystem& culling, const std::vector<SDFInstance>& instances,
+                         const CullingCamera& camera) {
+    const CullingResult result = culling.CullObjects(instances, camera);
+
+    std::vector<uint32_t> expected;
+    for (const SDFInstance& instance : instances) {
+        if (camera.frustum.TestSphere(instance.boundingSphereCenter, instance.boundingSphereRadius) &&
+            camera.frustum.TestAABB(instance.aabbMin, instance.aabbMax)) {
+            expected.push_back(instance.instanceID);
+        }
+    }
+    std::vector<uint32_t> expectedLODs;
+    culling.CalculateLOD(instances, expected, camera, expectedLODs);
+
+    ASSERT_EQ(expected.size(), result.totalVisible);
+    ASSERT_EQ(expected.size(), result.visibleIndices.size());
+    ASSERT_EQ(expected.size(), result.lodLevels.size());
+
+    // Job order is not fixed: compare (id, lod) pairs sorted by id
+    std::vector<std::pair<uint32_t, uint32_t>> actual;
+    for (size_t i = 0; i < result.visibleIndices.size(); i++) {
+        actual.emplace_back(result.visibleIndices[i], result.lodLevels[i]);
+    }
+    std::sort(actual.begin(), actual.end());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i], actual[i].first);
+        EXPECT_EQ(expectedLODs[i], actual[i].second) << "object " << expected[i];
+    }
+}
+
+} // namespace
+
+TEST(ParallelCullingTest, MatchesScalarTestsAndLOD) {
+    const auto instances = MakeInstances(10007, 60.0f);
+    ParallelCullingSystem culling;
+    ExpectMatchesScalar(culling, instances, MakeCamera(25.0f));
+}
+
+TEST(ParallelCullingTest, MatchesScalarOnJobSystem) {
+    auto& jobs = Nova::JobSystem::Instance();
+    if (!jobs.IsInitialized()) {
+        ASSERT_TRUE(jobs.Initialize());
+    }
+
+    ParallelCullingSystem::Config config;
+    config.jobGranularity = 100;  // Rounded up to whole batches
+    ParallelCullingSystem culling(config);
+
+    const auto instances = MakeInstances(20011, 60.0f);
+    ExpectMatchesScalar(culling, instances, MakeCamera(25.0f));
+}
+
+TEST(ParallelCullingTest, SphereOnlyAndLODDisabled) {
+    ParallelCullingSystem::Config config;
+    config.enableLOD = false;
+    config.testAABB = false;
+    ParallelCullingSystem culling(config);
+
+    // Sphere overlaps the box, but its inscribed AABB does not
+    std::vector<SDFInstance> instances(1);
+    instances[0].boundingSphereCenter = Vector3(11.0f, 0.0f, 0.0f);
+    instances[0].boundingSphereRadius = 2.0f;
+    instances[0].aabbMin = Vector3(10.5f, -1.0f, -1.0f);
+    instances[0].aabbMax = Vector3(12.5f, 1.0f, 1.0f);
+
+    const CullingResult result = culling.CullObjects(instances, MakeCamera(10.0f));
+    EXPECT_EQ(1u, result.totalVisible);
+    EXPECT_TRUE(result.lodLevels.empty());
+
+    config.testAABB = true;
+    culling.SetConfig(config);
+    EXPECT_EQ(0u, culling.CullObjects(instances, MakeCamera(10.0f)).totalVisible);
+}
+
+TEST(ParallelCullingTest, AABBsFollowTheInstanceTransform) {
+    ParallelCullingSystem culling;
+
+    // Bounds sit well outside the box in local space; the transform brings
+    // the first instance back to the origin and moves the second further out
+    std::vector<SDFInstance> instances(2);
+    for (size_t i = 0; i < instances.size(); i++) {
+        instances[i].boundingSphereCenter = Vector3(30.0f, 0.0f, 0.0f);
+        instances[i].boundingSphereRadius = 1.5f;
+        instances[i].aabbMin = Vector3(29.0f, -1.0f, -1.0f);
+        instances[i].aabbMax = Vector3(31.0f, 1.0f, 1.0f);
+        instances[i].instanceID = static_cast<uint32_t>(i);
+    }
+    instances[0].transform[3][0] = -30.0f;
+    instances[1].transform[3][0] = 30.0f;
+
+    const CullingResult result = culling.CullObjects(instances, MakeCamera(10.0f));
+    ASSERT_EQ(1u, result.totalVisible);
+    EXPECT_EQ(0u, result.visibleIndices[0]);
+
+    // A 90 degree turn about z swaps the box's x and y extents
+    CullingBounds bounds;
+    SDFInstance turned;
+    turned.aabbMin = Vector3(-3.0f, -1.0f, -1.0f);
+    turned.aabbMax = Vector3(3.0f, 1.0f, 1.0f);
+    turned.transform[0][0] = 0.0f;
+    turned.transform[0][1] = 1.0f;
+    turned.transform[1][0] = -1.0f;
+    turned.transform[1][1] = 0.0f;
+    turned.transform[3][0] = 5.0f;
+    bounds.Assign({turned}, true);
+    EXPECT_FLOAT_EQ(4.0f, bounds.minX[0]);
+    EXPECT_FLOAT_EQ(6.0f, bounds.maxX[0]);
+    EXPECT_FLOAT_EQ(-3.0f, bounds.minY[0]);
+    EXPECT_FLOAT_EQ(3.0f, bounds.maxY[0]);
+}
+
+TEST(ParallelCullingTest, PartialBatchesReportOnlyRealObjects) {
+    CullingBounds bounds;
+    bounds.Resize(13, false);
+    for (size_t i = 0; i < 13; i++) {
+        bounds.SetSphere(i, Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+        bounds.ids[i] = static_cast<uint32_t>(100 + i);
+    }
+    EXPECT_EQ(0u, bounds.centerX.size() % CullingBounds::kBatchPadding);
+
+    ParallelCullingSystem culling;
+    CullingResult result;
+    culling.CullBounds(bounds, MakeCamera(10.0f), result);
+
+    ASSERT_EQ(13u, result.totalVisible);
+    for (size_t i = 0; i < 13; i++) {
+        EXPECT_EQ(100 + i, result.visibleIndices[i]);
+    }
+
+    // Reusing the result keeps it consistent as the visible count changes
+    bounds.SetSphere(3, Vector3(50.0f, 0.0f, 0.0f), 1.0f);
+    culling.CullBounds(bounds, MakeCamera(10.0f), result);
+    EXPECT_EQ(12u, result.totalVisible);
+    EXPECT_EQ(12u, result.visibleIndices.size());
+    EXPECT_EQ(result.visibleIndices.end(),
+              std::find(result.visibleIndices.begin(), result.visibleIndices.end(), 103u));
+}
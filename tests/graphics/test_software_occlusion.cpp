@@ -0,0 +1,186 @@
+/**
+ * @file test_software_occlusion.cpp
+ * @brief Unit tests for the CPU occlusion rasteriser
+ */
+
+#include <gtest/gtest.h>
+
+#include "graphics/SoftwareOcclusion.hpp"
+#include "core/JobSystem.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace Nova;
+
+namespace {
+
+// Unit cube around the origin, counter-clockwise seen from outside
+const std::vector<glm::vec3> kCubeVertices = {
+    {-0.5f, -0.5f, -0.5f}, {0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, -0.5f}, {-0.5f, 0.5f, -0.5f},
+    {-0.5f, -0.5f, 0.5f},  {0.5f, -0.5f, 0.5f},  {0.5f, 0.5f, 0.5f},  {-0.5f, 0.5f, 0.5f},
+};
+const std::vector<uint32_t> kCubeIndices = {
+    4, 5, 6, 4, 6, 7,  // +z
+    1, 0, 3, 1, 3, 2,  // -z
+    5, 1, 2, 5, 2, 6,  // +x
+    0, 4, 7, 0, 7, 3,  // -x
+    7, 6, 2, 7, 2, 3,  // +y
+    0, 1, 5, 0, 5, 4,  // -y
+};
+
+glm::mat4 Box(const glm::vec3& center, const glm::vec3& size) {
+    return glm::scale(glm::translate(glm::mat4(1.0f), center), size);
+}
+
+AABB BoundsAt(const glm::vec3& center, float halfSize) {
+    return AABB(center - glm::vec3(halfSize), center + glm::vec3(halfSize));
+}
+
+/**
+ * @brief Camera at the origin looking down -z
+ */
+glm::mat4 ForwardView() {
+    return glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 500.0f) *
+           glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+SoftwareOcclusionSettings SerialSettings() {
+    SoftwareOcclusionSettings settings;
+    settings.useJobSystem = false;
+    return settings;
+}
+
+/**
+ * @brief 8 x 8 x 1 wall whose front face is 9.5 units ahead of the camera
+ */
+void AddWall(SoftwareOcclusionBuffer& buffer) {
+    buffer.AddOccluder(kCubeVertices, kCubeIndices, Box(glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(8.0f, 8.0f, 1.0f)));
+}
+
+} // namespace
+
+TEST(SoftwareOcclusionTest, HidesBoxesBehindOccluders) {
+    SoftwareOcclusionBuffer buffer(SerialSettings());
+    buffer.BeginFrame(ForwardView());
+    AddWall(buffer);
+
+    // Nothing is hidden before the occluders are rasterised
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f)));
+
+    buffer.Rasterize();
+    EXPECT_EQ(1u, buffer.GetStats().occluders);
+    EXPECT_EQ(12u, buffer.GetStats().triangles);
+
+    EXPECT_FALSE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f)));
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 0.0f, -5.0f), 1.0f)));
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(15.0f, 0.0f, -20.0f), 1.0f)));
+
+    // Pokes out above the wall
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 8.5f, -20.0f), 1.0f)));
+
+    // Behind the camera, and surrounding it
+    EXPECT_FALSE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 0.0f, 20.0f), 1.0f)));
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f), 1.0f)));
+}
+
+TEST(SoftwareOcclusionTest, MatchesSerialOnJobSystem) {
+    auto& jobs = JobSystem::Instance();
+    if (!jobs.IsInitialized()) {
+        ASSERT_TRUE(jobs.Initialize());
+    }
+
+    SoftwareOcclusionBuffer serial(SerialSettings());
+    SoftwareOcclusionBuffer parallel;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> across(-40.0f, 40.0f);
+    std::uniform_real_distribution<float> depth(-80.0f, -5.0f);
+    std::uniform_real_distribution<float> size(1.0f, 10.0f);
+
+    serial.BeginFrame(ForwardView());
+    parallel.BeginFrame(ForwardView());
+    for (int i = 0; i < 200; ++i) {
+        const glm::mat4 transform = Box(glm::vec3(across(rng), across(rng) * 0.5f, depth(rng)),
+                                        glm::vec3(size(rng), size(rng), size(rng)));
+        serial.AddOccluder(kCubeVertices, kCubeIndices, transform);
+        parallel.AddOccluder(kCubeVertices, kCubeIndices, transform);
+    }
+    serial.Rasterize();
+    parallel.Rasterize();
+
+    const auto expected = serial.GetDepth();
+    const auto actual = parallel.GetDepth();
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], actual[i]) << "pixel " << i;
+    }
+}
+
+TEST(SoftwareOcclusionTest, CullsBackFacesUnlessDisabled) {
+    // Single quad at z = -10, wound to face away from the camera
+    const std::vector<glm::vec3> quad = {
+        {-4.0f, -4.0f, -10.0f}, {4.0f, -4.0f, -10.0f}, {4.0f, 4.0f, -10.0f}, {-4.0f, 4.0f, -10.0f},
+    };
+    const std::vector<uint32_t> awayFromCamera = {0, 2, 1, 0, 3, 2};
+    const AABB behind = BoundsAt(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f);
+
+    SoftwareOcclusionBuffer buffer(SerialSettings());
+    buffer.BeginFrame(ForwardView());
+    buffer.AddOccluder(quad, awayFromCamera);
+    buffer.Rasterize();
+    EXPECT_EQ(0u, buffer.GetStats().rasterized);
+    EXPECT_TRUE(buffer.TestAABB(behind));
+
+    SoftwareOcclusionSettings twoSided = SerialSettings();
+    twoSided.cullBackFaces = false;
+    buffer.SetSettings(twoSided);
+    buffer.BeginFrame(ForwardView());
+    buffer.AddOccluder(quad, awayFromCamera);
+    buffer.Rasterize();
+    EXPECT_EQ(2u, buffer.GetStats().rasterized);
+    EXPECT_FALSE(buffer.TestAABB(behind));
+}
+
+TEST(SoftwareOcclusionTest, ClipsOccludersCrossingTheNearPlane) {
+    // Ground slab running from behind the camera far into the distance
+    SoftwareOcclusionBuffer buffer(SerialSettings());
+    buffer.BeginFrame(ForwardView());
+    buffer.AddOccluder(kCubeVertices, kCubeIndices, Box(glm::vec3(0.0f, -2.0f, -40.0f), glm::vec3(100.0f, 1.0f, 100.0f)));
+    buffer.Rasterize();
+
+    EXPECT_GT(buffer.GetStats().rasterized, 0u);
+    EXPECT_FALSE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, -5.0f, -20.0f), 1.0f)));
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 0.0f, -20.0f), 1.0f)));
+}
+
+TEST(SoftwareOcclusionTest, PointQueriesForLineOfSight) {
+    SoftwareOcclusionBuffer buffer(SerialSettings());
+    buffer.BeginFrame(ForwardView());
+    AddWall(buffer);
+    buffer.Rasterize();
+
+    EXPECT_FALSE(buffer.TestPoint(glm::vec3(0.0f, 0.0f, -30.0f)));
+    EXPECT_TRUE(buffer.TestPoint(glm::vec3(0.0f, 0.0f, -8.0f)));
+    EXPECT_TRUE(buffer.TestPoint(glm::vec3(20.0f, 0.0f, -30.0f)));
+    EXPECT_FALSE(buffer.TestPoint(glm::vec3(0.0f, 0.0f, 5.0f)));      // Behind the eye
+    EXPECT_FALSE(buffer.TestPoint(glm::vec3(200.0f, 0.0f, -10.0f)));  // Outside the view
+}
+
+TEST(SoftwareOcclusionTest, OrthographicTopDownView) {
+    // Fog of war: looking straight down on a 100 x 100 area
+    const glm::mat4 viewProjection =
+        glm::ortho(-50.0f, 50.0f, -50.0f, 50.0f, 1.0f, 200.0f) *
+        glm::lookAt(glm::vec3(0.0f, 100.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+
+    SoftwareOcclusionBuffer buffer(SerialSettings());
+    buffer.BeginFrame(viewProjection);
+    buffer.AddOccluder(kCubeVertices, kCubeIndices, Box(glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(10.0f)));
+    buffer.Rasterize();
+
+    EXPECT_FALSE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, -1.0f, 0.0f), 0.5f)));
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(20.0f, -1.0f, 0.0f), 0.5f)));
+    EXPECT_TRUE(buffer.TestAABB(BoundsAt(glm::vec3(0.0f, 12.0f, 0.0f), 0.5f)));  // On the roof
+}
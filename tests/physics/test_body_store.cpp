@@ -0,0 +1,336 @@
+/**
+ * @file test_body_store.cpp
+ * @brief Unit tests for the SoA physics body store and its batch kernels
+ *
+ * Test categories:
+ * - Attach/detach and swap-remove slot bookkeeping
+ * - CollisionBody accessors routed through the store
+ * - SIMD kernels against a scalar reference (including the tail lanes)
+ * - PhysicsWorld integration
+ */
+
+#include <gtest/gtest.h>
+
+#include "physics/BodyStore.hpp"
+#include "physics/PhysicsWorld.hpp"
+
+#include "../utils/TestHelpers.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Nova;
+using namespace Nova::Test;
+
+namespace {
+
+struct ReferenceBody {
+    glm::vec3 position{0.0f};
+    glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::vec3 linearVelocity{0.0f};
+    glm::vec3 angularVelocity{0.0f};
+    glm::vec3 force{0.0f};
+};
+
+/**
+ * @brief Builds a mix of dynamic, kinematic, static and sleeping bodies
+ *
+ * 37 bodies so every SIMD width leaves a scalar tail.
+ */
+class BodyStoreKernelTest : public ::testing::Test {
+protected:
+    static constexpr int kBodyCount = 37;
+
+    void SetUp() override {
+        for (int i = 0; i < kBodyCount; ++i) {
+            BodyType type = BodyType::Dynamic;
+            if (i % 7 == 3) type = BodyType::Static;
+            if (i % 7 == 5) type = BodyType::Kinematic;
+
+            auto body = std::make_unique<CollisionBody>(type);
+            body->AddShape(CollisionShape::CreateSphere(0.5f));
+            body->SetMass(RandomFloat(0.5f, 4.0f));
+            body->SetLinearDamping(RandomFloat(0.0f, 0.3f));
+            body->SetAngularDamping(RandomFloat(0.0f, 0.3f));
+            body->SetGravityScale(RandomFloat(0.0f, 2.0f));
+            body->SetPosition(RandomVec3(-10.0f, 10.0f));
+            body->SetRotation(RandomQuat());
+            body->SetLinearVelocity(RandomVec3(-2.0f, 2.0f));
+            body->SetAngularVelocity(RandomVec3(-1.0f, 1.0f));
+            body->ApplyForce(RandomVec3(-20.0f, 20.0f));
+            if (i % 5 == 1) {
+                body->SetSleeping(true);
+            }
+            if (i % 11 == 2) {
+                body->SetEnabled(false);
+            }
+
+            store.Attach(*body);
+            bodies.push_back(std::move(body));
+        }
+    }
+
+    void TearDown() override {
+        store.Clear();
+    }
+
+    std::vector<ReferenceBody> Capture() const {
+        std::vector<ReferenceBody> result;
+        for (const auto& body : bodies) {
+            result.push_back({body->GetPosition(), body->GetRotation(), body->GetLinearVelocity(),
+                              body->GetAngularVelocity(), body->GetAccumulatedForce()});
+        }
+        return result;
+    }
+
+    static bool IsAwake(const CollisionBody& body) {
+        return body.IsEnabled() && !body.IsSleeping();
+    }
+
+    PhysicsBodyStore store;
+    std::vector<std::unique_ptr<CollisionBody>> bodies;
+};
+
+} // namespace
+
+// =============================================================================
+// Attachment Tests
+// =============================================================================
+
+TEST(PhysicsBodyStoreTest, AttachRoutesAccessorsThroughStore) {
+    PhysicsBodyStore store;
+    CollisionBody body(BodyType::Dynamic);
+    body.SetPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    body.SetLinearVelocity(glm::vec3(0.0f, 4.0f, 0.0f));
+
+    const PhysicsBodyStore::Slot slot = store.Attach(body);
+    ASSERT_EQ(1u, store.Size());
+    EXPECT_EQ(&body, store.GetBody(slot));
+    EXPECT_VEC3_EQ(glm::vec3(1.0f, 2.0f, 3.0f), store.GetPosition(slot));
+
+    // Writes through the handle land in the store and vice versa
+    body.SetPosition(glm::vec3(5.0f, 0.0f, 0.0f));
+    EXPECT_VEC3_EQ(glm::vec3(5.0f, 0.0f, 0.0f), store.GetPosition(slot));
+    store.SetLinearVelocity(slot, glm::vec3(0.0f, 0.0f, -1.0f));
+    EXPECT_VEC3_EQ(glm::vec3(0.0f, 0.0f, -1.0f), body.GetLinearVelocity());
+
+    store.Detach(body);
+    EXPECT_EQ(0u, store.Size());
+    EXPECT_VEC3_EQ(glm::vec3(5.0f, 0.0f, 0.0f), body.GetPosition());
+    EXPECT_VEC3_EQ(glm::vec3(0.0f, 0.0f, -1.0f), body.GetLinearVelocity());
+}
+
+TEST(PhysicsBodyStoreTest, DetachMovesLastBodyIntoGap) {
+    PhysicsBodyStore store;
+    CollisionBody a(BodyType::Dynamic);
+    CollisionBody b(BodyType::Dynamic);
+    CollisionBody c(BodyType::Dynamic);
+    a.SetPosition(glm::vec3(1.0f));
+    b.SetPosition(glm::vec3(2.0f));
+    c.SetPosition(glm::vec3(3.0f));
+    store.Attach(a);
+    store.Attach(b);
+    store.Attach(c);
+
+    store.Detach(a);
+
+    ASSERT_EQ(2u, store.Size());
+    EXPECT_EQ(&c, store.GetBody(0));
+    EXPECT_EQ(&b, store.GetBody(1));
+    EXPECT_VEC3_EQ(glm::vec3(3.0f), c.GetPosition());
+    EXPECT_VEC3_EQ(glm::vec3(2.0f), b.GetPosition());
+
+    // The moved body still writes to its own (new) slot
+    c.SetPosition(glm::vec3(-3.0f));
+    EXPECT_VEC3_EQ(glm::vec3(-3.0f), store.GetPosition(0));
+    EXPECT_VEC3_EQ(glm::vec3(2.0f), store.GetPosition(1));
+}
+
+TEST(PhysicsBodyStoreTest, DestroyedBodyDetachesItself) {
+    PhysicsBodyStore store;
+    CollisionBody kept(BodyType::Dynamic);
+    store.Attach(kept);
+    {
+        CollisionBody temporary(BodyType::Dynamic);
+        store.Attach(temporary);
+        EXPECT_EQ(2u, store.Size());
+    }
+    EXPECT_EQ(1u, store.Size());
+    EXPECT_EQ(&kept, store.GetBody(0));
+}
+
+TEST(PhysicsBodyStoreTest, MovedBodiesKeepTheirSlots) {
+    // Growing the vector moves every attached body to a new address
+    PhysicsBodyStore store;
+    std::vector<CollisionBody> bodies;
+    for (int i = 0; i < 33; ++i) {
+        bodies.emplace_back(BodyType::Dynamic);
+        if (bodies.size() == 1) {
+            store.Attach(bodies.front());
+            bodies.front().SetPosition(glm::vec3(7.0f));
+        }
+    }
+
+    ASSERT_EQ(1u, store.Size());
+    EXPECT_EQ(&bodies.front(), store.GetBody(0));
+    EXPECT_VEC3_EQ(glm::vec3(7.0f), bodies.front().GetPosition());
+
+    // Move assignment over an attached body releases the target's own slot
+    CollisionBody other(BodyType::Dynamic);
+    store.Attach(other);
+    other = std::move(bodies.front());
+    ASSERT_EQ(1u, store.Size());
+    EXPECT_EQ(&other, store.GetBody(0));
+    EXPECT_VEC3_EQ(glm::vec3(7.0f), other.GetPosition());
+
+    // Destroying the moved-from bodies leaves the slot alone
+    bodies.clear();
+    ASSERT_EQ(1u, store.Size());
+    other.SetPosition(glm::vec3(-1.0f));
+    EXPECT_VEC3_EQ(glm::vec3(-1.0f), store.GetPosition(0));
+}
+
+// =============================================================================
+// Kernel Tests
+// =============================================================================
+
+TEST_F(BodyStoreKernelTest, IntegrateForcesMatchesScalarReference) {
+    const glm::vec3 gravity(0.0f, -9.81f, 0.0f);
+    const float dt = 1.0f / 60.0f;
+    const std::vector<ReferenceBody> before = Capture();
+
+    store.IntegrateForces(gravity, dt);
+
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        const CollisionBody& body = *bodies[i];
+        ReferenceBody expected = before[i];
+
+        if (IsAwake(body) && body.IsDynamic()) {
+            glm::vec3 accel = gravity * body.GetGravityScale() + expected.force * body.GetInverseMass();
+            expected.linearVelocity = (expected.linearVelocity + accel * dt) *
+                                      std::pow(1.0f - body.GetLinearDamping(), dt);
+            expected.angularVelocity *= std::pow(1.0f - body.GetAngularDamping(), dt);
+            expected.force = glm::vec3(0.0f);
+        }
+
+        EXPECT_VEC3_NEAR(expected.linearVelocity, body.GetLinearVelocity(), 1e-4f) << "body " << i;
+        EXPECT_VEC3_NEAR(expected.angularVelocity, body.GetAngularVelocity(), 1e-4f) << "body " << i;
+        EXPECT_VEC3_NEAR(expected.force, body.GetAccumulatedForce(), 1e-4f) << "body " << i;
+    }
+}
+
+TEST_F(BodyStoreKernelTest, IntegratePositionsMatchesScalarReference) {
+    const float dt = 1.0f / 60.0f;
+    const std::vector<ReferenceBody> before = Capture();
+
+    store.IntegratePositions(dt);
+
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        const CollisionBody& body = *bodies[i];
+        ReferenceBody expected = before[i];
+
+        if (IsAwake(body) && !body.IsStatic()) {
+            expected.position += expected.linearVelocity * dt;
+
+            const glm::vec3 w = expected.angularVelocity;
+            glm::quat spin(0.0f, w.x, w.y, w.z);
+            expected.rotation = glm::normalize(expected.rotation + (spin * expected.rotation) * (dt * 0.5f));
+        }
+
+        EXPECT_VEC3_NEAR(expected.position, body.GetPosition(), 1e-4f) << "body " << i;
+        EXPECT_TRUE(QuatEqual(expected.rotation, body.GetRotation(), 1e-4f)) << "body " << i;
+    }
+}
+
+TEST_F(BodyStoreKernelTest, MovedBodiesAreFlaggedDirty) {
+    for (PhysicsBodyStore::Slot slot = 0; slot < store.Size(); ++slot) {
+        store.ClearFlags(slot, PhysicsBodyStore::FlagBoundsDirty | PhysicsBodyStore::FlagBroadPhaseDirty);
+    }
+
+    store.IntegratePositions(1.0f / 60.0f);
+
+    for (PhysicsBodyStore::Slot slot = 0; slot < store.Size(); ++slot) {
+        const CollisionBody& body = *store.GetBody(slot);
+        const bool moved = IsAwake(body) && !body.IsStatic();
+        EXPECT_EQ(moved, (store.GetFlags(slot) & PhysicsBodyStore::FlagBroadPhaseDirty) != 0) << "slot " << slot;
+    }
+}
+
+TEST_F(BodyStoreKernelTest, SleepTimersAdvanceOnlyForSlowAwakeDynamicBodies) {
+    const float threshold = 1.0f;
+    const float dt = 0.1f;
+
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        // Alternate slow and fast bodies; setters would wake, so write the store
+        const auto slot = static_cast<PhysicsBodyStore::Slot>(i);
+        store.SetLinearVelocity(slot, glm::vec3(i % 2 == 0 ? 0.1f : 3.0f, 0.0f, 0.0f));
+        store.SetAngularVelocity(slot, glm::vec3(0.0f));
+        store.SetSleepTimer(slot, 0.5f);
+    }
+
+    store.UpdateSleepTimers(threshold, threshold, dt);
+
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        const CollisionBody& body = *bodies[i];
+        const auto slot = static_cast<PhysicsBodyStore::Slot>(i);
+
+        float expected = 0.5f;
+        if (IsAwake(body) && body.IsDynamic()) {
+            expected = (i % 2 == 0) ? 0.6f : 0.0f;
+        }
+        EXPECT_NEAR(expected, store.GetSleepTimer(slot), 1e-5f) << "body " << i;
+    }
+}
+
+TEST_F(BodyStoreKernelTest, CountActiveFollowsSleepAndEnabledState) {
+    auto countAwake = [this] {
+        size_t count = 0;
+        for (const auto& body : bodies) {
+            count += IsAwake(*body) ? 1 : 0;
+        }
+        return count;
+    };
+    EXPECT_EQ(countAwake(), store.CountActive());
+
+    bodies[0]->SetSleeping(true);
+    bodies[1]->WakeUp();
+    bodies[4]->SetEnabled(false);
+    EXPECT_EQ(countAwake(), store.CountActive());
+}
+
+// =============================================================================
+// PhysicsWorld Integration Tests
+// =============================================================================
+
+TEST(PhysicsBodyStoreWorldTest, WorldKeepsStoreInSyncWithBodies) {
+    PhysicsWorldConfig config;
+    config.gravity = glm::vec3(0.0f, -10.0f, 0.0f);
+    PhysicsWorld world(config);
+
+    std::vector<CollisionBody*> bodies;
+    for (int i = 0; i < 5; ++i) {
+        auto* body = world.CreateBody(BodyType::Dynamic);
+        body->AddShape(CollisionShape::CreateSphere(0.25f));
+        body->SetPosition(glm::vec3(static_cast<float>(i) * 2.0f, 10.0f, 0.0f));
+        bodies.push_back(body);
+    }
+    EXPECT_EQ(5u, world.GetBodyStore().Size());
+
+    // Removing from the middle moves the last body into the freed slot
+    world.RemoveBody(bodies[1]);
+    EXPECT_EQ(4u, world.GetBodyStore().Size());
+    EXPECT_VEC3_EQ(glm::vec3(8.0f, 10.0f, 0.0f), bodies[4]->GetPosition());
+
+    for (int i = 0; i < 30; ++i) {
+        world.FixedStep();
+    }
+
+    // Free fall, read back through the handles
+    for (CollisionBody* body : {bodies[0], bodies[2], bodies[3], bodies[4]}) {
+        EXPECT_LT(body->GetPosition().y, 9.0f);
+        EXPECT_LT(body->GetLinearVelocity().y, -4.0f);
+    }
+    EXPECT_NEAR(bodies[0]->GetPosition().y, bodies[4]->GetPosition().y, 1e-4f);
+    EXPECT_EQ(4u, world.GetStats().activeBodyCount);
+}
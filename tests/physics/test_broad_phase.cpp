@@ -0,0 +1,239 @@
+/**
+ * @file test_broad_phase.cpp
+ * @brief Unit tests for the persistent sweep-and-prune broad phase
+ *
+ * Test categories:
+ * - Pair creation and removal as proxies move
+ * - Add/remove deltas reconstruct the pair set
+ * - Agreement with brute-force overlap under random motion
+ * - PhysicsWorld integration
+ */
+
+#include <gtest/gtest.h>
+
+#include "physics/BroadPhase.hpp"
+#include "physics/PhysicsWorld.hpp"
+
+#include "../utils/TestHelpers.hpp"
+
+#include <random>
+#include <set>
+#include <utility>
+
+using namespace Nova;
+using namespace Nova::Test;
+
+namespace {
+
+using PairSet = std::set<std::pair<CollisionBody::BodyId, CollisionBody::BodyId>>;
+
+AABB MakeBox(const glm::vec3& center, float halfSize) {
+    return AABB{center - glm::vec3(halfSize), center + glm::vec3(halfSize)};
+}
+
+PairSet ToSet(const std::vector<CollisionPair>& pairs) {
+    PairSet result;
+    for (const auto& pair : pairs) {
+        result.insert({pair.bodyA, pair.bodyB});
+    }
+    return result;
+}
+
+} // namespace
+
+// =============================================================================
+// Pair Tracking Tests
+// =============================================================================
+
+TEST(SweepAndPruneTest, OverlappingProxiesFormPair) {
+    SweepAndPruneBroadPhase broadPhase(0.0f);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(0.0f), 1.0f), 1);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(1.5f, 0.0f, 0.0f), 1.0f), 2);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(10.0f, 0.0f, 0.0f), 1.0f), 3);
+    broadPhase.Update();
+
+    ASSERT_EQ(1u, broadPhase.GetPairs().size());
+    EXPECT_EQ(1u, broadPhase.GetPairs()[0].bodyA);
+    EXPECT_EQ(2u, broadPhase.GetPairs()[0].bodyB);
+    EXPECT_EQ(1u, broadPhase.GetAddedPairs().size());
+    EXPECT_TRUE(broadPhase.GetRemovedPairs().empty());
+}
+
+TEST(SweepAndPruneTest, OverlapOnOneAxisIsNotAPair) {
+    SweepAndPruneBroadPhase broadPhase(0.0f);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(0.0f), 1.0f), 1);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(0.5f, 5.0f, 0.0f), 1.0f), 2);
+    broadPhase.Update();
+
+    EXPECT_TRUE(broadPhase.GetPairs().empty());
+}
+
+TEST(SweepAndPruneTest, MovingApartReportsRemoval) {
+    SweepAndPruneBroadPhase broadPhase(0.0f);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(0.0f), 1.0f), 1);
+    auto proxy = broadPhase.CreateProxy(MakeBox(glm::vec3(1.0f, 0.0f, 0.0f), 1.0f), 2);
+    broadPhase.Update();
+    ASSERT_EQ(1u, broadPhase.GetPairs().size());
+
+    EXPECT_TRUE(broadPhase.MoveProxy(proxy, MakeBox(glm::vec3(0.0f, 0.0f, 5.0f), 1.0f)));
+    broadPhase.Update();
+
+    EXPECT_TRUE(broadPhase.GetPairs().empty());
+    EXPECT_TRUE(broadPhase.GetAddedPairs().empty());
+    ASSERT_EQ(1u, broadPhase.GetRemovedPairs().size());
+    EXPECT_EQ(2u, broadPhase.GetRemovedPairs()[0].bodyB);
+}
+
+TEST(SweepAndPruneTest, MoveWithinMarginIsIgnored) {
+    SweepAndPruneBroadPhase broadPhase(0.5f);
+    auto proxy = broadPhase.CreateProxy(MakeBox(glm::vec3(0.0f), 1.0f), 1);
+    broadPhase.Update();
+
+    EXPECT_FALSE(broadPhase.MoveProxy(proxy, MakeBox(glm::vec3(0.25f, 0.0f, 0.0f), 1.0f)));
+    EXPECT_TRUE(broadPhase.MoveProxy(proxy, MakeBox(glm::vec3(1.0f, 0.0f, 0.0f), 1.0f)));
+}
+
+TEST(SweepAndPruneTest, TouchingBoundsOverlap) {
+    // Matches AABB::Intersects, which is inclusive
+    SweepAndPruneBroadPhase broadPhase(0.0f);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(0.0f), 1.0f), 1);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(2.0f, 0.0f, 0.0f), 1.0f), 2);
+    broadPhase.Update();
+
+    EXPECT_EQ(1u, broadPhase.GetPairs().size());
+}
+
+TEST(SweepAndPruneTest, DestroyProxyRemovesItsPairs) {
+    SweepAndPruneBroadPhase broadPhase(0.0f);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(0.0f), 1.0f), 1);
+    auto proxy = broadPhase.CreateProxy(MakeBox(glm::vec3(0.5f), 1.0f), 2);
+    broadPhase.CreateProxy(MakeBox(glm::vec3(-0.5f), 1.0f), 3);
+    broadPhase.Update();
+    ASSERT_EQ(3u, broadPhase.GetPairs().size());
+
+    broadPhase.DestroyProxy(proxy);
+    broadPhase.Update();
+
+    EXPECT_EQ(2u, broadPhase.GetProxyCount());
+    EXPECT_EQ(PairSet({{1, 3}}), ToSet(broadPhase.GetPairs()));
+    EXPECT_EQ(2u, broadPhase.GetRemovedPairs().size());
+}
+
+// =============================================================================
+// Randomized Agreement Tests
+// =============================================================================
+
+TEST(SweepAndPruneTest, MatchesBruteForceUnderRandomMotion) {
+    struct TestBody {
+        CollisionBody::BodyId id;
+        SweepAndPruneBroadPhase::ProxyId proxy;
+        AABB bounds;
+        bool alive;
+    };
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> position(0.0f, 40.0f);
+    std::uniform_real_distribution<float> step(-0.4f, 0.4f);
+    std::uniform_real_distribution<float> size(0.2f, 2.0f);
+
+    SweepAndPruneBroadPhase broadPhase(0.1f);
+    std::vector<TestBody> bodies;
+    CollisionBody::BodyId nextId = 1;
+
+    auto spawn = [&]() {
+        AABB bounds = MakeBox(glm::vec3(position(rng), position(rng) * 0.2f, position(rng)), size(rng));
+        TestBody body{nextId++, 0, bounds, true};
+        body.proxy = broadPhase.CreateProxy(bounds, body.id);
+        bodies.push_back(body);
+    };
+
+    for (int i = 0; i < 300; ++i) {
+        spawn();
+    }
+
+    PairSet previous;
+    for (int frame = 0; frame < 120; ++frame) {
+        for (auto& body : bodies) {
+            if (!body.alive || rng() % 3 != 0) continue;
+            glm::vec3 delta(step(rng), step(rng), step(rng));
+            body.bounds = AABB{body.bounds.min + delta, body.bounds.max + delta};
+            broadPhase.MoveProxy(body.proxy, body.bounds);
+        }
+
+        // Occasional bursts exercise the full-rebuild path
+        const int churn = (frame % 40 == 0) ? 50 : 2;
+        for (int i = 0; i < churn; ++i) {
+            if (rng() % 2) {
+                spawn();
+            } else {
+                auto& body = bodies[rng() % bodies.size()];
+                if (body.alive) {
+                    body.alive = false;
+                    broadPhase.DestroyProxy(body.proxy);
+                }
+            }
+        }
+
+        broadPhase.Update();
+
+        PairSet expected;
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            if (!bodies[i].alive) continue;
+            for (size_t j = i + 1; j < bodies.size(); ++j) {
+                if (!bodies[j].alive) continue;
+                if (broadPhase.GetFatAABB(bodies[i].proxy).Intersects(broadPhase.GetFatAABB(bodies[j].proxy))) {
+                    expected.insert({std::min(bodies[i].id, bodies[j].id), std::max(bodies[i].id, bodies[j].id)});
+                }
+            }
+        }
+
+        PairSet current = ToSet(broadPhase.GetPairs());
+        ASSERT_EQ(broadPhase.GetPairs().size(), current.size()) << "duplicate pair at frame " << frame;
+        ASSERT_EQ(expected, current) << "frame " << frame;
+
+        PairSet reconstructed = previous;
+        for (const auto& pair : broadPhase.GetRemovedPairs()) {
+            ASSERT_EQ(1u, reconstructed.erase({pair.bodyA, pair.bodyB}));
+        }
+        for (const auto& pair : broadPhase.GetAddedPairs()) {
+            ASSERT_TRUE(reconstructed.insert({pair.bodyA, pair.bodyB}).second);
+        }
+        ASSERT_EQ(current, reconstructed) << "frame " << frame;
+
+        previous = std::move(current);
+    }
+}
+
+// =============================================================================
+// PhysicsWorld Integration Tests
+// =============================================================================
+
+TEST(SweepAndPruneTest, WorldReportsPairsForOverlappingBodies) {
+    PhysicsWorldConfig config;
+    config.gravity = glm::vec3(0.0f);
+    PhysicsWorld world(config);
+
+    auto* a = world.CreateBody(BodyType::Dynamic);
+    a->AddShape(CollisionShape::CreateSphere(1.0f));
+    a->SetPosition(glm::vec3(0.0f));
+
+    auto* b = world.CreateBody(BodyType::Dynamic);
+    b->AddShape(CollisionShape::CreateSphere(1.0f));
+    b->SetPosition(glm::vec3(1.5f, 0.0f, 0.0f));
+
+    auto* distant = world.CreateBody(BodyType::Dynamic);
+    distant->AddShape(CollisionShape::CreateSphere(1.0f));
+    distant->SetPosition(glm::vec3(50.0f, 0.0f, 0.0f));
+
+    world.FixedStep();
+
+    EXPECT_EQ(1u, world.GetStats().broadPhasePairs);
+    EXPECT_EQ(PairSet({{std::min(a->GetId(), b->GetId()), std::max(a->GetId(), b->GetId())}}),
+              ToSet(world.GetBroadPhase().GetPairs()));
+
+    world.RemoveBody(b);
+    world.FixedStep();
+
+    EXPECT_EQ(0u, world.GetStats().broadPhasePairs);
+    EXPECT_EQ(1u, world.GetStats().broadPhasePairsRemoved);
+}
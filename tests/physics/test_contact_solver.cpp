@@ -0,0 +1,254 @@
+/**
+ * @file test_contact_solver.cpp
+ * @brief Unit tests for the island-based contact solver
+ *
+ * Test categories:
+ * - Resting contact and stacking stability
+ * - Warm starting of cached manifold impulses
+ * - Island construction and island sleeping
+ * - Triggers and restitution
+ */
+
+#include <gtest/gtest.h>
+
+#include "physics/ContactSolver.hpp"
+#include "physics/PhysicsWorld.hpp"
+
+#include "../utils/TestHelpers.hpp"
+
+#include <cmath>
+
+using namespace Nova;
+using namespace Nova::Test;
+
+namespace {
+
+class ContactSolverTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        PhysicsWorldConfig config;
+        config.gravity = glm::vec3(0.0f, -9.81f, 0.0f);
+        config.fixedTimestep = 1.0f / 60.0f;
+        world = std::make_unique<PhysicsWorld>(config);
+
+        ground = world->CreateBody(BodyType::Static);
+        ground->AddShape(CollisionShape::CreateBox(glm::vec3(50.0f, 0.5f, 50.0f)));
+        ground->SetPosition(glm::vec3(0.0f, -0.5f, 0.0f));
+    }
+
+    CollisionBody* CreateBox(const glm::vec3& position, float halfExtent = 0.5f) {
+        auto* body = world->CreateBody(BodyType::Dynamic);
+        body->AddShape(CollisionShape::CreateBox(glm::vec3(halfExtent)));
+        body->SetPosition(position);
+        return body;
+    }
+
+    CollisionBody* CreateSphere(const glm::vec3& position, float radius = 0.5f) {
+        auto* body = world->CreateBody(BodyType::Dynamic);
+        body->AddShape(CollisionShape::CreateSphere(radius));
+        body->SetPosition(position);
+        return body;
+    }
+
+    void Step(int steps) {
+        for (int i = 0; i < steps; ++i) {
+            world->FixedStep();
+        }
+    }
+
+    std::unique_ptr<PhysicsWorld> world;
+    CollisionBody* ground = nullptr;
+};
+
+} // namespace
+
+// =============================================================================
+// Resting Contact Tests
+// =============================================================================
+
+TEST_F(ContactSolverTest, SphereRestsOnGround) {
+    auto* sphere = CreateSphere(glm::vec3(0.0f, 2.0f, 0.0f));
+
+    Step(180);
+
+    EXPECT_NEAR(0.5f, sphere->GetPosition().y, 0.05f);
+    EXPECT_LT(std::abs(sphere->GetLinearVelocity().y), 0.1f);
+}
+
+TEST_F(ContactSolverTest, BoxStackStaysUpright) {
+    std::vector<CollisionBody*> stack;
+    for (int i = 0; i < 4; ++i) {
+        stack.push_back(CreateBox(glm::vec3(0.0f, 0.5f + static_cast<float>(i) * 1.0f, 0.0f)));
+    }
+
+    Step(240);
+
+    for (size_t i = 0; i < stack.size(); ++i) {
+        const glm::vec3 position = stack[i]->GetPosition();
+        EXPECT_NEAR(0.5f + static_cast<float>(i), position.y, 0.1f) << "box " << i;
+        EXPECT_NEAR(0.0f, position.x, 0.05f) << "box " << i;
+        EXPECT_NEAR(0.0f, position.z, 0.05f) << "box " << i;
+    }
+}
+
+TEST_F(ContactSolverTest, BoxFarFromGroundCenterRests) {
+    // Box-box normals come from face axes, not the direction between centers
+    auto* box = CreateBox(glm::vec3(30.0f, 0.6f, -20.0f));
+
+    Step(120);
+
+    EXPECT_NEAR(0.5f, box->GetPosition().y, 0.05f);
+    EXPECT_NEAR(30.0f, box->GetPosition().x, 0.05f);
+}
+
+// =============================================================================
+// Warm Starting Tests
+// =============================================================================
+
+TEST(ContactManifoldTest, MatchingPointInheritsImpulse) {
+    CollisionBody a(BodyType::Dynamic);
+    CollisionBody b(BodyType::Static);
+    a.AddShape(CollisionShape::CreateSphere(0.5f));
+    b.AddShape(CollisionShape::CreateBox(glm::vec3(1.0f)));
+
+    ContactPoint contact;
+    contact.position = glm::vec3(0.0f, 1.0f, 0.0f);
+    contact.normal = glm::vec3(0.0f, -1.0f, 0.0f);
+    contact.penetration = 0.02f;
+
+    ContactManifold manifold;
+    manifold.bodyA = &a;
+    manifold.bodyB = &b;
+    ASSERT_EQ(1u, manifold.Update({contact}, true));
+    manifold.points[0].normalImpulse = 3.0f;
+    manifold.points[0].tangentImpulse[0] = 0.5f;
+
+    // Slightly moved point on the same feature keeps its impulse
+    contact.position += glm::vec3(0.01f, 0.0f, 0.0f);
+    ASSERT_EQ(1u, manifold.Update({contact}, true));
+    EXPECT_FLOAT_EQ(3.0f, manifold.points[0].normalImpulse);
+    EXPECT_FLOAT_EQ(0.5f, manifold.points[0].tangentImpulse[0]);
+
+    // A different normal is a new feature
+    contact.normal = glm::vec3(1.0f, 0.0f, 0.0f);
+    ASSERT_EQ(1u, manifold.Update({contact}, true));
+    EXPECT_FLOAT_EQ(0.0f, manifold.points[0].normalImpulse);
+}
+
+TEST(ContactManifoldTest, KeepsDeepestPoints) {
+    CollisionBody a(BodyType::Dynamic);
+    CollisionBody b(BodyType::Static);
+    a.AddShape(CollisionShape::CreateBox(glm::vec3(0.5f)));
+    b.AddShape(CollisionShape::CreateBox(glm::vec3(1.0f)));
+
+    std::vector<ContactPoint> contacts;
+    for (int i = 0; i < 6; ++i) {
+        ContactPoint contact;
+        contact.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+        contact.normal = glm::vec3(0.0f, 1.0f, 0.0f);
+        contact.penetration = 0.01f * static_cast<float>(i + 1);
+        contacts.push_back(contact);
+    }
+
+    ContactManifold manifold;
+    manifold.bodyA = &a;
+    manifold.bodyB = &b;
+    ASSERT_EQ(ContactManifold::kMaxPoints, manifold.Update(contacts, false));
+
+    for (uint32_t i = 0; i < manifold.pointCount; ++i) {
+        EXPECT_GE(manifold.points[i].penetration, 0.03f - 1e-6f);
+    }
+}
+
+TEST_F(ContactSolverTest, WarmStartingConvergesWithFewIterations) {
+    // One iteration per step is only stable for a stack if impulses carry over
+    PhysicsWorldConfig config = world->GetConfig();
+    config.velocityIterations = 1;
+    world->SetConfig(config);
+
+    std::vector<CollisionBody*> stack;
+    for (int i = 0; i < 3; ++i) {
+        stack.push_back(CreateBox(glm::vec3(0.0f, 0.5f + static_cast<float>(i), 0.0f)));
+    }
+
+    Step(240);
+
+    EXPECT_NEAR(2.5f, stack.back()->GetPosition().y, 0.15f);
+}
+
+// =============================================================================
+// Island Tests
+// =============================================================================
+
+TEST_F(ContactSolverTest, SeparateStacksFormSeparateIslands) {
+    CreateBox(glm::vec3(-5.0f, 0.5f, 0.0f));
+    CreateBox(glm::vec3(-5.0f, 1.5f, 0.0f));
+    CreateBox(glm::vec3(5.0f, 0.5f, 0.0f));
+    CreateSphere(glm::vec3(20.0f, 0.5f, 0.0f));
+
+    Step(2);
+
+    // Static ground does not join islands
+    EXPECT_EQ(3u, world->GetStats().islandCount);
+}
+
+TEST_F(ContactSolverTest, IslandSleepsAsAUnit) {
+    auto* bottom = CreateBox(glm::vec3(0.0f, 0.5f, 0.0f));
+    auto* top = CreateBox(glm::vec3(0.0f, 1.5f, 0.0f));
+
+    Step(600);
+
+    EXPECT_TRUE(bottom->IsSleeping());
+    EXPECT_TRUE(top->IsSleeping());
+    EXPECT_EQ(0u, world->GetStats().awakeIslandCount);
+}
+
+TEST_F(ContactSolverTest, TouchingSleepingIslandWakesIt) {
+    auto* bottom = CreateBox(glm::vec3(0.0f, 0.5f, 0.0f));
+    auto* top = CreateBox(glm::vec3(0.0f, 1.5f, 0.0f));
+    Step(600);
+    ASSERT_TRUE(bottom->IsSleeping());
+    ASSERT_TRUE(top->IsSleeping());
+
+    auto* falling = CreateSphere(glm::vec3(0.0f, 3.5f, 0.0f));
+    falling->SetLinearVelocity(glm::vec3(0.0f, -5.0f, 0.0f));
+    Step(30);
+
+    EXPECT_FALSE(top->IsSleeping());
+    EXPECT_FALSE(bottom->IsSleeping());
+}
+
+// =============================================================================
+// Trigger and Restitution Tests
+// =============================================================================
+
+TEST_F(ContactSolverTest, TriggerDoesNotPushBodies) {
+    auto* zone = world->CreateBody(BodyType::Static);
+    CollisionShape shape = CollisionShape::CreateBox(glm::vec3(2.0f));
+    shape.SetTrigger(true);
+    zone->AddShape(shape);
+    zone->SetPosition(glm::vec3(0.0f, 5.0f, 0.0f));
+
+    auto* sphere = CreateSphere(glm::vec3(0.0f, 8.0f, 0.0f));
+
+    Step(90);
+
+    // Fell straight through the trigger volume
+    EXPECT_LT(sphere->GetPosition().y, 3.0f);
+}
+
+TEST_F(ContactSolverTest, SlowContactDoesNotBounce) {
+    auto* sphere = world->CreateBody(BodyType::Dynamic);
+    CollisionShape shape = CollisionShape::CreateSphere(0.5f);
+    PhysicsMaterial bouncy = shape.GetMaterial();
+    bouncy.restitution = 1.0f;
+    shape.SetMaterial(bouncy);
+    sphere->AddShape(shape);
+    sphere->SetPosition(glm::vec3(0.0f, 0.55f, 0.0f));
+
+    Step(120);
+
+    // Below the restitution threshold the sphere settles instead of jittering
+    EXPECT_NEAR(0.5f, sphere->GetPosition().y, 0.05f);
+    EXPECT_LT(std::abs(sphere->GetLinearVelocity().y), 0.2f);
+}